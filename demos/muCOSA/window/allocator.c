@@ -0,0 +1,319 @@
+/*
+============================================================
+                        DEMO INFO
+
+DEMO NAME:          allocator.c
+DEMO WRITTEN BY:    Muukid
+CREATION DATE:      2026-10-18
+LAST UPDATED:       2026-10-18
+
+============================================================
+                        DEMO PURPOSE
+
+This demo shows how to create a mug context with a custom allocator,
+using a block pool for object buffers and a frame arena for scratch
+memory, and how to read the allocation counts of each category.
+
+============================================================
+                        LICENSE INFO
+
+This software is licensed under:
+(MIT license OR public domain) AND Apache 2.0.
+More explicit license information at the end of file.
+
+============================================================
+*/
+
+/* Inclusion */
+
+	// Include mug
+	#define MU_SUPPORT_OPENGL // (For OpenGL support)
+	#define MUG_NAMES // (For mug name functions)
+	#define MUCOSA_NAMES // (For muCOSA name functions)
+	#define MUG_IMPLEMENTATION // (For source code)
+	#include "muGraphics.h"
+
+	// Include stdio for printing
+	#include <stdio.h>
+	// Include math for moving rects
+	#include <math.h>
+
+/* Variables */
+	
+	// Global context
+	mugContext mug;
+
+	// Graphic handle
+	muGraphic gfx;
+
+	// Graphic system
+	muGraphicSystem gfx_system = MU_GRAPHIC_OPENGL;
+
+	// The window system
+	muWindowSystem window_system = MU_WINDOW_NULL; // (Auto)
+
+	// Pixel format
+	muPixelFormat format = {
+		// RGBA bits
+		8, 8, 8, 8,
+		// Depth bits
+		24,
+		// Stencil bits
+		0,
+		// Samples
+		1
+	};
+
+	// Window information
+	muWindowInfo wininfo = {
+		// Title
+		(char*)"Window",
+		// Resolution (width & height)
+		800, 600,
+		// Min/Max resolution (none)
+		0, 0, 0, 0,
+		// Coordinates (x and y)
+		50, 50,
+		// Pixel format
+		&format,
+		// Callbacks (default)
+		0
+	};
+
+	// Window handle
+	muWindow win;
+
+	// Window keyboard map
+	muBool* keyboard;
+
+	// Block pool for object buffers
+	mugBlockPool pool;
+
+	// Frame arena for scratch memory
+	mugFrameArena arena;
+
+	// Amount of rect buffers
+	#define BUFFER_COUNT 8
+	// Amount of rects per buffer
+	#define RECT_COUNT 64
+
+	// Rects
+	mugRect rects[RECT_COUNT];
+
+	// Rect object buffers
+	mugObjects rectbufs[BUFFER_COUNT];
+
+/* Functions */
+
+	// Names of each allocation category
+	const char* category_names[MUG_ALLOC_CATEGORY_COUNT] = {
+		"general", "window", "object buffer", "vertexes",
+		"spatial index", "texture", "frame", "scratch"
+	};
+
+	// Prints the allocation counts of each category
+	void print_alloc_counts(void) {
+		for (uint32_m c = 0; c < MUG_ALLOC_CATEGORY_COUNT; ++c) {
+			mugAllocCounts* counts = &mug.alloc_counts[c];
+			printf("\t%s: %lu allocs, %lu reallocs, %lu frees (%lu bytes)\n", category_names[c],
+				(unsigned long)counts->allocs, (unsigned long)counts->reallocs,
+				(unsigned long)counts->frees, (unsigned long)counts->bytes
+			);
+		}
+		printf("\t%lu pool blocks in use, %lu arena bytes in use\n",
+			(unsigned long)pool.used, (unsigned long)arena.len
+		);
+	}
+
+int main(void)
+{
+
+/* Initiation */
+
+	printf("Initiating...\n");
+
+	// Create allocator:
+	// Scratch memory comes from a 1 MiB arena, object buffers come from
+	// a pool of blocks, and everything else uses the default allocator
+	mugAllocator pool_allocator = mug_block_pool_allocator(&pool, mug_default_allocator(), MUG_ALLOC_OBJECT_BUFFER, 0);
+	mugAllocator allocator = mug_frame_arena_allocator(&arena, pool_allocator, 1 << MUG_ALLOC_SCRATCH, 1024*1024);
+
+	// Initiate mug with allocator
+	mug_context_create_with_allocator(&mug, window_system, MU_TRUE, &allocator);
+
+	// Print currently running window system
+	printf("Running window system \"%s\"\n",
+		mu_window_system_get_nice_name(muCOSA_context_get_window_system(&mug.cosa))
+	);
+
+	// Create graphic via window using OpenGL
+	gfx = mu_graphic_create_window(gfx_system, &wininfo);
+
+	// Get window handle
+	win = mu_graphic_get_window(gfx);
+	// Get window keyboard map
+	mu_window_get(win, MU_WINDOW_KEYBOARD_MAP, &keyboard);
+
+	// Create rects
+	for (uint32_m i = 0; i < RECT_COUNT; ++i) {
+		rects[i].center.pos[2] = 0.f;
+		rects[i].center.col[0] = (float)((i * 53) % 256) / 255.f;
+		rects[i].center.col[1] = (float)((i * 97) % 256) / 255.f;
+		rects[i].center.col[2] = (float)((i * 193) % 256) / 255.f;
+		rects[i].center.col[3] = 1.f;
+		rects[i].dim[0] = rects[i].dim[1] = 10.f;
+		rects[i].rot = 0.f;
+	}
+
+	// Create rect buffers
+	for (uint32_m b = 0; b < BUFFER_COUNT; ++b) {
+		rectbufs[b] = mu_gobjects_create(gfx, MUG_OBJECT_RECT, RECT_COUNT, rects);
+	}
+
+/* Print explanation */
+
+	printf("Window with rings of moving colored rects should appear\n");
+	printf("Allocation counts should be printed every second\n");
+	printf("Press escape to close window\n");
+
+/* Main loop */
+
+	// Time of last print
+	double last_print = mu_fixed_time_get();
+
+	// Run frame-by-frame while graphic exists:
+	while (mu_graphic_exists(gfx))
+	{
+		// Close if escape is pressed
+		if (keyboard[MU_KEYBOARD_ESCAPE]) {
+			mu_window_close(win);
+			continue;
+		}
+
+		// Clear the graphic with a slightly green-ish very dark grey
+		mu_graphic_clear(gfx, 15.f/255.f, 17.f/255.f, 15.f/255.f);
+
+		// Move each ring of rects and render it
+		double t = mu_fixed_time_get();
+		for (uint32_m b = 0; b < BUFFER_COUNT; ++b) {
+			for (uint32_m i = 0; i < RECT_COUNT; ++i) {
+				float a = (float)t * (1.f + (float)b * 0.2f) + (float)i * (6.2831853f / (float)RECT_COUNT);
+				rects[i].center.pos[0] = 400.f + cosf(a) * (float)(40 + b * 30);
+				rects[i].center.pos[1] = 300.f + sinf(a) * (float)(40 + b * 30);
+				rects[i].rot = a;
+			}
+			mu_gobjects_fill(gfx, rectbufs[b], rects);
+			mu_gobjects_render(gfx, rectbufs[b]);
+		}
+
+		// Swap graphic buffers (to present image)
+		mu_graphic_swap_buffers(gfx);
+
+		// Give back scratch memory (none should be in use between frames)
+		mug_frame_arena_reset(&arena);
+
+		// Print allocation counts every second
+		if (t - last_print >= 1.0) {
+			last_print = t;
+			printf("Allocation counts:\n");
+			print_alloc_counts();
+		}
+
+		// Update graphic at ~100 FPS
+		mu_graphic_update(gfx, 100.f);
+	}
+
+/* Termination */
+
+	// Destroy buffers
+	for (uint32_m b = 0; b < BUFFER_COUNT; ++b) {
+		rectbufs[b] = mu_gobjects_destroy(gfx, rectbufs[b]);
+	}
+
+	// Destroy graphic (required)
+	gfx = mu_graphic_destroy(gfx);
+
+	// Terminate mug (required)
+	mug_context_destroy(&mug);
+
+	// Print final allocation counts
+	printf("Final allocation counts:\n");
+	print_alloc_counts();
+
+	// Free allocators (after nothing allocated with them is in use)
+	mug_frame_arena_free(&arena);
+	mug_block_pool_free(&pool);
+
+	// Print possible error
+	if (mug.result != MUG_SUCCESS) {
+		printf("Something went wrong during the program's life; result: %s\n",
+			mug_result_get_name(mug.result)
+		);
+	} else {
+		printf("Successful\n");
+	}
+
+	return 0;
+}
+
+/*
+For all source code:
+
+	------------------------------------------------------------------------------
+	This software is available under 2 licenses -- choose whichever you prefer.
+	------------------------------------------------------------------------------
+	ALTERNATIVE A - MIT License
+	Copyright (c) 2024 Hum
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+	of the Software, and to permit persons to whom the Software is furnished to do
+	so, subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+	------------------------------------------------------------------------------
+	ALTERNATIVE B - Public Domain (www.unlicense.org)
+	This is free and unencumbered software released into the public domain.
+	Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+	software, either in source code form or as a compiled binary, for any purpose,
+	commercial or non-commercial, and by any means.
+	In jurisdictions that recognize copyright laws, the author or authors of this
+	software dedicate any and all copyright interest in the software to the public
+	domain. We make this dedication for the benefit of the public at large and to
+	the detriment of our heirs and successors. We intend this dedication to be an
+	overt act of relinquishment in perpetuity of all present and future rights to
+	this software under copyright law.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+	ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+	WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+	------------------------------------------------------------------------------
+
+For Khronos specifications:
+	
+	Copyright (c) 2013-2020 The Khronos Group Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+
+*/
+
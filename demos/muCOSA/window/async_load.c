@@ -0,0 +1,374 @@
+/*
+============================================================
+                        DEMO INFO
+
+DEMO NAME:          async_load.c
+DEMO WRITTEN BY:    Muukid
+CREATION DATE:      2026-10-18
+LAST UPDATED:       2026-10-18
+
+============================================================
+                        DEMO PURPOSE
+
+This demo tests if asynchronous texture loading works by
+encoding sixty-four images in memory, half as PPM images
+and half in a tiny custom format read by a user-given
+decoder, and loading all of them asynchronously into a grid
+of rects. The rects should start black and fill in with
+colorful gradients over the course of a few frames, without
+the window ever freezing, and a message should be printed
+once every image has loaded.
+
+If the user presses escape, the window will close.
+
+============================================================
+                        LICENSE INFO
+
+This software is licensed under:
+(MIT license OR public domain) AND Apache 2.0.
+More explicit license information at the end of file.
+
+============================================================
+*/
+
+/* Inclusion */
+	
+	// Include mug
+	#define MU_SUPPORT_OPENGL // (For OpenGL support)
+	#define MUG_NAMES // (For mug name functions)
+	#define MUCOSA_NAMES // (For muCOSA name functions)
+	#define MUG_IMPLEMENTATION // (For source code)
+	#include "muGraphics.h"
+
+	// Include stdio for printing
+	#include <stdio.h>
+
+	// Include stdlib for memory allocation
+	#include <stdlib.h>
+
+/* Variables */
+	
+	// Global context
+	mugContext mug;
+
+	// Graphic handle
+	muGraphic gfx;
+
+	// Graphic system
+	muGraphicSystem gfx_system = MU_GRAPHIC_OPENGL;
+
+	// The window system
+	muWindowSystem window_system = MU_WINDOW_NULL; // (Auto)
+
+	// Pixel format
+	muPixelFormat format = {
+		// RGBA bits
+		8, 8, 8, 8,
+		// Depth bits
+		24,
+		// Stencil bits
+		0,
+		// Samples
+		1
+	};
+
+	// Window information
+	muWindowInfo wininfo = {
+		// Title
+		(char*)"Window",
+		// Resolution (width & height)
+		800, 600,
+		// Min/Max resolution (none)
+		0, 0, 0, 0,
+		// Coordinates (x and y)
+		50, 50,
+		// Pixel format
+		&format,
+		// Callbacks (default)
+		0
+	};
+
+	// Window handle
+	muWindow win;
+
+	// Window keyboard map
+	muBool* keyboard;
+
+/* Image logic */
+
+	// Amount of images (in an 8x8 grid)
+	#define IMAGE_COUNT 64
+	// Image dimensions
+	#define SIZE 256
+
+	// Size of a PPM image's header and an image of the custom format's header
+	#define PPM_HEADER_SIZE 15
+	#define RAW_HEADER_SIZE 12
+
+	// Encoded images
+	muByte* images[IMAGE_COUNT];
+	size_m image_sizes[IMAGE_COUNT];
+
+	// Gets the color of a pixel of an image
+	void image_pixel(uint32_m index, uint32_m x, uint32_m y, muByte* p) {
+		p[0] = (muByte)((x + index*16) % 256);
+		p[1] = (muByte)((y + index*8) % 256);
+		p[2] = (muByte)((index * 32) % 256);
+	}
+
+	// Encodes an image as a PPM image ("P6") or as the custom format ("RAW!")
+	void encode_image(uint32_m index) {
+		muBool ppm = index % 2 == 0;
+		size_m header = (ppm) ? (PPM_HEADER_SIZE) : (RAW_HEADER_SIZE);
+		uint32_m channels = (ppm) ? (3) : (4);
+		image_sizes[index] = header + SIZE*SIZE*channels;
+		images[index] = (muByte*)malloc(image_sizes[index]);
+
+		// Header
+		muByte* data = images[index];
+		if (ppm) {
+			sprintf((char*)data, "P6\n%d %d\n255\n", SIZE, SIZE);
+		} else {
+			data[0] = 'R'; data[1] = 'A'; data[2] = 'W'; data[3] = '!';
+			for (uint32_m i = 0; i < 4; ++i) {
+				data[4+i] = (muByte)(SIZE >> (i*8));
+				data[8+i] = (muByte)(SIZE >> (i*8));
+			}
+		}
+
+		// Pixels
+		muByte* p = &data[header];
+		for (uint32_m y = 0; y < SIZE; ++y) {
+			for (uint32_m x = 0; x < SIZE; ++x) {
+				image_pixel(index, x, y, p);
+				if (!ppm) {
+					p[3] = 255;
+				}
+				p += channels;
+			}
+		}
+	}
+
+	// Decoder for the custom format ("RAW!", little-endian width and height, then RGBA pixels)
+	muByte* decode_raw(void* user, muByte* data, size_m size, uint32_m* dim) {
+		if (size < RAW_HEADER_SIZE || data[0] != 'R' || data[1] != 'A' || data[2] != 'W' || data[3] != '!') {
+			return 0;
+		}
+		dim[0] = data[4] | (data[5] << 8) | (data[6] << 16) | ((uint32_m)data[7] << 24);
+		dim[1] = data[8] | (data[9] << 8) | (data[10] << 16) | ((uint32_m)data[11] << 24);
+		size_m len = (size_m)dim[0]*dim[1]*4;
+		if (size - RAW_HEADER_SIZE < len) {
+			return 0;
+		}
+
+		muByte* pixels = (muByte*)mu_malloc(len);
+		if (pixels) {
+			mu_memcpy(pixels, &data[RAW_HEADER_SIZE], len);
+		}
+		return pixels;
+		if (user) {}
+	}
+
+/* Texture logic */
+
+	// Texture info
+	mugTextureInfo texinfo = {
+		// Type (2D)
+		MUG_TEXTURE_2D,
+		// Format (uint8_m RGBA)
+		MUG_TEXTURE_U8_RGBA,
+		// Wrapping x and y (clamp)
+		{ MUG_TEXTURE_CLAMP, MUG_TEXTURE_CLAMP },
+		// Filtering up-/downscale (bilinear)
+		{ MUG_TEXTURE_BILINEAR, MUG_TEXTURE_BILINEAR },
+		// Mip levels (irrelevant)
+		0,
+		// Conversion (none)
+		0
+	};
+
+	// Texture handles and respective texture rect object buffers
+	mugTexture textures[IMAGE_COUNT];
+	mugObjects bufs[IMAGE_COUNT];
+
+	// Amount of textures that have finished loading
+	uint32_m loaded = 0;
+
+	// Called once a texture has finished loading
+	void texture_loaded(mugTexture tex, mugResult result, void* user) {
+		if (result != MUG_SUCCESS) {
+			printf("Image %u failed to load; result: %s\n", (unsigned)(size_m)user, mug_result_get_name(result));
+		}
+		if (++loaded == IMAGE_COUNT) {
+			printf("Every image has loaded\n");
+		}
+		return; if (tex) {}
+	}
+
+int main(void)
+{
+
+/* Initiation */
+
+	printf("Initiating...\n");
+
+	// Initiate mug
+	mug_context_create(&mug, window_system, MU_TRUE);
+
+	// Print currently running window system
+	printf("Running window system \"%s\"\n",
+		mu_window_system_get_nice_name(muCOSA_context_get_window_system(&mug.cosa))
+	);
+
+	// Create graphic via window using OpenGL
+	gfx = mu_graphic_create_window(gfx_system, &wininfo);
+
+	// Get window handle
+	win = mu_graphic_get_window(gfx);
+	// Get window keyboard map
+	mu_window_get(win, MU_WINDOW_KEYBOARD_MAP, &keyboard);
+
+	// Encode images
+	for (uint32_m i = 0; i < IMAGE_COUNT; ++i) {
+		encode_image(i);
+	}
+
+	// Give graphic the decoder for the custom format
+	mu_graphic_image_decoder(gfx, decode_raw, 0);
+
+	// Load textures asynchronously and create their rects
+	for (uint32_m i = 0; i < IMAGE_COUNT; ++i) {
+		mugImageSource source = { 0, images[i], image_sizes[i] };
+		textures[i] = mu_gtexture_load_async(gfx, &source, &texinfo, texture_loaded, (void*)(size_m)i);
+
+		mug2DTextureRect rect = {
+			{ { 110.f + (float)(i % 8) * 83.f, 45.f + (float)(i / 8) * 73.f, 0.f }, { 1.f, 1.f, 1.f, 1.f } },
+			{ 80.f, 70.f }, 0.f, { 0.f, 0.f }, { 1.f, 1.f }
+		};
+		bufs[i] = mu_gobjects_create(gfx, MUG_OBJECT_TEXTURE_2D, 1, &rect);
+		mu_gobjects_texture(gfx, bufs[i], textures[i]);
+	}
+
+/* Print explanation */
+
+	printf("Window with dark grey background should appear\n");
+	printf("A grid of rects should fill in with colorful gradients\n");
+	printf("Press escape to close window\n");
+
+/* Main loop */
+
+	// Run frame-by-frame while graphic exists:
+	while (mu_graphic_exists(gfx))
+	{
+		// Close if escape is pressed
+		if (keyboard[MU_KEYBOARD_ESCAPE]) {
+			mu_window_close(win);
+			continue;
+		}
+
+		// Clear the graphic with a slightly green-ish very dark grey
+		mu_graphic_clear(gfx, 15.f/255.f, 17.f/255.f, 15.f/255.f);
+
+		// Render rects
+		for (uint32_m i = 0; i < IMAGE_COUNT; ++i) {
+			mu_gobjects_render(gfx, bufs[i]);
+		}
+
+		// Swap graphic buffers (to present image)
+		mu_graphic_swap_buffers(gfx);
+		// Update graphic at ~100 FPS
+		mu_graphic_update(gfx, 100.f);
+	}
+
+/* Termination */
+
+	// Destroy buffers and textures (required)
+	for (uint32_m i = 0; i < IMAGE_COUNT; ++i) {
+		bufs[i] = mu_gobjects_destroy(gfx, bufs[i]);
+		mu_gtexture_destroy(gfx, textures[i]);
+	}
+
+	// Destroy graphic (required)
+	gfx = mu_graphic_destroy(gfx);
+
+	// Free encoded images
+	for (uint32_m i = 0; i < IMAGE_COUNT; ++i) {
+		free(images[i]);
+	}
+
+	// Terminate mug (required)
+	mug_context_destroy(&mug);
+
+	// Print possible error
+	if (mug.result != MUG_SUCCESS) {
+		printf("Something went wrong during the program's life; result: %s\n",
+			mug_result_get_name(mug.result)
+		);
+	} else {
+		printf("Successful\n");
+	}
+
+	return 0;
+}
+
+/*
+For all source code:
+
+	------------------------------------------------------------------------------
+	This software is available under 2 licenses -- choose whichever you prefer.
+	------------------------------------------------------------------------------
+	ALTERNATIVE A - MIT License
+	Copyright (c) 2024 Hum
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+	of the Software, and to permit persons to whom the Software is furnished to do
+	so, subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+	------------------------------------------------------------------------------
+	ALTERNATIVE B - Public Domain (www.unlicense.org)
+	This is free and unencumbered software released into the public domain.
+	Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+	software, either in source code form or as a compiled binary, for any purpose,
+	commercial or non-commercial, and by any means.
+	In jurisdictions that recognize copyright laws, the author or authors of this
+	software dedicate any and all copyright interest in the software to the public
+	domain. We make this dedication for the benefit of the public at large and to
+	the detriment of our heirs and successors. We intend this dedication to be an
+	overt act of relinquishment in perpetuity of all present and future rights to
+	this software under copyright law.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+	ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+	WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+	------------------------------------------------------------------------------
+
+For Khronos specifications:
+	
+	Copyright (c) 2013-2020 The Khronos Group Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+
+*/
+
@@ -0,0 +1,379 @@
+/*
+============================================================
+                        DEMO INFO
+
+DEMO NAME:          atlas.c
+DEMO WRITTEN BY:    Muukid
+CREATION DATE:      2026-10-18
+LAST UPDATED:       2026-10-18
+
+============================================================
+                        DEMO PURPOSE
+
+This demo tests if atlases work by generating 48 small
+icons of different sizes, packing them all into one
+atlas, and rendering all of them from one texture buffer
+in a grid. Each icon is a colored disc on a lighter
+square, and no icon should show bits of its neighbors
+along its edges.
+
+Below the grid, a strip is drawn immediately every frame,
+and every half a second, a new icon is added to the
+atlas after the strip has been drawn (while it's still
+pending) and drawn on the strip from then on, until the
+strip is full.
+
+If the user presses escape, the window will close.
+
+============================================================
+                        LICENSE INFO
+
+This software is licensed under:
+(MIT license OR public domain) AND Apache 2.0.
+More explicit license information at the end of file.
+
+============================================================
+*/
+
+/* Inclusion */
+	
+	// Include mug
+	#define MU_SUPPORT_OPENGL // (For OpenGL support)
+	#define MUG_NAMES // (For mug name functions)
+	#define MUCOSA_NAMES // (For muCOSA name functions)
+	#define MUG_IMPLEMENTATION // (For source code)
+	#include "muGraphics.h"
+
+	// Include stdio for printing
+	#include <stdio.h>
+
+/* Variables */
+	
+	// Global context
+	mugContext mug;
+
+	// Graphic handle
+	muGraphic gfx;
+
+	// Graphic system
+	muGraphicSystem gfx_system = MU_GRAPHIC_OPENGL;
+
+	// The window system
+	muWindowSystem window_system = MU_WINDOW_NULL; // (Auto)
+
+	// Pixel format
+	muPixelFormat format = {
+		// RGBA bits
+		8, 8, 8, 8,
+		// Depth bits
+		24,
+		// Stencil bits
+		0,
+		// Samples
+		1
+	};
+
+	// Window information
+	muWindowInfo wininfo = {
+		// Title
+		(char*)"Window",
+		// Resolution (width & height)
+		800, 700,
+		// Min/Max resolution (none)
+		0, 0, 0, 0,
+		// Coordinates (x and y)
+		50, 50,
+		// Pixel format
+		&format,
+		// Callbacks (default)
+		0
+	};
+
+	// Window handle
+	muWindow win;
+
+	// Window keyboard map
+	muBool* keyboard;
+
+/* Atlas logic */
+
+	// Atlas texture info
+	mugTextureInfo texinfo = {
+		// Type (2D)
+		MUG_TEXTURE_2D,
+		// Format (uint8_m RGBA)
+		MUG_TEXTURE_U8_RGBA,
+		// Wrapping x and y (clamp)
+		{ MUG_TEXTURE_CLAMP, MUG_TEXTURE_CLAMP },
+		// Filtering up-/downscale (bilinear)
+		{ MUG_TEXTURE_BILINEAR, MUG_TEXTURE_BILINEAR },
+		// Mip levels (irrelevant)
+		0,
+		// Conversion (none)
+		0
+	};
+
+	// Atlas dimensions
+	uint32_m atlas_dim[2] = { 512, 256 };
+
+	// Atlas handle
+	mugAtlas atlas;
+
+	// Amount of icons
+	#define ICON_COUNT 48
+	// Amount of icons per row
+	#define ICON_ROW 8
+
+	// Texture rects of each icon
+	mug2DTextureRect icons[ICON_COUNT];
+
+	// Texture rect object buffer
+	mugObjects iconbuf;
+
+	// Amount of icons added while running
+	#define LIVE_COUNT 8
+	// Icons added while running so far
+	mug2DTextureRect live[LIVE_COUNT];
+	uint32_m live_count = 0;
+
+/* Icon logic */
+
+	// Largest icon size
+	#define ICON_MAX 48
+
+	// Icon pixel array
+	uint8_m pixels[ICON_MAX*ICON_MAX*4];
+
+	// Generates an icon of a given size and color
+	void calc_icon(uint32_m size, float r, float g, float b) {
+		float half = size / 2.f;
+		for (uint32_m y = 0; y < size; ++y) {
+			for (uint32_m x = 0; x < size; ++x) {
+				uint8_m* p = &pixels[(y*size + x)*4];
+				// Disc in the middle, lighter square around it
+				float dx = x + 0.5f - half, dy = y + 0.5f - half;
+				float shade = (dx*dx + dy*dy < half*half*0.6f) ? 1.f : 0.4f;
+				p[0] = (uint8_m)(r*shade*255.f);
+				p[1] = (uint8_m)(g*shade*255.f);
+				p[2] = (uint8_m)(b*shade*255.f);
+				p[3] = 255;
+			}
+		}
+	}
+
+	// Generates and packs all icons
+	void create_icons(void) {
+		// Create atlas, with 1 pixel of padding around each icon
+		atlas = mu_atlas_create(gfx, &texinfo, atlas_dim, 1);
+
+		for (uint32_m i = 0; i < ICON_COUNT; ++i) {
+			// Generate icon of varying size and color
+			uint32_m size = 16 + (i * 7) % (ICON_MAX - 15);
+			calc_icon(size, (i % 3) / 2.f, ((i / 3) % 3) / 2.f, 1.f - (i % 5) / 5.f);
+
+			// Place icon on screen
+			mug2DTextureRect icon = {
+				{ { 80.f + (i % ICON_ROW)*90.f, 80.f + (i / ICON_ROW)*90.f, 0.f }, { 1.f, 1.f, 1.f, 1.f } },
+				{ 64.f, 64.f }, 0.f, { 0.f, 0.f }, { 1.f, 1.f }
+			};
+
+			// Pack icon into atlas, getting its cutout
+			mu_atlas_add(gfx, atlas, size, size, 0, pixels, icon.tex_pos, icon.tex_dim);
+			icons[i] = icon;
+		}
+
+		// Create buffer using atlas's texture
+		iconbuf = mu_gobjects_create(gfx, MUG_OBJECT_TEXTURE_2D, ICON_COUNT, icons);
+		mu_gobjects_texture(gfx, iconbuf, mu_atlas_texture(gfx, atlas));
+	}
+
+	// Draws the strip of icons added while running
+	void draw_strip(void) {
+		// Strip background
+		mugRect strip = {
+			{ { 395.f, 640.f, 0.f }, { 0.25f, 0.25f, 0.25f, 1.f } },
+			{ 730.f, 50.f }, 0.f
+		};
+		mu_draw_rect(gfx, &strip);
+
+		// Icons added so far
+		for (uint32_m i = 0; i < live_count; ++i) {
+			mu_draw_texture_rect(gfx, mu_atlas_texture(gfx, atlas), &live[i]);
+		}
+	}
+
+	// Adds a new icon to the atlas while drawing is still pending
+	void add_live_icon(void) {
+		if (live_count == LIVE_COUNT) {
+			return;
+		}
+		uint32_m i = live_count;
+
+		// Generate icon
+		uint32_m size = 20 + i*3;
+		calc_icon(size, 1.f, (i % 2) ? 1.f : 0.5f, 0.25f);
+
+		// Place icon on strip
+		mug2DTextureRect icon = {
+			{ { 80.f + i*90.f, 640.f, 0.f }, { 1.f, 1.f, 1.f, 1.f } },
+			{ 40.f, 40.f }, 0.f, { 0.f, 0.f }, { 1.f, 1.f }
+		};
+
+		// Pack icon into atlas; this flushes the pending strip before uploading
+		if (mu_atlas_add(gfx, atlas, size, size, 0, pixels, icon.tex_pos, icon.tex_dim)) {
+			live[live_count++] = icon;
+		}
+	}
+
+int main(void)
+{
+
+/* Initiation */
+
+	printf("Initiating...\n");
+
+	// Initiate mug
+	mug_context_create(&mug, window_system, MU_TRUE);
+
+	// Print currently running window system
+	printf("Running window system \"%s\"\n",
+		mu_window_system_get_nice_name(muCOSA_context_get_window_system(&mug.cosa))
+	);
+
+	// Create graphic via window using OpenGL
+	gfx = mu_graphic_create_window(gfx_system, &wininfo);
+
+	// Get window handle
+	win = mu_graphic_get_window(gfx);
+	// Get window keyboard map
+	mu_window_get(win, MU_WINDOW_KEYBOARD_MAP, &keyboard);
+
+	// Create icons
+	create_icons();
+
+/* Print explanation */
+
+	printf("Window with dark grey background should appear\n");
+	printf("A grid of 48 colored icons should be visible, rendered from one atlas\n");
+	printf("Below it, a strip should gain a new orange or yellow icon every half a second, up to 8\n");
+	printf("Press escape to close window\n");
+
+/* Main loop */
+
+	// Frame counter
+	uint32_m frame = 0;
+
+	// Run frame-by-frame while graphic exists:
+	while (mu_graphic_exists(gfx))
+	{
+		// Close if escape is pressed
+		if (keyboard[MU_KEYBOARD_ESCAPE]) {
+			mu_window_close(win);
+			continue;
+		}
+
+		// Clear the graphic with a slightly green-ish very dark grey
+		mu_graphic_clear(gfx, 15.f/255.f, 17.f/255.f, 15.f/255.f);
+
+		// Render all icons in one draw call
+		mu_gobjects_render(gfx, iconbuf);
+
+		// Draw strip immediately, then add a new icon every 50 frames
+		draw_strip();
+		if (++frame % 50 == 0) {
+			add_live_icon();
+		}
+
+		// Swap graphic buffers (to present image)
+		mu_graphic_swap_buffers(gfx);
+		// Update graphic at ~100 FPS
+		mu_graphic_update(gfx, 100.f);
+	}
+
+/* Termination */
+
+	// Destroy buffer (required)
+	iconbuf = mu_gobjects_destroy(gfx, iconbuf);
+
+	// Destroy atlas (required)
+	atlas = mu_atlas_destroy(gfx, atlas);
+
+	// Destroy graphic (required)
+	gfx = mu_graphic_destroy(gfx);
+
+	// Terminate mug (required)
+	mug_context_destroy(&mug);
+
+	// Print possible error
+	if (mug.result != MUG_SUCCESS) {
+		printf("Something went wrong during the program's life; result: %s\n",
+			mug_result_get_name(mug.result)
+		);
+	} else {
+		printf("Successful\n");
+	}
+
+	return 0;
+}
+
+/*
+For all source code:
+
+	------------------------------------------------------------------------------
+	This software is available under 2 licenses -- choose whichever you prefer.
+	------------------------------------------------------------------------------
+	ALTERNATIVE A - MIT License
+	Copyright (c) 2024 Hum
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+	of the Software, and to permit persons to whom the Software is furnished to do
+	so, subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+	------------------------------------------------------------------------------
+	ALTERNATIVE B - Public Domain (www.unlicense.org)
+	This is free and unencumbered software released into the public domain.
+	Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+	software, either in source code form or as a compiled binary, for any purpose,
+	commercial or non-commercial, and by any means.
+	In jurisdictions that recognize copyright laws, the author or authors of this
+	software dedicate any and all copyright interest in the software to the public
+	domain. We make this dedication for the benefit of the public at large and to
+	the detriment of our heirs and successors. We intend this dedication to be an
+	overt act of relinquishment in perpetuity of all present and future rights to
+	this software under copyright law.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+	ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+	WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+	------------------------------------------------------------------------------
+
+For Khronos specifications:
+	
+	Copyright (c) 2013-2020 The Khronos Group Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+
+*/
+
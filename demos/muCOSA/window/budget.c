@@ -0,0 +1,328 @@
+/*
+============================================================
+                        DEMO INFO
+
+DEMO NAME:          budget.c
+DEMO WRITTEN BY:    Muukid
+CREATION DATE:      2026-10-18
+LAST UPDATED:       2026-10-18
+
+============================================================
+                        DEMO PURPOSE
+
+This demo tests if texture budgets work by creating sixteen
+evictable textures while only allowing four of them to be
+resident at once, and rendering them four at a time, moving
+to the next four every second. Each page of textures should
+render correctly even though most of them were evicted and
+reloaded, and the texture statistics are printed upon every
+page change.
+
+If the user presses escape, the window will close.
+
+============================================================
+                        LICENSE INFO
+
+This software is licensed under:
+(MIT license OR public domain) AND Apache 2.0.
+More explicit license information at the end of file.
+
+============================================================
+*/
+
+/* Inclusion */
+	
+	// Include mug
+	#define MU_SUPPORT_OPENGL // (For OpenGL support)
+	#define MUG_NAMES // (For mug name functions)
+	#define MUCOSA_NAMES // (For muCOSA name functions)
+	#define MUG_IMPLEMENTATION // (For source code)
+	#include "muGraphics.h"
+
+	// Include stdio for printing
+	#include <stdio.h>
+
+/* Variables */
+	
+	// Global context
+	mugContext mug;
+
+	// Graphic handle
+	muGraphic gfx;
+
+	// Graphic system
+	muGraphicSystem gfx_system = MU_GRAPHIC_OPENGL;
+
+	// The window system
+	muWindowSystem window_system = MU_WINDOW_NULL; // (Auto)
+
+	// Pixel format
+	muPixelFormat format = {
+		// RGBA bits
+		8, 8, 8, 8,
+		// Depth bits
+		24,
+		// Stencil bits
+		0,
+		// Samples
+		1
+	};
+
+	// Window information
+	muWindowInfo wininfo = {
+		// Title
+		(char*)"Window",
+		// Resolution (width & height)
+		800, 600,
+		// Min/Max resolution (none)
+		0, 0, 0, 0,
+		// Coordinates (x and y)
+		50, 50,
+		// Pixel format
+		&format,
+		// Callbacks (default)
+		0
+	};
+
+	// Window handle
+	muWindow win;
+
+	// Window keyboard map
+	muBool* keyboard;
+
+/* Texture logic */
+
+	// Texture info
+	mugTextureInfo texinfo = {
+		// Type (2D)
+		MUG_TEXTURE_2D,
+		// Format (uint8_m RGBA)
+		MUG_TEXTURE_U8_RGBA,
+		// Wrapping x and y (clamp)
+		{ MUG_TEXTURE_CLAMP, MUG_TEXTURE_CLAMP },
+		// Filtering up-/downscale (nearest)
+		{ MUG_TEXTURE_NEAREST, MUG_TEXTURE_NEAREST },
+		// Mip levels (irrelevant)
+		0,
+		// Conversion (none)
+		0
+	};
+
+	// Amount of textures, and amount shown per page
+	#define TEXTURE_COUNT 16
+	#define PAGE_COUNT 4
+
+	// Texture dimensions
+	#define SIZE 256
+	uint32_m dim[2] = { SIZE, SIZE };
+
+	// Texture handles and respective texture rect object buffers
+	mugTexture textures[TEXTURE_COUNT];
+	mugObjects bufs[TEXTURE_COUNT];
+
+	// Pixel array
+	uint8_m pixels[SIZE*SIZE*4];
+
+	// Fills pixels with a checkerboard whose color and size depend on the texture's index
+	void calc_pixels(uint32_m index, muByte* data) {
+		uint32_m cell = 8 + (index % 4) * 8;
+		for (uint32_m y = 0; y < SIZE; ++y) {
+			for (uint32_m x = 0; x < SIZE; ++x) {
+				muByte* p = &data[(y*SIZE + x)*4];
+				muBool on = ((x / cell) + (y / cell)) % 2;
+				p[0] = (on && (index & 1)) ? 255 : 40;
+				p[1] = (on && (index & 2)) ? 255 : 40;
+				p[2] = (on && (index & 4)) ? 255 : 40;
+				p[3] = 255;
+				if (!on) {
+					p[0] = p[1] = p[2] = (uint8_m)(index * 12);
+				}
+			}
+		}
+	}
+
+	// Reloads an evicted texture's pixels
+	void reload_texture(mugTexture tex, void* user, muByte* data) {
+		calc_pixels((uint32_m)(size_m)user, data);
+		return; if (tex) {}
+	}
+
+	// Prints the graphic's texture statistics
+	void print_stats(void) {
+		mugTextureStats stats;
+		mu_graphic_texture_stats(gfx, &stats);
+		printf("Resident: %u KiB / %u KiB, evictions: %u, reloads: %u\n",
+			(unsigned)(stats.resident_bytes / 1024), (unsigned)(stats.budget / 1024),
+			(unsigned)stats.evictions, (unsigned)stats.reloads
+		);
+	}
+
+int main(void)
+{
+
+/* Initiation */
+
+	printf("Initiating...\n");
+
+	// Initiate mug
+	mug_context_create(&mug, window_system, MU_TRUE);
+
+	// Print currently running window system
+	printf("Running window system \"%s\"\n",
+		mu_window_system_get_nice_name(muCOSA_context_get_window_system(&mug.cosa))
+	);
+
+	// Create graphic via window using OpenGL
+	gfx = mu_graphic_create_window(gfx_system, &wininfo);
+
+	// Get window handle
+	win = mu_graphic_get_window(gfx);
+	// Get window keyboard map
+	mu_window_get(win, MU_WINDOW_KEYBOARD_MAP, &keyboard);
+
+	// Only allow one page of textures to be resident
+	mu_graphic_texture_budget(gfx, PAGE_COUNT * SIZE*SIZE*4);
+
+	// Create evictable textures and their rects
+	for (uint32_m i = 0; i < TEXTURE_COUNT; ++i) {
+		calc_pixels(i, (muByte*)pixels);
+		textures[i] = mu_gtexture_create(gfx, &texinfo, dim, (muByte*)pixels);
+		mu_gtexture_evictable(gfx, textures[i], reload_texture, (void*)(size_m)i);
+
+		mug2DTextureRect rect = {
+			{ { 120.f + (float)(i % PAGE_COUNT) * 190.f, 300.f, 0.f }, { 1.f, 1.f, 1.f, 1.f } },
+			{ 180.f, 180.f }, 0.f, { 0.f, 0.f }, { 1.f, 1.f }
+		};
+		bufs[i] = mu_gobjects_create(gfx, MUG_OBJECT_TEXTURE_2D, 1, &rect);
+		mu_gobjects_texture(gfx, bufs[i], textures[i]);
+	}
+	print_stats();
+
+/* Print explanation */
+
+	printf("Window with dark grey background should appear\n");
+	printf("Four checkerboards should be visible, changing every second\n");
+	printf("Press escape to close window\n");
+
+/* Main loop */
+
+	// Frame counter, and page being shown
+	uint32_m frame = 0;
+	uint32_m page = 0;
+
+	// Run frame-by-frame while graphic exists:
+	while (mu_graphic_exists(gfx))
+	{
+		// Close if escape is pressed
+		if (keyboard[MU_KEYBOARD_ESCAPE]) {
+			mu_window_close(win);
+			continue;
+		}
+
+		// Move to next page every second
+		if (++frame % 100 == 0) {
+			page = (page + 1) % (TEXTURE_COUNT / PAGE_COUNT);
+			print_stats();
+		}
+
+		// Clear the graphic with a slightly green-ish very dark grey
+		mu_graphic_clear(gfx, 15.f/255.f, 17.f/255.f, 15.f/255.f);
+
+		// Render current page
+		for (uint32_m i = 0; i < PAGE_COUNT; ++i) {
+			mu_gobjects_render(gfx, bufs[page*PAGE_COUNT + i]);
+		}
+
+		// Swap graphic buffers (to present image)
+		mu_graphic_swap_buffers(gfx);
+		// Update graphic at ~100 FPS
+		mu_graphic_update(gfx, 100.f);
+	}
+
+/* Termination */
+
+	// Destroy buffers and textures (required)
+	for (uint32_m i = 0; i < TEXTURE_COUNT; ++i) {
+		bufs[i] = mu_gobjects_destroy(gfx, bufs[i]);
+		mu_gtexture_destroy(gfx, textures[i]);
+	}
+
+	// Destroy graphic (required)
+	gfx = mu_graphic_destroy(gfx);
+
+	// Terminate mug (required)
+	mug_context_destroy(&mug);
+
+	// Print possible error
+	if (mug.result != MUG_SUCCESS) {
+		printf("Something went wrong during the program's life; result: %s\n",
+			mug_result_get_name(mug.result)
+		);
+	} else {
+		printf("Successful\n");
+	}
+
+	return 0;
+}
+
+/*
+For all source code:
+
+	------------------------------------------------------------------------------
+	This software is available under 2 licenses -- choose whichever you prefer.
+	------------------------------------------------------------------------------
+	ALTERNATIVE A - MIT License
+	Copyright (c) 2024 Hum
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+	of the Software, and to permit persons to whom the Software is furnished to do
+	so, subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+	------------------------------------------------------------------------------
+	ALTERNATIVE B - Public Domain (www.unlicense.org)
+	This is free and unencumbered software released into the public domain.
+	Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+	software, either in source code form or as a compiled binary, for any purpose,
+	commercial or non-commercial, and by any means.
+	In jurisdictions that recognize copyright laws, the author or authors of this
+	software dedicate any and all copyright interest in the software to the public
+	domain. We make this dedication for the benefit of the public at large and to
+	the detriment of our heirs and successors. We intend this dedication to be an
+	overt act of relinquishment in perpetuity of all present and future rights to
+	this software under copyright law.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+	ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+	WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+	------------------------------------------------------------------------------
+
+For Khronos specifications:
+	
+	Copyright (c) 2013-2020 The Khronos Group Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+
+*/
+
@@ -0,0 +1,325 @@
+/*
+============================================================
+                        DEMO INFO
+
+DEMO NAME:          compressed.c
+DEMO WRITTEN BY:    Muukid
+CREATION DATE:      2026-10-18
+LAST UPDATED:       2026-10-18
+
+============================================================
+                        DEMO PURPOSE
+
+This demo tests if block-compressed textures work by
+generating a colorful image, compressing it to BC1 on the
+CPU, and rendering the original (left) and compressed
+(right) textures side-by-side. Both should look nearly
+identical, with the compressed one taking up an eighth of
+the memory.
+
+If the user presses escape, the window will close.
+
+============================================================
+                        LICENSE INFO
+
+This software is licensed under:
+(MIT license OR public domain) AND Apache 2.0.
+More explicit license information at the end of file.
+
+============================================================
+*/
+
+/* Inclusion */
+	
+	// Include mug
+	#define MU_SUPPORT_OPENGL // (For OpenGL support)
+	#define MUG_NAMES // (For mug name functions)
+	#define MUCOSA_NAMES // (For muCOSA name functions)
+	#define MUG_IMPLEMENTATION // (For source code)
+	#include "muGraphics.h"
+
+	// Include stdio for printing
+	#include <stdio.h>
+
+	// Include math for math functions
+	#include <math.h>
+
+/* Variables */
+	
+	// Global context
+	mugContext mug;
+
+	// Graphic handle
+	muGraphic gfx;
+
+	// Graphic system
+	muGraphicSystem gfx_system = MU_GRAPHIC_OPENGL;
+
+	// The window system
+	muWindowSystem window_system = MU_WINDOW_NULL; // (Auto)
+
+	// Pixel format
+	muPixelFormat format = {
+		// RGBA bits
+		8, 8, 8, 8,
+		// Depth bits
+		24,
+		// Stencil bits
+		0,
+		// Samples
+		1
+	};
+
+	// Window information
+	muWindowInfo wininfo = {
+		// Title
+		(char*)"Window",
+		// Resolution (width & height)
+		800, 600,
+		// Min/Max resolution (none)
+		0, 0, 0, 0,
+		// Coordinates (x and y)
+		50, 50,
+		// Pixel format
+		&format,
+		// Callbacks (default)
+		0
+	};
+
+	// Window handle
+	muWindow win;
+
+	// Window keyboard map
+	muBool* keyboard;
+
+/* Texture logic */
+
+	// Texture info
+	mugTextureInfo texinfo = {
+		// Type (2D)
+		MUG_TEXTURE_2D,
+		// Format (uint8_m RGBA; changed for compressed texture)
+		MUG_TEXTURE_U8_RGBA,
+		// Wrapping x and y (clamp)
+		{ MUG_TEXTURE_CLAMP, MUG_TEXTURE_CLAMP },
+		// Filtering up-/downscale (bilinear)
+		{ MUG_TEXTURE_BILINEAR, MUG_TEXTURE_BILINEAR },
+		// Mip levels (irrelevant)
+		0,
+		// Conversion (none)
+		0
+	};
+
+	// Texture handles
+	mugTexture original_tex, compressed_tex;
+
+	// Texture rect object buffers
+	mugObjects original_buf, compressed_buf;
+
+	// Texture rects
+	mug2DTextureRect original_rect = {
+		{ { 205.f, 300.f, 0.f }, { 1.f, 1.f, 1.f, 1.f } },
+		{ 360.f, 360.f }, 0.f, { 0.f, 0.f }, { 1.f, 1.f }
+	};
+	mug2DTextureRect compressed_rect = {
+		{ { 595.f, 300.f, 0.f }, { 1.f, 1.f, 1.f, 1.f } },
+		{ 360.f, 360.f }, 0.f, { 0.f, 0.f }, { 1.f, 1.f }
+	};
+
+/* Pixel logic */
+
+	// Pixel dimensions
+	#define SIZE 256
+	uint32_m dim[2] = { SIZE, SIZE };
+
+	// Pixel array
+	uint8_m pixels[SIZE*SIZE*4];
+
+	// Compressed pixel array (BC1 is 8 bytes per 4x4 block)
+	uint8_m compressed[(SIZE/4)*(SIZE/4)*8];
+
+	// Fills pixels with smooth color waves
+	void calc_pixels(void) {
+		for (uint32_m y = 0; y < SIZE; ++y) {
+			for (uint32_m x = 0; x < SIZE; ++x) {
+				uint8_m* p = &pixels[(y*SIZE + x)*4];
+				p[0] = (uint8_m)(127.5 + 127.5*sin(x*0.05));
+				p[1] = (uint8_m)(127.5 + 127.5*sin(y*0.04 + 1.0));
+				p[2] = (uint8_m)(127.5 + 127.5*sin((x+y)*0.03 + 2.0));
+				p[3] = 255;
+			}
+		}
+	}
+
+int main(void)
+{
+
+/* Initiation */
+
+	printf("Initiating...\n");
+
+	// Initiate mug
+	mug_context_create(&mug, window_system, MU_TRUE);
+
+	// Print currently running window system
+	printf("Running window system \"%s\"\n",
+		mu_window_system_get_nice_name(muCOSA_context_get_window_system(&mug.cosa))
+	);
+
+	// Create graphic via window using OpenGL
+	gfx = mu_graphic_create_window(gfx_system, &wininfo);
+
+	// Get window handle
+	win = mu_graphic_get_window(gfx);
+	// Get window keyboard map
+	mu_window_get(win, MU_WINDOW_KEYBOARD_MAP, &keyboard);
+
+	// Calculate pixel data
+	calc_pixels();
+
+	// Create original texture
+	original_tex = mu_gtexture_create(gfx, &texinfo, dim, (muByte*)pixels);
+	original_buf = mu_gobjects_create(gfx, MUG_OBJECT_TEXTURE_2D, 1, &original_rect);
+	mu_gobjects_texture(gfx, original_buf, original_tex);
+
+	// Create compressed texture if BC1 is supported
+	compressed_tex = 0;
+	compressed_buf = 0;
+	if (mug_max(&mug, gfx, MUG_MAX_TEXTURE_FORMATS) & (1 << MUG_TEXTURE_BC1_RGBA)) {
+		// Compress pixels
+		mu_texture_compress(MUG_TEXTURE_BC1_RGBA, SIZE, SIZE, 0, (muByte*)pixels, (muByte*)compressed);
+
+		// Create texture
+		texinfo.format = MUG_TEXTURE_BC1_RGBA;
+		compressed_tex = mu_gtexture_create(gfx, &texinfo, dim, (muByte*)compressed);
+		compressed_buf = mu_gobjects_create(gfx, MUG_OBJECT_TEXTURE_2D, 1, &compressed_rect);
+		mu_gobjects_texture(gfx, compressed_buf, compressed_tex);
+	} else {
+		printf("BC1 isn't supported on this device; only the original will be shown\n");
+	}
+
+/* Print explanation */
+
+	printf("Window with dark grey background should appear\n");
+	printf("Two nearly identical rects with colorful waves should be visible\n");
+	printf("Press escape to close window\n");
+
+/* Main loop */
+
+	// Run frame-by-frame while graphic exists:
+	while (mu_graphic_exists(gfx))
+	{
+		// Close if escape is pressed
+		if (keyboard[MU_KEYBOARD_ESCAPE]) {
+			mu_window_close(win);
+			continue;
+		}
+
+		// Clear the graphic with a slightly green-ish very dark grey
+		mu_graphic_clear(gfx, 15.f/255.f, 17.f/255.f, 15.f/255.f);
+
+		// Render buffers
+		mu_gobjects_render(gfx, original_buf);
+		if (compressed_buf) {
+			mu_gobjects_render(gfx, compressed_buf);
+		}
+
+		// Swap graphic buffers (to present image)
+		mu_graphic_swap_buffers(gfx);
+		// Update graphic at ~100 FPS
+		mu_graphic_update(gfx, 100.f);
+	}
+
+/* Termination */
+
+	// Destroy buffers (required)
+	original_buf = mu_gobjects_destroy(gfx, original_buf);
+	if (compressed_buf) {
+		compressed_buf = mu_gobjects_destroy(gfx, compressed_buf);
+	}
+
+	// Destroy textures (required)
+	mu_gtexture_destroy(gfx, original_tex);
+	if (compressed_tex) {
+		mu_gtexture_destroy(gfx, compressed_tex);
+	}
+
+	// Destroy graphic (required)
+	gfx = mu_graphic_destroy(gfx);
+
+	// Terminate mug (required)
+	mug_context_destroy(&mug);
+
+	// Print possible error
+	if (mug.result != MUG_SUCCESS) {
+		printf("Something went wrong during the program's life; result: %s\n",
+			mug_result_get_name(mug.result)
+		);
+	} else {
+		printf("Successful\n");
+	}
+
+	return 0;
+}
+
+/*
+For all source code:
+
+	------------------------------------------------------------------------------
+	This software is available under 2 licenses -- choose whichever you prefer.
+	------------------------------------------------------------------------------
+	ALTERNATIVE A - MIT License
+	Copyright (c) 2024 Hum
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+	of the Software, and to permit persons to whom the Software is furnished to do
+	so, subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+	------------------------------------------------------------------------------
+	ALTERNATIVE B - Public Domain (www.unlicense.org)
+	This is free and unencumbered software released into the public domain.
+	Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+	software, either in source code form or as a compiled binary, for any purpose,
+	commercial or non-commercial, and by any means.
+	In jurisdictions that recognize copyright laws, the author or authors of this
+	software dedicate any and all copyright interest in the software to the public
+	domain. We make this dedication for the benefit of the public at large and to
+	the detriment of our heirs and successors. We intend this dedication to be an
+	overt act of relinquishment in perpetuity of all present and future rights to
+	this software under copyright law.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+	ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+	WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+	------------------------------------------------------------------------------
+
+For Khronos specifications:
+	
+	Copyright (c) 2013-2020 The Khronos Group Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+
+*/
+
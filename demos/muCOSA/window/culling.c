@@ -0,0 +1,294 @@
+/*
+============================================================
+                        DEMO INFO
+
+DEMO NAME:          culling.c
+DEMO WRITTEN BY:    Muukid
+CREATION DATE:      2026-10-18
+LAST UPDATED:       2026-10-18
+
+============================================================
+                        DEMO PURPOSE
+
+This demo tests if viewport culling works by creating a
+buffer of 40,000 rects spread over a world much larger
+than the window, and only rendering the rects visible
+within a view that scrolls around the world in a circle.
+The rects should scroll smoothly, with no rects missing
+around the edges of the window.
+
+If the user presses escape, the window will close.
+
+============================================================
+                        LICENSE INFO
+
+This software is licensed under:
+(MIT license OR public domain) AND Apache 2.0.
+More explicit license information at the end of file.
+
+============================================================
+*/
+
+/* Inclusion */
+	
+	// Include mug
+	#define MU_SUPPORT_OPENGL // (For OpenGL support)
+	#define MUG_NAMES // (For mug name functions)
+	#define MUCOSA_NAMES // (For muCOSA name functions)
+	#define MUG_IMPLEMENTATION // (For source code)
+	#include "muGraphics.h"
+
+	// Include stdio for printing
+	#include <stdio.h>
+
+	// Include stdlib for allocation
+	#include <stdlib.h>
+
+	// Include math for math functions
+	#include <math.h>
+
+/* Variables */
+	
+	// Global context
+	mugContext mug;
+
+	// Graphic handle
+	muGraphic gfx;
+
+	// Graphic system
+	muGraphicSystem gfx_system = MU_GRAPHIC_OPENGL;
+
+	// The window system
+	muWindowSystem window_system = MU_WINDOW_NULL; // (Auto)
+
+	// Pixel format
+	muPixelFormat format = {
+		// RGBA bits
+		8, 8, 8, 8,
+		// Depth bits
+		24,
+		// Stencil bits
+		0,
+		// Samples
+		1
+	};
+
+	// Window information
+	muWindowInfo wininfo = {
+		// Title
+		(char*)"Window",
+		// Resolution (width & height)
+		800, 600,
+		// Min/Max resolution (none)
+		0, 0, 0, 0,
+		// Coordinates (x and y)
+		50, 50,
+		// Pixel format
+		&format,
+		// Callbacks (default)
+		0
+	};
+
+	// Window handle
+	muWindow win;
+
+	// Window keyboard map
+	muBool* keyboard;
+
+	// Rect object buffer
+	mugObjects rectbuf;
+
+/* Macros */
+
+	// Amount of rects per row/column
+	#define GRID_COUNT 200
+
+	// Size of each rect's cell in the world
+	#define CELL_SIZE 40.f
+
+/* Functions */
+
+	// Creates the rect buffer
+	void create_rects(void) {
+		// Allocate rects
+		mugRect* rects = (mugRect*)malloc(sizeof(mugRect)*GRID_COUNT*GRID_COUNT);
+		if (!rects) {
+			return;
+		}
+
+		// Fill each rect
+		for (uint32_m y = 0; y < GRID_COUNT; ++y) {
+			for (uint32_m x = 0; x < GRID_COUNT; ++x) {
+				mugRect rect = {
+					{ { (x+0.5f)*CELL_SIZE, (y+0.5f)*CELL_SIZE, 0.f }, { x/(float)GRID_COUNT, y/(float)GRID_COUNT, 0.6f, 1.f } },
+					{ CELL_SIZE-8.f, CELL_SIZE-8.f }, (float)(x+y)*0.1f
+				};
+				rects[y*GRID_COUNT + x] = rect;
+			}
+		}
+
+		// Create buffer
+		rectbuf = mu_gobjects_create(gfx, MUG_OBJECT_RECT, GRID_COUNT*GRID_COUNT, rects);
+		free(rects);
+
+		// Enable spatial index, with a cell about the size of one rect
+		mu_gobjects_index(gfx, rectbuf, CELL_SIZE);
+	}
+
+	// Renders the rects visible within the view
+	void render_rects(void) {
+		// Calculate view position, scrolling around the world
+		double time = mu_fixed_time_get() * 0.2;
+		float view[4] = {
+			(float)(3600.0 + cos(time)*3000.0), (float)(3700.0 + sin(time)*3000.0),
+			800.f, 600.f
+		};
+
+		// Offset rects by view position
+		float pos[3] = { -view[0], -view[1], 0.f };
+		mu_gobject_mod(gfx, MUG_OBJECT_RECT, MUG_OBJECT_ADD_POS, pos);
+
+		// Render only what's visible
+		mu_gobjects_render_visible(gfx, rectbuf, view);
+	}
+
+int main(void)
+{
+
+/* Initiation */
+
+	printf("Initiating...\n");
+
+	// Initiate mug
+	mug_context_create(&mug, window_system, MU_TRUE);
+
+	// Print currently running window system
+	printf("Running window system \"%s\"\n",
+		mu_window_system_get_nice_name(muCOSA_context_get_window_system(&mug.cosa))
+	);
+
+	// Create graphic via window using OpenGL
+	gfx = mu_graphic_create_window(gfx_system, &wininfo);
+
+	// Get window handle
+	win = mu_graphic_get_window(gfx);
+	// Get window keyboard map
+	mu_window_get(win, MU_WINDOW_KEYBOARD_MAP, &keyboard);
+
+	// Create rects
+	create_rects();
+
+/* Print explanation */
+
+	printf("Window with dark grey background should appear\n");
+	printf("A grid of rotated multicolored rects should be scrolling around\n");
+	printf("No rects should be missing around the edges of the window\n");
+	printf("Press escape to close window\n");
+
+/* Main loop */
+
+	// Run frame-by-frame while graphic exists:
+	while (mu_graphic_exists(gfx))
+	{
+		// Close if escape is pressed
+		if (keyboard[MU_KEYBOARD_ESCAPE]) {
+			mu_window_close(win);
+			continue;
+		}
+
+		// Clear the graphic with a slightly green-ish very dark grey
+		mu_graphic_clear(gfx, 15.f/255.f, 17.f/255.f, 15.f/255.f);
+
+		// Render rects
+		render_rects();
+
+		// Swap graphic buffers (to present image)
+		mu_graphic_swap_buffers(gfx);
+		// Update graphic at ~100 FPS
+		mu_graphic_update(gfx, 100.f);
+	}
+
+/* Termination */
+
+	// Destroy buffer (required)
+	rectbuf = mu_gobjects_destroy(gfx, rectbuf);
+
+	// Destroy graphic (required)
+	gfx = mu_graphic_destroy(gfx);
+
+	// Terminate mug (required)
+	mug_context_destroy(&mug);
+
+	// Print possible error
+	if (mug.result != MUG_SUCCESS) {
+		printf("Something went wrong during the program's life; result: %s\n",
+			mug_result_get_name(mug.result)
+		);
+	} else {
+		printf("Successful\n");
+	}
+
+	return 0;
+}
+
+/*
+For all source code:
+
+	------------------------------------------------------------------------------
+	This software is available under 2 licenses -- choose whichever you prefer.
+	------------------------------------------------------------------------------
+	ALTERNATIVE A - MIT License
+	Copyright (c) 2024 Hum
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+	of the Software, and to permit persons to whom the Software is furnished to do
+	so, subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+	------------------------------------------------------------------------------
+	ALTERNATIVE B - Public Domain (www.unlicense.org)
+	This is free and unencumbered software released into the public domain.
+	Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+	software, either in source code form or as a compiled binary, for any purpose,
+	commercial or non-commercial, and by any means.
+	In jurisdictions that recognize copyright laws, the author or authors of this
+	software dedicate any and all copyright interest in the software to the public
+	domain. We make this dedication for the benefit of the public at large and to
+	the detriment of our heirs and successors. We intend this dedication to be an
+	overt act of relinquishment in perpetuity of all present and future rights to
+	this software under copyright law.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+	ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+	WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+	------------------------------------------------------------------------------
+
+For Khronos specifications:
+	
+	Copyright (c) 2013-2020 The Khronos Group Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+
+*/
+
@@ -0,0 +1,290 @@
+/*
+============================================================
+                        DEMO INFO
+
+DEMO NAME:          frame_pacing.c
+DEMO WRITTEN BY:    Muukid
+CREATION DATE:      2026-10-18
+LAST UPDATED:       2026-10-18
+
+============================================================
+                        DEMO PURPOSE
+
+This demo shows frame pacing and present modes. A rect
+moves a fixed distance every frame, so any uneven frame
+timing is visible as stutter, while the frame statistics
+are printed every second. The keys 1, 2, and 3 switch
+between the immediate, vsync, and adaptive present modes,
+and P switches between dropping late frames and catching
+up on them.
+
+============================================================
+                        LICENSE INFO
+
+This software is licensed under:
+(MIT license OR public domain) AND Apache 2.0.
+More explicit license information at the end of file.
+
+============================================================
+*/
+
+/* Inclusion */
+	
+	// Include mug
+	#define MU_SUPPORT_OPENGL // (For OpenGL support)
+	#define MUG_NAMES // (For mug name functions)
+	#define MUCOSA_NAMES // (For muCOSA name functions)
+	#define MUG_IMPLEMENTATION // (For source code)
+	#include "muGraphics.h"
+
+	// Include stdio for printing
+	#include <stdio.h>
+
+/* Variables */
+	
+	// Global context
+	mugContext mug;
+
+	// Graphic handle
+	muGraphic gfx;
+
+	// Graphic system
+	muGraphicSystem gfx_system = MU_GRAPHIC_OPENGL;
+
+	// The window system
+	muWindowSystem window_system = MU_WINDOW_NULL; // (Auto)
+
+	// Pixel format
+	muPixelFormat format = {
+		// RGBA bits
+		8, 8, 8, 8,
+		// Depth bits
+		24,
+		// Stencil bits
+		0,
+		// Samples
+		1
+	};
+
+	// Window information
+	muWindowInfo wininfo = {
+		// Title
+		(char*)"Window",
+		// Resolution (width & height)
+		800, 600,
+		// Min/Max resolution (none)
+		0, 0, 0, 0,
+		// Coordinates (x and y)
+		50, 50,
+		// Pixel format
+		&format,
+		// Callbacks (default)
+		0
+	};
+
+	// Window handle
+	muWindow win;
+
+	// Window keyboard map
+	muBool* keyboard;
+
+/* Pacing logic */
+
+	// Target frame rate
+	#define TARGET_FPS 60.f
+
+	// Names of present modes and frame policies
+	const char* mode_names[] = { "immediate", "vsync", "adaptive" };
+	const char* policy_names[] = { "drop", "catch up" };
+
+	// Current frame policy
+	mugFramePolicy policy = MUG_FRAME_DROP;
+
+	// Sets the present mode, printing the mode in effect
+	void set_present_mode(mugPresentMode mode) {
+		mugResult result = MUG_SUCCESS;
+		mu_graphic_set_present_mode_(&result, gfx, mode);
+		if (result != MUG_SUCCESS) {
+			printf("Present mode \"%s\" isn't supported\n", mode_names[mode]);
+			return;
+		}
+		printf("Present mode: %s\n", mode_names[mu_graphic_get_present_mode(gfx)]);
+	}
+
+	// Prints the graphic's frame statistics
+	void print_stats(void) {
+		mugFrameStats stats;
+		mu_graphic_frame_stats(gfx, &stats);
+		printf("Frame: %.2f ms (average %.2f ms), jitter p50/p95/p99: %.3f/%.3f/%.3f ms, dropped: %u, GPU wait: %.2f ms\n",
+			stats.last * 1000.0, stats.average * 1000.0,
+			stats.jitter[0] * 1000.0, stats.jitter[1] * 1000.0, stats.jitter[2] * 1000.0,
+			(unsigned)stats.dropped, stats.gpu_wait_average * 1000.0
+		);
+	}
+
+int main(void)
+{
+
+/* Initiation */
+
+	printf("Initiating...\n");
+
+	// Initiate mug
+	mug_context_create(&mug, window_system, MU_TRUE);
+
+	// Print currently running window system
+	printf("Running window system \"%s\"\n",
+		mu_window_system_get_nice_name(muCOSA_context_get_window_system(&mug.cosa))
+	);
+
+	// Create graphic via window using OpenGL
+	gfx = mu_graphic_create_window(gfx_system, &wininfo);
+
+	// Get window handle
+	win = mu_graphic_get_window(gfx);
+	// Get window keyboard map
+	mu_window_get(win, MU_WINDOW_KEYBOARD_MAP, &keyboard);
+
+/* Print explanation */
+
+	printf("Window with dark grey background should appear\n");
+	printf("A white rect should be moving smoothly from left to right\n");
+	printf("Frame statistics should be printed every second\n");
+	printf("Press 1, 2, or 3 for the immediate, vsync, or adaptive present mode\n");
+	printf("Press P to switch between dropping and catching up on late frames\n");
+	printf("Press escape to close window\n");
+
+/* Main loop */
+
+	// Frame counter, and whether or not P was held last frame
+	uint32_m frame = 0;
+	muBool p_held = MU_FALSE;
+
+	// Run frame-by-frame while graphic exists:
+	while (mu_graphic_exists(gfx))
+	{
+		// Close if escape is pressed
+		if (keyboard[MU_KEYBOARD_ESCAPE]) {
+			mu_window_close(win);
+			continue;
+		}
+
+		// Switch present mode
+		if (keyboard[MU_KEYBOARD_1]) {
+			set_present_mode(MUG_PRESENT_IMMEDIATE);
+		} else if (keyboard[MU_KEYBOARD_2]) {
+			set_present_mode(MUG_PRESENT_VSYNC);
+		} else if (keyboard[MU_KEYBOARD_3]) {
+			set_present_mode(MUG_PRESENT_ADAPTIVE);
+		}
+
+		// Switch frame policy upon pressing P
+		if (keyboard[MU_KEYBOARD_P] && !p_held) {
+			policy = (policy == MUG_FRAME_DROP) ? (MUG_FRAME_CATCH_UP) : (MUG_FRAME_DROP);
+			mu_graphic_frame_policy(gfx, policy);
+			printf("Frame policy: %s\n", policy_names[policy]);
+		}
+		p_held = keyboard[MU_KEYBOARD_P];
+
+		// Print statistics every second
+		if (++frame % (uint32_m)TARGET_FPS == 0) {
+			print_stats();
+		}
+
+		// Clear the graphic with a slightly green-ish very dark grey
+		mu_graphic_clear(gfx, 15.f/255.f, 17.f/255.f, 15.f/255.f);
+
+		// Draw rect, moving a fixed distance each frame
+		mugRect rect = {
+			{ { (float)((frame * 4) % 880) - 40.f, 300.f, 0.f }, { 1.f, 1.f, 1.f, 1.f } },
+			{ 60.f, 200.f }, 0.f
+		};
+		mu_draw_rect(gfx, &rect);
+
+		// Swap graphic buffers (to present image)
+		mu_graphic_swap_buffers(gfx);
+		// Update graphic at ~60 FPS
+		mu_graphic_update(gfx, TARGET_FPS);
+	}
+
+/* Termination */
+
+	// Destroy graphic (required)
+	gfx = mu_graphic_destroy(gfx);
+
+	// Terminate mug (required)
+	mug_context_destroy(&mug);
+
+	// Print possible error
+	if (mug.result != MUG_SUCCESS) {
+		printf("Something went wrong during the program's life; result: %s\n",
+			mug_result_get_name(mug.result)
+		);
+	} else {
+		printf("Successful\n");
+	}
+
+	return 0;
+}
+
+/*
+For all source code:
+
+	------------------------------------------------------------------------------
+	This software is available under 2 licenses -- choose whichever you prefer.
+	------------------------------------------------------------------------------
+	ALTERNATIVE A - MIT License
+	Copyright (c) 2024 Hum
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+	of the Software, and to permit persons to whom the Software is furnished to do
+	so, subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+	------------------------------------------------------------------------------
+	ALTERNATIVE B - Public Domain (www.unlicense.org)
+	This is free and unencumbered software released into the public domain.
+	Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+	software, either in source code form or as a compiled binary, for any purpose,
+	commercial or non-commercial, and by any means.
+	In jurisdictions that recognize copyright laws, the author or authors of this
+	software dedicate any and all copyright interest in the software to the public
+	domain. We make this dedication for the benefit of the public at large and to
+	the detriment of our heirs and successors. We intend this dedication to be an
+	overt act of relinquishment in perpetuity of all present and future rights to
+	this software under copyright law.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+	ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+	WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+	------------------------------------------------------------------------------
+
+For Khronos specifications:
+	
+	Copyright (c) 2013-2020 The Khronos Group Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+
+*/
+
@@ -0,0 +1,293 @@
+/*
+============================================================
+                        DEMO INFO
+
+DEMO NAME:          gpu_zones.c
+DEMO WRITTEN BY:    Muukid
+CREATION DATE:      2026-10-18
+LAST UPDATED:       2026-10-18
+
+============================================================
+                        DEMO PURPOSE
+
+This demo shows how to measure the time that the GPU spends on parts of
+a frame via GPU zones, both automatic ones for each object type rendered
+and one begun manually.
+
+============================================================
+                        LICENSE INFO
+
+This software is licensed under:
+(MIT license OR public domain) AND Apache 2.0.
+More explicit license information at the end of file.
+
+============================================================
+*/
+
+/* Inclusion */
+	
+	// Include mug
+	#define MU_SUPPORT_OPENGL // (For OpenGL support)
+	#define MUG_NAMES // (For mug name functions)
+	#define MUCOSA_NAMES // (For muCOSA name functions)
+	#define MUG_IMPLEMENTATION // (For source code)
+	#include "muGraphics.h"
+
+	// Include stdio for printing
+	#include <stdio.h>
+
+/* Variables */
+	
+	// Global context
+	mugContext mug;
+
+	// Graphic handle
+	muGraphic gfx;
+
+	// Graphic system
+	muGraphicSystem gfx_system = MU_GRAPHIC_OPENGL;
+
+	// The window system
+	muWindowSystem window_system = MU_WINDOW_NULL; // (Auto)
+
+	// Pixel format
+	muPixelFormat format = {
+		// RGBA bits
+		8, 8, 8, 8,
+		// Depth bits
+		24,
+		// Stencil bits
+		0,
+		// Samples
+		1
+	};
+
+	// Window information
+	muWindowInfo wininfo = {
+		// Title
+		(char*)"Window",
+		// Resolution (width & height)
+		800, 600,
+		// Min/Max resolution (none)
+		0, 0, 0, 0,
+		// Coordinates (x and y)
+		50, 50,
+		// Pixel format
+		&format,
+		// Callbacks (default)
+		0
+	};
+
+	// Window handle
+	muWindow win;
+
+	// Window keyboard map
+	muBool* keyboard;
+
+	// Amount of each object
+	#define OBJECT_COUNT 64
+
+	// Objects
+	mugRect rects[OBJECT_COUNT];
+	mugCircle circles[OBJECT_COUNT];
+	mugSquircle squircles[OBJECT_COUNT];
+
+	// Object buffers
+	mugObjects rectbuf;
+	mugObjects circlebuf;
+	mugObjects squirclebuf;
+
+/* Functions */
+
+	// Sets the position and color of an object's center based on its index
+	void place_center(mugPoint* center, uint32_m i) {
+		center->pos[0] = (float)((i * 97) % 800);
+		center->pos[1] = (float)((i * 61) % 600);
+		center->pos[2] = 0.f;
+		center->col[0] = (float)((i * 53) % 256) / 255.f;
+		center->col[1] = (float)((i * 97) % 256) / 255.f;
+		center->col[2] = (float)((i * 193) % 256) / 255.f;
+		center->col[3] = 0.5f;
+	}
+
+int main(void)
+{
+
+/* Initiation */
+
+	printf("Initiating...\n");
+
+	// Initiate mug
+	mug_context_create(&mug, window_system, MU_TRUE);
+
+	// Print currently running window system
+	printf("Running window system \"%s\"\n",
+		mu_window_system_get_nice_name(muCOSA_context_get_window_system(&mug.cosa))
+	);
+
+	// Create graphic via window using OpenGL
+	gfx = mu_graphic_create_window(gfx_system, &wininfo);
+
+	// Get window handle
+	win = mu_graphic_get_window(gfx);
+	// Get window keyboard map
+	mu_window_get(win, MU_WINDOW_KEYBOARD_MAP, &keyboard);
+
+	// Enable GPU zones
+	mu_graphic_gpu_profile(gfx, MU_TRUE);
+
+	// Create large overlapping objects, which take a while to fill
+	for (uint32_m i = 0; i < OBJECT_COUNT; ++i) {
+		place_center(&rects[i].center, i);
+		rects[i].dim[0] = rects[i].dim[1] = 200.f;
+		rects[i].rot = 0.f;
+
+		place_center(&circles[i].center, i + OBJECT_COUNT);
+		circles[i].radius = 100.f;
+
+		place_center(&squircles[i].center, i + OBJECT_COUNT*2);
+		squircles[i].rot = 0.f;
+		squircles[i].radius = 100.f;
+		squircles[i].exp = 4.f;
+	}
+	rectbuf = mu_gobjects_create(gfx, MUG_OBJECT_RECT, OBJECT_COUNT, rects);
+	circlebuf = mu_gobjects_create(gfx, MUG_OBJECT_CIRCLE, OBJECT_COUNT, circles);
+	squirclebuf = mu_gobjects_create(gfx, MUG_OBJECT_SQUIRCLE, OBJECT_COUNT, squircles);
+
+/* Print explanation */
+
+	printf("Window with overlapping rects, circles, and squircles should appear\n");
+	printf("The GPU time of each zone should be printed every second\n");
+	printf("Press escape to close window\n");
+
+/* Main loop */
+
+	// Time of last print
+	double last_print = mu_fixed_time_get();
+
+	// Run frame-by-frame while graphic exists:
+	while (mu_graphic_exists(gfx))
+	{
+		// Close if escape is pressed
+		if (keyboard[MU_KEYBOARD_ESCAPE]) {
+			mu_window_close(win);
+			continue;
+		}
+
+		// Clear the graphic with a slightly green-ish very dark grey
+		mu_graphic_clear(gfx, 15.f/255.f, 17.f/255.f, 15.f/255.f);
+
+		// Render rects and circles, each measured in a zone named after their type
+		mu_gobjects_render(gfx, rectbuf);
+		mu_gobjects_render(gfx, circlebuf);
+
+		// Render squircles in a zone of our own
+		mu_gpu_zone_begin(gfx, "squircles");
+		mu_gobjects_render(gfx, squirclebuf);
+		mu_gpu_zone_end(gfx);
+
+		// Swap graphic buffers (to present image)
+		mu_graphic_swap_buffers(gfx);
+
+		// Print zones every second
+		if (mu_fixed_time_get() - last_print >= 1.0) {
+			last_print = mu_fixed_time_get();
+			mugGPUZone zones[MUG_GPU_ZONE_COUNT];
+			uint32_m count = mu_graphic_get_gpu_zones(gfx, zones, MUG_GPU_ZONE_COUNT);
+			for (uint32_m i = 0; i < count && i < MUG_GPU_ZONE_COUNT; ++i) {
+				printf("%s: %.3fms (last %.3fms, %lu frames)\n", zones[i].name,
+					zones[i].time*1000.0, zones[i].last*1000.0, (unsigned long)zones[i].frames
+				);
+			}
+		}
+
+		// Update graphic at ~100 FPS
+		mu_graphic_update(gfx, 100.f);
+	}
+
+/* Termination */
+
+	// Destroy buffers
+	rectbuf = mu_gobjects_destroy(gfx, rectbuf);
+	circlebuf = mu_gobjects_destroy(gfx, circlebuf);
+	squirclebuf = mu_gobjects_destroy(gfx, squirclebuf);
+
+	// Destroy graphic (required)
+	gfx = mu_graphic_destroy(gfx);
+
+	// Terminate mug (required)
+	mug_context_destroy(&mug);
+
+	// Print possible error
+	if (mug.result != MUG_SUCCESS) {
+		printf("Something went wrong during the program's life; result: %s\n",
+			mug_result_get_name(mug.result)
+		);
+	} else {
+		printf("Successful\n");
+	}
+
+	return 0;
+}
+
+/*
+For all source code:
+
+	------------------------------------------------------------------------------
+	This software is available under 2 licenses -- choose whichever you prefer.
+	------------------------------------------------------------------------------
+	ALTERNATIVE A - MIT License
+	Copyright (c) 2024 Hum
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+	of the Software, and to permit persons to whom the Software is furnished to do
+	so, subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+	------------------------------------------------------------------------------
+	ALTERNATIVE B - Public Domain (www.unlicense.org)
+	This is free and unencumbered software released into the public domain.
+	Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+	software, either in source code form or as a compiled binary, for any purpose,
+	commercial or non-commercial, and by any means.
+	In jurisdictions that recognize copyright laws, the author or authors of this
+	software dedicate any and all copyright interest in the software to the public
+	domain. We make this dedication for the benefit of the public at large and to
+	the detriment of our heirs and successors. We intend this dedication to be an
+	overt act of relinquishment in perpetuity of all present and future rights to
+	this software under copyright law.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+	ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+	WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+	------------------------------------------------------------------------------
+
+For Khronos specifications:
+	
+	Copyright (c) 2013-2020 The Khronos Group Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+
+*/
+
@@ -0,0 +1,375 @@
+/*
+============================================================
+                        DEMO INFO
+
+DEMO NAME:          memory.c
+DEMO WRITTEN BY:    Muukid
+CREATION DATE:      2026-10-18
+LAST UPDATED:       2026-10-18
+
+============================================================
+                        DEMO PURPOSE
+
+This demo shows how to retrieve the GPU memory report of a graphic, and
+how to be notified once the GPU memory that it holds goes over a
+threshold.
+
+============================================================
+                        LICENSE INFO
+
+This software is licensed under:
+(MIT license OR public domain) AND Apache 2.0.
+More explicit license information at the end of file.
+
+============================================================
+*/
+
+/* Inclusion */
+
+	// Include mug
+	#define MU_SUPPORT_OPENGL // (For OpenGL support)
+	#define MUG_NAMES // (For mug name functions)
+	#define MUCOSA_NAMES // (For muCOSA name functions)
+	#define MUG_IMPLEMENTATION // (For source code)
+	#include "muGraphics.h"
+
+	// Include stdio for printing
+	#include <stdio.h>
+
+/* Variables */
+	
+	// Global context
+	mugContext mug;
+
+	// Graphic handle
+	muGraphic gfx;
+
+	// Graphic system
+	muGraphicSystem gfx_system = MU_GRAPHIC_OPENGL;
+
+	// The window system
+	muWindowSystem window_system = MU_WINDOW_NULL; // (Auto)
+
+	// Pixel format
+	muPixelFormat format = {
+		// RGBA bits
+		8, 8, 8, 8,
+		// Depth bits
+		24,
+		// Stencil bits
+		0,
+		// Samples
+		1
+	};
+
+	// Window information
+	muWindowInfo wininfo = {
+		// Title
+		(char*)"Window",
+		// Resolution (width & height)
+		800, 600,
+		// Min/Max resolution (none)
+		0, 0, 0, 0,
+		// Coordinates (x and y)
+		50, 50,
+		// Pixel format
+		&format,
+		// Callbacks (default)
+		0
+	};
+
+	// Window handle
+	muWindow win;
+
+	// Window keyboard map
+	muBool* keyboard;
+
+	// Maximum amount of rect buffers
+	#define BUFFER_COUNT 64
+	// Amount of rects per buffer
+	#define RECT_COUNT 1024
+
+	// Rects
+	mugRect rects[RECT_COUNT];
+
+	// Rect object buffers, and amount of them created
+	mugObjects rectbufs[BUFFER_COUNT];
+	uint32_m rectbuf_count = 0;
+
+	// Texture drawn in the background
+	mugTexture tex;
+	// Texture object buffer
+	mugObjects texbuf;
+
+	// Threshold (8 MiB)
+	#define THRESHOLD (8*1024*1024)
+
+/* Functions */
+
+	// Names of each object type
+	const char* object_type_names[MUG_OBJECT_LAST+1] = {
+		"", "Points", "Lines", "Triangles", "Rects", "Circles",
+		"Squircles", "Round rects", "2D texture rects", "2D texture array rects"
+	};
+
+	// Prints a memory usage
+	void print_usage(const char* name, mugMemoryUsage* usage) {
+		if (usage->count) {
+			printf("\t%s: %lu, %lu bytes (%lu used)\n", name,
+				(unsigned long)usage->count, (unsigned long)usage->bytes, (unsigned long)usage->used
+			);
+		}
+	}
+
+	// Prints a memory report
+	void print_report(mugMemoryReport* report) {
+		for (mugObjectType type = MUG_OBJECT_FIRST; type <= MUG_OBJECT_LAST; ++type) {
+			print_usage(object_type_names[type], &report->objects[type]);
+		}
+		print_usage("Immediate", &report->immediate);
+		print_usage("Textures", &report->textures);
+		print_usage("Renderbuffers", &report->renderbuffers);
+		print_usage("Staging", &report->staging);
+		printf("\ttotal %lu bytes, peak %lu bytes\n",
+			(unsigned long)report->total, (unsigned long)report->peak
+		);
+	}
+
+	// Called once the graphic's memory goes over the threshold
+	void memory_over(muGraphic g, void* user, mugMemoryReport* report) {
+		printf("Over threshold of %lu bytes!\n", (unsigned long)THRESHOLD);
+		print_report(report);
+		return; if (g) {} if (user) {}
+	}
+
+int main(void)
+{
+
+/* Initiation */
+
+	printf("Initiating...\n");
+
+	// Initiate mug
+	mug_context_create(&mug, window_system, MU_TRUE);
+
+	// Print currently running window system
+	printf("Running window system \"%s\"\n",
+		mu_window_system_get_nice_name(muCOSA_context_get_window_system(&mug.cosa))
+	);
+
+	// Create graphic via window using OpenGL
+	gfx = mu_graphic_create_window(gfx_system, &wininfo);
+
+	// Get window handle
+	win = mu_graphic_get_window(gfx);
+	// Get window keyboard map
+	mu_window_get(win, MU_WINDOW_KEYBOARD_MAP, &keyboard);
+
+	// Set threshold
+	mu_graphic_memory_threshold(gfx, THRESHOLD, memory_over, 0);
+
+	// Create a mipmapped checkerboard texture
+	{
+		muByte pixels[256*256*4];
+		for (uint32_m y = 0; y < 256; ++y) {
+			for (uint32_m x = 0; x < 256; ++x) {
+				muByte c = (((x / 32) + (y / 32)) % 2) ? (60) : (30);
+				muByte* p = &pixels[(y*256 + x)*4];
+				p[0] = p[1] = p[2] = c;
+				p[3] = 255;
+			}
+		}
+		mugTextureInfo info = {
+			MUG_TEXTURE_2D, MUG_TEXTURE_U8_RGBA,
+			{ MUG_TEXTURE_REPEAT, MUG_TEXTURE_REPEAT },
+			{ MUG_TEXTURE_NEAREST, MUG_TEXTURE_TRILINEAR },
+			0, 0
+		};
+		uint32_m dim[2] = { 256, 256 };
+		tex = mu_gtexture_create(gfx, &info, dim, pixels);
+	}
+
+	// Create texture object buffer covering the window
+	mug2DTextureRect texobj = {
+		{ { 400.f, 300.f, 0.f }, { 1.f, 1.f, 1.f, 1.f } },
+		{ 800.f, 600.f }, 0.f,
+		{ 0.f, 0.f }, { 1.f, 1.f }
+	};
+	texbuf = mu_gobjects_create(gfx, MUG_OBJECT_TEXTURE_2D, 1, &texobj);
+	mu_gobjects_texture(gfx, texbuf, tex);
+
+	// Describe rects
+	for (uint32_m i = 0; i < RECT_COUNT; ++i) {
+		rects[i].center.pos[0] = (float)((i * 37) % 800);
+		rects[i].center.pos[1] = (float)((i * 91) % 600);
+		rects[i].center.pos[2] = 0.f;
+		rects[i].center.col[0] = (float)((i * 53) % 256) / 255.f;
+		rects[i].center.col[1] = (float)((i * 97) % 256) / 255.f;
+		rects[i].center.col[2] = (float)((i * 193) % 256) / 255.f;
+		rects[i].center.col[3] = 1.f;
+		rects[i].dim[0] = rects[i].dim[1] = 6.f;
+		rects[i].rot = 0.f;
+	}
+
+/* Print explanation */
+
+	printf("Window with a checkerboard should appear\n");
+	printf("Press space to create another buffer of rects\n");
+	printf("Press backspace to destroy the latest buffer of rects\n");
+	printf("Press enter to print the GPU memory report\n");
+	printf("A message should be printed once over %lu bytes are held\n", (unsigned long)THRESHOLD);
+	printf("Press escape to close window\n");
+
+/* Main loop */
+
+	// Keys held last frame
+	muBool space_held = MU_FALSE, back_held = MU_FALSE, enter_held = MU_FALSE;
+
+	// Run frame-by-frame while graphic exists:
+	while (mu_graphic_exists(gfx))
+	{
+		// Close if escape is pressed
+		if (keyboard[MU_KEYBOARD_ESCAPE]) {
+			mu_window_close(win);
+			continue;
+		}
+
+		// Create buffer if space is pressed
+		if (keyboard[MU_KEYBOARD_SPACE] && !space_held && rectbuf_count < BUFFER_COUNT) {
+			rectbufs[rectbuf_count++] = mu_gobjects_create(gfx, MUG_OBJECT_RECT, RECT_COUNT, rects);
+			for (uint32_m i = 0; i < RECT_COUNT; ++i) {
+				rects[i].center.pos[0] = (float)(((uint32_m)rects[i].center.pos[0] + 13) % 800);
+			}
+		}
+		space_held = keyboard[MU_KEYBOARD_SPACE];
+
+		// Destroy buffer if backspace is pressed
+		if (keyboard[MU_KEYBOARD_BACKSPACE] && !back_held && rectbuf_count) {
+			--rectbuf_count;
+			rectbufs[rectbuf_count] = mu_gobjects_destroy(gfx, rectbufs[rectbuf_count]);
+		}
+		back_held = keyboard[MU_KEYBOARD_BACKSPACE];
+
+		// Print report if enter is pressed
+		if (keyboard[MU_KEYBOARD_RETURN] && !enter_held) {
+			mugMemoryReport report;
+			mu_graphic_memory_report(gfx, &report);
+			printf("GPU memory:\n");
+			print_report(&report);
+		}
+		enter_held = keyboard[MU_KEYBOARD_RETURN];
+
+		// Clear the graphic with a slightly green-ish very dark grey
+		mu_graphic_clear(gfx, 15.f/255.f, 17.f/255.f, 15.f/255.f);
+
+		// Render background and rects
+		mu_gobjects_render(gfx, texbuf);
+		for (uint32_m b = 0; b < rectbuf_count; ++b) {
+			mu_gobjects_render(gfx, rectbufs[b]);
+		}
+
+		// Draw a rect in the corner immediately
+		mugRect corner = { { { 20.f, 20.f, 0.f }, { 1.f, 1.f, 1.f, 1.f } }, { 20.f, 20.f }, 0.f };
+		mu_draw_rect(gfx, &corner);
+
+		// Swap graphic buffers (to present image)
+		mu_graphic_swap_buffers(gfx);
+
+		// Update graphic at ~100 FPS
+		mu_graphic_update(gfx, 100.f);
+	}
+
+/* Termination */
+
+	// Destroy buffers and texture
+	for (uint32_m b = 0; b < rectbuf_count; ++b) {
+		rectbufs[b] = mu_gobjects_destroy(gfx, rectbufs[b]);
+	}
+	texbuf = mu_gobjects_destroy(gfx, texbuf);
+	tex = mu_gtexture_destroy(gfx, tex);
+
+	// Print final report (only the graphic's own resources should remain)
+	mugMemoryReport report;
+	mu_graphic_memory_report(gfx, &report);
+	printf("GPU memory at termination:\n");
+	print_report(&report);
+
+	// Destroy graphic (required)
+	gfx = mu_graphic_destroy(gfx);
+
+	// Terminate mug (required)
+	mug_context_destroy(&mug);
+
+	// Print possible error
+	if (mug.result != MUG_SUCCESS) {
+		printf("Something went wrong during the program's life; result: %s\n",
+			mug_result_get_name(mug.result)
+		);
+	} else {
+		printf("Successful\n");
+	}
+
+	return 0;
+}
+
+/*
+For all source code:
+
+	------------------------------------------------------------------------------
+	This software is available under 2 licenses -- choose whichever you prefer.
+	------------------------------------------------------------------------------
+	ALTERNATIVE A - MIT License
+	Copyright (c) 2024 Hum
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+	of the Software, and to permit persons to whom the Software is furnished to do
+	so, subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+	------------------------------------------------------------------------------
+	ALTERNATIVE B - Public Domain (www.unlicense.org)
+	This is free and unencumbered software released into the public domain.
+	Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+	software, either in source code form or as a compiled binary, for any purpose,
+	commercial or non-commercial, and by any means.
+	In jurisdictions that recognize copyright laws, the author or authors of this
+	software dedicate any and all copyright interest in the software to the public
+	domain. We make this dedication for the benefit of the public at large and to
+	the detriment of our heirs and successors. We intend this dedication to be an
+	overt act of relinquishment in perpetuity of all present and future rights to
+	this software under copyright law.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+	ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+	WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+	------------------------------------------------------------------------------
+
+For Khronos specifications:
+	
+	Copyright (c) 2013-2020 The Khronos Group Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+
+*/
+
@@ -0,0 +1,300 @@
+/*
+============================================================
+                        DEMO INFO
+
+DEMO NAME:          partial_redraw.c
+DEMO WRITTEN BY:    Muukid
+CREATION DATE:      2026-10-18
+LAST UPDATED:       2026-10-18
+
+============================================================
+                        DEMO PURPOSE
+
+This demo shows partial redraw. A grid of small rects is
+drawn, with one rect changing color every half second,
+and only the area of the changed rect is redrawn. The
+area redrawn each frame is printed, and D switches
+partial redraw on and off.
+
+============================================================
+                        LICENSE INFO
+
+This software is licensed under:
+(MIT license OR public domain) AND Apache 2.0.
+More explicit license information at the end of file.
+
+============================================================
+*/
+
+/* Inclusion */
+	
+	// Include mug
+	#define MU_SUPPORT_OPENGL // (For OpenGL support)
+	#define MUG_NAMES // (For mug name functions)
+	#define MUCOSA_NAMES // (For muCOSA name functions)
+	#define MUG_IMPLEMENTATION // (For source code)
+	#include "muGraphics.h"
+
+	// Include stdio for printing
+	#include <stdio.h>
+
+/* Variables */
+	
+	// Global context
+	mugContext mug;
+
+	// Graphic handle
+	muGraphic gfx;
+
+	// Graphic system
+	muGraphicSystem gfx_system = MU_GRAPHIC_OPENGL;
+
+	// The window system
+	muWindowSystem window_system = MU_WINDOW_NULL; // (Auto)
+
+	// Pixel format
+	muPixelFormat format = {
+		// RGBA bits
+		8, 8, 8, 8,
+		// Depth bits
+		24,
+		// Stencil bits
+		0,
+		// Samples
+		1
+	};
+
+	// Window information
+	muWindowInfo wininfo = {
+		// Title
+		(char*)"Window",
+		// Resolution (width & height)
+		800, 600,
+		// Min/Max resolution (none)
+		0, 0, 0, 0,
+		// Coordinates (x and y)
+		50, 50,
+		// Pixel format
+		&format,
+		// Callbacks (default)
+		0
+	};
+
+	// Window handle
+	muWindow win;
+
+	// Window keyboard map
+	muBool* keyboard;
+
+	// Grid dimensions, in rects
+	#define GRID_W 32
+	#define GRID_H 24
+	// Size of each grid cell, in pixels
+	#define CELL 25.f
+
+	// Rects
+	mugRect rects[GRID_W*GRID_H];
+
+	// Rect object buffer
+	mugObjects rectbuf;
+
+	// Whether or not partial redraw is enabled
+	muBool partial = MU_TRUE;
+
+/* Functions */
+
+	// Sets the color of a rect based on a value
+	void color_rect(mugRect* rect, uint32_m value) {
+		rect->center.col[0] = (float)((value * 53) % 256) / 255.f;
+		rect->center.col[1] = (float)((value * 97) % 256) / 255.f;
+		rect->center.col[2] = (float)((value * 193) % 256) / 255.f;
+		rect->center.col[3] = 1.f;
+	}
+
+int main(void)
+{
+
+/* Initiation */
+
+	printf("Initiating...\n");
+
+	// Initiate mug
+	mug_context_create(&mug, window_system, MU_TRUE);
+
+	// Print currently running window system
+	printf("Running window system \"%s\"\n",
+		mu_window_system_get_nice_name(muCOSA_context_get_window_system(&mug.cosa))
+	);
+
+	// Create graphic via window using OpenGL
+	gfx = mu_graphic_create_window(gfx_system, &wininfo);
+
+	// Get window handle
+	win = mu_graphic_get_window(gfx);
+	// Get window keyboard map
+	mu_window_get(win, MU_WINDOW_KEYBOARD_MAP, &keyboard);
+
+	// Enable partial redraw
+	mu_graphic_partial_redraw(gfx, partial);
+
+	// Create grid of rects
+	for (uint32_m y = 0; y < GRID_H; ++y) {
+		for (uint32_m x = 0; x < GRID_W; ++x) {
+			mugRect* rect = &rects[y*GRID_W + x];
+			rect->center.pos[0] = ((float)x + 0.5f) * CELL;
+			rect->center.pos[1] = ((float)y + 0.5f) * CELL;
+			rect->center.pos[2] = 0.f;
+			color_rect(rect, y*GRID_W + x);
+			rect->dim[0] = rect->dim[1] = CELL - 5.f;
+			rect->rot = 0.f;
+		}
+	}
+	rectbuf = mu_gobjects_create(gfx, MUG_OBJECT_RECT, GRID_W*GRID_H, rects);
+
+/* Print explanation */
+
+	printf("Window with a grid of colored rects should appear\n");
+	printf("One rect should change color every half second\n");
+	printf("The area redrawn each frame should be printed\n");
+	printf("Press D to switch partial redraw on and off\n");
+	printf("Press escape to close window\n");
+
+/* Main loop */
+
+	// Amount of rects changed, time of last change, and whether or not D was held last frame
+	uint32_m changes = 0;
+	double last_change = mu_fixed_time_get();
+	muBool d_held = MU_FALSE;
+
+	// Run frame-by-frame while graphic exists:
+	while (mu_graphic_exists(gfx))
+	{
+		// Close if escape is pressed
+		if (keyboard[MU_KEYBOARD_ESCAPE]) {
+			mu_window_close(win);
+			continue;
+		}
+
+		// Switch partial redraw upon pressing D
+		if (keyboard[MU_KEYBOARD_D] && !d_held) {
+			partial = !partial;
+			mu_graphic_partial_redraw(gfx, partial);
+			printf("Partial redraw: %s\n", (partial) ? ("on") : ("off"));
+		}
+		d_held = keyboard[MU_KEYBOARD_D];
+
+		// Change the color of the next rect every half second
+		if (mu_fixed_time_get() - last_change >= 0.5) {
+			last_change = mu_fixed_time_get();
+			uint32_m i = (changes * 37) % (GRID_W*GRID_H);
+			color_rect(&rects[i], ++changes + GRID_W*GRID_H);
+			mu_gobjects_subfill(gfx, rectbuf, i, 1, &rects[i]);
+		}
+
+		// Redraw if something has changed
+		if (mu_graphic_needs_redraw(gfx)) {
+			// Print area being redrawn
+			float area[4];
+			if (mu_graphic_get_damage(gfx, area)) {
+				printf("Redrawing %.0fx%.0f pixels at (%.0f, %.0f)\n", area[2], area[3], area[0], area[1]);
+			}
+
+			// Clear the graphic with a slightly green-ish very dark grey
+			mu_graphic_clear(gfx, 15.f/255.f, 17.f/255.f, 15.f/255.f);
+
+			// Render rects
+			mu_gobjects_render(gfx, rectbuf);
+
+			// Swap graphic buffers (to present image)
+			mu_graphic_swap_buffers(gfx);
+		}
+
+		// Wait for the next window event, or for the next change
+		double timeout = 0.5 - (mu_fixed_time_get() - last_change);
+		mu_graphic_update_wait(gfx, (timeout > 0.0) ? (timeout) : (0.0));
+	}
+
+/* Termination */
+
+	// Destroy buffer
+	rectbuf = mu_gobjects_destroy(gfx, rectbuf);
+
+	// Destroy graphic (required)
+	gfx = mu_graphic_destroy(gfx);
+
+	// Terminate mug (required)
+	mug_context_destroy(&mug);
+
+	// Print possible error
+	if (mug.result != MUG_SUCCESS) {
+		printf("Something went wrong during the program's life; result: %s\n",
+			mug_result_get_name(mug.result)
+		);
+	} else {
+		printf("Successful\n");
+	}
+
+	return 0;
+}
+
+/*
+For all source code:
+
+	------------------------------------------------------------------------------
+	This software is available under 2 licenses -- choose whichever you prefer.
+	------------------------------------------------------------------------------
+	ALTERNATIVE A - MIT License
+	Copyright (c) 2024 Hum
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+	of the Software, and to permit persons to whom the Software is furnished to do
+	so, subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+	------------------------------------------------------------------------------
+	ALTERNATIVE B - Public Domain (www.unlicense.org)
+	This is free and unencumbered software released into the public domain.
+	Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+	software, either in source code form or as a compiled binary, for any purpose,
+	commercial or non-commercial, and by any means.
+	In jurisdictions that recognize copyright laws, the author or authors of this
+	software dedicate any and all copyright interest in the software to the public
+	domain. We make this dedication for the benefit of the public at large and to
+	the detriment of our heirs and successors. We intend this dedication to be an
+	overt act of relinquishment in perpetuity of all present and future rights to
+	this software under copyright law.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+	ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+	WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+	------------------------------------------------------------------------------
+
+For Khronos specifications:
+	
+	Copyright (c) 2013-2020 The Khronos Group Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+
+*/
+
@@ -0,0 +1,309 @@
+/*
+============================================================
+                        DEMO INFO
+
+DEMO NAME:          picking.c
+DEMO WRITTEN BY:    Muukid
+CREATION DATE:      2026-10-18
+LAST UPDATED:       2026-10-18
+
+============================================================
+                        DEMO PURPOSE
+
+This demo tests if picking works by creating a buffer of
+overlapping circles, and highlighting the topmost circle
+underneath the mouse cursor in white. Only the circle
+visually on top should be highlighted, and moving the
+cursor just outside of a circle's edge should un-highlight
+it.
+
+If the user presses escape, the window will close.
+
+============================================================
+                        LICENSE INFO
+
+This software is licensed under:
+(MIT license OR public domain) AND Apache 2.0.
+More explicit license information at the end of file.
+
+============================================================
+*/
+
+/* Inclusion */
+	
+	// Include mug
+	#define MU_SUPPORT_OPENGL // (For OpenGL support)
+	#define MUG_NAMES // (For mug name functions)
+	#define MUCOSA_NAMES // (For muCOSA name functions)
+	#define MUG_IMPLEMENTATION // (For source code)
+	#include "muGraphics.h"
+
+	// Include stdio for printing
+	#include <stdio.h>
+
+/* Variables */
+	
+	// Global context
+	mugContext mug;
+
+	// Graphic handle
+	muGraphic gfx;
+
+	// Graphic system
+	muGraphicSystem gfx_system = MU_GRAPHIC_OPENGL;
+
+	// The window system
+	muWindowSystem window_system = MU_WINDOW_NULL; // (Auto)
+
+	// Pixel format
+	muPixelFormat format = {
+		// RGBA bits
+		8, 8, 8, 8,
+		// Depth bits
+		24,
+		// Stencil bits
+		0,
+		// Samples
+		1
+	};
+
+	// Window information
+	muWindowInfo wininfo = {
+		// Title
+		(char*)"Window",
+		// Resolution (width & height)
+		800, 600,
+		// Min/Max resolution (none)
+		0, 0, 0, 0,
+		// Coordinates (x and y)
+		50, 50,
+		// Pixel format
+		&format,
+		// Callbacks (default)
+		0
+	};
+
+	// Window handle
+	muWindow win;
+
+	// Window keyboard map
+	muBool* keyboard;
+
+	// Circle object buffer
+	mugObjects circlebuf;
+
+/* Macros */
+
+	// Amount of circles per row/column
+	#define GRID_W 24
+	#define GRID_H 18
+
+	// Distance between circles
+	#define SPACING 32.f
+
+	// Radius of each circle
+	#define RADIUS 22.f
+
+	// Index representing no circle
+	#define NO_CIRCLE 0xFFFFFFFF
+
+/* Globals */
+
+	// Circles
+	mugCircle circles[GRID_W*GRID_H];
+
+	// Index of highlighted circle
+	uint32_m highlighted = NO_CIRCLE;
+
+/* Functions */
+
+	// Creates the circle buffer
+	void create_circles(void) {
+		// Fill each circle
+		for (uint32_m y = 0; y < GRID_H; ++y) {
+			for (uint32_m x = 0; x < GRID_W; ++x) {
+				mugCircle circle = {
+					{ { 32.f + x*SPACING, 28.f + y*SPACING, 0.f }, { x/(float)GRID_W, y/(float)GRID_H, 0.6f, 1.f } },
+					RADIUS
+				};
+				circles[y*GRID_W + x] = circle;
+			}
+		}
+
+		// Create buffer
+		circlebuf = mu_gobjects_create(gfx, MUG_OBJECT_CIRCLE, GRID_W*GRID_H, circles);
+
+		// Enable spatial index (required for picking)
+		mu_gobjects_index(gfx, circlebuf, SPACING*2.f);
+	}
+
+	// Highlights the topmost circle under the cursor
+	void highlight_circle(void) {
+		// Get cursor position
+		int32_m cursor[2] = { 0, 0 };
+		mu_window_get(win, MU_WINDOW_CURSOR, cursor);
+
+		// Pick topmost circle
+		uint32_m index;
+		if (!mu_gobjects_pick(gfx, circlebuf, (float)cursor[0], (float)cursor[1], &index, 1)) {
+			index = NO_CIRCLE;
+		}
+		if (index == highlighted) {
+			return;
+		}
+
+		// Restore previously highlighted circle
+		if (highlighted != NO_CIRCLE) {
+			mu_gobjects_subfill(gfx, circlebuf, highlighted, 1, &circles[highlighted]);
+		}
+
+		// Highlight new circle
+		highlighted = index;
+		if (highlighted != NO_CIRCLE) {
+			mugCircle white = circles[highlighted];
+			white.center.col[0] = white.center.col[1] = white.center.col[2] = 1.f;
+			mu_gobjects_subfill(gfx, circlebuf, highlighted, 1, &white);
+		}
+	}
+
+int main(void)
+{
+
+/* Initiation */
+
+	printf("Initiating...\n");
+
+	// Initiate mug
+	mug_context_create(&mug, window_system, MU_TRUE);
+
+	// Print currently running window system
+	printf("Running window system \"%s\"\n",
+		mu_window_system_get_nice_name(muCOSA_context_get_window_system(&mug.cosa))
+	);
+
+	// Create graphic via window using OpenGL
+	gfx = mu_graphic_create_window(gfx_system, &wininfo);
+
+	// Get window handle
+	win = mu_graphic_get_window(gfx);
+	// Get window keyboard map
+	mu_window_get(win, MU_WINDOW_KEYBOARD_MAP, &keyboard);
+
+	// Create circles
+	create_circles();
+
+/* Print explanation */
+
+	printf("Window with dark grey background should appear\n");
+	printf("A grid of overlapping multicolored circles should be visible\n");
+	printf("The topmost circle under the cursor should be highlighted in white\n");
+	printf("Press escape to close window\n");
+
+/* Main loop */
+
+	// Run frame-by-frame while graphic exists:
+	while (mu_graphic_exists(gfx))
+	{
+		// Close if escape is pressed
+		if (keyboard[MU_KEYBOARD_ESCAPE]) {
+			mu_window_close(win);
+			continue;
+		}
+
+		// Clear the graphic with a slightly green-ish very dark grey
+		mu_graphic_clear(gfx, 15.f/255.f, 17.f/255.f, 15.f/255.f);
+
+		// Highlight and render circles
+		highlight_circle();
+		mu_gobjects_render(gfx, circlebuf);
+
+		// Swap graphic buffers (to present image)
+		mu_graphic_swap_buffers(gfx);
+		// Update graphic at ~100 FPS
+		mu_graphic_update(gfx, 100.f);
+	}
+
+/* Termination */
+
+	// Destroy buffer (required)
+	circlebuf = mu_gobjects_destroy(gfx, circlebuf);
+
+	// Destroy graphic (required)
+	gfx = mu_graphic_destroy(gfx);
+
+	// Terminate mug (required)
+	mug_context_destroy(&mug);
+
+	// Print possible error
+	if (mug.result != MUG_SUCCESS) {
+		printf("Something went wrong during the program's life; result: %s\n",
+			mug_result_get_name(mug.result)
+		);
+	} else {
+		printf("Successful\n");
+	}
+
+	return 0;
+}
+
+/*
+For all source code:
+
+	------------------------------------------------------------------------------
+	This software is available under 2 licenses -- choose whichever you prefer.
+	------------------------------------------------------------------------------
+	ALTERNATIVE A - MIT License
+	Copyright (c) 2024 Hum
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+	of the Software, and to permit persons to whom the Software is furnished to do
+	so, subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+	------------------------------------------------------------------------------
+	ALTERNATIVE B - Public Domain (www.unlicense.org)
+	This is free and unencumbered software released into the public domain.
+	Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+	software, either in source code form or as a compiled binary, for any purpose,
+	commercial or non-commercial, and by any means.
+	In jurisdictions that recognize copyright laws, the author or authors of this
+	software dedicate any and all copyright interest in the software to the public
+	domain. We make this dedication for the benefit of the public at large and to
+	the detriment of our heirs and successors. We intend this dedication to be an
+	overt act of relinquishment in perpetuity of all present and future rights to
+	this software under copyright law.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+	ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+	WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+	------------------------------------------------------------------------------
+
+For Khronos specifications:
+	
+	Copyright (c) 2013-2020 The Khronos Group Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+
+*/
+
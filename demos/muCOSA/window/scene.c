@@ -0,0 +1,338 @@
+/*
+============================================================
+                        DEMO INFO
+
+DEMO NAME:          scene.c
+DEMO WRITTEN BY:    Muukid
+CREATION DATE:      2026-10-18
+LAST UPDATED:       2026-10-18
+
+============================================================
+                        DEMO PURPOSE
+
+This demo tests if scenes work by keeping a scene of rects
+and circles. A new circle is added at a random position
+every tenth of a second, and the oldest circle is removed
+once there are more than 64 of them. The rects form a row
+along the bottom of the window, and only one of them is
+updated per frame, lighting it up, the light moving along
+the row over time.
+
+If the user presses escape, the window will close.
+
+============================================================
+                        LICENSE INFO
+
+This software is licensed under:
+(MIT license OR public domain) AND Apache 2.0.
+More explicit license information at the end of file.
+
+============================================================
+*/
+
+/* Inclusion */
+	
+	// Include mug
+	#define MU_SUPPORT_OPENGL // (For OpenGL support)
+	#define MUG_NAMES // (For mug name functions)
+	#define MUCOSA_NAMES // (For muCOSA name functions)
+	#define MUG_IMPLEMENTATION // (For source code)
+	#include "muGraphics.h"
+
+	// Include stdio for printing
+	#include <stdio.h>
+
+	// Include stdlib for random numbers
+	#include <stdlib.h>
+
+/* Variables */
+	
+	// Global context
+	mugContext mug;
+
+	// Graphic handle
+	muGraphic gfx;
+
+	// Graphic system
+	muGraphicSystem gfx_system = MU_GRAPHIC_OPENGL;
+
+	// The window system
+	muWindowSystem window_system = MU_WINDOW_NULL; // (Auto)
+
+	// Pixel format
+	muPixelFormat format = {
+		// RGBA bits
+		8, 8, 8, 8,
+		// Depth bits
+		24,
+		// Stencil bits
+		0,
+		// Samples
+		1
+	};
+
+	// Window information
+	muWindowInfo wininfo = {
+		// Title
+		(char*)"Window",
+		// Resolution (width & height)
+		800, 600,
+		// Min/Max resolution (none)
+		0, 0, 0, 0,
+		// Coordinates (x and y)
+		50, 50,
+		// Pixel format
+		&format,
+		// Callbacks (default)
+		0
+	};
+
+	// Window handle
+	muWindow win;
+
+	// Window keyboard map
+	muBool* keyboard;
+
+	// Scene handle
+	mugScene scene;
+
+/* Macros */
+
+	// Amount of rects in the row
+	#define RECT_COUNT 16
+
+	// Maximum amount of circles
+	#define CIRCLE_COUNT 64
+
+/* Rects */
+
+	// Handles to each rect
+	mugSceneObject rect_handles[RECT_COUNT];
+
+	// Which rect is currently lit up
+	uint32_m lit_rect = 0;
+
+	// Fills in a rect in the row
+	void fill_rect(mugRect* rect, uint32_m i, muBool lit) {
+		float w = 800.f / RECT_COUNT;
+		mugRect r = {
+			{ { (i+0.5f)*w, 560.f, 0.f }, { 0.3f, 0.3f, 0.3f, 1.f } },
+			{ w-6.f, 60.f }, 0.f
+		};
+		if (lit) {
+			r.center.col[0] = 1.f;
+			r.center.col[1] = 0.8f;
+			r.center.col[2] = 0.2f;
+		}
+		*rect = r;
+	}
+
+	// Adds all rects to the scene
+	void add_rects(void) {
+		for (uint32_m i = 0; i < RECT_COUNT; ++i) {
+			mugRect rect;
+			fill_rect(&rect, i, i == lit_rect);
+			rect_handles[i] = mu_scene_add(gfx, scene, MUG_OBJECT_RECT, &rect);
+		}
+	}
+
+	// Moves the light along the row every frame
+	// (Only the two rects changed get uploaded)
+	void update_rects(void) {
+		mugRect rect;
+		// Unlight previous rect
+		fill_rect(&rect, lit_rect, MU_FALSE);
+		mu_scene_update(gfx, scene, rect_handles[lit_rect], &rect);
+		// Light next rect
+		lit_rect = (uint32_m)(mu_fixed_time_get() * 8.0) % RECT_COUNT;
+		fill_rect(&rect, lit_rect, MU_TRUE);
+		mu_scene_update(gfx, scene, rect_handles[lit_rect], &rect);
+	}
+
+/* Circles */
+
+	// Handles to each circle, oldest first
+	mugSceneObject circle_handles[CIRCLE_COUNT];
+	// Amount of circles
+	uint32_m circle_count = 0;
+	// Time the last circle was added
+	double last_circle_time = 0.0;
+
+	// Random float between 0 and 1
+	float randf(void) {
+		return (float)rand() / (float)RAND_MAX;
+	}
+
+	// Adds a circle every tenth of a second, removing the oldest one if needed
+	void update_circles(void) {
+		double time = mu_fixed_time_get();
+		if (time - last_circle_time < 0.1) {
+			return;
+		}
+		last_circle_time = time;
+
+		// Remove oldest circle if there are too many
+		if (circle_count == CIRCLE_COUNT) {
+			mu_scene_remove(gfx, scene, circle_handles[0]);
+			for (uint32_m i = 1; i < CIRCLE_COUNT; ++i) {
+				circle_handles[i-1] = circle_handles[i];
+			}
+			circle_count -= 1;
+		}
+
+		// Add new circle
+		mugCircle circle = {
+			{ { randf()*800.f, randf()*500.f, 0.f }, { randf(), randf(), randf(), 1.f } },
+			10.f + randf()*30.f
+		};
+		circle_handles[circle_count++] = mu_scene_add(gfx, scene, MUG_OBJECT_CIRCLE, &circle);
+	}
+
+int main(void)
+{
+
+/* Initiation */
+
+	printf("Initiating...\n");
+
+	// Initiate mug
+	mug_context_create(&mug, window_system, MU_TRUE);
+
+	// Print currently running window system
+	printf("Running window system \"%s\"\n",
+		mu_window_system_get_nice_name(muCOSA_context_get_window_system(&mug.cosa))
+	);
+
+	// Create graphic via window using OpenGL
+	gfx = mu_graphic_create_window(gfx_system, &wininfo);
+
+	// Get window handle
+	win = mu_graphic_get_window(gfx);
+	// Get window keyboard map
+	mu_window_get(win, MU_WINDOW_KEYBOARD_MAP, &keyboard);
+
+	// Create scene
+	scene = mu_scene_create(gfx);
+
+	// Add rects to scene
+	add_rects();
+
+/* Print explanation */
+
+	printf("Window with dark grey background should appear\n");
+	printf("Circles of random colors should be appearing at random positions\n");
+	printf("Once there are 64 circles, the oldest circles should be disappearing\n");
+	printf("A light should be moving along the row of rects at the bottom\n");
+	printf("Press escape to close window\n");
+
+/* Main loop */
+
+	// Run frame-by-frame while graphic exists:
+	while (mu_graphic_exists(gfx))
+	{
+		// Close if escape is pressed
+		if (keyboard[MU_KEYBOARD_ESCAPE]) {
+			mu_window_close(win);
+			continue;
+		}
+
+		// Clear the graphic with a slightly green-ish very dark grey
+		mu_graphic_clear(gfx, 15.f/255.f, 17.f/255.f, 15.f/255.f);
+
+		// Update scene contents
+		update_rects();
+		update_circles();
+
+		// Render scene
+		mu_scene_render(gfx, scene);
+
+		// Swap graphic buffers (to present image)
+		mu_graphic_swap_buffers(gfx);
+		// Update graphic at ~100 FPS
+		mu_graphic_update(gfx, 100.f);
+	}
+
+/* Termination */
+
+	// Destroy scene (required)
+	scene = mu_scene_destroy(gfx, scene);
+
+	// Destroy graphic (required)
+	gfx = mu_graphic_destroy(gfx);
+
+	// Terminate mug (required)
+	mug_context_destroy(&mug);
+
+	// Print possible error
+	if (mug.result != MUG_SUCCESS) {
+		printf("Something went wrong during the program's life; result: %s\n",
+			mug_result_get_name(mug.result)
+		);
+	} else {
+		printf("Successful\n");
+	}
+
+	return 0;
+}
+
+/*
+For all source code:
+
+	------------------------------------------------------------------------------
+	This software is available under 2 licenses -- choose whichever you prefer.
+	------------------------------------------------------------------------------
+	ALTERNATIVE A - MIT License
+	Copyright (c) 2024 Hum
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+	of the Software, and to permit persons to whom the Software is furnished to do
+	so, subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+	------------------------------------------------------------------------------
+	ALTERNATIVE B - Public Domain (www.unlicense.org)
+	This is free and unencumbered software released into the public domain.
+	Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+	software, either in source code form or as a compiled binary, for any purpose,
+	commercial or non-commercial, and by any means.
+	In jurisdictions that recognize copyright laws, the author or authors of this
+	software dedicate any and all copyright interest in the software to the public
+	domain. We make this dedication for the benefit of the public at large and to
+	the detriment of our heirs and successors. We intend this dedication to be an
+	overt act of relinquishment in perpetuity of all present and future rights to
+	this software under copyright law.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+	ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+	WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+	------------------------------------------------------------------------------
+
+For Khronos specifications:
+	
+	Copyright (c) 2013-2020 The Khronos Group Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+
+*/
+
@@ -0,0 +1,293 @@
+/*
+============================================================
+                        DEMO INFO
+
+DEMO NAME:          stats.c
+DEMO WRITTEN BY:    Muukid
+CREATION DATE:      2026-10-18
+LAST UPDATED:       2026-10-18
+
+============================================================
+                        DEMO PURPOSE
+
+This demo shows how to retrieve the draw statistics of a graphic, which
+count the work done each frame (such as draw calls and bytes uploaded).
+
+============================================================
+                        LICENSE INFO
+
+This software is licensed under:
+(MIT license OR public domain) AND Apache 2.0.
+More explicit license information at the end of file.
+
+============================================================
+*/
+
+/* Inclusion */
+	
+	// Include mug
+	#define MU_SUPPORT_OPENGL // (For OpenGL support)
+	#define MUG_NAMES // (For mug name functions)
+	#define MUCOSA_NAMES // (For muCOSA name functions)
+	#define MUG_IMPLEMENTATION // (For source code)
+	#include "muGraphics.h"
+
+	// Include stdio for printing
+	#include <stdio.h>
+	// Include math for moving rects
+	#include <math.h>
+
+/* Variables */
+	
+	// Global context
+	mugContext mug;
+
+	// Graphic handle
+	muGraphic gfx;
+
+	// Graphic system
+	muGraphicSystem gfx_system = MU_GRAPHIC_OPENGL;
+
+	// The window system
+	muWindowSystem window_system = MU_WINDOW_NULL; // (Auto)
+
+	// Pixel format
+	muPixelFormat format = {
+		// RGBA bits
+		8, 8, 8, 8,
+		// Depth bits
+		24,
+		// Stencil bits
+		0,
+		// Samples
+		1
+	};
+
+	// Window information
+	muWindowInfo wininfo = {
+		// Title
+		(char*)"Window",
+		// Resolution (width & height)
+		800, 600,
+		// Min/Max resolution (none)
+		0, 0, 0, 0,
+		// Coordinates (x and y)
+		50, 50,
+		// Pixel format
+		&format,
+		// Callbacks (default)
+		0
+	};
+
+	// Window handle
+	muWindow win;
+
+	// Window keyboard map
+	muBool* keyboard;
+
+	// Amount of rects
+	#define RECT_COUNT 256
+
+	// Rects
+	mugRect rects[RECT_COUNT];
+
+	// Rect object buffer
+	mugObjects rectbuf;
+
+/* Functions */
+
+	// Prints a set of counters
+	void print_counters(const char* name, mugStatCounters* c) {
+		printf("%s: %lu draw calls, %lu objects, %lu vertexes\n", name,
+			(unsigned long)c->draw_calls, (unsigned long)c->objects, (unsigned long)c->vertexes
+		);
+		printf("\t%lu bytes uploaded, %lu index bytes, %lu mallocs (%lu bytes)\n",
+			(unsigned long)c->upload_bytes, (unsigned long)c->index_bytes,
+			(unsigned long)c->mallocs, (unsigned long)c->malloc_bytes
+		);
+		printf("\t%lu program binds, %lu VAO binds, %lu texture binds, %lu context binds, %lu shader compiles\n",
+			(unsigned long)c->program_binds, (unsigned long)c->vertex_array_binds,
+			(unsigned long)c->texture_binds, (unsigned long)c->context_binds,
+			(unsigned long)c->shader_compiles
+		);
+		printf("\tfill %.3fms, upload %.3fms, swap %.3fms, sleep %.3fms\n",
+			c->fill_time*1000.0, c->upload_time*1000.0, c->swap_time*1000.0, c->sleep_time*1000.0
+		);
+	}
+
+int main(void)
+{
+
+/* Initiation */
+
+	printf("Initiating...\n");
+
+	// Initiate mug
+	mug_context_create(&mug, window_system, MU_TRUE);
+
+	// Print currently running window system
+	printf("Running window system \"%s\"\n",
+		mu_window_system_get_nice_name(muCOSA_context_get_window_system(&mug.cosa))
+	);
+
+	// Create graphic via window using OpenGL
+	gfx = mu_graphic_create_window(gfx_system, &wininfo);
+
+	// Get window handle
+	win = mu_graphic_get_window(gfx);
+	// Get window keyboard map
+	mu_window_get(win, MU_WINDOW_KEYBOARD_MAP, &keyboard);
+
+	// Create rects
+	for (uint32_m i = 0; i < RECT_COUNT; ++i) {
+		rects[i].center.pos[2] = 0.f;
+		rects[i].center.col[0] = (float)((i * 53) % 256) / 255.f;
+		rects[i].center.col[1] = (float)((i * 97) % 256) / 255.f;
+		rects[i].center.col[2] = (float)((i * 193) % 256) / 255.f;
+		rects[i].center.col[3] = 1.f;
+		rects[i].dim[0] = rects[i].dim[1] = 20.f;
+		rects[i].rot = 0.f;
+	}
+	rectbuf = mu_gobjects_create(gfx, MUG_OBJECT_RECT, RECT_COUNT, rects);
+
+/* Print explanation */
+
+	printf("Window with moving colored rects should appear\n");
+	printf("Statistics of the last frame should be printed every second\n");
+	printf("Press escape to close window\n");
+
+/* Main loop */
+
+	// Time of last print
+	double last_print = mu_fixed_time_get();
+
+	// Run frame-by-frame while graphic exists:
+	while (mu_graphic_exists(gfx))
+	{
+		// Close if escape is pressed
+		if (keyboard[MU_KEYBOARD_ESCAPE]) {
+			mu_window_close(win);
+			continue;
+		}
+
+		// Move rects around in circles
+		double t = mu_fixed_time_get();
+		for (uint32_m i = 0; i < RECT_COUNT; ++i) {
+			float a = (float)t + (float)i * 0.1f;
+			rects[i].center.pos[0] = 400.f + cosf(a) * (float)(i + 20);
+			rects[i].center.pos[1] = 300.f + sinf(a) * (float)(i + 20);
+			rects[i].rot = a;
+		}
+		mu_gobjects_fill(gfx, rectbuf, rects);
+
+		// Clear the graphic with a slightly green-ish very dark grey
+		mu_graphic_clear(gfx, 15.f/255.f, 17.f/255.f, 15.f/255.f);
+
+		// Render rects
+		mu_gobjects_render(gfx, rectbuf);
+
+		// Swap graphic buffers (to present image)
+		mu_graphic_swap_buffers(gfx);
+
+		// Print statistics every second
+		if (t - last_print >= 1.0) {
+			last_print = t;
+			mugStats stats;
+			mu_graphic_get_stats(gfx, &stats);
+			printf("Frame %lu\n", (unsigned long)stats.frames);
+			print_counters("Last frame", &stats.last);
+		}
+
+		// Update graphic at ~100 FPS
+		mu_graphic_update(gfx, 100.f);
+	}
+
+/* Termination */
+
+	// Print cumulative statistics
+	mugStats stats;
+	mu_graphic_get_stats(gfx, &stats);
+	print_counters("Total", &stats.total);
+
+	// Destroy buffer
+	rectbuf = mu_gobjects_destroy(gfx, rectbuf);
+
+	// Destroy graphic (required)
+	gfx = mu_graphic_destroy(gfx);
+
+	// Terminate mug (required)
+	mug_context_destroy(&mug);
+
+	// Print possible error
+	if (mug.result != MUG_SUCCESS) {
+		printf("Something went wrong during the program's life; result: %s\n",
+			mug_result_get_name(mug.result)
+		);
+	} else {
+		printf("Successful\n");
+	}
+
+	return 0;
+}
+
+/*
+For all source code:
+
+	------------------------------------------------------------------------------
+	This software is available under 2 licenses -- choose whichever you prefer.
+	------------------------------------------------------------------------------
+	ALTERNATIVE A - MIT License
+	Copyright (c) 2024 Hum
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+	of the Software, and to permit persons to whom the Software is furnished to do
+	so, subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+	------------------------------------------------------------------------------
+	ALTERNATIVE B - Public Domain (www.unlicense.org)
+	This is free and unencumbered software released into the public domain.
+	Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+	software, either in source code form or as a compiled binary, for any purpose,
+	commercial or non-commercial, and by any means.
+	In jurisdictions that recognize copyright laws, the author or authors of this
+	software dedicate any and all copyright interest in the software to the public
+	domain. We make this dedication for the benefit of the public at large and to
+	the detriment of our heirs and successors. We intend this dedication to be an
+	overt act of relinquishment in perpetuity of all present and future rights to
+	this software under copyright law.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+	ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+	WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+	------------------------------------------------------------------------------
+
+For Khronos specifications:
+	
+	Copyright (c) 2013-2020 The Khronos Group Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+
+*/
+
@@ -120,7 +120,11 @@ More explicit license information at the end of file.
 		// Wrapping x and y (clamp)
 		{ MUG_TEXTURE_CLAMP, MUG_TEXTURE_CLAMP },
 		// Filtering up-/downscale (nearest)
-		{ MUG_TEXTURE_NEAREST, MUG_TEXTURE_NEAREST }
+		{ MUG_TEXTURE_NEAREST, MUG_TEXTURE_NEAREST },
+		// Mip levels (irrelevant)
+		0,
+		// Conversion (none)
+		0
 	};
 
 	// Texture handle
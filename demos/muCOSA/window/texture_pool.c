@@ -0,0 +1,321 @@
+/*
+============================================================
+                        DEMO INFO
+
+DEMO NAME:          texture_pool.c
+DEMO WRITTEN BY:    Muukid
+CREATION DATE:      2026-10-18
+LAST UPDATED:       2026-10-18
+
+============================================================
+                        DEMO PURPOSE
+
+This demo tests if texture pools work by adding 1200 distinct
+small sprites into a texture pool that starts with room for
+16, which makes it grow several times, then removing a third
+of them and adding new sprites in their place, which reuses
+the removed layers. All sprites are then rendered in a grid
+from one object buffer in a single draw call.
+
+If the user presses escape, the window will close.
+
+============================================================
+                        LICENSE INFO
+
+This software is licensed under:
+(MIT license OR public domain) AND Apache 2.0.
+More explicit license information at the end of file.
+
+============================================================
+*/
+
+/* Inclusion */
+	
+	// Include mug
+	#define MU_SUPPORT_OPENGL // (For OpenGL support)
+	#define MUG_NAMES // (For mug name functions)
+	#define MUCOSA_NAMES // (For muCOSA name functions)
+	#define MUG_IMPLEMENTATION // (For source code)
+	#include "muGraphics.h"
+
+	// Include stdio for printing
+	#include <stdio.h>
+
+/* Variables */
+	
+	// Global context
+	mugContext mug;
+
+	// Graphic handle
+	muGraphic gfx;
+
+	// Graphic system
+	muGraphicSystem gfx_system = MU_GRAPHIC_OPENGL;
+
+	// The window system
+	muWindowSystem window_system = MU_WINDOW_NULL; // (Auto)
+
+	// Pixel format
+	muPixelFormat format = {
+		// RGBA bits
+		8, 8, 8, 8,
+		// Depth bits
+		24,
+		// Stencil bits
+		0,
+		// Samples
+		1
+	};
+
+	// Window information
+	muWindowInfo wininfo = {
+		// Title
+		(char*)"Window",
+		// Resolution (width & height)
+		800, 600,
+		// Min/Max resolution (none)
+		0, 0, 0, 0,
+		// Coordinates (x and y)
+		50, 50,
+		// Pixel format
+		&format,
+		// Callbacks (default)
+		0
+	};
+
+	// Window handle
+	muWindow win;
+
+	// Window keyboard map
+	muBool* keyboard;
+
+/* Sprite logic */
+
+	// Sprite size and amount of sprites in grid
+	#define SPRITE_SIZE 16
+	#define GRID_WIDTH 40
+	#define GRID_HEIGHT 30
+	#define SPRITE_COUNT (GRID_WIDTH*GRID_HEIGHT)
+
+	// Pixels of one sprite
+	uint8_m pixels[SPRITE_SIZE*SPRITE_SIZE*4];
+
+	// Fills pixels with a sprite; a shape whose color and form depend on the index
+	void calc_sprite(uint32_m index) {
+		uint8_m r = (uint8_m)(index * 37), g = (uint8_m)(index * 91), b = (uint8_m)(index * 53 + 128);
+		for (int32_m y = 0; y < SPRITE_SIZE; ++y) {
+			for (int32_m x = 0; x < SPRITE_SIZE; ++x) {
+				int32_m dx = x*2 - (SPRITE_SIZE-1), dy = y*2 - (SPRITE_SIZE-1);
+				int32_m ax = (dx < 0) ? (-dx) : (dx), ay = (dy < 0) ? (-dy) : (dy);
+				muBool inside = MU_FALSE;
+				switch (index % 4) {
+					// Circle
+					case 0: inside = dx*dx + dy*dy < SPRITE_SIZE*SPRITE_SIZE; break;
+					// Square
+					case 1: inside = ax < SPRITE_SIZE-4 && ay < SPRITE_SIZE-4; break;
+					// Diamond
+					case 2: inside = ax + ay < SPRITE_SIZE; break;
+					// Cross
+					case 3: inside = ax < 5 || ay < 5; break;
+				}
+				uint8_m* p = &pixels[(y*SPRITE_SIZE + x)*4];
+				p[0] = r; p[1] = g; p[2] = b;
+				p[3] = (inside) ? (255) : (0);
+			}
+		}
+	}
+
+	// Texture info
+	mugTextureInfo texinfo = {
+		// Type (always a 2D array for pools)
+		MUG_TEXTURE_2D_ARRAY,
+		// Format (uint8_m RGBA)
+		MUG_TEXTURE_U8_RGBA,
+		// Wrapping x and y (clamp)
+		{ MUG_TEXTURE_CLAMP, MUG_TEXTURE_CLAMP },
+		// Filtering up-/downscale (nearest)
+		{ MUG_TEXTURE_NEAREST, MUG_TEXTURE_NEAREST },
+		// Mip levels (irrelevant)
+		0,
+		// Conversion (none)
+		0
+	};
+
+	// Sprite size, and initial room for 16 sprites
+	uint32_m dim[3] = { SPRITE_SIZE, SPRITE_SIZE, 16 };
+
+	// Texture pool handle
+	mugTexturePool pool;
+
+	// Sprite rects and their object buffer
+	mug2DTextureArrayRect rects[SPRITE_COUNT];
+	mugObjects buf;
+
+int main(void)
+{
+
+/* Initiation */
+
+	printf("Initiating...\n");
+
+	// Initiate mug
+	mug_context_create(&mug, window_system, MU_TRUE);
+
+	// Print currently running window system
+	printf("Running window system \"%s\"\n",
+		mu_window_system_get_nice_name(muCOSA_context_get_window_system(&mug.cosa))
+	);
+
+	// Create graphic via window using OpenGL
+	gfx = mu_graphic_create_window(gfx_system, &wininfo);
+
+	// Get window handle
+	win = mu_graphic_get_window(gfx);
+	// Get window keyboard map
+	mu_window_get(win, MU_WINDOW_KEYBOARD_MAP, &keyboard);
+
+	// Create texture pool
+	pool = mu_pool_create(gfx, &texinfo, dim);
+
+	// Add every sprite, laid out in a grid
+	for (uint32_m i = 0; i < SPRITE_COUNT; ++i) {
+		calc_sprite(i);
+		uint32_m layer = mu_pool_add(gfx, pool, 0, (muByte*)pixels);
+
+		mug2DTextureArrayRect rect = {
+			{ { 10.f + (float)(i%GRID_WIDTH)*20.f, 10.f + (float)(i/GRID_WIDTH)*20.f, 0.f }, { 1.f, 1.f, 1.f, 1.f } },
+			{ 16.f, 16.f }, 0.f, { 0.f, 0.f, (float)layer }, { 1.f, 1.f }
+		};
+		rects[i] = rect;
+	}
+
+	// Replace every third sprite with a new one (reusing the removed layers)
+	for (uint32_m i = 0; i < SPRITE_COUNT; i += 3) {
+		mu_pool_remove(gfx, pool, (uint32_m)rects[i].tex_pos[2]);
+	}
+	for (uint32_m i = 0; i < SPRITE_COUNT; i += 3) {
+		calc_sprite(i+1);
+		rects[i].tex_pos[2] = (float)mu_pool_add(gfx, pool, 0, (muByte*)pixels);
+	}
+
+	// Create buffer with pool's texture
+	buf = mu_gobjects_create(gfx, MUG_OBJECT_TEXTURE_2D_ARRAY, SPRITE_COUNT, rects);
+	mu_gobjects_texture(gfx, buf, mu_pool_texture(gfx, pool));
+
+/* Print explanation */
+
+	printf("Window with dark grey background should appear\n");
+	printf("A grid of colorful shapes should be visible\n");
+	printf("Every third shape should match the shape after it\n");
+	printf("Press escape to close window\n");
+
+/* Main loop */
+
+	// Run frame-by-frame while graphic exists:
+	while (mu_graphic_exists(gfx))
+	{
+		// Close if escape is pressed
+		if (keyboard[MU_KEYBOARD_ESCAPE]) {
+			mu_window_close(win);
+			continue;
+		}
+
+		// Clear the graphic with a slightly green-ish very dark grey
+		mu_graphic_clear(gfx, 15.f/255.f, 17.f/255.f, 15.f/255.f);
+
+		// Render every sprite in one call
+		mu_gobjects_render(gfx, buf);
+
+		// Swap graphic buffers (to present image)
+		mu_graphic_swap_buffers(gfx);
+		// Update graphic at ~100 FPS
+		mu_graphic_update(gfx, 100.f);
+	}
+
+/* Termination */
+
+	// Destroy buffer (required)
+	buf = mu_gobjects_destroy(gfx, buf);
+
+	// Destroy texture pool (required)
+	pool = mu_pool_destroy(gfx, pool);
+
+	// Destroy graphic (required)
+	gfx = mu_graphic_destroy(gfx);
+
+	// Terminate mug (required)
+	mug_context_destroy(&mug);
+
+	// Print possible error
+	if (mug.result != MUG_SUCCESS) {
+		printf("Something went wrong during the program's life; result: %s\n",
+			mug_result_get_name(mug.result)
+		);
+	} else {
+		printf("Successful\n");
+	}
+
+	return 0;
+}
+
+/*
+For all source code:
+
+	------------------------------------------------------------------------------
+	This software is available under 2 licenses -- choose whichever you prefer.
+	------------------------------------------------------------------------------
+	ALTERNATIVE A - MIT License
+	Copyright (c) 2024 Hum
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+	of the Software, and to permit persons to whom the Software is furnished to do
+	so, subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+	------------------------------------------------------------------------------
+	ALTERNATIVE B - Public Domain (www.unlicense.org)
+	This is free and unencumbered software released into the public domain.
+	Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+	software, either in source code form or as a compiled binary, for any purpose,
+	commercial or non-commercial, and by any means.
+	In jurisdictions that recognize copyright laws, the author or authors of this
+	software dedicate any and all copyright interest in the software to the public
+	domain. We make this dedication for the benefit of the public at large and to
+	the detriment of our heirs and successors. We intend this dedication to be an
+	overt act of relinquishment in perpetuity of all present and future rights to
+	this software under copyright law.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+	ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+	WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+	------------------------------------------------------------------------------
+
+For Khronos specifications:
+	
+	Copyright (c) 2013-2020 The Khronos Group Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+
+*/
+
@@ -0,0 +1,297 @@
+/*
+============================================================
+                        DEMO INFO
+
+DEMO NAME:          virtual_texture.c
+DEMO WRITTEN BY:    Muukid
+CREATION DATE:      2026-10-18
+LAST UPDATED:       2026-10-18
+
+============================================================
+                        DEMO PURPOSE
+
+This demo tests if virtual textures work by drawing a
+procedurally-generated image of 1048576 by 1048576 pixels,
+far too large to fit in a single texture, and continually
+zooming in and out of it. Tiles are generated as they
+become visible, with blurrier lower levels of detail being
+shown briefly while sharper tiles stream in.
+
+If the user presses escape, the window will close.
+
+============================================================
+                        LICENSE INFO
+
+This software is licensed under:
+(MIT license OR public domain) AND Apache 2.0.
+More explicit license information at the end of file.
+
+============================================================
+*/
+
+/* Inclusion */
+	
+	// Include mug
+	#define MU_SUPPORT_OPENGL // (For OpenGL support)
+	#define MUG_NAMES // (For mug name functions)
+	#define MUCOSA_NAMES // (For muCOSA name functions)
+	#define MUG_IMPLEMENTATION // (For source code)
+	#include "muGraphics.h"
+
+	// Include stdio for printing
+	#include <stdio.h>
+
+/* Variables */
+	
+	// Global context
+	mugContext mug;
+
+	// Graphic handle
+	muGraphic gfx;
+
+	// Graphic system
+	muGraphicSystem gfx_system = MU_GRAPHIC_OPENGL;
+
+	// The window system
+	muWindowSystem window_system = MU_WINDOW_NULL; // (Auto)
+
+	// Pixel format
+	muPixelFormat format = {
+		// RGBA bits
+		8, 8, 8, 8,
+		// Depth bits
+		24,
+		// Stencil bits
+		0,
+		// Samples
+		1
+	};
+
+	// Window information
+	muWindowInfo wininfo = {
+		// Title
+		(char*)"Window",
+		// Resolution (width & height)
+		800, 600,
+		// Min/Max resolution (none)
+		0, 0, 0, 0,
+		// Coordinates (x and y)
+		50, 50,
+		// Pixel format
+		&format,
+		// Callbacks (default)
+		0
+	};
+
+	// Window handle
+	muWindow win;
+
+	// Window keyboard map
+	muBool* keyboard;
+
+/* Virtual texture logic */
+
+	// Size of image and tiles
+	#define IMAGE_SIZE 1048576
+	#define TILE_SIZE 256
+
+	// Amount of tiles generated
+	uint32_m tiles_loaded = 0;
+
+	// Tile loader; generates the pixels of a tile
+	muBool load_tile(void* user, uint32_m level, uint32_m x, uint32_m y, uint32_m w, uint32_m h, muByte* pixels) {
+		for (uint32_m py = 0; py < h; ++py) {
+			for (uint32_m px = 0; px < w; ++px) {
+				// Position of pixel in full-size image
+				uint32_m fx = ((x*TILE_SIZE)+px) << level;
+				uint32_m fy = ((y*TILE_SIZE)+py) << level;
+
+				muByte* p = &pixels[(py*TILE_SIZE + px) * 4];
+				p[0] = (muByte)((fx ^ fy) >> 8);
+				p[1] = (muByte)(fx >> 12);
+				p[2] = (muByte)(fy >> 12);
+				p[3] = 255;
+			}
+		}
+
+		++tiles_loaded;
+		return MU_TRUE;
+		// To avoid unused parameter warnings
+		if (user) {}
+	}
+
+	// Virtual texture info
+	mugVirtualTextureInfo vtexinfo = {
+		// Format (uint8_m RGBA)
+		MUG_TEXTURE_U8_RGBA,
+		// Filtering up-/downscale (bilinear)
+		{ MUG_TEXTURE_BILINEAR, MUG_TEXTURE_BILINEAR },
+		// Image dimensions
+		{ IMAGE_SIZE, IMAGE_SIZE },
+		// Tile size
+		TILE_SIZE,
+		// Tiles in page cache (enough for 800x600)
+		96,
+		// Tiles uploaded per frame (default)
+		0,
+		// Tile loader and user pointer
+		load_tile, 0
+	};
+
+	// Virtual texture handle
+	mugVirtualTexture vtex;
+
+int main(void)
+{
+
+/* Initiation */
+
+	printf("Initiating...\n");
+
+	// Initiate mug
+	mug_context_create(&mug, window_system, MU_TRUE);
+
+	// Print currently running window system
+	printf("Running window system \"%s\"\n",
+		mu_window_system_get_nice_name(muCOSA_context_get_window_system(&mug.cosa))
+	);
+
+	// Create graphic via window using OpenGL
+	gfx = mu_graphic_create_window(gfx_system, &wininfo);
+
+	// Get window handle
+	win = mu_graphic_get_window(gfx);
+	// Get window keyboard map
+	mu_window_get(win, MU_WINDOW_KEYBOARD_MAP, &keyboard);
+
+	// Create virtual texture
+	vtex = mu_vtexture_create(gfx, &vtexinfo);
+
+/* Print explanation */
+
+	printf("Window with dark grey background should appear\n");
+	printf("A colorful pattern should be continually zoomed in and out of\n");
+	printf("Press escape to close window\n");
+
+/* Main loop */
+
+	// Zoom (width of image on screen divided by width of window) and zoom speed
+	float zoom = 1.f;
+	float zoom_speed = 1.02f;
+
+	// Run frame-by-frame while graphic exists:
+	while (mu_graphic_exists(gfx))
+	{
+		// Close if escape is pressed
+		if (keyboard[MU_KEYBOARD_ESCAPE]) {
+			mu_window_close(win);
+			continue;
+		}
+
+		// Zoom in towards a point, turning around every so often
+		zoom *= zoom_speed;
+		if (zoom > 8192.f || zoom < 1.f) {
+			zoom_speed = 1.f / zoom_speed;
+		}
+		float rect[4] = { 0.f, 0.f, 800.f*zoom, 800.f*zoom };
+		rect[0] = 400.f - rect[2]*0.3f;
+		rect[1] = 300.f - rect[3]*0.6f;
+
+		// Clear the graphic with a slightly green-ish very dark grey
+		mu_graphic_clear(gfx, 15.f/255.f, 17.f/255.f, 15.f/255.f);
+
+		// Draw virtual texture
+		mu_vtexture_draw(gfx, vtex, rect);
+
+		// Swap graphic buffers (to present image)
+		mu_graphic_swap_buffers(gfx);
+		// Update graphic at ~60 FPS
+		mu_graphic_update(gfx, 60.f);
+	}
+
+/* Termination */
+
+	printf("Generated %u tiles\n", (unsigned)tiles_loaded);
+
+	// Destroy virtual texture (required)
+	vtex = mu_vtexture_destroy(gfx, vtex);
+
+	// Destroy graphic (required)
+	gfx = mu_graphic_destroy(gfx);
+
+	// Terminate mug (required)
+	mug_context_destroy(&mug);
+
+	// Print possible error
+	if (mug.result != MUG_SUCCESS) {
+		printf("Something went wrong during the program's life; result: %s\n",
+			mug_result_get_name(mug.result)
+		);
+	} else {
+		printf("Successful\n");
+	}
+
+	return 0;
+}
+
+/*
+For all source code:
+
+	------------------------------------------------------------------------------
+	This software is available under 2 licenses -- choose whichever you prefer.
+	------------------------------------------------------------------------------
+	ALTERNATIVE A - MIT License
+	Copyright (c) 2024 Hum
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+	of the Software, and to permit persons to whom the Software is furnished to do
+	so, subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+	------------------------------------------------------------------------------
+	ALTERNATIVE B - Public Domain (www.unlicense.org)
+	This is free and unencumbered software released into the public domain.
+	Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+	software, either in source code form or as a compiled binary, for any purpose,
+	commercial or non-commercial, and by any means.
+	In jurisdictions that recognize copyright laws, the author or authors of this
+	software dedicate any and all copyright interest in the software to the public
+	domain. We make this dedication for the benefit of the public at large and to
+	the detriment of our heirs and successors. We intend this dedication to be an
+	overt act of relinquishment in perpetuity of all present and future rights to
+	this software under copyright law.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+	ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+	WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+	------------------------------------------------------------------------------
+
+For Khronos specifications:
+	
+	Copyright (c) 2013-2020 The Khronos Group Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+
+*/
+
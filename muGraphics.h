@@ -90,7 +90,7 @@ This all means that mug is set up to create and render exclusively 2D objects. T
 
 Modern graphics APIs are designed to make rendering multiple textures in one shader very difficult and generally discouraged as an option. For example, OpenGL 3.3 doesn't support choosing a sampler based on given vertex data, meaning that you would need to make the jump to OpenGL 4.0+ to get that feature. And, even then, the limits on how many samplers can be stored in a shader (especially in regards to whether or not you're storing them as an array or as separate variables, which, yes, does affect the amount the shader can hold) are not queryable as values (at least as far as I'm aware), making "the amount of sampler2Ds you can hold in a shader" a very hard-to-figure-out amount that needs to be handled at runtime, and can be very small on certain devices, making the handling of texture buffers device-dependent, which makes coding them on the user-side hell, and makes the act of going through the effort very questionable, especially on those lower-end devices; all of this, and you're now having to use a later version of OpenGL, which can harm compatibility.
 
-For all these complications, mug only allows one texture to be used per texture buffer, which forces the user to get creative with how they handle the rendering of multiple textures. It's an unfortunate conundrum, but manufacturers are gonna do what they're gonna do.
+For all these complications, mug only allows one texture to be used per texture buffer, which forces the user to get creative with how they handle the rendering of multiple textures. It's an unfortunate conundrum, but manufacturers are gonna do what they're gonna do. To make this easier, mug provides [atlases](#atlas), which pack many images into one texture so that they can all be rendered from one texture buffer.
 
 ## Create graphic with pre-existing window
 
@@ -2098,6 +2098,130 @@ It is likely that [object type modifiers](#object-type-modifiers) would work bet
 		#define MUG_VERSION_MINOR 0
 		#define MUG_VERSION_PATCH 1
 
+	// @DOCLINE # Allocation
+
+		// @DOCLINE The memory that mug allocates (including the memory allocated by its bundled muCOSA implementation) is allocated via an ***allocator***, which belongs to the [mug context](#mug-context). By default, the allocator uses `mu_malloc`, `mu_realloc`, and `mu_free`.
+
+		// @DOCLINE ## Allocation categories
+
+			typedef uint8_m mugAllocCategory;
+
+			// @DOCLINE Each allocation belongs to a ***category***, represented by the type `mugAllocCategory` (typedef for `uint8_m`), which has the following defined values:
+
+			// @DOCLINE * `MUG_ALLOC_GENERAL` - memory not belonging to any of the categories below, such as graphics, scenes, and atlases.
+			#define MUG_ALLOC_GENERAL 0
+			// @DOCLINE * `MUG_ALLOC_WINDOW` - memory allocated by muCOSA, such as for windows and OpenGL contexts.
+			#define MUG_ALLOC_WINDOW 1
+			// @DOCLINE * `MUG_ALLOC_OBJECT_BUFFER` - object buffers themselves, which are all of the same size.
+			#define MUG_ALLOC_OBJECT_BUFFER 2
+			// @DOCLINE * `MUG_ALLOC_VERTEXES` - vertex data and bounds of objects kept by object buffers.
+			#define MUG_ALLOC_VERTEXES 3
+			// @DOCLINE * `MUG_ALLOC_SPATIAL_INDEX` - [spatial indexes](#spatial-index) of object buffers.
+			#define MUG_ALLOC_SPATIAL_INDEX 4
+			// @DOCLINE * `MUG_ALLOC_TEXTURE` - textures themselves, which are all of the same size.
+			#define MUG_ALLOC_TEXTURE 5
+			// @DOCLINE * `MUG_ALLOC_FRAME` - the memory that a graphic uses for [immediate drawing](#immediate-drawing) and other work within a frame, which is reused every frame and grows as needed.
+			#define MUG_ALLOC_FRAME 6
+			// @DOCLINE * `MUG_ALLOC_SCRATCH` - temporary memory, which is freed before the function that allocated it returns, such as vertex and pixel data being sent to the GPU.
+			#define MUG_ALLOC_SCRATCH 7
+
+			// @DOCLINE The amount of categories is defined as `MUG_ALLOC_CATEGORY_COUNT`.
+			#define MUG_ALLOC_CATEGORY_COUNT 8
+
+		// @DOCLINE ## Allocator
+
+			// @DOCLINE An allocator is represented by the struct `mugAllocator`, which has the following members:
+
+			struct mugAllocator {
+				// @DOCLINE * `@NLFT alloc` - allocates `size` bytes, returning 0 on failure.
+				void* (*alloc)(void* user, size_m size, mugAllocCategory category);
+				// @DOCLINE * `@NLFT realloc` - resizes the allocation `ptr` (which may be 0) to `size` bytes, returning 0 on failure (in which case `ptr` is left allocated).
+				void* (*realloc)(void* user, void* ptr, size_m size, mugAllocCategory category);
+				// @DOCLINE * `@NLFT free` - frees the allocation `ptr`, which is never 0.
+				void (*free)(void* user, void* ptr, mugAllocCategory category);
+				// @DOCLINE * `@NLFT user` - the pointer passed as `user` to each function.
+				void* user;
+			};
+			typedef struct mugAllocator mugAllocator;
+
+			// @DOCLINE Memory is always freed and reallocated with the same category that it was allocated with. The allocator is only called from the thread that the context is used on. The exceptions to allocating via the allocator are image pixels (which are allocated with `mu_malloc` as documented for [image decoders](#image-decoders)), the memory of [asynchronous loading](#asynchronous-loading) (which is shared with its worker threads), and clipboard text handed to the user by muCOSA, all of which use `mu_malloc` directly.
+
+			// @DOCLINE The allocator used by default can be retrieved via the function `mug_default_allocator`, defined below: @NLNT
+			MUDEF mugAllocator mug_default_allocator(void);
+
+		// @DOCLINE ## Allocation counts
+
+			// @DOCLINE The allocations made in each category are counted by the struct `mugAllocCounts`, which has the following members:
+
+			struct mugAllocCounts {
+				// @DOCLINE * `@NLFT allocs` - the amount of allocations made.
+				uint64_m allocs;
+				// @DOCLINE * `@NLFT reallocs` - the amount of reallocations made.
+				uint64_m reallocs;
+				// @DOCLINE * `@NLFT frees` - the amount of frees made.
+				uint64_m frees;
+				// @DOCLINE * `@NLFT bytes` - the amount of bytes requested by every allocation and reallocation.
+				uint64_m bytes;
+			};
+			typedef struct mugAllocCounts mugAllocCounts;
+
+			// @DOCLINE The counts of a context are kept in its member `alloc_counts`, indexed by category.
+
+		// @DOCLINE ## Block pool allocator
+
+			// @DOCLINE A ***block pool allocator*** allocates memory of one category from blocks of one size, which are allocated in chunks and reused upon being freed, avoiding allocating each one separately. This is meant for categories whose allocations are all of the same size, such as `MUG_ALLOC_OBJECT_BUFFER` and `MUG_ALLOC_TEXTURE`. It is represented by the struct `mugBlockPool`, which has the following members:
+
+			struct mugBlockPool {
+				// @DOCLINE * `@NLFT parent` - the allocator used for other categories, for allocations larger than a block, and for the chunks themselves.
+				mugAllocator parent;
+				// @DOCLINE * `@NLFT category` - the category allocated from blocks.
+				mugAllocCategory category;
+				// @DOCLINE * `@NLFT block_size` - the size of each block, in bytes; if 0, it's set to the size of the first allocation of the category.
+				size_m block_size;
+				// @DOCLINE * `@NLFT chunk_blocks` - the amount of blocks allocated per chunk.
+				uint32_m chunk_blocks;
+				// @DOCLINE * `@NLFT used` - the amount of blocks currently allocated.
+				uint32_m used;
+				// @DOCLINE * `@NLFT free_list` - blocks available to allocate (internal).
+				void* free_list;
+				// @DOCLINE * `@NLFT chunks` - chunks allocated so far (internal).
+				void* chunks;
+			};
+			typedef struct mugBlockPool mugBlockPool;
+
+			// @DOCLINE A block pool allocator is created via the function `mug_block_pool_allocator`, defined below: @NLNT
+			MUDEF mugAllocator mug_block_pool_allocator(mugBlockPool* pool, mugAllocator parent, mugAllocCategory category, uint32_m chunk_blocks);
+
+			// @DOCLINE `pool` is initialized and must stay valid for as long as the returned allocator is used. A `chunk_blocks` value of 0 uses 16 blocks per chunk. Once nothing allocated from the pool is in use (such as after destroying the context using it), its chunks are freed via the function `mug_block_pool_free`, defined below: @NLNT
+			MUDEF void mug_block_pool_free(mugBlockPool* pool);
+
+		// @DOCLINE ## Frame arena allocator
+
+			// @DOCLINE A ***frame arena allocator*** allocates memory of the given categories by incrementing an offset into one block of memory, which makes allocating nearly free. Freeing the latest allocation gives its memory back; other memory is only given back upon the arena being reset, which is usually done once per frame. This is meant for `MUG_ALLOC_SCRATCH`, whose allocations are freed in reverse order of being allocated. Allocations that don't fit are made via the parent allocator instead. It is represented by the struct `mugFrameArena`, which has the following members:
+
+			struct mugFrameArena {
+				// @DOCLINE * `@NLFT parent` - the allocator used for other categories, for allocations that don't fit, and for the arena's memory.
+				mugAllocator parent;
+				// @DOCLINE * `@NLFT categories` - a bitmask of the categories allocated on the arena (`1 << category`).
+				uint32_m categories;
+				// @DOCLINE * `@NLFT data` - the arena's memory, allocated once first used.
+				muByte* data;
+				// @DOCLINE * `@NLFT cap` - the size of the arena's memory, in bytes.
+				size_m cap;
+				// @DOCLINE * `@NLFT len` - the amount of bytes of the arena's memory in use.
+				size_m len;
+			};
+			typedef struct mugFrameArena mugFrameArena;
+
+			// @DOCLINE A frame arena allocator is created via the function `mug_frame_arena_allocator`, defined below: @NLNT
+			MUDEF mugAllocator mug_frame_arena_allocator(mugFrameArena* arena, mugAllocator parent, uint32_m categories, size_m cap);
+
+			// @DOCLINE `arena` is initialized and must stay valid for as long as the returned allocator is used. Every allocation on the arena is given up upon resetting it via the function `mug_frame_arena_reset`, defined below: @NLNT
+			MUDEF void mug_frame_arena_reset(mugFrameArena* arena);
+
+			// @DOCLINE An arena must only be reset when nothing allocated on it is in use. Its memory is freed via the function `mug_frame_arena_free`, defined below: @NLNT
+			MUDEF void mug_frame_arena_free(mugFrameArena* arena);
+
 	// @DOCLINE # mug context
 
 		// @DOCLINE mug operates in a context, encapsulated by the type `mugContext`, which has the following members:
@@ -2107,6 +2231,10 @@ It is likely that [object type modifiers](#object-type-modifiers) would work bet
 			mugResult result;
 			// @DOCLINE * `@NLFT cosa` - the muCOSA context used by the mug context.
 			muCOSAContext cosa;
+			// @DOCLINE * `@NLFT allocator` - the [allocator](#allocator) used by the context.
+			mugAllocator allocator;
+			// @DOCLINE * `@NLFT alloc_counts` - the [allocation counts](#allocation-counts) of the context, indexed by category.
+			mugAllocCounts alloc_counts[MUG_ALLOC_CATEGORY_COUNT];
 		};
 		typedef struct mugContext mugContext;
 
@@ -2117,6 +2245,11 @@ It is likely that [object type modifiers](#object-type-modifiers) would work bet
 
 			// @DOCLINE The result of this function is stored within `context->result`. Upon success, this function automatically calls `mug_context_set` on the created context, as well as `muCOSA_context_set` on the created muCOSA context, unless `set_context` is equal to `MU_FALSE`.
 
+			// @DOCLINE A context that allocates via a given [allocator](#allocator) is created via the function `mug_context_create_with_allocator`, defined below: @NLNT
+			MUDEF void mug_context_create_with_allocator(mugContext* context, muWindowSystem system, muBool set_context, mugAllocator* allocator);
+
+			// @DOCLINE If `allocator` is 0, the default allocator is used, which is what `mug_context_create` does. Memory is allocated via the allocator of the context created most recently, so, as with the OpenGL functions loaded by mug, no more than one context should exist at a time.
+
 			// @DOCLINE > It is valid for `system` to be `MU_WINDOW_NULL` for this function, in which case, the best currently available window system will be automatically chosen by muCOSA. More information about the window system is available via muCOSA's documentation.
 
 			// @DOCLINE For every successfully created context, it must be destroyed, which is done with the function `mug_context_destroy`, defined below: @NLNT
@@ -2271,12 +2404,330 @@ It is likely that [object type modifiers](#object-type-modifiers) would work bet
 				// @DOCLINE Once the graphic has been presented, before the next frame potentially starts, the graphic's state needs to be internally updated; this is performed with the function `mug_graphic_update`, defined below: @NLNT
 				MUDEF void mug_graphic_update(mugContext* context, mugResult* result, muGraphic gfx, float target_fps);
 
-				// @DOCLINE The parameter `target_fps` specifies the desired amount of frames that the user wants to be processed each second, given as a rate of frames per second. `mug_graphic_update` accomplishes this by sleeping for the time required to reach this desired FPS, keeping track internally of the approximate time it has taken for each frame to be processed. This does mean that no compensation is performed if the approximate time is at or above the time needed to reach the desired FPS rate. This functionality is not performed if `target_fps` is less than or equal to `0.f`.
+				// @DOCLINE The parameter `target_fps` specifies the desired amount of frames that the user wants to be processed each second, given as a rate of frames per second. `mug_graphic_update` accomplishes this by waiting until the time that the next frame is scheduled to start, with each frame being scheduled exactly `1 / target_fps` seconds after the previous one was scheduled (rather than after it finished), so that the time spent waiting and processing never accumulates into drift. The wait sleeps for as long as it safely can, measuring how long the operating system actually takes to sleep, and then spins for the rest of the time, so frames start within a fraction of a millisecond of when they're scheduled at the cost of some CPU time. What happens when a frame takes longer than scheduled is specified by the graphic's [frame policy](#frame-policy). This functionality is not performed if `target_fps` is less than or equal to `0.f`, or if the graphic's [present mode](#present-mode) already paces frames to the display.
 
 				// @DOCLINE > The macro `mu_graphic_update` is the non-result-checking equivalent, and the macro `mu_graphic_update_` is the result-checking equivalent.
 				#define mu_graphic_update(...) mug_graphic_update(mug_global_context, &mug_global_context->result, __VA_ARGS__)
 				#define mu_graphic_update_(result, ...) mug_graphic_update(mug_global_context, result, __VA_ARGS__)
 
+			// @DOCLINE ### Frame policy
+
+				typedef uint8_m mugFramePolicy;
+
+				// @DOCLINE What `mug_graphic_update` does when a frame finishes after the next frame was scheduled to start is specified by the type `mugFramePolicy` (typedef for `uint8_m`), which has the following defined values:
+
+				// @DOCLINE * `MUG_FRAME_DROP` - the schedule restarts from the late frame, with the next frame starting immediately. Time that was missed is skipped, and every whole frame's worth of time that was missed is counted as a dropped frame. This keeps the time between frames as even as possible, and is the default policy.
+				#define MUG_FRAME_DROP 0
+
+				// @DOCLINE * `MUG_FRAME_CATCH_UP` - the schedule is kept, with frames being started without waiting until they're back on schedule. This keeps the average frame rate at `target_fps`, which is useful for programs that advance by a fixed amount of time each frame. If the frames fall behind by more than `MUG_FRAME_CATCH_UP_MAX` frames (4 by default, overridable by defining it before including the implementation), the schedule restarts as it does for `MUG_FRAME_DROP`, and the frames that weren't caught up are counted as dropped.
+				#define MUG_FRAME_CATCH_UP 1
+				#ifndef MUG_FRAME_CATCH_UP_MAX
+					#define MUG_FRAME_CATCH_UP_MAX 4
+				#endif
+
+				// @DOCLINE The frame policy of a graphic is set via the function `mug_graphic_frame_policy`, defined below: @NLNT
+				MUDEF void mug_graphic_frame_policy(mugContext* context, muGraphic gfx, mugFramePolicy policy);
+
+				// @DOCLINE > The macro `mu_graphic_frame_policy` is the non-result-checking equivalent.
+				#define mu_graphic_frame_policy(...) mug_graphic_frame_policy(mug_global_context, __VA_ARGS__)
+
+			// @DOCLINE ### Frame statistics
+
+				// @DOCLINE Statistics about the time between a graphic's frames are represented by the struct `mugFrameStats`, which has the following members:
+
+				struct mugFrameStats {
+					// @DOCLINE * `@NLFT last` - the time between the start of the two most recent frames, in seconds.
+					double last;
+					// @DOCLINE * `@NLFT average` - the average time between frames over the recorded frames, in seconds.
+					double average;
+					// @DOCLINE * `@NLFT jitter[3]` - the 50th (`jitter[0]`), 95th (`jitter[1]`), and 99th (`jitter[2]`) percentiles of the jitter of the recorded frames, in seconds. The jitter of a frame is how far the time between it and the previous frame was from `1 / target_fps` seconds, or from `average` if `target_fps` was less than or equal to `0.f`.
+					double jitter[3];
+					// @DOCLINE * `@NLFT frames` - the amount of recorded frames.
+					uint32_m frames;
+					// @DOCLINE * `@NLFT dropped` - the amount of frames dropped by the [frame policy](#frame-policy) since the graphic was created.
+					uint32_m dropped;
+					// @DOCLINE * `@NLFT gpu_wait_last` - the time that the CPU spent waiting on the GPU during the most recent frame because of the graphic's [frames in flight](#frames-in-flight) limit, in seconds.
+					double gpu_wait_last;
+					// @DOCLINE * `@NLFT gpu_wait_average` - the average of `gpu_wait_last` over the recorded frames, in seconds.
+					double gpu_wait_average;
+				};
+				typedef struct mugFrameStats mugFrameStats;
+
+				// @DOCLINE The frame statistics of a graphic are retrieved into `stats` via the function `mug_graphic_frame_stats`, defined below: @NLNT
+				MUDEF void mug_graphic_frame_stats(mugContext* context, muGraphic gfx, mugFrameStats* stats);
+
+				// @DOCLINE Frames are recorded by `mug_graphic_update`, and the most recent `MUG_FRAME_STATS_FRAMES` frames (128 by default, overridable by defining it before including the implementation) are recorded.
+				#ifndef MUG_FRAME_STATS_FRAMES
+					#define MUG_FRAME_STATS_FRAMES 128
+				#endif
+
+				// @DOCLINE > The macro `mu_graphic_frame_stats` is the non-result-checking equivalent.
+				#define mu_graphic_frame_stats(...) mug_graphic_frame_stats(mug_global_context, __VA_ARGS__)
+
+			// @DOCLINE ### Present mode
+
+				typedef uint8_m mugPresentMode;
+
+				// @DOCLINE How a graphic's frames are presented to the screen relative to the display's refresh is specified by the type `mugPresentMode` (typedef for `uint8_m`), which has the following defined values:
+
+				// @DOCLINE * `MUG_PRESENT_IMMEDIATE` - frames are presented as soon as they're swapped, without waiting for the display to refresh. This has the lowest latency, but can visibly tear. `mug_graphic_update` paces frames to `target_fps` itself.
+				#define MUG_PRESENT_IMMEDIATE 0
+
+				// @DOCLINE * `MUG_PRESENT_VSYNC` - frames are presented when the display refreshes (vertical sync), so they never tear, and swapping waits for the display when frames are ready faster than it refreshes.
+				#define MUG_PRESENT_VSYNC 1
+
+				// @DOCLINE * `MUG_PRESENT_ADAPTIVE` - the same as `MUG_PRESENT_VSYNC`, except that a frame that misses a refresh is presented immediately rather than waiting for the next one, tearing briefly instead of stuttering (late-swap tearing). If the device doesn't support this, `MUG_PRESENT_VSYNC` is used instead.
+				#define MUG_PRESENT_ADAPTIVE 2
+
+				// @DOCLINE With `MUG_PRESENT_VSYNC` and `MUG_PRESENT_ADAPTIVE`, the display already paces frames, so `mug_graphic_update` doesn't wait, which avoids throttling each frame twice and the latency that it adds; `target_fps` is then only used as the target of the [frame statistics](#frame-statistics), and should be the display's refresh rate (or `0.f`).
+
+				// @DOCLINE The present mode of a graphic is set via the function `mug_graphic_set_present_mode`, defined below: @NLNT
+				MUDEF void mug_graphic_set_present_mode(mugContext* context, mugResult* result, muGraphic gfx, mugPresentMode mode);
+
+				// @DOCLINE If the device doesn't support setting how frames are presented, the result is set to `MUG_UNSUPPORTED_PRESENT_MODE`, and the present mode is left unchanged. Until a present mode is set, frames are presented however the device presents them by default, and `mug_graphic_update` paces frames itself as it does for `MUG_PRESENT_IMMEDIATE`.
+
+				// @DOCLINE > The macro `mu_graphic_set_present_mode` is the non-result-checking equivalent, and the macro `mu_graphic_set_present_mode_` is the result-checking equivalent.
+				#define mu_graphic_set_present_mode(...) mug_graphic_set_present_mode(mug_global_context, &mug_global_context->result, __VA_ARGS__)
+				#define mu_graphic_set_present_mode_(result, ...) mug_graphic_set_present_mode(mug_global_context, result, __VA_ARGS__)
+
+				// @DOCLINE The present mode in effect for a graphic (which differs from the one set if `MUG_PRESENT_ADAPTIVE` isn't supported) can be retrieved via the function `mug_graphic_get_present_mode`, defined below: @NLNT
+				MUDEF mugPresentMode mug_graphic_get_present_mode(mugContext* context, muGraphic gfx);
+
+				// @DOCLINE > The macro `mu_graphic_get_present_mode` is the non-result-checking equivalent.
+				#define mu_graphic_get_present_mode(...) mug_graphic_get_present_mode(mug_global_context, __VA_ARGS__)
+
+			// @DOCLINE ### Frames in flight
+
+				// @DOCLINE Swapping a graphic's buffers only queues the frame's rendering commands; the GPU executes them later, while the CPU moves on to the next frame. The amount of frames that the CPU is allowed to get ahead of the GPU, called the amount of ***frames in flight***, is bounded: a fence is placed after each swap, and before the CPU starts a frame that would exceed the limit, it waits until the GPU has finished the oldest frame in flight. A lower limit lowers input latency, and a higher limit lets the CPU and GPU overlap more of their work.
+
+				// @DOCLINE The time spent waiting is reported by `gpu_wait_last` and `gpu_wait_average` in the [frame statistics](#frame-statistics). If frames consistently spend a significant part of their time waiting on the GPU, the graphic is GPU-bound; if they barely wait at all while still missing `target_fps`, the graphic is CPU-bound.
+
+				// @DOCLINE The maximum amount of frames in flight for a graphic is set via the function `mug_graphic_frames_in_flight`, defined below: @NLNT
+				MUDEF void mug_graphic_frames_in_flight(mugContext* context, muGraphic gfx, uint32_m frames);
+
+				// @DOCLINE `frames` is clamped to `MUG_MAX_FRAMES_IN_FLIGHT` (8 by default, overridable by defining it before including the implementation), and `0` leaves the amount of frames in flight unbounded (up to whatever the device allows). Graphics start with a limit of `MUG_FRAMES_IN_FLIGHT` (2 by default, overridable by defining it before including the implementation).
+				#ifndef MUG_MAX_FRAMES_IN_FLIGHT
+					#define MUG_MAX_FRAMES_IN_FLIGHT 8
+				#endif
+				#ifndef MUG_FRAMES_IN_FLIGHT
+					#define MUG_FRAMES_IN_FLIGHT 2
+				#endif
+
+				// @DOCLINE > The macro `mu_graphic_frames_in_flight` is the non-result-checking equivalent.
+				#define mu_graphic_frames_in_flight(...) mug_graphic_frames_in_flight(mug_global_context, __VA_ARGS__)
+
+			// @DOCLINE ### Idle mode
+
+				// @DOCLINE Programs whose contents only change occasionally (such as in response to input) don't need to render identical frames at `target_fps`. To avoid this, a graphic tracks whether or not anything that it presents has changed since its buffers were last swapped, which can be retrieved via the function `mug_graphic_needs_redraw`, defined below: @NLNT
+				MUDEF muBool mug_graphic_needs_redraw(mugContext* context, muGraphic gfx);
+
+				// @DOCLINE A graphic needs to be redrawn upon being created, upon its size changing, upon an object buffer being created, filled, subfilled, resized, retextured, or destroyed, upon an object type's modifiers being changed, upon a scene being changed, and upon a texture being created, updated, resized, destroyed, or finishing [loading asynchronously](#asynchronous-texture-loading). Swapping the graphic's buffers marks it as no longer needing to be redrawn. Immediately drawn objects aren't tracked, as they only exist in the frame that they're drawn in.
+
+				// @DOCLINE > The macro `mu_graphic_needs_redraw` is the non-result-checking equivalent.
+				#define mu_graphic_needs_redraw(...) mug_graphic_needs_redraw(mug_global_context, __VA_ARGS__)
+
+				// @DOCLINE When the graphic doesn't need to be redrawn, `mug_graphic_update_wait` can be called in place of `mug_graphic_update`, which, rather than waiting until the next frame is scheduled, blocks until the graphic's window receives an event (such as input), the graphic is woken from another thread, or `timeout` seconds pass (with a negative `timeout` waiting indefinitely), and then updates the graphic, defined below: @NLNT
+				MUDEF void mug_graphic_update_wait(mugContext* context, mugResult* result, muGraphic gfx, double timeout);
+
+				// @DOCLINE If the graphic already needs to be redrawn, or asynchronously loaded textures are waiting to be transferred (which `mug_graphic_update_wait` transfers as `mug_graphic_swap_buffers` would), it doesn't block. Waiting on window events is only possible with Win32; with other window systems, only wakeups and the timeout end the wait. Frames ended by `mug_graphic_update_wait` aren't recorded in the [frame statistics](#frame-statistics), and the frame schedule restarts afterwards. A main loop that idles while nothing changes generally looks like this:
+
+				/* @DOCBEGIN
+				```c
+				while (mu_graphic_exists(gfx)) {
+					// (Handle input, possibly changing buffers, textures, etc.)
+
+					if (mu_graphic_needs_redraw(gfx)) {
+						mu_graphic_clear(gfx, 0.f, 0.f, 0.f);
+						// (Render)
+						mu_graphic_swap_buffers(gfx);
+					}
+					mu_graphic_update_wait(gfx, -1.0);
+				}
+				```
+				@DOCEND */
+
+				// @DOCLINE > The macro `mu_graphic_update_wait` is the non-result-checking equivalent, and the macro `mu_graphic_update_wait_` is the result-checking equivalent.
+				#define mu_graphic_update_wait(...) mug_graphic_update_wait(mug_global_context, &mug_global_context->result, __VA_ARGS__)
+				#define mu_graphic_update_wait_(result, ...) mug_graphic_update_wait(mug_global_context, result, __VA_ARGS__)
+
+				// @DOCLINE A graphic waiting in `mug_graphic_update_wait` can be woken from any thread via the function `mug_graphic_wake`, defined below: @NLNT
+				MUDEF void mug_graphic_wake(mugContext* context, muGraphic gfx);
+
+				// @DOCLINE If the graphic isn't waiting, the next call to `mug_graphic_update_wait` returns without blocking. Waking a graphic doesn't mark it as needing to be redrawn by itself; the woken thread is expected to make whatever changes it was woken for.
+
+				// @DOCLINE > The macro `mu_graphic_wake` is the non-result-checking equivalent.
+				#define mu_graphic_wake(...) mug_graphic_wake(mug_global_context, __VA_ARGS__)
+
+			// @DOCLINE ### Partial redraw
+
+				// @DOCLINE By default, every frame is cleared and redrawn in its entirety. A graphic can instead be set to ***partially redraw*** its frames, in which it tracks the area of the graphic that has changed (called the ***damage***), and only pixels within that area are cleared and drawn to, with the rest of the graphic keeping its contents from the previous frame. This makes the cost of filling pixels scale with what changed rather than with the size of the graphic. Partial redraw is enabled or disabled via the function `mug_graphic_partial_redraw`, defined below: @NLNT
+				MUDEF void mug_graphic_partial_redraw(mugContext* context, muGraphic gfx, muBool partial);
+
+				// @DOCLINE While partially redrawing, the graphic's frames are rendered to a framebuffer kept between frames, which is copied to the window when the graphic's buffers are swapped. The same objects should still be rendered each frame, as anything within the damage that isn't rendered is cleared. The damage of a frame is made up of the following:
+
+				// @DOCLINE * The bounds of objects in object buffers (and scenes) where they were and where they are now, upon them being filled, subfilled, resized, retextured, or destroyed, taking into account the [position modifiers](#object-type-modifiers) of their object type.
+
+				// @DOCLINE * The entire graphic upon partial redraw being enabled, upon its size changing, upon an object type's modifiers being changed, and upon a texture being updated, resized, destroyed, or finishing [loading asynchronously](#asynchronous-texture-loading) (as the objects using the texture are unknown).
+
+				// @DOCLINE * Areas given by the user via the function `mug_graphic_damage`, defined below: @NLNT
+				MUDEF void mug_graphic_damage(mugContext* context, muGraphic gfx, float* rect);
+
+				// @DOCLINE `rect` should be a pointer to an array of four floats, which are the x- and y-coordinates of the top-left corner of the area and its width and height, in pixels; if `rect` is 0, the entire graphic is damaged. This is needed for changes that mug can't track, such as rendering different objects than the previous frame, or drawing objects [immediately](#immediate-drawing) in different places.
+
+				// @DOCLINE The damage of a frame is determined upon the graphic being cleared with `mug_graphic_clear`, so changes should be made before it's called; damage caused after clearing (such as by rendering a [scene](#scene), which uploads its changes when rendered) is redrawn the next frame, with the graphic still [needing to be redrawn](#idle-mode) after its buffers are swapped. The area damaged since the graphic was last cleared can be retrieved via the function `mug_graphic_get_damage`, defined below: @NLNT
+				MUDEF muBool mug_graphic_get_damage(mugContext* context, muGraphic gfx, float* rect);
+
+				// @DOCLINE `rect` is filled with the area in the same format as `mug_graphic_damage`, limited to the graphic. `mug_graphic_get_damage` returns whether or not any area has been damaged, and always returns `MU_FALSE` if partial redraw isn't enabled. If the framebuffer used for partial redraw can't be created, `mug_graphic_clear` gives the result `MUG_GL_FAILED_CREATE_FRAMEBUFFER`, and partial redraw is disabled.
+
+				// @DOCLINE > The macros `mu_graphic_partial_redraw`, `mu_graphic_damage`, and `mu_graphic_get_damage` are the non-result-checking equivalents.
+				#define mu_graphic_partial_redraw(...) mug_graphic_partial_redraw(mug_global_context, __VA_ARGS__)
+				#define mu_graphic_damage(...) mug_graphic_damage(mug_global_context, __VA_ARGS__)
+				#define mu_graphic_get_damage(...) mug_graphic_get_damage(mug_global_context, __VA_ARGS__)
+
+		// @DOCLINE ## Draw statistics
+
+			// @DOCLINE Counters of the work that mug does for a graphic are represented by the struct `mugStatCounters`, which has the following members:
+
+			struct mugStatCounters {
+				// @DOCLINE * `@NLFT draw_calls` - the amount of draw calls made.
+				uint64_m draw_calls;
+				// @DOCLINE * `@NLFT objects` - the amount of objects drawn.
+				uint64_m objects;
+				// @DOCLINE * `@NLFT vertexes` - the amount of vertexes drawn.
+				uint64_m vertexes;
+				// @DOCLINE * `@NLFT upload_bytes` - the amount of bytes of vertex data sent to the GPU upon filling and subfilling object buffers (including the buffers used for [immediate drawing](#immediate-drawing)).
+				uint64_m upload_bytes;
+				// @DOCLINE * `@NLFT index_bytes` - the amount of bytes of index data regenerated and sent to the GPU, which happens when object buffers are created or resized.
+				uint64_m index_bytes;
+				// @DOCLINE * `@NLFT program_binds` - the amount of times that a shader program was bound to render.
+				uint64_m program_binds;
+				// @DOCLINE * `@NLFT vertex_array_binds` - the amount of times that an object buffer's vertex array was bound to be filled or rendered.
+				uint64_m vertex_array_binds;
+				// @DOCLINE * `@NLFT texture_binds` - the amount of times that a texture was bound to render.
+				uint64_m texture_binds;
+				// @DOCLINE * `@NLFT context_binds` - the amount of times that the graphic's context (such as its OpenGL context) was bound.
+				uint64_m context_binds;
+				// @DOCLINE * `@NLFT mallocs` - the amount of memory allocations made to fill object buffers, and to grow the memory used for immediate drawing.
+				uint64_m mallocs;
+				// @DOCLINE * `@NLFT malloc_bytes` - the amount of bytes allocated by those allocations.
+				uint64_m malloc_bytes;
+				// @DOCLINE * `@NLFT shader_compiles` - the amount of shader programs compiled.
+				uint64_m shader_compiles;
+				// @DOCLINE * `@NLFT fill_time` - the time spent generating vertex data for objects, in seconds.
+				double fill_time;
+				// @DOCLINE * `@NLFT upload_time` - the time spent sending vertex and index data to the GPU, in seconds.
+				double upload_time;
+				// @DOCLINE * `@NLFT swap_time` - the time spent swapping the graphic's buffers, in seconds.
+				double swap_time;
+				// @DOCLINE * `@NLFT sleep_time` - the time spent waiting for the next frame in `mug_graphic_update` and `mug_graphic_update_wait`, in seconds.
+				double sleep_time;
+			};
+			typedef struct mugStatCounters mugStatCounters;
+
+			// @DOCLINE The draw statistics of a graphic are represented by the struct `mugStats`, which has the following members:
+
+			struct mugStats {
+				// @DOCLINE * `@NLFT frame` - the counters of the current frame so far.
+				mugStatCounters frame;
+				// @DOCLINE * `@NLFT last` - the counters of the most recent complete frame.
+				mugStatCounters last;
+				// @DOCLINE * `@NLFT total` - the counters of every complete frame added together.
+				mugStatCounters total;
+				// @DOCLINE * `@NLFT frames` - the amount of complete frames.
+				uint64_m frames;
+			};
+			typedef struct mugStats mugStats;
+
+			// @DOCLINE The draw statistics of a graphic are retrieved into `stats` via the function `mug_graphic_get_stats`, defined below: @NLNT
+			MUDEF void mug_graphic_get_stats(mugContext* context, muGraphic gfx, mugStats* stats);
+
+			// @DOCLINE A frame is completed by `mug_graphic_swap_buffers`, upon which the counters of `frame` are added to `total`, copied to `last`, and reset to 0; work done before a graphic's first swap (such as creating object buffers) is counted as part of its first frame. The time spent waiting in `mug_graphic_update` is counted as part of the frame after the one that was just swapped.
+
+			// @DOCLINE Counting takes a few additions per operation, along with reading the time before and after the operations that are timed. Defining `MUG_NO_STATS` before including the implementation removes counting entirely, in which case every counter stays 0.
+
+			// @DOCLINE > The macro `mu_graphic_get_stats` is the non-result-checking equivalent.
+			#define mu_graphic_get_stats(...) mug_graphic_get_stats(mug_global_context, __VA_ARGS__)
+
+		// @DOCLINE ## GPU zones
+
+			// @DOCLINE The time that the GPU spends on parts of a frame can be measured via ***GPU zones***. GPU zones are disabled by default, and are enabled or disabled for a graphic via the function `mug_graphic_gpu_profile`, defined below: @NLNT
+			MUDEF void mug_graphic_gpu_profile(mugContext* context, muGraphic gfx, muBool enable);
+
+			// @DOCLINE While enabled, the time spent on everything rendered between a call to `mug_gpu_zone_begin` and `mug_gpu_zone_end`, both defined below, is measured as part of the zone with the given name: @NLNT
+			MUDEF void mug_gpu_zone_begin(mugContext* context, mugResult* result, muGraphic gfx, const char* name);
+			// @NLNT
+			MUDEF void mug_gpu_zone_end(mugContext* context, muGraphic gfx);
+
+			// @DOCLINE Zones are identified by the contents of `name`, which is expected to stay valid for as long as the graphic exists (such as a string literal). A zone can be begun more than once per frame, in which case its times are added together. Zones can't be nested; beginning a zone while another is active does nothing. A zone left active is ended upon the graphic's buffers being swapped. Up to `MUG_GPU_ZONE_COUNT` zones can exist per graphic; beginning a zone of a new name past that does nothing.
+			#define MUG_GPU_ZONE_COUNT 32
+
+			// @DOCLINE While enabled and no zone is active, each call to [`mug_gobjects_render`](#render-object-buffer), [`mug_gobjects_subrender`](#subrender-object-buffer), and [`mug_gobjects_render_visible`](#render-visible-objects) is measured as part of a zone named after the buffer's object type (such as "rect" for rects, or "texture_2d" for 2D textures). Beginning a zone around renders attributes their time to it instead.
+
+			// @DOCLINE Times are measured using timer queries, whose results are read back without waiting on the GPU once they're available, usually a few frames later. A zone is represented by the struct `mugGPUZone`, which has the following members:
+
+			struct mugGPUZone {
+				// @DOCLINE * `const char* name` - the name of the zone.
+				const char* name;
+				// @DOCLINE * `@NLFT time` - the moving average of the time spent on the zone per frame, in seconds.
+				double time;
+				// @DOCLINE * `@NLFT last` - the time spent on the zone in the latest frame measured, in seconds.
+				double last;
+				// @DOCLINE * `@NLFT frames` - the amount of frames measured.
+				uint64_m frames;
+			};
+			typedef struct mugGPUZone mugGPUZone;
+
+			// @DOCLINE Each frame's time is weighed by `MUG_GPU_ZONE_SMOOTHING` in the moving average, which roughly averages the last 10 frames measured.
+			#define MUG_GPU_ZONE_SMOOTHING 0.1
+
+			// @DOCLINE The zones of a graphic can be retrieved via the function `mug_graphic_get_gpu_zones`, defined below: @NLNT
+			MUDEF uint32_m mug_graphic_get_gpu_zones(mugContext* context, muGraphic gfx, mugGPUZone* zones, uint32_m max);
+
+			// @DOCLINE Up to `max` zones are filled into `zones`, in the order that they were first begun. `mug_graphic_get_gpu_zones` returns the amount of zones that exist, which can be retrieved without filling any by passing 0 for `zones` and `max`. Zones that haven't been measured yet have a `frames` value of 0.
+
+			// @DOCLINE > The macros `mu_graphic_gpu_profile`, `mu_gpu_zone_end`, and `mu_graphic_get_gpu_zones` are the non-result-checking equivalents, and the macro `mu_gpu_zone_begin` is the result-checking equivalent.
+			#define mu_graphic_gpu_profile(...) mug_graphic_gpu_profile(mug_global_context, __VA_ARGS__)
+			#define mu_gpu_zone_begin(...) mug_gpu_zone_begin(mug_global_context, &mug_global_context->result, __VA_ARGS__)
+			#define mu_gpu_zone_end(...) mug_gpu_zone_end(mug_global_context, __VA_ARGS__)
+			#define mu_graphic_get_gpu_zones(...) mug_graphic_get_gpu_zones(mug_global_context, __VA_ARGS__)
+
+		// @DOCLINE ## Tracing
+
+			// @DOCLINE mug can record a timeline of what it does for a graphic, which can be written as a [Chrome trace](https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU) JSON file and viewed in tools such as [Perfetto](https://ui.perfetto.dev) or `chrome://tracing`. Tracing is disabled by default, and is enabled or disabled for a graphic via the function `mug_graphic_trace`, defined below: @NLNT
+			MUDEF void mug_graphic_trace(mugContext* context, mugResult* result, muGraphic gfx, muBool enable);
+
+			// @DOCLINE While enabled, the start time and duration of the following operations are recorded on the graphic's CPU track:
+
+			// @DOCLINE * "context bind" - binding the graphic's context (such as its OpenGL context).
+
+			// @DOCLINE * "shader compile" - compiling a shader program.
+
+			// @DOCLINE * "fill vertexes" - generating vertex data for objects.
+
+			// @DOCLINE * "upload" - sending vertex and index data to the GPU.
+
+			// @DOCLINE * "draw" - issuing a draw call.
+
+			// @DOCLINE * "swap" - swapping the graphic's buffers.
+
+			// @DOCLINE * "sleep" - waiting for the next frame in `mug_graphic_update` and `mug_graphic_update_wait`.
+
+			// @DOCLINE * "window update" - updating the graphic's window.
+
+			// @DOCLINE If [GPU zones](#gpu-zones) are enabled as well, each zone measured is recorded on a separate GPU track, aligned to the CPU track's time. GPU zones are recorded once their time is read back, so the latest few frames' zones may be missing.
+
+			// @DOCLINE Events are recorded into a ring holding the latest `MUG_TRACE_EVENT_COUNT` events of the graphic, which is allocated when tracing is first enabled (giving `MUG_FAILED_MALLOC` if the allocation fails). Disabling tracing stops recording, but keeps the events recorded so far. Recording an event takes reading the time twice and writing it to the ring; no locks are used, as a graphic is only used from one thread. Defining `MUG_NO_TRACE` before including the implementation removes recording entirely.
+			#define MUG_TRACE_EVENT_COUNT 65536
+
+			// @DOCLINE The events recorded for a graphic can be written as Chrome trace JSON to a file via the function `mug_graphic_write_trace`, defined below: @NLNT
+			MUDEF void mug_graphic_write_trace(mugContext* context, mugResult* result, muGraphic gfx, const char* path);
+
+			// @DOCLINE If the file can't be written, the result `MUG_FAILED_ACCESS_FILE` is given. Times are written in microseconds since the context's fixed time started.
+
+			// @DOCLINE > The macros `mu_graphic_trace` and `mu_graphic_write_trace` are the result-checking equivalents.
+			#define mu_graphic_trace(...) mug_graphic_trace(mug_global_context, &mug_global_context->result, __VA_ARGS__)
+			#define mu_graphic_write_trace(...) mug_graphic_write_trace(mug_global_context, &mug_global_context->result, __VA_ARGS__)
+
 	// @DOCLINE # Objects
 
 		// @DOCLINE An ***object*** in mug (commonly called a "gobject" in the API) is something that is rendered to the screen. Its ***type*** defines what type of object it is, such as a triangle object.
@@ -2549,6 +3000,58 @@ It is likely that [object type modifiers](#object-type-modifiers) would work bet
 			#define mu_gobjects_subrender(...) mug_gobjects_subrender(mug_global_context, &mug_global_context->result, __VA_ARGS__)
 			#define mu_gobjects_subrender_(result, ...) mug_gobjects_subrender(mug_global_context, result, __VA_ARGS__)
 
+		// @DOCLINE ## Spatial index
+
+			// @DOCLINE An object buffer can optionally keep a spatial index over the bounds of its objects, which allows only rendering the objects within a given area. The bounds of each object are calculated from the same geometry that is uploaded for rendering it, and the index is updated whenever the buffer is filled/subfilled, with subfilling only updating the objects that were subfilled.
+
+			// @DOCLINE ### Enable spatial index
+
+				// @DOCLINE The spatial index of an object buffer can be enabled via the function `mug_gobjects_index`, defined below: @NLNT
+				MUDEF void mug_gobjects_index(mugContext* context, mugResult* result, muGraphic gfx, mugObjects objs, float cell_size);
+
+				// @DOCLINE The index is a uniform grid whose cells have a width and height of `cell_size` pixels; a good cell size is around the size of a typical object within the buffer. If `cell_size` is less than or equal to 0, the spatial index is disabled and freed. Enabling the spatial index reads back the buffer's current contents, so it's best to enable it right after creating the buffer. Filling or resizing the buffer with no data removes all of its objects from the index until they're given contents again.
+
+				// @DOCLINE > The macro `mu_gobjects_index` is the non-result-checking equivalent, and the macro `mu_gobjects_index_` is the result-checking equivalent.
+				#define mu_gobjects_index(...) mug_gobjects_index(mug_global_context, &mug_global_context->result, __VA_ARGS__)
+				#define mu_gobjects_index_(result, ...) mug_gobjects_index(mug_global_context, result, __VA_ARGS__)
+
+			// @DOCLINE ### Render visible objects
+
+				// @DOCLINE The objects of an object buffer within a given area can be rendered via the function `mug_gobjects_render_visible`, defined below: @NLNT
+				MUDEF void mug_gobjects_render_visible(mugContext* context, mugResult* result, muGraphic gfx, mugObjects objs, float* view_rect);
+
+				// @DOCLINE `view_rect` should be a pointer to an array of four floats, which are the x- and y-coordinates of the top-left corner of the area and its width and height, in the same coordinates as the objects themselves (before any [object type modifiers](#object-type-modifiers) are applied). All objects whose bounds overlap the area are rendered, with ranges of consecutive visible objects being rendered together in a single draw call. If the object buffer has no spatial index, all objects are rendered, as if `mug_gobjects_render` was called.
+
+				// @DOCLINE > The macro `mu_gobjects_render_visible` is the non-result-checking equivalent, and the macro `mu_gobjects_render_visible_` is the result-checking equivalent.
+				#define mu_gobjects_render_visible(...) mug_gobjects_render_visible(mug_global_context, &mug_global_context->result, __VA_ARGS__)
+				#define mu_gobjects_render_visible_(result, ...) mug_gobjects_render_visible(mug_global_context, result, __VA_ARGS__)
+
+			// @DOCLINE ### Pick objects
+
+				// @DOCLINE The objects of an object buffer at a given point (such as the position of the mouse cursor) can be found via the function `mug_gobjects_pick`, defined below: @NLNT
+				MUDEF uint32_m mug_gobjects_pick(mugContext* context, mugResult* result, muGraphic gfx, mugObjects objs, float x, float y, uint32_m* indexes, uint32_m max);
+
+				// @DOCLINE An object is considered to be at the point if the coverage that its shader calculates for it at the point (with the same anti-aliasing, rotation, squircle exponent, corner radius, etc.) is at least one half. Points and lines are considered one pixel wide. The point is given in the same coordinates as the objects themselves (before any [object type modifiers](#object-type-modifiers) are applied), and the colors of the objects (and the texture of texture objects) are not taken into account.
+
+				// @DOCLINE The indexes of the objects found are written to `indexes`, ordered from the topmost object to the bottommost object, being sorted by their z-coordinates, and then by their index (as later objects are drawn on top of earlier objects with the same z-coordinate). At most `max` indexes are written. This function returns the amount of objects found, which can be greater than `max`.
+
+				// @DOCLINE This function requires the object buffer to have a spatial index; if it doesn't, the result is set to `MUG_NO_SPATIAL_INDEX`, and 0 is returned.
+
+				// @DOCLINE > The macro `mu_gobjects_pick` is the non-result-checking equivalent, and the macro `mu_gobjects_pick_` is the result-checking equivalent.
+				#define mu_gobjects_pick(...) mug_gobjects_pick(mug_global_context, &mug_global_context->result, __VA_ARGS__)
+				#define mu_gobjects_pick_(result, ...) mug_gobjects_pick(mug_global_context, result, __VA_ARGS__)
+
+			// @DOCLINE ### Pick objects in rect
+
+				// @DOCLINE The objects of an object buffer overlapping a given rectangle (such as a selection box) can be found via the function `mug_gobjects_pick_rect`, defined below: @NLNT
+				MUDEF uint32_m mug_gobjects_pick_rect(mugContext* context, mugResult* result, muGraphic gfx, mugObjects objs, float* rect, uint32_m* indexes, uint32_m max);
+
+				// @DOCLINE `rect` should be a pointer to an array of four floats, which are the x- and y-coordinates of the top-left corner of the rectangle and its width and height. Points, lines, triangles, rects, and texture rects are tested exactly; circles, squircles, and round rects are considered to overlap the rectangle if they cover the point of the rectangle closest to their center or any of the rectangle's corners, which is exact for circles and closely approximates the others. Everything else works the same as with `mug_gobjects_pick`.
+
+				// @DOCLINE > The macro `mu_gobjects_pick_rect` is the non-result-checking equivalent, and the macro `mu_gobjects_pick_rect_` is the result-checking equivalent.
+				#define mu_gobjects_pick_rect(...) mug_gobjects_pick_rect(mug_global_context, &mug_global_context->result, __VA_ARGS__)
+				#define mu_gobjects_pick_rect_(result, ...) mug_gobjects_pick_rect(mug_global_context, result, __VA_ARGS__)
+
 		// @DOCLINE ## Fill
 
 			// @DOCLINE An object buffer's contents can be replaced using the function `mug_gobjects_fill`, defined below: @NLNT
@@ -2571,6 +3074,17 @@ It is likely that [object type modifiers](#object-type-modifiers) would work bet
 			#define mu_gobjects_subfill(...) mug_gobjects_subfill(mug_global_context, &mug_global_context->result, __VA_ARGS__)
 			#define mu_gobjects_subfill_(result, ...) mug_gobjects_subfill(mug_global_context, result, __VA_ARGS__)
 
+		// @DOCLINE ## Resize
+
+			// @DOCLINE The amount of objects held by an object buffer can be changed via the function `mug_gobjects_resize`, defined below: @NLNT
+			MUDEF void mug_gobjects_resize(mugContext* context, mugResult* result, muGraphic gfx, mugObjects objs, uint32_m obj_count, void* data);
+
+			// @DOCLINE If `data` is 0, the contents of the buffer are undefined after resizing. If `data` is not 0, it should be a pointer to an array of objects whose type matches the object type of the buffer, and whose length (in objects) should match `obj_count`. If this function fails, the buffer retains its previous size.
+
+			// @DOCLINE > The macro `mu_gobjects_resize` is the non-result-checking equivalent, and the macro `mu_gobjects_resize_` is the result-checking equivalent.
+			#define mu_gobjects_resize(...) mug_gobjects_resize(mug_global_context, &mug_global_context->result, __VA_ARGS__)
+			#define mu_gobjects_resize_(result, ...) mug_gobjects_resize(mug_global_context, result, __VA_ARGS__)
+
 		// @DOCLINE ## Object buffer texture
 
 			// @DOCLINE For object buffers that rely on rendering a texture, their texture can be set via the function `mug_gobjects_texture`, defined below: @NLNT
@@ -2583,6 +3097,149 @@ It is likely that [object type modifiers](#object-type-modifiers) would work bet
 			// @DOCLINE > The macro `mu_gobjects_texture` is the non-result-checking equivalent.
 			#define mu_gobjects_texture(...) mug_gobjects_texture(mug_global_context, __VA_ARGS__)
 
+	// @DOCLINE # Immediate drawing
+
+		// @DOCLINE Besides object buffers, objects can be drawn "immediately" for the current frame, without creating or managing an object buffer. Immediately-drawn objects are appended to a pending batch; consecutive draws of the same object type (and, for texture objects, the same texture) are collected into the same batch, which is rendered in a single draw call once a differing object type or texture is drawn, or once the frame ends via `mug_graphic_swap_buffers`.
+
+		// @DOCLINE The pending batch is stored in a per-graphic frame arena that is reset every frame, and batches are uploaded into per-type streaming buffers kept alive by the graphic. This means that once the arena and streaming buffers have grown to fit a frame's worth of objects, immediate drawing performs no further allocations.
+
+		// @DOCLINE Immediate drawing keeps the order in which things are drawn; rendering/subrendering an object buffer and setting an object type modifier render the pending batch first.
+
+		// @DOCLINE ## Draw rect
+
+			// @DOCLINE The function `mug_draw_rect` draws a [rect](#rect) for the current frame, defined below: @NLNT
+			MUDEF void mug_draw_rect(mugContext* context, mugResult* result, muGraphic gfx, mugRect* rect);
+
+			// @DOCLINE > The macro `mu_draw_rect` is the non-result-checking equivalent, and the macro `mu_draw_rect_` is the result-checking equivalent.
+			#define mu_draw_rect(...) mug_draw_rect(mug_global_context, &mug_global_context->result, __VA_ARGS__)
+			#define mu_draw_rect_(result, ...) mug_draw_rect(mug_global_context, result, __VA_ARGS__)
+
+		// @DOCLINE ## Draw circle
+
+			// @DOCLINE The function `mug_draw_circle` draws a [circle](#circle) for the current frame, defined below: @NLNT
+			MUDEF void mug_draw_circle(mugContext* context, mugResult* result, muGraphic gfx, mugCircle* circle);
+
+			// @DOCLINE > The macro `mu_draw_circle` is the non-result-checking equivalent, and the macro `mu_draw_circle_` is the result-checking equivalent.
+			#define mu_draw_circle(...) mug_draw_circle(mug_global_context, &mug_global_context->result, __VA_ARGS__)
+			#define mu_draw_circle_(result, ...) mug_draw_circle(mug_global_context, result, __VA_ARGS__)
+
+		// @DOCLINE ## Draw round rect
+
+			// @DOCLINE The function `mug_draw_round_rect` draws a [round rect](#round-rect) for the current frame, defined below: @NLNT
+			MUDEF void mug_draw_round_rect(mugContext* context, mugResult* result, muGraphic gfx, mugRoundRect* round_rect);
+
+			// @DOCLINE > The macro `mu_draw_round_rect` is the non-result-checking equivalent, and the macro `mu_draw_round_rect_` is the result-checking equivalent.
+			#define mu_draw_round_rect(...) mug_draw_round_rect(mug_global_context, &mug_global_context->result, __VA_ARGS__)
+			#define mu_draw_round_rect_(result, ...) mug_draw_round_rect(mug_global_context, result, __VA_ARGS__)
+
+		// @DOCLINE ## Draw texture rect
+
+			// @DOCLINE The function `mug_draw_texture_rect` draws a [2D texture rect](#2d-texture-rect) with a given texture for the current frame, defined below: @NLNT
+			MUDEF void mug_draw_texture_rect(mugContext* context, mugResult* result, muGraphic gfx, mugTexture tex, mug2DTextureRect* rect);
+
+			// @DOCLINE The type of `tex` must be `MUG_TEXTURE_2D`. Drawing a texture rect with a different texture than the last texture rect drawn starts a new batch, so grouping draws by texture keeps the amount of draw calls low. `tex` must not be destroyed before the frame ends.
+
+			// @DOCLINE > The macro `mu_draw_texture_rect` is the non-result-checking equivalent, and the macro `mu_draw_texture_rect_` is the result-checking equivalent.
+			#define mu_draw_texture_rect(...) mug_draw_texture_rect(mug_global_context, &mug_global_context->result, __VA_ARGS__)
+			#define mu_draw_texture_rect_(result, ...) mug_draw_texture_rect(mug_global_context, result, __VA_ARGS__)
+
+		// @DOCLINE ## Flush immediate drawing
+
+			// @DOCLINE The pending batch is rendered automatically when needed, but it can also be rendered manually via the function `mug_draw_flush`, defined below: @NLNT
+			MUDEF void mug_draw_flush(mugContext* context, mugResult* result, muGraphic gfx);
+
+			// @DOCLINE This function does nothing if no batch is pending.
+
+			// @DOCLINE > The macro `mu_draw_flush` is the non-result-checking equivalent, and the macro `mu_draw_flush_` is the result-checking equivalent.
+			#define mu_draw_flush(...) mug_draw_flush(mug_global_context, &mug_global_context->result, __VA_ARGS__)
+			#define mu_draw_flush_(result, ...) mug_draw_flush(mug_global_context, result, __VA_ARGS__)
+
+	// @DOCLINE # Scene
+
+		typedef void* mugScene;
+		typedef uint64_m mugSceneObject;
+
+		// @DOCLINE A "scene" is a retained container of individual objects, which owns an object buffer for each object type in use. Objects are added to a scene and referred to with a stable handle (type `mugSceneObject`, typedef for `uint64_m`), and can then be updated and removed through that handle, without having to keep track of offsets within object buffers. The type for a scene is `mugScene` (typedef for `void*`).
+
+		// @DOCLINE Objects of each type are kept tightly packed; removing an object moves the last object of its type into its place. Adding, updating, and removing objects only marks them as changed, and the changed objects are uploaded the next time the scene is rendered, meaning that the cost of rendering a scene each frame scales with the amount of objects changed since the last frame rather than the amount of objects in the scene.
+
+		// @DOCLINE ## Create scene
+
+			// @DOCLINE A scene can be created via the function `mug_scene_create`, defined below: @NLNT
+			MUDEF mugScene mug_scene_create(mugContext* context, mugResult* result, muGraphic gfx);
+
+			// @DOCLINE Every scene that is created must be destroyed before the graphic that was used to create it is destroyed.
+
+			// @DOCLINE > The macro `mu_scene_create` is the non-result-checking equivalent, and the macro `mu_scene_create_` is the result-checking equivalent.
+			#define mu_scene_create(...) mug_scene_create(mug_global_context, &mug_global_context->result, __VA_ARGS__)
+			#define mu_scene_create_(result, ...) mug_scene_create(mug_global_context, result, __VA_ARGS__)
+
+		// @DOCLINE ## Destroy scene
+
+			// @DOCLINE A scene can be destroyed via the function `mug_scene_destroy`, defined below: @NLNT
+			MUDEF mugScene mug_scene_destroy(mugContext* context, muGraphic gfx, mugScene scene);
+
+			// @DOCLINE This function destroys all object buffers owned by the scene, and invalidates every handle of the scene. This function returns 0.
+
+			// @DOCLINE > The macro `mu_scene_destroy` is the non-result-checking equivalent.
+			#define mu_scene_destroy(...) mug_scene_destroy(mug_global_context, __VA_ARGS__)
+
+		// @DOCLINE ## Add object to scene
+
+			// @DOCLINE An object can be added to a scene via the function `mug_scene_add`, defined below: @NLNT
+			MUDEF mugSceneObject mug_scene_add(mugContext* context, mugResult* result, muGraphic gfx, mugScene scene, mugObjectType type, void* obj);
+
+			// @DOCLINE `obj` should be a pointer to a single object whose type matches the object type indicated by `type`; its contents are copied. This function returns a handle to the object, which remains valid until the object is removed, even as other objects are added and removed. If this function fails, 0 is returned, which is never a valid handle.
+
+			// @DOCLINE > The macro `mu_scene_add` is the non-result-checking equivalent, and the macro `mu_scene_add_` is the result-checking equivalent.
+			#define mu_scene_add(...) mug_scene_add(mug_global_context, &mug_global_context->result, __VA_ARGS__)
+			#define mu_scene_add_(result, ...) mug_scene_add(mug_global_context, result, __VA_ARGS__)
+
+		// @DOCLINE ## Update object in scene
+
+			// @DOCLINE An object within a scene can be changed via the function `mug_scene_update`, defined below: @NLNT
+			MUDEF void mug_scene_update(mugContext* context, mugResult* result, muGraphic gfx, mugScene scene, mugSceneObject obj, void* data);
+
+			// @DOCLINE `data` should be a pointer to a single object whose type matches the object type that the object was added with; its contents are copied.
+
+			// @DOCLINE > The macro `mu_scene_update` is the non-result-checking equivalent, and the macro `mu_scene_update_` is the result-checking equivalent.
+			#define mu_scene_update(...) mug_scene_update(mug_global_context, &mug_global_context->result, __VA_ARGS__)
+			#define mu_scene_update_(result, ...) mug_scene_update(mug_global_context, result, __VA_ARGS__)
+
+		// @DOCLINE ## Remove object from scene
+
+			// @DOCLINE An object can be removed from a scene via the function `mug_scene_remove`, defined below: @NLNT
+			MUDEF void mug_scene_remove(mugContext* context, mugResult* result, muGraphic gfx, mugScene scene, mugSceneObject obj);
+
+			// @DOCLINE The handle of the removed object is invalid after this function is called.
+
+			// @DOCLINE > The macro `mu_scene_remove` is the non-result-checking equivalent, and the macro `mu_scene_remove_` is the result-checking equivalent.
+			#define mu_scene_remove(...) mug_scene_remove(mug_global_context, &mug_global_context->result, __VA_ARGS__)
+			#define mu_scene_remove_(result, ...) mug_scene_remove(mug_global_context, result, __VA_ARGS__)
+
+		// @DOCLINE Calling `mug_scene_update` or `mug_scene_remove` with an invalid handle (such as a handle to an object that has already been removed) sets the result to `MUG_INVALID_SCENE_OBJECT` and does nothing else.
+
+		// @DOCLINE ## Render scene
+
+			// @DOCLINE A scene can be rendered via the function `mug_scene_render`, defined below: @NLNT
+			MUDEF void mug_scene_render(mugContext* context, mugResult* result, muGraphic gfx, mugScene scene);
+
+			// @DOCLINE This function first uploads every object changed since the last time the scene was rendered, with changed objects next to each other being uploaded together, and then renders all objects of each object type with one call, in the order of the [object type](#object-types) values.
+
+			// @DOCLINE > The macro `mu_scene_render` is the non-result-checking equivalent, and the macro `mu_scene_render_` is the result-checking equivalent.
+			#define mu_scene_render(...) mug_scene_render(mug_global_context, &mug_global_context->result, __VA_ARGS__)
+			#define mu_scene_render_(result, ...) mug_scene_render(mug_global_context, result, __VA_ARGS__)
+
+		// @DOCLINE ## Scene texture
+
+			// @DOCLINE For object types that rely on rendering a texture, the texture that a scene renders them with can be set via the function `mug_scene_texture`, defined below: @NLNT
+			MUDEF void mug_scene_texture(mugContext* context, muGraphic gfx, mugScene scene, mugObjectType type, mugTexture tex);
+
+			// @DOCLINE All objects of the given type within the scene are rendered with the given texture. The same rules apply as with [object buffer textures](#object-buffer-texture). An unknown object type is ignored.
+
+			// @DOCLINE > The macro `mu_scene_texture` is the non-result-checking equivalent.
+			#define mu_scene_texture(...) mug_scene_texture(mug_global_context, __VA_ARGS__)
+
 	// @DOCLINE # Texture
 
 		// @DOCLINE A "texture" in mug is a pixel bitmap stored for rendering (often called a "gtexture" in the API), and is used in rendering to draw images to the screen using a texture object buffer. Its respective type is `mugTexture` (typedef for `void*`).
@@ -2614,6 +3271,18 @@ It is likely that [object type modifiers](#object-type-modifiers) would work bet
 			#define MUG_TEXTURE_U8_RGB 1
 			// @DOCLINE * `MUG_TEXTURE_U8_RGBA` - red-green-blue-alpha-channel unsigned 8-bit integer normalized texture format.
 			#define MUG_TEXTURE_U8_RGBA 2
+			// @DOCLINE * `MUG_TEXTURE_BC1_RGBA` - [BC1](https://en.wikipedia.org/wiki/S3_Texture_Compression) (also known as DXT1) block-compressed red-green-blue texture format with 1-bit alpha; 8 bytes per block.
+			#define MUG_TEXTURE_BC1_RGBA 3
+			// @DOCLINE * `MUG_TEXTURE_BC3_RGBA` - BC3 (also known as DXT5) block-compressed red-green-blue-alpha texture format; 16 bytes per block.
+			#define MUG_TEXTURE_BC3_RGBA 4
+			// @DOCLINE * `MUG_TEXTURE_BC4_R` - BC4 (also known as RGTC1) block-compressed red-channel texture format; 8 bytes per block.
+			#define MUG_TEXTURE_BC4_R 5
+			// @DOCLINE * `MUG_TEXTURE_BC7_RGBA` - BC7 (also known as BPTC) block-compressed red-green-blue-alpha texture format; 16 bytes per block.
+			#define MUG_TEXTURE_BC7_RGBA 6
+
+			// @DOCLINE The block-compressed formats store pixels in blocks of 4 by 4 pixels, ordered left-to-right and top-to-bottom, with the blocks on the right and bottom edges covering pixels past the texture's width and height if they aren't multiples of 4. Not every device supports every block-compressed format; the formats supported by the current device can be retrieved with [`MUG_MAX_TEXTURE_FORMATS`](#texture-maximum-supported-values), and using an unsupported format sets the result to `MUG_UNSUPPORTED_TEXTURE_FORMAT`. `MUG_TEXTURE_BC4_R` is supported on every device that runs mug.
+
+			// @DOCLINE Mipmaps are not generated for block-compressed textures; a block-compressed texture with `MUG_TEXTURE_TRILINEAR` downscale filtering acts as if it had `MUG_TEXTURE_BILINEAR` downscale filtering.
 
 		// @DOCLINE ## Texture wrapping
 
@@ -2642,6 +3311,36 @@ It is likely that [object type modifiers](#object-type-modifiers) would work bet
 			// @DOCLINE * `MUG_TEXTURE_BILINEAR` - [bilinear interpolation](https://en.wikipedia.org/wiki/Bilinear_interpolation).
 			#define MUG_TEXTURE_BILINEAR 1
 
+			// @DOCLINE * `MUG_TEXTURE_TRILINEAR` - [trilinear interpolation](https://en.wikipedia.org/wiki/Trilinear_filtering). When used for downscaling, the texture stores a [mipmap](https://en.wikipedia.org/wiki/Mipmap) chain (progressively halved copies of the texture), and is sampled by blending bilinear samples of the two copies closest to the size being rendered. This avoids aliasing, and is often faster for heavily downscaled textures, as far fewer texture pixels need to be read. When used for upscaling, it acts the same as `MUG_TEXTURE_BILINEAR`.
+			#define MUG_TEXTURE_TRILINEAR 2
+
+		// @DOCLINE ## Texture conversion
+
+			typedef uint8_m mugTextureConversion;
+
+			// @DOCLINE The pixels given for a texture of an uncompressed format can be converted as they're uploaded, which is specified with the type `mugTextureConversion` (typedef for `uint8_m`), a bitmask of the following defined values:
+
+			// @DOCLINE * `MUG_TEXTURE_CONVERT_BGR` - the pixels given have their red and blue channels swapped (such as BGR or BGRA pixel data, which many image decoders and operating systems give), and are swizzled into red-green-blue order.
+			#define MUG_TEXTURE_CONVERT_BGR 1
+
+			// @DOCLINE * `MUG_TEXTURE_CONVERT_PREMULTIPLY` - the red, green, and blue channels of the pixels given are multiplied by their alpha channel (rounded to the nearest value). This only affects `MUG_TEXTURE_U8_RGBA` pixels.
+			#define MUG_TEXTURE_CONVERT_PREMULTIPLY 2
+
+			// @DOCLINE A value of 0 performs no conversion. Pixels are converted while being copied into the graphic's [staging buffers](#texture-update), so converting takes no extra pass over them.
+
+			// @DOCLINE Regardless of conversion, `MUG_TEXTURE_U8_RGB` textures are stored on the GPU with an opaque alpha channel, as GPUs lack a native 3-byte pixel format, and drivers otherwise expand each pixel themselves (often slowly) upon every upload. Their pixels are still given as `MUG_TEXTURE_U8_RGB` pixel data, and are expanded while being copied into the staging buffers, but they take up as much texture memory as `MUG_TEXTURE_U8_RGBA` textures of the same size.
+
+			// @DOCLINE Pixel data can also be converted between uncompressed formats on the CPU via the function `mug_texture_convert`, defined below: @NLNT
+			MUDEF void mug_texture_convert(mugContext* context, mugResult* result, mugTextureFormat src_format, mugTextureFormat dst_format, mugTextureConversion convert, uint32_m w, uint32_m h, uint32_m row_stride, muByte* src, muByte* dst);
+
+			// @DOCLINE `src_format` and `dst_format` must be `MUG_TEXTURE_U8_R`, `MUG_TEXTURE_U8_RGB`, or `MUG_TEXTURE_U8_RGBA`; any other format sets the result to `MUG_UNSUPPORTED_TEXTURE_FORMAT`. `convert` is applied to the pixels of `src`, and channels that `src` lacks are filled in: alpha is opaque, and the red channel of `MUG_TEXTURE_U8_R` pixels is copied to green and blue. Converting a format with color to `MUG_TEXTURE_U8_R` packs each pixel into its luma (using the [BT.601](https://en.wikipedia.org/wiki/Rec._601) weights), which stores a grayscale image in a fraction of the memory. `w` and `h` are the width and height of the image, and `row_stride` is the amount of bytes between the start of each row of `src` (0 meaning that the rows are tightly packed). `dst` should point to at least `mug_texture_data_size(dst_format, w, h)` bytes, which are written tightly packed, and can't overlap `src`.
+
+			// @DOCLINE Conversion uses SSSE3 or NEON instructions if the compiler targets them, and falls back to plain C otherwise. Defining `MUG_NO_SIMD` before including the implementation disables the SIMD instructions.
+
+			// @DOCLINE > The macro `mu_texture_convert` is the non-result-checking equivalent, and the macro `mu_texture_convert_` is the result-checking equivalent.
+			#define mu_texture_convert(...) mug_texture_convert(mug_global_context, &mug_global_context->result, __VA_ARGS__)
+			#define mu_texture_convert_(result, ...) mug_texture_convert(mug_global_context, result, __VA_ARGS__)
+
 		// @DOCLINE ## Texture info
 
 			// @DOCLINE Information about how a texture is stored within mug is represented with the struct `mugTextureInfo`. It has the following members:
@@ -2655,6 +3354,10 @@ It is likely that [object type modifiers](#object-type-modifiers) would work bet
 				mugTextureWrapping wrapping[2];
 				// @DOCLINE * `@NLFT filtering[2]` - the [texture filtering](#texture-filtering) when upscaling (`filtering[0]`) and downscaling (`filtering[1]`).
 				mugTextureFiltering filtering[2];
+				// @DOCLINE * `@NLFT mip_levels` - the maximum amount of mipmap levels (including the full-size texture) stored for the texture if its downscale filtering is `MUG_TEXTURE_TRILINEAR`. A value of 0 stores every level down to a size of 1 by 1 pixel.
+				uint32_m mip_levels;
+				// @DOCLINE * `@NLFT convert` - the [conversion](#texture-conversion) performed on every pixel given for the texture. It's ignored for block-compressed formats.
+				mugTextureConversion convert;
 			};
 			typedef struct mugTextureInfo mugTextureInfo;
 
@@ -2677,7 +3380,11 @@ It is likely that [object type modifiers](#object-type-modifiers) would work bet
 
 			// @DOCLINE The texture width and height's minimum supported value is 2048. The texture depth's minimum supported value is 256.
 
-			// @DOCLINE Once this function is finished, the pointer to the data (`data`) is no longer held onto.
+			// @DOCLINE Once this function is finished, the pointer to the data (`data`) is no longer held onto. `data` can be 0, in which case the texture's pixels are left undefined until they are [updated](#texture-update).
+
+			// @DOCLINE The storage of a texture is fixed once it's created; its type, format, and dimensions cannot be changed, but its pixels can be [updated](#texture-update).
+
+			// @DOCLINE If the texture's downscale filtering is `MUG_TEXTURE_TRILINEAR`, its mipmap levels are generated on the GPU from its pixels. They are regenerated whenever the texture is next rendered after its pixels have been updated.
 
 			// @DOCLINE Every successfully created texture must be [destroyed](#texture-destruction) at some point.
 
@@ -2685,396 +3392,1056 @@ It is likely that [object type modifiers](#object-type-modifiers) would work bet
 			#define mu_gtexture_create(...) mug_gtexture_create(mug_global_context, &mug_global_context->result, __VA_ARGS__)
 			#define mu_gtexture_create_(result, ...) mug_gtexture_create(mug_global_context, result, __VA_ARGS__)
 
-		// @DOCLINE ## Texture destruction
+		// @DOCLINE ## Texture update
 
-			// @DOCLINE Once a texture is successfully created, the function `mug_gtexture_destroy` must be called on it at some point, defined below: @NLNT
-			MUDEF mugTexture mug_gtexture_destroy(mugContext* context, muGraphic gfx, mugTexture tex);
+			// @DOCLINE A rectangular region of a texture's pixels can be updated via the function `mug_gtexture_subimage`, defined below: @NLNT
+			MUDEF void mug_gtexture_subimage(mugContext* context, mugResult* result, muGraphic gfx, mugTexture tex, uint32_m x, uint32_m y, uint32_m layer, uint32_m w, uint32_m h, uint32_m row_stride, muByte* data);
 
-			// @DOCLINE > The macro `mu_gtexture_destroy` is the non-result-checking equivalent.
-			#define mu_gtexture_destroy(...) mug_gtexture_destroy(mug_global_context, __VA_ARGS__)
+			// @DOCLINE `x` and `y` are the coordinates of the top-left pixel of the region, and `w` and `h` are its width and height in pixels. `layer` is the layer of the texture array to update, and must be 0 for non-array textures. If the region is not fully within the texture, the result is set to `MUG_INVALID_TEXTURE_REGION`, and nothing is updated. For block-compressed textures, the region must also be aligned to blocks; `x` and `y` must be multiples of 4, and `w` and `h` must be multiples of 4 unless the region reaches the right or bottom edge of the texture respectively.
 
-	// @DOCLINE # Min/Max supported values
+			// @DOCLINE `data` should point to the region's pixels, in the texture's format, ordered left-to-right and top-to-bottom. `row_stride` is the amount of bytes between the start of each row of `data` (or each row of blocks for block-compressed textures); this allows a region of a larger image to be uploaded without repacking it, by pointing `data` at the region's first pixel and setting `row_stride` to the size of a row of the larger image. A `row_stride` of 0 means that the rows are tightly packed.
 
-		// @DOCLINE mug has several minimums and maximums in regards to several values, such as a texture's width and height. mug's [minimum values](#minimum-supported-values) are constants that are guaranteed to be supported on any system that runs mug successfully. mug's [maximum values](#maximum-supported-values) can differ from device to device, and are retrieved at runtime.
+			// @DOCLINE The pixels are copied into one of a small ring of staging buffers owned by the graphic, and are transferred to the texture from there; this means that the function returns without waiting for the GPU to finish rendering with the texture, and `data` is no longer held onto once the function is finished. Rendering performed before this call uses the old pixels, and rendering performed after it uses the new pixels.
 
-		// @DOCLINE ## Minimum supported values
+			// @DOCLINE > The macro `mu_gtexture_subimage` is the non-result-checking equivalent, and the macro `mu_gtexture_subimage_` is the result-checking equivalent.
+			#define mu_gtexture_subimage(...) mug_gtexture_subimage(mug_global_context, &mug_global_context->result, __VA_ARGS__)
+			#define mu_gtexture_subimage_(result, ...) mug_gtexture_subimage(mug_global_context, result, __VA_ARGS__)
 
-			// @DOCLINE mug defines several macros for minimum values for various parts of mug. If mug is running successfully, these minimums are guaranteed for the system.
+		// @DOCLINE ## Texture array resizing
 
-			// @DOCLINE ### Texture minimum supported values
+			// @DOCLINE The amount of layers of a texture array can be changed via the function `mug_gtexture_resize_layers`, defined below: @NLNT
+			MUDEF void mug_gtexture_resize_layers(mugContext* context, mugResult* result, muGraphic gfx, mugTexture tex, uint32_m depth);
 
-				// @DOCLINE The following macros for minimum values regarding textures are defined:
+			// @DOCLINE The type of `tex` must be `MUG_TEXTURE_2D_ARRAY`, and `depth` must be at least 1 and can't exceed `MUG_MAX_TEXTURE_DEPTH`. The first `depth` layers (or all layers, if growing) keep their pixels, which are copied into the new storage on the GPU without passing through the CPU, and the pixels of any new layers are undefined. The texture handle stays the same, so object buffers using the texture don't need to be updated. If the texture is still [loading](#asynchronous-texture-loading), the result is set to `MUG_TEXTURE_NOT_LOADED`, and nothing is changed. Block-compressed textures with more than one mipmap level can't be resized, as their mipmap levels can't be regenerated, and neither can the texture of a [render target](#render-target); attempting to do either sets the result to `MUG_UNSUPPORTED_TEXTURE_FORMAT`.
 
-				// @DOCLINE * `MUG_MIN_TEXTURE_WIDTH_HEIGHT` - the minimum texture width and height. This value is 1024.
-				#define MUG_MIN_TEXTURE_WIDTH_HEIGHT 1024
+			// @DOCLINE > The macro `mu_gtexture_resize_layers` is the non-result-checking equivalent, and the macro `mu_gtexture_resize_layers_` is the result-checking equivalent.
+			#define mu_gtexture_resize_layers(...) mug_gtexture_resize_layers(mug_global_context, &mug_global_context->result, __VA_ARGS__)
+			#define mu_gtexture_resize_layers_(result, ...) mug_gtexture_resize_layers(mug_global_context, result, __VA_ARGS__)
 
-				// @DOCLINE * `MUG_MIN_TEXTURE_DEPTH` - the minimum texture depth (for texture arrays). This value is 256.
-				#define MUG_MIN_TEXTURE_DEPTH 256
+		// @DOCLINE ## Texture compression
 
-		// @DOCLINE ## Maximum supported values
+			// @DOCLINE The amount of bytes that pixel data of a given format and size takes up can be retrieved via the function `mug_texture_data_size`, defined below: @NLNT
+			MUDEF size_m mug_texture_data_size(mugTextureFormat format, uint32_m w, uint32_m h);
 
-			typedef uint16_m mugMax;
+			// @DOCLINE Uncompressed pixel data can be compressed to some of the [block-compressed formats](#texture-format) on the CPU via the function `mug_texture_compress`, defined below: @NLNT
+			MUDEF void mug_texture_compress(mugContext* context, mugResult* result, mugTextureFormat format, uint32_m w, uint32_m h, uint32_m row_stride, muByte* src, muByte* dst);
 
-			// @DOCLINE mug is able to retrieve maximum values for the current device using the function `mug_max`, defined below: @NLNT
-			MUDEF uint32_m mug_max(mugContext* context, muGraphic gfx, mugMax max);
+			// @DOCLINE `format` is the format to compress to, and can be `MUG_TEXTURE_BC1_RGBA` or `MUG_TEXTURE_BC3_RGBA`, in which case `src` should be `MUG_TEXTURE_U8_RGBA` pixel data, or `MUG_TEXTURE_BC4_R`, in which case `src` should be `MUG_TEXTURE_U8_R` pixel data; any other format sets the result to `MUG_UNSUPPORTED_TEXTURE_FORMAT`. `w` and `h` are the width and height of the image, and `row_stride` is the amount of bytes between the start of each row of `src` (0 meaning that the rows are tightly packed). `dst` should point to at least `mug_texture_data_size(format, w, h)` bytes.
 
-			// @DOCLINE `max` is a value specifying what maximum is being requested; values for the type `mugMax` are defined below. If `max` is an unrecognized value, 0 is returned.
+			// @DOCLINE The encoder is built for speed over quality, choosing each block's endpoints from the block's color bounds. Pixels with an alpha value below 128 are encoded as transparent in `MUG_TEXTURE_BC1_RGBA`. Color blocks are encoded using the same SIMD instructions as [texture conversion](#texture-conversion), with the same output either way.
 
-		// @DOCLINE ### Texture maximum supported values
-			// 1 -> 512
+			// @DOCLINE Images of at least 4096 blocks are split into bands of block rows, which are compressed at the same time on up to `MUG_COMPRESS_THREADS` threads (including the calling thread), and this function returns once all bands are done. The amount of threads can be set by defining `MUG_COMPRESS_THREADS` (4 by default, and at least 1) before including the implementation.
+			#ifndef MUG_COMPRESS_THREADS
+				#define MUG_COMPRESS_THREADS 4
+			#endif
+			#if MUG_COMPRESS_THREADS < 1
+				#error MUG_COMPRESS_THREADS must be at least 1
+			#endif
 
-			// @DOCLINE The following macros for maximum values (for the type `mugMax`) regarding textures are defined:
+			// @DOCLINE > The macro `mu_texture_compress` is the non-result-checking equivalent, and the macro `mu_texture_compress_` is the result-checking equivalent.
+			#define mu_texture_compress(...) mug_texture_compress(mug_global_context, &mug_global_context->result, __VA_ARGS__)
+			#define mu_texture_compress_(result, ...) mug_texture_compress(mug_global_context, result, __VA_ARGS__)
 
-			// @DOCLINE * `MUG_MAX_TEXTURE_WIDTH_HEIGHT` - the maximum texture width and height.
-			#define MUG_MAX_TEXTURE_WIDTH_HEIGHT 1
+		// @DOCLINE ## Texture residency
 
-			// @DOCLINE * `MUG_MAX_TEXTURE_DEPTH` - the maximum texture depth (for texture arrays).
-			#define MUG_MAX_TEXTURE_DEPTH 2
+			// @DOCLINE A graphic can be given a budget for how many bytes of texture storage it keeps on the GPU at once. Textures that can be reloaded are then "evictable", meaning that their storage is freed when the graphic is over budget, and reallocated (and reloaded) whenever they're next needed.
 
-	// @DOCLINE # Result
+			// @DOCLINE The budget of a graphic can be set via the function `mug_graphic_texture_budget`, defined below: @NLNT
+			MUDEF void mug_graphic_texture_budget(mugContext* context, muGraphic gfx, size_m budget);
 
-		// @DOCLINE The type `mugResult` (typedef for `uint16_m`) is used to represent how a task in mug went. It has the following defined values:
+			// @DOCLINE `budget` is the amount of bytes allowed, and 0 means that there is no budget (which is the default). Only evictable textures are ever evicted, so a graphic can still go over budget if its non-evictable textures take up more storage than the budget allows.
 
-		// == MUG_... 0-4095 ==
+			// @DOCLINE > The macro `mu_graphic_texture_budget` is the non-result-checking equivalent.
+			#define mu_graphic_texture_budget(...) mug_graphic_texture_budget(mug_global_context, __VA_ARGS__)
 
-		// @DOCLINE * `MUG_SUCCESS` - the task succeeded; real value 0.
-		#define MUG_SUCCESS 0
+			// @DOCLINE A texture is made evictable by giving it a callback used to reload its pixels after it has been evicted, which is defined below: @NLNT
+			typedef void (*mugTextureReload)(mugTexture tex, void* user, muByte* data);
 
-		// @DOCLINE * `MUG_FAILED_MALLOC` - `mu_malloc` returned a failure value, and the task was unable to be completed.
-		#define MUG_FAILED_MALLOC 1
-		// @DOCLINE * `MUG_FAILED_REALLOC` - `mu_realloc` returned a failure value, and the task was unable to be completed.
-		#define MUG_FAILED_REALLOC 2
+			// @DOCLINE `data` points to a buffer of `mug_texture_data_size(format, width, height)` bytes (multiplied by the depth for texture arrays), and the callback is expected to fill it with all of the texture's pixels, laid out the same way as the data given upon [creation](#texture-creation). The buffer is owned by mug, and is no longer valid once the callback returns. Any [updates](#texture-update) made to the texture are lost upon eviction, so the callback should provide the texture's latest pixels.
 
-		// @DOCLINE * `MUG_UNKNOWN_GRAPHIC_SYSTEM` - a `muGraphicSystem` value given by the user was unrecognized. This could happen because support for the requested graphics API was not defined by the user, such as passing `MU_GRAPHIC_OPENGL` without defining `MU_SUPPORT_OPENGL`.
-		#define MUG_UNKNOWN_GRAPHIC_SYSTEM 3
+			// @DOCLINE Textures are evicted in least-recently-used order, based on when they were last rendered, both when the budget is exceeded upon creating or reloading a texture, and at the end of each frame (when [swapping buffers](#swap-graphic-buffers)). A texture rendered in the current frame is never evicted. An evicted texture is reloaded when it's next rendered or updated, which happens synchronously, so reloading should be quick.
 
-		// @DOCLINE * `MUG_UNKNOWN_OBJECT_TYPE` - a `mugObjectType` value given by the user was unrecognized.
-		#define MUG_UNKNOWN_OBJECT_TYPE 4
-		// @DOCLINE * `MUG_UNKNOWN_OBJECT_MOD` - a `mugObjectMod` value given by the user was unrecognized.
-		#define MUG_UNKNOWN_OBJECT_MOD 5
+			// @DOCLINE The reload callback of a texture is set via the function `mug_gtexture_evictable`, defined below: @NLNT
+			MUDEF void mug_gtexture_evictable(mugContext* context, mugResult* result, muGraphic gfx, mugTexture tex, mugTextureReload reload, void* user);
 
-		// == MUG_MUCOSA_... 4096-8191 ==
+			// @DOCLINE `user` is passed to `reload` whenever it's called. A `reload` value of 0 makes the texture non-evictable again. If the texture is evicted at the time of this call, it is reloaded first. Only the full-size level is reloaded, with any other mipmap levels being generated from it, so block-compressed textures with more than one mipmap level (which can only be created from [texture files](#texture-files)) can't be made evictable, and attempting to do so sets the result to `MUG_UNSUPPORTED_TEXTURE_FORMAT`. The same goes for the texture of a [render target](#render-target).
 
-		// @DOCLINE * `MUG_MUCOSA_...` - a muCOSA function was called, which gave a non-success result value, which has been converted to a `mugResult` equivalent. There is a `mugResult` equivalent for any `muCOSAResult` value (besides `MUCOSA_SUCCESS`), and the conditions of the given `muCOSAResult` value apply based on the muCOSA documentation. Note that the value of the muCOSA-equivalent does not necessarily match the value of the mug version.
-			#define MUG_MUCOSA_FAILED_NULL_WINDOW_SYSTEM 4096
-			#define MUG_MUCOSA_FAILED_MALLOC 4097
-			#define MUG_MUCOSA_FAILED_UNKNOWN_WINDOW_ATTRIB 4098
-			#define MUG_MUCOSA_FAILED_REALLOC 4099
-			#define MUG_MUCOSA_FAILED_UNKNOWN_GRAPHICS_API 4100
-			#define MUG_MUCOSA_FAILED_UNSUPPORTED_GRAPHICS_API 4101
-			#define MUG_MUCOSA_WIN32_FAILED_CONVERT_UTF8_TO_WCHAR 4102
-			#define MUG_MUCOSA_WIN32_FAILED_REGISTER_WINDOW_CLASS 4103
-			#define MUG_MUCOSA_WIN32_FAILED_CREATE_WINDOW 4104
-			#define MUG_MUCOSA_WIN32_FAILED_GET_WINDOW_ATTRIB 4105
-			#define MUG_MUCOSA_WIN32_FAILED_SET_WINDOW_ATTRIB 4106
-			#define MUG_MUCOSA_WIN32_FAILED_REGISTER_DUMMY_WGL_WINDOW_CLASS 4107
-			#define MUG_MUCOSA_WIN32_FAILED_CREATE_DUMMY_WGL_WINDOW 4108
-			#define MUG_MUCOSA_WIN32_FAILED_GET_DUMMY_WGL_PIXEL_FORMAT 4109
-			#define MUG_MUCOSA_WIN32_FAILED_DESCRIBE_DUMMY_WGL_PIXEL_FORMAT 4110
-			#define MUG_MUCOSA_WIN32_FAILED_SET_DUMMY_WGL_PIXEL_FORMAT 4111
-			#define MUG_MUCOSA_WIN32_FAILED_CREATE_DUMMY_WGL_CONTEXT 4112
-			#define MUG_MUCOSA_WIN32_FAILED_BIND_DUMMY_WGL_CONTEXT 4113
-			#define MUG_MUCOSA_WIN32_FAILED_FIND_WGL_CREATE_CONTEXT_ATTRIBS 4114
-			#define MUG_MUCOSA_WIN32_FAILED_FIND_WGL_CHOOSE_PIXEL_FORMAT 4115
-			#define MUG_MUCOSA_WIN32_FAILED_CHOOSE_WGL_PIXEL_FORMAT 4116
-			#define MUG_MUCOSA_WIN32_FAILED_GET_WGL_PIXEL_FORMAT 4117
-			#define MUG_MUCOSA_WIN32_FAILED_DESCRIBE_WGL_PIXEL_FORMAT 4118
-			#define MUG_MUCOSA_WIN32_FAILED_SET_WGL_PIXEL_FORMAT 4119
-			#define MUG_MUCOSA_WIN32_FAILED_CREATE_WGL_CONTEXT 4120
-			#define MUG_MUCOSA_WIN32_FAILED_SET_WGL_CONTEXT 4121
-			#define MUG_MUCOSA_WIN32_FAILED_SWAP_WGL_BUFFERS 4122
-			#define MUG_MUCOSA_WIN32_FAILED_FIND_WGL_FUNCTION 4123
-			#define MUG_MUCOSA_WIN32_FAILED_ASSOCIATE_IMM 4124
-			#define MUG_MUCOSA_WIN32_FAILED_SET_COMPOSITION_WINDOW_POSITION 4125
-			#define MUG_MUCOSA_WIN32_FAILED_HOLD_CLIPBOARD 4126
-			#define MUG_MUCOSA_WIN32_FAILED_GET_CLIPBOARD_DATA 4127
-			#define MUG_MUCOSA_WIN32_FAILED_CONVERT_CLIPBOARD_DATA_FORMAT 4128
-			#define MUG_MUCOSA_WIN32_FAILED_ALLOCATE_CLIPBOARD_DATA 4129
-			#define MUG_MUCOSA_WIN32_FAILED_SET_CLIPBOARD_DATA 4130
+			// @DOCLINE > The macro `mu_gtexture_evictable` is the non-result-checking equivalent, and the macro `mu_gtexture_evictable_` is the result-checking equivalent.
+			#define mu_gtexture_evictable(...) mug_gtexture_evictable(mug_global_context, &mug_global_context->result, __VA_ARGS__)
+			#define mu_gtexture_evictable_(result, ...) mug_gtexture_evictable(mug_global_context, result, __VA_ARGS__)
 
-		// == MUG_GL_... 8192-12287 ==
+			// @DOCLINE Statistics about a graphic's texture storage are represented with the struct `mugTextureStats`, which has the following members:
 
-		// @DOCLINE * `MUG_GL_FAILED_LOAD` - the required OpenGL functionality failed to load from the function call to `gladLoadGL`.
-		#define MUG_GL_FAILED_LOAD 8192
+			struct mugTextureStats {
+				// @DOCLINE * `@NLFT resident_bytes` - the amount of bytes of texture storage currently allocated on the GPU (including mipmap levels).
+				size_m resident_bytes;
+				// @DOCLINE * `@NLFT budget` - the graphic's current budget.
+				size_m budget;
+				// @DOCLINE * `@NLFT evictions` - the amount of times that a texture has been evicted.
+				uint32_m evictions;
+				// @DOCLINE * `@NLFT reloads` - the amount of times that an evicted texture has been reloaded.
+				uint32_m reloads;
+			};
+			typedef struct mugTextureStats mugTextureStats;
 
-		// @DOCLINE * `MUG_GL_FAILED_COMPILE_VERTEX_SHADER` - a vertex shader in OpenGL necessary to perform the task failed to compile.
-		#define MUG_GL_FAILED_COMPILE_VERTEX_SHADER 8193
-		// @DOCLINE * `MUG_GL_FAILED_COMPILE_FRAGMENT_SHADER` - a fragment shader in OpenGL necessary to perform the task failed to compile.
-		#define MUG_GL_FAILED_COMPILE_FRAGMENT_SHADER 8194
-		// @DOCLINE * `MUG_GL_FAILED_LINK_SHADERS` - shaders necessary to be linked to a shader program in OpenGL to perform the task failed to link.
-		#define MUG_GL_FAILED_LINK_SHADERS 8195
+			// @DOCLINE The statistics of a graphic can be retrieved via the function `mug_graphic_texture_stats`, defined below: @NLNT
+			MUDEF void mug_graphic_texture_stats(mugContext* context, muGraphic gfx, mugTextureStats* stats);
 
-		// @DOCLINE * `MUG_GL_FAILED_ALLOCATE_BUFFER` - an internal OpenGL buffer needed to perform the task was unable to be allocated to the correct size.
-		#define MUG_GL_FAILED_ALLOCATE_BUFFER 8196
-		// @DOCLINE * `MUG_GL_FAILED_CREATE_BUFFER` - a necessary call to create an OpenGL buffer failed.
-		#define MUG_GL_FAILED_CREATE_BUFFER 8197
-		// @DOCLINE * `MUG_GL_FAILED_CREATE_VERTEX_ARRAY` - a necessary call to create an OpenGL vertex array failed.
-		#define MUG_GL_FAILED_CREATE_VERTEX_ARRAY 8198
+			// @DOCLINE > The macro `mu_graphic_texture_stats` is the non-result-checking equivalent.
+			#define mu_graphic_texture_stats(...) mug_graphic_texture_stats(mug_global_context, __VA_ARGS__)
 
-		// @DOCLINE * `MUG_GL_FAILED_GENERATE_TEXTURE` - a necessary call to generate an OpenGL texture failed.
-		#define MUG_GL_FAILED_GENERATE_TEXTURE 8199
+		// @DOCLINE ## Asynchronous texture loading
 
-		// @DOCLINE All non-success values (unless explicitly stated otherwise) mean that the function fully failed; AKA, it was "fatal", and the library continues as if the function had never been called. So, for example, if something was supposed to be allocated, but the function fatally failed, nothing was allocated.
+			// @DOCLINE A texture can be loaded from an encoded image without stalling rendering, with the image being read, decoded, and transferred to the texture over time while the program keeps rendering.
 
-		// @DOCLINE There are non-fatal failure values, which mean that the function still executed, but not fully to the extent that the user would expect from the function. The function `mug_result_is_fatal` returns whether or not a given result function value is fatal, defined below: @NLNT
-		MUDEF muBool mug_result_is_fatal(mugResult result);
+			// @DOCLINE Where the image is loaded from is described with the struct `mugImageSource`, which has the following members:
 
-		// @DOCLINE This function also considers the fatal status of `mugResult` values representing `muCOSAResult` values.
+			struct mugImageSource {
+				// @DOCLINE * `const char* path` - the path to the image file, or 0 if the image is in memory. The path is copied.
+				const char* path;
+				// @DOCLINE * `@NLFT data` - the encoded image, if `path` is 0. It must remain valid until the texture has finished loading (or is destroyed).
+				muByte* data;
+				// @DOCLINE * `@NLFT size` - the size of `data`, in bytes.
+				size_m size;
+			};
+			typedef struct mugImageSource mugImageSource;
 
-		// @DOCLINE > This function returns `MU_TRUE` if the value of `result` is invalid. It returns `MU_FALSE` if `result` is equal to `MUG_SUCCESS`.
+			// @DOCLINE Once a texture has finished loading (successfully or not), a callback is called, which is defined below: @NLNT
+			typedef void (*mugTextureLoaded)(mugTexture tex, mugResult result, void* user);
 
-		// @DOCLINE ## Result names
-			#ifdef MUG_NAMES
+			// @DOCLINE `tex` is the texture, `result` is the result of loading it, and `user` is the value given when the load was requested. The callback is called during [`mug_graphic_swap_buffers`](#swap-graphic-buffers), on the thread that called it.
 
-			// @DOCLINE The name function `mug_result_get_name` returns a `const char*` representation of the given result value (for example, `MUG_SUCCESS` returns "MUG_SUCCESS"), defined below: @NLNT
-			MUDEF const char* mug_result_get_name(mugResult result);
+			// @DOCLINE A texture is loaded asynchronously via the function `mug_gtexture_load_async`, defined below: @NLNT
+			MUDEF mugTexture mug_gtexture_load_async(mugContext* context, mugResult* result, muGraphic gfx, mugImageSource* source, mugTextureInfo* info, mugTextureLoaded callback, void* user);
 
-			// @DOCLINE It will return "MU_UNKNOWN" in the case that `result` is an invalid result value.
+			// @DOCLINE The returned texture is a placeholder, which can be used like any other texture, but renders as black until it has finished loading. `info` describes how the texture should be stored, and its type must be `MUG_TEXTURE_2D`; the image is converted to `info`'s format once decoded, being compressed on the CPU for the block-compressed formats that [`mug_texture_compress`](#texture-compression) supports. Any other type or format sets the result to `MUG_UNSUPPORTED_TEXTURE_FORMAT`, and 0 is returned. `callback` can be 0.
 
-			// @DOCLINE > This function is a "name" function, and therefore is only defined if `MUG_NAMES` is also defined by the user.
+			// @DOCLINE The image is read and decoded on a pool of worker threads owned by the graphic, which is started when the first texture is loaded asynchronously. Once decoded, it's transferred to the texture through the graphic's [staging buffers](#texture-update) in slices of rows, with a bounded amount of bytes transferred each frame during `mug_graphic_swap_buffers`. The amount of worker threads can be set by defining `MUG_LOAD_THREADS` (2 by default), and the amount of bytes transferred per frame can be set by defining `MUG_LOAD_UPLOAD_BYTES` (1 MiB by default), both before including the implementation.
+			#ifndef MUG_LOAD_THREADS
+				#define MUG_LOAD_THREADS 2
+			#endif
+			#ifndef MUG_LOAD_UPLOAD_BYTES
+				#define MUG_LOAD_UPLOAD_BYTES 1048576
 			#endif
 
-		// @DOCLINE ## muCOSA-mug result to muCOSA result
+			// @DOCLINE The built-in decoders support [QOI](https://qoiformat.org/) images, uncompressed TGA images (true-color or grayscale), and binary PPM/PGM images (`P6`/`P5`, with a maximum value of up to 255). If the image can't be read or decoded, the result given to the callback is `MUG_FAILED_DECODE_IMAGE`.
 
-			// @DOCLINE The function `mug_to_muCOSA_result` returns the muCOSA-equivalent of a mug result that represents a `muCOSAResult` value (for example, `MUG_MUCOSA_FAILED_MALLOC` returns `MUCOSA_FAILED_MALLOC`), defined below: @NLNT
-			MUDEF muCOSAResult mug_to_muCOSA_result(mugResult result);
+			// @DOCLINE If loading fails, the texture remains a placeholder. The texture can't be [updated](#texture-update) or made [evictable](#texture-residency) until it has finished loading successfully, and attempting to do so sets the result to `MUG_TEXTURE_NOT_LOADED`. Destroying the texture before it has finished loading cancels the load, and its callback is never called.
 
-			// @DOCLINE This function returns `MUG_SUCCESS`/`MUCOSA_SUCCESS` (same value) if no muCOSA equivalent exists for the given `mugResult` value.
+			// @DOCLINE > The macro `mu_gtexture_load_async` is the non-result-checking equivalent, and the macro `mu_gtexture_load_async_` is the result-checking equivalent.
+			#define mu_gtexture_load_async(...) mug_gtexture_load_async(mug_global_context, &mug_global_context->result, __VA_ARGS__)
+			#define mu_gtexture_load_async_(result, ...) mug_gtexture_load_async(mug_global_context, result, __VA_ARGS__)
 
-		// @DOCLINE ## muCOSA result to mug result
+			// @DOCLINE Other image formats can be supported by giving a graphic a decoder, which is tried before the built-in decoders. The decoder is defined below: @NLNT
+			typedef muByte* (*mugImageDecoder)(void* user, muByte* data, size_m size, uint32_m* dim);
 
-			// @DOCLINE The function `muCOSA_to_mug_result` returns the mug-equivalent of a muCOSA result value (for example, `MUCOSA_FAILED_MALLOC` returns `MUG_MUCOSA_FAILED_MALLOC`), defined below: @NLNT
-			MUDEF mugResult muCOSA_to_mug_result(muCOSAResult result);
+			// @DOCLINE `data` and `size` are the encoded image. If the decoder recognizes the image, it should set `dim[0]` and `dim[1]` to its width and height, and return its pixels as `MUG_TEXTURE_U8_RGBA` pixel data allocated with `mu_malloc`, which mug frees once done with it. Otherwise, it should return 0, in which case the built-in decoders are tried. The decoder is called on the worker threads, and thus must be thread-safe.
 
-			// @DOCLINE This function returns `MUG_SUCCESS`/`MUCOSA_SUCCESS` (same value) if no mug equivalent exists for the given `muCOSAResult` value, rather because the given `muCOSAResult` value is invalid or is equal to `MUCOSA_SUCCESS`.
+			// @DOCLINE The decoder of a graphic is set via the function `mug_graphic_image_decoder`, defined below: @NLNT
+			MUDEF void mug_graphic_image_decoder(mugContext* context, muGraphic gfx, mugImageDecoder decoder, void* user);
 
-	// @DOCLINE # C standard library dependencies
+			// @DOCLINE `user` is passed to `decoder` whenever it's called. A `decoder` value of 0 removes the decoder. Loads requested before this call keep using the decoder that was set when they were requested.
 
-		// @DOCLINE mug has several C standard library dependencies, all of which are overridable by defining them before the inclusion of its header. The following is a list of those dependencies.
+			// @DOCLINE > The macro `mu_graphic_image_decoder` is the non-result-checking equivalent.
+			#define mu_graphic_image_decoder(...) mug_graphic_image_decoder(mug_global_context, __VA_ARGS__)
 
-		#if !defined(mu_sinf) || \
-			!defined(mu_cosf)
+			// @DOCLINE The built-in decoders can also be used directly via the function `mug_image_decode`, defined below: @NLNT
+			MUDEF muByte* mug_image_decode(mugContext* context, mugResult* result, muByte* data, size_m size, uint32_m* dim);
 
-			// @DOCLINE ## `math.h` dependencies
-			#include <math.h>
+			// @DOCLINE `data` and `size` are the encoded image. Upon success, `dim[0]` and `dim[1]` are set to the image's width and height, and its pixels are returned as `MUG_TEXTURE_U8_RGBA` pixel data allocated with `mu_malloc`, which the user is responsible for freeing with `mu_free`. Upon failure, the result is set to `MUG_FAILED_DECODE_IMAGE`, and 0 is returned.
 
-			// @DOCLINE * `mu_sinf` - equivalent to `sinf`.
-			#ifndef mu_sinf
-				#define mu_sinf sinf
-			#endif
+			// @DOCLINE > The macro `mu_image_decode` is the non-result-checking equivalent, and the macro `mu_image_decode_` is the result-checking equivalent.
+			#define mu_image_decode(...) mug_image_decode(mug_global_context, &mug_global_context->result, __VA_ARGS__)
+			#define mu_image_decode_(result, ...) mug_image_decode(mug_global_context, result, __VA_ARGS__)
 
-			// @DOCLINE * `mu_cosf` - equivalent to `cosf`.
-			#ifndef mu_cosf
-				#define mu_cosf cosf
-			#endif
+		// @DOCLINE ## Texture files
 
-		#endif /* math.h */
+			// @DOCLINE mug defines a simple container format for textures, `.mugtex`, which stores a texture's info and dimensions along with its pixel data, already in the texture's format and ready to be transferred to the GPU. Loading one involves no decoding or conversion, making it much quicker to load than an encoded image.
 
-	MU_CPP_EXTERN_END
-#endif /* MUG_H */
+			// @DOCLINE A `.mugtex` file begins with a header of 64 bytes, made up of little-endian 32-bit unsigned integers:
 
-// @IGNORE
-#ifdef MUG_IMPLEMENTATION
+			// @DOCLINE * Bytes 0 to 3 - the characters `MUGT`.
+			// @DOCLINE * Bytes 4 to 7 - the version of the format, which is currently 1.
+			// @DOCLINE * Bytes 8 to 35 - the members of the texture's [info](#texture-info), in order (`type`, `format`, `wrapping[0]`, `wrapping[1]`, `filtering[0]`, `filtering[1]`, and `mip_levels`). `convert` isn't stored, as the pixel data should already be converted.
+			// @DOCLINE * Bytes 36 to 47 - the width, height, and depth of the texture, with the depth being 1 for non-array textures.
+			// @DOCLINE * Bytes 48 to 51 - the amount of mipmap levels stored in the file, which is at least 1.
+			// @DOCLINE * Bytes 52 to 63 - reserved, and set to 0.
 
-	#ifdef MU_SUPPORT_OPENGL
-	// glad header and implementation
-	// Changes (implementation):
-	// - Removed space between last extern "C" and the #endif for GLAD_GL_IMPLEMENTATION.
-	#ifndef GLAD_GL_H_
-		#define GLAD_GL_H_
+			// @DOCLINE The header is followed by the pixel data of each stored mipmap level, starting with the full-size texture, and with each level being half the width and height of the previous one (rounded down, but never below 1). The pixel data of each level is laid out the same way as the data given upon [creation](#texture-creation), with each layer of a texture array following the previous one.
+			#define MUG_TEXTURE_FILE_HEADER_SIZE 64
+			#define MUG_TEXTURE_FILE_VERSION 1
 
-		#ifdef __clang__
-		#pragma clang diagnostic push
-		#pragma clang diagnostic ignored "-Wreserved-id-macro"
-		#endif
-		#ifdef __gl_h_
-		  #error OpenGL (gl.h) header already included (API: gl), remove previous include!
-		#endif
-		#define __gl_h_ 1
-		#ifdef __gl3_h_
-		  #error OpenGL (gl3.h) header already included (API: gl), remove previous include!
-		#endif
-		#define __gl3_h_ 1
-		#ifdef __glext_h_
-		  #error OpenGL (glext.h) header already included (API: gl), remove previous include!
-		#endif
-		#define __glext_h_ 1
-		#ifdef __gl3ext_h_
-		  #error OpenGL (gl3ext.h) header already included (API: gl), remove previous include!
-		#endif
-		#define __gl3ext_h_ 1
-		#ifdef __clang__
-		#pragma clang diagnostic pop
-		#endif
+			// @DOCLINE A texture can be created from a `.mugtex` file via the function `mug_gtexture_create_from_file`, defined below: @NLNT
+			MUDEF mugTexture mug_gtexture_create_from_file(mugContext* context, mugResult* result, muGraphic gfx, const char* path);
 
-		#define GLAD_GL
-		#define GLAD_OPTION_GL_HEADER_ONLY
-		#define GLAD_OPTION_GL_LOADER
+			// @DOCLINE The file is memory-mapped, and each stored level is copied from the mapping straight into one of the graphic's [staging buffers](#texture-update) and transferred to the texture from there, without any intermediate copies. If the file can't be opened, the result is set to `MUG_FAILED_ACCESS_FILE`, and if it isn't a valid `.mugtex` file (including if it's too small to hold the pixel data described by its header), the result is set to `MUG_INVALID_TEXTURE_FILE`; in both cases, 0 is returned.
 
-		#ifdef __cplusplus
-		extern "C" {
-		#endif
+			// @DOCLINE If the texture's downscale filtering is `MUG_TEXTURE_TRILINEAR` and the file stores more than one level, the stored levels are used rather than being generated, including for block-compressed formats (which otherwise can't have mipmap levels); the texture is then limited to the levels stored. If only one level is stored, the texture is created the same way as `mug_gtexture_create`, with any other levels being generated.
 
-		#ifndef GLAD_PLATFORM_H_
-		#define GLAD_PLATFORM_H_
+			// @DOCLINE > The macro `mu_gtexture_create_from_file` is the non-result-checking equivalent, and the macro `mu_gtexture_create_from_file_` is the result-checking equivalent.
+			#define mu_gtexture_create_from_file(...) mug_gtexture_create_from_file(mug_global_context, &mug_global_context->result, __VA_ARGS__)
+			#define mu_gtexture_create_from_file_(result, ...) mug_gtexture_create_from_file(mug_global_context, result, __VA_ARGS__)
 
-		#ifndef GLAD_PLATFORM_WIN32
-		  #if defined(_WIN32) || defined(__WIN32__) || defined(WIN32) || defined(__MINGW32__)
-		    #define GLAD_PLATFORM_WIN32 1
-		  #else
-		    #define GLAD_PLATFORM_WIN32 0
-		  #endif
-		#endif
+			// @DOCLINE A `.mugtex` file can be written via the function `mug_texture_file_write`, defined below: @NLNT
+			MUDEF void mug_texture_file_write(mugContext* context, mugResult* result, const char* path, mugTextureInfo* info, uint32_m* dim, uint32_m levels, muByte* data);
 
-		#ifndef GLAD_PLATFORM_APPLE
-		  #ifdef __APPLE__
-		    #define GLAD_PLATFORM_APPLE 1
-		  #else
-		    #define GLAD_PLATFORM_APPLE 0
-		  #endif
-		#endif
+			// @DOCLINE `info` and `dim` are the same as upon [creation](#texture-creation), `levels` is the amount of mipmap levels stored in `data`, and `data` holds their pixel data, laid out as described above. If `levels` is 0 or more than the full amount of mipmap levels for the texture's size, or `info` isn't valid, the result is set to `MUG_INVALID_TEXTURE_FILE`, and if the file can't be written, the result is set to `MUG_FAILED_ACCESS_FILE`.
 
-		#ifndef GLAD_PLATFORM_EMSCRIPTEN
-		  #ifdef __EMSCRIPTEN__
-		    #define GLAD_PLATFORM_EMSCRIPTEN 1
-		  #else
-		    #define GLAD_PLATFORM_EMSCRIPTEN 0
-		  #endif
-		#endif
+			// @DOCLINE The baker in `tools/mugtex_bake.c` converts images to `.mugtex` files from the command line, optionally generating mipmap levels, compressing the pixels, and combining several images into a texture array.
 
-		#ifndef GLAD_PLATFORM_UWP
-		  #if defined(_MSC_VER) && !defined(GLAD_INTERNAL_HAVE_WINAPIFAMILY)
-		    #ifdef __has_include
-		      #if __has_include(<winapifamily.h>)
-		        #define GLAD_INTERNAL_HAVE_WINAPIFAMILY 1
-		      #endif
-		    #elif _MSC_VER >= 1700 && !_USING_V110_SDK71_
-		      #define GLAD_INTERNAL_HAVE_WINAPIFAMILY 1
-		    #endif
-		  #endif
+			// @DOCLINE > The macro `mu_texture_file_write` is the non-result-checking equivalent, and the macro `mu_texture_file_write_` is the result-checking equivalent.
+			#define mu_texture_file_write(...) mug_texture_file_write(mug_global_context, &mug_global_context->result, __VA_ARGS__)
+			#define mu_texture_file_write_(result, ...) mug_texture_file_write(mug_global_context, result, __VA_ARGS__)
 
-		  #ifdef GLAD_INTERNAL_HAVE_WINAPIFAMILY
-		    #include <winapifamily.h>
-		    #if !WINAPI_FAMILY_PARTITION(WINAPI_PARTITION_DESKTOP) && WINAPI_FAMILY_PARTITION(WINAPI_PARTITION_APP)
-		      #define GLAD_PLATFORM_UWP 1
-		    #endif
-		  #endif
+		// @DOCLINE ## Texture destruction
 
-		  #ifndef GLAD_PLATFORM_UWP
-		    #define GLAD_PLATFORM_UWP 0
-		  #endif
-		#endif
+			// @DOCLINE Once a texture is successfully created, the function `mug_gtexture_destroy` must be called on it at some point, defined below: @NLNT
+			MUDEF mugTexture mug_gtexture_destroy(mugContext* context, muGraphic gfx, mugTexture tex);
 
-		#ifdef __GNUC__
-		  #define GLAD_GNUC_EXTENSION __extension__
-		#else
-		  #define GLAD_GNUC_EXTENSION
-		#endif
+			// @DOCLINE > The macro `mu_gtexture_destroy` is the non-result-checking equivalent.
+			#define mu_gtexture_destroy(...) mug_gtexture_destroy(mug_global_context, __VA_ARGS__)
 
-		#define GLAD_UNUSED(x) (void)(x)
+	// @DOCLINE # Atlas
 
-		#ifndef GLAD_API_CALL
-		  #if defined(GLAD_API_CALL_EXPORT)
-		    #if GLAD_PLATFORM_WIN32 || defined(__CYGWIN__)
-		      #if defined(GLAD_API_CALL_EXPORT_BUILD)
-		        #if defined(__GNUC__)
-		          #define GLAD_API_CALL __attribute__ ((dllexport)) extern
-		        #else
-		          #define GLAD_API_CALL __declspec(dllexport) extern
-		        #endif
-		      #else
-		        #if defined(__GNUC__)
-		          #define GLAD_API_CALL __attribute__ ((dllimport)) extern
-		        #else
-		          #define GLAD_API_CALL __declspec(dllimport) extern
-		        #endif
-		      #endif
-		    #elif defined(__GNUC__) && defined(GLAD_API_CALL_EXPORT_BUILD)
-		      #define GLAD_API_CALL __attribute__ ((visibility ("default"))) extern
-		    #else
-		      #define GLAD_API_CALL extern
-		    #endif
-		  #else
-		    #define GLAD_API_CALL extern
-		  #endif
-		#endif
+		typedef void* mugAtlas;
 
-		#ifdef APIENTRY
-		  #define GLAD_API_PTR APIENTRY
-		#elif GLAD_PLATFORM_WIN32
-		  #define GLAD_API_PTR __stdcall
-		#else
-		  #define GLAD_API_PTR
-		#endif
+		// @DOCLINE An "atlas" in mug is a texture that many smaller images are packed into, so that all of them can be rendered from one texture buffer (and thus in one draw call). Its respective type is `mugAtlas` (typedef for `void*`).
 
-		#ifndef GLAPI
-		#define GLAPI GLAD_API_CALL
-		#endif
+		// @DOCLINE Images are placed into the atlas's texture with a skyline bin packer, which places each image at the lowest position that it fits in, and are uploaded into the texture as they're added.
 
-		#ifndef GLAPIENTRY
-		#define GLAPIENTRY GLAD_API_PTR
-		#endif
+		// @DOCLINE ## Create atlas
 
-		#define GLAD_MAKE_VERSION(major, minor) (major * 10000 + minor)
-		#define GLAD_VERSION_MAJOR(version) (version / 10000)
-		#define GLAD_VERSION_MINOR(version) (version % 10000)
+			// @DOCLINE An atlas can be created via the function `mug_atlas_create`, defined below: @NLNT
+			MUDEF mugAtlas mug_atlas_create(mugContext* context, mugResult* result, muGraphic gfx, mugTextureInfo* info, uint32_m* dim, uint32_m padding);
 
-		#define GLAD_GENERATOR_VERSION "2.0.6"
+			// @DOCLINE `info` and `dim` describe the texture that the atlas owns, and work the same as they do for [texture creation](#texture-creation), except that block-compressed formats aren't supported. The texture type can be `MUG_TEXTURE_2D`, in which case all images are packed into one texture, or `MUG_TEXTURE_2D_ARRAY`, in which case each layer of the texture array is a separate page that images are packed into, with a new page being used once the previous ones are too full to fit an image.
 
-		typedef void (*GLADapiproc)(void);
+			// @DOCLINE `padding` is the amount of pixels reserved around each image, which are filled with the colors of the image's edges; this prevents neighboring images from bleeding into each other when the texture is filtered bilinearly.
 
-		typedef GLADapiproc (*GLADloadfunc)(const char *name);
-		typedef GLADapiproc (*GLADuserptrloadfunc)(void *userptr, const char *name);
+			// @DOCLINE Every atlas that is created must be destroyed before the graphic that was used to create it is destroyed.
 
-		typedef void (*GLADprecallback)(const char *name, GLADapiproc apiproc, int len_args, ...);
-		typedef void (*GLADpostcallback)(void *ret, const char *name, GLADapiproc apiproc, int len_args, ...);
+			// @DOCLINE > The macro `mu_atlas_create` is the non-result-checking equivalent, and the macro `mu_atlas_create_` is the result-checking equivalent.
+			#define mu_atlas_create(...) mug_atlas_create(mug_global_context, &mug_global_context->result, __VA_ARGS__)
+			#define mu_atlas_create_(result, ...) mug_atlas_create(mug_global_context, result, __VA_ARGS__)
 
-		#endif /* GLAD_PLATFORM_H_ */
+		// @DOCLINE ## Destroy atlas
 
-		#define GL_ACTIVE_ATTRIBUTES 0x8B89
-		#define GL_ACTIVE_ATTRIBUTE_MAX_LENGTH 0x8B8A
-		#define GL_ACTIVE_TEXTURE 0x84E0
-		#define GL_ACTIVE_UNIFORMS 0x8B86
-		#define GL_ACTIVE_UNIFORM_BLOCKS 0x8A36
-		#define GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH 0x8A35
-		#define GL_ACTIVE_UNIFORM_MAX_LENGTH 0x8B87
-		#define GL_ALIASED_LINE_WIDTH_RANGE 0x846E
-		#define GL_ALPHA 0x1906
-		#define GL_ALREADY_SIGNALED 0x911A
-		#define GL_ALWAYS 0x0207
-		#define GL_AND 0x1501
-		#define GL_AND_INVERTED 0x1504
-		#define GL_AND_REVERSE 0x1502
-		#define GL_ANY_SAMPLES_PASSED 0x8C2F
-		#define GL_ARRAY_BUFFER 0x8892
-		#define GL_ARRAY_BUFFER_BINDING 0x8894
-		#define GL_ATTACHED_SHADERS 0x8B85
-		#define GL_BACK 0x0405
-		#define GL_BACK_LEFT 0x0402
-		#define GL_BACK_RIGHT 0x0403
-		#define GL_BGR 0x80E0
-		#define GL_BGRA 0x80E1
-		#define GL_BGRA_INTEGER 0x8D9B
-		#define GL_BGR_INTEGER 0x8D9A
-		#define GL_BLEND 0x0BE2
-		#define GL_BLEND_COLOR 0x8005
-		#define GL_BLEND_DST 0x0BE0
-		#define GL_BLEND_DST_ALPHA 0x80CA
-		#define GL_BLEND_DST_RGB 0x80C8
-		#define GL_BLEND_EQUATION 0x8009
-		#define GL_BLEND_EQUATION_ALPHA 0x883D
-		#define GL_BLEND_EQUATION_RGB 0x8009
-		#define GL_BLEND_SRC 0x0BE1
-		#define GL_BLEND_SRC_ALPHA 0x80CB
-		#define GL_BLEND_SRC_RGB 0x80C9
-		#define GL_BLUE 0x1905
-		#define GL_BLUE_INTEGER 0x8D96
-		#define GL_BOOL 0x8B56
-		#define GL_BOOL_VEC2 0x8B57
-		#define GL_BOOL_VEC3 0x8B58
-		#define GL_BOOL_VEC4 0x8B59
-		#define GL_BUFFER_ACCESS 0x88BB
-		#define GL_BUFFER_ACCESS_FLAGS 0x911F
+			// @DOCLINE An atlas (along with its texture) can be destroyed via the function `mug_atlas_destroy`, defined below: @NLNT
+			MUDEF mugAtlas mug_atlas_destroy(mugContext* context, muGraphic gfx, mugAtlas atlas);
+
+			// @DOCLINE This function returns 0.
+
+			// @DOCLINE > The macro `mu_atlas_destroy` is the non-result-checking equivalent.
+			#define mu_atlas_destroy(...) mug_atlas_destroy(mug_global_context, __VA_ARGS__)
+
+		// @DOCLINE ## Add image to atlas
+
+			// @DOCLINE An image can be added to an atlas via the function `mug_atlas_add`, defined below: @NLNT
+			MUDEF muBool mug_atlas_add(mugContext* context, mugResult* result, muGraphic gfx, mugAtlas atlas, uint32_m w, uint32_m h, uint32_m row_stride, muByte* data, float* tex_pos, float* tex_dim);
+
+			// @DOCLINE `w` and `h` are the width and height of the image, and `data` and `row_stride` are its pixels, in the atlas's texture format, laid out the same way as they are for [texture updates](#texture-update).
+
+			// @DOCLINE On success, the [texture cutout](#texture-cutout) of the image within the atlas's texture is written to `tex_pos` and `tex_dim`, which can be copied directly into the `tex_pos` and `tex_dim` members of a `mug2DTextureRect` (or a `mug2DTextureArrayRect` if the atlas is a texture array, in which case `tex_pos` must have room for three floats, with the third one being set to the page that the image was placed in), and `MU_TRUE` is returned.
+
+			// @DOCLINE If there isn't enough free space left in the atlas to fit the image, the result is set to `MUG_ATLAS_FULL`, and `MU_FALSE` is returned.
+
+			// @DOCLINE > The macro `mu_atlas_add` is the non-result-checking equivalent, and the macro `mu_atlas_add_` is the result-checking equivalent.
+			#define mu_atlas_add(...) mug_atlas_add(mug_global_context, &mug_global_context->result, __VA_ARGS__)
+			#define mu_atlas_add_(result, ...) mug_atlas_add(mug_global_context, result, __VA_ARGS__)
+
+		// @DOCLINE ## Clear atlas
+
+			// @DOCLINE All images of an atlas can be removed via the function `mug_atlas_clear`, defined below: @NLNT
+			MUDEF void mug_atlas_clear(mugContext* context, muGraphic gfx, mugAtlas atlas);
+
+			// @DOCLINE This frees up all of the atlas's space for new images; the pixels of the texture are left as they are until they're overwritten by new images.
+
+			// @DOCLINE > The macro `mu_atlas_clear` is the non-result-checking equivalent.
+			#define mu_atlas_clear(...) mug_atlas_clear(mug_global_context, __VA_ARGS__)
+
+		// @DOCLINE ## Get atlas texture
+
+			// @DOCLINE The texture of an atlas can be retrieved via the function `mug_atlas_texture`, defined below: @NLNT
+			MUDEF mugTexture mug_atlas_texture(mugContext* context, muGraphic gfx, mugAtlas atlas);
+
+			// @DOCLINE The texture is owned by the atlas, and must not be destroyed by the user.
+
+			// @DOCLINE > The macro `mu_atlas_texture` is the non-result-checking equivalent.
+			#define mu_atlas_texture(...) mug_atlas_texture(mug_global_context, __VA_ARGS__)
+
+	// @DOCLINE # Texture pool
+
+		typedef void* mugTexturePool;
+
+		// @DOCLINE A "texture pool" in mug is a texture array that many images of the same size and format are placed into, one image per layer, so that all of them can be rendered from one texture buffer (and thus in one draw call). Its respective type is `mugTexturePool` (typedef for `void*`).
+
+		// @DOCLINE Unlike an [atlas](#atlas), images don't need to be packed, and the layers of removed images are reused by images added afterwards. Once every layer is in use, the texture array grows to twice as many layers, with the existing layers being copied over on the GPU via [texture array resizing](#texture-array-resizing).
+
+		// @DOCLINE ## Create texture pool
+
+			// @DOCLINE A texture pool can be created via the function `mug_pool_create`, defined below: @NLNT
+			MUDEF mugTexturePool mug_pool_create(mugContext* context, mugResult* result, muGraphic gfx, mugTextureInfo* info, uint32_m* dim);
+
+			// @DOCLINE `info` describes the texture that the pool owns, and works the same as it does for [texture creation](#texture-creation), except that the texture type is always `MUG_TEXTURE_2D_ARRAY`. `dim` should be a pointer to an array of three `uint32_m`s, which are the width and height of every image in the pool, and the amount of layers that the texture array initially has room for (0 being treated as 1).
+
+			// @DOCLINE Every texture pool that is created must be destroyed before the graphic that was used to create it is destroyed.
+
+			// @DOCLINE > The macro `mu_pool_create` is the non-result-checking equivalent, and the macro `mu_pool_create_` is the result-checking equivalent.
+			#define mu_pool_create(...) mug_pool_create(mug_global_context, &mug_global_context->result, __VA_ARGS__)
+			#define mu_pool_create_(result, ...) mug_pool_create(mug_global_context, result, __VA_ARGS__)
+
+		// @DOCLINE ## Destroy texture pool
+
+			// @DOCLINE A texture pool (along with its texture) can be destroyed via the function `mug_pool_destroy`, defined below: @NLNT
+			MUDEF mugTexturePool mug_pool_destroy(mugContext* context, muGraphic gfx, mugTexturePool pool);
+
+			// @DOCLINE This function returns 0.
+
+			// @DOCLINE > The macro `mu_pool_destroy` is the non-result-checking equivalent.
+			#define mu_pool_destroy(...) mug_pool_destroy(mug_global_context, __VA_ARGS__)
+
+		// @DOCLINE ## Add image to texture pool
+
+			// @DOCLINE An image can be added to a texture pool via the function `mug_pool_add`, defined below: @NLNT
+			MUDEF uint32_m mug_pool_add(mugContext* context, mugResult* result, muGraphic gfx, mugTexturePool pool, uint32_m row_stride, muByte* data);
+
+			// @DOCLINE `data` and `row_stride` are the pixels of the image, in the pool's texture format, laid out the same way as they are for [texture updates](#texture-update). On success, the layer that the image was placed in is returned, which can be used directly as the third value of `tex_pos` of a `mug2DTextureArrayRect`.
+
+			// @DOCLINE If the texture array can't grow any further, the result is set to `MUG_TEXTURE_POOL_FULL`, and `MUG_TEXTURE_POOL_NONE` is returned.
+			#define MUG_TEXTURE_POOL_NONE 0xFFFFFFFF
+
+			// @DOCLINE > The macro `mu_pool_add` is the non-result-checking equivalent, and the macro `mu_pool_add_` is the result-checking equivalent.
+			#define mu_pool_add(...) mug_pool_add(mug_global_context, &mug_global_context->result, __VA_ARGS__)
+			#define mu_pool_add_(result, ...) mug_pool_add(mug_global_context, result, __VA_ARGS__)
+
+		// @DOCLINE ## Remove image from texture pool
+
+			// @DOCLINE An image can be removed from a texture pool via the function `mug_pool_remove`, defined below: @NLNT
+			MUDEF void mug_pool_remove(mugContext* context, muGraphic gfx, mugTexturePool pool, uint32_m layer);
+
+			// @DOCLINE `layer` should be a layer returned by `mug_pool_add`; removing any other layer, or a layer that has already been removed, does nothing. The layer's pixels are left as they are until it's reused by another image, and the texture array never shrinks.
+
+			// @DOCLINE > The macro `mu_pool_remove` is the non-result-checking equivalent.
+			#define mu_pool_remove(...) mug_pool_remove(mug_global_context, __VA_ARGS__)
+
+		// @DOCLINE ## Get texture pool texture
+
+			// @DOCLINE The texture of a texture pool can be retrieved via the function `mug_pool_texture`, defined below: @NLNT
+			MUDEF mugTexture mug_pool_texture(mugContext* context, muGraphic gfx, mugTexturePool pool);
+
+			// @DOCLINE The texture is owned by the pool, and must not be destroyed by the user. It stays the same when the pool grows, so it only needs to be set as the texture of an object buffer once.
+
+			// @DOCLINE > The macro `mu_pool_texture` is the non-result-checking equivalent.
+			#define mu_pool_texture(...) mug_pool_texture(mug_global_context, __VA_ARGS__)
+
+	// @DOCLINE # Virtual texture
+
+		typedef void* mugVirtualTexture;
+
+		// @DOCLINE A "virtual texture" in mug is an image too large to fit in a single texture (or in memory at all), which is split into fixed-size square tiles that are loaded on demand as they become visible. Its respective type is `mugVirtualTexture` (typedef for `void*`).
+
+		// @DOCLINE The image is stored at several levels of detail, with level 0 being the image at full size, and each level after it being half the width and height of the previous one (rounded up), until the level fits within a single tile. Resident tiles are kept in a "page cache", a `MUG_TEXTURE_2D_ARRAY` texture with one tile per layer, and an indirection table keeps track of which layer (if any) each tile of each level is stored in. Once the page cache is full, the least-recently-visible tiles are replaced with new ones, so the amount of texture memory that a virtual texture uses is fixed regardless of the size of the image.
+
+		// @DOCLINE ## Tile loader
+
+			// @DOCLINE Tiles are requested from the user through a callback of type `mugTileLoader`, defined below: @NLNT
+			typedef muBool (*mugTileLoader)(void* user, uint32_m level, uint32_m x, uint32_m y, uint32_m w, uint32_m h, muByte* pixels);
+
+			// @DOCLINE `level` is the level of detail of the tile, and `x` and `y` are the column and row of the tile within that level. `pixels` points to a buffer of `mug_texture_data_size(format, tile_size, tile_size)` bytes, which should be filled with the tile's pixels, laid out as a tightly-packed image of `tile_size` by `tile_size` pixels. Tiles on the right and bottom edges of a level can reach past the level's edges, in which case `w` and `h` are the width and height of the part of the tile within the level, and only that part needs to be filled (for uncompressed formats, mug extends the edge pixels of the filled part for filtering).
+
+			// @DOCLINE The callback is called from within [drawing](#draw-virtual-texture), and should return `MU_TRUE` if it filled the buffer, or `MU_FALSE` if the tile isn't available yet (for example, while the user reads it from disk on another thread), in which case the tile is requested again on later draws for as long as it's visible.
+
+		// @DOCLINE ## Virtual texture info
+
+			// @DOCLINE The information about a virtual texture is described by the struct `mugVirtualTextureInfo`, which has the following members:
+
+			struct mugVirtualTextureInfo {
+				// @DOCLINE * `@NLFT format` - the [format](#texture-format) of the tiles.
+				mugTextureFormat format;
+				// @DOCLINE * `@NLFT filtering[2]` - the [filtering](#texture-filtering) of the tiles, with `filtering[0]` being for upscaling and `filtering[1]` being for downscaling. Trilinear filtering is treated as bilinear filtering, as the levels of detail take the place of mipmaps.
+				mugTextureFiltering filtering[2];
+				// @DOCLINE * `@NLFT dim[2]` - the width and height of the full image, in pixels, which aren't limited by `MUG_MAX_TEXTURE_WIDTH_HEIGHT`.
+				uint32_m dim[2];
+				// @DOCLINE * `@NLFT tile_size` - the width and height of each tile, in pixels. For block-compressed formats, this must be a multiple of the block width.
+				uint32_m tile_size;
+				// @DOCLINE * `@NLFT cache_tiles` - the amount of tiles that the page cache can hold, which must be at least 2 and can't exceed `MUG_MAX_TEXTURE_DEPTH`. The page cache should be able to hold every tile visible at once; for a graphic of width `w` and height `h`, that's at most `(2*w/tile_size + 2) * (2*h/tile_size + 2)` tiles, plus one for the lowest level. If it can't, the visible tiles that don't fit are drawn at a lower level of detail.
+				uint32_m cache_tiles;
+				// @DOCLINE * `@NLFT upload_tiles` - the maximum amount of tiles loaded and uploaded per draw, which keeps the cost of streaming in tiles bounded per frame. 0 means a default of `MUG_VTEXTURE_UPLOAD_TILES`.
+				uint32_m upload_tiles;
+				// @DOCLINE * `@NLFT loader` - the [tile loader](#tile-loader) that tiles are requested from.
+				mugTileLoader loader;
+				// @DOCLINE * `@NLFT user` - the user pointer passed to `loader`.
+				void* user;
+			};
+			typedef struct mugVirtualTextureInfo mugVirtualTextureInfo;
+
+			// @DOCLINE The default amount of tiles uploaded per draw is defined as `MUG_VTEXTURE_UPLOAD_TILES`, which is 4 by default, and can be overridden by defining it before including mug.
+			#ifndef MUG_VTEXTURE_UPLOAD_TILES
+				#define MUG_VTEXTURE_UPLOAD_TILES 4
+			#endif
+
+		// @DOCLINE ## Create virtual texture
+
+			// @DOCLINE A virtual texture can be created via the function `mug_vtexture_create`, defined below: @NLNT
+			MUDEF mugVirtualTexture mug_vtexture_create(mugContext* context, mugResult* result, muGraphic gfx, mugVirtualTextureInfo* info);
+
+			// @DOCLINE No tiles are loaded upon creation. If `info` is invalid, the result is set to `MUG_INVALID_VIRTUAL_TEXTURE`, and 0 is returned.
+
+			// @DOCLINE Every virtual texture that is created must be destroyed before the graphic that was used to create it is destroyed.
+
+			// @DOCLINE > The macro `mu_vtexture_create` is the non-result-checking equivalent, and the macro `mu_vtexture_create_` is the result-checking equivalent.
+			#define mu_vtexture_create(...) mug_vtexture_create(mug_global_context, &mug_global_context->result, __VA_ARGS__)
+			#define mu_vtexture_create_(result, ...) mug_vtexture_create(mug_global_context, result, __VA_ARGS__)
+
+		// @DOCLINE ## Destroy virtual texture
+
+			// @DOCLINE A virtual texture (along with its page cache) can be destroyed via the function `mug_vtexture_destroy`, defined below: @NLNT
+			MUDEF mugVirtualTexture mug_vtexture_destroy(mugContext* context, muGraphic gfx, mugVirtualTexture vtex);
+
+			// @DOCLINE This function returns 0.
+
+			// @DOCLINE > The macro `mu_vtexture_destroy` is the non-result-checking equivalent.
+			#define mu_vtexture_destroy(...) mug_vtexture_destroy(mug_global_context, __VA_ARGS__)
+
+		// @DOCLINE ## Draw virtual texture
+
+			// @DOCLINE A virtual texture can be [drawn immediately](#immediate-drawing) via the function `mug_vtexture_draw`, defined below: @NLNT
+			MUDEF void mug_vtexture_draw(mugContext* context, mugResult* result, muGraphic gfx, mugVirtualTexture vtex, float* rect);
+
+			// @DOCLINE `rect` should be a pointer to an array of four floats, which are the x- and y-coordinates of the top-left corner of the area that the full image is stretched over and its width and height, in pixels; panning and zooming is done by moving and resizing this area, which can reach far past the edges of the graphic.
+
+			// @DOCLINE The level of detail is picked so that each pixel of the graphic covers between one and two pixels of the level, and only the tiles of that level within the part of the area visible on the graphic are drawn, each as a [2D texture array rect](#2d-texture-array-rect) with a z-coordinate of 0 in a single batch. Missing tiles are requested from the [tile loader](#tile-loader), starting with the tile of the lowest level and then the visible tiles closest to the center of the graphic, until `upload_tiles` tiles have been uploaded. Visible tiles that still aren't resident are drawn using the closest lower level whose tile covering them is resident, with the tile of the lowest level (which is never replaced once loaded) acting as the final fallback, so the image is always drawn at the highest level of detail available.
+
+			// @DOCLINE Tiles are filtered independently, so filtering doesn't blend pixels across the edges of tiles. As visibility is calculated from the dimensions of the graphic, [object type modifiers](#object-type-modifiers) of `MUG_OBJECT_TEXTURE_2D_ARRAY` should be left as their defaults while drawing virtual textures.
+
+			// @DOCLINE > The macro `mu_vtexture_draw` is the non-result-checking equivalent, and the macro `mu_vtexture_draw_` is the result-checking equivalent.
+			#define mu_vtexture_draw(...) mug_vtexture_draw(mug_global_context, &mug_global_context->result, __VA_ARGS__)
+			#define mu_vtexture_draw_(result, ...) mug_vtexture_draw(mug_global_context, result, __VA_ARGS__)
+
+		// @DOCLINE ## Missing tiles
+
+			// @DOCLINE The amount of tiles that were visible but not resident (and were thus drawn at a lower level of detail) in the last draw of a virtual texture can be retrieved via the function `mug_vtexture_missing`, defined below: @NLNT
+			MUDEF uint32_m mug_vtexture_missing(mugContext* context, muGraphic gfx, mugVirtualTexture vtex);
+
+			// @DOCLINE This can be used to keep rendering frames while tiles are still streaming in, and to idle once the view is complete.
+
+			// @DOCLINE > The macro `mu_vtexture_missing` is the non-result-checking equivalent.
+			#define mu_vtexture_missing(...) mug_vtexture_missing(mug_global_context, __VA_ARGS__)
+
+	// @DOCLINE # Render target
+
+		typedef void* mugTarget;
+
+		// @DOCLINE A "render target" in mug is a texture that can be rendered to in place of the graphic, which allows something expensive to render but rarely changing (such as a complex static panel) to be rendered once and then drawn each frame as a single texture rect until it changes. Its respective type is `mugTarget` (typedef for `void*`).
+
+		// @DOCLINE ## Create render target
+
+			// @DOCLINE A render target can be created via the function `mug_gtarget_create`, defined below: @NLNT
+			MUDEF mugTarget mug_gtarget_create(mugContext* context, mugResult* result, muGraphic gfx, uint32_m* dim, muBool depth);
+
+			// @DOCLINE `dim` should be a pointer to an array of two `uint32_m`s, which are the width and height of the render target in pixels, and can't exceed `MUG_MAX_TEXTURE_WIDTH_HEIGHT`. `depth` is whether or not the render target has a depth buffer, which is only needed if the objects rendered to it rely on their z-coordinates to be drawn over one another. If the render target's framebuffer can't be created, the result is set to `MUG_GL_FAILED_CREATE_FRAMEBUFFER`, and 0 is returned.
+
+			// @DOCLINE Render targets are pooled per graphic: a destroyed render target is kept rather than freed, and is reused by the next render target created with the same width, height, and `depth`, so layers that are recreated whenever they change don't reallocate GPU memory each time. The pixels of a reused render target are undefined until it's [rendered to](#render-to-render-target).
+
+			// @DOCLINE Every render target that is created must be destroyed before the graphic that was used to create it is destroyed.
+
+			// @DOCLINE > The macro `mu_gtarget_create` is the non-result-checking equivalent, and the macro `mu_gtarget_create_` is the result-checking equivalent.
+			#define mu_gtarget_create(...) mug_gtarget_create(mug_global_context, &mug_global_context->result, __VA_ARGS__)
+			#define mu_gtarget_create_(result, ...) mug_gtarget_create(mug_global_context, result, __VA_ARGS__)
+
+		// @DOCLINE ## Destroy render target
+
+			// @DOCLINE A render target can be destroyed via the function `mug_gtarget_destroy`, defined below: @NLNT
+			MUDEF mugTarget mug_gtarget_destroy(mugContext* context, muGraphic gfx, mugTarget target);
+
+			// @DOCLINE This function returns 0. The render target must not be being rendered to, and its texture must not be used afterwards.
+
+			// @DOCLINE > The macro `mu_gtarget_destroy` is the non-result-checking equivalent.
+			#define mu_gtarget_destroy(...) mug_gtarget_destroy(mug_global_context, __VA_ARGS__)
+
+		// @DOCLINE ## Render target pool
+
+			// @DOCLINE The maximum amount of destroyed render targets that a graphic keeps for reuse can be set via the function `mug_graphic_target_pool`, defined below: @NLNT
+			MUDEF void mug_graphic_target_pool(mugContext* context, muGraphic gfx, uint32_m count);
+
+			// @DOCLINE Once the pool is full, the render target destroyed longest ago is freed to make room for another. A `count` of 0 disables pooling. Pooled render targets past `count` are freed immediately, and all of them are freed once the graphic is destroyed. By default, a graphic keeps up to `MUG_TARGET_POOL_COUNT` render targets.
+			#define MUG_TARGET_POOL_COUNT 4
+
+			// @DOCLINE > The macro `mu_graphic_target_pool` is the non-result-checking equivalent.
+			#define mu_graphic_target_pool(...) mug_graphic_target_pool(mug_global_context, __VA_ARGS__)
+
+		// @DOCLINE ## Get render target texture
+
+			// @DOCLINE The texture of a render target can be retrieved via the function `mug_gtarget_texture`, defined below: @NLNT
+			MUDEF mugTexture mug_gtarget_texture(mugContext* context, muGraphic gfx, mugTarget target);
+
+			// @DOCLINE The texture is a `MUG_TEXTURE_2D` texture of the format `MUG_TEXTURE_U8_RGBA`, wrapped with `MUG_TEXTURE_CLAMP` and filtered with `MUG_TEXTURE_BILINEAR`, and can be drawn the same as any other texture (such as by setting it as the texture of a `MUG_OBJECT_TEXTURE_2D` object buffer), with the [texture cutout](#texture-cutout) of position (0, 0) and dimensions (1, 1) covering the entire render target upright. The texture is owned by the render target, and must not be destroyed by the user. Its storage is attached to the render target, so it can't be made [evictable](#texture-residency) or [resized](#texture-array-resizing), and attempting to do so sets the result to `MUG_UNSUPPORTED_TEXTURE_FORMAT`.
+
+			// @DOCLINE > The macro `mu_gtarget_texture` is the non-result-checking equivalent.
+			#define mu_gtarget_texture(...) mug_gtarget_texture(mug_global_context, __VA_ARGS__)
+
+		// @DOCLINE ## Render to render target
+
+			// @DOCLINE Rendering can be redirected to a render target via the function `mug_graphic_begin_target`, defined below: @NLNT
+			MUDEF void mug_graphic_begin_target(mugContext* context, mugResult* result, muGraphic gfx, mugTarget target);
+
+			// @DOCLINE Everything rendered afterwards (via object buffers, immediate drawing, or scenes) is drawn onto the render target rather than the graphic, with positions being in the render target's pixels with a top-left origin, until the function `mug_graphic_end_target` is called, defined below: @NLNT
+			MUDEF void mug_graphic_end_target(mugContext* context, muGraphic gfx);
+
+			// @DOCLINE `mug_graphic_begin_target` clears the render target to fully transparent pixels, and calling `mug_graphic_clear` while rendering to a render target clears it to the given color instead of clearing the graphic. Colors drawn over transparent parts of a render target are stored multiplied by their alpha, so translucent parts of it appear darker once drawn; clearing it to an opaque color first avoids this. If another render target is being rendered to, rendering to it is ended first. A render target's texture can't be drawn while rendering to that same render target.
+
+			// @DOCLINE `mug_graphic_end_target` returns rendering to the graphic (within the damaged area, if [partial redraw](#partial-redraw) is enabled). As the render target's texture has changed, the entire graphic is considered damaged and in need of being redrawn. If rendering to a render target hasn't ended once `mug_graphic_swap_buffers` is called, it's ended automatically.
+
+			// @DOCLINE > The macro `mu_graphic_begin_target` is the non-result-checking equivalent, and the macro `mu_graphic_begin_target_` is the result-checking equivalent.
+			#define mu_graphic_begin_target(...) mug_graphic_begin_target(mug_global_context, &mug_global_context->result, __VA_ARGS__)
+			#define mu_graphic_begin_target_(result, ...) mug_graphic_begin_target(mug_global_context, result, __VA_ARGS__)
+
+			// @DOCLINE > The macro `mu_graphic_end_target` is the non-result-checking equivalent.
+			#define mu_graphic_end_target(...) mug_graphic_end_target(mug_global_context, __VA_ARGS__)
+
+	// @DOCLINE # GPU memory
+
+		// @DOCLINE mug keeps track of how many bytes of GPU memory each graphic holds, counting the storage allocated for every resource that it creates on the GPU. The amount is calculated from the sizes of the resources as requested from the graphics API, so the memory actually used by the driver may differ slightly (for example, due to alignment).
+
+		// @DOCLINE ## Memory usage
+
+			// @DOCLINE The memory held by a kind of resource is represented by the struct `mugMemoryUsage`, which has the following members:
+
+			struct mugMemoryUsage {
+				// @DOCLINE * `@NLFT count` - the amount of resources that currently exist.
+				uint32_m count;
+				// @DOCLINE * `@NLFT bytes` - the amount of bytes that the resources hold (their capacity).
+				size_m bytes;
+				// @DOCLINE * `@NLFT used` - the amount of those bytes in use, as described for each kind of resource below.
+				size_m used;
+			};
+			typedef struct mugMemoryUsage mugMemoryUsage;
+
+		// @DOCLINE ## Memory report
+
+			// @DOCLINE The memory held by a graphic is represented by the struct `mugMemoryReport`, which has the following members:
+
+			struct mugMemoryReport {
+				// @DOCLINE * `@NLFT objects` - the memory of [object buffers](#object-buffers), indexed by object type (with the element at index 0 being unused). Each object buffer holds the vertex data (and index data, if used) of all of its objects, all of which is in use.
+				mugMemoryUsage objects[MUG_OBJECT_LAST+1];
+				// @DOCLINE * `@NLFT immediate` - the memory of the buffers used for [immediate drawing](#immediate-drawing), of which one exists per object type drawn so far. Each buffer grows to fit the largest batch drawn, and what's in use is the data of the objects drawn to it in the last frame that it was drawn to.
+				mugMemoryUsage immediate;
+				// @DOCLINE * `@NLFT textures` - the storage of [textures](#texture) (including those of [render targets](#render-target)), counting every mipmap level and layer. Evicted textures, and textures still being loaded asynchronously, hold no storage and aren't counted. What's in use is the storage of the full-size level of each layer, with the rest being taken up by the remaining mipmap levels.
+				mugMemoryUsage textures;
+				// @DOCLINE * `@NLFT texture_layers` - the amount of layers that the counted textures have in total, with non-array textures having one layer.
+				uint32_m texture_layers;
+				// @DOCLINE * `@NLFT renderbuffers` - the memory of the depth buffers of render targets, as well as the color and depth buffers kept for [partial redraw](#partial-redraw), each estimated as 4 bytes per pixel per sample, all of which is in use.
+				mugMemoryUsage renderbuffers;
+				// @DOCLINE * `@NLFT staging` - the memory of buffers used to transfer pixels to and from textures, all of which is in use.
+				mugMemoryUsage staging;
+				// @DOCLINE * `@NLFT total` - the amount of bytes held by every resource above.
+				size_m total;
+				// @DOCLINE * `@NLFT peak` - the highest that `total` has been since the graphic was created (its high-water mark).
+				size_m peak;
+			};
+			typedef struct mugMemoryReport mugMemoryReport;
+
+			// @DOCLINE The memory report of a graphic can be retrieved via the function `mug_graphic_memory_report`, defined below: @NLNT
+			MUDEF void mug_graphic_memory_report(mugContext* context, muGraphic gfx, mugMemoryReport* report);
+
+			// @DOCLINE As the report is kept up to date as resources are created, resized, and destroyed, retrieving it takes no more than copying it. An object buffer count that keeps growing over time is a sign of object buffers not being destroyed.
+
+			// @DOCLINE > The macro `mu_graphic_memory_report` is the non-result-checking equivalent.
+			#define mu_graphic_memory_report(...) mug_graphic_memory_report(mug_global_context, __VA_ARGS__)
+
+		// @DOCLINE ## Memory threshold
+
+			// @DOCLINE A graphic can be given a threshold of how many bytes of GPU memory it's expected to hold at most, along with a callback that's called once the total amount held goes over the threshold, which is defined below: @NLNT
+			typedef void (*mugMemoryCallback)(muGraphic gfx, void* user, mugMemoryReport* report);
+
+			// @DOCLINE `report` is the graphic's memory report at the time of the call. The threshold of a graphic is set via the function `mug_graphic_memory_threshold`, defined below: @NLNT
+			MUDEF void mug_graphic_memory_threshold(mugContext* context, muGraphic gfx, size_m threshold, mugMemoryCallback callback, void* user);
+
+			// @DOCLINE `user` is passed to `callback` whenever it's called. A `threshold` value of 0 means that there is no threshold (which is the default). Rather than being called in the middle of whatever went over the threshold, the callback is called once the graphic's buffers are next [swapped](#swap-graphic-buffers), so it can safely call mug functions regarding the graphic. It's called only once per crossing, and isn't called again until the total has gone back to or under the threshold and over it once more. If the total is already over the threshold when it's set, the callback is called upon the next swap.
+
+			// @DOCLINE > The macro `mu_graphic_memory_threshold` is the non-result-checking equivalent.
+			#define mu_graphic_memory_threshold(...) mug_graphic_memory_threshold(mug_global_context, __VA_ARGS__)
+
+	// @DOCLINE # Min/Max supported values
+
+		// @DOCLINE mug has several minimums and maximums in regards to several values, such as a texture's width and height. mug's [minimum values](#minimum-supported-values) are constants that are guaranteed to be supported on any system that runs mug successfully. mug's [maximum values](#maximum-supported-values) can differ from device to device, and are retrieved at runtime.
+
+		// @DOCLINE ## Minimum supported values
+
+			// @DOCLINE mug defines several macros for minimum values for various parts of mug. If mug is running successfully, these minimums are guaranteed for the system.
+
+			// @DOCLINE ### Texture minimum supported values
+
+				// @DOCLINE The following macros for minimum values regarding textures are defined:
+
+				// @DOCLINE * `MUG_MIN_TEXTURE_WIDTH_HEIGHT` - the minimum texture width and height. This value is 1024.
+				#define MUG_MIN_TEXTURE_WIDTH_HEIGHT 1024
+
+				// @DOCLINE * `MUG_MIN_TEXTURE_DEPTH` - the minimum texture depth (for texture arrays). This value is 256.
+				#define MUG_MIN_TEXTURE_DEPTH 256
+
+		// @DOCLINE ## Maximum supported values
+
+			typedef uint16_m mugMax;
+
+			// @DOCLINE mug is able to retrieve maximum values for the current device using the function `mug_max`, defined below: @NLNT
+			MUDEF uint32_m mug_max(mugContext* context, muGraphic gfx, mugMax max);
+
+			// @DOCLINE `max` is a value specifying what maximum is being requested; values for the type `mugMax` are defined below. If `max` is an unrecognized value, 0 is returned.
+
+		// @DOCLINE ### Texture maximum supported values
+			// 1 -> 512
+
+			// @DOCLINE The following macros for maximum values (for the type `mugMax`) regarding textures are defined:
+
+			// @DOCLINE * `MUG_MAX_TEXTURE_WIDTH_HEIGHT` - the maximum texture width and height.
+			#define MUG_MAX_TEXTURE_WIDTH_HEIGHT 1
+
+			// @DOCLINE * `MUG_MAX_TEXTURE_DEPTH` - the maximum texture depth (for texture arrays).
+			#define MUG_MAX_TEXTURE_DEPTH 2
+
+			// @DOCLINE * `MUG_MAX_TEXTURE_FORMATS` - a bitmask of the [texture formats](#texture-format) supported by the device, where the format `f` is supported if the bit `1 << f` is set.
+			#define MUG_MAX_TEXTURE_FORMATS 3
+
+	// @DOCLINE # Result
+
+		// @DOCLINE The type `mugResult` (typedef for `uint16_m`) is used to represent how a task in mug went. It has the following defined values:
+
+		// == MUG_... 0-4095 ==
+
+		// @DOCLINE * `MUG_SUCCESS` - the task succeeded; real value 0.
+		#define MUG_SUCCESS 0
+
+		// @DOCLINE * `MUG_FAILED_MALLOC` - `mu_malloc` (or the context's [allocator](#allocator)) returned a failure value, and the task was unable to be completed.
+		#define MUG_FAILED_MALLOC 1
+		// @DOCLINE * `MUG_FAILED_REALLOC` - `mu_realloc` (or the context's [allocator](#allocator)) returned a failure value, and the task was unable to be completed.
+		#define MUG_FAILED_REALLOC 2
+
+		// @DOCLINE * `MUG_UNKNOWN_GRAPHIC_SYSTEM` - a `muGraphicSystem` value given by the user was unrecognized. This could happen because support for the requested graphics API was not defined by the user, such as passing `MU_GRAPHIC_OPENGL` without defining `MU_SUPPORT_OPENGL`.
+		#define MUG_UNKNOWN_GRAPHIC_SYSTEM 3
+
+		// @DOCLINE * `MUG_UNKNOWN_OBJECT_TYPE` - a `mugObjectType` value given by the user was unrecognized.
+		#define MUG_UNKNOWN_OBJECT_TYPE 4
+		// @DOCLINE * `MUG_UNKNOWN_OBJECT_MOD` - a `mugObjectMod` value given by the user was unrecognized.
+		#define MUG_UNKNOWN_OBJECT_MOD 5
+		// @DOCLINE * `MUG_INVALID_SCENE_OBJECT` - a `mugSceneObject` handle given by the user does not refer to an object within the scene.
+		#define MUG_INVALID_SCENE_OBJECT 6
+		// @DOCLINE * `MUG_NO_SPATIAL_INDEX` - the task required the given object buffer to have a [spatial index](#spatial-index), which it doesn't have.
+		#define MUG_NO_SPATIAL_INDEX 7
+		// @DOCLINE * `MUG_INVALID_TEXTURE_REGION` - a region of a texture given by the user is not fully within the texture's bounds.
+		#define MUG_INVALID_TEXTURE_REGION 8
+		// @DOCLINE * `MUG_ATLAS_FULL` - an [atlas](#atlas) doesn't have enough free space left to fit the given image.
+		#define MUG_ATLAS_FULL 9
+		// @DOCLINE * `MUG_UNSUPPORTED_TEXTURE_FORMAT` - a [texture format](#texture-format) given by the user isn't supported for the task, such as a block-compressed format that the device doesn't support.
+		#define MUG_UNSUPPORTED_TEXTURE_FORMAT 10
+		// @DOCLINE * `MUG_FAILED_DECODE_IMAGE` - an image [loaded asynchronously](#asynchronous-texture-loading) couldn't be read, or isn't in a format that any available decoder recognizes.
+		#define MUG_FAILED_DECODE_IMAGE 11
+		// @DOCLINE * `MUG_TEXTURE_NOT_LOADED` - the task required a texture that is still being [loaded asynchronously](#asynchronous-texture-loading), or that failed to load.
+		#define MUG_TEXTURE_NOT_LOADED 12
+		// @DOCLINE * `MUG_FAILED_CREATE_THREAD` - a worker thread could not be created.
+		#define MUG_FAILED_CREATE_THREAD 13
+		// @DOCLINE * `MUG_FAILED_ACCESS_FILE` - a file could not be opened, read, or written.
+		#define MUG_FAILED_ACCESS_FILE 14
+		// @DOCLINE * `MUG_INVALID_TEXTURE_FILE` - a [texture file](#texture-files) is invalid, or the texture given to be written to one is.
+		#define MUG_INVALID_TEXTURE_FILE 15
+		// @DOCLINE * `MUG_INVALID_VIRTUAL_TEXTURE` - the [information of a virtual texture](#virtual-texture-info) given by the user is invalid.
+		#define MUG_INVALID_VIRTUAL_TEXTURE 16
+		// @DOCLINE * `MUG_TEXTURE_POOL_FULL` - a [texture pool](#texture-pool) has no free layers left, and its texture array can't grow any further.
+		#define MUG_TEXTURE_POOL_FULL 17
+		// @DOCLINE * `MUG_UNSUPPORTED_PRESENT_MODE` - the device doesn't support setting the requested [present mode](#present-mode).
+		#define MUG_UNSUPPORTED_PRESENT_MODE 18
+
+		// == MUG_MUCOSA_... 4096-8191 ==
+
+		// @DOCLINE * `MUG_MUCOSA_...` - a muCOSA function was called, which gave a non-success result value, which has been converted to a `mugResult` equivalent. There is a `mugResult` equivalent for any `muCOSAResult` value (besides `MUCOSA_SUCCESS`), and the conditions of the given `muCOSAResult` value apply based on the muCOSA documentation. Note that the value of the muCOSA-equivalent does not necessarily match the value of the mug version.
+			#define MUG_MUCOSA_FAILED_NULL_WINDOW_SYSTEM 4096
+			#define MUG_MUCOSA_FAILED_MALLOC 4097
+			#define MUG_MUCOSA_FAILED_UNKNOWN_WINDOW_ATTRIB 4098
+			#define MUG_MUCOSA_FAILED_REALLOC 4099
+			#define MUG_MUCOSA_FAILED_UNKNOWN_GRAPHICS_API 4100
+			#define MUG_MUCOSA_FAILED_UNSUPPORTED_GRAPHICS_API 4101
+			#define MUG_MUCOSA_WIN32_FAILED_CONVERT_UTF8_TO_WCHAR 4102
+			#define MUG_MUCOSA_WIN32_FAILED_REGISTER_WINDOW_CLASS 4103
+			#define MUG_MUCOSA_WIN32_FAILED_CREATE_WINDOW 4104
+			#define MUG_MUCOSA_WIN32_FAILED_GET_WINDOW_ATTRIB 4105
+			#define MUG_MUCOSA_WIN32_FAILED_SET_WINDOW_ATTRIB 4106
+			#define MUG_MUCOSA_WIN32_FAILED_REGISTER_DUMMY_WGL_WINDOW_CLASS 4107
+			#define MUG_MUCOSA_WIN32_FAILED_CREATE_DUMMY_WGL_WINDOW 4108
+			#define MUG_MUCOSA_WIN32_FAILED_GET_DUMMY_WGL_PIXEL_FORMAT 4109
+			#define MUG_MUCOSA_WIN32_FAILED_DESCRIBE_DUMMY_WGL_PIXEL_FORMAT 4110
+			#define MUG_MUCOSA_WIN32_FAILED_SET_DUMMY_WGL_PIXEL_FORMAT 4111
+			#define MUG_MUCOSA_WIN32_FAILED_CREATE_DUMMY_WGL_CONTEXT 4112
+			#define MUG_MUCOSA_WIN32_FAILED_BIND_DUMMY_WGL_CONTEXT 4113
+			#define MUG_MUCOSA_WIN32_FAILED_FIND_WGL_CREATE_CONTEXT_ATTRIBS 4114
+			#define MUG_MUCOSA_WIN32_FAILED_FIND_WGL_CHOOSE_PIXEL_FORMAT 4115
+			#define MUG_MUCOSA_WIN32_FAILED_CHOOSE_WGL_PIXEL_FORMAT 4116
+			#define MUG_MUCOSA_WIN32_FAILED_GET_WGL_PIXEL_FORMAT 4117
+			#define MUG_MUCOSA_WIN32_FAILED_DESCRIBE_WGL_PIXEL_FORMAT 4118
+			#define MUG_MUCOSA_WIN32_FAILED_SET_WGL_PIXEL_FORMAT 4119
+			#define MUG_MUCOSA_WIN32_FAILED_CREATE_WGL_CONTEXT 4120
+			#define MUG_MUCOSA_WIN32_FAILED_SET_WGL_CONTEXT 4121
+			#define MUG_MUCOSA_WIN32_FAILED_SWAP_WGL_BUFFERS 4122
+			#define MUG_MUCOSA_WIN32_FAILED_FIND_WGL_FUNCTION 4123
+			#define MUG_MUCOSA_WIN32_FAILED_ASSOCIATE_IMM 4124
+			#define MUG_MUCOSA_WIN32_FAILED_SET_COMPOSITION_WINDOW_POSITION 4125
+			#define MUG_MUCOSA_WIN32_FAILED_HOLD_CLIPBOARD 4126
+			#define MUG_MUCOSA_WIN32_FAILED_GET_CLIPBOARD_DATA 4127
+			#define MUG_MUCOSA_WIN32_FAILED_CONVERT_CLIPBOARD_DATA_FORMAT 4128
+			#define MUG_MUCOSA_WIN32_FAILED_ALLOCATE_CLIPBOARD_DATA 4129
+			#define MUG_MUCOSA_WIN32_FAILED_SET_CLIPBOARD_DATA 4130
+
+		// == MUG_GL_... 8192-12287 ==
+
+		// @DOCLINE * `MUG_GL_FAILED_LOAD` - the required OpenGL functionality failed to load from the function call to `gladLoadGL`.
+		#define MUG_GL_FAILED_LOAD 8192
+
+		// @DOCLINE * `MUG_GL_FAILED_COMPILE_VERTEX_SHADER` - a vertex shader in OpenGL necessary to perform the task failed to compile.
+		#define MUG_GL_FAILED_COMPILE_VERTEX_SHADER 8193
+		// @DOCLINE * `MUG_GL_FAILED_COMPILE_FRAGMENT_SHADER` - a fragment shader in OpenGL necessary to perform the task failed to compile.
+		#define MUG_GL_FAILED_COMPILE_FRAGMENT_SHADER 8194
+		// @DOCLINE * `MUG_GL_FAILED_LINK_SHADERS` - shaders necessary to be linked to a shader program in OpenGL to perform the task failed to link.
+		#define MUG_GL_FAILED_LINK_SHADERS 8195
+
+		// @DOCLINE * `MUG_GL_FAILED_ALLOCATE_BUFFER` - an internal OpenGL buffer needed to perform the task was unable to be allocated to the correct size.
+		#define MUG_GL_FAILED_ALLOCATE_BUFFER 8196
+		// @DOCLINE * `MUG_GL_FAILED_CREATE_BUFFER` - a necessary call to create an OpenGL buffer failed.
+		#define MUG_GL_FAILED_CREATE_BUFFER 8197
+		// @DOCLINE * `MUG_GL_FAILED_CREATE_VERTEX_ARRAY` - a necessary call to create an OpenGL vertex array failed.
+		#define MUG_GL_FAILED_CREATE_VERTEX_ARRAY 8198
+
+		// @DOCLINE * `MUG_GL_FAILED_GENERATE_TEXTURE` - a necessary call to generate an OpenGL texture failed.
+		#define MUG_GL_FAILED_GENERATE_TEXTURE 8199
+
+		// @DOCLINE * `MUG_GL_FAILED_CREATE_FRAMEBUFFER` - a necessary OpenGL framebuffer failed to be created or is incomplete.
+		#define MUG_GL_FAILED_CREATE_FRAMEBUFFER 8200
+
+		// @DOCLINE All non-success values (unless explicitly stated otherwise) mean that the function fully failed; AKA, it was "fatal", and the library continues as if the function had never been called. So, for example, if something was supposed to be allocated, but the function fatally failed, nothing was allocated.
+
+		// @DOCLINE There are non-fatal failure values, which mean that the function still executed, but not fully to the extent that the user would expect from the function. The function `mug_result_is_fatal` returns whether or not a given result function value is fatal, defined below: @NLNT
+		MUDEF muBool mug_result_is_fatal(mugResult result);
+
+		// @DOCLINE This function also considers the fatal status of `mugResult` values representing `muCOSAResult` values.
+
+		// @DOCLINE > This function returns `MU_TRUE` if the value of `result` is invalid. It returns `MU_FALSE` if `result` is equal to `MUG_SUCCESS`.
+
+		// @DOCLINE ## Result names
+			#ifdef MUG_NAMES
+
+			// @DOCLINE The name function `mug_result_get_name` returns a `const char*` representation of the given result value (for example, `MUG_SUCCESS` returns "MUG_SUCCESS"), defined below: @NLNT
+			MUDEF const char* mug_result_get_name(mugResult result);
+
+			// @DOCLINE It will return "MU_UNKNOWN" in the case that `result` is an invalid result value.
+
+			// @DOCLINE > This function is a "name" function, and therefore is only defined if `MUG_NAMES` is also defined by the user.
+			#endif
+
+		// @DOCLINE ## muCOSA-mug result to muCOSA result
+
+			// @DOCLINE The function `mug_to_muCOSA_result` returns the muCOSA-equivalent of a mug result that represents a `muCOSAResult` value (for example, `MUG_MUCOSA_FAILED_MALLOC` returns `MUCOSA_FAILED_MALLOC`), defined below: @NLNT
+			MUDEF muCOSAResult mug_to_muCOSA_result(mugResult result);
+
+			// @DOCLINE This function returns `MUG_SUCCESS`/`MUCOSA_SUCCESS` (same value) if no muCOSA equivalent exists for the given `mugResult` value.
+
+		// @DOCLINE ## muCOSA result to mug result
+
+			// @DOCLINE The function `muCOSA_to_mug_result` returns the mug-equivalent of a muCOSA result value (for example, `MUCOSA_FAILED_MALLOC` returns `MUG_MUCOSA_FAILED_MALLOC`), defined below: @NLNT
+			MUDEF mugResult muCOSA_to_mug_result(muCOSAResult result);
+
+			// @DOCLINE This function returns `MUG_SUCCESS`/`MUCOSA_SUCCESS` (same value) if no mug equivalent exists for the given `muCOSAResult` value, rather because the given `muCOSAResult` value is invalid or is equal to `MUCOSA_SUCCESS`.
+
+	// @DOCLINE # C standard library dependencies
+
+		// @DOCLINE mug has several C standard library dependencies, all of which are overridable by defining them before the inclusion of its header. The following is a list of those dependencies.
+
+		#if !defined(mu_sinf) || \
+			!defined(mu_cosf) || \
+			!defined(mu_sqrtf) || \
+			!defined(mu_powf)
+
+			// @DOCLINE ## `math.h` dependencies
+			#include <math.h>
+
+			// @DOCLINE * `mu_sinf` - equivalent to `sinf`.
+			#ifndef mu_sinf
+				#define mu_sinf sinf
+			#endif
+
+			// @DOCLINE * `mu_cosf` - equivalent to `cosf`.
+			#ifndef mu_cosf
+				#define mu_cosf cosf
+			#endif
+
+			// @DOCLINE * `mu_sqrtf` - equivalent to `sqrtf`.
+			#ifndef mu_sqrtf
+				#define mu_sqrtf sqrtf
+			#endif
+
+			// @DOCLINE * `mu_powf` - equivalent to `powf`.
+			#ifndef mu_powf
+				#define mu_powf powf
+			#endif
+
+		#endif /* math.h */
+
+		#if !defined(mu_qsort)
+
+			// @DOCLINE ## `stdlib.h` dependencies
+			#include <stdlib.h>
+
+			// @DOCLINE * `mu_qsort` - equivalent to `qsort`.
+			#ifndef mu_qsort
+				#define mu_qsort qsort
+			#endif
+
+		#endif /* stdlib.h */
+
+		#if !defined(mu_memmove)
+
+			// @DOCLINE ## `string.h` dependencies
+			#include <string.h>
+
+			// @DOCLINE * `mu_memmove` - equivalent to `memmove`.
+			#ifndef mu_memmove
+				#define mu_memmove memmove
+			#endif
+
+		#endif /* string.h */
+
+		#if !defined(mu_fopen) || \
+			!defined(mu_fread) || \
+			!defined(mu_fwrite) || \
+			!defined(mu_fclose)
+
+			// @DOCLINE ## `stdio.h` dependencies
+			#include <stdio.h>
+
+			// @DOCLINE * `mu_fopen` - equivalent to `fopen`.
+			#ifndef mu_fopen
+				#define mu_fopen fopen
+			#endif
+
+			// @DOCLINE * `mu_fread` - equivalent to `fread`.
+			#ifndef mu_fread
+				#define mu_fread fread
+			#endif
+
+			// @DOCLINE * `mu_fwrite` - equivalent to `fwrite`.
+			#ifndef mu_fwrite
+				#define mu_fwrite fwrite
+			#endif
+
+			// @DOCLINE * `mu_fclose` - equivalent to `fclose`.
+			#ifndef mu_fclose
+				#define mu_fclose fclose
+			#endif
+
+		#endif /* stdio.h */
+
+	MU_CPP_EXTERN_END
+#endif /* MUG_H */
+
+// @IGNORE
+#ifdef MUG_IMPLEMENTATION
+
+	#ifdef MU_SUPPORT_OPENGL
+	// glad header and implementation
+	// Changes (implementation):
+	// - Removed space between last extern "C" and the #endif for GLAD_GL_IMPLEMENTATION.
+	#ifndef GLAD_GL_H_
+		#define GLAD_GL_H_
+
+		#ifdef __clang__
+		#pragma clang diagnostic push
+		#pragma clang diagnostic ignored "-Wreserved-id-macro"
+		#endif
+		#ifdef __gl_h_
+		  #error OpenGL (gl.h) header already included (API: gl), remove previous include!
+		#endif
+		#define __gl_h_ 1
+		#ifdef __gl3_h_
+		  #error OpenGL (gl3.h) header already included (API: gl), remove previous include!
+		#endif
+		#define __gl3_h_ 1
+		#ifdef __glext_h_
+		  #error OpenGL (glext.h) header already included (API: gl), remove previous include!
+		#endif
+		#define __glext_h_ 1
+		#ifdef __gl3ext_h_
+		  #error OpenGL (gl3ext.h) header already included (API: gl), remove previous include!
+		#endif
+		#define __gl3ext_h_ 1
+		#ifdef __clang__
+		#pragma clang diagnostic pop
+		#endif
+
+		#define GLAD_GL
+		#define GLAD_OPTION_GL_HEADER_ONLY
+		#define GLAD_OPTION_GL_LOADER
+
+		#ifdef __cplusplus
+		extern "C" {
+		#endif
+
+		#ifndef GLAD_PLATFORM_H_
+		#define GLAD_PLATFORM_H_
+
+		#ifndef GLAD_PLATFORM_WIN32
+		  #if defined(_WIN32) || defined(__WIN32__) || defined(WIN32) || defined(__MINGW32__)
+		    #define GLAD_PLATFORM_WIN32 1
+		  #else
+		    #define GLAD_PLATFORM_WIN32 0
+		  #endif
+		#endif
+
+		#ifndef GLAD_PLATFORM_APPLE
+		  #ifdef __APPLE__
+		    #define GLAD_PLATFORM_APPLE 1
+		  #else
+		    #define GLAD_PLATFORM_APPLE 0
+		  #endif
+		#endif
+
+		#ifndef GLAD_PLATFORM_EMSCRIPTEN
+		  #ifdef __EMSCRIPTEN__
+		    #define GLAD_PLATFORM_EMSCRIPTEN 1
+		  #else
+		    #define GLAD_PLATFORM_EMSCRIPTEN 0
+		  #endif
+		#endif
+
+		#ifndef GLAD_PLATFORM_UWP
+		  #if defined(_MSC_VER) && !defined(GLAD_INTERNAL_HAVE_WINAPIFAMILY)
+		    #ifdef __has_include
+		      #if __has_include(<winapifamily.h>)
+		        #define GLAD_INTERNAL_HAVE_WINAPIFAMILY 1
+		      #endif
+		    #elif _MSC_VER >= 1700 && !_USING_V110_SDK71_
+		      #define GLAD_INTERNAL_HAVE_WINAPIFAMILY 1
+		    #endif
+		  #endif
+
+		  #ifdef GLAD_INTERNAL_HAVE_WINAPIFAMILY
+		    #include <winapifamily.h>
+		    #if !WINAPI_FAMILY_PARTITION(WINAPI_PARTITION_DESKTOP) && WINAPI_FAMILY_PARTITION(WINAPI_PARTITION_APP)
+		      #define GLAD_PLATFORM_UWP 1
+		    #endif
+		  #endif
+
+		  #ifndef GLAD_PLATFORM_UWP
+		    #define GLAD_PLATFORM_UWP 0
+		  #endif
+		#endif
+
+		#ifdef __GNUC__
+		  #define GLAD_GNUC_EXTENSION __extension__
+		#else
+		  #define GLAD_GNUC_EXTENSION
+		#endif
+
+		#define GLAD_UNUSED(x) (void)(x)
+
+		#ifndef GLAD_API_CALL
+		  #if defined(GLAD_API_CALL_EXPORT)
+		    #if GLAD_PLATFORM_WIN32 || defined(__CYGWIN__)
+		      #if defined(GLAD_API_CALL_EXPORT_BUILD)
+		        #if defined(__GNUC__)
+		          #define GLAD_API_CALL __attribute__ ((dllexport)) extern
+		        #else
+		          #define GLAD_API_CALL __declspec(dllexport) extern
+		        #endif
+		      #else
+		        #if defined(__GNUC__)
+		          #define GLAD_API_CALL __attribute__ ((dllimport)) extern
+		        #else
+		          #define GLAD_API_CALL __declspec(dllimport) extern
+		        #endif
+		      #endif
+		    #elif defined(__GNUC__) && defined(GLAD_API_CALL_EXPORT_BUILD)
+		      #define GLAD_API_CALL __attribute__ ((visibility ("default"))) extern
+		    #else
+		      #define GLAD_API_CALL extern
+		    #endif
+		  #else
+		    #define GLAD_API_CALL extern
+		  #endif
+		#endif
+
+		#ifdef APIENTRY
+		  #define GLAD_API_PTR APIENTRY
+		#elif GLAD_PLATFORM_WIN32
+		  #define GLAD_API_PTR __stdcall
+		#else
+		  #define GLAD_API_PTR
+		#endif
+
+		#ifndef GLAPI
+		#define GLAPI GLAD_API_CALL
+		#endif
+
+		#ifndef GLAPIENTRY
+		#define GLAPIENTRY GLAD_API_PTR
+		#endif
+
+		#define GLAD_MAKE_VERSION(major, minor) (major * 10000 + minor)
+		#define GLAD_VERSION_MAJOR(version) (version / 10000)
+		#define GLAD_VERSION_MINOR(version) (version % 10000)
+
+		#define GLAD_GENERATOR_VERSION "2.0.6"
+
+		typedef void (*GLADapiproc)(void);
+
+		typedef GLADapiproc (*GLADloadfunc)(const char *name);
+		typedef GLADapiproc (*GLADuserptrloadfunc)(void *userptr, const char *name);
+
+		typedef void (*GLADprecallback)(const char *name, GLADapiproc apiproc, int len_args, ...);
+		typedef void (*GLADpostcallback)(void *ret, const char *name, GLADapiproc apiproc, int len_args, ...);
+
+		#endif /* GLAD_PLATFORM_H_ */
+
+		#define GL_ACTIVE_ATTRIBUTES 0x8B89
+		#define GL_ACTIVE_ATTRIBUTE_MAX_LENGTH 0x8B8A
+		#define GL_ACTIVE_TEXTURE 0x84E0
+		#define GL_ACTIVE_UNIFORMS 0x8B86
+		#define GL_ACTIVE_UNIFORM_BLOCKS 0x8A36
+		#define GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH 0x8A35
+		#define GL_ACTIVE_UNIFORM_MAX_LENGTH 0x8B87
+		#define GL_ALIASED_LINE_WIDTH_RANGE 0x846E
+		#define GL_ALPHA 0x1906
+		#define GL_ALREADY_SIGNALED 0x911A
+		#define GL_ALWAYS 0x0207
+		#define GL_AND 0x1501
+		#define GL_AND_INVERTED 0x1504
+		#define GL_AND_REVERSE 0x1502
+		#define GL_ANY_SAMPLES_PASSED 0x8C2F
+		#define GL_ARRAY_BUFFER 0x8892
+		#define GL_ARRAY_BUFFER_BINDING 0x8894
+		#define GL_ATTACHED_SHADERS 0x8B85
+		#define GL_BACK 0x0405
+		#define GL_BACK_LEFT 0x0402
+		#define GL_BACK_RIGHT 0x0403
+		#define GL_BGR 0x80E0
+		#define GL_BGRA 0x80E1
+		#define GL_BGRA_INTEGER 0x8D9B
+		#define GL_BGR_INTEGER 0x8D9A
+		#define GL_BLEND 0x0BE2
+		#define GL_BLEND_COLOR 0x8005
+		#define GL_BLEND_DST 0x0BE0
+		#define GL_BLEND_DST_ALPHA 0x80CA
+		#define GL_BLEND_DST_RGB 0x80C8
+		#define GL_BLEND_EQUATION 0x8009
+		#define GL_BLEND_EQUATION_ALPHA 0x883D
+		#define GL_BLEND_EQUATION_RGB 0x8009
+		#define GL_BLEND_SRC 0x0BE1
+		#define GL_BLEND_SRC_ALPHA 0x80CB
+		#define GL_BLEND_SRC_RGB 0x80C9
+		#define GL_BLUE 0x1905
+		#define GL_BLUE_INTEGER 0x8D96
+		#define GL_BOOL 0x8B56
+		#define GL_BOOL_VEC2 0x8B57
+		#define GL_BOOL_VEC3 0x8B58
+		#define GL_BOOL_VEC4 0x8B59
+		#define GL_BUFFER_ACCESS 0x88BB
+		#define GL_BUFFER_ACCESS_FLAGS 0x911F
 		#define GL_BUFFER_MAPPED 0x88BC
 		#define GL_BUFFER_MAP_LENGTH 0x9120
 		#define GL_BUFFER_MAP_OFFSET 0x9121
@@ -5691,7054 +7058,14955 @@ It is likely that [object type modifiers](#object-type-modifiers) would work bet
 		PFNGLWAITSYNCPROC glad_glWaitSync = NULL;
 
 
-		static void glad_gl_load_GL_VERSION_1_0( GLADuserptrloadfunc load, void* userptr) {
-		    if(!GLAD_GL_VERSION_1_0) return;
-		    glad_glBlendFunc = (PFNGLBLENDFUNCPROC) load(userptr, "glBlendFunc");
-		    glad_glClear = (PFNGLCLEARPROC) load(userptr, "glClear");
-		    glad_glClearColor = (PFNGLCLEARCOLORPROC) load(userptr, "glClearColor");
-		    glad_glClearDepth = (PFNGLCLEARDEPTHPROC) load(userptr, "glClearDepth");
-		    glad_glClearStencil = (PFNGLCLEARSTENCILPROC) load(userptr, "glClearStencil");
-		    glad_glColorMask = (PFNGLCOLORMASKPROC) load(userptr, "glColorMask");
-		    glad_glCullFace = (PFNGLCULLFACEPROC) load(userptr, "glCullFace");
-		    glad_glDepthFunc = (PFNGLDEPTHFUNCPROC) load(userptr, "glDepthFunc");
-		    glad_glDepthMask = (PFNGLDEPTHMASKPROC) load(userptr, "glDepthMask");
-		    glad_glDepthRange = (PFNGLDEPTHRANGEPROC) load(userptr, "glDepthRange");
-		    glad_glDisable = (PFNGLDISABLEPROC) load(userptr, "glDisable");
-		    glad_glDrawBuffer = (PFNGLDRAWBUFFERPROC) load(userptr, "glDrawBuffer");
-		    glad_glEnable = (PFNGLENABLEPROC) load(userptr, "glEnable");
-		    glad_glFinish = (PFNGLFINISHPROC) load(userptr, "glFinish");
-		    glad_glFlush = (PFNGLFLUSHPROC) load(userptr, "glFlush");
-		    glad_glFrontFace = (PFNGLFRONTFACEPROC) load(userptr, "glFrontFace");
-		    glad_glGetBooleanv = (PFNGLGETBOOLEANVPROC) load(userptr, "glGetBooleanv");
-		    glad_glGetDoublev = (PFNGLGETDOUBLEVPROC) load(userptr, "glGetDoublev");
-		    glad_glGetError = (PFNGLGETERRORPROC) load(userptr, "glGetError");
-		    glad_glGetFloatv = (PFNGLGETFLOATVPROC) load(userptr, "glGetFloatv");
-		    glad_glGetIntegerv = (PFNGLGETINTEGERVPROC) load(userptr, "glGetIntegerv");
+		static void glad_gl_load_GL_VERSION_1_0( GLADuserptrloadfunc load, void* userptr) {
+		    if(!GLAD_GL_VERSION_1_0) return;
+		    glad_glBlendFunc = (PFNGLBLENDFUNCPROC) load(userptr, "glBlendFunc");
+		    glad_glClear = (PFNGLCLEARPROC) load(userptr, "glClear");
+		    glad_glClearColor = (PFNGLCLEARCOLORPROC) load(userptr, "glClearColor");
+		    glad_glClearDepth = (PFNGLCLEARDEPTHPROC) load(userptr, "glClearDepth");
+		    glad_glClearStencil = (PFNGLCLEARSTENCILPROC) load(userptr, "glClearStencil");
+		    glad_glColorMask = (PFNGLCOLORMASKPROC) load(userptr, "glColorMask");
+		    glad_glCullFace = (PFNGLCULLFACEPROC) load(userptr, "glCullFace");
+		    glad_glDepthFunc = (PFNGLDEPTHFUNCPROC) load(userptr, "glDepthFunc");
+		    glad_glDepthMask = (PFNGLDEPTHMASKPROC) load(userptr, "glDepthMask");
+		    glad_glDepthRange = (PFNGLDEPTHRANGEPROC) load(userptr, "glDepthRange");
+		    glad_glDisable = (PFNGLDISABLEPROC) load(userptr, "glDisable");
+		    glad_glDrawBuffer = (PFNGLDRAWBUFFERPROC) load(userptr, "glDrawBuffer");
+		    glad_glEnable = (PFNGLENABLEPROC) load(userptr, "glEnable");
+		    glad_glFinish = (PFNGLFINISHPROC) load(userptr, "glFinish");
+		    glad_glFlush = (PFNGLFLUSHPROC) load(userptr, "glFlush");
+		    glad_glFrontFace = (PFNGLFRONTFACEPROC) load(userptr, "glFrontFace");
+		    glad_glGetBooleanv = (PFNGLGETBOOLEANVPROC) load(userptr, "glGetBooleanv");
+		    glad_glGetDoublev = (PFNGLGETDOUBLEVPROC) load(userptr, "glGetDoublev");
+		    glad_glGetError = (PFNGLGETERRORPROC) load(userptr, "glGetError");
+		    glad_glGetFloatv = (PFNGLGETFLOATVPROC) load(userptr, "glGetFloatv");
+		    glad_glGetIntegerv = (PFNGLGETINTEGERVPROC) load(userptr, "glGetIntegerv");
+		    glad_glGetString = (PFNGLGETSTRINGPROC) load(userptr, "glGetString");
+		    glad_glGetTexImage = (PFNGLGETTEXIMAGEPROC) load(userptr, "glGetTexImage");
+		    glad_glGetTexLevelParameterfv = (PFNGLGETTEXLEVELPARAMETERFVPROC) load(userptr, "glGetTexLevelParameterfv");
+		    glad_glGetTexLevelParameteriv = (PFNGLGETTEXLEVELPARAMETERIVPROC) load(userptr, "glGetTexLevelParameteriv");
+		    glad_glGetTexParameterfv = (PFNGLGETTEXPARAMETERFVPROC) load(userptr, "glGetTexParameterfv");
+		    glad_glGetTexParameteriv = (PFNGLGETTEXPARAMETERIVPROC) load(userptr, "glGetTexParameteriv");
+		    glad_glHint = (PFNGLHINTPROC) load(userptr, "glHint");
+		    glad_glIsEnabled = (PFNGLISENABLEDPROC) load(userptr, "glIsEnabled");
+		    glad_glLineWidth = (PFNGLLINEWIDTHPROC) load(userptr, "glLineWidth");
+		    glad_glLogicOp = (PFNGLLOGICOPPROC) load(userptr, "glLogicOp");
+		    glad_glPixelStoref = (PFNGLPIXELSTOREFPROC) load(userptr, "glPixelStoref");
+		    glad_glPixelStorei = (PFNGLPIXELSTOREIPROC) load(userptr, "glPixelStorei");
+		    glad_glPointSize = (PFNGLPOINTSIZEPROC) load(userptr, "glPointSize");
+		    glad_glPolygonMode = (PFNGLPOLYGONMODEPROC) load(userptr, "glPolygonMode");
+		    glad_glReadBuffer = (PFNGLREADBUFFERPROC) load(userptr, "glReadBuffer");
+		    glad_glReadPixels = (PFNGLREADPIXELSPROC) load(userptr, "glReadPixels");
+		    glad_glScissor = (PFNGLSCISSORPROC) load(userptr, "glScissor");
+		    glad_glStencilFunc = (PFNGLSTENCILFUNCPROC) load(userptr, "glStencilFunc");
+		    glad_glStencilMask = (PFNGLSTENCILMASKPROC) load(userptr, "glStencilMask");
+		    glad_glStencilOp = (PFNGLSTENCILOPPROC) load(userptr, "glStencilOp");
+		    glad_glTexImage1D = (PFNGLTEXIMAGE1DPROC) load(userptr, "glTexImage1D");
+		    glad_glTexImage2D = (PFNGLTEXIMAGE2DPROC) load(userptr, "glTexImage2D");
+		    glad_glTexParameterf = (PFNGLTEXPARAMETERFPROC) load(userptr, "glTexParameterf");
+		    glad_glTexParameterfv = (PFNGLTEXPARAMETERFVPROC) load(userptr, "glTexParameterfv");
+		    glad_glTexParameteri = (PFNGLTEXPARAMETERIPROC) load(userptr, "glTexParameteri");
+		    glad_glTexParameteriv = (PFNGLTEXPARAMETERIVPROC) load(userptr, "glTexParameteriv");
+		    glad_glViewport = (PFNGLVIEWPORTPROC) load(userptr, "glViewport");
+		}
+		static void glad_gl_load_GL_VERSION_1_1( GLADuserptrloadfunc load, void* userptr) {
+		    if(!GLAD_GL_VERSION_1_1) return;
+		    glad_glBindTexture = (PFNGLBINDTEXTUREPROC) load(userptr, "glBindTexture");
+		    glad_glCopyTexImage1D = (PFNGLCOPYTEXIMAGE1DPROC) load(userptr, "glCopyTexImage1D");
+		    glad_glCopyTexImage2D = (PFNGLCOPYTEXIMAGE2DPROC) load(userptr, "glCopyTexImage2D");
+		    glad_glCopyTexSubImage1D = (PFNGLCOPYTEXSUBIMAGE1DPROC) load(userptr, "glCopyTexSubImage1D");
+		    glad_glCopyTexSubImage2D = (PFNGLCOPYTEXSUBIMAGE2DPROC) load(userptr, "glCopyTexSubImage2D");
+		    glad_glDeleteTextures = (PFNGLDELETETEXTURESPROC) load(userptr, "glDeleteTextures");
+		    glad_glDrawArrays = (PFNGLDRAWARRAYSPROC) load(userptr, "glDrawArrays");
+		    glad_glDrawElements = (PFNGLDRAWELEMENTSPROC) load(userptr, "glDrawElements");
+		    glad_glGenTextures = (PFNGLGENTEXTURESPROC) load(userptr, "glGenTextures");
+		    glad_glIsTexture = (PFNGLISTEXTUREPROC) load(userptr, "glIsTexture");
+		    glad_glPolygonOffset = (PFNGLPOLYGONOFFSETPROC) load(userptr, "glPolygonOffset");
+		    glad_glTexSubImage1D = (PFNGLTEXSUBIMAGE1DPROC) load(userptr, "glTexSubImage1D");
+		    glad_glTexSubImage2D = (PFNGLTEXSUBIMAGE2DPROC) load(userptr, "glTexSubImage2D");
+		}
+		static void glad_gl_load_GL_VERSION_1_2( GLADuserptrloadfunc load, void* userptr) {
+		    if(!GLAD_GL_VERSION_1_2) return;
+		    glad_glCopyTexSubImage3D = (PFNGLCOPYTEXSUBIMAGE3DPROC) load(userptr, "glCopyTexSubImage3D");
+		    glad_glDrawRangeElements = (PFNGLDRAWRANGEELEMENTSPROC) load(userptr, "glDrawRangeElements");
+		    glad_glTexImage3D = (PFNGLTEXIMAGE3DPROC) load(userptr, "glTexImage3D");
+		    glad_glTexSubImage3D = (PFNGLTEXSUBIMAGE3DPROC) load(userptr, "glTexSubImage3D");
+		}
+		static void glad_gl_load_GL_VERSION_1_3( GLADuserptrloadfunc load, void* userptr) {
+		    if(!GLAD_GL_VERSION_1_3) return;
+		    glad_glActiveTexture = (PFNGLACTIVETEXTUREPROC) load(userptr, "glActiveTexture");
+		    glad_glCompressedTexImage1D = (PFNGLCOMPRESSEDTEXIMAGE1DPROC) load(userptr, "glCompressedTexImage1D");
+		    glad_glCompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC) load(userptr, "glCompressedTexImage2D");
+		    glad_glCompressedTexImage3D = (PFNGLCOMPRESSEDTEXIMAGE3DPROC) load(userptr, "glCompressedTexImage3D");
+		    glad_glCompressedTexSubImage1D = (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC) load(userptr, "glCompressedTexSubImage1D");
+		    glad_glCompressedTexSubImage2D = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC) load(userptr, "glCompressedTexSubImage2D");
+		    glad_glCompressedTexSubImage3D = (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC) load(userptr, "glCompressedTexSubImage3D");
+		    glad_glGetCompressedTexImage = (PFNGLGETCOMPRESSEDTEXIMAGEPROC) load(userptr, "glGetCompressedTexImage");
+		    glad_glSampleCoverage = (PFNGLSAMPLECOVERAGEPROC) load(userptr, "glSampleCoverage");
+		}
+		static void glad_gl_load_GL_VERSION_1_4( GLADuserptrloadfunc load, void* userptr) {
+		    if(!GLAD_GL_VERSION_1_4) return;
+		    glad_glBlendColor = (PFNGLBLENDCOLORPROC) load(userptr, "glBlendColor");
+		    glad_glBlendEquation = (PFNGLBLENDEQUATIONPROC) load(userptr, "glBlendEquation");
+		    glad_glBlendFuncSeparate = (PFNGLBLENDFUNCSEPARATEPROC) load(userptr, "glBlendFuncSeparate");
+		    glad_glMultiDrawArrays = (PFNGLMULTIDRAWARRAYSPROC) load(userptr, "glMultiDrawArrays");
+		    glad_glMultiDrawElements = (PFNGLMULTIDRAWELEMENTSPROC) load(userptr, "glMultiDrawElements");
+		    glad_glPointParameterf = (PFNGLPOINTPARAMETERFPROC) load(userptr, "glPointParameterf");
+		    glad_glPointParameterfv = (PFNGLPOINTPARAMETERFVPROC) load(userptr, "glPointParameterfv");
+		    glad_glPointParameteri = (PFNGLPOINTPARAMETERIPROC) load(userptr, "glPointParameteri");
+		    glad_glPointParameteriv = (PFNGLPOINTPARAMETERIVPROC) load(userptr, "glPointParameteriv");
+		}
+		static void glad_gl_load_GL_VERSION_1_5( GLADuserptrloadfunc load, void* userptr) {
+		    if(!GLAD_GL_VERSION_1_5) return;
+		    glad_glBeginQuery = (PFNGLBEGINQUERYPROC) load(userptr, "glBeginQuery");
+		    glad_glBindBuffer = (PFNGLBINDBUFFERPROC) load(userptr, "glBindBuffer");
+		    glad_glBufferData = (PFNGLBUFFERDATAPROC) load(userptr, "glBufferData");
+		    glad_glBufferSubData = (PFNGLBUFFERSUBDATAPROC) load(userptr, "glBufferSubData");
+		    glad_glDeleteBuffers = (PFNGLDELETEBUFFERSPROC) load(userptr, "glDeleteBuffers");
+		    glad_glDeleteQueries = (PFNGLDELETEQUERIESPROC) load(userptr, "glDeleteQueries");
+		    glad_glEndQuery = (PFNGLENDQUERYPROC) load(userptr, "glEndQuery");
+		    glad_glGenBuffers = (PFNGLGENBUFFERSPROC) load(userptr, "glGenBuffers");
+		    glad_glGenQueries = (PFNGLGENQUERIESPROC) load(userptr, "glGenQueries");
+		    glad_glGetBufferParameteriv = (PFNGLGETBUFFERPARAMETERIVPROC) load(userptr, "glGetBufferParameteriv");
+		    glad_glGetBufferPointerv = (PFNGLGETBUFFERPOINTERVPROC) load(userptr, "glGetBufferPointerv");
+		    glad_glGetBufferSubData = (PFNGLGETBUFFERSUBDATAPROC) load(userptr, "glGetBufferSubData");
+		    glad_glGetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC) load(userptr, "glGetQueryObjectiv");
+		    glad_glGetQueryObjectuiv = (PFNGLGETQUERYOBJECTUIVPROC) load(userptr, "glGetQueryObjectuiv");
+		    glad_glGetQueryiv = (PFNGLGETQUERYIVPROC) load(userptr, "glGetQueryiv");
+		    glad_glIsBuffer = (PFNGLISBUFFERPROC) load(userptr, "glIsBuffer");
+		    glad_glIsQuery = (PFNGLISQUERYPROC) load(userptr, "glIsQuery");
+		    glad_glMapBuffer = (PFNGLMAPBUFFERPROC) load(userptr, "glMapBuffer");
+		    glad_glUnmapBuffer = (PFNGLUNMAPBUFFERPROC) load(userptr, "glUnmapBuffer");
+		}
+		static void glad_gl_load_GL_VERSION_2_0( GLADuserptrloadfunc load, void* userptr) {
+		    if(!GLAD_GL_VERSION_2_0) return;
+		    glad_glAttachShader = (PFNGLATTACHSHADERPROC) load(userptr, "glAttachShader");
+		    glad_glBindAttribLocation = (PFNGLBINDATTRIBLOCATIONPROC) load(userptr, "glBindAttribLocation");
+		    glad_glBlendEquationSeparate = (PFNGLBLENDEQUATIONSEPARATEPROC) load(userptr, "glBlendEquationSeparate");
+		    glad_glCompileShader = (PFNGLCOMPILESHADERPROC) load(userptr, "glCompileShader");
+		    glad_glCreateProgram = (PFNGLCREATEPROGRAMPROC) load(userptr, "glCreateProgram");
+		    glad_glCreateShader = (PFNGLCREATESHADERPROC) load(userptr, "glCreateShader");
+		    glad_glDeleteProgram = (PFNGLDELETEPROGRAMPROC) load(userptr, "glDeleteProgram");
+		    glad_glDeleteShader = (PFNGLDELETESHADERPROC) load(userptr, "glDeleteShader");
+		    glad_glDetachShader = (PFNGLDETACHSHADERPROC) load(userptr, "glDetachShader");
+		    glad_glDisableVertexAttribArray = (PFNGLDISABLEVERTEXATTRIBARRAYPROC) load(userptr, "glDisableVertexAttribArray");
+		    glad_glDrawBuffers = (PFNGLDRAWBUFFERSPROC) load(userptr, "glDrawBuffers");
+		    glad_glEnableVertexAttribArray = (PFNGLENABLEVERTEXATTRIBARRAYPROC) load(userptr, "glEnableVertexAttribArray");
+		    glad_glGetActiveAttrib = (PFNGLGETACTIVEATTRIBPROC) load(userptr, "glGetActiveAttrib");
+		    glad_glGetActiveUniform = (PFNGLGETACTIVEUNIFORMPROC) load(userptr, "glGetActiveUniform");
+		    glad_glGetAttachedShaders = (PFNGLGETATTACHEDSHADERSPROC) load(userptr, "glGetAttachedShaders");
+		    glad_glGetAttribLocation = (PFNGLGETATTRIBLOCATIONPROC) load(userptr, "glGetAttribLocation");
+		    glad_glGetProgramInfoLog = (PFNGLGETPROGRAMINFOLOGPROC) load(userptr, "glGetProgramInfoLog");
+		    glad_glGetProgramiv = (PFNGLGETPROGRAMIVPROC) load(userptr, "glGetProgramiv");
+		    glad_glGetShaderInfoLog = (PFNGLGETSHADERINFOLOGPROC) load(userptr, "glGetShaderInfoLog");
+		    glad_glGetShaderSource = (PFNGLGETSHADERSOURCEPROC) load(userptr, "glGetShaderSource");
+		    glad_glGetShaderiv = (PFNGLGETSHADERIVPROC) load(userptr, "glGetShaderiv");
+		    glad_glGetUniformLocation = (PFNGLGETUNIFORMLOCATIONPROC) load(userptr, "glGetUniformLocation");
+		    glad_glGetUniformfv = (PFNGLGETUNIFORMFVPROC) load(userptr, "glGetUniformfv");
+		    glad_glGetUniformiv = (PFNGLGETUNIFORMIVPROC) load(userptr, "glGetUniformiv");
+		    glad_glGetVertexAttribPointerv = (PFNGLGETVERTEXATTRIBPOINTERVPROC) load(userptr, "glGetVertexAttribPointerv");
+		    glad_glGetVertexAttribdv = (PFNGLGETVERTEXATTRIBDVPROC) load(userptr, "glGetVertexAttribdv");
+		    glad_glGetVertexAttribfv = (PFNGLGETVERTEXATTRIBFVPROC) load(userptr, "glGetVertexAttribfv");
+		    glad_glGetVertexAttribiv = (PFNGLGETVERTEXATTRIBIVPROC) load(userptr, "glGetVertexAttribiv");
+		    glad_glIsProgram = (PFNGLISPROGRAMPROC) load(userptr, "glIsProgram");
+		    glad_glIsShader = (PFNGLISSHADERPROC) load(userptr, "glIsShader");
+		    glad_glLinkProgram = (PFNGLLINKPROGRAMPROC) load(userptr, "glLinkProgram");
+		    glad_glShaderSource = (PFNGLSHADERSOURCEPROC) load(userptr, "glShaderSource");
+		    glad_glStencilFuncSeparate = (PFNGLSTENCILFUNCSEPARATEPROC) load(userptr, "glStencilFuncSeparate");
+		    glad_glStencilMaskSeparate = (PFNGLSTENCILMASKSEPARATEPROC) load(userptr, "glStencilMaskSeparate");
+		    glad_glStencilOpSeparate = (PFNGLSTENCILOPSEPARATEPROC) load(userptr, "glStencilOpSeparate");
+		    glad_glUniform1f = (PFNGLUNIFORM1FPROC) load(userptr, "glUniform1f");
+		    glad_glUniform1fv = (PFNGLUNIFORM1FVPROC) load(userptr, "glUniform1fv");
+		    glad_glUniform1i = (PFNGLUNIFORM1IPROC) load(userptr, "glUniform1i");
+		    glad_glUniform1iv = (PFNGLUNIFORM1IVPROC) load(userptr, "glUniform1iv");
+		    glad_glUniform2f = (PFNGLUNIFORM2FPROC) load(userptr, "glUniform2f");
+		    glad_glUniform2fv = (PFNGLUNIFORM2FVPROC) load(userptr, "glUniform2fv");
+		    glad_glUniform2i = (PFNGLUNIFORM2IPROC) load(userptr, "glUniform2i");
+		    glad_glUniform2iv = (PFNGLUNIFORM2IVPROC) load(userptr, "glUniform2iv");
+		    glad_glUniform3f = (PFNGLUNIFORM3FPROC) load(userptr, "glUniform3f");
+		    glad_glUniform3fv = (PFNGLUNIFORM3FVPROC) load(userptr, "glUniform3fv");
+		    glad_glUniform3i = (PFNGLUNIFORM3IPROC) load(userptr, "glUniform3i");
+		    glad_glUniform3iv = (PFNGLUNIFORM3IVPROC) load(userptr, "glUniform3iv");
+		    glad_glUniform4f = (PFNGLUNIFORM4FPROC) load(userptr, "glUniform4f");
+		    glad_glUniform4fv = (PFNGLUNIFORM4FVPROC) load(userptr, "glUniform4fv");
+		    glad_glUniform4i = (PFNGLUNIFORM4IPROC) load(userptr, "glUniform4i");
+		    glad_glUniform4iv = (PFNGLUNIFORM4IVPROC) load(userptr, "glUniform4iv");
+		    glad_glUniformMatrix2fv = (PFNGLUNIFORMMATRIX2FVPROC) load(userptr, "glUniformMatrix2fv");
+		    glad_glUniformMatrix3fv = (PFNGLUNIFORMMATRIX3FVPROC) load(userptr, "glUniformMatrix3fv");
+		    glad_glUniformMatrix4fv = (PFNGLUNIFORMMATRIX4FVPROC) load(userptr, "glUniformMatrix4fv");
+		    glad_glUseProgram = (PFNGLUSEPROGRAMPROC) load(userptr, "glUseProgram");
+		    glad_glValidateProgram = (PFNGLVALIDATEPROGRAMPROC) load(userptr, "glValidateProgram");
+		    glad_glVertexAttrib1d = (PFNGLVERTEXATTRIB1DPROC) load(userptr, "glVertexAttrib1d");
+		    glad_glVertexAttrib1dv = (PFNGLVERTEXATTRIB1DVPROC) load(userptr, "glVertexAttrib1dv");
+		    glad_glVertexAttrib1f = (PFNGLVERTEXATTRIB1FPROC) load(userptr, "glVertexAttrib1f");
+		    glad_glVertexAttrib1fv = (PFNGLVERTEXATTRIB1FVPROC) load(userptr, "glVertexAttrib1fv");
+		    glad_glVertexAttrib1s = (PFNGLVERTEXATTRIB1SPROC) load(userptr, "glVertexAttrib1s");
+		    glad_glVertexAttrib1sv = (PFNGLVERTEXATTRIB1SVPROC) load(userptr, "glVertexAttrib1sv");
+		    glad_glVertexAttrib2d = (PFNGLVERTEXATTRIB2DPROC) load(userptr, "glVertexAttrib2d");
+		    glad_glVertexAttrib2dv = (PFNGLVERTEXATTRIB2DVPROC) load(userptr, "glVertexAttrib2dv");
+		    glad_glVertexAttrib2f = (PFNGLVERTEXATTRIB2FPROC) load(userptr, "glVertexAttrib2f");
+		    glad_glVertexAttrib2fv = (PFNGLVERTEXATTRIB2FVPROC) load(userptr, "glVertexAttrib2fv");
+		    glad_glVertexAttrib2s = (PFNGLVERTEXATTRIB2SPROC) load(userptr, "glVertexAttrib2s");
+		    glad_glVertexAttrib2sv = (PFNGLVERTEXATTRIB2SVPROC) load(userptr, "glVertexAttrib2sv");
+		    glad_glVertexAttrib3d = (PFNGLVERTEXATTRIB3DPROC) load(userptr, "glVertexAttrib3d");
+		    glad_glVertexAttrib3dv = (PFNGLVERTEXATTRIB3DVPROC) load(userptr, "glVertexAttrib3dv");
+		    glad_glVertexAttrib3f = (PFNGLVERTEXATTRIB3FPROC) load(userptr, "glVertexAttrib3f");
+		    glad_glVertexAttrib3fv = (PFNGLVERTEXATTRIB3FVPROC) load(userptr, "glVertexAttrib3fv");
+		    glad_glVertexAttrib3s = (PFNGLVERTEXATTRIB3SPROC) load(userptr, "glVertexAttrib3s");
+		    glad_glVertexAttrib3sv = (PFNGLVERTEXATTRIB3SVPROC) load(userptr, "glVertexAttrib3sv");
+		    glad_glVertexAttrib4Nbv = (PFNGLVERTEXATTRIB4NBVPROC) load(userptr, "glVertexAttrib4Nbv");
+		    glad_glVertexAttrib4Niv = (PFNGLVERTEXATTRIB4NIVPROC) load(userptr, "glVertexAttrib4Niv");
+		    glad_glVertexAttrib4Nsv = (PFNGLVERTEXATTRIB4NSVPROC) load(userptr, "glVertexAttrib4Nsv");
+		    glad_glVertexAttrib4Nub = (PFNGLVERTEXATTRIB4NUBPROC) load(userptr, "glVertexAttrib4Nub");
+		    glad_glVertexAttrib4Nubv = (PFNGLVERTEXATTRIB4NUBVPROC) load(userptr, "glVertexAttrib4Nubv");
+		    glad_glVertexAttrib4Nuiv = (PFNGLVERTEXATTRIB4NUIVPROC) load(userptr, "glVertexAttrib4Nuiv");
+		    glad_glVertexAttrib4Nusv = (PFNGLVERTEXATTRIB4NUSVPROC) load(userptr, "glVertexAttrib4Nusv");
+		    glad_glVertexAttrib4bv = (PFNGLVERTEXATTRIB4BVPROC) load(userptr, "glVertexAttrib4bv");
+		    glad_glVertexAttrib4d = (PFNGLVERTEXATTRIB4DPROC) load(userptr, "glVertexAttrib4d");
+		    glad_glVertexAttrib4dv = (PFNGLVERTEXATTRIB4DVPROC) load(userptr, "glVertexAttrib4dv");
+		    glad_glVertexAttrib4f = (PFNGLVERTEXATTRIB4FPROC) load(userptr, "glVertexAttrib4f");
+		    glad_glVertexAttrib4fv = (PFNGLVERTEXATTRIB4FVPROC) load(userptr, "glVertexAttrib4fv");
+		    glad_glVertexAttrib4iv = (PFNGLVERTEXATTRIB4IVPROC) load(userptr, "glVertexAttrib4iv");
+		    glad_glVertexAttrib4s = (PFNGLVERTEXATTRIB4SPROC) load(userptr, "glVertexAttrib4s");
+		    glad_glVertexAttrib4sv = (PFNGLVERTEXATTRIB4SVPROC) load(userptr, "glVertexAttrib4sv");
+		    glad_glVertexAttrib4ubv = (PFNGLVERTEXATTRIB4UBVPROC) load(userptr, "glVertexAttrib4ubv");
+		    glad_glVertexAttrib4uiv = (PFNGLVERTEXATTRIB4UIVPROC) load(userptr, "glVertexAttrib4uiv");
+		    glad_glVertexAttrib4usv = (PFNGLVERTEXATTRIB4USVPROC) load(userptr, "glVertexAttrib4usv");
+		    glad_glVertexAttribPointer = (PFNGLVERTEXATTRIBPOINTERPROC) load(userptr, "glVertexAttribPointer");
+		}
+		static void glad_gl_load_GL_VERSION_2_1( GLADuserptrloadfunc load, void* userptr) {
+		    if(!GLAD_GL_VERSION_2_1) return;
+		    glad_glUniformMatrix2x3fv = (PFNGLUNIFORMMATRIX2X3FVPROC) load(userptr, "glUniformMatrix2x3fv");
+		    glad_glUniformMatrix2x4fv = (PFNGLUNIFORMMATRIX2X4FVPROC) load(userptr, "glUniformMatrix2x4fv");
+		    glad_glUniformMatrix3x2fv = (PFNGLUNIFORMMATRIX3X2FVPROC) load(userptr, "glUniformMatrix3x2fv");
+		    glad_glUniformMatrix3x4fv = (PFNGLUNIFORMMATRIX3X4FVPROC) load(userptr, "glUniformMatrix3x4fv");
+		    glad_glUniformMatrix4x2fv = (PFNGLUNIFORMMATRIX4X2FVPROC) load(userptr, "glUniformMatrix4x2fv");
+		    glad_glUniformMatrix4x3fv = (PFNGLUNIFORMMATRIX4X3FVPROC) load(userptr, "glUniformMatrix4x3fv");
+		}
+		static void glad_gl_load_GL_VERSION_3_0( GLADuserptrloadfunc load, void* userptr) {
+		    if(!GLAD_GL_VERSION_3_0) return;
+		    glad_glBeginConditionalRender = (PFNGLBEGINCONDITIONALRENDERPROC) load(userptr, "glBeginConditionalRender");
+		    glad_glBeginTransformFeedback = (PFNGLBEGINTRANSFORMFEEDBACKPROC) load(userptr, "glBeginTransformFeedback");
+		    glad_glBindBufferBase = (PFNGLBINDBUFFERBASEPROC) load(userptr, "glBindBufferBase");
+		    glad_glBindBufferRange = (PFNGLBINDBUFFERRANGEPROC) load(userptr, "glBindBufferRange");
+		    glad_glBindFragDataLocation = (PFNGLBINDFRAGDATALOCATIONPROC) load(userptr, "glBindFragDataLocation");
+		    glad_glBindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC) load(userptr, "glBindFramebuffer");
+		    glad_glBindRenderbuffer = (PFNGLBINDRENDERBUFFERPROC) load(userptr, "glBindRenderbuffer");
+		    glad_glBindVertexArray = (PFNGLBINDVERTEXARRAYPROC) load(userptr, "glBindVertexArray");
+		    glad_glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC) load(userptr, "glBlitFramebuffer");
+		    glad_glCheckFramebufferStatus = (PFNGLCHECKFRAMEBUFFERSTATUSPROC) load(userptr, "glCheckFramebufferStatus");
+		    glad_glClampColor = (PFNGLCLAMPCOLORPROC) load(userptr, "glClampColor");
+		    glad_glClearBufferfi = (PFNGLCLEARBUFFERFIPROC) load(userptr, "glClearBufferfi");
+		    glad_glClearBufferfv = (PFNGLCLEARBUFFERFVPROC) load(userptr, "glClearBufferfv");
+		    glad_glClearBufferiv = (PFNGLCLEARBUFFERIVPROC) load(userptr, "glClearBufferiv");
+		    glad_glClearBufferuiv = (PFNGLCLEARBUFFERUIVPROC) load(userptr, "glClearBufferuiv");
+		    glad_glColorMaski = (PFNGLCOLORMASKIPROC) load(userptr, "glColorMaski");
+		    glad_glDeleteFramebuffers = (PFNGLDELETEFRAMEBUFFERSPROC) load(userptr, "glDeleteFramebuffers");
+		    glad_glDeleteRenderbuffers = (PFNGLDELETERENDERBUFFERSPROC) load(userptr, "glDeleteRenderbuffers");
+		    glad_glDeleteVertexArrays = (PFNGLDELETEVERTEXARRAYSPROC) load(userptr, "glDeleteVertexArrays");
+		    glad_glDisablei = (PFNGLDISABLEIPROC) load(userptr, "glDisablei");
+		    glad_glEnablei = (PFNGLENABLEIPROC) load(userptr, "glEnablei");
+		    glad_glEndConditionalRender = (PFNGLENDCONDITIONALRENDERPROC) load(userptr, "glEndConditionalRender");
+		    glad_glEndTransformFeedback = (PFNGLENDTRANSFORMFEEDBACKPROC) load(userptr, "glEndTransformFeedback");
+		    glad_glFlushMappedBufferRange = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC) load(userptr, "glFlushMappedBufferRange");
+		    glad_glFramebufferRenderbuffer = (PFNGLFRAMEBUFFERRENDERBUFFERPROC) load(userptr, "glFramebufferRenderbuffer");
+		    glad_glFramebufferTexture1D = (PFNGLFRAMEBUFFERTEXTURE1DPROC) load(userptr, "glFramebufferTexture1D");
+		    glad_glFramebufferTexture2D = (PFNGLFRAMEBUFFERTEXTURE2DPROC) load(userptr, "glFramebufferTexture2D");
+		    glad_glFramebufferTexture3D = (PFNGLFRAMEBUFFERTEXTURE3DPROC) load(userptr, "glFramebufferTexture3D");
+		    glad_glFramebufferTextureLayer = (PFNGLFRAMEBUFFERTEXTURELAYERPROC) load(userptr, "glFramebufferTextureLayer");
+		    glad_glGenFramebuffers = (PFNGLGENFRAMEBUFFERSPROC) load(userptr, "glGenFramebuffers");
+		    glad_glGenRenderbuffers = (PFNGLGENRENDERBUFFERSPROC) load(userptr, "glGenRenderbuffers");
+		    glad_glGenVertexArrays = (PFNGLGENVERTEXARRAYSPROC) load(userptr, "glGenVertexArrays");
+		    glad_glGenerateMipmap = (PFNGLGENERATEMIPMAPPROC) load(userptr, "glGenerateMipmap");
+		    glad_glGetBooleani_v = (PFNGLGETBOOLEANI_VPROC) load(userptr, "glGetBooleani_v");
+		    glad_glGetFragDataLocation = (PFNGLGETFRAGDATALOCATIONPROC) load(userptr, "glGetFragDataLocation");
+		    glad_glGetFramebufferAttachmentParameteriv = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC) load(userptr, "glGetFramebufferAttachmentParameteriv");
+		    glad_glGetIntegeri_v = (PFNGLGETINTEGERI_VPROC) load(userptr, "glGetIntegeri_v");
+		    glad_glGetRenderbufferParameteriv = (PFNGLGETRENDERBUFFERPARAMETERIVPROC) load(userptr, "glGetRenderbufferParameteriv");
+		    glad_glGetStringi = (PFNGLGETSTRINGIPROC) load(userptr, "glGetStringi");
+		    glad_glGetTexParameterIiv = (PFNGLGETTEXPARAMETERIIVPROC) load(userptr, "glGetTexParameterIiv");
+		    glad_glGetTexParameterIuiv = (PFNGLGETTEXPARAMETERIUIVPROC) load(userptr, "glGetTexParameterIuiv");
+		    glad_glGetTransformFeedbackVarying = (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC) load(userptr, "glGetTransformFeedbackVarying");
+		    glad_glGetUniformuiv = (PFNGLGETUNIFORMUIVPROC) load(userptr, "glGetUniformuiv");
+		    glad_glGetVertexAttribIiv = (PFNGLGETVERTEXATTRIBIIVPROC) load(userptr, "glGetVertexAttribIiv");
+		    glad_glGetVertexAttribIuiv = (PFNGLGETVERTEXATTRIBIUIVPROC) load(userptr, "glGetVertexAttribIuiv");
+		    glad_glIsEnabledi = (PFNGLISENABLEDIPROC) load(userptr, "glIsEnabledi");
+		    glad_glIsFramebuffer = (PFNGLISFRAMEBUFFERPROC) load(userptr, "glIsFramebuffer");
+		    glad_glIsRenderbuffer = (PFNGLISRENDERBUFFERPROC) load(userptr, "glIsRenderbuffer");
+		    glad_glIsVertexArray = (PFNGLISVERTEXARRAYPROC) load(userptr, "glIsVertexArray");
+		    glad_glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC) load(userptr, "glMapBufferRange");
+		    glad_glRenderbufferStorage = (PFNGLRENDERBUFFERSTORAGEPROC) load(userptr, "glRenderbufferStorage");
+		    glad_glRenderbufferStorageMultisample = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC) load(userptr, "glRenderbufferStorageMultisample");
+		    glad_glTexParameterIiv = (PFNGLTEXPARAMETERIIVPROC) load(userptr, "glTexParameterIiv");
+		    glad_glTexParameterIuiv = (PFNGLTEXPARAMETERIUIVPROC) load(userptr, "glTexParameterIuiv");
+		    glad_glTransformFeedbackVaryings = (PFNGLTRANSFORMFEEDBACKVARYINGSPROC) load(userptr, "glTransformFeedbackVaryings");
+		    glad_glUniform1ui = (PFNGLUNIFORM1UIPROC) load(userptr, "glUniform1ui");
+		    glad_glUniform1uiv = (PFNGLUNIFORM1UIVPROC) load(userptr, "glUniform1uiv");
+		    glad_glUniform2ui = (PFNGLUNIFORM2UIPROC) load(userptr, "glUniform2ui");
+		    glad_glUniform2uiv = (PFNGLUNIFORM2UIVPROC) load(userptr, "glUniform2uiv");
+		    glad_glUniform3ui = (PFNGLUNIFORM3UIPROC) load(userptr, "glUniform3ui");
+		    glad_glUniform3uiv = (PFNGLUNIFORM3UIVPROC) load(userptr, "glUniform3uiv");
+		    glad_glUniform4ui = (PFNGLUNIFORM4UIPROC) load(userptr, "glUniform4ui");
+		    glad_glUniform4uiv = (PFNGLUNIFORM4UIVPROC) load(userptr, "glUniform4uiv");
+		    glad_glVertexAttribI1i = (PFNGLVERTEXATTRIBI1IPROC) load(userptr, "glVertexAttribI1i");
+		    glad_glVertexAttribI1iv = (PFNGLVERTEXATTRIBI1IVPROC) load(userptr, "glVertexAttribI1iv");
+		    glad_glVertexAttribI1ui = (PFNGLVERTEXATTRIBI1UIPROC) load(userptr, "glVertexAttribI1ui");
+		    glad_glVertexAttribI1uiv = (PFNGLVERTEXATTRIBI1UIVPROC) load(userptr, "glVertexAttribI1uiv");
+		    glad_glVertexAttribI2i = (PFNGLVERTEXATTRIBI2IPROC) load(userptr, "glVertexAttribI2i");
+		    glad_glVertexAttribI2iv = (PFNGLVERTEXATTRIBI2IVPROC) load(userptr, "glVertexAttribI2iv");
+		    glad_glVertexAttribI2ui = (PFNGLVERTEXATTRIBI2UIPROC) load(userptr, "glVertexAttribI2ui");
+		    glad_glVertexAttribI2uiv = (PFNGLVERTEXATTRIBI2UIVPROC) load(userptr, "glVertexAttribI2uiv");
+		    glad_glVertexAttribI3i = (PFNGLVERTEXATTRIBI3IPROC) load(userptr, "glVertexAttribI3i");
+		    glad_glVertexAttribI3iv = (PFNGLVERTEXATTRIBI3IVPROC) load(userptr, "glVertexAttribI3iv");
+		    glad_glVertexAttribI3ui = (PFNGLVERTEXATTRIBI3UIPROC) load(userptr, "glVertexAttribI3ui");
+		    glad_glVertexAttribI3uiv = (PFNGLVERTEXATTRIBI3UIVPROC) load(userptr, "glVertexAttribI3uiv");
+		    glad_glVertexAttribI4bv = (PFNGLVERTEXATTRIBI4BVPROC) load(userptr, "glVertexAttribI4bv");
+		    glad_glVertexAttribI4i = (PFNGLVERTEXATTRIBI4IPROC) load(userptr, "glVertexAttribI4i");
+		    glad_glVertexAttribI4iv = (PFNGLVERTEXATTRIBI4IVPROC) load(userptr, "glVertexAttribI4iv");
+		    glad_glVertexAttribI4sv = (PFNGLVERTEXATTRIBI4SVPROC) load(userptr, "glVertexAttribI4sv");
+		    glad_glVertexAttribI4ubv = (PFNGLVERTEXATTRIBI4UBVPROC) load(userptr, "glVertexAttribI4ubv");
+		    glad_glVertexAttribI4ui = (PFNGLVERTEXATTRIBI4UIPROC) load(userptr, "glVertexAttribI4ui");
+		    glad_glVertexAttribI4uiv = (PFNGLVERTEXATTRIBI4UIVPROC) load(userptr, "glVertexAttribI4uiv");
+		    glad_glVertexAttribI4usv = (PFNGLVERTEXATTRIBI4USVPROC) load(userptr, "glVertexAttribI4usv");
+		    glad_glVertexAttribIPointer = (PFNGLVERTEXATTRIBIPOINTERPROC) load(userptr, "glVertexAttribIPointer");
+		}
+		static void glad_gl_load_GL_VERSION_3_1( GLADuserptrloadfunc load, void* userptr) {
+		    if(!GLAD_GL_VERSION_3_1) return;
+		    glad_glBindBufferBase = (PFNGLBINDBUFFERBASEPROC) load(userptr, "glBindBufferBase");
+		    glad_glBindBufferRange = (PFNGLBINDBUFFERRANGEPROC) load(userptr, "glBindBufferRange");
+		    glad_glCopyBufferSubData = (PFNGLCOPYBUFFERSUBDATAPROC) load(userptr, "glCopyBufferSubData");
+		    glad_glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDPROC) load(userptr, "glDrawArraysInstanced");
+		    glad_glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC) load(userptr, "glDrawElementsInstanced");
+		    glad_glGetActiveUniformBlockName = (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC) load(userptr, "glGetActiveUniformBlockName");
+		    glad_glGetActiveUniformBlockiv = (PFNGLGETACTIVEUNIFORMBLOCKIVPROC) load(userptr, "glGetActiveUniformBlockiv");
+		    glad_glGetActiveUniformName = (PFNGLGETACTIVEUNIFORMNAMEPROC) load(userptr, "glGetActiveUniformName");
+		    glad_glGetActiveUniformsiv = (PFNGLGETACTIVEUNIFORMSIVPROC) load(userptr, "glGetActiveUniformsiv");
+		    glad_glGetIntegeri_v = (PFNGLGETINTEGERI_VPROC) load(userptr, "glGetIntegeri_v");
+		    glad_glGetUniformBlockIndex = (PFNGLGETUNIFORMBLOCKINDEXPROC) load(userptr, "glGetUniformBlockIndex");
+		    glad_glGetUniformIndices = (PFNGLGETUNIFORMINDICESPROC) load(userptr, "glGetUniformIndices");
+		    glad_glPrimitiveRestartIndex = (PFNGLPRIMITIVERESTARTINDEXPROC) load(userptr, "glPrimitiveRestartIndex");
+		    glad_glTexBuffer = (PFNGLTEXBUFFERPROC) load(userptr, "glTexBuffer");
+		    glad_glUniformBlockBinding = (PFNGLUNIFORMBLOCKBINDINGPROC) load(userptr, "glUniformBlockBinding");
+		}
+		static void glad_gl_load_GL_VERSION_3_2( GLADuserptrloadfunc load, void* userptr) {
+		    if(!GLAD_GL_VERSION_3_2) return;
+		    glad_glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC) load(userptr, "glClientWaitSync");
+		    glad_glDeleteSync = (PFNGLDELETESYNCPROC) load(userptr, "glDeleteSync");
+		    glad_glDrawElementsBaseVertex = (PFNGLDRAWELEMENTSBASEVERTEXPROC) load(userptr, "glDrawElementsBaseVertex");
+		    glad_glDrawElementsInstancedBaseVertex = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC) load(userptr, "glDrawElementsInstancedBaseVertex");
+		    glad_glDrawRangeElementsBaseVertex = (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC) load(userptr, "glDrawRangeElementsBaseVertex");
+		    glad_glFenceSync = (PFNGLFENCESYNCPROC) load(userptr, "glFenceSync");
+		    glad_glFramebufferTexture = (PFNGLFRAMEBUFFERTEXTUREPROC) load(userptr, "glFramebufferTexture");
+		    glad_glGetBufferParameteri64v = (PFNGLGETBUFFERPARAMETERI64VPROC) load(userptr, "glGetBufferParameteri64v");
+		    glad_glGetInteger64i_v = (PFNGLGETINTEGER64I_VPROC) load(userptr, "glGetInteger64i_v");
+		    glad_glGetInteger64v = (PFNGLGETINTEGER64VPROC) load(userptr, "glGetInteger64v");
+		    glad_glGetMultisamplefv = (PFNGLGETMULTISAMPLEFVPROC) load(userptr, "glGetMultisamplefv");
+		    glad_glGetSynciv = (PFNGLGETSYNCIVPROC) load(userptr, "glGetSynciv");
+		    glad_glIsSync = (PFNGLISSYNCPROC) load(userptr, "glIsSync");
+		    glad_glMultiDrawElementsBaseVertex = (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC) load(userptr, "glMultiDrawElementsBaseVertex");
+		    glad_glProvokingVertex = (PFNGLPROVOKINGVERTEXPROC) load(userptr, "glProvokingVertex");
+		    glad_glSampleMaski = (PFNGLSAMPLEMASKIPROC) load(userptr, "glSampleMaski");
+		    glad_glTexImage2DMultisample = (PFNGLTEXIMAGE2DMULTISAMPLEPROC) load(userptr, "glTexImage2DMultisample");
+		    glad_glTexImage3DMultisample = (PFNGLTEXIMAGE3DMULTISAMPLEPROC) load(userptr, "glTexImage3DMultisample");
+		    glad_glWaitSync = (PFNGLWAITSYNCPROC) load(userptr, "glWaitSync");
+		}
+		static void glad_gl_load_GL_VERSION_3_3( GLADuserptrloadfunc load, void* userptr) {
+		    if(!GLAD_GL_VERSION_3_3) return;
+		    glad_glBindFragDataLocationIndexed = (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC) load(userptr, "glBindFragDataLocationIndexed");
+		    glad_glBindSampler = (PFNGLBINDSAMPLERPROC) load(userptr, "glBindSampler");
+		    glad_glDeleteSamplers = (PFNGLDELETESAMPLERSPROC) load(userptr, "glDeleteSamplers");
+		    glad_glGenSamplers = (PFNGLGENSAMPLERSPROC) load(userptr, "glGenSamplers");
+		    glad_glGetFragDataIndex = (PFNGLGETFRAGDATAINDEXPROC) load(userptr, "glGetFragDataIndex");
+		    glad_glGetQueryObjecti64v = (PFNGLGETQUERYOBJECTI64VPROC) load(userptr, "glGetQueryObjecti64v");
+		    glad_glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC) load(userptr, "glGetQueryObjectui64v");
+		    glad_glGetSamplerParameterIiv = (PFNGLGETSAMPLERPARAMETERIIVPROC) load(userptr, "glGetSamplerParameterIiv");
+		    glad_glGetSamplerParameterIuiv = (PFNGLGETSAMPLERPARAMETERIUIVPROC) load(userptr, "glGetSamplerParameterIuiv");
+		    glad_glGetSamplerParameterfv = (PFNGLGETSAMPLERPARAMETERFVPROC) load(userptr, "glGetSamplerParameterfv");
+		    glad_glGetSamplerParameteriv = (PFNGLGETSAMPLERPARAMETERIVPROC) load(userptr, "glGetSamplerParameteriv");
+		    glad_glIsSampler = (PFNGLISSAMPLERPROC) load(userptr, "glIsSampler");
+		    glad_glQueryCounter = (PFNGLQUERYCOUNTERPROC) load(userptr, "glQueryCounter");
+		    glad_glSamplerParameterIiv = (PFNGLSAMPLERPARAMETERIIVPROC) load(userptr, "glSamplerParameterIiv");
+		    glad_glSamplerParameterIuiv = (PFNGLSAMPLERPARAMETERIUIVPROC) load(userptr, "glSamplerParameterIuiv");
+		    glad_glSamplerParameterf = (PFNGLSAMPLERPARAMETERFPROC) load(userptr, "glSamplerParameterf");
+		    glad_glSamplerParameterfv = (PFNGLSAMPLERPARAMETERFVPROC) load(userptr, "glSamplerParameterfv");
+		    glad_glSamplerParameteri = (PFNGLSAMPLERPARAMETERIPROC) load(userptr, "glSamplerParameteri");
+		    glad_glSamplerParameteriv = (PFNGLSAMPLERPARAMETERIVPROC) load(userptr, "glSamplerParameteriv");
+		    glad_glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC) load(userptr, "glVertexAttribDivisor");
+		    glad_glVertexAttribP1ui = (PFNGLVERTEXATTRIBP1UIPROC) load(userptr, "glVertexAttribP1ui");
+		    glad_glVertexAttribP1uiv = (PFNGLVERTEXATTRIBP1UIVPROC) load(userptr, "glVertexAttribP1uiv");
+		    glad_glVertexAttribP2ui = (PFNGLVERTEXATTRIBP2UIPROC) load(userptr, "glVertexAttribP2ui");
+		    glad_glVertexAttribP2uiv = (PFNGLVERTEXATTRIBP2UIVPROC) load(userptr, "glVertexAttribP2uiv");
+		    glad_glVertexAttribP3ui = (PFNGLVERTEXATTRIBP3UIPROC) load(userptr, "glVertexAttribP3ui");
+		    glad_glVertexAttribP3uiv = (PFNGLVERTEXATTRIBP3UIVPROC) load(userptr, "glVertexAttribP3uiv");
+		    glad_glVertexAttribP4ui = (PFNGLVERTEXATTRIBP4UIPROC) load(userptr, "glVertexAttribP4ui");
+		    glad_glVertexAttribP4uiv = (PFNGLVERTEXATTRIBP4UIVPROC) load(userptr, "glVertexAttribP4uiv");
+		}
+
+
+
+		static void glad_gl_free_extensions(char **exts_i) {
+		    if (exts_i != NULL) {
+		        unsigned int index;
+		        for(index = 0; exts_i[index]; index++) {
+		            free((void *) (exts_i[index]));
+		        }
+		        free((void *)exts_i);
+		        exts_i = NULL;
+		    }
+		}
+		static int glad_gl_get_extensions( const char **out_exts, char ***out_exts_i) {
+		#if defined(GL_ES_VERSION_3_0) || defined(GL_VERSION_3_0)
+		    if (glad_glGetStringi != NULL && glad_glGetIntegerv != NULL) {
+		        unsigned int index = 0;
+		        unsigned int num_exts_i = 0;
+		        char **exts_i = NULL;
+		        glad_glGetIntegerv(GL_NUM_EXTENSIONS, (int*) &num_exts_i);
+		        exts_i = (char **) malloc((num_exts_i + 1) * (sizeof *exts_i));
+		        if (exts_i == NULL) {
+		            return 0;
+		        }
+		        for(index = 0; index < num_exts_i; index++) {
+		            const char *gl_str_tmp = (const char*) glad_glGetStringi(GL_EXTENSIONS, index);
+		            size_t len = strlen(gl_str_tmp) + 1;
+
+		            char *local_str = (char*) malloc(len * sizeof(char));
+		            if(local_str == NULL) {
+		                exts_i[index] = NULL;
+		                glad_gl_free_extensions(exts_i);
+		                return 0;
+		            }
+
+		            memcpy(local_str, gl_str_tmp, len * sizeof(char));
+		            exts_i[index] = local_str;
+		        }
+		        exts_i[index] = NULL;
+
+		        *out_exts_i = exts_i;
+
+		        return 1;
+		    }
+		#else
+		    GLAD_UNUSED(out_exts_i);
+		#endif
+		    if (glad_glGetString == NULL) {
+		        return 0;
+		    }
+		    *out_exts = (const char *)glad_glGetString(GL_EXTENSIONS);
+		    return 1;
+		}
+		static int glad_gl_has_extension(const char *exts, char **exts_i, const char *ext) {
+		    if(exts_i) {
+		        unsigned int index;
+		        for(index = 0; exts_i[index]; index++) {
+		            const char *e = exts_i[index];
+		            if(strcmp(e, ext) == 0) {
+		                return 1;
+		            }
+		        }
+		    } else {
+		        const char *extensions;
+		        const char *loc;
+		        const char *terminator;
+		        extensions = exts;
+		        if(extensions == NULL || ext == NULL) {
+		            return 0;
+		        }
+		        while(1) {
+		            loc = strstr(extensions, ext);
+		            if(loc == NULL) {
+		                return 0;
+		            }
+		            terminator = loc + strlen(ext);
+		            if((loc == extensions || *(loc - 1) == ' ') &&
+		                (*terminator == ' ' || *terminator == '\0')) {
+		                return 1;
+		            }
+		            extensions = terminator;
+		        }
+		    }
+		    return 0;
+		}
+
+		static GLADapiproc glad_gl_get_proc_from_userptr(void *userptr, const char* name) {
+		    return (GLAD_GNUC_EXTENSION (GLADapiproc (*)(const char *name)) userptr)(name);
+		}
+
+		static int glad_gl_find_extensions_gl(void) {
+		    const char *exts = NULL;
+		    char **exts_i = NULL;
+		    if (!glad_gl_get_extensions(&exts, &exts_i)) return 0;
+
+		    GLAD_UNUSED(glad_gl_has_extension);
+
+		    glad_gl_free_extensions(exts_i);
+
+		    return 1;
+		}
+
+		static int glad_gl_find_core_gl(void) {
+		    int i;
+		    const char* version;
+		    const char* prefixes[] = {
+		        "OpenGL ES-CM ",
+		        "OpenGL ES-CL ",
+		        "OpenGL ES ",
+		        "OpenGL SC ",
+		        NULL
+		    };
+		    int major = 0;
+		    int minor = 0;
+		    version = (const char*) glad_glGetString(GL_VERSION);
+		    if (!version) return 0;
+		    for (i = 0;  prefixes[i];  i++) {
+		        const size_t length = strlen(prefixes[i]);
+		        if (strncmp(version, prefixes[i], length) == 0) {
+		            version += length;
+		            break;
+		        }
+		    }
+
+		    GLAD_IMPL_UTIL_SSCANF(version, "%d.%d", &major, &minor);
+
+		    GLAD_GL_VERSION_1_0 = (major == 1 && minor >= 0) || major > 1;
+		    GLAD_GL_VERSION_1_1 = (major == 1 && minor >= 1) || major > 1;
+		    GLAD_GL_VERSION_1_2 = (major == 1 && minor >= 2) || major > 1;
+		    GLAD_GL_VERSION_1_3 = (major == 1 && minor >= 3) || major > 1;
+		    GLAD_GL_VERSION_1_4 = (major == 1 && minor >= 4) || major > 1;
+		    GLAD_GL_VERSION_1_5 = (major == 1 && minor >= 5) || major > 1;
+		    GLAD_GL_VERSION_2_0 = (major == 2 && minor >= 0) || major > 2;
+		    GLAD_GL_VERSION_2_1 = (major == 2 && minor >= 1) || major > 2;
+		    GLAD_GL_VERSION_3_0 = (major == 3 && minor >= 0) || major > 3;
+		    GLAD_GL_VERSION_3_1 = (major == 3 && minor >= 1) || major > 3;
+		    GLAD_GL_VERSION_3_2 = (major == 3 && minor >= 2) || major > 3;
+		    GLAD_GL_VERSION_3_3 = (major == 3 && minor >= 3) || major > 3;
+
+		    return GLAD_MAKE_VERSION(major, minor);
+		}
+
+		int gladLoadGLUserPtr( GLADuserptrloadfunc load, void *userptr) {
+		    int version;
+
 		    glad_glGetString = (PFNGLGETSTRINGPROC) load(userptr, "glGetString");
-		    glad_glGetTexImage = (PFNGLGETTEXIMAGEPROC) load(userptr, "glGetTexImage");
-		    glad_glGetTexLevelParameterfv = (PFNGLGETTEXLEVELPARAMETERFVPROC) load(userptr, "glGetTexLevelParameterfv");
-		    glad_glGetTexLevelParameteriv = (PFNGLGETTEXLEVELPARAMETERIVPROC) load(userptr, "glGetTexLevelParameteriv");
-		    glad_glGetTexParameterfv = (PFNGLGETTEXPARAMETERFVPROC) load(userptr, "glGetTexParameterfv");
-		    glad_glGetTexParameteriv = (PFNGLGETTEXPARAMETERIVPROC) load(userptr, "glGetTexParameteriv");
-		    glad_glHint = (PFNGLHINTPROC) load(userptr, "glHint");
-		    glad_glIsEnabled = (PFNGLISENABLEDPROC) load(userptr, "glIsEnabled");
-		    glad_glLineWidth = (PFNGLLINEWIDTHPROC) load(userptr, "glLineWidth");
-		    glad_glLogicOp = (PFNGLLOGICOPPROC) load(userptr, "glLogicOp");
-		    glad_glPixelStoref = (PFNGLPIXELSTOREFPROC) load(userptr, "glPixelStoref");
-		    glad_glPixelStorei = (PFNGLPIXELSTOREIPROC) load(userptr, "glPixelStorei");
-		    glad_glPointSize = (PFNGLPOINTSIZEPROC) load(userptr, "glPointSize");
-		    glad_glPolygonMode = (PFNGLPOLYGONMODEPROC) load(userptr, "glPolygonMode");
-		    glad_glReadBuffer = (PFNGLREADBUFFERPROC) load(userptr, "glReadBuffer");
-		    glad_glReadPixels = (PFNGLREADPIXELSPROC) load(userptr, "glReadPixels");
-		    glad_glScissor = (PFNGLSCISSORPROC) load(userptr, "glScissor");
-		    glad_glStencilFunc = (PFNGLSTENCILFUNCPROC) load(userptr, "glStencilFunc");
-		    glad_glStencilMask = (PFNGLSTENCILMASKPROC) load(userptr, "glStencilMask");
-		    glad_glStencilOp = (PFNGLSTENCILOPPROC) load(userptr, "glStencilOp");
-		    glad_glTexImage1D = (PFNGLTEXIMAGE1DPROC) load(userptr, "glTexImage1D");
-		    glad_glTexImage2D = (PFNGLTEXIMAGE2DPROC) load(userptr, "glTexImage2D");
-		    glad_glTexParameterf = (PFNGLTEXPARAMETERFPROC) load(userptr, "glTexParameterf");
-		    glad_glTexParameterfv = (PFNGLTEXPARAMETERFVPROC) load(userptr, "glTexParameterfv");
-		    glad_glTexParameteri = (PFNGLTEXPARAMETERIPROC) load(userptr, "glTexParameteri");
-		    glad_glTexParameteriv = (PFNGLTEXPARAMETERIVPROC) load(userptr, "glTexParameteriv");
-		    glad_glViewport = (PFNGLVIEWPORTPROC) load(userptr, "glViewport");
+		    if(glad_glGetString == NULL) return 0;
+		    version = glad_gl_find_core_gl();
+
+		    glad_gl_load_GL_VERSION_1_0(load, userptr);
+		    glad_gl_load_GL_VERSION_1_1(load, userptr);
+		    glad_gl_load_GL_VERSION_1_2(load, userptr);
+		    glad_gl_load_GL_VERSION_1_3(load, userptr);
+		    glad_gl_load_GL_VERSION_1_4(load, userptr);
+		    glad_gl_load_GL_VERSION_1_5(load, userptr);
+		    glad_gl_load_GL_VERSION_2_0(load, userptr);
+		    glad_gl_load_GL_VERSION_2_1(load, userptr);
+		    glad_gl_load_GL_VERSION_3_0(load, userptr);
+		    glad_gl_load_GL_VERSION_3_1(load, userptr);
+		    glad_gl_load_GL_VERSION_3_2(load, userptr);
+		    glad_gl_load_GL_VERSION_3_3(load, userptr);
+
+		    if (!glad_gl_find_extensions_gl()) return 0;
+
+
+
+		    return version;
+		}
+
+
+		int gladLoadGL( GLADloadfunc load) {
+		    return gladLoadGLUserPtr( glad_gl_get_proc_from_userptr, GLAD_GNUC_EXTENSION (void*) load);
+		}
+
+
+
+		 
+
+		#ifdef GLAD_GL
+
+		#ifndef GLAD_LOADER_LIBRARY_C_
+		#define GLAD_LOADER_LIBRARY_C_
+
+		#include <stddef.h>
+		#include <stdlib.h>
+
+		#if GLAD_PLATFORM_WIN32
+		#include <windows.h>
+		#else
+		#include <dlfcn.h>
+		#endif
+
+
+		static void* glad_get_dlopen_handle(const char *lib_names[], int length) {
+		    void *handle = NULL;
+		    int i;
+
+		    for (i = 0; i < length; ++i) {
+		#if GLAD_PLATFORM_WIN32
+		  #if GLAD_PLATFORM_UWP
+		        size_t buffer_size = (strlen(lib_names[i]) + 1) * sizeof(WCHAR);
+		        LPWSTR buffer = (LPWSTR) malloc(buffer_size);
+		        if (buffer != NULL) {
+		            int ret = MultiByteToWideChar(CP_ACP, 0, lib_names[i], -1, buffer, buffer_size);
+		            if (ret != 0) {
+		                handle = (void*) LoadPackagedLibrary(buffer, 0);
+		            }
+		            free((void*) buffer);
+		        }
+		  #else
+		        handle = (void*) LoadLibraryA(lib_names[i]);
+		  #endif
+		#else
+		        handle = dlopen(lib_names[i], RTLD_LAZY | RTLD_LOCAL);
+		#endif
+		        if (handle != NULL) {
+		            return handle;
+		        }
+		    }
+
+		    return NULL;
+		}
+
+		static void glad_close_dlopen_handle(void* handle) {
+		    if (handle != NULL) {
+		#if GLAD_PLATFORM_WIN32
+		        FreeLibrary((HMODULE) handle);
+		#else
+		        dlclose(handle);
+		#endif
+		    }
+		}
+
+		static GLADapiproc glad_dlsym_handle(void* handle, const char *name) {
+		    if (handle == NULL) {
+		        return NULL;
+		    }
+
+		#if GLAD_PLATFORM_WIN32
+		    return (GLADapiproc) GetProcAddress((HMODULE) handle, name);
+		#else
+		    return GLAD_GNUC_EXTENSION (GLADapiproc) dlsym(handle, name);
+		#endif
+		}
+
+		#endif /* GLAD_LOADER_LIBRARY_C_ */
+
+		typedef void* (GLAD_API_PTR *GLADglprocaddrfunc)(const char*);
+		struct _glad_gl_userptr {
+		    void *handle;
+		    GLADglprocaddrfunc gl_get_proc_address_ptr;
+		};
+
+		static GLADapiproc glad_gl_get_proc(void *vuserptr, const char *name) {
+		    struct _glad_gl_userptr userptr = *(struct _glad_gl_userptr*) vuserptr;
+		    GLADapiproc result = NULL;
+
+		    if(userptr.gl_get_proc_address_ptr != NULL) {
+		        result = GLAD_GNUC_EXTENSION (GLADapiproc) userptr.gl_get_proc_address_ptr(name);
+		    }
+		    if(result == NULL) {
+		        result = glad_dlsym_handle(userptr.handle, name);
+		    }
+
+		    return result;
 		}
-		static void glad_gl_load_GL_VERSION_1_1( GLADuserptrloadfunc load, void* userptr) {
-		    if(!GLAD_GL_VERSION_1_1) return;
-		    glad_glBindTexture = (PFNGLBINDTEXTUREPROC) load(userptr, "glBindTexture");
-		    glad_glCopyTexImage1D = (PFNGLCOPYTEXIMAGE1DPROC) load(userptr, "glCopyTexImage1D");
-		    glad_glCopyTexImage2D = (PFNGLCOPYTEXIMAGE2DPROC) load(userptr, "glCopyTexImage2D");
-		    glad_glCopyTexSubImage1D = (PFNGLCOPYTEXSUBIMAGE1DPROC) load(userptr, "glCopyTexSubImage1D");
-		    glad_glCopyTexSubImage2D = (PFNGLCOPYTEXSUBIMAGE2DPROC) load(userptr, "glCopyTexSubImage2D");
-		    glad_glDeleteTextures = (PFNGLDELETETEXTURESPROC) load(userptr, "glDeleteTextures");
-		    glad_glDrawArrays = (PFNGLDRAWARRAYSPROC) load(userptr, "glDrawArrays");
-		    glad_glDrawElements = (PFNGLDRAWELEMENTSPROC) load(userptr, "glDrawElements");
-		    glad_glGenTextures = (PFNGLGENTEXTURESPROC) load(userptr, "glGenTextures");
-		    glad_glIsTexture = (PFNGLISTEXTUREPROC) load(userptr, "glIsTexture");
-		    glad_glPolygonOffset = (PFNGLPOLYGONOFFSETPROC) load(userptr, "glPolygonOffset");
-		    glad_glTexSubImage1D = (PFNGLTEXSUBIMAGE1DPROC) load(userptr, "glTexSubImage1D");
-		    glad_glTexSubImage2D = (PFNGLTEXSUBIMAGE2DPROC) load(userptr, "glTexSubImage2D");
+
+		static void* _glad_GL_loader_handle = NULL;
+
+		static void* glad_gl_dlopen_handle(void) {
+		#if GLAD_PLATFORM_APPLE
+		    static const char *NAMES[] = {
+		        "../Frameworks/OpenGL.framework/OpenGL",
+		        "/Library/Frameworks/OpenGL.framework/OpenGL",
+		        "/System/Library/Frameworks/OpenGL.framework/OpenGL",
+		        "/System/Library/Frameworks/OpenGL.framework/Versions/Current/OpenGL"
+		    };
+		#elif GLAD_PLATFORM_WIN32
+		    static const char *NAMES[] = {"opengl32.dll"};
+		#else
+		    static const char *NAMES[] = {
+		  #if defined(__CYGWIN__)
+		        "libGL-1.so",
+		  #endif
+		        "libGL.so.1",
+		        "libGL.so"
+		    };
+		#endif
+
+		    if (_glad_GL_loader_handle == NULL) {
+		        _glad_GL_loader_handle = glad_get_dlopen_handle(NAMES, sizeof(NAMES) / sizeof(NAMES[0]));
+		    }
+
+		    return _glad_GL_loader_handle;
 		}
-		static void glad_gl_load_GL_VERSION_1_2( GLADuserptrloadfunc load, void* userptr) {
-		    if(!GLAD_GL_VERSION_1_2) return;
-		    glad_glCopyTexSubImage3D = (PFNGLCOPYTEXSUBIMAGE3DPROC) load(userptr, "glCopyTexSubImage3D");
-		    glad_glDrawRangeElements = (PFNGLDRAWRANGEELEMENTSPROC) load(userptr, "glDrawRangeElements");
-		    glad_glTexImage3D = (PFNGLTEXIMAGE3DPROC) load(userptr, "glTexImage3D");
-		    glad_glTexSubImage3D = (PFNGLTEXSUBIMAGE3DPROC) load(userptr, "glTexSubImage3D");
+
+		static struct _glad_gl_userptr glad_gl_build_userptr(void *handle) {
+		    struct _glad_gl_userptr userptr;
+
+		    userptr.handle = handle;
+		#if GLAD_PLATFORM_APPLE || defined(__HAIKU__)
+		    userptr.gl_get_proc_address_ptr = NULL;
+		#elif GLAD_PLATFORM_WIN32
+		    userptr.gl_get_proc_address_ptr =
+		        (GLADglprocaddrfunc) glad_dlsym_handle(handle, "wglGetProcAddress");
+		#else
+		    userptr.gl_get_proc_address_ptr =
+		        (GLADglprocaddrfunc) glad_dlsym_handle(handle, "glXGetProcAddressARB");
+		#endif
+
+		    return userptr;
 		}
-		static void glad_gl_load_GL_VERSION_1_3( GLADuserptrloadfunc load, void* userptr) {
-		    if(!GLAD_GL_VERSION_1_3) return;
-		    glad_glActiveTexture = (PFNGLACTIVETEXTUREPROC) load(userptr, "glActiveTexture");
-		    glad_glCompressedTexImage1D = (PFNGLCOMPRESSEDTEXIMAGE1DPROC) load(userptr, "glCompressedTexImage1D");
-		    glad_glCompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC) load(userptr, "glCompressedTexImage2D");
-		    glad_glCompressedTexImage3D = (PFNGLCOMPRESSEDTEXIMAGE3DPROC) load(userptr, "glCompressedTexImage3D");
-		    glad_glCompressedTexSubImage1D = (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC) load(userptr, "glCompressedTexSubImage1D");
-		    glad_glCompressedTexSubImage2D = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC) load(userptr, "glCompressedTexSubImage2D");
-		    glad_glCompressedTexSubImage3D = (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC) load(userptr, "glCompressedTexSubImage3D");
-		    glad_glGetCompressedTexImage = (PFNGLGETCOMPRESSEDTEXIMAGEPROC) load(userptr, "glGetCompressedTexImage");
-		    glad_glSampleCoverage = (PFNGLSAMPLECOVERAGEPROC) load(userptr, "glSampleCoverage");
+
+		int gladLoaderLoadGL(void) {
+		    int version = 0;
+		    void *handle;
+		    int did_load = 0;
+		    struct _glad_gl_userptr userptr;
+
+		    did_load = _glad_GL_loader_handle == NULL;
+		    handle = glad_gl_dlopen_handle();
+		    if (handle) {
+		        userptr = glad_gl_build_userptr(handle);
+
+		        version = gladLoadGLUserPtr(glad_gl_get_proc, &userptr);
+
+		        if (did_load) {
+		            gladLoaderUnloadGL();
+		        }
+		    }
+
+		    return version;
 		}
-		static void glad_gl_load_GL_VERSION_1_4( GLADuserptrloadfunc load, void* userptr) {
-		    if(!GLAD_GL_VERSION_1_4) return;
-		    glad_glBlendColor = (PFNGLBLENDCOLORPROC) load(userptr, "glBlendColor");
-		    glad_glBlendEquation = (PFNGLBLENDEQUATIONPROC) load(userptr, "glBlendEquation");
-		    glad_glBlendFuncSeparate = (PFNGLBLENDFUNCSEPARATEPROC) load(userptr, "glBlendFuncSeparate");
-		    glad_glMultiDrawArrays = (PFNGLMULTIDRAWARRAYSPROC) load(userptr, "glMultiDrawArrays");
-		    glad_glMultiDrawElements = (PFNGLMULTIDRAWELEMENTSPROC) load(userptr, "glMultiDrawElements");
-		    glad_glPointParameterf = (PFNGLPOINTPARAMETERFPROC) load(userptr, "glPointParameterf");
-		    glad_glPointParameterfv = (PFNGLPOINTPARAMETERFVPROC) load(userptr, "glPointParameterfv");
-		    glad_glPointParameteri = (PFNGLPOINTPARAMETERIPROC) load(userptr, "glPointParameteri");
-		    glad_glPointParameteriv = (PFNGLPOINTPARAMETERIVPROC) load(userptr, "glPointParameteriv");
+
+
+
+		void gladLoaderUnloadGL(void) {
+		    if (_glad_GL_loader_handle != NULL) {
+		        glad_close_dlopen_handle(_glad_GL_loader_handle);
+		        _glad_GL_loader_handle = NULL;
+		    }
 		}
-		static void glad_gl_load_GL_VERSION_1_5( GLADuserptrloadfunc load, void* userptr) {
-		    if(!GLAD_GL_VERSION_1_5) return;
-		    glad_glBeginQuery = (PFNGLBEGINQUERYPROC) load(userptr, "glBeginQuery");
-		    glad_glBindBuffer = (PFNGLBINDBUFFERPROC) load(userptr, "glBindBuffer");
-		    glad_glBufferData = (PFNGLBUFFERDATAPROC) load(userptr, "glBufferData");
-		    glad_glBufferSubData = (PFNGLBUFFERSUBDATAPROC) load(userptr, "glBufferSubData");
-		    glad_glDeleteBuffers = (PFNGLDELETEBUFFERSPROC) load(userptr, "glDeleteBuffers");
-		    glad_glDeleteQueries = (PFNGLDELETEQUERIESPROC) load(userptr, "glDeleteQueries");
-		    glad_glEndQuery = (PFNGLENDQUERYPROC) load(userptr, "glEndQuery");
-		    glad_glGenBuffers = (PFNGLGENBUFFERSPROC) load(userptr, "glGenBuffers");
-		    glad_glGenQueries = (PFNGLGENQUERIESPROC) load(userptr, "glGenQueries");
-		    glad_glGetBufferParameteriv = (PFNGLGETBUFFERPARAMETERIVPROC) load(userptr, "glGetBufferParameteriv");
-		    glad_glGetBufferPointerv = (PFNGLGETBUFFERPOINTERVPROC) load(userptr, "glGetBufferPointerv");
-		    glad_glGetBufferSubData = (PFNGLGETBUFFERSUBDATAPROC) load(userptr, "glGetBufferSubData");
-		    glad_glGetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC) load(userptr, "glGetQueryObjectiv");
-		    glad_glGetQueryObjectuiv = (PFNGLGETQUERYOBJECTUIVPROC) load(userptr, "glGetQueryObjectuiv");
-		    glad_glGetQueryiv = (PFNGLGETQUERYIVPROC) load(userptr, "glGetQueryiv");
-		    glad_glIsBuffer = (PFNGLISBUFFERPROC) load(userptr, "glIsBuffer");
-		    glad_glIsQuery = (PFNGLISQUERYPROC) load(userptr, "glIsQuery");
-		    glad_glMapBuffer = (PFNGLMAPBUFFERPROC) load(userptr, "glMapBuffer");
-		    glad_glUnmapBuffer = (PFNGLUNMAPBUFFERPROC) load(userptr, "glUnmapBuffer");
+
+		#endif /* GLAD_GL */
+
+		#ifdef __cplusplus
 		}
-		static void glad_gl_load_GL_VERSION_2_0( GLADuserptrloadfunc load, void* userptr) {
-		    if(!GLAD_GL_VERSION_2_0) return;
-		    glad_glAttachShader = (PFNGLATTACHSHADERPROC) load(userptr, "glAttachShader");
-		    glad_glBindAttribLocation = (PFNGLBINDATTRIBLOCATIONPROC) load(userptr, "glBindAttribLocation");
-		    glad_glBlendEquationSeparate = (PFNGLBLENDEQUATIONSEPARATEPROC) load(userptr, "glBlendEquationSeparate");
-		    glad_glCompileShader = (PFNGLCOMPILESHADERPROC) load(userptr, "glCompileShader");
-		    glad_glCreateProgram = (PFNGLCREATEPROGRAMPROC) load(userptr, "glCreateProgram");
-		    glad_glCreateShader = (PFNGLCREATESHADERPROC) load(userptr, "glCreateShader");
-		    glad_glDeleteProgram = (PFNGLDELETEPROGRAMPROC) load(userptr, "glDeleteProgram");
-		    glad_glDeleteShader = (PFNGLDELETESHADERPROC) load(userptr, "glDeleteShader");
-		    glad_glDetachShader = (PFNGLDETACHSHADERPROC) load(userptr, "glDetachShader");
-		    glad_glDisableVertexAttribArray = (PFNGLDISABLEVERTEXATTRIBARRAYPROC) load(userptr, "glDisableVertexAttribArray");
-		    glad_glDrawBuffers = (PFNGLDRAWBUFFERSPROC) load(userptr, "glDrawBuffers");
-		    glad_glEnableVertexAttribArray = (PFNGLENABLEVERTEXATTRIBARRAYPROC) load(userptr, "glEnableVertexAttribArray");
-		    glad_glGetActiveAttrib = (PFNGLGETACTIVEATTRIBPROC) load(userptr, "glGetActiveAttrib");
-		    glad_glGetActiveUniform = (PFNGLGETACTIVEUNIFORMPROC) load(userptr, "glGetActiveUniform");
-		    glad_glGetAttachedShaders = (PFNGLGETATTACHEDSHADERSPROC) load(userptr, "glGetAttachedShaders");
-		    glad_glGetAttribLocation = (PFNGLGETATTRIBLOCATIONPROC) load(userptr, "glGetAttribLocation");
-		    glad_glGetProgramInfoLog = (PFNGLGETPROGRAMINFOLOGPROC) load(userptr, "glGetProgramInfoLog");
-		    glad_glGetProgramiv = (PFNGLGETPROGRAMIVPROC) load(userptr, "glGetProgramiv");
-		    glad_glGetShaderInfoLog = (PFNGLGETSHADERINFOLOGPROC) load(userptr, "glGetShaderInfoLog");
-		    glad_glGetShaderSource = (PFNGLGETSHADERSOURCEPROC) load(userptr, "glGetShaderSource");
-		    glad_glGetShaderiv = (PFNGLGETSHADERIVPROC) load(userptr, "glGetShaderiv");
-		    glad_glGetUniformLocation = (PFNGLGETUNIFORMLOCATIONPROC) load(userptr, "glGetUniformLocation");
-		    glad_glGetUniformfv = (PFNGLGETUNIFORMFVPROC) load(userptr, "glGetUniformfv");
-		    glad_glGetUniformiv = (PFNGLGETUNIFORMIVPROC) load(userptr, "glGetUniformiv");
-		    glad_glGetVertexAttribPointerv = (PFNGLGETVERTEXATTRIBPOINTERVPROC) load(userptr, "glGetVertexAttribPointerv");
-		    glad_glGetVertexAttribdv = (PFNGLGETVERTEXATTRIBDVPROC) load(userptr, "glGetVertexAttribdv");
-		    glad_glGetVertexAttribfv = (PFNGLGETVERTEXATTRIBFVPROC) load(userptr, "glGetVertexAttribfv");
-		    glad_glGetVertexAttribiv = (PFNGLGETVERTEXATTRIBIVPROC) load(userptr, "glGetVertexAttribiv");
-		    glad_glIsProgram = (PFNGLISPROGRAMPROC) load(userptr, "glIsProgram");
-		    glad_glIsShader = (PFNGLISSHADERPROC) load(userptr, "glIsShader");
-		    glad_glLinkProgram = (PFNGLLINKPROGRAMPROC) load(userptr, "glLinkProgram");
-		    glad_glShaderSource = (PFNGLSHADERSOURCEPROC) load(userptr, "glShaderSource");
-		    glad_glStencilFuncSeparate = (PFNGLSTENCILFUNCSEPARATEPROC) load(userptr, "glStencilFuncSeparate");
-		    glad_glStencilMaskSeparate = (PFNGLSTENCILMASKSEPARATEPROC) load(userptr, "glStencilMaskSeparate");
-		    glad_glStencilOpSeparate = (PFNGLSTENCILOPSEPARATEPROC) load(userptr, "glStencilOpSeparate");
-		    glad_glUniform1f = (PFNGLUNIFORM1FPROC) load(userptr, "glUniform1f");
-		    glad_glUniform1fv = (PFNGLUNIFORM1FVPROC) load(userptr, "glUniform1fv");
-		    glad_glUniform1i = (PFNGLUNIFORM1IPROC) load(userptr, "glUniform1i");
-		    glad_glUniform1iv = (PFNGLUNIFORM1IVPROC) load(userptr, "glUniform1iv");
-		    glad_glUniform2f = (PFNGLUNIFORM2FPROC) load(userptr, "glUniform2f");
-		    glad_glUniform2fv = (PFNGLUNIFORM2FVPROC) load(userptr, "glUniform2fv");
-		    glad_glUniform2i = (PFNGLUNIFORM2IPROC) load(userptr, "glUniform2i");
-		    glad_glUniform2iv = (PFNGLUNIFORM2IVPROC) load(userptr, "glUniform2iv");
-		    glad_glUniform3f = (PFNGLUNIFORM3FPROC) load(userptr, "glUniform3f");
-		    glad_glUniform3fv = (PFNGLUNIFORM3FVPROC) load(userptr, "glUniform3fv");
-		    glad_glUniform3i = (PFNGLUNIFORM3IPROC) load(userptr, "glUniform3i");
-		    glad_glUniform3iv = (PFNGLUNIFORM3IVPROC) load(userptr, "glUniform3iv");
-		    glad_glUniform4f = (PFNGLUNIFORM4FPROC) load(userptr, "glUniform4f");
-		    glad_glUniform4fv = (PFNGLUNIFORM4FVPROC) load(userptr, "glUniform4fv");
-		    glad_glUniform4i = (PFNGLUNIFORM4IPROC) load(userptr, "glUniform4i");
-		    glad_glUniform4iv = (PFNGLUNIFORM4IVPROC) load(userptr, "glUniform4iv");
-		    glad_glUniformMatrix2fv = (PFNGLUNIFORMMATRIX2FVPROC) load(userptr, "glUniformMatrix2fv");
-		    glad_glUniformMatrix3fv = (PFNGLUNIFORMMATRIX3FVPROC) load(userptr, "glUniformMatrix3fv");
-		    glad_glUniformMatrix4fv = (PFNGLUNIFORMMATRIX4FVPROC) load(userptr, "glUniformMatrix4fv");
-		    glad_glUseProgram = (PFNGLUSEPROGRAMPROC) load(userptr, "glUseProgram");
-		    glad_glValidateProgram = (PFNGLVALIDATEPROGRAMPROC) load(userptr, "glValidateProgram");
-		    glad_glVertexAttrib1d = (PFNGLVERTEXATTRIB1DPROC) load(userptr, "glVertexAttrib1d");
-		    glad_glVertexAttrib1dv = (PFNGLVERTEXATTRIB1DVPROC) load(userptr, "glVertexAttrib1dv");
-		    glad_glVertexAttrib1f = (PFNGLVERTEXATTRIB1FPROC) load(userptr, "glVertexAttrib1f");
-		    glad_glVertexAttrib1fv = (PFNGLVERTEXATTRIB1FVPROC) load(userptr, "glVertexAttrib1fv");
-		    glad_glVertexAttrib1s = (PFNGLVERTEXATTRIB1SPROC) load(userptr, "glVertexAttrib1s");
-		    glad_glVertexAttrib1sv = (PFNGLVERTEXATTRIB1SVPROC) load(userptr, "glVertexAttrib1sv");
-		    glad_glVertexAttrib2d = (PFNGLVERTEXATTRIB2DPROC) load(userptr, "glVertexAttrib2d");
-		    glad_glVertexAttrib2dv = (PFNGLVERTEXATTRIB2DVPROC) load(userptr, "glVertexAttrib2dv");
-		    glad_glVertexAttrib2f = (PFNGLVERTEXATTRIB2FPROC) load(userptr, "glVertexAttrib2f");
-		    glad_glVertexAttrib2fv = (PFNGLVERTEXATTRIB2FVPROC) load(userptr, "glVertexAttrib2fv");
-		    glad_glVertexAttrib2s = (PFNGLVERTEXATTRIB2SPROC) load(userptr, "glVertexAttrib2s");
-		    glad_glVertexAttrib2sv = (PFNGLVERTEXATTRIB2SVPROC) load(userptr, "glVertexAttrib2sv");
-		    glad_glVertexAttrib3d = (PFNGLVERTEXATTRIB3DPROC) load(userptr, "glVertexAttrib3d");
-		    glad_glVertexAttrib3dv = (PFNGLVERTEXATTRIB3DVPROC) load(userptr, "glVertexAttrib3dv");
-		    glad_glVertexAttrib3f = (PFNGLVERTEXATTRIB3FPROC) load(userptr, "glVertexAttrib3f");
-		    glad_glVertexAttrib3fv = (PFNGLVERTEXATTRIB3FVPROC) load(userptr, "glVertexAttrib3fv");
-		    glad_glVertexAttrib3s = (PFNGLVERTEXATTRIB3SPROC) load(userptr, "glVertexAttrib3s");
-		    glad_glVertexAttrib3sv = (PFNGLVERTEXATTRIB3SVPROC) load(userptr, "glVertexAttrib3sv");
-		    glad_glVertexAttrib4Nbv = (PFNGLVERTEXATTRIB4NBVPROC) load(userptr, "glVertexAttrib4Nbv");
-		    glad_glVertexAttrib4Niv = (PFNGLVERTEXATTRIB4NIVPROC) load(userptr, "glVertexAttrib4Niv");
-		    glad_glVertexAttrib4Nsv = (PFNGLVERTEXATTRIB4NSVPROC) load(userptr, "glVertexAttrib4Nsv");
-		    glad_glVertexAttrib4Nub = (PFNGLVERTEXATTRIB4NUBPROC) load(userptr, "glVertexAttrib4Nub");
-		    glad_glVertexAttrib4Nubv = (PFNGLVERTEXATTRIB4NUBVPROC) load(userptr, "glVertexAttrib4Nubv");
-		    glad_glVertexAttrib4Nuiv = (PFNGLVERTEXATTRIB4NUIVPROC) load(userptr, "glVertexAttrib4Nuiv");
-		    glad_glVertexAttrib4Nusv = (PFNGLVERTEXATTRIB4NUSVPROC) load(userptr, "glVertexAttrib4Nusv");
-		    glad_glVertexAttrib4bv = (PFNGLVERTEXATTRIB4BVPROC) load(userptr, "glVertexAttrib4bv");
-		    glad_glVertexAttrib4d = (PFNGLVERTEXATTRIB4DPROC) load(userptr, "glVertexAttrib4d");
-		    glad_glVertexAttrib4dv = (PFNGLVERTEXATTRIB4DVPROC) load(userptr, "glVertexAttrib4dv");
-		    glad_glVertexAttrib4f = (PFNGLVERTEXATTRIB4FPROC) load(userptr, "glVertexAttrib4f");
-		    glad_glVertexAttrib4fv = (PFNGLVERTEXATTRIB4FVPROC) load(userptr, "glVertexAttrib4fv");
-		    glad_glVertexAttrib4iv = (PFNGLVERTEXATTRIB4IVPROC) load(userptr, "glVertexAttrib4iv");
-		    glad_glVertexAttrib4s = (PFNGLVERTEXATTRIB4SPROC) load(userptr, "glVertexAttrib4s");
-		    glad_glVertexAttrib4sv = (PFNGLVERTEXATTRIB4SVPROC) load(userptr, "glVertexAttrib4sv");
-		    glad_glVertexAttrib4ubv = (PFNGLVERTEXATTRIB4UBVPROC) load(userptr, "glVertexAttrib4ubv");
-		    glad_glVertexAttrib4uiv = (PFNGLVERTEXATTRIB4UIVPROC) load(userptr, "glVertexAttrib4uiv");
-		    glad_glVertexAttrib4usv = (PFNGLVERTEXATTRIB4USVPROC) load(userptr, "glVertexAttrib4usv");
-		    glad_glVertexAttribPointer = (PFNGLVERTEXATTRIBPOINTERPROC) load(userptr, "glVertexAttribPointer");
+		#endif
+	//#endif /* GLAD_GL_IMPLEMENTATION */
+	#endif /* MU_SUPPORT_OPENGL */
+
+	MU_CPP_EXTERN_START
+
+	/* Allocation */
+
+		// Context whose allocator is used (0 if none, in which case mu_malloc is used)
+		// This is a non-threadsafe solution that requires
+		// no more than one mug context to be created at
+		// one time within the program.
+		mugContext* mug_alloc_context = 0;
+
+		// Allocates memory via the context's allocator
+		void* mug_alloc(size_m size, mugAllocCategory category) {
+			mugContext* context = mug_alloc_context;
+			if (!context) {
+				return mu_malloc(size);
+			}
+			++context->alloc_counts[category].allocs;
+			context->alloc_counts[category].bytes += size;
+			return context->allocator.alloc(context->allocator.user, size, category);
+		}
+
+		// Reallocates memory via the context's allocator
+		void* mug_realloc(void* ptr, size_m size, mugAllocCategory category) {
+			mugContext* context = mug_alloc_context;
+			if (!context) {
+				return mu_realloc(ptr, size);
+			}
+			++context->alloc_counts[category].reallocs;
+			context->alloc_counts[category].bytes += size;
+			return context->allocator.realloc(context->allocator.user, ptr, size, category);
 		}
-		static void glad_gl_load_GL_VERSION_2_1( GLADuserptrloadfunc load, void* userptr) {
-		    if(!GLAD_GL_VERSION_2_1) return;
-		    glad_glUniformMatrix2x3fv = (PFNGLUNIFORMMATRIX2X3FVPROC) load(userptr, "glUniformMatrix2x3fv");
-		    glad_glUniformMatrix2x4fv = (PFNGLUNIFORMMATRIX2X4FVPROC) load(userptr, "glUniformMatrix2x4fv");
-		    glad_glUniformMatrix3x2fv = (PFNGLUNIFORMMATRIX3X2FVPROC) load(userptr, "glUniformMatrix3x2fv");
-		    glad_glUniformMatrix3x4fv = (PFNGLUNIFORMMATRIX3X4FVPROC) load(userptr, "glUniformMatrix3x4fv");
-		    glad_glUniformMatrix4x2fv = (PFNGLUNIFORMMATRIX4X2FVPROC) load(userptr, "glUniformMatrix4x2fv");
-		    glad_glUniformMatrix4x3fv = (PFNGLUNIFORMMATRIX4X3FVPROC) load(userptr, "glUniformMatrix4x3fv");
+
+		// Frees memory via the context's allocator
+		void mug_dealloc(void* ptr, mugAllocCategory category) {
+			mugContext* context = mug_alloc_context;
+			if (!ptr) {
+				return;
+			}
+			if (!context) {
+				mu_free(ptr);
+				return;
+			}
+			++context->alloc_counts[category].frees;
+			context->allocator.free(context->allocator.user, ptr, category);
 		}
-		static void glad_gl_load_GL_VERSION_3_0( GLADuserptrloadfunc load, void* userptr) {
-		    if(!GLAD_GL_VERSION_3_0) return;
-		    glad_glBeginConditionalRender = (PFNGLBEGINCONDITIONALRENDERPROC) load(userptr, "glBeginConditionalRender");
-		    glad_glBeginTransformFeedback = (PFNGLBEGINTRANSFORMFEEDBACKPROC) load(userptr, "glBeginTransformFeedback");
-		    glad_glBindBufferBase = (PFNGLBINDBUFFERBASEPROC) load(userptr, "glBindBufferBase");
-		    glad_glBindBufferRange = (PFNGLBINDBUFFERRANGEPROC) load(userptr, "glBindBufferRange");
-		    glad_glBindFragDataLocation = (PFNGLBINDFRAGDATALOCATIONPROC) load(userptr, "glBindFragDataLocation");
-		    glad_glBindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC) load(userptr, "glBindFramebuffer");
-		    glad_glBindRenderbuffer = (PFNGLBINDRENDERBUFFERPROC) load(userptr, "glBindRenderbuffer");
-		    glad_glBindVertexArray = (PFNGLBINDVERTEXARRAYPROC) load(userptr, "glBindVertexArray");
-		    glad_glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC) load(userptr, "glBlitFramebuffer");
-		    glad_glCheckFramebufferStatus = (PFNGLCHECKFRAMEBUFFERSTATUSPROC) load(userptr, "glCheckFramebufferStatus");
-		    glad_glClampColor = (PFNGLCLAMPCOLORPROC) load(userptr, "glClampColor");
-		    glad_glClearBufferfi = (PFNGLCLEARBUFFERFIPROC) load(userptr, "glClearBufferfi");
-		    glad_glClearBufferfv = (PFNGLCLEARBUFFERFVPROC) load(userptr, "glClearBufferfv");
-		    glad_glClearBufferiv = (PFNGLCLEARBUFFERIVPROC) load(userptr, "glClearBufferiv");
-		    glad_glClearBufferuiv = (PFNGLCLEARBUFFERUIVPROC) load(userptr, "glClearBufferuiv");
-		    glad_glColorMaski = (PFNGLCOLORMASKIPROC) load(userptr, "glColorMaski");
-		    glad_glDeleteFramebuffers = (PFNGLDELETEFRAMEBUFFERSPROC) load(userptr, "glDeleteFramebuffers");
-		    glad_glDeleteRenderbuffers = (PFNGLDELETERENDERBUFFERSPROC) load(userptr, "glDeleteRenderbuffers");
-		    glad_glDeleteVertexArrays = (PFNGLDELETEVERTEXARRAYSPROC) load(userptr, "glDeleteVertexArrays");
-		    glad_glDisablei = (PFNGLDISABLEIPROC) load(userptr, "glDisablei");
-		    glad_glEnablei = (PFNGLENABLEIPROC) load(userptr, "glEnablei");
-		    glad_glEndConditionalRender = (PFNGLENDCONDITIONALRENDERPROC) load(userptr, "glEndConditionalRender");
-		    glad_glEndTransformFeedback = (PFNGLENDTRANSFORMFEEDBACKPROC) load(userptr, "glEndTransformFeedback");
-		    glad_glFlushMappedBufferRange = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC) load(userptr, "glFlushMappedBufferRange");
-		    glad_glFramebufferRenderbuffer = (PFNGLFRAMEBUFFERRENDERBUFFERPROC) load(userptr, "glFramebufferRenderbuffer");
-		    glad_glFramebufferTexture1D = (PFNGLFRAMEBUFFERTEXTURE1DPROC) load(userptr, "glFramebufferTexture1D");
-		    glad_glFramebufferTexture2D = (PFNGLFRAMEBUFFERTEXTURE2DPROC) load(userptr, "glFramebufferTexture2D");
-		    glad_glFramebufferTexture3D = (PFNGLFRAMEBUFFERTEXTURE3DPROC) load(userptr, "glFramebufferTexture3D");
-		    glad_glFramebufferTextureLayer = (PFNGLFRAMEBUFFERTEXTURELAYERPROC) load(userptr, "glFramebufferTextureLayer");
-		    glad_glGenFramebuffers = (PFNGLGENFRAMEBUFFERSPROC) load(userptr, "glGenFramebuffers");
-		    glad_glGenRenderbuffers = (PFNGLGENRENDERBUFFERSPROC) load(userptr, "glGenRenderbuffers");
-		    glad_glGenVertexArrays = (PFNGLGENVERTEXARRAYSPROC) load(userptr, "glGenVertexArrays");
-		    glad_glGenerateMipmap = (PFNGLGENERATEMIPMAPPROC) load(userptr, "glGenerateMipmap");
-		    glad_glGetBooleani_v = (PFNGLGETBOOLEANI_VPROC) load(userptr, "glGetBooleani_v");
-		    glad_glGetFragDataLocation = (PFNGLGETFRAGDATALOCATIONPROC) load(userptr, "glGetFragDataLocation");
-		    glad_glGetFramebufferAttachmentParameteriv = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC) load(userptr, "glGetFramebufferAttachmentParameteriv");
-		    glad_glGetIntegeri_v = (PFNGLGETINTEGERI_VPROC) load(userptr, "glGetIntegeri_v");
-		    glad_glGetRenderbufferParameteriv = (PFNGLGETRENDERBUFFERPARAMETERIVPROC) load(userptr, "glGetRenderbufferParameteriv");
-		    glad_glGetStringi = (PFNGLGETSTRINGIPROC) load(userptr, "glGetStringi");
-		    glad_glGetTexParameterIiv = (PFNGLGETTEXPARAMETERIIVPROC) load(userptr, "glGetTexParameterIiv");
-		    glad_glGetTexParameterIuiv = (PFNGLGETTEXPARAMETERIUIVPROC) load(userptr, "glGetTexParameterIuiv");
-		    glad_glGetTransformFeedbackVarying = (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC) load(userptr, "glGetTransformFeedbackVarying");
-		    glad_glGetUniformuiv = (PFNGLGETUNIFORMUIVPROC) load(userptr, "glGetUniformuiv");
-		    glad_glGetVertexAttribIiv = (PFNGLGETVERTEXATTRIBIIVPROC) load(userptr, "glGetVertexAttribIiv");
-		    glad_glGetVertexAttribIuiv = (PFNGLGETVERTEXATTRIBIUIVPROC) load(userptr, "glGetVertexAttribIuiv");
-		    glad_glIsEnabledi = (PFNGLISENABLEDIPROC) load(userptr, "glIsEnabledi");
-		    glad_glIsFramebuffer = (PFNGLISFRAMEBUFFERPROC) load(userptr, "glIsFramebuffer");
-		    glad_glIsRenderbuffer = (PFNGLISRENDERBUFFERPROC) load(userptr, "glIsRenderbuffer");
-		    glad_glIsVertexArray = (PFNGLISVERTEXARRAYPROC) load(userptr, "glIsVertexArray");
-		    glad_glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC) load(userptr, "glMapBufferRange");
-		    glad_glRenderbufferStorage = (PFNGLRENDERBUFFERSTORAGEPROC) load(userptr, "glRenderbufferStorage");
-		    glad_glRenderbufferStorageMultisample = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC) load(userptr, "glRenderbufferStorageMultisample");
-		    glad_glTexParameterIiv = (PFNGLTEXPARAMETERIIVPROC) load(userptr, "glTexParameterIiv");
-		    glad_glTexParameterIuiv = (PFNGLTEXPARAMETERIUIVPROC) load(userptr, "glTexParameterIuiv");
-		    glad_glTransformFeedbackVaryings = (PFNGLTRANSFORMFEEDBACKVARYINGSPROC) load(userptr, "glTransformFeedbackVaryings");
-		    glad_glUniform1ui = (PFNGLUNIFORM1UIPROC) load(userptr, "glUniform1ui");
-		    glad_glUniform1uiv = (PFNGLUNIFORM1UIVPROC) load(userptr, "glUniform1uiv");
-		    glad_glUniform2ui = (PFNGLUNIFORM2UIPROC) load(userptr, "glUniform2ui");
-		    glad_glUniform2uiv = (PFNGLUNIFORM2UIVPROC) load(userptr, "glUniform2uiv");
-		    glad_glUniform3ui = (PFNGLUNIFORM3UIPROC) load(userptr, "glUniform3ui");
-		    glad_glUniform3uiv = (PFNGLUNIFORM3UIVPROC) load(userptr, "glUniform3uiv");
-		    glad_glUniform4ui = (PFNGLUNIFORM4UIPROC) load(userptr, "glUniform4ui");
-		    glad_glUniform4uiv = (PFNGLUNIFORM4UIVPROC) load(userptr, "glUniform4uiv");
-		    glad_glVertexAttribI1i = (PFNGLVERTEXATTRIBI1IPROC) load(userptr, "glVertexAttribI1i");
-		    glad_glVertexAttribI1iv = (PFNGLVERTEXATTRIBI1IVPROC) load(userptr, "glVertexAttribI1iv");
-		    glad_glVertexAttribI1ui = (PFNGLVERTEXATTRIBI1UIPROC) load(userptr, "glVertexAttribI1ui");
-		    glad_glVertexAttribI1uiv = (PFNGLVERTEXATTRIBI1UIVPROC) load(userptr, "glVertexAttribI1uiv");
-		    glad_glVertexAttribI2i = (PFNGLVERTEXATTRIBI2IPROC) load(userptr, "glVertexAttribI2i");
-		    glad_glVertexAttribI2iv = (PFNGLVERTEXATTRIBI2IVPROC) load(userptr, "glVertexAttribI2iv");
-		    glad_glVertexAttribI2ui = (PFNGLVERTEXATTRIBI2UIPROC) load(userptr, "glVertexAttribI2ui");
-		    glad_glVertexAttribI2uiv = (PFNGLVERTEXATTRIBI2UIVPROC) load(userptr, "glVertexAttribI2uiv");
-		    glad_glVertexAttribI3i = (PFNGLVERTEXATTRIBI3IPROC) load(userptr, "glVertexAttribI3i");
-		    glad_glVertexAttribI3iv = (PFNGLVERTEXATTRIBI3IVPROC) load(userptr, "glVertexAttribI3iv");
-		    glad_glVertexAttribI3ui = (PFNGLVERTEXATTRIBI3UIPROC) load(userptr, "glVertexAttribI3ui");
-		    glad_glVertexAttribI3uiv = (PFNGLVERTEXATTRIBI3UIVPROC) load(userptr, "glVertexAttribI3uiv");
-		    glad_glVertexAttribI4bv = (PFNGLVERTEXATTRIBI4BVPROC) load(userptr, "glVertexAttribI4bv");
-		    glad_glVertexAttribI4i = (PFNGLVERTEXATTRIBI4IPROC) load(userptr, "glVertexAttribI4i");
-		    glad_glVertexAttribI4iv = (PFNGLVERTEXATTRIBI4IVPROC) load(userptr, "glVertexAttribI4iv");
-		    glad_glVertexAttribI4sv = (PFNGLVERTEXATTRIBI4SVPROC) load(userptr, "glVertexAttribI4sv");
-		    glad_glVertexAttribI4ubv = (PFNGLVERTEXATTRIBI4UBVPROC) load(userptr, "glVertexAttribI4ubv");
-		    glad_glVertexAttribI4ui = (PFNGLVERTEXATTRIBI4UIPROC) load(userptr, "glVertexAttribI4ui");
-		    glad_glVertexAttribI4uiv = (PFNGLVERTEXATTRIBI4UIVPROC) load(userptr, "glVertexAttribI4uiv");
-		    glad_glVertexAttribI4usv = (PFNGLVERTEXATTRIBI4USVPROC) load(userptr, "glVertexAttribI4usv");
-		    glad_glVertexAttribIPointer = (PFNGLVERTEXATTRIBIPOINTERPROC) load(userptr, "glVertexAttribIPointer");
+
+		/* Default allocator */
+
+			void* mug_default_alloc(void* user, size_m size, mugAllocCategory category) {
+				return mu_malloc(size); if (user) {} if (category) {}
+			}
+
+			void* mug_default_realloc(void* user, void* ptr, size_m size, mugAllocCategory category) {
+				return mu_realloc(ptr, size); if (user) {} if (category) {}
+			}
+
+			void mug_default_free(void* user, void* ptr, mugAllocCategory category) {
+				mu_free(ptr);
+				return; if (user) {} if (category) {}
+			}
+
+			MUDEF mugAllocator mug_default_allocator(void) {
+				mugAllocator allocator;
+				allocator.alloc = mug_default_alloc;
+				allocator.realloc = mug_default_realloc;
+				allocator.free = mug_default_free;
+				allocator.user = 0;
+				return allocator;
+			}
+
+		/* Block pool allocator */
+
+			// Size of the header at the start of each chunk (holding the next chunk),
+			// and alignment of blocks
+			#define MUG_BLOCK_ALIGN 16
+
+			// Distance between blocks
+			size_m mug_block_pool_stride(mugBlockPool* pool) {
+				size_m size = (pool->block_size < sizeof(void*)) ? (sizeof(void*)) : (pool->block_size);
+				return (size + MUG_BLOCK_ALIGN-1) & ~((size_m)MUG_BLOCK_ALIGN-1);
+			}
+
+			// Returns whether or not memory belongs to a pool's chunks
+			muBool mug_block_pool_owns(mugBlockPool* pool, void* ptr) {
+				size_m size = mug_block_pool_stride(pool) * pool->chunk_blocks;
+				for (muByte* chunk = (muByte*)pool->chunks; chunk; chunk = *(muByte**)chunk) {
+					muByte* blocks = &chunk[MUG_BLOCK_ALIGN];
+					if ((muByte*)ptr >= blocks && (muByte*)ptr < &blocks[size]) {
+						return MU_TRUE;
+					}
+				}
+				return MU_FALSE;
+			}
+
+			void* mug_block_pool_alloc(void* user, size_m size, mugAllocCategory category) {
+				mugBlockPool* pool = (mugBlockPool*)user;
+				if (category != pool->category) {
+					return pool->parent.alloc(pool->parent.user, size, category);
+				}
+				if (!pool->block_size) {
+					pool->block_size = size;
+				}
+				if (size > pool->block_size) {
+					return pool->parent.alloc(pool->parent.user, size, category);
+				}
+
+				// Allocate another chunk if no blocks are free
+				if (!pool->free_list) {
+					size_m stride = mug_block_pool_stride(pool);
+					muByte* chunk = (muByte*)pool->parent.alloc(pool->parent.user, MUG_BLOCK_ALIGN + stride*pool->chunk_blocks, category);
+					if (!chunk) {
+						return 0;
+					}
+					*(void**)chunk = pool->chunks;
+					pool->chunks = chunk;
+					// Link its blocks, first block first
+					for (uint32_m b = pool->chunk_blocks; b > 0; --b) {
+						void** block = (void**)&chunk[MUG_BLOCK_ALIGN + stride*(b-1)];
+						*block = pool->free_list;
+						pool->free_list = block;
+					}
+				}
+
+				// Take first free block
+				void** block = (void**)pool->free_list;
+				pool->free_list = *block;
+				++pool->used;
+				return block;
+			}
+
+			void mug_block_pool_dealloc(void* user, void* ptr, mugAllocCategory category) {
+				mugBlockPool* pool = (mugBlockPool*)user;
+				if (category != pool->category || !mug_block_pool_owns(pool, ptr)) {
+					pool->parent.free(pool->parent.user, ptr, category);
+					return;
+				}
+				*(void**)ptr = pool->free_list;
+				pool->free_list = ptr;
+				--pool->used;
+			}
+
+			void* mug_block_pool_realloc(void* user, void* ptr, size_m size, mugAllocCategory category) {
+				mugBlockPool* pool = (mugBlockPool*)user;
+				if (!ptr) {
+					return mug_block_pool_alloc(user, size, category);
+				}
+				if (category != pool->category || !mug_block_pool_owns(pool, ptr)) {
+					return pool->parent.realloc(pool->parent.user, ptr, size, category);
+				}
+
+				// Blocks can't grow, so larger memory is moved out of the pool
+				if (size <= pool->block_size) {
+					return ptr;
+				}
+				void* moved = pool->parent.alloc(pool->parent.user, size, category);
+				if (!moved) {
+					return 0;
+				}
+				mu_memcpy(moved, ptr, pool->block_size);
+				mug_block_pool_dealloc(user, ptr, category);
+				return moved;
+			}
+
+			MUDEF mugAllocator mug_block_pool_allocator(mugBlockPool* pool, mugAllocator parent, mugAllocCategory category, uint32_m chunk_blocks) {
+				mu_memset(pool, 0, sizeof(mugBlockPool));
+				pool->parent = parent;
+				pool->category = category;
+				pool->chunk_blocks = (chunk_blocks) ? (chunk_blocks) : (16);
+
+				mugAllocator allocator;
+				allocator.alloc = mug_block_pool_alloc;
+				allocator.realloc = mug_block_pool_realloc;
+				allocator.free = mug_block_pool_dealloc;
+				allocator.user = pool;
+				return allocator;
+			}
+
+			MUDEF void mug_block_pool_free(mugBlockPool* pool) {
+				muByte* chunk = (muByte*)pool->chunks;
+				while (chunk) {
+					muByte* next = *(muByte**)chunk;
+					pool->parent.free(pool->parent.user, chunk, pool->category);
+					chunk = next;
+				}
+				pool->chunks = 0;
+				pool->free_list = 0;
+				pool->used = 0;
+			}
+
+		/* Frame arena allocator */
+
+			// Each allocation on an arena is preceded by a header
+			// of MUG_BLOCK_ALIGN bytes, holding its size
+
+			// Rounds a size up to the alignment of arena allocations
+			size_m mug_frame_arena_round(size_m size) {
+				return (size + MUG_BLOCK_ALIGN-1) & ~((size_m)MUG_BLOCK_ALIGN-1);
+			}
+
+			// Returns whether or not memory belongs to an arena
+			muBool mug_frame_arena_owns(mugFrameArena* arena, void* ptr) {
+				return arena->data && (muByte*)ptr >= arena->data && (muByte*)ptr < &arena->data[arena->cap];
+			}
+
+			void* mug_frame_arena_alloc(void* user, size_m size, mugAllocCategory category) {
+				mugFrameArena* arena = (mugFrameArena*)user;
+				if (!(arena->categories & (1 << category))) {
+					return arena->parent.alloc(arena->parent.user, size, category);
+				}
+
+				// Allocate arena memory if not done already
+				if (!arena->data) {
+					arena->data = (muByte*)arena->parent.alloc(arena->parent.user, arena->cap, MUG_ALLOC_GENERAL);
+				}
+				size_m needed = MUG_BLOCK_ALIGN + mug_frame_arena_round(size);
+				if (!arena->data || needed > arena->cap - arena->len) {
+					return arena->parent.alloc(arena->parent.user, size, category);
+				}
+
+				// Push allocation
+				muByte* header = &arena->data[arena->len];
+				*(size_m*)header = size;
+				arena->len += needed;
+				return &header[MUG_BLOCK_ALIGN];
+			}
+
+			void mug_frame_arena_dealloc(void* user, void* ptr, mugAllocCategory category) {
+				mugFrameArena* arena = (mugFrameArena*)user;
+				if (!mug_frame_arena_owns(arena, ptr)) {
+					arena->parent.free(arena->parent.user, ptr, category);
+					return;
+				}
+
+				// Give memory back if this is the latest allocation
+				muByte* header = (muByte*)ptr - MUG_BLOCK_ALIGN;
+				size_m end = (size_m)(header - arena->data) + MUG_BLOCK_ALIGN + mug_frame_arena_round(*(size_m*)header);
+				if (end == arena->len) {
+					arena->len = (size_m)(header - arena->data);
+				}
+			}
+
+			void* mug_frame_arena_realloc(void* user, void* ptr, size_m size, mugAllocCategory category) {
+				mugFrameArena* arena = (mugFrameArena*)user;
+				if (!ptr) {
+					return mug_frame_arena_alloc(user, size, category);
+				}
+				if (!mug_frame_arena_owns(arena, ptr)) {
+					return arena->parent.realloc(arena->parent.user, ptr, size, category);
+				}
+
+				// Resize in place if this is the latest allocation and it fits
+				muByte* header = (muByte*)ptr - MUG_BLOCK_ALIGN;
+				size_m offset = (size_m)(header - arena->data);
+				size_m old_size = *(size_m*)header;
+				if (offset + MUG_BLOCK_ALIGN + mug_frame_arena_round(old_size) == arena->len
+					&& mug_frame_arena_round(size) <= arena->cap - offset - MUG_BLOCK_ALIGN
+				) {
+					*(size_m*)header = size;
+					arena->len = offset + MUG_BLOCK_ALIGN + mug_frame_arena_round(size);
+					return ptr;
+				}
+				if (size <= old_size) {
+					*(size_m*)header = size;
+					return ptr;
+				}
+
+				// Move otherwise
+				void* moved = mug_frame_arena_alloc(user, size, category);
+				if (!moved) {
+					return 0;
+				}
+				mu_memcpy(moved, ptr, old_size);
+				mug_frame_arena_dealloc(user, ptr, category);
+				return moved;
+			}
+
+			MUDEF mugAllocator mug_frame_arena_allocator(mugFrameArena* arena, mugAllocator parent, uint32_m categories, size_m cap) {
+				mu_memset(arena, 0, sizeof(mugFrameArena));
+				arena->parent = parent;
+				arena->categories = categories;
+				arena->cap = mug_frame_arena_round(cap);
+
+				mugAllocator allocator;
+				allocator.alloc = mug_frame_arena_alloc;
+				allocator.realloc = mug_frame_arena_realloc;
+				allocator.free = mug_frame_arena_dealloc;
+				allocator.user = arena;
+				return allocator;
+			}
+
+			MUDEF void mug_frame_arena_reset(mugFrameArena* arena) {
+				arena->len = 0;
+			}
+
+			MUDEF void mug_frame_arena_free(mugFrameArena* arena) {
+				if (arena->data) {
+					arena->parent.free(arena->parent.user, arena->data, MUG_ALLOC_GENERAL);
+					arena->data = 0;
+				}
+				arena->len = 0;
+			}
+
+	MU_CPP_EXTERN_END
+
+	// muCOSA implementation
+	// Changes:
+	// - Allocations are made via mug's allocator, except for clipboard text handed to the user.
+	#ifndef MUCOSA_IMPLEMENTATION
+		#define MUCOSA_IMPLEMENTATION
+		#ifdef MUCOSA_IMPLEMENTATION
+
+			MU_CPP_EXTERN_START
+
+			/* Macros */
+
+				// OS recognition
+
+				#ifndef MUCOSA_MANUAL_OS_SUPPORT
+
+					// Win32
+					#ifdef MU_WIN32
+						#define MUCOSA_WIN32
+						#define MUCOSA_WIN32_CALL(...) __VA_ARGS__
+					#else
+						#define MUCOSA_WIN32_CALL(...)
+					#endif
+
+				#endif /* MUCOSA_MANUAL_OS_SUPPORT */
+
+				// Graphics API support
+
+				#ifdef MU_SUPPORT_OPENGL
+					#define MUCOSA_OPENGL_CALL(...) __VA_ARGS__
+				#else
+					#define MUCOSA_OPENGL_CALL(...)
+				#endif
+
+			/* Win32 */
+
+			#ifdef MUCOSA_WIN32
+
+				// For all of the stuff that can't be included directly (CURSE YOU BILL)
+				#include <windows.h>
+
+				/* Useful functions */
+
+					// Hinstance retriever (thank you Raymond Chen)
+					EXTERN_C IMAGE_DOS_HEADER __ImageBase;
+					HINSTANCE muCOSAW32_get_hinstance(void) {
+						return ((HINSTANCE)&__ImageBase);
+					}
+
+					// UTF-8 -> wchar_t (UTF-16)
+					// Result is scratch memory, freed via mug_dealloc with MUG_ALLOC_SCRATCH
+					wchar_t* muCOSAW32_utf8_to_wchar(char* str) {
+						// Get length needed for conversion
+						// Note: we can use -1 here, since it's expected for it to be null-terminated
+						int len = MultiByteToWideChar(CP_UTF8, 0, str, -1, NULL, 0);
+						if (len == 0) {
+							return 0;
+						}
+
+						// Allocate data
+						wchar_t* wstr = (wchar_t*)mug_alloc(len * sizeof(wchar_t), MUG_ALLOC_SCRATCH);
+						if (wstr == 0) {
+							return 0;
+						}
+
+						// Perform conversion
+						if (MultiByteToWideChar(CP_UTF8, 0, str, -1, (LPWSTR)wstr, len) == 0) {
+							mug_dealloc(wstr, MUG_ALLOC_SCRATCH);
+							return 0;
+						}
+
+						// Return converted data
+						return wstr;
+					}
+
+					// wchar_t (UTF-16) -> UTF-8
+					// Result is handed to the user, so it's allocated via mu_malloc
+					uint8_m* muCOSAW32_wchar_to_utf8(wchar_t* wstr) {
+						// Get length needed
+						int len = WideCharToMultiByte(CP_UTF8, 0, wstr, -1, NULL, 0, NULL, NULL);
+						if (!len) {
+							return 0;
+						}
+
+						// Allocate data needed for conversion
+						uint8_m* str = (uint8_m*)mu_malloc(len);
+						if (!str) {
+							return 0;
+						}
+
+						// Perform conversion
+						if (!WideCharToMultiByte(CP_UTF8, 0, wstr, -1, (LPSTR)str, len, NULL, NULL)) {
+							mu_free(str);
+							return 0;
+						}
+
+						return str;
+					}
+
+					// Win32 virtual key code to muCOSA key code
+					muKeyboardKey muCOSAW32_VK_to_muCOSA(WPARAM vk) {
+						switch (vk) {
+							default: return MU_KEYBOARD_UNKNOWN; break;
+							case VK_BACK: return MU_KEYBOARD_BACKSPACE; break;
+							case VK_TAB: return MU_KEYBOARD_TAB; break;
+							case VK_CLEAR: return MU_KEYBOARD_CLEAR; break;
+							case VK_RETURN: return MU_KEYBOARD_RETURN; break;
+							case VK_PAUSE: return MU_KEYBOARD_PAUSE; break;
+							case VK_ESCAPE: return MU_KEYBOARD_ESCAPE; break;
+							case VK_MODECHANGE: return MU_KEYBOARD_MODECHANGE; break;
+							case VK_SPACE: return MU_KEYBOARD_SPACE; break;
+							case VK_PRIOR: return MU_KEYBOARD_PRIOR; break;
+							case VK_NEXT: return MU_KEYBOARD_NEXT; break;
+							case VK_END: return MU_KEYBOARD_END; break;
+							case VK_HOME: return MU_KEYBOARD_HOME; break;
+							case VK_LEFT: return MU_KEYBOARD_LEFT; break;
+							case VK_UP: return MU_KEYBOARD_UP; break;
+							case VK_RIGHT: return MU_KEYBOARD_RIGHT; break;
+							case VK_DOWN: return MU_KEYBOARD_DOWN; break;
+							case VK_SELECT: return MU_KEYBOARD_SELECT; break;
+							case VK_PRINT: return MU_KEYBOARD_PRINT; break;
+							case VK_EXECUTE: return MU_KEYBOARD_EXECUTE; break;
+							case VK_INSERT: return MU_KEYBOARD_INSERT; break;
+							case VK_DELETE: return MU_KEYBOARD_DELETE; break;
+							case VK_HELP: return MU_KEYBOARD_HELP; break;
+							case 0x30: return MU_KEYBOARD_0; break;
+							case 0x31: return MU_KEYBOARD_1; break;
+							case 0x32: return MU_KEYBOARD_2; break;
+							case 0x33: return MU_KEYBOARD_3; break;
+							case 0x34: return MU_KEYBOARD_4; break;
+							case 0x35: return MU_KEYBOARD_5; break;
+							case 0x36: return MU_KEYBOARD_6; break;
+							case 0x37: return MU_KEYBOARD_7; break;
+							case 0x38: return MU_KEYBOARD_8; break;
+							case 0x39: return MU_KEYBOARD_9; break;
+							case 0x41: return MU_KEYBOARD_A; break;
+							case 0x42: return MU_KEYBOARD_B; break;
+							case 0x43: return MU_KEYBOARD_C; break;
+							case 0x44: return MU_KEYBOARD_D; break;
+							case 0x45: return MU_KEYBOARD_E; break;
+							case 0x46: return MU_KEYBOARD_F; break;
+							case 0x47: return MU_KEYBOARD_G; break;
+							case 0x48: return MU_KEYBOARD_H; break;
+							case 0x49: return MU_KEYBOARD_I; break;
+							case 0x4A: return MU_KEYBOARD_J; break;
+							case 0x4B: return MU_KEYBOARD_K; break;
+							case 0x4C: return MU_KEYBOARD_L; break;
+							case 0x4D: return MU_KEYBOARD_M; break;
+							case 0x4E: return MU_KEYBOARD_N; break;
+							case 0x4F: return MU_KEYBOARD_O; break;
+							case 0x50: return MU_KEYBOARD_P; break;
+							case 0x51: return MU_KEYBOARD_Q; break;
+							case 0x52: return MU_KEYBOARD_R; break;
+							case 0x53: return MU_KEYBOARD_S; break;
+							case 0x54: return MU_KEYBOARD_T; break;
+							case 0x55: return MU_KEYBOARD_U; break;
+							case 0x56: return MU_KEYBOARD_V; break;
+							case 0x57: return MU_KEYBOARD_W; break;
+							case 0x58: return MU_KEYBOARD_X; break;
+							case 0x59: return MU_KEYBOARD_Y; break;
+							case 0x5A: return MU_KEYBOARD_Z; break;
+							case VK_LWIN: return MU_KEYBOARD_LEFT_WINDOWS; break;
+							case VK_RWIN: return MU_KEYBOARD_RIGHT_WINDOWS; break;
+							case VK_NUMPAD0: return MU_KEYBOARD_NUMPAD_0; break;
+							case VK_NUMPAD1: return MU_KEYBOARD_NUMPAD_1; break;
+							case VK_NUMPAD2: return MU_KEYBOARD_NUMPAD_2; break;
+							case VK_NUMPAD3: return MU_KEYBOARD_NUMPAD_3; break;
+							case VK_NUMPAD4: return MU_KEYBOARD_NUMPAD_4; break;
+							case VK_NUMPAD5: return MU_KEYBOARD_NUMPAD_5; break;
+							case VK_NUMPAD6: return MU_KEYBOARD_NUMPAD_6; break;
+							case VK_NUMPAD7: return MU_KEYBOARD_NUMPAD_7; break;
+							case VK_NUMPAD8: return MU_KEYBOARD_NUMPAD_8; break;
+							case VK_NUMPAD9: return MU_KEYBOARD_NUMPAD_9; break;
+							case VK_MULTIPLY: return MU_KEYBOARD_MULTIPLY; break;
+							case VK_ADD: return MU_KEYBOARD_ADD; break;
+							case VK_SEPARATOR: return MU_KEYBOARD_SEPARATOR; break;
+							case VK_SUBTRACT: return MU_KEYBOARD_SUBTRACT; break;
+							case VK_DECIMAL: return MU_KEYBOARD_DECIMAL; break;
+							case VK_DIVIDE: return MU_KEYBOARD_DIVIDE; break;
+							case VK_F1: return MU_KEYBOARD_F1; break;
+							case VK_F2: return MU_KEYBOARD_F2; break;
+							case VK_F3: return MU_KEYBOARD_F3; break;
+							case VK_F4: return MU_KEYBOARD_F4; break;
+							case VK_F5: return MU_KEYBOARD_F5; break;
+							case VK_F6: return MU_KEYBOARD_F6; break;
+							case VK_F7: return MU_KEYBOARD_F7; break;
+							case VK_F8: return MU_KEYBOARD_F8; break;
+							case VK_F9: return MU_KEYBOARD_F9; break;
+							case VK_F10: return MU_KEYBOARD_F10; break;
+							case VK_F11: return MU_KEYBOARD_F11; break;
+							case VK_F12: return MU_KEYBOARD_F12; break;
+							case VK_F13: return MU_KEYBOARD_F13; break;
+							case VK_F14: return MU_KEYBOARD_F14; break;
+							case VK_F15: return MU_KEYBOARD_F15; break;
+							case VK_F16: return MU_KEYBOARD_F16; break;
+							case VK_F17: return MU_KEYBOARD_F17; break;
+							case VK_F18: return MU_KEYBOARD_F18; break;
+							case VK_F19: return MU_KEYBOARD_F19; break;
+							case VK_F20: return MU_KEYBOARD_F20; break;
+							case VK_F21: return MU_KEYBOARD_F21; break;
+							case VK_F22: return MU_KEYBOARD_F22; break;
+							case VK_F23: return MU_KEYBOARD_F23; break;
+							case VK_F24: return MU_KEYBOARD_F24; break;
+							case VK_NUMLOCK: return MU_KEYBOARD_NUMLOCK; break;
+							case VK_SCROLL: return MU_KEYBOARD_SCROLL; break;
+							case VK_LSHIFT: return MU_KEYBOARD_LEFT_SHIFT; break;
+							case VK_RSHIFT: return MU_KEYBOARD_RIGHT_SHIFT; break;
+							case VK_LCONTROL: return MU_KEYBOARD_LEFT_CONTROL; break;
+							case VK_RCONTROL: return MU_KEYBOARD_RIGHT_CONTROL; break;
+							case VK_LMENU: return MU_KEYBOARD_LEFT_MENU; break;
+							case VK_RMENU: return MU_KEYBOARD_RIGHT_MENU; break;
+							case VK_ATTN: return MU_KEYBOARD_ATTN; break;
+							case VK_CRSEL: return MU_KEYBOARD_CRSEL; break;
+							case VK_EXSEL: return MU_KEYBOARD_EXSEL; break;
+							case VK_EREOF: return MU_KEYBOARD_EREOF; break;
+							case VK_PLAY: return MU_KEYBOARD_PLAY; break;
+							case VK_PA1: return MU_KEYBOARD_PA1; break;
+						}
+					}
+
+					// muCOSA cursor style to Win32 cursor
+					void* muCOSAW32_muCOSA_cursor_to_W32(muCursorStyle style) {
+						switch (style) {
+							default: return IDC_ARROW; break;
+							case MU_CURSOR_ARROW: return IDC_ARROW; break;
+							case MU_CURSOR_IBEAM: return IDC_IBEAM; break;
+							case MU_CURSOR_WAIT: return IDC_WAIT; break;
+							case MU_CURSOR_WAIT_ARROW: return IDC_APPSTARTING; break;
+							case MU_CURSOR_CROSSHAIR: return IDC_CROSS; break;
+							case MU_CURSOR_HAND: return IDC_HAND; break;
+							case MU_CURSOR_SIZE_LR: return IDC_SIZEWE; break;
+							case MU_CURSOR_SIZE_TB: return IDC_SIZENS; break;
+							case MU_CURSOR_SIZE_TL_BR: return IDC_SIZENWSE; break;
+							case MU_CURSOR_SIZE_TR_BL: return IDC_SIZENESW; break;
+							case MU_CURSOR_SIZE_ALL: return IDC_SIZEALL; break;
+							case MU_CURSOR_NO: return IDC_NO; break;
+						}
+					}
+
+					// muCOSA keystate to Win32
+					int muCOSAW32_keystate_to_W32(muKeyboardState state) {
+						switch (state) {
+							default: return VK_NONAME; break;
+							case MU_KEYSTATE_CAPS_LOCK: return VK_CAPITAL; break;
+							case MU_KEYSTATE_SCROLL_LOCK: return VK_SCROLL; break;
+							case MU_KEYSTATE_NUM_LOCK: return VK_NUMLOCK; break;
+						}
+					}
+
+				/* OpenGL */
+
+				#ifdef MU_SUPPORT_OPENGL
+
+					/* Inclusion and common definition */
+
+						// Common OpenGL definitions
+						#ifndef MUCOSA_NO_INCLUDE_OPENGL
+							// Only include if "glClearColor" isn't defined; this is to avoid
+							// accidental double definition in many circumstances.
+							#ifndef glClearColor
+								#include <gl/gl.h>
+								#include <gl/glu.h>
+							#endif
+						#endif
+
+						// Device context -> valid OpenGL context
+						#include <wingdi.h>
+
+						// Typedefs for functions we need
+						// - wglCreateContextAttribs; needed for specifying exact version when creating context
+						typedef HGLRC WINAPI muCOSAW32_wglCreateContextAttribsARB_type(HDC hdc, HGLRC hShareContext, const int* attribList);
+						// - wglChoosePixelFormat; needed for choosing a more thorough pixel format when creating context
+						typedef BOOL WINAPI muCOSAW32_wglChoosePixelFormatARB_type(HDC hdc, const int* piAttribIList, const FLOAT* pfAttribFList, UINT uMaxFormats, int* piFormats, UINT* nNumFormats);
+						// - wglSwapInterval; not needed in context creation, but used for swap interval later
+						typedef BOOL WINAPI muCOSAW32_wglSwapIntervalEXT_type(int interval);
+
+						// Struct to hold WGL functions needed for context creation
+						struct muCOSAW32_WGL {
+							muCOSAW32_wglCreateContextAttribsARB_type* CreateContextAttribs;
+							muCOSAW32_wglChoosePixelFormatARB_type* ChoosePixelFormat;
+							muCOSAW32_wglSwapIntervalEXT_type* SwapInterval;
+						};
+						typedef struct muCOSAW32_WGL muCOSAW32_WGL;
+
+					/* WGL tokens */
+
+						// https://registry.khronos.org/OpenGL/extensions/ARB/WGL_ARB_create_context.txt
+
+						#define MUCOSAWGL_CONTEXT_MAJOR_VERSION_ARB             0x2091
+						#define MUCOSAWGL_CONTEXT_MINOR_VERSION_ARB             0x2092
+						#define MUCOSAWGL_CONTEXT_LAYER_PLANE_ARB               0x2093
+						#define MUCOSAWGL_CONTEXT_FLAGS_ARB                     0x2094
+						#define MUCOSAWGL_CONTEXT_PROFILE_MASK_ARB              0x9126
+
+						#define MUCOSAWGL_CONTEXT_DEBUG_BIT_ARB                 0x0001
+						#define MUCOSAWGL_CONTEXT_FORWARD_COMPATIBLE_BIT_ARB    0x0002
+
+						#define MUCOSAWGL_CONTEXT_CORE_PROFILE_BIT_ARB          0x00000001
+						#define MUCOSAWGL_CONTEXT_COMPATIBILITY_PROFILE_BIT_ARB 0x00000002
+
+						#define MUCOSAWGL_ERROR_INVALID_VERSION_ARB                 0x2095
+						#define MUCOSAWGL_ERROR_INVALID_PROFILE_ARB                 0x2096
+
+						// https://registry.khronos.org/OpenGL/extensions/ARB/WGL_ARB_pixel_format.txt
+
+						#define MUCOSAWGL_NUMBER_PIXEL_FORMATS_ARB    0x2000
+						#define MUCOSAWGL_DRAW_TO_WINDOW_ARB          0x2001
+						#define MUCOSAWGL_DRAW_TO_BITMAP_ARB          0x2002
+						#define MUCOSAWGL_ACCELERATION_ARB            0x2003
+						#define MUCOSAWGL_NEED_PALETTE_ARB            0x2004
+						#define MUCOSAWGL_NEED_SYSTEM_PALETTE_ARB     0x2005
+						#define MUCOSAWGL_SWAP_LAYER_BUFFERS_ARB      0x2006
+						#define MUCOSAWGL_SWAP_METHOD_ARB             0x2007
+						#define MUCOSAWGL_NUMBER_OVERLAYS_ARB         0x2008
+						#define MUCOSAWGL_NUMBER_UNDERLAYS_ARB        0x2009
+						#define MUCOSAWGL_TRANSPARENT_ARB             0x200A
+						#define MUCOSAWGL_TRANSPARENT_RED_VALUE_ARB   0x2037
+						#define MUCOSAWGL_TRANSPARENT_GREEN_VALUE_ARB 0x2038
+						#define MUCOSAWGL_TRANSPARENT_BLUE_VALUE_ARB  0x2039
+						#define MUCOSAWGL_TRANSPARENT_ALPHA_VALUE_ARB 0x203A
+						#define MUCOSAWGL_TRANSPARENT_INDEX_VALUE_ARB 0x203B
+						#define MUCOSAWGL_SHARE_DEPTH_ARB             0x200C
+						#define MUCOSAWGL_SHARE_STENCIL_ARB           0x200D
+						#define MUCOSAWGL_SHARE_ACCUM_ARB             0x200E
+						#define MUCOSAWGL_SUPPORT_GDI_ARB             0x200F
+						#define MUCOSAWGL_SUPPORT_OPENGL_ARB          0x2010
+						#define MUCOSAWGL_DOUBLE_BUFFER_ARB           0x2011
+						#define MUCOSAWGL_STEREO_ARB                  0x2012
+						#define MUCOSAWGL_PIXEL_TYPE_ARB              0x2013
+						#define MUCOSAWGL_COLOR_BITS_ARB              0x2014
+						#define MUCOSAWGL_RED_BITS_ARB                0x2015
+						#define MUCOSAWGL_RED_SHIFT_ARB               0x2016
+						#define MUCOSAWGL_GREEN_BITS_ARB              0x2017
+						#define MUCOSAWGL_GREEN_SHIFT_ARB             0x2018
+						#define MUCOSAWGL_BLUE_BITS_ARB               0x2019
+						#define MUCOSAWGL_BLUE_SHIFT_ARB              0x201A
+						#define MUCOSAWGL_ALPHA_BITS_ARB              0x201B
+						#define MUCOSAWGL_ALPHA_SHIFT_ARB             0x201C
+						#define MUCOSAWGL_ACCUM_BITS_ARB              0x201D
+						#define MUCOSAWGL_ACCUM_RED_BITS_ARB          0x201E
+						#define MUCOSAWGL_ACCUM_GREEN_BITS_ARB        0x201F
+						#define MUCOSAWGL_ACCUM_BLUE_BITS_ARB         0x2020
+						#define MUCOSAWGL_ACCUM_ALPHA_BITS_ARB        0x2021
+						#define MUCOSAWGL_DEPTH_BITS_ARB              0x2022
+						#define MUCOSAWGL_STENCIL_BITS_ARB            0x2023
+						#define MUCOSAWGL_AUX_BUFFERS_ARB             0x2024
+
+						#define MUCOSAWGL_NO_ACCELERATION_ARB         0x2025
+						#define MUCOSAWGL_GENERIC_ACCELERATION_ARB    0x2026
+						#define MUCOSAWGL_FULL_ACCELERATION_ARB       0x2027
+
+						#define MUCOSAWGL_SWAP_EXCHANGE_ARB           0x2028
+						#define MUCOSAWGL_SWAP_COPY_ARB               0x2029
+						#define MUCOSAWGL_SWAP_UNDEFINED_ARB          0x202A
+
+						#define MUCOSAWGL_TYPE_RGBA_ARB               0x202B
+						#define MUCOSAWGL_TYPE_COLORINDEX_ARB         0x202C
+
+						// https://nehe.gamedev.net/tutorial/fullscreen_antialiasing/16008/
+
+						#define MUCOSAWGL_SAMPLE_BUFFERS_ARB  0x2041
+						#define MUCOSAWGL_SAMPLES_ARB     0x2042
+
+					/* Functions */
+
+						// Retrieves OpenGL extensions needed for context creation
+						muCOSAResult muCOSAW32_get_opengl_extensions(muCOSAW32_WGL* wgl) {
+							// Create temp window class
+							WNDCLASSA wclass = MU_ZERO_STRUCT(WNDCLASSA);
+							wclass.style = CS_HREDRAW | CS_VREDRAW | CS_OWNDC;
+							wclass.lpfnWndProc = DefWindowProcA;
+							wclass.hInstance = muCOSAW32_get_hinstance();
+							wclass.lpszClassName = "Dummy WGL window class";
+							if (!RegisterClassA(&wclass)) {
+								return MUCOSA_WIN32_FAILED_REGISTER_DUMMY_WGL_WINDOW_CLASS;
+							}
+
+							// Create temp window
+							HWND win = CreateWindowExA(
+								0, wclass.lpszClassName, "Dummy WGL window", 0,
+								CW_USEDEFAULT, CW_USEDEFAULT, CW_USEDEFAULT, CW_USEDEFAULT, 0, 0,
+								wclass.hInstance, 0
+							);
+							if (win == NULL) {
+								UnregisterClassA(wclass.lpszClassName, wclass.hInstance);
+								return MUCOSA_WIN32_FAILED_CREATE_DUMMY_WGL_WINDOW;
+							}
+
+							// Get device context from this window
+							HDC dc = GetDC(win);
+
+							// Use pixel format number 1
+							// This is a HACK and a half, but works
+							int pixel_format = 1;
+							PIXELFORMATDESCRIPTOR format_desc;
+							if (!DescribePixelFormat(dc, pixel_format, sizeof(format_desc), &format_desc)) {
+								ReleaseDC(win, dc);
+								DestroyWindow(win);
+								UnregisterClassA(wclass.lpszClassName, wclass.hInstance);
+								return MUCOSA_WIN32_FAILED_DESCRIBE_DUMMY_WGL_PIXEL_FORMAT;
+							}
+
+							// Set pixel format. This doesn't make much sense, this is already definitionally
+							// the pixel format of the device, but it doesn't work if I don't do this, so, :L
+							// Note: this might not be okay, and we may need to specify SOME pixel format,
+							// but I don't know.
+							if (!SetPixelFormat(dc, pixel_format, &format_desc)) {
+								ReleaseDC(win, dc);
+								DestroyWindow(win);
+								UnregisterClassA(wclass.lpszClassName, wclass.hInstance);
+								return MUCOSA_WIN32_FAILED_SET_DUMMY_WGL_PIXEL_FORMAT;
+							}
+
+							// Create dummy context
+							HGLRC context = wglCreateContext(dc);
+							if (!context) {
+								ReleaseDC(win, dc);
+								DestroyWindow(win);
+								UnregisterClassA(wclass.lpszClassName, wclass.hInstance);
+								return MUCOSA_WIN32_FAILED_CREATE_DUMMY_WGL_CONTEXT;
+							}
+							// Bind dummy context
+							if (!wglMakeCurrent(dc, context)) {
+								wglDeleteContext(context);
+								ReleaseDC(win, dc);
+								DestroyWindow(win);
+								UnregisterClassA(wclass.lpszClassName, wclass.hInstance);
+								return MUCOSA_WIN32_FAILED_BIND_DUMMY_WGL_CONTEXT;
+							}
+
+							// Find necessary functions
+							PROC wglCreateContextAttribsARB_proc = wglGetProcAddress("wglCreateContextAttribsARB");
+							PROC wglChoosePixelFormatARB_proc    = wglGetProcAddress("wglChoosePixelFormatARB");
+							// Find helpful functions
+							PROC wglSwapIntervalEXT_proc         = wglGetProcAddress("wglSwapIntervalEXT");
+
+							// Destroy resources
+							wglMakeCurrent(dc, 0);
+							wglDeleteContext(context);
+							ReleaseDC(win, dc);
+							DestroyWindow(win);
+							UnregisterClassA(wclass.lpszClassName, wclass.hInstance);
+
+							// Detect if any required functions went unfound
+							if (!wglCreateContextAttribsARB_proc) {
+								return MUCOSA_WIN32_FAILED_FIND_WGL_CREATE_CONTEXT_ATTRIBS;
+							}
+							if (!wglChoosePixelFormatARB_proc) {
+								return MUCOSA_WIN32_FAILED_FIND_WGL_CHOOSE_PIXEL_FORMAT;
+							}
+
+							// Copy over functions
+							mu_memcpy(&wgl->CreateContextAttribs, &wglCreateContextAttribsARB_proc, sizeof(PROC));
+							mu_memcpy(&wgl->ChoosePixelFormat,    &wglChoosePixelFormatARB_proc,    sizeof(PROC));
+							mu_memcpy(&wgl->SwapInterval,         &wglSwapIntervalEXT_proc,         sizeof(PROC));
+							return MUCOSA_SUCCESS;
+						}
+
+						// Creates an OpenGL context
+						muCOSAResult muCOSAW32_create_opengl_context(HDC dc, int win_pixel_format, muCOSAW32_WGL* wgl, muPixelFormat* format, HGLRC* context, muGraphicsAPI api, muBool* set) {
+							muCOSAResult res = MUCOSA_SUCCESS;
+							// Choose pixel format
+							int pixel_format;
+
+							// - If a pixel format is supplied by the user:
+							if (format) {
+								// Set up an attribute field based on pixel format
+								int pixel_format_attributes[] = {
+									MUCOSAWGL_DRAW_TO_WINDOW_ARB, MU_TRUE,
+									MUCOSAWGL_SUPPORT_OPENGL_ARB, MU_TRUE,
+									MUCOSAWGL_DOUBLE_BUFFER_ARB,  MU_TRUE,
+									MUCOSAWGL_SAMPLE_BUFFERS_ARB, MU_TRUE, // (?)
+									MUCOSAWGL_ACCELERATION_ARB,   MUCOSAWGL_FULL_ACCELERATION_ARB, // (?)
+									MUCOSAWGL_PIXEL_TYPE_ARB,     MUCOSAWGL_TYPE_RGBA_ARB, // (?)
+									MUCOSAWGL_RED_BITS_ARB,       format->red_bits,
+									MUCOSAWGL_GREEN_BITS_ARB,     format->green_bits,
+									MUCOSAWGL_BLUE_BITS_ARB,      format->blue_bits,
+									MUCOSAWGL_ALPHA_BITS_ARB,     format->alpha_bits,
+									MUCOSAWGL_DEPTH_BITS_ARB,     format->depth_bits,
+									MUCOSAWGL_STENCIL_BITS_ARB,   format->stencil_bits,
+									MUCOSAWGL_SAMPLES_ARB,        format->samples,
+									0
+								};
+								// Find corresponding format using WGL
+								UINT format_count = 0;
+								// - Does the return value of this indicate error? Can't find documentation
+								wgl->ChoosePixelFormat(dc, pixel_format_attributes, 0, 1, &pixel_format, &format_count);
+								if (!format_count) {
+									res = MUCOSA_WIN32_FAILED_CHOOSE_WGL_PIXEL_FORMAT;
+								}
+							}
+
+							// - If a pixel format isn't supplied by the user (or it failed)
+							if ((!format) || (res != MUCOSA_SUCCESS)) {
+								// Get default pixel format from window
+								pixel_format = win_pixel_format;
+							}
+
+							// Describe pixel format
+							PIXELFORMATDESCRIPTOR format_desc;
+							if (!DescribePixelFormat(dc, pixel_format, sizeof(format_desc), &format_desc)) {
+								return MUCOSA_WIN32_FAILED_DESCRIBE_WGL_PIXEL_FORMAT;
+							}
+							// Set pixel format @TODO Figure this out in window creation
+							if (!*set) {
+								if (!SetPixelFormat(dc, pixel_format, &format_desc)) {
+									return MUCOSA_WIN32_FAILED_SET_WGL_PIXEL_FORMAT;
+								}
+								*set = MU_TRUE;
+							}
+
+							// OpenGL version info
+							int opengl_attributes[] = {
+								MUCOSAWGL_CONTEXT_MAJOR_VERSION_ARB, 0,
+								MUCOSAWGL_CONTEXT_MINOR_VERSION_ARB, 0,
+								MUCOSAWGL_CONTEXT_PROFILE_MASK_ARB, MUCOSAWGL_CONTEXT_CORE_PROFILE_BIT_ARB,
+								0
+							};
+
+							// - Fill in OpenGL version info based on graphics API value
+							switch (api) {
+								default: return MUCOSA_FAILED_UNKNOWN_GRAPHICS_API; break;
+								case MU_OPENGL_1_0: {
+									opengl_attributes[1] = 1;
+									opengl_attributes[3] = 0;
+									opengl_attributes[4] = 0;
+								} break;
+								case MU_OPENGL_1_1: {
+									opengl_attributes[1] = 1;
+									opengl_attributes[3] = 1;
+									opengl_attributes[4] = 0;
+								} break;
+								case MU_OPENGL_1_2: {
+									opengl_attributes[1] = 1;
+									opengl_attributes[3] = 2;
+									opengl_attributes[4] = 0;
+								} break;
+								// Don't know what to do, setting to 1.3
+								case MU_OPENGL_1_2_1: {
+									opengl_attributes[1] = 1;
+									opengl_attributes[3] = 3;
+									opengl_attributes[4] = 0;
+								} break;
+								case MU_OPENGL_1_3: {
+									opengl_attributes[1] = 1;
+									opengl_attributes[3] = 3;
+									opengl_attributes[4] = 0;
+								} break;
+								case MU_OPENGL_1_4: {
+									opengl_attributes[1] = 1;
+									opengl_attributes[3] = 4;
+									opengl_attributes[4] = 0;
+								} break;
+								case MU_OPENGL_1_5: {
+									opengl_attributes[1] = 1;
+									opengl_attributes[3] = 5;
+									opengl_attributes[4] = 0;
+								} break;
+								case MU_OPENGL_2_0: {
+									opengl_attributes[1] = 2;
+									opengl_attributes[3] = 0;
+									opengl_attributes[4] = 0;
+								} break;
+								case MU_OPENGL_2_1: {
+									opengl_attributes[1] = 2;
+									opengl_attributes[3] = 1;
+									opengl_attributes[4] = 0;
+								} break;
+								case MU_OPENGL_3_0: {
+									opengl_attributes[1] = 3;
+									opengl_attributes[3] = 0;
+									opengl_attributes[4] = 0;
+								} break;
+								case MU_OPENGL_3_1: {
+									opengl_attributes[1] = 3;
+									opengl_attributes[3] = 1;
+									opengl_attributes[4] = 0;
+								} break;
+								case MU_OPENGL_3_2_CORE: {
+									opengl_attributes[1] = 3;
+									opengl_attributes[3] = 2;
+								} break;
+								case MU_OPENGL_3_2_COMPATIBILITY: {
+									opengl_attributes[1] = 3;
+									opengl_attributes[3] = 2;
+									opengl_attributes[5] = MUCOSAWGL_CONTEXT_COMPATIBILITY_PROFILE_BIT_ARB;
+								} break;
+								case MU_OPENGL_3_3_CORE: {
+									opengl_attributes[1] = 3;
+									opengl_attributes[3] = 3;
+								} break;
+								case MU_OPENGL_3_3_COMPATIBILITY: {
+									opengl_attributes[1] = 3;
+									opengl_attributes[3] = 3;
+									opengl_attributes[5] = MUCOSAWGL_CONTEXT_COMPATIBILITY_PROFILE_BIT_ARB;
+								} break;
+								case MU_OPENGL_4_0_CORE: {
+									opengl_attributes[1] = 4;
+									opengl_attributes[3] = 0;
+								} break;
+								case MU_OPENGL_4_0_COMPATIBILITY: {
+									opengl_attributes[1] = 4;
+									opengl_attributes[3] = 0;
+									opengl_attributes[5] = MUCOSAWGL_CONTEXT_COMPATIBILITY_PROFILE_BIT_ARB;
+								} break;
+								case MU_OPENGL_4_1_CORE: {
+									opengl_attributes[1] = 4;
+									opengl_attributes[3] = 1;
+								} break;
+								case MU_OPENGL_4_1_COMPATIBILITY: {
+									opengl_attributes[1] = 4;
+									opengl_attributes[3] = 1;
+									opengl_attributes[5] = MUCOSAWGL_CONTEXT_COMPATIBILITY_PROFILE_BIT_ARB;
+								} break;
+								case MU_OPENGL_4_2_CORE: {
+									opengl_attributes[1] = 4;
+									opengl_attributes[3] = 2;
+								} break;
+								case MU_OPENGL_4_2_COMPATIBILITY: {
+									opengl_attributes[1] = 4;
+									opengl_attributes[3] = 2;
+									opengl_attributes[5] = MUCOSAWGL_CONTEXT_COMPATIBILITY_PROFILE_BIT_ARB;
+								} break;
+								case MU_OPENGL_4_3_CORE: {
+									opengl_attributes[1] = 4;
+									opengl_attributes[3] = 3;
+								} break;
+								case MU_OPENGL_4_3_COMPATIBILITY: {
+									opengl_attributes[1] = 4;
+									opengl_attributes[3] = 3;
+									opengl_attributes[5] = MUCOSAWGL_CONTEXT_COMPATIBILITY_PROFILE_BIT_ARB;
+								} break;
+								case MU_OPENGL_4_4_CORE: {
+									opengl_attributes[1] = 4;
+									opengl_attributes[3] = 4;
+								} break;
+								case MU_OPENGL_4_4_COMPATIBILITY: {
+									opengl_attributes[1] = 4;
+									opengl_attributes[3] = 4;
+									opengl_attributes[5] = MUCOSAWGL_CONTEXT_COMPATIBILITY_PROFILE_BIT_ARB;
+								} break;
+								case MU_OPENGL_4_5_CORE: {
+									opengl_attributes[1] = 4;
+									opengl_attributes[3] = 5;
+								} break;
+								case MU_OPENGL_4_5_COMPATIBILITY: {
+									opengl_attributes[1] = 4;
+									opengl_attributes[3] = 5;
+									opengl_attributes[5] = MUCOSAWGL_CONTEXT_COMPATIBILITY_PROFILE_BIT_ARB;
+								} break;
+								case MU_OPENGL_4_6_CORE: {
+									opengl_attributes[1] = 4;
+									opengl_attributes[3] = 6;
+								} break;
+								case MU_OPENGL_4_6_COMPATIBILITY: {
+									opengl_attributes[1] = 4;
+									opengl_attributes[3] = 6;
+									opengl_attributes[5] = MUCOSAWGL_CONTEXT_COMPATIBILITY_PROFILE_BIT_ARB;
+								} break;
+							}
+
+							// Create context
+							*context = wgl->CreateContextAttribs(dc, 0, opengl_attributes);
+							if (!*context) {
+								return MUCOSA_WIN32_FAILED_CREATE_WGL_CONTEXT;
+							}
+
+							return res;
+						}
+
+				#endif /* MU_SUPPORT_OPENGL */
+
+				/* Time */
+
+					struct muCOSAW32_Time {
+						// @DOCLINE The original time the context was created.
+						double orig_time;
+						// @DOCLINE The non-overwritable time.
+						double fixed_time;
+					};
+					typedef struct muCOSAW32_Time muCOSAW32_Time;
+
+					// https://stackoverflow.com/questions/1695288/getting-the-current-time-in-milliseconds-from-the-system-clock-in-windows
+					double muCOSAW32_get_current_time(void) {
+						// Get system time
+						FILETIME file_time;
+						GetSystemTimeAsFileTime(&file_time);
+
+						// Format low + high time
+						LONGLONG ll_now = 
+							(LONGLONG)(file_time.dwLowDateTime) + ((LONGLONG)(file_time.dwHighDateTime) << 32LL)
+						;
+						// Return time properly divided
+						return (double)(ll_now) / (double)(1.0e7);
+					}
+
+					// Initiates the time struct
+					void muCOSAW32_time_init(muCOSAW32_Time* time) {
+						// Set time to current time
+						time->orig_time = time->fixed_time = muCOSAW32_get_current_time();
+					}
+
+				/* Clipboard */
+
+					uint8_m* muCOSAW32_clipboard_get(muCOSAResult* result) {
+						// Hold clipboard
+						if (!OpenClipboard(NULL)) {
+							MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_HOLD_CLIPBOARD)
+							return 0;
+						}
+
+						// Get handle to clipboard data (UTF-16)
+						HANDLE data = GetClipboardData(CF_UNICODETEXT);
+						if (!data) {
+							// I'm pretty sure this can happen if no clipboard is available, so I'm not
+							// throwing an error here
+							CloseClipboard();
+							return 0;
+						}
+
+						// Get clipboard data (UTF-16)
+						wchar_t* utf16 = (wchar_t*)GlobalLock(data);
+						if (!utf16) {
+							MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_GET_CLIPBOARD_DATA)
+							CloseClipboard();
+							return 0;
+						}
+
+						// Convert UTF-16 to UTF-8
+						uint8_m* utf8 = muCOSAW32_wchar_to_utf8(utf16);
+						if (!utf8) {
+							MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_CONVERT_CLIPBOARD_DATA_FORMAT)
+							GlobalUnlock(data);
+							CloseClipboard();
+							return 0;
+						}
+
+						// Close and return data
+						GlobalUnlock(data);
+						CloseClipboard();
+						return utf8;
+					}
+
+					void muCOSAW32_clipboard_set(muCOSAResult* result, uint8_m* data, size_m datalen) {
+						// Get length of UTF-16 equivalent
+						int wlen = MultiByteToWideChar(CP_UTF8, 0, (LPCCH)data, datalen, NULL, 0);
+						if (!wlen) {
+							MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_CONVERT_CLIPBOARD_DATA_FORMAT)
+							return;
+						}
+
+						// Allocate global memory for UTF-16 string
+						HGLOBAL g_mem = GlobalAlloc(GMEM_MOVEABLE, (SIZE_T)(wlen)*sizeof(wchar_t));
+						if (!g_mem) {
+							MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_ALLOCATE_CLIPBOARD_DATA)
+							return;
+						}
+
+						// Get memory pointer
+						LPVOID p_mem = GlobalLock(g_mem);
+						if (!p_mem) {
+							MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_ALLOCATE_CLIPBOARD_DATA)
+							GlobalFree(g_mem);
+							return;
+						}
+
+						// Perform conversion
+						if (!MultiByteToWideChar(CP_UTF8, 0, (LPCCH)data, datalen, (LPWSTR)p_mem, wlen)) {
+							MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_CONVERT_CLIPBOARD_DATA_FORMAT)
+							GlobalUnlock(g_mem);
+							GlobalFree(g_mem);
+							return;
+						}
+
+						// Release memory pointer
+						GlobalUnlock(g_mem);
+
+						// Hold clipboard
+						if (!OpenClipboard(NULL)) {
+							MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_HOLD_CLIPBOARD)
+							GlobalFree(g_mem);
+							return;
+						}
+
+						// Empty pre-existing clipboard data
+						if (!EmptyClipboard()) {
+							// Assuming this can get triggered if the clipboard was already empty,
+							// so no error thrown here.
+						}
+
+						// Set clipboard data
+						if (!SetClipboardData(CF_UNICODETEXT, g_mem)) {
+							MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_SET_CLIPBOARD_DATA)
+							GlobalFree(g_mem);
+							CloseClipboard();
+							return;
+						}
+
+						// Close clipboard and we're done
+						CloseClipboard();
+					}
+
+				/* Context */
+
+					struct muCOSAW32_Context {
+						muCOSAW32_Time time;
+						MUCOSA_OPENGL_CALL(muCOSAW32_WGL wgl;)
+					};
+					typedef struct muCOSAW32_Context muCOSAW32_Context;
+
+					// Accessing/Deaccessing pointer map functions needed for contexts
+					void muCOSAW32_window_pmap_access(void);
+					void muCOSAW32_window_pmap_deaccess(void);
+
+					muCOSAResult muCOSAW32_context_init(muCOSAW32_Context* context) {
+						muCOSAResult res = MUCOSA_SUCCESS;
+						// Mark newly created context for pmap
+						muCOSAW32_window_pmap_access();
+						// Initiate context time
+						muCOSAW32_time_init(&context->time);
+						// Load OpenGL extensions
+						MUCOSA_OPENGL_CALL(
+							mu_memset(&context->wgl, 0, sizeof(context->wgl));
+							res = muCOSAW32_get_opengl_extensions(&context->wgl);
+						)
+
+						return res;
+					}
+
+					void muCOSAW32_context_term(muCOSAW32_Context* context) {
+						// Remove context from pmap
+						muCOSAW32_window_pmap_deaccess();
+						return; if (context) {}
+					}
+
+				/* Context time */
+
+					double muCOSAW32_fixed_time_get(muCOSAW32_Context* context) {
+						// Return the difference between now and when the context was created
+						return muCOSAW32_get_current_time() - context->time.fixed_time;
+					}
+
+					double muCOSAW32_time_get(muCOSAW32_Context* context) {
+						// Return the difference between now and the overridable original time
+						return muCOSAW32_get_current_time() - context->time.orig_time;
+					}
+
+					void muCOSAW32_time_set(muCOSAW32_Context* context, double time) {
+						// Set time to current time minus the given time
+						context->time.orig_time = muCOSAW32_get_current_time() - time;
+					}
+
+				/* Sleep */
+
+					void muCOSAW32_sleep(double time) {
+						// Sleep for the approx. amount of milliseconds
+						Sleep((DWORD)(time*1000.0));
+					}
+
+				/* Window structs */
+
+					struct muCOSAW32_Keymaps {
+						// Keyboard keys
+						muBool keyboard[MU_KEYBOARD_LENGTH];
+						// Keystates
+						muBool keystates[MU_KEYSTATE_LENGTH];
+						// Mouse keys
+						muBool mouse[MU_MOUSE_LENGTH];
+					};
+					typedef struct muCOSAW32_Keymaps muCOSAW32_Keymaps;
+
+					struct muCOSAW32_WindowHandles {
+						// Window class name
+						wchar_t wclass_name[2];
+						// Hinstance
+						HINSTANCE hinstance;
+						// Window handle
+						HWND hwnd;
+						// Device context
+						HDC dc;
+						// Cursor handle
+						HCURSOR hcursor;
+						// IMM context handle
+						HIMC imc;
+					};
+					typedef struct muCOSAW32_WindowHandles muCOSAW32_WindowHandles;
+
+					// States possibly held by the window that are updated via proc
+					struct muCOSAW32_WindowStates {
+						// Closed or not
+						muBool closed;
+						// Cursor style
+						muCursorStyle cursor_style;
+					};
+					typedef struct muCOSAW32_WindowStates muCOSAW32_WindowStates;
+
+					struct muCOSAW32_WindowProperties {
+						// Pixel format
+						muPixelFormat format;
+						muBool use_format;
+						muBool format_set;
+						// Default pixel format value
+						int pixel_format;
+
+						// Min/Max dimensions
+						uint32_m min_width;
+						uint32_m min_height;
+						uint32_m max_width;
+						uint32_m max_height;
+
+						// Scroll level
+						int32_m scroll_level;
+
+						// Cursor position
+						int32_m cursor_x;
+						int32_m cursor_y;
+
+						// Text input
+						void (*text_input_callback)(muWindow window, uint8_m* data);
+						uint32_m text_cursor_x;
+						uint32_m text_cursor_y;
+					};
+					typedef struct muCOSAW32_WindowProperties muCOSAW32_WindowProperties;
+
+					struct muCOSAW32_WindowTemp {
+						// High surrogate for cross-WM_CHAR messages
+						WCHAR high_surrogate;
+					};
+					typedef struct muCOSAW32_WindowTemp muCOSAW32_WindowTemp;
+
+					struct muCOSAW32_Window {
+						muCOSAW32_WindowHandles handles;
+						muCOSAW32_Keymaps keymaps;
+						muCOSAW32_WindowStates states;
+						muCOSAW32_WindowProperties props;
+						muWindowCallbacks callbacks;
+						muCOSAW32_WindowTemp temp;
+					};
+					typedef struct muCOSAW32_Window muCOSAW32_Window;
+
+				/* Pmap */
+
+					// This entire section describes an atom-locked array of muCOSAW32_Window's.
+					// This is needed for when we need to find a muCOSAW32_Window based on just
+					// the Win32 handle (HWND), which happens in the proc function. Really sucks
+					// that I have to do this, but it works!
+
+					// The way the array works is by using a pointer array that doubles in memory
+					// to keep up with allocation every time new memory is needed. Each element
+					// in the array is a pointer to a valid muCOSA window or 0; when a window is
+					// removed, its slot is set to 0, marking it for overwriting, which will be
+					// done if a new window needs to be added and there is an empty slot.
+
+					// The limitation to this is that the array cannot "de-expand"; for the
+					// entire time that at least one muCOSA context exists, the amount of windows
+					// alllocated can only go up. This is never likely to be a large issue, as
+					// the VAST majority of programs will never allocate enough windows at once
+					// to ever make this considerable in terms of memory allocated, but it is a
+					// limitation nonetheless.
+
+					// Pointer map struct
+					struct muCOSAW32_WindowPMAP {
+						// Pointer to each window's memory
+						muCOSAW32_Window** windows;
+						// Amount of windows
+						size_m wincount;
+						// Amount of window array memory allocated; unit is amount of windows
+						size_m winlen;
+						// Locked state
+						LONG volatile locked;
+						// Amount of active muCOSA contexts;
+						// used to destroy all memory once all muCOSA contexts deactivate
+						size_m access_count;
+					};
+					typedef struct muCOSAW32_WindowPMAP muCOSAW32_WindowPMAP;
+
+					// Global window pmap
+					muCOSAW32_WindowPMAP muCOSAW32_GlobalWindowPMAP = MU_ZERO_STRUCT_CONST(muCOSAW32_WindowPMAP);
+
+					// Locks the window pmap to this thread
+					void muCOSAW32_window_pmap_lock(void) {
+						// Wait until we have it locked for this thread
+						while (InterlockedCompareExchange(&muCOSAW32_GlobalWindowPMAP.locked, 1, 0) == 1) {
+							// ...
+						}
+					}
+
+					// Unlocks the window pmap (make sure you have it locked under the current thread!)
+					void muCOSAW32_window_pmap_unlock(void) {
+						// Set locked bit to 0 atomically
+						_interlockedbittestandreset(&muCOSAW32_GlobalWindowPMAP.locked, 0);
+					}
+
+					// Adds a window to the window pmap
+					muCOSAResult muCOSAW32_window_pmap_add(muCOSAW32_Window* win) {
+						// Lock pmap to this thread
+						muCOSAW32_window_pmap_lock();
+
+						// Try and find an empty slot to fill
+						for (size_m s = 0; s < muCOSAW32_GlobalWindowPMAP.wincount; ++s) {
+							if (!muCOSAW32_GlobalWindowPMAP.windows[s]) {
+								// If an empty slot is found, fill it and leave
+								muCOSAW32_GlobalWindowPMAP.windows[s] = win;
+								muCOSAW32_window_pmap_unlock();
+								return MUCOSA_SUCCESS;
+							}
+						}
+
+						// Increment window count by 1
+						++muCOSAW32_GlobalWindowPMAP.wincount;
+
+						// If array is non-existent currently:
+						if (!muCOSAW32_GlobalWindowPMAP.windows) {
+							// Allocate 1 window worth
+							muCOSAW32_GlobalWindowPMAP.winlen = 1;
+							muCOSAW32_GlobalWindowPMAP.windows = (muCOSAW32_Window**)mug_alloc(sizeof(muCOSAW32_Window*), MUG_ALLOC_WINDOW);
+							// If unable to allocate:
+							if (!muCOSAW32_GlobalWindowPMAP.windows) {
+								// Set values to 0
+								muCOSAW32_GlobalWindowPMAP.wincount = 0;
+								muCOSAW32_GlobalWindowPMAP.winlen = 0;
+								// Unlock pmap
+								muCOSAW32_window_pmap_unlock();
+								// Return bad value
+								return MUCOSA_FAILED_MALLOC;
+							}
+						}
+
+						// If an array already exists, but we don't have enough memory allocated
+						else if (muCOSAW32_GlobalWindowPMAP.wincount >= muCOSAW32_GlobalWindowPMAP.winlen) {
+							// Multiply window length by 2
+							muCOSAW32_GlobalWindowPMAP.winlen *= 2;
+							// Reallocate this new length
+							muCOSAW32_Window** new_windows = (muCOSAW32_Window**)mug_realloc(
+								muCOSAW32_GlobalWindowPMAP.windows,
+								sizeof(muCOSAW32_Window*) * muCOSAW32_GlobalWindowPMAP.winlen
+							, MUG_ALLOC_WINDOW);
+
+							// If we failed to reallocate:
+							if (!new_windows) {
+								// Deincrement window count
+								--muCOSAW32_GlobalWindowPMAP.wincount;
+								// Undo winlen multiplication
+								muCOSAW32_GlobalWindowPMAP.winlen /= 2;
+								// Unlock pmap
+								muCOSAW32_window_pmap_unlock();
+								// Return bad value
+								return MUCOSA_FAILED_REALLOC;
+							}
+
+							// If we didn't fail, we point to the newly allocated memory
+							muCOSAW32_GlobalWindowPMAP.windows = new_windows;
+						}
+
+						// Set newly allocated window spot to the new window
+						muCOSAW32_GlobalWindowPMAP.windows[muCOSAW32_GlobalWindowPMAP.wincount-1] = win;
+
+						// Unlock pmap
+						muCOSAW32_window_pmap_unlock();
+						// Return success
+						return MUCOSA_SUCCESS;
+					}
+
+					// Removes a window from the pmap
+					void muCOSAW32_window_pmap_remove(muCOSAW32_Window* win) {
+						// Lock pmap to this thread
+						muCOSAW32_window_pmap_lock();
+
+						// Find window pointer within pmap
+						for (size_m p = 0; p < muCOSAW32_GlobalWindowPMAP.wincount; ++p) {
+							if (muCOSAW32_GlobalWindowPMAP.windows[p] == win) {
+								muCOSAW32_GlobalWindowPMAP.windows[p] = 0;
+								break;
+							}
+						}
+
+						// Unlock pmap
+						muCOSAW32_window_pmap_unlock();
+					}
+
+					// Cleans up all of the memory within the pmap
+					// Note that this does NOT lock/unlock; this should only be called with
+					// a thread that already has the global pmap locked
+					void muCOSAW32_window_pmap_cleanup(void) {
+						// Free the memory if it's allocated
+						if (muCOSAW32_GlobalWindowPMAP.windows) {
+							mug_dealloc(muCOSAW32_GlobalWindowPMAP.windows, MUG_ALLOC_WINDOW);
+						}
+						// Zero-out the global pmap struct
+						muCOSAW32_GlobalWindowPMAP = MU_ZERO_STRUCT(muCOSAW32_WindowPMAP);
+					}
+
+					// "Accesses" the pmap, marking a context as currently active
+					void muCOSAW32_window_pmap_access(void) {
+						// Lock the pmap
+						muCOSAW32_window_pmap_lock();
+
+						// Increment access count
+						++muCOSAW32_GlobalWindowPMAP.access_count;
+
+						// Unlock the pmap
+						muCOSAW32_window_pmap_unlock();
+					}
+
+					// "De-accesses" the pmap, marking a context as no longer active
+					void muCOSAW32_window_pmap_deaccess(void) {
+						// Lock the pmap
+						muCOSAW32_window_pmap_lock();
+
+						// Deincrement access count
+						--muCOSAW32_GlobalWindowPMAP.access_count;
+
+						// If access count is 0, no more contexts are active, which
+						// means that we should clean everything up
+						if (muCOSAW32_GlobalWindowPMAP.access_count == 0) {
+							muCOSAW32_window_pmap_cleanup();
+						}
+
+						// Unlock the pmap
+						muCOSAW32_window_pmap_unlock();
+					}
+
+					// Finds a pointer to a muCOSA window based on the HWND handle
+					muCOSAW32_Window* muCOSAW32_window_pmap_find(HWND hwnd) {
+						// Lock the pmap
+						muCOSAW32_window_pmap_lock();
+
+						// Default pointer
+						muCOSAW32_Window* wp = 0;
+
+						// Find pointer in array
+						for (size_m p = 0; p < muCOSAW32_GlobalWindowPMAP.wincount; ++p) {
+							if (muCOSAW32_GlobalWindowPMAP.windows[p] != 0 && 
+								muCOSAW32_GlobalWindowPMAP.windows[p]->handles.hwnd == hwnd
+							) {
+								wp = muCOSAW32_GlobalWindowPMAP.windows[p];
+								break;
+							}
+						}
+
+						// Unlock the pmap
+						muCOSAW32_window_pmap_unlock();
+						// Return pointer
+						return wp;
+					}
+
+				/* Proc */
+
+					// Info about a proc message
+					struct muCOSAW32_ProcMsg {
+						// Proc stuff
+						UINT uMsg;
+						WPARAM wParam;
+						LPARAM lParam;
+
+						// muCOSA window
+						muCOSAW32_Window* win;
+					};
+					typedef struct muCOSAW32_ProcMsg muCOSAW32_ProcMsg;
+
+					// Handling for WM_DESTROY; when a window is closed
+					LRESULT CALLBACK muCOSAW32_DESTROY(muCOSAW32_ProcMsg msg) {
+						PostQuitMessage(0);
+						msg.win->states.closed = MU_TRUE;
+						return 0;
+					}
+
+					// Separates left/right keys
+					WPARAM muCOSAW32_map_lr_keys(WPARAM vk, LPARAM lParam) {
+						// Separate scancode and left/right bit
+						UINT scancode = (lParam & 0x00ff0000) >> 16;
+						int  extended = (lParam & 0x01000000) != 0;
+
+						// Separate into left/right virtual key codes if need be
+						switch (vk) {
+							default: return vk; break;
+							case VK_SHIFT:   return MapVirtualKey(scancode, MAPVK_VSC_TO_VK_EX); break;
+							case VK_CONTROL: return extended ? VK_RCONTROL : VK_LCONTROL; break;
+							case VK_MENU:    return extended ? VK_RMENU    : VK_LMENU; break;
+						}
+					}
+
+					// Handling for WM_KEYDOWN and WM_KEYUP
+					LRESULT CALLBACK muCOSAW32_KEY(muCOSAW32_ProcMsg msg, muBool up) {
+						// Handle separation of keys based on left/right
+						msg.wParam = muCOSAW32_map_lr_keys(msg.wParam, msg.lParam);
+						// Convert Win32 key value to muCOSA key value
+						muKeyboardKey key = muCOSAW32_VK_to_muCOSA(msg.wParam);
+						// Return if key is unknown or out of range
+						if (key == MU_KEYBOARD_UNKNOWN || key >= MU_KEYBOARD_LENGTH) {
+							return 0;
+						}
+
+						// Set key state
+						msg.win->keymaps.keyboard[key] = up;
+						// Call keyboard callback
+						if (msg.win->callbacks.keyboard) {
+							msg.win->callbacks.keyboard(msg.win, key, up);
+						}
+
+						// Exit
+						return 0;
+					}
+
+					// Handling for WM_LBUTTONDOWN, WM_RBUTTONDOWN, WM_LBUTTONUP, and WM_RBUTTONDOWN
+					LRESULT CALLBACK muCOSAW32_MBUTTON(muCOSAW32_ProcMsg msg, muMouseKey key, muBool up) {
+						// Update keymap
+						msg.win->keymaps.mouse[key] = up;
+						// + Callback
+						if (msg.win->callbacks.mouse_key) {
+							msg.win->callbacks.mouse_key(msg.win, key, up);
+						}
+						return 0;
+					}
+
+					muCOSAResult muCOSAW32_window_get_dimensions(muCOSAW32_Window* win, uint32_m* data);
+					muCOSAResult muCOSAW32_window_get_cursor_pos(muCOSAW32_Window* win, int32_m* data);
+					// Handling for WM_SETCURSOR
+					LRESULT CALLBACK muCOSAW32_SETCURSOR(muCOSAW32_ProcMsg msg) {
+						// Only allow the cursor to change if it's outside the window surface
+						// This is a hack and a half, but largely works
+						int32_m cur[2]; muCOSAW32_window_get_cursor_pos(msg.win, cur);
+						uint32_m dim[2]; muCOSAW32_window_get_dimensions(msg.win, dim);
+						int32_m idim[2] = { (int32_m)dim[0], (int32_m)dim[1] };
+						if (cur[0] >= 0 && cur[1] >= 0 && cur[0] < idim[0] && cur[1] < idim[1]) {
+							SetCursor(msg.win->handles.hcursor);
+						} else {
+							return DefWindowProcW(msg.win->handles.hwnd, msg.uMsg, msg.wParam, msg.lParam);
+						}
+						return 0;
+					}
+
+					// Handling for WM_GETMINMAXINFO
+					LRESULT CALLBACK muCOSAW32_GETMINMAXINFO(muCOSAW32_ProcMsg msg) {
+						LPMINMAXINFO lp = (LPMINMAXINFO)msg.lParam;
+						// I have no idea why 16 and 39 need to be added here. Can't be borders
+						// because these numbers don't even nearly match the border values.
+						// If it works, it works :P
+						lp->ptMinTrackSize.x = msg.win->props.min_width + 16;
+						lp->ptMinTrackSize.y = msg.win->props.min_height + 39;
+						lp->ptMaxTrackSize.x = msg.win->props.max_width + 16;
+						lp->ptMaxTrackSize.y = msg.win->props.max_height + 39;
+						return 0;
+					}
+
+					// Handling for WM_MOUSEWHEEL
+					LRESULT CALLBACK muCOSAW32_MOUSEWHEEL(muCOSAW32_ProcMsg msg) {
+						// Add scroll level from wParam
+						int32_m add = GET_WHEEL_DELTA_WPARAM(msg.wParam);
+						msg.win->props.scroll_level += add;
+						// + Callback
+						if (msg.win->callbacks.scroll) {
+							msg.win->callbacks.scroll(msg.win, add);
+						}
+
+						return 0;
+					}
+
+					// Handling for WM_SIZE
+					LRESULT CALLBACK muCOSAW32_SIZE(muCOSAW32_ProcMsg msg) {
+						// Call dimensions callback
+						if (msg.win->callbacks.dimensions) {
+							msg.win->callbacks.dimensions(msg.win,
+								(uint32_m)(LOWORD(msg.lParam)),
+								(uint32_m)(HIWORD(msg.lParam))
+							);
+						}
+
+						// Not sure why we're calling this
+						// I think I vaguely remember this fixing some issue, but idk
+						PostMessage(msg.win->handles.hwnd, WM_PAINT, 0, 0);
+						return 0;
+					}
+
+					// Handling for WM_MOVE
+					LRESULT CALLBACK muCOSAW32_MOVE(muCOSAW32_ProcMsg msg) {
+						// Call position callback
+						if (msg.win->callbacks.position) {
+							// https://www.autohotkey.com/boards/viewtopic.php?t=27857
+							// I would KISS Bill on the mouth if I ever met him...
+							msg.win->callbacks.position(
+								msg.win,
+								(int32_m)( msg.lParam      & 0x8000 ? - ((~msg.lParam    ) & 0x7FFF)+1 : msg.lParam       & 0x7FFF),
+								(int32_m)((msg.lParam>>16) & 0x8000 ? - ((~msg.lParam>>16) & 0X7FFF)+1 : (msg.lParam>>16) & 0x7FFF)
+							);
+						}
+
+						return 0;
+					}
+
+					uint8_m muCOSAW32_UTF8_codepoint_size(uint32_m codepoint) {
+						// Storable in 7 bits = 1 byte
+						if (codepoint < 128) {
+							return 1;
+						}
+						// Storable in 11 bits = 2 bytes
+						if (codepoint < 2048) {
+							return 2;
+						}
+						// Storable in 16 bits = 3 bytes
+						if (codepoint < 65536) {
+							return 3;
+						}
+						return 4;
+					}
+
+					// Handling for WM_CHAR
+					LRESULT CALLBACK muCOSAW32_CHAR(muCOSAW32_ProcMsg msg) {
+						// Hold onto high surrogate if it is one
+						if (IS_HIGH_SURROGATE(msg.wParam)) {
+							msg.win->temp.high_surrogate = (WCHAR)msg.wParam;
+							return 0;
+						}
+
+						// Return if we aren't taking text input
+						if (!msg.win->props.text_input_callback) {
+							return DefWindowProcW(msg.win->handles.hwnd, msg.uMsg, msg.wParam, msg.lParam);
+						}
+
+						// Convert UTF-16 wParam to wchar_t* UTF-16 string
+						WCHAR wstr[3];
+						// - Surrogate pair
+						if (msg.win->temp.high_surrogate) {
+							wstr[0] = msg.win->temp.high_surrogate;
+							wstr[1] = (WCHAR)msg.wParam;
+							wstr[2] = 0;
+							// (Reset high surrogate)
+							msg.win->temp.high_surrogate = 0;
+						}
+						// - Non-surrogate pair
+						else {
+							wstr[0] = (WCHAR)msg.wParam;
+							wstr[1] = 0;
+						}
+
+						// Convert wchar_t* UTF-16 string to UTF-8 string
+						uint8_m buf[5];
+						if (!WideCharToMultiByte(CP_UTF8, WC_ERR_INVALID_CHARS, wstr, -1, (LPSTR)buf, sizeof(buf), NULL, NULL)) {
+							return 0;
+						}
+
+						// Callback
+						msg.win->props.text_input_callback(msg.win, buf);
+						return 0;
+					}
+
+					// Handling for WM_IME_STARTCOMPOSITION
+					LRESULT CALLBACK muCOSAW32_IME_STARTCOMPOSITION(muCOSAW32_ProcMsg msg) {
+						// Get IMM context handle
+						HIMC imc = ImmGetContext(msg.win->handles.hwnd);
+
+						// Fill out composition form
+						COMPOSITIONFORM cf = MU_ZERO_STRUCT(COMPOSITIONFORM);
+						cf.dwStyle = CFS_FORCE_POSITION;
+						cf.ptCurrentPos.x = msg.win->props.text_cursor_x;
+						cf.ptCurrentPos.y = msg.win->props.text_cursor_y;
+
+						// Send composition form
+						if (!ImmSetCompositionWindow(imc, &cf)) {
+							return 0;
+						}
+
+						// Release IMM context handle
+						ImmReleaseContext(msg.win->handles.hwnd, imc);
+						return 0;
+					}
+
+					// Handles a proc message
+					LRESULT muCOSAW32_procmsg(muCOSAW32_ProcMsg msg) {
+						// Do things based on the message code
+						switch (msg.uMsg) {
+							// Message code we're not processing; return default handling at end of switch
+							default: break;
+							// Window closing
+							case WM_DESTROY: return muCOSAW32_DESTROY(msg); break;
+							// Key down
+							case WM_KEYDOWN: return muCOSAW32_KEY(msg, MU_TRUE); break;
+							// Key up
+							case WM_KEYUP: return muCOSAW32_KEY(msg, MU_FALSE); break;
+							// Left mouse up
+							case WM_LBUTTONUP: return muCOSAW32_MBUTTON(msg, MU_MOUSE_LEFT, MU_FALSE); break;
+							// Left mouse down
+							case WM_LBUTTONDOWN: return muCOSAW32_MBUTTON(msg, MU_MOUSE_LEFT, MU_TRUE); break;
+							// Right mouse up
+							case WM_RBUTTONUP: return muCOSAW32_MBUTTON(msg, MU_MOUSE_RIGHT, MU_FALSE); break;
+							// Right mouse down
+							case WM_RBUTTONDOWN: return muCOSAW32_MBUTTON(msg, MU_MOUSE_RIGHT, MU_TRUE); break;
+							// Middle mouse up
+							case WM_MBUTTONUP: return muCOSAW32_MBUTTON(msg, MU_MOUSE_MIDDLE, MU_FALSE); break;
+							// Middle mouse down
+							case WM_MBUTTONDOWN: return muCOSAW32_MBUTTON(msg, MU_MOUSE_MIDDLE, MU_TRUE); break;
+							// Cursor style changing
+							case WM_SETCURSOR: return muCOSAW32_SETCURSOR(msg); break;
+							// Windows asking for min/max dimensions
+							case WM_GETMINMAXINFO: return muCOSAW32_GETMINMAXINFO(msg); break;
+							// Scrolling
+							case WM_MOUSEWHEEL: return muCOSAW32_MOUSEWHEEL(msg); break;
+							// Resizing
+							case WM_SIZE: return muCOSAW32_SIZE(msg); break;
+							// Movement
+							case WM_MOVE: return muCOSAW32_MOVE(msg); break;
+							// Character input
+							case WM_CHAR: return muCOSAW32_CHAR(msg); break;
+							// IME composition position
+							case WM_IME_STARTCOMPOSITION: return muCOSAW32_IME_STARTCOMPOSITION(msg); break;
+						}
+
+						// Default handling
+						return DefWindowProcW(msg.win->handles.hwnd, msg.uMsg, msg.wParam, msg.lParam);
+					}
+
+					// Proc function for Win32
+					LRESULT CALLBACK muCOSAW32_winproc(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM lParam) {
+						// Return default if hwnd is NULL
+						if (!hwnd) {
+							return DefWindowProcW(hwnd, uMsg, wParam, lParam);
+						}
+
+						// Start getting info about the proc
+						muCOSAW32_ProcMsg msg;
+
+						// Find window based on HWND
+						msg.win = muCOSAW32_window_pmap_find(hwnd);
+						if (!msg.win) {
+							return DefWindowProcW(hwnd, uMsg, wParam, lParam);
+						}
+
+						// Copy over other info
+						msg.uMsg = uMsg;
+						msg.wParam = wParam;
+						msg.lParam = lParam;
+
+						// Return proc message handling
+						return muCOSAW32_procmsg(msg);
+					}
+
+				/* Creation / Destruction */
+
+					muCOSAResult muCOSAW32_window_set_position(muCOSAW32_Window* win, int32_m* data);
+
+					muCOSAResult muCOSAW32_window_create(muWindowInfo* info, muCOSAW32_Window* win) {
+						/* Default attributes */
+
+							// Zero-ing-out
+							mu_memset(&win->handles, 0, sizeof(win->handles));
+							mu_memset(&win->keymaps, 0, sizeof(win->keymaps));
+
+							// Closed
+							win->states.closed = MU_FALSE;
+
+							// Cursor style
+							win->states.cursor_style = MU_CURSOR_ARROW;
+
+							// Pixel format
+							if (info->pixel_format) {
+								win->props.use_format = MU_TRUE;
+								win->props.format = *info->pixel_format;
+							} else {
+								win->props.use_format = MU_FALSE;
+							}
+							win->props.format_set = MU_FALSE;
+
+							// Min/Max dimensions
+							win->props.min_width = info->min_width;
+							win->props.min_height = info->min_height;
+							win->props.max_width = info->max_width;
+							win->props.max_height = info->max_height;
+							// - (Fix 0 defaults)
+							if (win->props.min_width == 0) {
+								win->props.min_width = 120;
+							}
+							if (win->props.min_height == 0) {
+								win->props.min_height = 1;
+							}
+							if (win->props.max_width == 0) {
+								win->props.max_width = 0x0FFFFFFF;
+							}
+							if (win->props.max_height == 0) {
+								win->props.max_height = 0x0FFFFFFF;
+							}
+
+							// Scroll level
+							win->props.scroll_level = 0;
+
+							// Cursor position
+							win->props.cursor_x = win->props.cursor_y = 0;
+
+							// Callbacks
+							// - Zero-out if no callbacks specified
+							if (!info->callbacks) {
+								mu_memset(&win->callbacks, 0, sizeof(win->callbacks));
+							}
+							// - Set all callbacks if specified
+							else {
+								win->callbacks = *info->callbacks;
+							}
+
+							// Text focus
+							win->props.text_input_callback = 0;
+							win->props.text_cursor_x = win->props.text_cursor_y = 0;
+
+							// High surrogate for WM_CHAR messages
+							win->temp.high_surrogate = 0;
+
+						/* Class */
+
+							// Window title
+							wchar_t* wname = muCOSAW32_utf8_to_wchar(info->title);
+							if (!wname) {
+								return MUCOSA_WIN32_FAILED_CONVERT_UTF8_TO_WCHAR;
+							}
+
+							// This is some of the jankiest code I've written!
+							// To generate a unique window class, I hamfistedly
+							// attempt to generate one by adding the actual pointer
+							// value of 'win' to a character, creating an often
+							// unreadable class title. This needs to be improved
+							// at some point, but works for me :P
+
+							win->handles.wclass_name[0] = (wchar_t)'!';
+
+							wchar_t add; // (Purposely left uninitialized for more randomness)
+							if (sizeof(wchar_t) < sizeof(win)) {
+								mu_memcpy(&add, &win, sizeof(wchar_t));
+							} else {
+								mu_memcpy(&add, &win, sizeof(win));
+							}
+
+							win->handles.wclass_name[0] += add;
+							win->handles.wclass_name[1] = (wchar_t)'\0';
+
+							// Hinstance
+							win->handles.hinstance = muCOSAW32_get_hinstance();
+							// Hcursor
+							win->handles.hcursor = LoadCursor(NULL, IDC_ARROW);
+
+							// Create class struct
+							WNDCLASSEXW wclass = MU_ZERO_STRUCT(WNDCLASSEXW);
+							wclass.cbSize = sizeof(wclass);
+							wclass.style = CS_HREDRAW | CS_VREDRAW | CS_OWNDC;
+							wclass.lpfnWndProc = muCOSAW32_winproc;
+							wclass.hInstance = win->handles.hinstance;
+							wclass.hCursor = win->handles.hcursor;
+							wclass.lpszMenuName = wname;
+							wclass.lpszClassName = win->handles.wclass_name;
+
+							// Register
+							if(!RegisterClassExW(&wclass)) {
+								mug_dealloc(wname, MUG_ALLOC_SCRATCH);
+								return MUCOSA_WIN32_FAILED_REGISTER_WINDOW_CLASS;
+							}
+
+						/* Window */
+
+							// Style
+							DWORD style = WS_OVERLAPPEDWINDOW;
+
+							// Rect for the window's dimensions
+							RECT r;
+							r.left = r.top = 0;
+							r.right = (LONG)info->width;
+							r.bottom = (LONG)info->height;
+							AdjustWindowRect(&r, style, FALSE);
+
+							// Create window
+							win->handles.hwnd = CreateWindowExW(
+								// dwExStyle
+								0,
+								// lpClassName
+								wclass.lpszClassName,
+								// lpWindowName
+								wclass.lpszMenuName,
+								// dwStyle
+								style,
+								// X, Y,
+								(int)info->x, (int)info->y,
+								// nWidth, nHeight
+								r.right-r.left, r.bottom-r.top,
+								// hWndParent
+								NULL,
+								// hMenu
+								NULL,
+								// hInstance
+								win->handles.hinstance,
+								// lpParam
+								NULL
+							);
+
+							// - Handle fail case
+							mug_dealloc(wname, MUG_ALLOC_SCRATCH);
+							if (win->handles.hwnd == NULL) {
+								UnregisterClassW(win->handles.wclass_name, win->handles.hinstance);
+								return MUCOSA_WIN32_FAILED_CREATE_WINDOW;
+							}
+
+						/* Pixel format */
+
+							// Get device context
+							win->handles.dc = GetDC(win->handles.hwnd);
+
+							// Handle default pixel format:
+							if (!info->pixel_format) {
+								// Generic pixel format descriptor
+								// Based on https://www.khronos.org/opengl/wiki/Creating_an_OpenGL_Context_(WGL)
+								PIXELFORMATDESCRIPTOR pfd = {
+									sizeof(PIXELFORMATDESCRIPTOR),
+									1,
+									PFD_DRAW_TO_WINDOW | PFD_SUPPORT_OPENGL | PFD_DOUBLEBUFFER,
+									PFD_TYPE_RGBA,
+									32,
+									0, 0, 0, 0, 0, 0,
+									0, 0, 0,
+									0, 0, 0, 0,
+									24, 8, 8,
+									PFD_MAIN_PLANE,
+									0,
+									0, 0, 0
+								};
+
+								// Find pixel format; fallback on 1
+								win->props.pixel_format = ChoosePixelFormat(win->handles.dc, &pfd);
+								if (!win->props.pixel_format) {
+									win->props.pixel_format = 1;
+								}
+							}
+
+							// Show window
+							ShowWindow(win->handles.hwnd, SW_NORMAL);
+
+						/* Auto-disable IME */
+
+							if (ImmAssociateContextEx(win->handles.hwnd, NULL, 0) == FALSE) {
+								// ?
+							}
+
+						/* Set position manually */
+
+							// A bit of a hack considering that it should work on the first try,
+							// but frame extents on Win32 will be frame extents on Win32.
+
+							int32_m pos[2] = { info->x, info->y };
+							muCOSAW32_window_set_position(win, pos);
+
+						/* Add window to pmap */
+
+							muCOSAResult res = muCOSAW32_window_pmap_add(win);
+							if (muCOSA_result_is_fatal(res)) {
+								return res;
+							}
+
+						return res;
+					}
+
+					void muCOSAW32_window_destroy(muCOSAW32_Window* win) {
+						// Release device context
+						ReleaseDC(win->handles.hwnd, win->handles.dc);
+						// Destroy window
+						DestroyWindow(win->handles.hwnd);
+						// Unregister window class
+						UnregisterClassW(win->handles.wclass_name, win->handles.hinstance);
+						// Remove window from pmap
+						muCOSAW32_window_pmap_remove(win);
+					}
+
+				/* Main loop */
+
+					muBool muCOSAW32_window_get_closed(muCOSAW32_Window* win) {
+						return win->states.closed;
+					}
+
+					void muCOSAW32_window_close(muCOSAW32_Window* win) {
+						// Set closed flag
+						win->states.closed = MU_TRUE;
+					}
+
+					// Checks all keystates and updates accordingly
+					void muCOSAW32_update_keystate(muCOSAW32_Window* win) {
+						// Loop through each possible keystate
+						for (muKeyboardState s = 1; s < MU_KEYSTATE_LENGTH; ++s) {
+							// Assume not on at first
+							muBool b = MU_FALSE;
+							// Convert keystate to Win32
+							int s_w32 = muCOSAW32_keystate_to_W32(s);
+							// If not recognized, continue:
+							if (s_w32 == VK_NONAME) {
+								continue;
+							}
+
+							// Set boolean to if it's on or off
+							b = (GetKeyState(s_w32) & 0x0001) != 0;
+							// Change value if different
+							if (b != win->keymaps.keystates[s]) {
+								win->keymaps.keystates[s] = b;
+
+								// + Callback
+								if (win->callbacks.keystate) {
+									win->callbacks.keystate(win, s, b);
+								}
+							}
+						}
+					}
+
+					// Handles the cursor changing position every frame;
+					// no corresponding Win32 proc for this as far as I'm aware :L
+					muCOSAResult muCOSAW32_window_get_cursor_pos(muCOSAW32_Window* win, int32_m* data);
+					void muCOSAW32_update_cursor(muCOSAW32_Window* win) {
+						// Get cursor position
+						int32_m c[2];
+						if (muCOSA_result_is_fatal(muCOSAW32_window_get_cursor_pos(win, c))) {
+							return;
+						}
+
+						// Update cursor position if changed
+						if (win->props.cursor_x != c[0] || win->props.cursor_y != c[1]) {
+							win->props.cursor_x = c[0];
+							win->props.cursor_y = c[1];
+							// + Callback
+							if (win->callbacks.cursor) {
+								win->callbacks.cursor(win, c[0], c[1]);
+							}
+						}
+					}
+
+					void muCOSAW32_window_update(muCOSAW32_Window* win) {
+						// Process messages
+						MSG msg = MU_ZERO_STRUCT(MSG);
+						while (PeekMessageA(&msg, 0, 0, 0, PM_REMOVE)) {
+							TranslateMessage(&msg);
+							DispatchMessage(&msg);
+						}
+
+						// Update keystates
+						muCOSAW32_update_keystate(win);
+						// Update cursor position
+						muCOSAW32_update_cursor(win);
+					}
+
+				/* Title */
+
+					// Set title
+					muCOSAResult muCOSAW32_window_set_title(muCOSAW32_Window* win, char* data) {
+						// Convert UTF-8 data to wchar_t* data
+						wchar_t* wtitle = muCOSAW32_utf8_to_wchar(data);
+						if (!wtitle) {
+							return MUCOSA_WIN32_FAILED_CONVERT_UTF8_TO_WCHAR;
+						}
+
+						// Set window title
+						if (!SetWindowTextW(win->handles.hwnd, wtitle)) {
+							mug_dealloc(wtitle, MUG_ALLOC_SCRATCH);
+							return MUCOSA_WIN32_FAILED_SET_WINDOW_ATTRIB;
+						}
+
+						mug_dealloc(wtitle, MUG_ALLOC_SCRATCH);
+						return MUCOSA_SUCCESS;
+					}
+
+				/* Frame extents */
+
+					// Default frame extents
+					// I love you Bill...
+					void muCOSAW32_def_window_frame_extents(uint32_m* data) {
+						data[0] = data[1] = data[3] = (uint32_m)GetSystemMetrics(SM_CXSIZEFRAME);
+						data[2] = (uint32_m)(GetSystemMetrics(SM_CYFRAME) + GetSystemMetrics(SM_CYCAPTION) + GetSystemMetrics(92));
+					}
+
+					// Get frame extents for a window
+					// I LOVE YOU BILL GATES!!!!!
+					void muCOSAW32_window_get_frame_extents(muCOSAW32_Window* win, uint32_m* data) {
+						// Fallback
+						muCOSAW32_def_window_frame_extents(data);
+
+						// Get window and client rect
+						RECT wr, cr;
+						if (!GetWindowRect(win->handles.hwnd, &wr)) {
+							// (Not returning error since default window frame extents are filled)
+							return;
+						}
+						if (!GetClientRect(win->handles.hwnd, &cr)) {
+							return;
+						}
+
+						// Map client rect to window points
+						if (!MapWindowPoints(win->handles.hwnd, NULL, (LPPOINT)&cr, 2)) {
+							return;
+						}
+
+						// Set values based on window and client rect
+						data[0] = (uint32_m)(cr.left-wr.left);
+						data[1] = (uint32_m)(wr.right-cr.right);
+						data[2] = (uint32_m)(cr.top-wr.top);
+						data[3] = (uint32_m)(wr.bottom-cr.bottom);
+					}
+
+				/* Dimensions */
+
+					muCOSAResult muCOSAW32_window_get_dimensions(muCOSAW32_Window* win, uint32_m* data) {
+						// Get client rect
+						RECT r;
+						if (!GetClientRect(win->handles.hwnd, &r)) {
+							return MUCOSA_WIN32_FAILED_GET_WINDOW_ATTRIB;
+						}
+
+						// Set values
+						data[0] = (uint32_m)(r.right-r.left);
+						data[1] = (uint32_m)(r.bottom-r.top);
+						return MUCOSA_SUCCESS;
+					}
+
+					muCOSAResult muCOSAW32_window_set_dimensions(muCOSAW32_Window* win, uint32_m* data) {
+						// Get general window info for style
+						WINDOWINFO wi;
+						if (!GetWindowInfo(win->handles.hwnd, &wi)) {
+							return MUCOSA_WIN32_FAILED_SET_WINDOW_ATTRIB;
+						}
+
+						// Calculate rect
+						RECT r;
+						r.left = r.top = 0;
+						r.right = data[0];
+						r.bottom = data[1];
+
+						// Calculate appropriate window rect for dimensions
+						if (!AdjustWindowRect(&r, wi.dwStyle, FALSE)) {
+							return MUCOSA_WIN32_FAILED_SET_WINDOW_ATTRIB;
+						}
+
+						// Set window rect based on this
+						if (!SetWindowPos(win->handles.hwnd, HWND_TOP, 0, 0, r.right-r.left, r.bottom-r.top, SWP_NOACTIVATE | SWP_NOZORDER | SWP_NOMOVE)) {
+							return MUCOSA_WIN32_FAILED_SET_WINDOW_ATTRIB;
+						}
+						return MUCOSA_SUCCESS;
+					}
+
+				/* Position */
+
+					muCOSAResult muCOSAW32_window_get_position(muCOSAW32_Window* win, int32_m* data) {
+						// Get window rect
+						RECT r;
+						if (!GetWindowRect(win->handles.hwnd, &r)) {
+							return MUCOSA_WIN32_FAILED_GET_WINDOW_ATTRIB;
+						}
+
+						// Get frame extents
+						uint32_m fe[4];
+						muCOSAW32_window_get_frame_extents(win, fe);
+
+						// Set position based on rect and relative frame extents
+						data[0] = (int32_m)(r.left) + (int32_m)(fe[0]);
+						data[1] = (int32_m)(r.top) + (int32_m)(fe[2]);
+						return MUCOSA_SUCCESS;
+					}
+
+					muCOSAResult muCOSAW32_window_set_position(muCOSAW32_Window* win, int32_m* data) {
+						// Get frame extents
+						uint32_m fe[4];
+						muCOSAW32_window_get_frame_extents(win, fe);
+
+						// Translate x and y based on extents
+						int32_m x = data[0] - (int32_m)(fe[0]);
+						int32_m y = data[1] - (int32_m)(fe[2]);
+
+						// Set window position
+						if (!SetWindowPos(win->handles.hwnd, HWND_TOP, x, y, 0, 0, SWP_NOACTIVATE | SWP_NOZORDER | SWP_NOSIZE)) {
+							return MUCOSA_WIN32_FAILED_SET_WINDOW_ATTRIB;
+						}
+						return MUCOSA_SUCCESS;
+					}
+
+				/* Keymaps */
+
+					muCOSAResult muCOSAW32_window_get_keyboard_map(muCOSAW32_Window* win, muBool** data) {
+						// Point to keyboard keymap
+						*data = win->keymaps.keyboard;
+						return MUCOSA_SUCCESS;
+					}
+
+					muCOSAResult muCOSAW32_window_get_keystate_map(muCOSAW32_Window* win, muBool** data) {
+						// Point to keystate keymap
+						*data = win->keymaps.keystates;
+						return MUCOSA_SUCCESS;
+					}
+
+					muCOSAResult muCOSAW32_window_get_mouse_map(muCOSAW32_Window* win, muBool** data) {
+						// Point to mouse keymap
+						*data = win->keymaps.mouse;
+						return MUCOSA_SUCCESS;
+					}
+
+				/* Cursor */
+
+					muCOSAResult muCOSAW32_window_get_cursor_pos(muCOSAW32_Window* win, int32_m* data) {
+						// Get cursor position
+						POINT p;
+						if (!GetCursorPos(&p)) {
+							return MUCOSA_WIN32_FAILED_GET_WINDOW_ATTRIB;
+						}
+
+						// Get window position
+						int32_m wpos[2];
+						muCOSAResult res = muCOSAW32_window_get_position(win, wpos);
+						if (muCOSA_result_is_fatal(res)) {
+							return MUCOSA_WIN32_FAILED_GET_WINDOW_ATTRIB;
+						}
+
+						// Retrieve cursor position relative to window
+						data[0] = p.x-wpos[0];
+						data[1] = p.y-wpos[1];
+						return res;
+					}
+
+					muCOSAResult muCOSAW32_window_set_cursor_pos(muCOSAW32_Window* win, int32_m* data) {
+						// Get window position
+						int32_m wpos[2];
+						muCOSAResult res = muCOSAW32_window_get_position(win, wpos);
+						if (muCOSA_result_is_fatal(res)) {
+							return MUCOSA_WIN32_FAILED_SET_WINDOW_ATTRIB;
+						}
+
+						// Set cursor position relative to window
+						if (!SetCursorPos(wpos[0]+data[0], wpos[1]+data[1])) {
+							return MUCOSA_WIN32_FAILED_SET_WINDOW_ATTRIB;
+						}
+						return res;
+					}
+
+					muCOSAResult muCOSAW32_window_get_cursor_style(muCOSAW32_Window* win, muCursorStyle* data) {
+						// Set data to cursor style
+						*data = win->states.cursor_style;
+						return MUCOSA_SUCCESS;
+					}
+
+					muCOSAResult muCOSAW32_window_set_cursor_style(muCOSAW32_Window* win, muCursorStyle* data) {
+						// Set internal storage to cursor style
+						win->states.cursor_style = *data;
+						// Destroy cursor
+						DestroyCursor(win->handles.hcursor);
+						// Load cursor
+						win->handles.hcursor = LoadCursor(0, (LPCSTR)muCOSAW32_muCOSA_cursor_to_W32(*data));
+						// Set cursor
+						SetCursor(win->handles.hcursor);
+						return MUCOSA_SUCCESS;
+					}
+
+				/* Scroll */
+
+					void muCOSAW32_window_get_scroll(muCOSAW32_Window* win, int32_m* data) {
+						// Give scroll level
+						*data = win->props.scroll_level;
+					}
+
+					void muCOSAW32_window_set_scroll(muCOSAW32_Window* win, int32_m* data) {
+						// Overwrite scroll level
+						win->props.scroll_level = *data;
+					}
+
+				/* Callbacks */
+
+					void muCOSAW32_window_set_callback(muCOSAW32_Window* win, muWindowAttrib attrib, void* fun) {
+						switch (attrib) {
+							case MU_WINDOW_DIMENSIONS_CALLBACK: {
+								mu_memcpy(&win->callbacks.dimensions, fun, sizeof(win->callbacks.dimensions));
+							} break;
+							case MU_WINDOW_POSITION_CALLBACK: {
+								mu_memcpy(&win->callbacks.position, fun, sizeof(win->callbacks.position));
+							} break;
+							case MU_WINDOW_KEYBOARD_CALLBACK: {
+								mu_memcpy(&win->callbacks.keyboard, fun, sizeof(win->callbacks.keyboard));
+							} break;
+							case MU_WINDOW_KEYSTATE_CALLBACK: {
+								mu_memcpy(&win->callbacks.keystate, fun, sizeof(win->callbacks.keystate));
+							} break;
+							case MU_WINDOW_MOUSE_KEY_CALLBACK: {
+								mu_memcpy(&win->callbacks.mouse_key, fun, sizeof(win->callbacks.mouse_key));
+							} break;
+							case MU_WINDOW_CURSOR_CALLBACK: {
+								mu_memcpy(&win->callbacks.cursor, fun, sizeof(win->callbacks.cursor));
+							} break;
+							case MU_WINDOW_SCROLL_CALLBACK: {
+								mu_memcpy(&win->callbacks.scroll, fun, sizeof(win->callbacks.scroll));
+							} break;
+						}
+					}
+
+				/* Text input */
+
+					void muCOSAW32_window_update_text_cursor(muCOSAResult* result, muCOSAW32_Window* win, uint32_m cx, uint32_m cy);
+					void muCOSAW32_window_get_text_input(muCOSAResult* result, muCOSAW32_Window* win, uint32_m cx, uint32_m cy, void (*callback)(muWindow, uint8_m*)) {
+						// Associate IMM context with this window
+						if (!ImmAssociateContextEx(win->handles.hwnd, NULL, IACE_DEFAULT)) {
+							MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_ASSOCIATE_IMM)
+							return;
+						}
+
+						// Set callback
+						win->props.text_input_callback = callback;
+						// Update text cursor position
+						muCOSAW32_window_update_text_cursor(0, win, cx, cy);
+					}
+
+					void muCOSAW32_window_let_text_input(muCOSAW32_Window* win) {
+						// Set callback to nothing
+						win->props.text_input_callback = 0;
+						// Deassociate IMM context
+						ImmAssociateContextEx(win->handles.hwnd, NULL, 0);
+					}
+
+					void muCOSAW32_window_update_text_cursor(muCOSAResult* result, muCOSAW32_Window* win, uint32_m cx, uint32_m cy) {
+						// Do nothing if text input isn't being taken
+						if (!win->props.text_input_callback) {
+							return;
+						}
+
+						// Might not be a good idea to keep grabbing an releasing IMM context,
+						// but the entire IMM is so fragile that the smallest change makes it
+						// not function at all. So, I'm keeping it like this :L
+
+						// Get IMM context handle
+						win->handles.imc = ImmGetContext(win->handles.hwnd);
+
+						// Fill out composition form
+						COMPOSITIONFORM cf = MU_ZERO_STRUCT(COMPOSITIONFORM);
+						cf.dwStyle = CFS_FORCE_POSITION;
+						cf.ptCurrentPos.x = cx;
+						cf.ptCurrentPos.y = cy;
+
+						// Send composition form
+						if (!ImmSetCompositionWindow(win->handles.imc, &cf)) {
+							MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_SET_COMPOSITION_WINDOW_POSITION)
+						}
+
+						// Release IMM context handle
+						ImmReleaseContext(win->handles.hwnd, win->handles.imc);
+					}
+
+				/* OpenGL */
+
+				#ifdef MU_SUPPORT_OPENGL
+
+					struct muCOSAW32_GL {
+						HDC dc;
+						HGLRC hgl;
+					};
+					typedef struct muCOSAW32_GL muCOSAW32_GL;
+
+					void* muCOSAW32_gl_context_create(muCOSAW32_Context* context, muCOSAResult* result, muCOSAW32_Window* win, muGraphicsAPI api) {
+						// Allocate memory for context
+						muCOSAW32_GL* gl = (muCOSAW32_GL*)mug_alloc(sizeof(muCOSAW32_GL), MUG_ALLOC_WINDOW);
+						if (!gl) {
+							MU_SET_RESULT(result, MUCOSA_FAILED_MALLOC)
+							return 0;
+						}
+						gl->dc = win->handles.dc;
+
+						// Create OpenGL context
+						muPixelFormat* format = 0;
+						if (win->props.use_format) {
+							format = &win->props.format;
+						}
+						muCOSAResult res = muCOSAW32_create_opengl_context(win->handles.dc, win->props.pixel_format, &context->wgl, format, &gl->hgl, api, &win->props.format_set);
+						if (res != MUCOSA_SUCCESS) {
+							MU_SET_RESULT(result, res)
+							if (muCOSA_result_is_fatal(res)) {
+								mug_dealloc(gl, MUG_ALLOC_WINDOW);
+								gl = 0;
+							}
+						}
+						return gl;
+					}
+
+					void muCOSAW32_gl_context_destroy(muCOSAW32_GL* gl) {
+						wglDeleteContext(gl->hgl);
+						mug_dealloc(gl, MUG_ALLOC_WINDOW);
+					}
+
+					muCOSAResult muCOSAW32_gl_bind(muCOSAW32_GL* gl) {
+						if (!wglMakeCurrent(gl->dc, gl->hgl)) {
+							return MUCOSA_WIN32_FAILED_SET_WGL_CONTEXT;
+						}
+						return MUCOSA_SUCCESS;
+					}
+
+					muCOSAResult muCOSAW32_gl_swap_buffers(muCOSAW32_Window* win) {
+						if (!SwapBuffers(win->handles.dc)) {
+							return MUCOSA_WIN32_FAILED_SWAP_WGL_BUFFERS;
+						}
+						return MUCOSA_SUCCESS;
+					}
+
+					void* muCOSAW32_gl_get_proc_address(const char* name) {
+						// Get proc address based on name
+						PROC p = (PROC)wglGetProcAddress(name);
+
+						// If failed:
+						if (p == 0
+							|| (p == (PROC)1)
+							|| (p == (PROC)2)
+							|| (p == (PROC)3)
+							|| (p == (PROC)-1)
+						) {
+							// Try loading from DLL itself
+							HMODULE module = LoadLibraryA("opengl32.dll");
+							p = (PROC)GetProcAddress(module, name);
+						}
+
+						// Convert to void* in a way that avoids warnings
+						void* vptr = 0;
+						mu_memcpy(&vptr, &p, sizeof(void*));
+						return vptr;
+					}
+
+					muBool muCOSAW32_gl_swap_interval(muCOSAW32_Context* context, muCOSAResult* result, int interval) {
+						// If the swap interval function was not found when loading, quit
+						if (!context->wgl.SwapInterval) {
+							MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_FIND_WGL_FUNCTION)
+							return 0;
+						}
+
+						// Return a call to it if we've found it
+						return context->wgl.SwapInterval(interval);
+					}
+
+				#endif /* MU_SUPPORT_OPENGL */
+
+			#endif /* MUCOSA_WIN32 */
+
+			/* Inner */
+
+				// Inner struct
+				struct muCOSA_Inner {
+					muWindowSystem system;
+					void* context;
+				};
+				typedef struct muCOSA_Inner muCOSA_Inner;
+
+				// Determines the best window system
+				muWindowSystem muCOSA_best_window_system(void) {
+					#ifdef MUCOSA_WIN32
+						return MU_WINDOW_WIN32;
+					#else
+						return 0;
+					#endif
+				}
+
+				// Creates a valid inner struct based on the requested system
+				muCOSAResult muCOSA_inner_create(muCOSA_Inner* inner, muWindowSystem system) {
+					// Find best window system
+					if (system == 0) {
+						system = muCOSA_best_window_system();
+					}
+					inner->system = system;
+
+					// Create context based on system
+					switch (system) {
+						// Unknown/Unsupported/None supported:
+						default: return MUCOSA_FAILED_NULL_WINDOW_SYSTEM; break;
+
+						// Win32
+						MUCOSA_WIN32_CALL(
+							case MU_WINDOW_WIN32: {
+								// Allocate context
+								inner->context = mug_alloc(sizeof(muCOSAW32_Context), MUG_ALLOC_WINDOW);
+								if (!inner->context) {
+									return MUCOSA_FAILED_MALLOC;
+								}
+
+								// Create context
+								muCOSAResult res = muCOSAW32_context_init((muCOSAW32_Context*)inner->context);
+								if (muCOSA_result_is_fatal(res)) {
+									mug_dealloc(inner->context, MUG_ALLOC_WINDOW);
+								}
+								return res;
+							} break;
+						)
+					}
+				}
+
+				// Destroys inner struct based on system
+				void muCOSA_inner_destroy(muCOSA_Inner* inner) {
+					switch (inner->system) {
+						default: break;
+
+						// Win32
+						MUCOSA_WIN32_CALL(
+							case MU_WINDOW_WIN32: {
+								// Destroy context
+								muCOSAW32_context_term((muCOSAW32_Context*)inner->context);
+							} break;
+						)
+					}
+				}
+
+			// Name call macro
+			#ifdef MUCOSA_NAMES
+				#define MUCOSA_NAME_CALL(...) __VA_ARGS__
+			#else
+				#define MUCOSA_NAME_CALL(...)
+			#endif
+
+			/* Context */
+
+				MUDEF void muCOSA_context_create(muCOSAContext* context, muWindowSystem system, muBool set_context) {
+					// Allocate context
+					context->inner = mug_alloc(sizeof(muCOSA_Inner), MUG_ALLOC_WINDOW);
+					if (!context->inner) {
+						context->result = MUCOSA_FAILED_MALLOC;
+						return;
+					}
+
+					// Create context
+					context->result = muCOSA_inner_create((muCOSA_Inner*)context->inner, system);
+					if (muCOSA_result_is_fatal(context->result)) {
+						mug_dealloc(context->inner, MUG_ALLOC_WINDOW);
+						return;
+					}
+
+					// Set context if necessary
+					if (set_context) {
+						muCOSA_context_set(context);
+					}
+				}
+
+				MUDEF void muCOSA_context_destroy(muCOSAContext* context) {
+					// Free and destroy if inner contents exist
+					if (context->inner) {
+						muCOSA_inner_destroy((muCOSA_Inner*)context->inner);
+						mug_dealloc(context->inner, MUG_ALLOC_WINDOW);
+					}
+				}
+
+				// Global context
+				muCOSAContext* muCOSA_global_context = 0;
+
+				// Set context
+				MUDEF void muCOSA_context_set(muCOSAContext* context) {
+					muCOSA_global_context = context;
+				}
+
+				// Get window system
+				MUDEF muWindowSystem muCOSA_context_get_window_system(muCOSAContext* context) {
+					return ((muCOSA_Inner*)context->inner)->system;
+				}
+
+			/* Window */
+
+				/* Creation / Destruction */
+
+					MUDEF muWindow muCOSA_window_create(muCOSAContext* context, muCOSAResult* result, muWindowInfo* info) {
+						// Get inner from context
+						muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+
+						// Do thing based on window system
+						switch (inner->system) {
+							default: return 0; break;
+
+							// Win32
+							MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32 : {
+								// Allocate window memory
+								muCOSAW32_Window* win = (muCOSAW32_Window*)mug_alloc(sizeof(muCOSAW32_Window), MUG_ALLOC_WINDOW);
+								if (!win) {
+									MU_SET_RESULT(result, MUCOSA_FAILED_MALLOC)
+									return 0;
+								}
+
+								// Create window
+								muCOSAResult res = muCOSAW32_window_create(info, win);
+								if (res != MUCOSA_SUCCESS) {
+									MU_SET_RESULT(result, res)
+									if (muCOSA_result_is_fatal(res)) {
+										mug_dealloc(win, MUG_ALLOC_WINDOW);
+										MU_SET_RESULT(result, res)
+										return 0;
+									}
+								}
+								return win;
+							} break;)
+						}
+
+						// To avoid unused parameter warnings in some cases
+						if (result) {} if (info) {}
+					}
+
+					MUDEF muWindow muCOSA_window_destroy(muCOSAContext* context, muWindow win) {
+						// Get inner from context
+						muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+
+						// Do things based on window system
+						switch (inner->system) {
+							default: return 0; break;
+
+							// Win32
+							MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+								// Destroy window
+								muCOSAW32_window_destroy((muCOSAW32_Window*)win);
+								// Free memory
+								mug_dealloc(win, MUG_ALLOC_WINDOW);
+								return 0;
+							} break;)
+						}
+
+						// To avoid unused parameter warnings in some cases
+						if (win) {}
+					}
+
+				/* Main loop */
+
+					MUDEF muBool muCOSA_window_get_closed(muCOSAContext* context, muCOSAResult* result, muWindow win) {
+						// Get inner from context
+						muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+
+						// Do things based on window system
+						switch (inner->system) {
+							default: return 0; break;
+
+							// Win32
+							MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+								return muCOSAW32_window_get_closed((muCOSAW32_Window*)win);
+							} break;)
+						}
+
+						// To avoid unused parameter warnings in some cases
+						if (result) {} if (win) {}
+					}
+
+					MUDEF void muCOSA_window_close(muCOSAContext* context, muWindow win) {
+						// Get inner from context
+						muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+
+						// Do things based on window system
+						switch (inner->system) {
+							default: return; break;
+
+							// Win32
+							MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+								muCOSAW32_window_close((muCOSAW32_Window*)win);
+								return;
+							} break;)
+						}
+
+						// To avoid unused parameter warnings in some cases
+						if (win) {}
+					}
+
+					MUDEF void muCOSA_window_update(muCOSAContext* context, muCOSAResult* result, muWindow win) {
+						// Get inner from context
+						muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+
+						// Do things based on window system
+						switch (inner->system) {
+							default: return; break;
+
+							// Win32
+							MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+								muCOSAW32_window_update((muCOSAW32_Window*)win);
+								return;
+							} break;)
+						}
+
+						// To avoid unused parameter warnings in some cases
+						if (result) {} if (win) {}
+					}
+
+				/* Get / Set */
+
+					MUDEF void muCOSA_window_get(muCOSAContext* context, muCOSAResult* result, muWindow win, muWindowAttrib attrib, void* data) {
+						// Get inner from context
+						muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+
+						// Do things based on window system
+						switch (inner->system) {
+							default: return; break;
+
+							// Win32
+							MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+								muCOSAResult res = MUCOSA_SUCCESS;
+								muCOSAW32_Window* w32_win = (muCOSAW32_Window*)win;
+
+								// Do things based on attribute
+								switch (attrib) {
+									default: MU_SET_RESULT(result, MUCOSA_FAILED_UNKNOWN_WINDOW_ATTRIB) return; break;
+
+									// Dimensions
+									case MU_WINDOW_DIMENSIONS: res = muCOSAW32_window_get_dimensions(w32_win, (uint32_m*)data); break;
+									// Position
+									case MU_WINDOW_POSITION: res = muCOSAW32_window_get_position(w32_win, (int32_m*)data); break;
+									// Keyboard keymap
+									case MU_WINDOW_KEYBOARD_MAP: res = muCOSAW32_window_get_keyboard_map(w32_win, (muBool**)data); break;
+									// Keystate keymap
+									case MU_WINDOW_KEYSTATE_MAP: res = muCOSAW32_window_get_keystate_map(w32_win, (muBool**)data); break;
+									// Mouse keymap
+									case MU_WINDOW_MOUSE_MAP: res = muCOSAW32_window_get_mouse_map(w32_win, (muBool**)data); break;
+									// Scroll
+									case MU_WINDOW_SCROLL_LEVEL: muCOSAW32_window_get_scroll(w32_win, (int32_m*)data); return; break;
+									// Cursor
+									case MU_WINDOW_CURSOR: res = muCOSAW32_window_get_cursor_pos(w32_win, (int32_m*)data); break;
+									// Cursor style
+									case MU_WINDOW_CURSOR_STYLE: res = muCOSAW32_window_get_cursor_style(w32_win, (muCursorStyle*)data); break;
+								}
+
+								if (res != MUCOSA_SUCCESS) {
+									MU_SET_RESULT(result, res)
+								}
+								return;
+							} break;)
+						}
+
+						// To avoid unused parameter warnings in some cases
+						if (result) {} if (win) {} if (attrib) {} if (data) {}
+					}
+
+					MUDEF void muCOSA_window_set(muCOSAContext* context, muCOSAResult* result, muWindow win, muWindowAttrib attrib, void* data) {
+						// Get inner from context
+						muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+
+						// Do things based on window system
+						switch (inner->system) {
+							default: return; break;
+
+							// Win32
+							MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+								muCOSAResult res = MUCOSA_SUCCESS;
+								muCOSAW32_Window* w32_win = (muCOSAW32_Window*)win;
+
+								// Do things based on attribute
+								switch (attrib) {
+									default: MU_SET_RESULT(result, MUCOSA_FAILED_UNKNOWN_WINDOW_ATTRIB) return; break;
+
+									// Title
+									case MU_WINDOW_TITLE: res = muCOSAW32_window_set_title(w32_win, (char*)data); break;
+									// Dimensions
+									case MU_WINDOW_DIMENSIONS: res = muCOSAW32_window_set_dimensions(w32_win, (uint32_m*)data); break;
+									// Position
+									case MU_WINDOW_POSITION: res = muCOSAW32_window_set_position(w32_win, (int32_m*)data); break;
+									// Scroll
+									case MU_WINDOW_SCROLL_LEVEL: muCOSAW32_window_set_scroll(w32_win, (int32_m*)data); return; break;
+									// Cursor
+									case MU_WINDOW_CURSOR: res = muCOSAW32_window_set_cursor_pos(w32_win, (int32_m*)data); break;
+									// Cursor style
+									case MU_WINDOW_CURSOR_STYLE: res = muCOSAW32_window_set_cursor_style(w32_win, (muCursorStyle*)data); break;
+									// Callbacks
+									case MU_WINDOW_DIMENSIONS_CALLBACK: case MU_WINDOW_POSITION_CALLBACK:
+									case MU_WINDOW_KEYBOARD_CALLBACK: case MU_WINDOW_KEYSTATE_CALLBACK:
+									case MU_WINDOW_MOUSE_KEY_CALLBACK: case MU_WINDOW_CURSOR_CALLBACK:
+									case MU_WINDOW_SCROLL_CALLBACK: muCOSAW32_window_set_callback(w32_win, attrib, data); return; break;
+								}
+
+								if (res != MUCOSA_SUCCESS) {
+									MU_SET_RESULT(result, res)
+								}
+								return;
+							} break;)
+						}
+
+						// To avoid unused parameter warnings in some cases
+						if (result) {} if (win) {} if (attrib) {} if (data) {}
+					}
+
+				/* Text input */
+
+					MUDEF void muCOSA_window_get_text_input(muCOSAContext* context, muCOSAResult* result, muWindow win, uint32_m text_cursor_x, uint32_m text_cursor_y, void (*callback)(muWindow window, uint8_m* data)) {
+						// Get inner from context
+						muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+
+						// Do things based on window system
+						switch (inner->system) {
+							default: return; break;
+
+							// Win32
+							MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+								muCOSAW32_window_get_text_input(result, (muCOSAW32_Window*)win, text_cursor_x, text_cursor_y, callback);
+								return;
+							} break;)
+						}
+
+						// To avoid unused parameter warnings in some cases
+						if (result) {} if (win) {} if (text_cursor_x) {} if (text_cursor_y) {} if (callback) {}
+					}
+
+					MUDEF void muCOSA_window_let_text_input(muCOSAContext* context, muWindow win) {
+						// Get inner from context
+						muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+
+						// Do things based on window system
+						switch (inner->system) {
+							default: return; break;
+
+							// Win32
+							MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+								muCOSAW32_window_let_text_input((muCOSAW32_Window*)win);
+								return;
+							} break;)
+						}
+
+						// To avoid unused parameter warnings in some cases
+						if (win) {}
+					}
+
+					MUDEF void muCOSA_window_update_text_cursor(muCOSAContext* context, muCOSAResult* result, muWindow win, uint32_m x, uint32_m y) {
+						// Get inner from context
+						muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+
+						// Do things based on window system
+						switch (inner->system) {
+							default: return; break;
+
+							// Win32
+							MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+								muCOSAW32_window_update_text_cursor(result, (muCOSAW32_Window*)win, x, y);
+								return;
+							} break;)
+						}
+
+						// To avoid unused parameter warnings in some cases
+						if (result) {} if (win) {} if (x) {} if (y) {}
+					}
+
+				/* OpenGL */
+
+					MUDEF muGLContext muCOSA_gl_context_create(muCOSAContext* context, muCOSAResult* result, muWindow win, muGraphicsAPI api) {
+						#ifdef MU_SUPPORT_OPENGL
+						// Get inner from context
+						muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+
+						// Do things based on window system
+						switch (inner->system) {
+							default: return 0; break;
+
+							// Win32
+							MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+								return muCOSAW32_gl_context_create(
+									(muCOSAW32_Context*)inner->context, result,
+									(muCOSAW32_Window*)win, api
+								);
+							} break;)
+						}
+
+						// To avoid parameter warnings in certain circumstances
+						if (result) {} if (win) {} if (api) {}
+
+						// Fallback for non-OpenGL support:
+						#else
+						MU_SET_RESULT(result, MUCOSA_FAILED_UNSUPPORTED_GRAPHICS_API)
+						return 0;
+						if (context) {} if (result) {} if (win) {} if (api) {}
+						#endif
+					}
+
+					MUDEF muGLContext muCOSA_gl_context_destroy(muCOSAContext* context, muWindow win, muGLContext gl_context) {
+						#ifdef MU_SUPPORT_OPENGL
+						// Get inner from context
+						muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+
+						// Do things based on window system
+						switch (inner->system) {
+							default: return 0; break;
+
+							// Win32
+							MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+								muCOSAW32_gl_context_destroy((muCOSAW32_GL*)gl_context);
+								return 0;
+							} break;)
+						}
+
+						// To avoid parameter warnings in certain circumstances
+						if (win) {} if (gl_context) {}
+
+						// Fallback for non-OpenGL support:
+						#else
+						return 0;
+						if (context) {} if (win) {} if (gl_context) {}
+						#endif
+					}
+
+					MUDEF void muCOSA_gl_bind(muCOSAContext* context, muCOSAResult* result, muWindow win, muGLContext gl_context) {
+						#ifdef MU_SUPPORT_OPENGL
+						// Get inner from context
+						muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+
+						// Do things based on window system
+						switch (inner->system) {
+							default: return; break;
+
+							// Win32
+							MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+								muCOSAResult res = muCOSAW32_gl_bind((muCOSAW32_GL*)gl_context);
+								if (res != MUCOSA_SUCCESS) {
+									MU_SET_RESULT(result, res)
+								}
+								return;
+							} break;)
+						}
+
+						// To avoid parameter warnings in certain circumstances
+						if (result) {} if (win) {} if (gl_context) {}
+
+						// Fallback for non-OpenGL support:
+						#else
+						MU_SET_RESULT(result, MUCOSA_FAILED_UNSUPPORTED_GRAPHICS_API)
+						return;
+						if (context) {} if (result) {} if (win) {} if (gl_context) {}
+						#endif
+					}
+
+					MUDEF void muCOSA_gl_swap_buffers(muCOSAContext* context, muCOSAResult* result, muWindow win) {
+						#ifdef MU_SUPPORT_OPENGL
+						// Get inner from context
+						muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+
+						// Do things based on window system
+						switch (inner->system) {
+							default: return; break;
+
+							// Win32
+							MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+								muCOSAResult res = muCOSAW32_gl_swap_buffers((muCOSAW32_Window*)win);
+								if (res != MUCOSA_SUCCESS) {
+									MU_SET_RESULT(result, res)
+								}
+								return;
+							} break;)
+						}
+
+						// To avoid parameter warnings in certain circumstances
+						if (result) {} if (win) {}
+
+						// Fallback for non-OpenGL support:
+						#else
+						MU_SET_RESULT(result, MUCOSA_FAILED_UNSUPPORTED_GRAPHICS_API)
+						return;
+						if (context) {} if (result) {} if (win) {}
+						#endif
+					}
+
+					MUDEF void* muCOSA_gl_get_proc_address(muCOSAContext* context, const char* name) {
+						#ifdef MU_SUPPORT_OPENGL
+						// Get inner from context
+						muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+
+						// Do things based on window system
+						switch (inner->system) {
+							default: return 0; break;
+
+							// Win32
+							MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+								return muCOSAW32_gl_get_proc_address(name);
+							} break;)
+						}
+
+						// To avoid parameter warnings in certain circumstances
+						if (name) {}
+
+						// Fallback for non-OpenGL support:
+						#else
+						return 0;
+						if (context) {} if (name) {}
+						#endif
+					}
+
+					MUDEF muBool muCOSA_gl_swap_interval(muCOSAContext* context, muCOSAResult* result, int interval) {
+						#ifdef MU_SUPPORT_OPENGL
+						// Get inner from context
+						muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+
+						// Do things based on window system
+						switch (inner->system) {
+							default: return 0; break;
+
+							// Win32
+							MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+								return muCOSAW32_gl_swap_interval((muCOSAW32_Context*)inner->context, result, interval);
+							} break;)
+						}
+
+						// Fallback for non-OpenGL support
+						#else
+						MU_SET_RESULT(result, MUCOSA_FAILED_UNSUPPORTED_GRAPHICS_API)
+						return 0;
+						if (context) {} if (result) {} if (interval) {}
+						#endif
+					}
+
+			/* Time */
+
+				MUDEF double muCOSA_fixed_time_get(muCOSAContext* context) {
+					// Get inner from context
+					muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+
+					// Do things based on window system
+					switch (inner->system) {
+						default: return 0.0; break;
+
+						// Win32
+						MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+							return muCOSAW32_fixed_time_get((muCOSAW32_Context*)inner->context);
+						} break;)
+					}
+				}
+
+				MUDEF double muCOSA_time_get(muCOSAContext* context) {
+					// Get inner from context
+					muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+
+					// Do things based on window system
+					switch (inner->system) {
+						default: return 0.0; break;
+
+						// Win32
+						MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+							return muCOSAW32_time_get((muCOSAW32_Context*)inner->context);
+						} break;)
+					}
+				}
+
+				MUDEF void muCOSA_time_set(muCOSAContext* context, double time) {
+					// Get inner from context
+					muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+
+					// Do things based on window system
+					switch (inner->system) {
+						default: return; break;
+
+						// Win32
+						MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+							muCOSAW32_time_set((muCOSAW32_Context*)inner->context, time);
+							return;
+						} break;)
+					}
+
+					// To avoid parameter warnings in certain cirumstances
+					if (time) {}
+				}
+
+			/* Sleep */
+
+				MUDEF void muCOSA_sleep(muCOSAContext* context, double time) {
+					// Get inner from context
+					muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+
+					// Do things based on window system
+					switch (inner->system) {
+						default: return; break;
+
+						// Win32
+						MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+							muCOSAW32_sleep(time);
+							return;
+						} break;)
+					}
+
+					// To avoid parameter warnings in certain circumstances
+					if (time) {}
+				}
+
+			/* Clipboard */
+
+				MUDEF uint8_m* muCOSA_clipboard_get(muCOSAContext* context, muCOSAResult* result) {
+					// Get inner from context
+					muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+
+					// Do things based on window system
+					switch (inner->system) {
+						default: return 0; break;
+
+						// Win32
+						MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+							return muCOSAW32_clipboard_get(result);
+						} break;)
+					}
+
+					// To avoid unused parameter warnings in some circumstances
+					if (result) {}
+				}
+
+				MUDEF void muCOSA_clipboard_set(muCOSAContext* context, muCOSAResult* result, uint8_m* data, size_m datalen) {
+					// Get inner from context
+					muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+
+					// Do things based on window system
+					switch (inner->system) {
+						default: return; break;
+
+						// Win32
+						MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
+							muCOSAW32_clipboard_set(result, data, datalen);
+							return;
+						} break;)
+					}
+
+					// To avoid unused parameter warnings in some circumstances
+					if (result) {} if (data) {} if (datalen) {}
+				}
+
+			/* Result */
+
+				MUDEF muBool muCOSA_result_is_fatal(muCOSAResult result) {
+					switch (result) {
+						// Fatal errors (assumed fatal):
+						default: return MU_TRUE; break;
+
+						// All non-fatal errors:
+						case MUCOSA_SUCCESS:
+						case MUCOSA_WIN32_FAILED_REGISTER_DUMMY_WGL_WINDOW_CLASS:
+						case MUCOSA_WIN32_FAILED_CREATE_DUMMY_WGL_WINDOW:
+						case MUCOSA_WIN32_FAILED_GET_DUMMY_WGL_PIXEL_FORMAT:
+						case MUCOSA_WIN32_FAILED_DESCRIBE_DUMMY_WGL_PIXEL_FORMAT:
+						case MUCOSA_WIN32_FAILED_SET_DUMMY_WGL_PIXEL_FORMAT:
+						case MUCOSA_WIN32_FAILED_CREATE_DUMMY_WGL_CONTEXT:
+						case MUCOSA_WIN32_FAILED_BIND_DUMMY_WGL_CONTEXT:
+						case MUCOSA_WIN32_FAILED_FIND_WGL_CREATE_CONTEXT_ATTRIBS:
+						case MUCOSA_WIN32_FAILED_FIND_WGL_CHOOSE_PIXEL_FORMAT:
+						case MUCOSA_WIN32_FAILED_CHOOSE_WGL_PIXEL_FORMAT:
+							return MU_FALSE;
+						break;
+					}
+				}
+
+			/* Names */
+
+			MUCOSA_NAME_CALL(
+				MUDEF const char* muCOSA_result_get_name(muCOSAResult result) {
+					switch (result) {
+						default: return "MU_UNKNOWN"; break;
+
+						case MUCOSA_SUCCESS: return "MUCOSA_SUCCESS"; break;
+						case MUCOSA_FAILED_NULL_WINDOW_SYSTEM: return "MUCOSA_FAILED_NULL_WINDOW_SYSTEM"; break;
+						case MUCOSA_FAILED_MALLOC: return "MUCOSA_FAILED_MALLOC"; break;
+						case MUCOSA_FAILED_UNKNOWN_WINDOW_ATTRIB: return "MUCOSA_FAILED_UNKNOWN_WINDOW_ATTRIB"; break;
+						case MUCOSA_FAILED_REALLOC: return "MUCOSA_FAILED_REALLOC"; break;
+						case MUCOSA_FAILED_UNKNOWN_GRAPHICS_API: return "MUCOSA_FAILED_UNKNOWN_GRAPHICS_API"; break;
+						case MUCOSA_FAILED_UNSUPPORTED_GRAPHICS_API: return "MUCOSA_FAILED_UNSUPPORTED_GRAPHICS_API"; break;
+
+						case MUCOSA_WIN32_FAILED_CONVERT_UTF8_TO_WCHAR: return "MUCOSA_WIN32_FAILED_CONVERT_UTF8_TO_WCHAR"; break;
+						case MUCOSA_WIN32_FAILED_REGISTER_WINDOW_CLASS: return "MUCOSA_WIN32_FAILED_REGISTER_WINDOW_CLASS"; break;
+						case MUCOSA_WIN32_FAILED_CREATE_WINDOW: return "MUCOSA_WIN32_FAILED_CREATE_WINDOW"; break;
+						case MUCOSA_WIN32_FAILED_GET_WINDOW_ATTRIB: return "MUCOSA_WIN32_FAILED_GET_WINDOW_ATTRIB"; break;
+						case MUCOSA_WIN32_FAILED_SET_WINDOW_ATTRIB: return "MUCOSA_WIN32_FAILED_SET_WINDOW_ATTRIB"; break;
+						case MUCOSA_WIN32_FAILED_REGISTER_DUMMY_WGL_WINDOW_CLASS: return "MUCOSA_WIN32_FAILED_REGISTER_DUMMY_WGL_WINDOW_CLASS"; break;
+						case MUCOSA_WIN32_FAILED_CREATE_DUMMY_WGL_WINDOW: return "MUCOSA_WIN32_FAILED_CREATE_DUMMY_WGL_WINDOW"; break;
+						case MUCOSA_WIN32_FAILED_GET_DUMMY_WGL_PIXEL_FORMAT: return "MUCOSA_WIN32_FAILED_GET_DUMMY_WGL_PIXEL_FORMAT"; break;
+						case MUCOSA_WIN32_FAILED_DESCRIBE_DUMMY_WGL_PIXEL_FORMAT: return "MUCOSA_WIN32_FAILED_DESCRIBE_DUMMY_WGL_PIXEL_FORMAT"; break;
+						case MUCOSA_WIN32_FAILED_SET_DUMMY_WGL_PIXEL_FORMAT: return "MUCOSA_WIN32_FAILED_SET_DUMMY_WGL_PIXEL_FORMAT"; break;
+						case MUCOSA_WIN32_FAILED_CREATE_DUMMY_WGL_CONTEXT: return "MUCOSA_WIN32_FAILED_CREATE_DUMMY_WGL_CONTEXT"; break;
+						case MUCOSA_WIN32_FAILED_BIND_DUMMY_WGL_CONTEXT: return "MUCOSA_WIN32_FAILED_BIND_DUMMY_WGL_CONTEXT"; break;
+						case MUCOSA_WIN32_FAILED_FIND_WGL_CREATE_CONTEXT_ATTRIBS: return "MUCOSA_WIN32_FAILED_FIND_WGL_CREATE_CONTEXT_ATTRIBS"; break;
+						case MUCOSA_WIN32_FAILED_FIND_WGL_CHOOSE_PIXEL_FORMAT: return "MUCOSA_WIN32_FAILED_FIND_WGL_CHOOSE_PIXEL_FORMAT"; break;
+						case MUCOSA_WIN32_FAILED_CHOOSE_WGL_PIXEL_FORMAT: return "MUCOSA_WIN32_FAILED_CHOOSE_WGL_PIXEL_FORMAT"; break;
+						case MUCOSA_WIN32_FAILED_GET_WGL_PIXEL_FORMAT: return "MUCOSA_WIN32_FAILED_GET_WGL_PIXEL_FORMAT"; break;
+						case MUCOSA_WIN32_FAILED_DESCRIBE_WGL_PIXEL_FORMAT: return "MUCOSA_WIN32_FAILED_DESCRIBE_WGL_PIXEL_FORMAT"; break;
+						case MUCOSA_WIN32_FAILED_SET_WGL_PIXEL_FORMAT: return "MUCOSA_WIN32_FAILED_SET_WGL_PIXEL_FORMAT"; break;
+						case MUCOSA_WIN32_FAILED_CREATE_WGL_CONTEXT: return "MUCOSA_WIN32_FAILED_CREATE_WGL_CONTEXT"; break;
+						case MUCOSA_WIN32_FAILED_SET_WGL_CONTEXT: return "MUCOSA_WIN32_FAILED_SET_WGL_CONTEXT"; break;
+						case MUCOSA_WIN32_FAILED_SWAP_WGL_BUFFERS: return "MUCOSA_WIN32_FAILED_SWAP_WGL_BUFFERS"; break;
+						case MUCOSA_WIN32_FAILED_FIND_WGL_FUNCTION: return "MUCOSA_WIN32_FAILED_FIND_WGL_FUNCTION"; break;
+						case MUCOSA_WIN32_FAILED_ASSOCIATE_IMM: return "MUCOSA_WIN32_FAILED_ASSOCIATE_IMM"; break;
+						case MUCOSA_WIN32_FAILED_SET_COMPOSITION_WINDOW_POSITION: return "MUCOSA_WIN32_FAILED_SET_COMPOSITION_WINDOW_POSITION"; break;
+						case MUCOSA_WIN32_FAILED_HOLD_CLIPBOARD: return "MUCOSA_WIN32_FAILED_HOLD_CLIPBOARD"; break;
+						case MUCOSA_WIN32_FAILED_GET_CLIPBOARD_DATA: return "MUCOSA_WIN32_FAILED_GET_CLIPBOARD_DATA"; break;
+						case MUCOSA_WIN32_FAILED_CONVERT_CLIPBOARD_DATA_FORMAT: return "MUCOSA_WIN32_FAILED_CONVERT_CLIPBOARD_DATA_FORMAT"; break;
+						case MUCOSA_WIN32_FAILED_ALLOCATE_CLIPBOARD_DATA: return "MUCOSA_WIN32_FAILED_ALLOCATE_CLIPBOARD_DATA"; break;
+						case MUCOSA_WIN32_FAILED_SET_CLIPBOARD_DATA: return "MUCOSA_WIN32_FAILED_SET_CLIPBOARD_DATA"; break;
+					}
+				}
+
+				MUDEF const char* mu_window_system_get_name(muWindowSystem system) {
+					switch (system) {
+						default: return "MU_UNKNOWN"; break;
+
+						case MU_WINDOW_NULL: return "MU_WINDOW_NULL"; break;
+						case MU_WINDOW_WIN32: return "MU_WINDOW_WIN32"; break;
+					}
+				}
+
+				MUDEF const char* mu_window_system_get_nice_name(muWindowSystem system) {
+					switch (system) {
+						default: return "Unknown"; break;
+
+						case MU_WINDOW_NULL: return "Unknown/Auto"; break;
+						case MU_WINDOW_WIN32: return "Win32"; break;
+					}
+				}
+
+				MUDEF const char* mu_window_attrib_get_name(muWindowAttrib attrib) {
+					switch (attrib) {
+						default: return "MU_UNKNOWN"; break;
+						case MU_WINDOW_TITLE: return "MU_WINDOW_TITLE"; break;
+						case MU_WINDOW_DIMENSIONS: return "MU_WINDOW_DIMENSIONS"; break;
+						case MU_WINDOW_POSITION: return "MU_WINDOW_POSITION"; break;
+						case MU_WINDOW_KEYBOARD_MAP: return "MU_WINDOW_KEYBOARD_MAP"; break;
+						case MU_WINDOW_KEYSTATE_MAP: return "MU_WINDOW_KEYSTATE_MAP"; break;
+						case MU_WINDOW_MOUSE_MAP: return "MU_WINDOW_MOUSE_MAP"; break;
+						case MU_WINDOW_SCROLL_LEVEL: return "MU_WINDOW_SCROLL_LEVEL"; break;
+						case MU_WINDOW_CURSOR: return "MU_WINDOW_CURSOR"; break;
+						case MU_WINDOW_CURSOR_STYLE: return "MU_WINDOW_CURSOR_STYLE"; break;
+						case MU_WINDOW_DIMENSIONS_CALLBACK: return "MU_WINDOW_DIMENSIONS_CALLBACK"; break;
+						case MU_WINDOW_POSITION_CALLBACK: return "MU_WINDOW_POSITION_CALLBACK"; break;
+						case MU_WINDOW_KEYBOARD_CALLBACK: return "MU_WINDOW_KEYBOARD_CALLBACK"; break;
+						case MU_WINDOW_KEYSTATE_CALLBACK: return "MU_WINDOW_KEYSTATE_CALLBACK"; break;
+						case MU_WINDOW_MOUSE_KEY_CALLBACK: return "MU_WINDOW_MOUSE_KEY_CALLBACK"; break;
+						case MU_WINDOW_CURSOR_CALLBACK: return "MU_WINDOW_CURSOR_CALLBACK"; break;
+						case MU_WINDOW_SCROLL_CALLBACK: return "MU_WINDOW_SCROLL_CALLBACK"; break;
+					}
+				}
+
+				MUDEF const char* mu_window_attrib_get_nice_name(muWindowAttrib attrib) {
+					switch (attrib) {
+						default: return "Unknown"; break;
+						case MU_WINDOW_TITLE: return "Title"; break;
+						case MU_WINDOW_DIMENSIONS: return "Dimensions"; break;
+						case MU_WINDOW_POSITION: return "Position"; break;
+						case MU_WINDOW_KEYBOARD_MAP: return "Keyboard map"; break;
+						case MU_WINDOW_KEYSTATE_MAP: return "Keystate map"; break;
+						case MU_WINDOW_MOUSE_MAP: return "Mouse map"; break;
+						case MU_WINDOW_SCROLL_LEVEL: return "Scroll level"; break;
+						case MU_WINDOW_CURSOR: return "Cursor"; break;
+						case MU_WINDOW_CURSOR_STYLE: return "Cursor style"; break;
+						case MU_WINDOW_DIMENSIONS_CALLBACK: return "Dimensions callback"; break;
+						case MU_WINDOW_POSITION_CALLBACK: return "Position callback"; break;
+						case MU_WINDOW_KEYBOARD_CALLBACK: return "Keyboard callback"; break;
+						case MU_WINDOW_KEYSTATE_CALLBACK: return "Keystate callback"; break;
+						case MU_WINDOW_MOUSE_KEY_CALLBACK: return "Mouse key callback"; break;
+						case MU_WINDOW_CURSOR_CALLBACK: return "Cursor callback"; break;
+						case MU_WINDOW_SCROLL_CALLBACK: return "Scroll callback"; break;
+					}
+				}
+
+				MUDEF const char* mu_keyboard_key_get_name(muKeyboardKey key) {
+					switch (key) {
+						default: return "MU_UNKNOWN"; break;
+						case MU_KEYBOARD_UNKNOWN: return "MU_KEYBOARD_UNKNOWN"; break;
+						case MU_KEYBOARD_BACKSPACE: return "MU_KEYBOARD_BACKSPACE"; break;
+						case MU_KEYBOARD_TAB: return "MU_KEYBOARD_TAB"; break;
+						case MU_KEYBOARD_CLEAR: return "MU_KEYBOARD_CLEAR"; break;
+						case MU_KEYBOARD_RETURN: return "MU_KEYBOARD_RETURN"; break;
+						case MU_KEYBOARD_PAUSE: return "MU_KEYBOARD_PAUSE"; break;
+						case MU_KEYBOARD_ESCAPE: return "MU_KEYBOARD_ESCAPE"; break;
+						case MU_KEYBOARD_MODECHANGE: return "MU_KEYBOARD_MODECHANGE"; break;
+						case MU_KEYBOARD_SPACE: return "MU_KEYBOARD_SPACE"; break;
+						case MU_KEYBOARD_PRIOR: return "MU_KEYBOARD_PRIOR"; break;
+						case MU_KEYBOARD_NEXT: return "MU_KEYBOARD_NEXT"; break;
+						case MU_KEYBOARD_END: return "MU_KEYBOARD_END"; break;
+						case MU_KEYBOARD_HOME: return "MU_KEYBOARD_HOME"; break;
+						case MU_KEYBOARD_LEFT: return "MU_KEYBOARD_LEFT"; break;
+						case MU_KEYBOARD_UP: return "MU_KEYBOARD_UP"; break;
+						case MU_KEYBOARD_RIGHT: return "MU_KEYBOARD_RIGHT"; break;
+						case MU_KEYBOARD_DOWN: return "MU_KEYBOARD_DOWN"; break;
+						case MU_KEYBOARD_SELECT: return "MU_KEYBOARD_SELECT"; break;
+						case MU_KEYBOARD_PRINT: return "MU_KEYBOARD_PRINT"; break;
+						case MU_KEYBOARD_EXECUTE: return "MU_KEYBOARD_EXECUTE"; break;
+						case MU_KEYBOARD_INSERT: return "MU_KEYBOARD_INSERT"; break;
+						case MU_KEYBOARD_DELETE: return "MU_KEYBOARD_DELETE"; break;
+						case MU_KEYBOARD_HELP: return "MU_KEYBOARD_HELP"; break;
+						case MU_KEYBOARD_0: return "MU_KEYBOARD_0"; break;
+						case MU_KEYBOARD_1: return "MU_KEYBOARD_1"; break;
+						case MU_KEYBOARD_2: return "MU_KEYBOARD_2"; break;
+						case MU_KEYBOARD_3: return "MU_KEYBOARD_3"; break;
+						case MU_KEYBOARD_4: return "MU_KEYBOARD_4"; break;
+						case MU_KEYBOARD_5: return "MU_KEYBOARD_5"; break;
+						case MU_KEYBOARD_6: return "MU_KEYBOARD_6"; break;
+						case MU_KEYBOARD_7: return "MU_KEYBOARD_7"; break;
+						case MU_KEYBOARD_8: return "MU_KEYBOARD_8"; break;
+						case MU_KEYBOARD_9: return "MU_KEYBOARD_9"; break;
+						case MU_KEYBOARD_A: return "MU_KEYBOARD_A"; break;
+						case MU_KEYBOARD_B: return "MU_KEYBOARD_B"; break;
+						case MU_KEYBOARD_C: return "MU_KEYBOARD_C"; break;
+						case MU_KEYBOARD_D: return "MU_KEYBOARD_D"; break;
+						case MU_KEYBOARD_E: return "MU_KEYBOARD_E"; break;
+						case MU_KEYBOARD_F: return "MU_KEYBOARD_F"; break;
+						case MU_KEYBOARD_G: return "MU_KEYBOARD_G"; break;
+						case MU_KEYBOARD_H: return "MU_KEYBOARD_H"; break;
+						case MU_KEYBOARD_I: return "MU_KEYBOARD_I"; break;
+						case MU_KEYBOARD_J: return "MU_KEYBOARD_J"; break;
+						case MU_KEYBOARD_K: return "MU_KEYBOARD_K"; break;
+						case MU_KEYBOARD_L: return "MU_KEYBOARD_L"; break;
+						case MU_KEYBOARD_M: return "MU_KEYBOARD_M"; break;
+						case MU_KEYBOARD_N: return "MU_KEYBOARD_N"; break;
+						case MU_KEYBOARD_O: return "MU_KEYBOARD_O"; break;
+						case MU_KEYBOARD_P: return "MU_KEYBOARD_P"; break;
+						case MU_KEYBOARD_Q: return "MU_KEYBOARD_Q"; break;
+						case MU_KEYBOARD_R: return "MU_KEYBOARD_R"; break;
+						case MU_KEYBOARD_S: return "MU_KEYBOARD_S"; break;
+						case MU_KEYBOARD_T: return "MU_KEYBOARD_T"; break;
+						case MU_KEYBOARD_U: return "MU_KEYBOARD_U"; break;
+						case MU_KEYBOARD_V: return "MU_KEYBOARD_V"; break;
+						case MU_KEYBOARD_W: return "MU_KEYBOARD_W"; break;
+						case MU_KEYBOARD_X: return "MU_KEYBOARD_X"; break;
+						case MU_KEYBOARD_Y: return "MU_KEYBOARD_Y"; break;
+						case MU_KEYBOARD_Z: return "MU_KEYBOARD_Z"; break;
+						case MU_KEYBOARD_LEFT_WINDOWS: return "MU_KEYBOARD_LEFT_WINDOWS"; break;
+						case MU_KEYBOARD_RIGHT_WINDOWS: return "MU_KEYBOARD_RIGHT_WINDOWS"; break;
+						case MU_KEYBOARD_NUMPAD_0: return "MU_KEYBOARD_NUMPAD_0"; break;
+						case MU_KEYBOARD_NUMPAD_1: return "MU_KEYBOARD_NUMPAD_1"; break;
+						case MU_KEYBOARD_NUMPAD_2: return "MU_KEYBOARD_NUMPAD_2"; break;
+						case MU_KEYBOARD_NUMPAD_3: return "MU_KEYBOARD_NUMPAD_3"; break;
+						case MU_KEYBOARD_NUMPAD_4: return "MU_KEYBOARD_NUMPAD_4"; break;
+						case MU_KEYBOARD_NUMPAD_5: return "MU_KEYBOARD_NUMPAD_5"; break;
+						case MU_KEYBOARD_NUMPAD_6: return "MU_KEYBOARD_NUMPAD_6"; break;
+						case MU_KEYBOARD_NUMPAD_7: return "MU_KEYBOARD_NUMPAD_7"; break;
+						case MU_KEYBOARD_NUMPAD_8: return "MU_KEYBOARD_NUMPAD_8"; break;
+						case MU_KEYBOARD_NUMPAD_9: return "MU_KEYBOARD_NUMPAD_9"; break;
+						case MU_KEYBOARD_ADD: return "MU_KEYBOARD_ADD"; break;
+						case MU_KEYBOARD_SUBTRACT: return "MU_KEYBOARD_SUBTRACT"; break;
+						case MU_KEYBOARD_MULTIPLY: return "MU_KEYBOARD_MULTIPLY"; break;
+						case MU_KEYBOARD_DIVIDE: return "MU_KEYBOARD_DIVIDE"; break;
+						case MU_KEYBOARD_SEPARATOR: return "MU_KEYBOARD_SEPARATOR"; break;
+						case MU_KEYBOARD_DECIMAL: return "MU_KEYBOARD_DECIMAL"; break;
+						case MU_KEYBOARD_F1: return "MU_KEYBOARD_F1"; break;
+						case MU_KEYBOARD_F2: return "MU_KEYBOARD_F2"; break;
+						case MU_KEYBOARD_F3: return "MU_KEYBOARD_F3"; break;
+						case MU_KEYBOARD_F4: return "MU_KEYBOARD_F4"; break;
+						case MU_KEYBOARD_F5: return "MU_KEYBOARD_F5"; break;
+						case MU_KEYBOARD_F6: return "MU_KEYBOARD_F6"; break;
+						case MU_KEYBOARD_F7: return "MU_KEYBOARD_F7"; break;
+						case MU_KEYBOARD_F8: return "MU_KEYBOARD_F8"; break;
+						case MU_KEYBOARD_F9: return "MU_KEYBOARD_F9"; break;
+						case MU_KEYBOARD_F10: return "MU_KEYBOARD_F10"; break;
+						case MU_KEYBOARD_F11: return "MU_KEYBOARD_F11"; break;
+						case MU_KEYBOARD_F12: return "MU_KEYBOARD_F12"; break;
+						case MU_KEYBOARD_F13: return "MU_KEYBOARD_F13"; break;
+						case MU_KEYBOARD_F14: return "MU_KEYBOARD_F14"; break;
+						case MU_KEYBOARD_F15: return "MU_KEYBOARD_F15"; break;
+						case MU_KEYBOARD_F16: return "MU_KEYBOARD_F16"; break;
+						case MU_KEYBOARD_F17: return "MU_KEYBOARD_F17"; break;
+						case MU_KEYBOARD_F18: return "MU_KEYBOARD_F18"; break;
+						case MU_KEYBOARD_F19: return "MU_KEYBOARD_F19"; break;
+						case MU_KEYBOARD_F20: return "MU_KEYBOARD_F20"; break;
+						case MU_KEYBOARD_F21: return "MU_KEYBOARD_F21"; break;
+						case MU_KEYBOARD_F22: return "MU_KEYBOARD_F22"; break;
+						case MU_KEYBOARD_F23: return "MU_KEYBOARD_F23"; break;
+						case MU_KEYBOARD_F24: return "MU_KEYBOARD_F24"; break;
+						case MU_KEYBOARD_NUMLOCK: return "MU_KEYBOARD_NUMLOCK"; break;
+						case MU_KEYBOARD_SCROLL: return "MU_KEYBOARD_SCROLL"; break;
+						case MU_KEYBOARD_LEFT_SHIFT: return "MU_KEYBOARD_LEFT_SHIFT"; break;
+						case MU_KEYBOARD_RIGHT_SHIFT: return "MU_KEYBOARD_RIGHT_SHIFT"; break;
+						case MU_KEYBOARD_LEFT_CONTROL: return "MU_KEYBOARD_LEFT_CONTROL"; break;
+						case MU_KEYBOARD_RIGHT_CONTROL: return "MU_KEYBOARD_RIGHT_CONTROL"; break;
+						case MU_KEYBOARD_LEFT_MENU: return "MU_KEYBOARD_LEFT_MENU"; break;
+						case MU_KEYBOARD_RIGHT_MENU: return "MU_KEYBOARD_RIGHT_MENU"; break;
+						case MU_KEYBOARD_ATTN: return "MU_KEYBOARD_ATTN"; break;
+						case MU_KEYBOARD_CRSEL: return "MU_KEYBOARD_CRSEL"; break;
+						case MU_KEYBOARD_EXSEL: return "MU_KEYBOARD_EXSEL"; break;
+						case MU_KEYBOARD_EREOF: return "MU_KEYBOARD_EREOF"; break;
+						case MU_KEYBOARD_PLAY: return "MU_KEYBOARD_PLAY"; break;
+						case MU_KEYBOARD_PA1: return "MU_KEYBOARD_PA1"; break;
+					}
+				}
+
+				MUDEF const char* mu_keyboard_key_get_nice_name(muKeyboardKey key) {
+					switch (key) {
+						default: return "Unknown"; break;
+						case MU_KEYBOARD_UNKNOWN: return "Unknown"; break;
+						case MU_KEYBOARD_BACKSPACE: return "Baskspace"; break;
+						case MU_KEYBOARD_TAB: return "Tab"; break;
+						case MU_KEYBOARD_CLEAR: return "Clear"; break;
+						case MU_KEYBOARD_RETURN: return "Return"; break;
+						case MU_KEYBOARD_PAUSE: return "Pause"; break;
+						case MU_KEYBOARD_ESCAPE: return "Escape"; break;
+						case MU_KEYBOARD_MODECHANGE: return "Mode change"; break;
+						case MU_KEYBOARD_SPACE: return "Space"; break;
+						case MU_KEYBOARD_PRIOR: return "Prior"; break;
+						case MU_KEYBOARD_NEXT: return "Next"; break;
+						case MU_KEYBOARD_END: return "End"; break;
+						case MU_KEYBOARD_HOME: return "Home"; break;
+						case MU_KEYBOARD_LEFT: return "Left"; break;
+						case MU_KEYBOARD_UP: return "Up"; break;
+						case MU_KEYBOARD_RIGHT: return "Right"; break;
+						case MU_KEYBOARD_DOWN: return "Down"; break;
+						case MU_KEYBOARD_SELECT: return "Select"; break;
+						case MU_KEYBOARD_PRINT: return "Print"; break;
+						case MU_KEYBOARD_EXECUTE: return "Execute"; break;
+						case MU_KEYBOARD_INSERT: return "Insert"; break;
+						case MU_KEYBOARD_DELETE: return "Delete"; break;
+						case MU_KEYBOARD_HELP: return "Help"; break;
+						case MU_KEYBOARD_0: return "0"; break;
+						case MU_KEYBOARD_1: return "1"; break;
+						case MU_KEYBOARD_2: return "2"; break;
+						case MU_KEYBOARD_3: return "3"; break;
+						case MU_KEYBOARD_4: return "4"; break;
+						case MU_KEYBOARD_5: return "5"; break;
+						case MU_KEYBOARD_6: return "6"; break;
+						case MU_KEYBOARD_7: return "7"; break;
+						case MU_KEYBOARD_8: return "8"; break;
+						case MU_KEYBOARD_9: return "9"; break;
+						case MU_KEYBOARD_A: return "A"; break;
+						case MU_KEYBOARD_B: return "B"; break;
+						case MU_KEYBOARD_C: return "C"; break;
+						case MU_KEYBOARD_D: return "D"; break;
+						case MU_KEYBOARD_E: return "E"; break;
+						case MU_KEYBOARD_F: return "F"; break;
+						case MU_KEYBOARD_G: return "G"; break;
+						case MU_KEYBOARD_H: return "H"; break;
+						case MU_KEYBOARD_I: return "I"; break;
+						case MU_KEYBOARD_J: return "J"; break;
+						case MU_KEYBOARD_K: return "K"; break;
+						case MU_KEYBOARD_L: return "L"; break;
+						case MU_KEYBOARD_M: return "M"; break;
+						case MU_KEYBOARD_N: return "N"; break;
+						case MU_KEYBOARD_O: return "O"; break;
+						case MU_KEYBOARD_P: return "P"; break;
+						case MU_KEYBOARD_Q: return "Q"; break;
+						case MU_KEYBOARD_R: return "R"; break;
+						case MU_KEYBOARD_S: return "S"; break;
+						case MU_KEYBOARD_T: return "T"; break;
+						case MU_KEYBOARD_U: return "U"; break;
+						case MU_KEYBOARD_V: return "V"; break;
+						case MU_KEYBOARD_W: return "W"; break;
+						case MU_KEYBOARD_X: return "X"; break;
+						case MU_KEYBOARD_Y: return "Y"; break;
+						case MU_KEYBOARD_Z: return "Z"; break;
+						case MU_KEYBOARD_LEFT_WINDOWS: return "Left Windows/Super/Command"; break;
+						case MU_KEYBOARD_RIGHT_WINDOWS: return "Right Windows/Super/Command"; break;
+						case MU_KEYBOARD_NUMPAD_0: return "Numpad 0"; break;
+						case MU_KEYBOARD_NUMPAD_1: return "Numpad 1"; break;
+						case MU_KEYBOARD_NUMPAD_2: return "Numpad 2"; break;
+						case MU_KEYBOARD_NUMPAD_3: return "Numpad 3"; break;
+						case MU_KEYBOARD_NUMPAD_4: return "Numpad 4"; break;
+						case MU_KEYBOARD_NUMPAD_5: return "Numpad 5"; break;
+						case MU_KEYBOARD_NUMPAD_6: return "Numpad 6"; break;
+						case MU_KEYBOARD_NUMPAD_7: return "Numpad 7"; break;
+						case MU_KEYBOARD_NUMPAD_8: return "Numpad 8"; break;
+						case MU_KEYBOARD_NUMPAD_9: return "Numpad 9"; break;
+						case MU_KEYBOARD_ADD: return "Add"; break;
+						case MU_KEYBOARD_SUBTRACT: return "Subtract"; break;
+						case MU_KEYBOARD_MULTIPLY: return "Multiply"; break;
+						case MU_KEYBOARD_DIVIDE: return "Divide"; break;
+						case MU_KEYBOARD_SEPARATOR: return "Separator"; break;
+						case MU_KEYBOARD_DECIMAL: return "Decimal"; break;
+						case MU_KEYBOARD_F1: return "F1"; break;
+						case MU_KEYBOARD_F2: return "F2"; break;
+						case MU_KEYBOARD_F3: return "F3"; break;
+						case MU_KEYBOARD_F4: return "F4"; break;
+						case MU_KEYBOARD_F5: return "F5"; break;
+						case MU_KEYBOARD_F6: return "F6"; break;
+						case MU_KEYBOARD_F7: return "F7"; break;
+						case MU_KEYBOARD_F8: return "F8"; break;
+						case MU_KEYBOARD_F9: return "F9"; break;
+						case MU_KEYBOARD_F10: return "F10"; break;
+						case MU_KEYBOARD_F11: return "F11"; break;
+						case MU_KEYBOARD_F12: return "F12"; break;
+						case MU_KEYBOARD_F13: return "F13"; break;
+						case MU_KEYBOARD_F14: return "F14"; break;
+						case MU_KEYBOARD_F15: return "F15"; break;
+						case MU_KEYBOARD_F16: return "F16"; break;
+						case MU_KEYBOARD_F17: return "F17"; break;
+						case MU_KEYBOARD_F18: return "F18"; break;
+						case MU_KEYBOARD_F19: return "F19"; break;
+						case MU_KEYBOARD_F20: return "F20"; break;
+						case MU_KEYBOARD_F21: return "F21"; break;
+						case MU_KEYBOARD_F22: return "F22"; break;
+						case MU_KEYBOARD_F23: return "F23"; break;
+						case MU_KEYBOARD_F24: return "F24"; break;
+						case MU_KEYBOARD_NUMLOCK: return "Num Lock"; break;
+						case MU_KEYBOARD_SCROLL: return "Scroll"; break;
+						case MU_KEYBOARD_LEFT_SHIFT: return "Left shift"; break;
+						case MU_KEYBOARD_RIGHT_SHIFT: return "Right shift"; break;
+						case MU_KEYBOARD_LEFT_CONTROL: return "Left control"; break;
+						case MU_KEYBOARD_RIGHT_CONTROL: return "Right control"; break;
+						case MU_KEYBOARD_LEFT_MENU: return "Left menu"; break;
+						case MU_KEYBOARD_RIGHT_MENU: return "Right menu"; break;
+						case MU_KEYBOARD_ATTN: return "Attn"; break;
+						case MU_KEYBOARD_CRSEL: return "CrSel"; break;
+						case MU_KEYBOARD_EXSEL: return "ExSel"; break;
+						case MU_KEYBOARD_EREOF: return "EreOf"; break;
+						case MU_KEYBOARD_PLAY: return "Play"; break;
+						case MU_KEYBOARD_PA1: return "PA1"; break;
+					}
+				}
+
+				MUDEF const char* mu_keystate_get_name(muKeyboardState state) {
+					switch (state) {
+						default: return "MU_UNKNOWN"; break;
+						case MU_KEYSTATE_UNKNOWN: return "MU_KEYSTATE_UNKNOWN"; break;
+						case MU_KEYSTATE_CAPS_LOCK: return "MU_KEYSTATE_CAPS_LOCK"; break;
+						case MU_KEYSTATE_SCROLL_LOCK: return "MU_KEYSTATE_SCROLL_LOCK"; break;
+						case MU_KEYSTATE_NUM_LOCK: return "MU_KEYSTATE_NUM_LOCK"; break;
+					}
+				}
+
+				MUDEF const char* mu_keystate_get_nice_name(muKeyboardState state) {
+					switch (state) {
+						default: return "Unknown"; break;
+						case MU_KEYSTATE_UNKNOWN: return "Unknown"; break;
+						case MU_KEYSTATE_CAPS_LOCK: return "Caps Lock"; break;
+						case MU_KEYSTATE_SCROLL_LOCK: return "Scroll Lock"; break;
+						case MU_KEYSTATE_NUM_LOCK: return "Num Lock"; break;
+					}
+				}
+
+				MUDEF const char* mu_mouse_key_get_name(muMouseKey key) {
+					switch (key) {
+						default: return "MU_UNKNOWN"; break;
+						case MU_MOUSE_UNKNOWN: return "MU_MOUSE_UNKNOWN"; break;
+						case MU_MOUSE_LEFT: return "MU_MOUSE_LEFT"; break;
+						case MU_MOUSE_RIGHT: return "MU_MOUSE_RIGHT"; break;
+						case MU_MOUSE_MIDDLE: return "MU_MOUSE_MIDDLE"; break;
+					}
+				}
+
+				MUDEF const char* mu_mouse_key_get_nice_name(muMouseKey key) {
+					switch (key) {
+						default: return "Unknown"; break;
+						case MU_MOUSE_UNKNOWN: return "Unknown"; break;
+						case MU_MOUSE_LEFT: return "Left"; break;
+						case MU_MOUSE_RIGHT: return "Right"; break;
+						case MU_MOUSE_MIDDLE: return "Middle"; break;
+					}
+				}
+
+				MUDEF const char* mu_cursor_style_get_name(muCursorStyle style) {
+					switch (style) {
+						default: return "MU_UNKNOWN"; break;
+						case MU_CURSOR_UNKNOWN: return "MU_CURSOR_UNKNOWN"; break;
+						case MU_CURSOR_ARROW: return "MU_CURSOR_ARROW"; break;
+						case MU_CURSOR_IBEAM: return "MU_CURSOR_IBEAM"; break;
+						case MU_CURSOR_WAIT: return "MU_CURSOR_WAIT"; break;
+						case MU_CURSOR_WAIT_ARROW: return "MU_CURSOR_WAIT_ARROW"; break;
+						case MU_CURSOR_CROSSHAIR: return "MU_CURSOR_CROSSHAIR"; break;
+						case MU_CURSOR_HAND: return "MU_CURSOR_HAND"; break;
+						case MU_CURSOR_SIZE_LR: return "MU_CURSOR_SIZE_LR"; break;
+						case MU_CURSOR_SIZE_TB: return "MU_CURSOR_SIZE_TB"; break;
+						case MU_CURSOR_SIZE_TL_BR: return "MU_CURSOR_SIZE_TL_BR"; break;
+						case MU_CURSOR_SIZE_TR_BL: return "MU_CURSOR_SIZE_TR_BL"; break;
+						case MU_CURSOR_SIZE_ALL: return "MU_CURSOR_SIZE_ALL"; break;
+						case MU_CURSOR_NO: return "MU_CURSOR_NO"; break;
+					}
+				}
+
+				MUDEF const char* mu_cursor_style_get_nice_name(muCursorStyle style) {
+					switch (style) {
+						default: return "Unknown"; break;
+						case MU_CURSOR_UNKNOWN: return "Unknown"; break;
+						case MU_CURSOR_ARROW: return "Arrow"; break;
+						case MU_CURSOR_IBEAM: return "I-Beam"; break;
+						case MU_CURSOR_WAIT: return "Wait"; break;
+						case MU_CURSOR_WAIT_ARROW: return "Wait (Arrow)"; break;
+						case MU_CURSOR_CROSSHAIR: return "Crosshair"; break;
+						case MU_CURSOR_HAND: return "Hand"; break;
+						case MU_CURSOR_SIZE_LR: return "Resize (Left to right)"; break;
+						case MU_CURSOR_SIZE_TB: return "Resize (Top to bottom)"; break;
+						case MU_CURSOR_SIZE_TL_BR: return "Resize (Top-left to bottom-right)"; break;
+						case MU_CURSOR_SIZE_TR_BL: return "Resize (Top-right to bottom-left)"; break;
+						case MU_CURSOR_SIZE_ALL: return "Resize (All 4 directions)"; break;
+						case MU_CURSOR_NO: return "No/Error"; break;
+					}
+				}
+
+				MUDEF const char* mu_graphics_api_get_name(muGraphicsAPI api) {
+					switch (api) {
+						default: return "MU_UNKNOWN"; break;
+						case MU_NULL_GRAPHICS_API: return "MU_NULL_GRAPHICS_API"; break;
+						case MU_OPENGL_1_0: return "MU_OPENGL_1_0"; break;
+						case MU_OPENGL_1_1: return "MU_OPENGL_1_1"; break;
+						case MU_OPENGL_1_2: return "MU_OPENGL_1_2"; break;
+						case MU_OPENGL_1_2_1: return "MU_OPENGL_1_2_1"; break;
+						case MU_OPENGL_1_3: return "MU_OPENGL_1_3"; break;
+						case MU_OPENGL_1_4: return "MU_OPENGL_1_4"; break;
+						case MU_OPENGL_1_5: return "MU_OPENGL_1_5"; break;
+						case MU_OPENGL_2_0: return "MU_OPENGL_2_0"; break;
+						case MU_OPENGL_2_1: return "MU_OPENGL_2_1"; break;
+						case MU_OPENGL_3_0: return "MU_OPENGL_3_0"; break;
+						case MU_OPENGL_3_1: return "MU_OPENGL_3_1"; break;
+						case MU_OPENGL_3_2_CORE: return "MU_OPENGL_3_2_CORE"; break;
+						case MU_OPENGL_3_2_COMPATIBILITY: return "MU_OPENGL_3_2_COMPATIBILITY"; break;
+						case MU_OPENGL_3_3_CORE: return "MU_OPENGL_3_3_CORE"; break;
+						case MU_OPENGL_3_3_COMPATIBILITY: return "MU_OPENGL_3_3_COMPATIBILITY"; break;
+						case MU_OPENGL_4_0_CORE: return "MU_OPENGL_4_0_CORE"; break;
+						case MU_OPENGL_4_0_COMPATIBILITY: return "MU_OPENGL_4_0_COMPATIBILITY"; break;
+						case MU_OPENGL_4_1_CORE: return "MU_OPENGL_4_1_CORE"; break;
+						case MU_OPENGL_4_1_COMPATIBILITY: return "MU_OPENGL_4_1_COMPATIBILITY"; break;
+						case MU_OPENGL_4_2_CORE: return "MU_OPENGL_4_2_CORE"; break;
+						case MU_OPENGL_4_2_COMPATIBILITY: return "MU_OPENGL_4_2_COMPATIBILITY"; break;
+						case MU_OPENGL_4_3_CORE: return "MU_OPENGL_4_3_CORE"; break;
+						case MU_OPENGL_4_3_COMPATIBILITY: return "MU_OPENGL_4_3_COMPATIBILITY"; break;
+						case MU_OPENGL_4_4_CORE: return "MU_OPENGL_4_4_CORE"; break;
+						case MU_OPENGL_4_4_COMPATIBILITY: return "MU_OPENGL_4_4_COMPATIBILITY"; break;
+						case MU_OPENGL_4_5_CORE: return "MU_OPENGL_4_5_CORE"; break;
+						case MU_OPENGL_4_5_COMPATIBILITY: return "MU_OPENGL_4_5_COMPATIBILITY"; break;
+						case MU_OPENGL_4_6_CORE: return "MU_OPENGL_4_6_CORE"; break;
+						case MU_OPENGL_4_6_COMPATIBILITY: return "MU_OPENGL_4_6_COMPATIBILITY"; break;
+					}
+				}
+
+				MUDEF const char* mu_graphics_api_get_nice_name(muGraphicsAPI api) {
+					switch (api) {
+						default: return "Unknown"; break;
+						case MU_NULL_GRAPHICS_API: return "Unknown"; break;
+						case MU_OPENGL_1_0: return "OpenGL 1.0"; break;
+						case MU_OPENGL_1_1: return "OpenGL 1.1"; break;
+						case MU_OPENGL_1_2: return "OpenGL 1.2"; break;
+						case MU_OPENGL_1_2_1: return "OpenGL 1.2.1"; break;
+						case MU_OPENGL_1_3: return "OpenGL 1.3"; break;
+						case MU_OPENGL_1_4: return "OpenGL 1.4"; break;
+						case MU_OPENGL_1_5: return "OpenGL 1.5"; break;
+						case MU_OPENGL_2_0: return "OpenGL 2.0"; break;
+						case MU_OPENGL_2_1: return "OpenGL 2.1"; break;
+						case MU_OPENGL_3_0: return "OpenGL 3.0"; break;
+						case MU_OPENGL_3_1: return "OpenGL 3.1"; break;
+						case MU_OPENGL_3_2_CORE: return "OpenGL 3.2 (Core Profile)"; break;
+						case MU_OPENGL_3_2_COMPATIBILITY: return "OpenGL 3.2 (Compatibility Profile)"; break;
+						case MU_OPENGL_3_3_CORE: return "OpenGL 3.3 (Core Profile)"; break;
+						case MU_OPENGL_3_3_COMPATIBILITY: return "OpenGL 3.3 (Compatibility Profile)"; break;
+						case MU_OPENGL_4_0_CORE: return "OpenGL 4.0 (Core Profile)"; break;
+						case MU_OPENGL_4_0_COMPATIBILITY: return "OpenGL 4.0 (Compatibility Profile)"; break;
+						case MU_OPENGL_4_1_CORE: return "OpenGL 4.1 (Core Profile)"; break;
+						case MU_OPENGL_4_1_COMPATIBILITY: return "OpenGL 4.1 (Compatibility Profile)"; break;
+						case MU_OPENGL_4_2_CORE: return "OpenGL 4.2 (Core Profile)"; break;
+						case MU_OPENGL_4_2_COMPATIBILITY: return "OpenGL 4.2 (Compatibility Profile)"; break;
+						case MU_OPENGL_4_3_CORE: return "OpenGL 4.3 (Core Profile)"; break;
+						case MU_OPENGL_4_3_COMPATIBILITY: return "OpenGL 4.3 (Compatibility Profile)"; break;
+						case MU_OPENGL_4_4_CORE: return "OpenGL 4.4 (Core Profile)"; break;
+						case MU_OPENGL_4_4_COMPATIBILITY: return "OpenGL 4.4 (Compatibility Profile)"; break;
+						case MU_OPENGL_4_5_CORE: return "OpenGL 4.5 (Core Profile)"; break;
+						case MU_OPENGL_4_5_COMPATIBILITY: return "OpenGL 4.5 (Compatibility Profile)"; break;
+						case MU_OPENGL_4_6_CORE: return "OpenGL 4.6 (Core Profile)"; break;
+						case MU_OPENGL_4_6_COMPATIBILITY: return "OpenGL 4.6 (Compatibility Profile)"; break;
+					}
+				}
+			)
+
+			MU_CPP_EXTERN_END
+
+		#endif /* MUCOSA_IMPLEMENTATION */
+	#endif
+
+	MU_CPP_EXTERN_START
+
+	/* mug context */
+
+		// Global context
+		mugContext* mug_global_context = 0;
+
+		// Create context
+		MUDEF void mug_context_create(mugContext* context, muWindowSystem system, muBool set_context) {
+			mug_context_create_with_allocator(context, system, set_context, 0);
 		}
-		static void glad_gl_load_GL_VERSION_3_1( GLADuserptrloadfunc load, void* userptr) {
-		    if(!GLAD_GL_VERSION_3_1) return;
-		    glad_glBindBufferBase = (PFNGLBINDBUFFERBASEPROC) load(userptr, "glBindBufferBase");
-		    glad_glBindBufferRange = (PFNGLBINDBUFFERRANGEPROC) load(userptr, "glBindBufferRange");
-		    glad_glCopyBufferSubData = (PFNGLCOPYBUFFERSUBDATAPROC) load(userptr, "glCopyBufferSubData");
-		    glad_glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDPROC) load(userptr, "glDrawArraysInstanced");
-		    glad_glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC) load(userptr, "glDrawElementsInstanced");
-		    glad_glGetActiveUniformBlockName = (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC) load(userptr, "glGetActiveUniformBlockName");
-		    glad_glGetActiveUniformBlockiv = (PFNGLGETACTIVEUNIFORMBLOCKIVPROC) load(userptr, "glGetActiveUniformBlockiv");
-		    glad_glGetActiveUniformName = (PFNGLGETACTIVEUNIFORMNAMEPROC) load(userptr, "glGetActiveUniformName");
-		    glad_glGetActiveUniformsiv = (PFNGLGETACTIVEUNIFORMSIVPROC) load(userptr, "glGetActiveUniformsiv");
-		    glad_glGetIntegeri_v = (PFNGLGETINTEGERI_VPROC) load(userptr, "glGetIntegeri_v");
-		    glad_glGetUniformBlockIndex = (PFNGLGETUNIFORMBLOCKINDEXPROC) load(userptr, "glGetUniformBlockIndex");
-		    glad_glGetUniformIndices = (PFNGLGETUNIFORMINDICESPROC) load(userptr, "glGetUniformIndices");
-		    glad_glPrimitiveRestartIndex = (PFNGLPRIMITIVERESTARTINDEXPROC) load(userptr, "glPrimitiveRestartIndex");
-		    glad_glTexBuffer = (PFNGLTEXBUFFERPROC) load(userptr, "glTexBuffer");
-		    glad_glUniformBlockBinding = (PFNGLUNIFORMBLOCKBINDINGPROC) load(userptr, "glUniformBlockBinding");
+
+		MUDEF void mug_context_create_with_allocator(mugContext* context, muWindowSystem system, muBool set_context, mugAllocator* allocator) {
+			// Allocate via given allocator from here on
+			context->allocator = (allocator) ? (*allocator) : (mug_default_allocator());
+			mu_memset(context->alloc_counts, 0, sizeof(context->alloc_counts));
+			mugContext* prev_alloc_context = mug_alloc_context;
+			mug_alloc_context = context;
+
+			// Create muCOSA context
+			muCOSA_context_create(&context->cosa, system, set_context);
+			if (context->cosa.result != MUCOSA_SUCCESS) {
+				context->result = muCOSA_to_mug_result(context->cosa.result);
+				if (muCOSA_result_is_fatal(context->cosa.result)) {
+					// Go back to the previous allocator, as this context won't be destroyed
+					mug_alloc_context = prev_alloc_context;
+					return;
+				}
+			} else {
+				context->result = MUG_SUCCESS;
+			}
+
+			// Set context
+			if (set_context) {
+				mug_context_set(context);
+			}
 		}
-		static void glad_gl_load_GL_VERSION_3_2( GLADuserptrloadfunc load, void* userptr) {
-		    if(!GLAD_GL_VERSION_3_2) return;
-		    glad_glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC) load(userptr, "glClientWaitSync");
-		    glad_glDeleteSync = (PFNGLDELETESYNCPROC) load(userptr, "glDeleteSync");
-		    glad_glDrawElementsBaseVertex = (PFNGLDRAWELEMENTSBASEVERTEXPROC) load(userptr, "glDrawElementsBaseVertex");
-		    glad_glDrawElementsInstancedBaseVertex = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC) load(userptr, "glDrawElementsInstancedBaseVertex");
-		    glad_glDrawRangeElementsBaseVertex = (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC) load(userptr, "glDrawRangeElementsBaseVertex");
-		    glad_glFenceSync = (PFNGLFENCESYNCPROC) load(userptr, "glFenceSync");
-		    glad_glFramebufferTexture = (PFNGLFRAMEBUFFERTEXTUREPROC) load(userptr, "glFramebufferTexture");
-		    glad_glGetBufferParameteri64v = (PFNGLGETBUFFERPARAMETERI64VPROC) load(userptr, "glGetBufferParameteri64v");
-		    glad_glGetInteger64i_v = (PFNGLGETINTEGER64I_VPROC) load(userptr, "glGetInteger64i_v");
-		    glad_glGetInteger64v = (PFNGLGETINTEGER64VPROC) load(userptr, "glGetInteger64v");
-		    glad_glGetMultisamplefv = (PFNGLGETMULTISAMPLEFVPROC) load(userptr, "glGetMultisamplefv");
-		    glad_glGetSynciv = (PFNGLGETSYNCIVPROC) load(userptr, "glGetSynciv");
-		    glad_glIsSync = (PFNGLISSYNCPROC) load(userptr, "glIsSync");
-		    glad_glMultiDrawElementsBaseVertex = (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC) load(userptr, "glMultiDrawElementsBaseVertex");
-		    glad_glProvokingVertex = (PFNGLPROVOKINGVERTEXPROC) load(userptr, "glProvokingVertex");
-		    glad_glSampleMaski = (PFNGLSAMPLEMASKIPROC) load(userptr, "glSampleMaski");
-		    glad_glTexImage2DMultisample = (PFNGLTEXIMAGE2DMULTISAMPLEPROC) load(userptr, "glTexImage2DMultisample");
-		    glad_glTexImage3DMultisample = (PFNGLTEXIMAGE3DMULTISAMPLEPROC) load(userptr, "glTexImage3DMultisample");
-		    glad_glWaitSync = (PFNGLWAITSYNCPROC) load(userptr, "glWaitSync");
+
+		// Destroy context
+		MUDEF void mug_context_destroy(mugContext* context) {
+			// Destroy muCOSA context
+			muCOSA_context_destroy(&context->cosa);
+
+			// Stop allocating via the context's allocator
+			if (mug_alloc_context == context) {
+				mug_alloc_context = 0;
+			}
 		}
-		static void glad_gl_load_GL_VERSION_3_3( GLADuserptrloadfunc load, void* userptr) {
-		    if(!GLAD_GL_VERSION_3_3) return;
-		    glad_glBindFragDataLocationIndexed = (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC) load(userptr, "glBindFragDataLocationIndexed");
-		    glad_glBindSampler = (PFNGLBINDSAMPLERPROC) load(userptr, "glBindSampler");
-		    glad_glDeleteSamplers = (PFNGLDELETESAMPLERSPROC) load(userptr, "glDeleteSamplers");
-		    glad_glGenSamplers = (PFNGLGENSAMPLERSPROC) load(userptr, "glGenSamplers");
-		    glad_glGetFragDataIndex = (PFNGLGETFRAGDATAINDEXPROC) load(userptr, "glGetFragDataIndex");
-		    glad_glGetQueryObjecti64v = (PFNGLGETQUERYOBJECTI64VPROC) load(userptr, "glGetQueryObjecti64v");
-		    glad_glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC) load(userptr, "glGetQueryObjectui64v");
-		    glad_glGetSamplerParameterIiv = (PFNGLGETSAMPLERPARAMETERIIVPROC) load(userptr, "glGetSamplerParameterIiv");
-		    glad_glGetSamplerParameterIuiv = (PFNGLGETSAMPLERPARAMETERIUIVPROC) load(userptr, "glGetSamplerParameterIuiv");
-		    glad_glGetSamplerParameterfv = (PFNGLGETSAMPLERPARAMETERFVPROC) load(userptr, "glGetSamplerParameterfv");
-		    glad_glGetSamplerParameteriv = (PFNGLGETSAMPLERPARAMETERIVPROC) load(userptr, "glGetSamplerParameteriv");
-		    glad_glIsSampler = (PFNGLISSAMPLERPROC) load(userptr, "glIsSampler");
-		    glad_glQueryCounter = (PFNGLQUERYCOUNTERPROC) load(userptr, "glQueryCounter");
-		    glad_glSamplerParameterIiv = (PFNGLSAMPLERPARAMETERIIVPROC) load(userptr, "glSamplerParameterIiv");
-		    glad_glSamplerParameterIuiv = (PFNGLSAMPLERPARAMETERIUIVPROC) load(userptr, "glSamplerParameterIuiv");
-		    glad_glSamplerParameterf = (PFNGLSAMPLERPARAMETERFPROC) load(userptr, "glSamplerParameterf");
-		    glad_glSamplerParameterfv = (PFNGLSAMPLERPARAMETERFVPROC) load(userptr, "glSamplerParameterfv");
-		    glad_glSamplerParameteri = (PFNGLSAMPLERPARAMETERIPROC) load(userptr, "glSamplerParameteri");
-		    glad_glSamplerParameteriv = (PFNGLSAMPLERPARAMETERIVPROC) load(userptr, "glSamplerParameteriv");
-		    glad_glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC) load(userptr, "glVertexAttribDivisor");
-		    glad_glVertexAttribP1ui = (PFNGLVERTEXATTRIBP1UIPROC) load(userptr, "glVertexAttribP1ui");
-		    glad_glVertexAttribP1uiv = (PFNGLVERTEXATTRIBP1UIVPROC) load(userptr, "glVertexAttribP1uiv");
-		    glad_glVertexAttribP2ui = (PFNGLVERTEXATTRIBP2UIPROC) load(userptr, "glVertexAttribP2ui");
-		    glad_glVertexAttribP2uiv = (PFNGLVERTEXATTRIBP2UIVPROC) load(userptr, "glVertexAttribP2uiv");
-		    glad_glVertexAttribP3ui = (PFNGLVERTEXATTRIBP3UIPROC) load(userptr, "glVertexAttribP3ui");
-		    glad_glVertexAttribP3uiv = (PFNGLVERTEXATTRIBP3UIVPROC) load(userptr, "glVertexAttribP3uiv");
-		    glad_glVertexAttribP4ui = (PFNGLVERTEXATTRIBP4UIPROC) load(userptr, "glVertexAttribP4ui");
-		    glad_glVertexAttribP4uiv = (PFNGLVERTEXATTRIBP4UIVPROC) load(userptr, "glVertexAttribP4uiv");
+
+		// Set global context
+		MUDEF void mug_context_set(mugContext* context) {
+			mug_global_context = context;
 		}
 
+	/* Memory */
+
+		// Arena allocator; grows and is reset as a whole
+		// Reallocating may move data, so allocations are
+		// referred to via byte offsets, not pointers
+		struct mug_Arena {
+			// Arena memory
+			muByte* data;
+			// Amount of bytes currently allocated
+			size_m len;
+			// Amount of bytes available
+			size_m cap;
+		};
+		typedef struct mug_Arena mug_Arena;
+
+		// Allocates bytes on an arena, returning its offset
+		// Returns MU_SIZE_MAX on failure
+		size_m mug_arena_push(mug_Arena* arena, size_m size) {
+			// Keep allocations 8-byte-aligned
+			arena->len = (arena->len + 7) & ~((size_m)7);
+			size = (size + 7) & ~((size_m)7);
+
+			// Grow if necessary
+			if (arena->len + size > arena->cap) {
+				// Calculate new capacity
+				size_m cap = (arena->cap) ? (arena->cap*2) : (4096);
+				while (cap < arena->len + size) {
+					cap *= 2;
+				}
+				// Reallocate
+				muByte* data = (muByte*)mug_realloc(arena->data, cap, MUG_ALLOC_FRAME);
+				if (!data) {
+					return MU_SIZE_MAX;
+				}
+				arena->data = data;
+				arena->cap = cap;
+			}
 
+			// Allocate
+			size_m offset = arena->len;
+			arena->len += size;
+			return offset;
+		}
 
-		static void glad_gl_free_extensions(char **exts_i) {
-		    if (exts_i != NULL) {
-		        unsigned int index;
-		        for(index = 0; exts_i[index]; index++) {
-		            free((void *) (exts_i[index]));
-		        }
-		        free((void *)exts_i);
-		        exts_i = NULL;
-		    }
+		// Allocates bytes on an arena right after the last allocation, without
+		// any alignment padding, so that arrays can be built one element at a time
+		// Returns MU_SIZE_MAX on failure
+		size_m mug_arena_push_packed(mug_Arena* arena, size_m size) {
+			size_m len = arena->len;
+			size_m offset = mug_arena_push(arena, size);
+			if (offset == MU_SIZE_MAX) {
+				return MU_SIZE_MAX;
+			}
+			arena->len = len + size;
+			return len;
 		}
-		static int glad_gl_get_extensions( const char **out_exts, char ***out_exts_i) {
-		#if defined(GL_ES_VERSION_3_0) || defined(GL_VERSION_3_0)
-		    if (glad_glGetStringi != NULL && glad_glGetIntegerv != NULL) {
-		        unsigned int index = 0;
-		        unsigned int num_exts_i = 0;
-		        char **exts_i = NULL;
-		        glad_glGetIntegerv(GL_NUM_EXTENSIONS, (int*) &num_exts_i);
-		        exts_i = (char **) malloc((num_exts_i + 1) * (sizeof *exts_i));
-		        if (exts_i == NULL) {
-		            return 0;
-		        }
-		        for(index = 0; index < num_exts_i; index++) {
-		            const char *gl_str_tmp = (const char*) glad_glGetStringi(GL_EXTENSIONS, index);
-		            size_t len = strlen(gl_str_tmp) + 1;
 
-		            char *local_str = (char*) malloc(len * sizeof(char));
-		            if(local_str == NULL) {
-		                exts_i[index] = NULL;
-		                glad_gl_free_extensions(exts_i);
-		                return 0;
-		            }
+		// Resets an arena to a given offset, freeing everything allocated after it
+		void mug_arena_pop(mug_Arena* arena, size_m offset) {
+			arena->len = offset;
+		}
 
-		            memcpy(local_str, gl_str_tmp, len * sizeof(char));
-		            exts_i[index] = local_str;
-		        }
-		        exts_i[index] = NULL;
+		// Frees an arena's memory
+		void mug_arena_free(mug_Arena* arena) {
+			if (arena->data) {
+				mug_dealloc(arena->data, MUG_ALLOC_FRAME);
+			}
+			arena->data = 0;
+			arena->len = arena->cap = 0;
+		}
 
-		        *out_exts_i = exts_i;
+	/* Threads */
+
+		// Minimal threading primitives, used by the asynchronous loader, block compression, and idle waiting
+
+		#ifdef MU_WIN32
+
+			#include <windows.h>
+
+			typedef HANDLE mug_Thread;
+			typedef CRITICAL_SECTION mug_Mutex;
+			typedef CONDITION_VARIABLE mug_Cond;
+			typedef LPTHREAD_START_ROUTINE mug_ThreadFunc;
+
+			// Starts a thread; returns whether or not it started
+			muBool mug_thread_create(mug_Thread* thread, mug_ThreadFunc func, void* arg) {
+				*thread = CreateThread(0, 0, func, arg, 0, 0);
+				return *thread != 0;
+			}
+			// Waits for a thread to finish and frees it
+			void mug_thread_join(mug_Thread thread) {
+				WaitForSingleObject(thread, INFINITE);
+				CloseHandle(thread);
+			}
+
+			void mug_mutex_init(mug_Mutex* mutex) { InitializeCriticalSection(mutex); }
+			void mug_mutex_term(mug_Mutex* mutex) { DeleteCriticalSection(mutex); }
+			void mug_mutex_lock(mug_Mutex* mutex) { EnterCriticalSection(mutex); }
+			void mug_mutex_unlock(mug_Mutex* mutex) { LeaveCriticalSection(mutex); }
+
+			void mug_cond_init(mug_Cond* cond) { InitializeConditionVariable(cond); }
+			void mug_cond_term(mug_Cond* cond) { if (cond) {} }
+			void mug_cond_wait(mug_Cond* cond, mug_Mutex* mutex) { SleepConditionVariableCS(cond, mutex, INFINITE); }
+			void mug_cond_signal(mug_Cond* cond) { WakeConditionVariable(cond); }
+			void mug_cond_broadcast(mug_Cond* cond) { WakeAllConditionVariable(cond); }
+
+			// Auto-resetting signal that one thread can wait on while other threads raise it
+			// (an event, so that waiting can be combined with waiting on window messages)
+			typedef HANDLE mug_Signal;
+
+			void mug_signal_init(mug_Signal* signal) { *signal = CreateEventA(0, FALSE, FALSE, 0); }
+			void mug_signal_term(mug_Signal* signal) { if (*signal) { CloseHandle(*signal); } }
+			void mug_signal_raise(mug_Signal* signal) { if (*signal) { SetEvent(*signal); } }
+			// Waits until raised or until timeout (in seconds; negative for none) passes
+			void mug_signal_wait(mug_Signal* signal, double timeout) {
+				DWORD ms = (timeout < 0.0) ? (INFINITE) : ((DWORD)(timeout * 1000.0));
+				if (*signal) {
+					WaitForSingleObject(*signal, ms);
+				} else {
+					Sleep(ms);
+				}
+			}
 
-		        return 1;
-		    }
 		#else
-		    GLAD_UNUSED(out_exts_i);
-		#endif
-		    if (glad_glGetString == NULL) {
-		        return 0;
-		    }
-		    *out_exts = (const char *)glad_glGetString(GL_EXTENSIONS);
-		    return 1;
-		}
-		static int glad_gl_has_extension(const char *exts, char **exts_i, const char *ext) {
-		    if(exts_i) {
-		        unsigned int index;
-		        for(index = 0; exts_i[index]; index++) {
-		            const char *e = exts_i[index];
-		            if(strcmp(e, ext) == 0) {
-		                return 1;
-		            }
-		        }
-		    } else {
-		        const char *extensions;
-		        const char *loc;
-		        const char *terminator;
-		        extensions = exts;
-		        if(extensions == NULL || ext == NULL) {
-		            return 0;
-		        }
-		        while(1) {
-		            loc = strstr(extensions, ext);
-		            if(loc == NULL) {
-		                return 0;
-		            }
-		            terminator = loc + strlen(ext);
-		            if((loc == extensions || *(loc - 1) == ' ') &&
-		                (*terminator == ' ' || *terminator == '\0')) {
-		                return 1;
-		            }
-		            extensions = terminator;
-		        }
-		    }
-		    return 0;
-		}
 
-		static GLADapiproc glad_gl_get_proc_from_userptr(void *userptr, const char* name) {
-		    return (GLAD_GNUC_EXTENSION (GLADapiproc (*)(const char *name)) userptr)(name);
-		}
+			#include <pthread.h>
 
-		static int glad_gl_find_extensions_gl(void) {
-		    const char *exts = NULL;
-		    char **exts_i = NULL;
-		    if (!glad_gl_get_extensions(&exts, &exts_i)) return 0;
+			typedef pthread_t mug_Thread;
+			typedef pthread_mutex_t mug_Mutex;
+			typedef pthread_cond_t mug_Cond;
+			typedef void* (*mug_ThreadFunc)(void*);
 
-		    GLAD_UNUSED(glad_gl_has_extension);
+			// Starts a thread; returns whether or not it started
+			muBool mug_thread_create(mug_Thread* thread, mug_ThreadFunc func, void* arg) {
+				return pthread_create(thread, 0, func, arg) == 0;
+			}
+			// Waits for a thread to finish and frees it
+			void mug_thread_join(mug_Thread thread) {
+				pthread_join(thread, 0);
+			}
 
-		    glad_gl_free_extensions(exts_i);
+			void mug_mutex_init(mug_Mutex* mutex) { pthread_mutex_init(mutex, 0); }
+			void mug_mutex_term(mug_Mutex* mutex) { pthread_mutex_destroy(mutex); }
+			void mug_mutex_lock(mug_Mutex* mutex) { pthread_mutex_lock(mutex); }
+			void mug_mutex_unlock(mug_Mutex* mutex) { pthread_mutex_unlock(mutex); }
 
-		    return 1;
-		}
+			void mug_cond_init(mug_Cond* cond) { pthread_cond_init(cond, 0); }
+			void mug_cond_term(mug_Cond* cond) { pthread_cond_destroy(cond); }
+			void mug_cond_wait(mug_Cond* cond, mug_Mutex* mutex) { pthread_cond_wait(cond, mutex); }
+			void mug_cond_signal(mug_Cond* cond) { pthread_cond_signal(cond); }
+			void mug_cond_broadcast(mug_Cond* cond) { pthread_cond_broadcast(cond); }
 
-		static int glad_gl_find_core_gl(void) {
-		    int i;
-		    const char* version;
-		    const char* prefixes[] = {
-		        "OpenGL ES-CM ",
-		        "OpenGL ES-CL ",
-		        "OpenGL ES ",
-		        "OpenGL SC ",
-		        NULL
-		    };
-		    int major = 0;
-		    int minor = 0;
-		    version = (const char*) glad_glGetString(GL_VERSION);
-		    if (!version) return 0;
-		    for (i = 0;  prefixes[i];  i++) {
-		        const size_t length = strlen(prefixes[i]);
-		        if (strncmp(version, prefixes[i], length) == 0) {
-		            version += length;
-		            break;
-		        }
-		    }
+			#include <sys/time.h>
 
-		    GLAD_IMPL_UTIL_SSCANF(version, "%d.%d", &major, &minor);
+			// Auto-resetting signal that one thread can wait on while other threads raise it
+			struct mug_Signal {
+				mug_Mutex mutex;
+				mug_Cond cond;
+				muBool raised;
+			};
+			typedef struct mug_Signal mug_Signal;
 
-		    GLAD_GL_VERSION_1_0 = (major == 1 && minor >= 0) || major > 1;
-		    GLAD_GL_VERSION_1_1 = (major == 1 && minor >= 1) || major > 1;
-		    GLAD_GL_VERSION_1_2 = (major == 1 && minor >= 2) || major > 1;
-		    GLAD_GL_VERSION_1_3 = (major == 1 && minor >= 3) || major > 1;
-		    GLAD_GL_VERSION_1_4 = (major == 1 && minor >= 4) || major > 1;
-		    GLAD_GL_VERSION_1_5 = (major == 1 && minor >= 5) || major > 1;
-		    GLAD_GL_VERSION_2_0 = (major == 2 && minor >= 0) || major > 2;
-		    GLAD_GL_VERSION_2_1 = (major == 2 && minor >= 1) || major > 2;
-		    GLAD_GL_VERSION_3_0 = (major == 3 && minor >= 0) || major > 3;
-		    GLAD_GL_VERSION_3_1 = (major == 3 && minor >= 1) || major > 3;
-		    GLAD_GL_VERSION_3_2 = (major == 3 && minor >= 2) || major > 3;
-		    GLAD_GL_VERSION_3_3 = (major == 3 && minor >= 3) || major > 3;
+			void mug_signal_init(mug_Signal* signal) {
+				mug_mutex_init(&signal->mutex);
+				mug_cond_init(&signal->cond);
+				signal->raised = MU_FALSE;
+			}
+			void mug_signal_term(mug_Signal* signal) {
+				mug_cond_term(&signal->cond);
+				mug_mutex_term(&signal->mutex);
+			}
+			void mug_signal_raise(mug_Signal* signal) {
+				mug_mutex_lock(&signal->mutex);
+				signal->raised = MU_TRUE;
+				mug_cond_signal(&signal->cond);
+				mug_mutex_unlock(&signal->mutex);
+			}
+			// Waits until raised or until timeout (in seconds; negative for none) passes
+			void mug_signal_wait(mug_Signal* signal, double timeout) {
+				// Get absolute deadline (on the realtime clock, which condition variables use by default)
+				struct timeval now;
+				gettimeofday(&now, 0);
+				double end = (double)now.tv_sec + (double)now.tv_usec / 1000000.0 + ((timeout > 0.0) ? (timeout) : (0.0));
+				struct timespec deadline;
+				deadline.tv_sec = (time_t)end;
+				deadline.tv_nsec = (long)((end - (double)deadline.tv_sec) * 1000000000.0);
+
+				mug_mutex_lock(&signal->mutex);
+				while (!signal->raised) {
+					if (timeout < 0.0) {
+						pthread_cond_wait(&signal->cond, &signal->mutex);
+					} else if (pthread_cond_timedwait(&signal->cond, &signal->mutex, &deadline) != 0) {
+						break;
+					}
+				}
+				signal->raised = MU_FALSE;
+				mug_mutex_unlock(&signal->mutex);
+			}
 
-		    return GLAD_MAKE_VERSION(major, minor);
-		}
+		#endif
 
-		int gladLoadGLUserPtr( GLADuserptrloadfunc load, void *userptr) {
-		    int version;
+	/* File mapping */
 
-		    glad_glGetString = (PFNGLGETSTRINGPROC) load(userptr, "glGetString");
-		    if(glad_glGetString == NULL) return 0;
-		    version = glad_gl_find_core_gl();
+		// Read-only memory mapping of a whole file
 
-		    glad_gl_load_GL_VERSION_1_0(load, userptr);
-		    glad_gl_load_GL_VERSION_1_1(load, userptr);
-		    glad_gl_load_GL_VERSION_1_2(load, userptr);
-		    glad_gl_load_GL_VERSION_1_3(load, userptr);
-		    glad_gl_load_GL_VERSION_1_4(load, userptr);
-		    glad_gl_load_GL_VERSION_1_5(load, userptr);
-		    glad_gl_load_GL_VERSION_2_0(load, userptr);
-		    glad_gl_load_GL_VERSION_2_1(load, userptr);
-		    glad_gl_load_GL_VERSION_3_0(load, userptr);
-		    glad_gl_load_GL_VERSION_3_1(load, userptr);
-		    glad_gl_load_GL_VERSION_3_2(load, userptr);
-		    glad_gl_load_GL_VERSION_3_3(load, userptr);
+		#ifdef MU_WIN32
 
-		    if (!glad_gl_find_extensions_gl()) return 0;
+			struct mug_FileMap {
+				// Mapped contents
+				muByte* data;
+				size_m size;
+				// File and mapping handles
+				HANDLE file;
+				HANDLE mapping;
+			};
+			typedef struct mug_FileMap mug_FileMap;
+
+			// Maps a file; returns whether or not it succeeded
+			muBool mug_file_map(mug_FileMap* map, const char* path) {
+				// Open file
+				map->file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, 0);
+				if (map->file == INVALID_HANDLE_VALUE) {
+					return MU_FALSE;
+				}
+				LARGE_INTEGER size;
+				if (!GetFileSizeEx(map->file, &size) || !size.QuadPart) {
+					CloseHandle(map->file);
+					return MU_FALSE;
+				}
+				map->size = (size_m)size.QuadPart;
+
+				// Map it
+				map->mapping = CreateFileMappingA(map->file, 0, PAGE_READONLY, 0, 0, 0);
+				if (!map->mapping) {
+					CloseHandle(map->file);
+					return MU_FALSE;
+				}
+				map->data = (muByte*)MapViewOfFile(map->mapping, FILE_MAP_READ, 0, 0, 0);
+				if (!map->data) {
+					CloseHandle(map->mapping);
+					CloseHandle(map->file);
+					return MU_FALSE;
+				}
+				return MU_TRUE;
+			}
+
+			// Unmaps a file
+			void mug_file_unmap(mug_FileMap* map) {
+				UnmapViewOfFile(map->data);
+				CloseHandle(map->mapping);
+				CloseHandle(map->file);
+			}
 
+		#else
 
+			#include <sys/mman.h>
+			#include <sys/stat.h>
+			#include <fcntl.h>
+			#include <unistd.h>
 
-		    return version;
-		}
+			struct mug_FileMap {
+				// Mapped contents
+				muByte* data;
+				size_m size;
+			};
+			typedef struct mug_FileMap mug_FileMap;
+
+			// Maps a file; returns whether or not it succeeded
+			muBool mug_file_map(mug_FileMap* map, const char* path) {
+				// Open file
+				int fd = open(path, O_RDONLY);
+				if (fd < 0) {
+					return MU_FALSE;
+				}
+				struct stat st;
+				if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+					close(fd);
+					return MU_FALSE;
+				}
+				map->size = (size_m)st.st_size;
+
+				// Map it (the mapping outlives the descriptor)
+				void* data = mmap(0, map->size, PROT_READ, MAP_PRIVATE, fd, 0);
+				close(fd);
+				if (data == MAP_FAILED) {
+					return MU_FALSE;
+				}
+				map->data = (muByte*)data;
+				return MU_TRUE;
+			}
 
+			// Unmaps a file
+			void mug_file_unmap(mug_FileMap* map) {
+				munmap(map->data, map->size);
+			}
 
-		int gladLoadGL( GLADloadfunc load) {
-		    return gladLoadGLUserPtr( glad_gl_get_proc_from_userptr, GLAD_GNUC_EXTENSION (void*) load);
+		#endif
+
+	/* Frame pacing */
+
+		// Struct for scheduling a graphic's frames and recording their times
+		struct mug_Pacer {
+			// Time that the next frame is scheduled to start (0 if unscheduled)
+			double next;
+			// Time between frames that the schedule is for
+			double period;
+			// Policy for late frames
+			mugFramePolicy policy;
+			// Time that the last frame started
+			double last_start;
+
+			// Running mean and variance of how long a 1 ms sleep actually takes
+			// (which is often far longer, like ~15 ms on Win32 by default)
+			double sleep_mean;
+			double sleep_var;
+			uint32_m sleep_count;
+
+			// Ring of recorded frame times, and the time each one targeted (0 if none)
+			double times[MUG_FRAME_STATS_FRAMES];
+			double targets[MUG_FRAME_STATS_FRAMES];
+			// Scratch space for sorting jitter
+			double jitter[MUG_FRAME_STATS_FRAMES];
+			// Amount of frames recorded, in total
+			uint32_m recorded;
+			// Amount of frames dropped
+			uint32_m dropped;
+
+			// Time spent waiting on the GPU during the current frame
+			double gpu_wait;
+			// Ring of time spent waiting on the GPU, per recorded frame
+			double gpu_waits[MUG_FRAME_STATS_FRAMES];
+		};
+		typedef struct mug_Pacer mug_Pacer;
+
+		// Samples after which sleep measurements are weighted exponentially
+		#define MUG_PACER_SLEEP_SAMPLES 64
+
+		// Initializes a pacer, starting its first frame at the given time
+		void mug_pacer_init(mug_Pacer* pacer, double now) {
+			mu_memset(pacer, 0, sizeof(mug_Pacer));
+			pacer->policy = MUG_FRAME_DROP;
+			pacer->last_start = now;
 		}
 
+		// Returns how long a 1 ms sleep can be expected to take at most
+		double mug_pacer_sleep_estimate(mug_Pacer* pacer) {
+			// Assume a bit over a millisecond until measured
+			if (pacer->sleep_count < 2) {
+				return 0.002;
+			}
+			return pacer->sleep_mean + (double)mu_sqrtf((float)pacer->sleep_var);
+		}
 
+		// Records how long a 1 ms sleep took
+		void mug_pacer_sleep_observe(mug_Pacer* pacer, double time) {
+			if (pacer->sleep_count < MUG_PACER_SLEEP_SAMPLES) {
+				++pacer->sleep_count;
+			}
+			double alpha = 1.0 / (double)pacer->sleep_count;
+			double delta = time - pacer->sleep_mean;
+			pacer->sleep_mean += alpha * delta;
+			pacer->sleep_var = (1.0 - alpha) * (pacer->sleep_var + alpha * delta * delta);
+		}
 
-		 
+		// Waits until the given time, sleeping in steps of 1 ms while a sleep
+		// is expected to finish in time, and then spinning for the rest
+		// Returns the time after waiting
+		double mug_pacer_wait(mugContext* context, mug_Pacer* pacer, double deadline) {
+			double now = muCOSA_fixed_time_get(&context->cosa);
+			while (deadline - now > mug_pacer_sleep_estimate(pacer)) {
+				muCOSA_sleep(&context->cosa, 0.001);
+				double after = muCOSA_fixed_time_get(&context->cosa);
+				mug_pacer_sleep_observe(pacer, after - now);
+				now = after;
+			}
+			while (now < deadline) {
+				now = muCOSA_fixed_time_get(&context->cosa);
+			}
+			return now;
+		}
 
-		#ifdef GLAD_GL
+		// Finishes a frame, waiting until the next frame is scheduled to start
+		// synced is whether or not presenting already paces frames to the display
+		void mug_pacer_frame(mugContext* context, mug_Pacer* pacer, float target_fps, muBool synced) {
+			double now = muCOSA_fixed_time_get(&context->cosa);
+			double period = (target_fps > 0.f) ? (1.0 / (double)target_fps) : (0.0);
+
+			if (period > 0.0 && !synced) {
+				// Start schedule from the last frame if unscheduled or retargeted
+				if (pacer->next == 0.0 || pacer->period != period) {
+					pacer->next = pacer->last_start + period;
+					pacer->period = period;
+				}
 
-		#ifndef GLAD_LOADER_LIBRARY_C_
-		#define GLAD_LOADER_LIBRARY_C_
+				// Late; restart the schedule from now if dropping, or if too far behind to catch up
+				double late = now - pacer->next;
+				if (late > 0.0) {
+					uint32_m missed = (uint32_m)(late / period);
+					if (pacer->policy == MUG_FRAME_DROP || missed > MUG_FRAME_CATCH_UP_MAX) {
+						pacer->dropped += missed;
+						pacer->next = now;
+					}
+				}
+				// On time; wait for the schedule
+				else {
+					now = mug_pacer_wait(context, pacer, pacer->next);
+				}
+				pacer->next += period;
+			} else {
+				pacer->next = 0.0;
+			}
 
-		#include <stddef.h>
-		#include <stdlib.h>
+			// Record frame
+			uint32_m i = pacer->recorded % MUG_FRAME_STATS_FRAMES;
+			pacer->times[i] = now - pacer->last_start;
+			pacer->targets[i] = period;
+			pacer->gpu_waits[i] = pacer->gpu_wait;
+			pacer->gpu_wait = 0.0;
+			++pacer->recorded;
+			pacer->last_start = now;
+		}
 
-		#if GLAD_PLATFORM_WIN32
-		#include <windows.h>
-		#else
-		#include <dlfcn.h>
-		#endif
+		// Restarts a pacer's schedule after idling, starting the next frame at the given time
+		void mug_pacer_idle(mug_Pacer* pacer, double now) {
+			pacer->next = 0.0;
+			pacer->last_start = now;
+		}
 
+		// Compares two doubles, for sorting in ascending order
+		int mug_compare_double(const void* a, const void* b) {
+			double da = *(const double*)a, db = *(const double*)b;
+			return (da > db) - (da < db);
+		}
 
-		static void* glad_get_dlopen_handle(const char *lib_names[], int length) {
-		    void *handle = NULL;
-		    int i;
+		// Fills in frame statistics from a pacer's recorded frames
+		void mug_pacer_stats(mug_Pacer* pacer, mugFrameStats* stats) {
+			mu_memset(stats, 0, sizeof(mugFrameStats));
+			stats->dropped = pacer->dropped;
+			uint32_m count = (pacer->recorded < MUG_FRAME_STATS_FRAMES) ? (pacer->recorded) : (MUG_FRAME_STATS_FRAMES);
+			if (!count) {
+				return;
+			}
+			stats->frames = count;
+			stats->last = pacer->times[(pacer->recorded-1) % MUG_FRAME_STATS_FRAMES];
+			stats->gpu_wait_last = pacer->gpu_waits[(pacer->recorded-1) % MUG_FRAME_STATS_FRAMES];
+
+			// Averages
+			for (uint32_m i = 0; i < count; ++i) {
+				stats->average += pacer->times[i];
+				stats->gpu_wait_average += pacer->gpu_waits[i];
+			}
+			stats->average /= (double)count;
+			stats->gpu_wait_average /= (double)count;
+
+			// Jitter percentiles (nearest rank)
+			for (uint32_m i = 0; i < count; ++i) {
+				double target = (pacer->targets[i] > 0.0) ? (pacer->targets[i]) : (stats->average);
+				double d = pacer->times[i] - target;
+				pacer->jitter[i] = (d < 0.0) ? (-d) : (d);
+			}
+			mu_qsort(pacer->jitter, count, sizeof(double), mug_compare_double);
+			const double percentiles[3] = { 0.5, 0.95, 0.99 };
+			for (uint32_m p = 0; p < 3; ++p) {
+				stats->jitter[p] = pacer->jitter[(uint32_m)((double)(count-1) * percentiles[p] + 0.5)];
+			}
+		}
 
-		    for (i = 0; i < length; ++i) {
-		#if GLAD_PLATFORM_WIN32
-		  #if GLAD_PLATFORM_UWP
-		        size_t buffer_size = (strlen(lib_names[i]) + 1) * sizeof(WCHAR);
-		        LPWSTR buffer = (LPWSTR) malloc(buffer_size);
-		        if (buffer != NULL) {
-		            int ret = MultiByteToWideChar(CP_ACP, 0, lib_names[i], -1, buffer, buffer_size);
-		            if (ret != 0) {
-		                handle = (void*) LoadPackagedLibrary(buffer, 0);
-		            }
-		            free((void*) buffer);
-		        }
-		  #else
-		        handle = (void*) LoadLibraryA(lib_names[i]);
-		  #endif
+	/* Draw statistics */
+
+		// Struct for a graphic's draw statistics
+		struct mug_Stats {
+			// Counters (see mugStats)
+			mugStats counters;
+			// Context used to read the time
+			mugContext* context;
+		};
+		typedef struct mug_Stats mug_Stats;
+
+		// Adds to a counter of the current frame, and times operations
+		// (Compiled out if MUG_NO_STATS is defined)
+		#ifndef MUG_NO_STATS
+			#define MUG_STAT(stats, member, amount) (stats)->counters.frame.member += (amount);
+			// Declares a variable holding the time that an operation started
+			#define MUG_STAT_TIME(stats, start) double start = muCOSA_fixed_time_get(&(stats)->context->cosa);
+			// Adds the time since start to a time counter
+			#define MUG_STAT_TIME_END(stats, member, start) (stats)->counters.frame.member += muCOSA_fixed_time_get(&(stats)->context->cosa) - (start);
 		#else
-		        handle = dlopen(lib_names[i], RTLD_LAZY | RTLD_LOCAL);
+			#define MUG_STAT(stats, member, amount)
+			#define MUG_STAT_TIME(stats, start)
+			#define MUG_STAT_TIME_END(stats, member, start)
 		#endif
-		        if (handle != NULL) {
-		            return handle;
-		        }
-		    }
 
-		    return NULL;
+		// Initializes draw statistics
+		void mug_stats_init(mug_Stats* stats, mugContext* context) {
+			mu_memset(&stats->counters, 0, sizeof(mugStats));
+			stats->context = context;
 		}
 
-		static void glad_close_dlopen_handle(void* handle) {
-		    if (handle != NULL) {
-		#if GLAD_PLATFORM_WIN32
-		        FreeLibrary((HMODULE) handle);
-		#else
-		        dlclose(handle);
-		#endif
-		    }
+		// Adds one set of counters to another
+		void mug_stats_add(mugStatCounters* dst, mugStatCounters* src) {
+			dst->draw_calls += src->draw_calls;
+			dst->objects += src->objects;
+			dst->vertexes += src->vertexes;
+			dst->upload_bytes += src->upload_bytes;
+			dst->index_bytes += src->index_bytes;
+			dst->program_binds += src->program_binds;
+			dst->vertex_array_binds += src->vertex_array_binds;
+			dst->texture_binds += src->texture_binds;
+			dst->context_binds += src->context_binds;
+			dst->mallocs += src->mallocs;
+			dst->malloc_bytes += src->malloc_bytes;
+			dst->shader_compiles += src->shader_compiles;
+			dst->fill_time += src->fill_time;
+			dst->upload_time += src->upload_time;
+			dst->swap_time += src->swap_time;
+			dst->sleep_time += src->sleep_time;
 		}
 
-		static GLADapiproc glad_dlsym_handle(void* handle, const char *name) {
-		    if (handle == NULL) {
-		        return NULL;
-		    }
+		// Completes the current frame's counters
+		void mug_stats_frame(mug_Stats* stats) {
+			mugStats* c = &stats->counters;
+			mug_stats_add(&c->total, &c->frame);
+			c->last = c->frame;
+			mu_memset(&c->frame, 0, sizeof(mugStatCounters));
+			++c->frames;
+		}
 
-		#if GLAD_PLATFORM_WIN32
-		    return (GLADapiproc) GetProcAddress((HMODULE) handle, name);
-		#else
-		    return GLAD_GNUC_EXTENSION (GLADapiproc) dlsym(handle, name);
-		#endif
+		// Sums counts of objects, such as those given to multirender functions
+		uint64_m mug_stats_sum(uint32_m* counts, uint32_m n) {
+			uint64_m sum = 0;
+			for (uint32_m i = 0; i < n; ++i) {
+				sum += counts[i];
+			}
+			return sum;
 		}
 
-		#endif /* GLAD_LOADER_LIBRARY_C_ */
+		// Counts an arena growing since its capacity was prev_cap
+		void mug_stats_arena(mug_Stats* stats, mug_Arena* arena, size_m prev_cap) {
+			if (arena->cap != prev_cap) {
+				MUG_STAT(stats, mallocs, 1)
+				MUG_STAT(stats, malloc_bytes, arena->cap)
+			}
+			return; if (stats) {} if (arena) {} if (prev_cap) {}
+		}
 
-		typedef void* (GLAD_API_PTR *GLADglprocaddrfunc)(const char*);
-		struct _glad_gl_userptr {
-		    void *handle;
-		    GLADglprocaddrfunc gl_get_proc_address_ptr;
+	/* GPU zones */
+
+		// Struct for a GPU zone being measured
+		struct mug_GPUZone {
+			// Public info
+			mugGPUZone info;
+			// Time added up for the frame being read, and said frame
+			double sum;
+			uint64_m frame;
+			// Whether or not any time has been read for said frame
+			muBool pending;
+		};
+		typedef struct mug_GPUZone mug_GPUZone;
+
+		// Struct for the GPU zones of a graphic
+		struct mug_GPUZones {
+			// Whether or not zones are measured
+			muBool enabled;
+			// Zones, in the order that they were first begun
+			mug_GPUZone zones[MUG_GPU_ZONE_COUNT];
+			uint32_m count;
+			// Index of the active zone plus 1 (0 if none)
+			uint32_m active;
+			// Frame being rendered
+			uint64_m frame;
 		};
+		typedef struct mug_GPUZones mug_GPUZones;
 
-		static GLADapiproc glad_gl_get_proc(void *vuserptr, const char *name) {
-		    struct _glad_gl_userptr userptr = *(struct _glad_gl_userptr*) vuserptr;
-		    GLADapiproc result = NULL;
+		// Initializes GPU zones
+		void mug_gpu_zones_init(mug_GPUZones* zones) {
+			mu_memset(zones, 0, sizeof(mug_GPUZones));
+		}
 
-		    if(userptr.gl_get_proc_address_ptr != NULL) {
-		        result = GLAD_GNUC_EXTENSION (GLADapiproc) userptr.gl_get_proc_address_ptr(name);
-		    }
-		    if(result == NULL) {
-		        result = glad_dlsym_handle(userptr.handle, name);
-		    }
+		// Finds the zone of a name, adding it if it doesn't exist
+		// Returns MUG_GPU_ZONE_COUNT if there's no room for it
+		uint32_m mug_gpu_zone_find(mug_GPUZones* zones, const char* name) {
+			for (uint32_m i = 0; i < zones->count; ++i) {
+				const char* zname = zones->zones[i].info.name;
+				// Compare names
+				size_m c = 0;
+				while (zname[c] && zname[c] == name[c]) {
+					++c;
+				}
+				if (zname[c] == name[c]) {
+					return i;
+				}
+			}
 
-		    return result;
+			if (zones->count == MUG_GPU_ZONE_COUNT) {
+				return MUG_GPU_ZONE_COUNT;
+			}
+			mu_memset(&zones->zones[zones->count], 0, sizeof(mug_GPUZone));
+			zones->zones[zones->count].info.name = name;
+			return zones->count++;
 		}
 
-		static void* _glad_GL_loader_handle = NULL;
+		// Adds the time of a zone's frame to its moving average
+		void mug_gpu_zone_commit(mug_GPUZone* zone) {
+			if (!zone->pending) {
+				return;
+			}
+			zone->info.last = zone->sum;
+			if (zone->info.frames) {
+				zone->info.time += (zone->sum - zone->info.time) * MUG_GPU_ZONE_SMOOTHING;
+			} else {
+				zone->info.time = zone->sum;
+			}
+			++zone->info.frames;
+			zone->pending = MU_FALSE;
+		}
 
-		static void* glad_gl_dlopen_handle(void) {
-		#if GLAD_PLATFORM_APPLE
-		    static const char *NAMES[] = {
-		        "../Frameworks/OpenGL.framework/OpenGL",
-		        "/Library/Frameworks/OpenGL.framework/OpenGL",
-		        "/System/Library/Frameworks/OpenGL.framework/OpenGL",
-		        "/System/Library/Frameworks/OpenGL.framework/Versions/Current/OpenGL"
-		    };
-		#elif GLAD_PLATFORM_WIN32
-		    static const char *NAMES[] = {"opengl32.dll"};
+		// Adds time measured for a zone in a given frame
+		void mug_gpu_zone_sample(mug_GPUZones* zones, uint32_m index, uint64_m frame, double time) {
+			mug_GPUZone* zone = &zones->zones[index];
+			if (zone->pending && zone->frame != frame) {
+				mug_gpu_zone_commit(zone);
+			}
+			if (!zone->pending) {
+				zone->sum = 0.0;
+				zone->frame = frame;
+				zone->pending = MU_TRUE;
+			}
+			zone->sum += time;
+		}
+
+		// Commits the time of zones' frames before the given frame
+		// (which have no more time left to be read)
+		void mug_gpu_zones_commit(mug_GPUZones* zones, uint64_m frame) {
+			for (uint32_m i = 0; i < zones->count; ++i) {
+				if (zones->zones[i].pending && zones->zones[i].frame < frame) {
+					mug_gpu_zone_commit(&zones->zones[i]);
+				}
+			}
+		}
+
+		// Name of the automatic zone of an object type
+		const char* mug_gpu_zone_object_name(mugObjectType type) {
+			switch (type) {
+				default: return "objects"; break;
+				case MUG_OBJECT_POINT: return "point"; break;
+				case MUG_OBJECT_LINE: return "line"; break;
+				case MUG_OBJECT_TRIANGLE: return "triangle"; break;
+				case MUG_OBJECT_RECT: return "rect"; break;
+				case MUG_OBJECT_CIRCLE: return "circle"; break;
+				case MUG_OBJECT_SQUIRCLE: return "squircle"; break;
+				case MUG_OBJECT_ROUND_RECT: return "round_rect"; break;
+				case MUG_OBJECT_TEXTURE_2D: return "texture_2d"; break;
+				case MUG_OBJECT_TEXTURE_2D_ARRAY: return "texture_2d_array"; break;
+			}
+		}
+
+	/* Tracing */
+
+		// Struct for an event recorded for a trace
+		struct mug_TraceEvent {
+			// Name of the operation
+			const char* name;
+			// Start time and duration, in seconds
+			double start;
+			double dur;
+			// Whether or not the event was measured on the GPU
+			muBool gpu;
+		};
+		typedef struct mug_TraceEvent mug_TraceEvent;
+
+		// Struct for the trace of a graphic
+		struct mug_Trace {
+			// Whether or not events are recorded
+			muBool enabled;
+			// Ring of events (0 until tracing is first enabled)
+			mug_TraceEvent* events;
+			// Amount of events ever recorded (the next is written at count % MUG_TRACE_EVENT_COUNT)
+			uint64_m count;
+			// Context used for the time
+			mugContext* context;
+			// CPU time and GPU timestamp (in nanoseconds) taken at the same moment,
+			// used to align GPU events with CPU events
+			double cpu_ref;
+			uint64_m gpu_ref;
+			muBool calibrated;
+		};
+		typedef struct mug_Trace mug_Trace;
+
+		// Records an operation, and the time that it started
+		// (Compiled out if MUG_NO_TRACE is defined)
+		#ifndef MUG_NO_TRACE
+			// Declares a variable holding the time that an operation started (0 if not tracing)
+			#define MUG_TRACE_BEGIN(trace, start) double start = mug_trace_time(trace);
+			// Records an operation that started at start
+			#define MUG_TRACE_END(trace, name, start) mug_trace_end(trace, name, start);
 		#else
-		    static const char *NAMES[] = {
-		  #if defined(__CYGWIN__)
-		        "libGL-1.so",
-		  #endif
-		        "libGL.so.1",
-		        "libGL.so"
-		    };
+			#define MUG_TRACE_BEGIN(trace, start)
+			#define MUG_TRACE_END(trace, name, start)
 		#endif
 
-		    if (_glad_GL_loader_handle == NULL) {
-		        _glad_GL_loader_handle = glad_get_dlopen_handle(NAMES, sizeof(NAMES) / sizeof(NAMES[0]));
-		    }
+		// Initializes a trace
+		void mug_trace_init(mug_Trace* trace, mugContext* context) {
+			mu_memset(trace, 0, sizeof(mug_Trace));
+			trace->context = context;
+		}
 
-		    return _glad_GL_loader_handle;
+		// Frees a trace's events
+		void mug_trace_free(mug_Trace* trace) {
+			if (trace->events) {
+				mug_dealloc(trace->events, MUG_ALLOC_GENERAL);
+				trace->events = 0;
+			}
 		}
 
-		static struct _glad_gl_userptr glad_gl_build_userptr(void *handle) {
-		    struct _glad_gl_userptr userptr;
+		// Gets the current time if tracing, and 0 otherwise
+		double mug_trace_time(mug_Trace* trace) {
+			if (!trace->enabled) {
+				return 0.0;
+			}
+			return muCOSA_fixed_time_get(&trace->context->cosa);
+		}
 
-		    userptr.handle = handle;
-		#if GLAD_PLATFORM_APPLE || defined(__HAIKU__)
-		    userptr.gl_get_proc_address_ptr = NULL;
-		#elif GLAD_PLATFORM_WIN32
-		    userptr.gl_get_proc_address_ptr =
-		        (GLADglprocaddrfunc) glad_dlsym_handle(handle, "wglGetProcAddress");
-		#else
-		    userptr.gl_get_proc_address_ptr =
-		        (GLADglprocaddrfunc) glad_dlsym_handle(handle, "glXGetProcAddressARB");
-		#endif
+		// Records an event
+		void mug_trace_event(mug_Trace* trace, const char* name, double start, double dur, muBool gpu) {
+			mug_TraceEvent* event = &trace->events[trace->count % MUG_TRACE_EVENT_COUNT];
+			event->name = name;
+			event->start = start;
+			event->dur = dur;
+			event->gpu = gpu;
+			++trace->count;
+		}
 
-		    return userptr;
+		// Records an operation that started at start (if tracing was enabled then)
+		void mug_trace_end(mug_Trace* trace, const char* name, double start) {
+			if (!trace->enabled || start == 0.0) {
+				return;
+			}
+			mug_trace_event(trace, name, start, muCOSA_fixed_time_get(&trace->context->cosa) - start, MU_FALSE);
 		}
 
-		int gladLoaderLoadGL(void) {
-		    int version = 0;
-		    void *handle;
-		    int did_load = 0;
-		    struct _glad_gl_userptr userptr;
+		// Records an operation measured on the GPU, given its GPU timestamp and duration in nanoseconds
+		void mug_trace_gpu(mug_Trace* trace, const char* name, uint64_m stamp, uint64_m ns) {
+			if (!trace->enabled || !trace->calibrated) {
+				return;
+			}
+			double offset = (stamp >= trace->gpu_ref)
+				? ((double)(stamp - trace->gpu_ref) / 1000000000.0)
+				: (-(double)(trace->gpu_ref - stamp) / 1000000000.0);
+			mug_trace_event(trace, name, trace->cpu_ref + offset, (double)ns / 1000000000.0, MU_TRUE);
+		}
 
-		    did_load = _glad_GL_loader_handle == NULL;
-		    handle = glad_gl_dlopen_handle();
-		    if (handle) {
-		        userptr = glad_gl_build_userptr(handle);
+		// Writes an unsigned integer as text; returns the amount of characters written
+		size_m mug_trace_format_uint(char* out, uint64_m n) {
+			char digits[20];
+			size_m count = 0;
+			do {
+				digits[count++] = (char)('0' + (n % 10));
+				n /= 10;
+			} while (n);
+			for (size_m i = 0; i < count; ++i) {
+				out[i] = digits[count-1-i];
+			}
+			return count;
+		}
 
-		        version = gladLoadGLUserPtr(glad_gl_get_proc, &userptr);
+		// Writes a time in seconds as microseconds with 3 decimals;
+		// returns the amount of characters written
+		size_m mug_trace_format_time(char* out, double seconds) {
+			uint64_m ns = (seconds > 0.0) ? ((uint64_m)(seconds * 1000000000.0 + 0.5)) : (0);
+			size_m len = mug_trace_format_uint(out, ns / 1000);
+			out[len++] = '.';
+			out[len++] = (char)('0' + ((ns / 100) % 10));
+			out[len++] = (char)('0' + ((ns / 10) % 10));
+			out[len++] = (char)('0' + (ns % 10));
+			return len;
+		}
 
-		        if (did_load) {
-		            gladLoaderUnloadGL();
-		        }
-		    }
+		// Writes a trace as Chrome trace JSON; returns whether or not it succeeded
+		muBool mug_trace_write(mug_Trace* trace, FILE* file) {
+			// Header, naming the tracks
+			const char* header =
+				"{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"
+				"{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"mug\"}},\n"
+				"{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"CPU\"}},\n"
+				"{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":2,\"args\":{\"name\":\"GPU\"}}";
+			size_m header_len = 0;
+			while (header[header_len]) {
+				++header_len;
+			}
+			if (mu_fwrite(header, 1, header_len, file) != header_len) {
+				return MU_FALSE;
+			}
 
-		    return version;
+			// Events, oldest first
+			uint64_m first = (trace->count > MUG_TRACE_EVENT_COUNT) ? (trace->count - MUG_TRACE_EVENT_COUNT) : (0);
+			for (uint64_m e = first; e < trace->count; ++e) {
+				mug_TraceEvent* event = &trace->events[e % MUG_TRACE_EVENT_COUNT];
+				char line[256];
+				size_m len = 0;
+
+				// Name (escaped, and cut short if too long)
+				const char* start = ",\n{\"name\":\"";
+				while (*start) {
+					line[len++] = *start++;
+				}
+				for (size_m c = 0; event->name[c] && len < 160; ++c) {
+					char ch = event->name[c];
+					if (ch == '"' || ch == '\\') {
+						line[len++] = '\\';
+					} else if ((unsigned char)ch < 0x20) {
+						ch = ' ';
+					}
+					line[len++] = ch;
+				}
+
+				// Track, start, and duration
+				const char* mid = (event->gpu)
+					? ("\",\"ph\":\"X\",\"pid\":1,\"tid\":2,\"ts\":")
+					: ("\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":");
+				while (*mid) {
+					line[len++] = *mid++;
+				}
+				len += mug_trace_format_time(&line[len], event->start);
+				const char* dur = ",\"dur\":";
+				while (*dur) {
+					line[len++] = *dur++;
+				}
+				len += mug_trace_format_time(&line[len], event->dur);
+				line[len++] = '}';
+
+				if (mu_fwrite(line, 1, len, file) != len) {
+					return MU_FALSE;
+				}
+			}
+
+			return mu_fwrite("\n]}\n", 1, 4, file) == 4;
 		}
 
+	/* GPU memory */
+
+		// Struct for the GPU memory held by a graphic
+		struct mug_Memory {
+			// Current usage and high-water mark
+			mugMemoryReport report;
+			// Threshold (0 if none), and callback called upon crossing it
+			size_m threshold;
+			mugMemoryCallback callback;
+			void* user;
+			// Whether or not the total is over the threshold
+			muBool over;
+			// Whether or not the threshold has been crossed since the callback was last called
+			muBool crossed;
+		};
+		typedef struct mug_Memory mug_Memory;
 
+		// Initializes GPU memory tracking
+		void mug_memory_init(mug_Memory* mem) {
+			mu_memset(mem, 0, sizeof(mug_Memory));
+		}
 
-		void gladLoaderUnloadGL(void) {
-		    if (_glad_GL_loader_handle != NULL) {
-		        glad_close_dlopen_handle(_glad_GL_loader_handle);
-		        _glad_GL_loader_handle = NULL;
-		    }
+		// Notes whether or not the total crossed over the threshold
+		void mug_memory_check(mug_Memory* mem) {
+			if (mem->threshold && mem->report.total > mem->threshold) {
+				if (!mem->over) {
+					mem->over = MU_TRUE;
+					mem->crossed = MU_TRUE;
+				}
+			} else {
+				mem->over = MU_FALSE;
+			}
 		}
 
-		#endif /* GLAD_GL */
+		// Tracks a resource going from holding old_bytes (old_used in use)
+		// to holding bytes (used in use)
+		void mug_memory_change(mug_Memory* mem, mugMemoryUsage* usage, size_m old_bytes, size_m bytes, size_m old_used, size_m used) {
+			usage->bytes = usage->bytes - old_bytes + bytes;
+			usage->used = usage->used - old_used + used;
+			mem->report.total = mem->report.total - old_bytes + bytes;
+			if (mem->report.total > mem->report.peak) {
+				mem->report.peak = mem->report.total;
+			}
+			mug_memory_check(mem);
+		}
 
-		#ifdef __cplusplus
+		// Tracks a resource being created, holding bytes (used in use)
+		void mug_memory_add(mug_Memory* mem, mugMemoryUsage* usage, size_m bytes, size_m used) {
+			++usage->count;
+			mug_memory_change(mem, usage, 0, bytes, 0, used);
 		}
-		#endif
-	//#endif /* GLAD_GL_IMPLEMENTATION */
-	#endif /* MU_SUPPORT_OPENGL */
 
-	// muCOSA implementation
-	#ifndef MUCOSA_IMPLEMENTATION
-		#define MUCOSA_IMPLEMENTATION
-		#ifdef MUCOSA_IMPLEMENTATION
+		// Tracks a resource holding bytes (used in use) being destroyed
+		void mug_memory_remove(mug_Memory* mem, mugMemoryUsage* usage, size_m bytes, size_m used) {
+			--usage->count;
+			mug_memory_change(mem, usage, bytes, 0, used, 0);
+		}
 
-			MU_CPP_EXTERN_START
+		// Calls the threshold callback if the threshold has been crossed
+		// Called at the end of each frame
+		void mug_memory_frame(mug_Memory* mem, muGraphic gfx) {
+			if (!mem->crossed) {
+				return;
+			}
+			mem->crossed = MU_FALSE;
+			if (mem->callback) {
+				mem->callback(gfx, mem->user, &mem->report);
+			}
+		}
 
-			/* Macros */
+	/* Damage tracking */
+
+		// Bounds coordinate used for damage of unknown extent
+		#define MUG_DAMAGE_UNKNOWN 1e30f
+
+		// Struct for tracking which area of a graphic has changed
+		// Areas are stored as min x, min y, max x, max y, in pixels
+		struct mug_Damage {
+			// Whether or not damage is tracked (partial redraw is enabled)
+			muBool enabled;
+			// Area damaged since the last clear, if any
+			float area[4];
+			muBool any;
+			// Area being redrawn in the current frame, if any
+			float frame[4];
+			muBool frame_any;
+			// x- and y-position modifiers of each object type, applied to object bounds
+			float add[MUG_OBJECT_LAST+1][2];
+			float mul[MUG_OBJECT_LAST+1][2];
+		};
+		typedef struct mug_Damage mug_Damage;
 
-				// OS recognition
+		// Initializes damage tracking (disabled)
+		void mug_damage_init(mug_Damage* damage) {
+			mu_memset(damage, 0, sizeof(mug_Damage));
+			for (mugObjectType type = 0; type <= MUG_OBJECT_LAST; ++type) {
+				damage->mul[type][0] = damage->mul[type][1] = 1.f;
+			}
+		}
 
-				#ifndef MUCOSA_MANUAL_OS_SUPPORT
+		// Adds an area to the damage
+		void mug_damage_add(mug_Damage* damage, const float* area) {
+			if (!damage->enabled) {
+				return;
+			}
+			if (!damage->any) {
+				mu_memcpy(damage->area, area, sizeof(damage->area));
+				damage->any = MU_TRUE;
+				return;
+			}
+			if (area[0] < damage->area[0]) damage->area[0] = area[0];
+			if (area[1] < damage->area[1]) damage->area[1] = area[1];
+			if (area[2] > damage->area[2]) damage->area[2] = area[2];
+			if (area[3] > damage->area[3]) damage->area[3] = area[3];
+		}
 
-					// Win32
-					#ifdef MU_WIN32
-						#define MUCOSA_WIN32
-						#define MUCOSA_WIN32_CALL(...) __VA_ARGS__
-					#else
-						#define MUCOSA_WIN32_CALL(...)
-					#endif
+		// Damages the entire graphic
+		void mug_damage_full(mug_Damage* damage) {
+			const float full[4] = { -MUG_DAMAGE_UNKNOWN, -MUG_DAMAGE_UNKNOWN, MUG_DAMAGE_UNKNOWN, MUG_DAMAGE_UNKNOWN };
+			mug_damage_add(damage, full);
+		}
 
-				#endif /* MUCOSA_MANUAL_OS_SUPPORT */
+		// Adds the bounds of an object of a given type to the damage, applying its position modifiers
+		// Bounds with min > max are empty and ignored
+		void mug_damage_object(mug_Damage* damage, mugObjectType type, const float* bounds) {
+			if (bounds[0] > bounds[2] || bounds[1] > bounds[3]) {
+				return;
+			}
+			float area[4];
+			for (uint32_m i = 0; i < 2; ++i) {
+				float a = bounds[i] * damage->mul[type][i] + damage->add[type][i];
+				float b = bounds[i+2] * damage->mul[type][i] + damage->add[type][i];
+				area[i] = (a < b) ? (a) : (b);
+				area[i+2] = (a < b) ? (b) : (a);
+			}
+			mug_damage_add(damage, area);
+		}
 
-				// Graphics API support
+		// Starts redrawing a frame, which covers everything damaged so far
+		void mug_damage_begin_frame(mug_Damage* damage) {
+			mu_memcpy(damage->frame, damage->area, sizeof(damage->frame));
+			damage->frame_any = damage->any;
+			damage->any = MU_FALSE;
+		}
 
-				#ifdef MU_SUPPORT_OPENGL
-					#define MUCOSA_OPENGL_CALL(...) __VA_ARGS__
-				#else
-					#define MUCOSA_OPENGL_CALL(...)
-				#endif
+		// Converts the area being redrawn into a pixel rectangle
+		// (x, y from the bottom-left, width, height) within the given dimensions
+		void mug_damage_frame_rect(mug_Damage* damage, uint32_m* dim, int32_m* rect) {
+			if (!damage->frame_any) {
+				rect[0] = rect[1] = rect[2] = rect[3] = 0;
+				return;
+			}
+			float b[4];
+			for (uint32_m i = 0; i < 4; ++i) {
+				float max = (float)dim[i % 2];
+				b[i] = (damage->frame[i] < 0.f) ? (0.f) : ((damage->frame[i] > max) ? (max) : (damage->frame[i]));
+			}
+			// (Rounded outwards; values are non-negative, so casting floors them)
+			int32_m x0 = (int32_m)b[0], x1 = (int32_m)b[2];
+			int32_m y0 = (int32_m)b[1], y1 = (int32_m)b[3];
+			x1 += ((float)x1 < b[2]);
+			y1 += ((float)y1 < b[3]);
+			rect[0] = x0;
+			rect[1] = (int32_m)dim[1] - y1;
+			rect[2] = (x1 > x0) ? (x1 - x0) : (0);
+			rect[3] = (y1 > y0) ? (y1 - y0) : (0);
+		}
 
-			/* Win32 */
+	/* Inner graphic logic */
 
-			#ifdef MUCOSA_WIN32
+		// This section handles all API-specific functionality
+		// so that rendering sections are coded in a completely
+		// API-less manner.
 
-				// For all of the stuff that can't be included directly (CURSE YOU BILL)
-				#include <windows.h>
+		// Union representing a graphic's parent
+		union mug_GraphicParent {
+			// muCOSA window
+			muWindow cosa_win;
+		};
+		typedef union mug_GraphicParent mug_GraphicParent;
 
-				/* Useful functions */
+		// Macro used to identify graphic parent type
+		typedef uint16_m mug_GraphicParentType;
+		#define MUG_GRAPHIC_PARENT_MUWIN 1 // (muWindow)
+
+		// Union representing a graphic's GL implementation
+		#ifdef MU_SUPPORT_OPENGL
+			union mug_GraphicGL {
+				// muCOSA OpenGL context
+				muGLContext cosa_gl;
+			};
+			typedef union mug_GraphicGL mug_GraphicGL;
+		#endif
+
+		// Struct representing a graphic
+		struct mug_Graphic {
+			// The context used by the graphic
+			mugContext* context;
+			// Graphic system
+			muGraphicSystem system;
+			// Inner-API data
+			void* p;
+			// Parent type
+			mug_GraphicParentType parent_type;
+			// Parent
+			mug_GraphicParent parent;
+
+			// OpenGL context
+			#ifdef MU_SUPPORT_OPENGL
+				mug_GraphicGL gl;
+			#endif
+
+			// Frame pacer
+			mug_Pacer pacer;
+			// Present mode in effect
+			mugPresentMode present_mode;
+			// Maximum amount of frames in flight (0 if unbounded)
+			uint32_m frames_in_flight;
+			// Whether or not anything has changed since the last present
+			muBool redraw;
+			// Raised to wake the graphic from waiting while idle
+			mug_Signal wake;
+			// Damage tracking for partial redraw
+			mug_Damage damage;
+			// Draw statistics
+			mug_Stats stats;
+			// GPU zones
+			mug_GPUZones zones;
+			// Trace
+			mug_Trace trace;
+			// GPU memory
+			mug_Memory memory;
+
+			// Latest dimensions retrieved
+			uint32_m dim[2];
+
+			// Frame arena; reset every frame
+			mug_Arena arena;
+			// Object type of the pending immediate batch (0 if none)
+			mugObjectType batch_type;
+			// Texture of the pending immediate batch
+			mugTexture batch_tex;
+			// Amount of objects in the pending immediate batch
+			uint32_m batch_count;
+			// Arena offset of the pending immediate batch's objects
+			size_m batch_offset;
+
+			// Asynchronous loader (0 until first used)
+			struct mug_Loader* loader;
+			// Image decoder for asynchronous loads
+			mugImageDecoder decoder;
+			void* decoder_user;
+		};
+		typedef struct mug_Graphic mug_Graphic;
+
+		// Create graphic via window
+		mugResult mugGraphic_window_create(mugContext* context, muWindowInfo* info, mug_Graphic* gfx, muGraphicSystem system) {
+			// Create window
+			muCOSAResult cosa_res = MUCOSA_SUCCESS;
+			gfx->parent_type = MUG_GRAPHIC_PARENT_MUWIN;
+			gfx->parent.cosa_win = muCOSA_window_create(&context->cosa, &cosa_res, info);
+			if (muCOSA_result_is_fatal(cosa_res)) {
+				return muCOSA_to_mug_result(cosa_res);
+			}
+
+			// Set generic parameters
+			gfx->context = context;
+			gfx->system = system;
+			mug_pacer_init(&gfx->pacer, muCOSA_fixed_time_get(&context->cosa));
+			gfx->present_mode = MUG_PRESENT_IMMEDIATE;
+			gfx->frames_in_flight = (MUG_FRAMES_IN_FLIGHT > MUG_MAX_FRAMES_IN_FLIGHT) ? (MUG_MAX_FRAMES_IN_FLIGHT) : (MUG_FRAMES_IN_FLIGHT);
+			gfx->dim[0] = info->width;
+			gfx->dim[1] = info->height;
+			gfx->redraw = MU_TRUE;
+			mug_signal_init(&gfx->wake);
+			mug_damage_init(&gfx->damage);
+			mug_stats_init(&gfx->stats, context);
+			mug_gpu_zones_init(&gfx->zones);
+			mug_trace_init(&gfx->trace, context);
+			mug_memory_init(&gfx->memory);
+
+			// Set immediate drawing parameters
+			mu_memset(&gfx->arena, 0, sizeof(gfx->arena));
+			gfx->batch_type = 0;
+			gfx->batch_tex = 0;
+			gfx->batch_count = 0;
+			gfx->batch_offset = 0;
+
+			// Set asynchronous loading parameters
+			gfx->loader = 0;
+			gfx->decoder = 0;
+			gfx->decoder_user = 0;
 
-					// Hinstance retriever (thank you Raymond Chen)
-					EXTERN_C IMAGE_DOS_HEADER __ImageBase;
-					HINSTANCE muCOSAW32_get_hinstance(void) {
-						return ((HINSTANCE)&__ImageBase);
-					}
+			return muCOSA_to_mug_result(cosa_res);
+		}
 
-					// UTF-8 -> wchar_t (UTF-16)
-					wchar_t* muCOSAW32_utf8_to_wchar(char* str) {
-						// Get length needed for conversion
-						// Note: we can use -1 here, since it's expected for it to be null-terminated
-						int len = MultiByteToWideChar(CP_UTF8, 0, str, -1, NULL, 0);
-						if (len == 0) {
-							return 0;
-						}
+		// Destroys graphic based on parent
+		// Note: does not free internally stored contents
+		void mugGraphic_destroy(mug_Graphic* gfx) {
+			// Find out parent type
+			switch (gfx->parent_type) {
+				// muWindow
+				case MUG_GRAPHIC_PARENT_MUWIN: {
+					muCOSA_window_destroy(&gfx->context->cosa, gfx->parent.cosa_win);
+				} break;
+			}
 
-						// Allocate data
-						wchar_t* wstr = (wchar_t*)mu_malloc(len * sizeof(wchar_t));
-						if (wstr == 0) {
-							return 0;
-						}
+			mug_signal_term(&gfx->wake);
+		}
 
-						// Perform conversion
-						if (MultiByteToWideChar(CP_UTF8, 0, str, -1, (LPWSTR)wstr, len) == 0) {
-							mu_free(wstr);
-							return 0;
-						}
+		// Retrieves the dimensions of a graphic; stored in gfx->dim
+		void mugGraphic_dim(mug_Graphic* gfx) {
+			// Retrieve dimensions based on parent type
+			switch (gfx->parent_type) {
+				case MUG_GRAPHIC_PARENT_MUWIN: {
+					muCOSA_window_get(&gfx->context->cosa, 0, gfx->parent.cosa_win, MU_WINDOW_DIMENSIONS, gfx->dim);
+				} break;
+			}
+		}
 
-						// Return converted data
-						return wstr;
-					}
+		// Returns whether or not the graphic still exists
+		muBool mugGraphic_exists(mug_Graphic* gfx) {
+			// Find out parent type
+			switch (gfx->parent_type) {
+				default: return MU_FALSE; break;
 
-					// wchar_t (UTF-16) -> UTF-8
-					uint8_m* muCOSAW32_wchar_to_utf8(wchar_t* wstr) {
-						// Get length needed
-						int len = WideCharToMultiByte(CP_UTF8, 0, wstr, -1, NULL, 0, NULL, NULL);
-						if (!len) {
-							return 0;
-						}
+				// muWindow
+				case MUG_GRAPHIC_PARENT_MUWIN: {
+					return !muCOSA_window_get_closed(&gfx->context->cosa, 0, gfx->parent.cosa_win);
+				} break;
+			}
+		}
 
-						// Allocate data needed for conversion
-						uint8_m* str = (uint8_m*)mu_malloc(len);
-						if (!str) {
-							return 0;
-						}
+		// Updates the graphic's parent
+		mugResult mugGraphic_update(mug_Graphic* gfx) {
+			// Find out parent type
+			switch (gfx->parent_type) {
+				default: return 0; break;
 
-						// Perform conversion
-						if (!WideCharToMultiByte(CP_UTF8, 0, wstr, -1, (LPSTR)str, len, NULL, NULL)) {
-							mu_free(str);
-							return 0;
-						}
+				case MUG_GRAPHIC_PARENT_MUWIN: {
+					// Update window
+					mugResult res = MUG_SUCCESS;
+					muCOSA_window_update(&gfx->context->cosa, &res, gfx->parent.cosa_win);
 
-						return str;
+					// Needs redraw if resized
+					uint32_m dim[2] = { gfx->dim[0], gfx->dim[1] };
+					muCOSA_window_get(&gfx->context->cosa, 0, gfx->parent.cosa_win, MU_WINDOW_DIMENSIONS, dim);
+					if (dim[0] != gfx->dim[0] || dim[1] != gfx->dim[1]) {
+						gfx->redraw = MU_TRUE;
 					}
+					return res;
+				} break;
+			}
+		}
 
-					// Win32 virtual key code to muCOSA key code
-					muKeyboardKey muCOSAW32_VK_to_muCOSA(WPARAM vk) {
-						switch (vk) {
-							default: return MU_KEYBOARD_UNKNOWN; break;
-							case VK_BACK: return MU_KEYBOARD_BACKSPACE; break;
-							case VK_TAB: return MU_KEYBOARD_TAB; break;
-							case VK_CLEAR: return MU_KEYBOARD_CLEAR; break;
-							case VK_RETURN: return MU_KEYBOARD_RETURN; break;
-							case VK_PAUSE: return MU_KEYBOARD_PAUSE; break;
-							case VK_ESCAPE: return MU_KEYBOARD_ESCAPE; break;
-							case VK_MODECHANGE: return MU_KEYBOARD_MODECHANGE; break;
-							case VK_SPACE: return MU_KEYBOARD_SPACE; break;
-							case VK_PRIOR: return MU_KEYBOARD_PRIOR; break;
-							case VK_NEXT: return MU_KEYBOARD_NEXT; break;
-							case VK_END: return MU_KEYBOARD_END; break;
-							case VK_HOME: return MU_KEYBOARD_HOME; break;
-							case VK_LEFT: return MU_KEYBOARD_LEFT; break;
-							case VK_UP: return MU_KEYBOARD_UP; break;
-							case VK_RIGHT: return MU_KEYBOARD_RIGHT; break;
-							case VK_DOWN: return MU_KEYBOARD_DOWN; break;
-							case VK_SELECT: return MU_KEYBOARD_SELECT; break;
-							case VK_PRINT: return MU_KEYBOARD_PRINT; break;
-							case VK_EXECUTE: return MU_KEYBOARD_EXECUTE; break;
-							case VK_INSERT: return MU_KEYBOARD_INSERT; break;
-							case VK_DELETE: return MU_KEYBOARD_DELETE; break;
-							case VK_HELP: return MU_KEYBOARD_HELP; break;
-							case 0x30: return MU_KEYBOARD_0; break;
-							case 0x31: return MU_KEYBOARD_1; break;
-							case 0x32: return MU_KEYBOARD_2; break;
-							case 0x33: return MU_KEYBOARD_3; break;
-							case 0x34: return MU_KEYBOARD_4; break;
-							case 0x35: return MU_KEYBOARD_5; break;
-							case 0x36: return MU_KEYBOARD_6; break;
-							case 0x37: return MU_KEYBOARD_7; break;
-							case 0x38: return MU_KEYBOARD_8; break;
-							case 0x39: return MU_KEYBOARD_9; break;
-							case 0x41: return MU_KEYBOARD_A; break;
-							case 0x42: return MU_KEYBOARD_B; break;
-							case 0x43: return MU_KEYBOARD_C; break;
-							case 0x44: return MU_KEYBOARD_D; break;
-							case 0x45: return MU_KEYBOARD_E; break;
-							case 0x46: return MU_KEYBOARD_F; break;
-							case 0x47: return MU_KEYBOARD_G; break;
-							case 0x48: return MU_KEYBOARD_H; break;
-							case 0x49: return MU_KEYBOARD_I; break;
-							case 0x4A: return MU_KEYBOARD_J; break;
-							case 0x4B: return MU_KEYBOARD_K; break;
-							case 0x4C: return MU_KEYBOARD_L; break;
-							case 0x4D: return MU_KEYBOARD_M; break;
-							case 0x4E: return MU_KEYBOARD_N; break;
-							case 0x4F: return MU_KEYBOARD_O; break;
-							case 0x50: return MU_KEYBOARD_P; break;
-							case 0x51: return MU_KEYBOARD_Q; break;
-							case 0x52: return MU_KEYBOARD_R; break;
-							case 0x53: return MU_KEYBOARD_S; break;
-							case 0x54: return MU_KEYBOARD_T; break;
-							case 0x55: return MU_KEYBOARD_U; break;
-							case 0x56: return MU_KEYBOARD_V; break;
-							case 0x57: return MU_KEYBOARD_W; break;
-							case 0x58: return MU_KEYBOARD_X; break;
-							case 0x59: return MU_KEYBOARD_Y; break;
-							case 0x5A: return MU_KEYBOARD_Z; break;
-							case VK_LWIN: return MU_KEYBOARD_LEFT_WINDOWS; break;
-							case VK_RWIN: return MU_KEYBOARD_RIGHT_WINDOWS; break;
-							case VK_NUMPAD0: return MU_KEYBOARD_NUMPAD_0; break;
-							case VK_NUMPAD1: return MU_KEYBOARD_NUMPAD_1; break;
-							case VK_NUMPAD2: return MU_KEYBOARD_NUMPAD_2; break;
-							case VK_NUMPAD3: return MU_KEYBOARD_NUMPAD_3; break;
-							case VK_NUMPAD4: return MU_KEYBOARD_NUMPAD_4; break;
-							case VK_NUMPAD5: return MU_KEYBOARD_NUMPAD_5; break;
-							case VK_NUMPAD6: return MU_KEYBOARD_NUMPAD_6; break;
-							case VK_NUMPAD7: return MU_KEYBOARD_NUMPAD_7; break;
-							case VK_NUMPAD8: return MU_KEYBOARD_NUMPAD_8; break;
-							case VK_NUMPAD9: return MU_KEYBOARD_NUMPAD_9; break;
-							case VK_MULTIPLY: return MU_KEYBOARD_MULTIPLY; break;
-							case VK_ADD: return MU_KEYBOARD_ADD; break;
-							case VK_SEPARATOR: return MU_KEYBOARD_SEPARATOR; break;
-							case VK_SUBTRACT: return MU_KEYBOARD_SUBTRACT; break;
-							case VK_DECIMAL: return MU_KEYBOARD_DECIMAL; break;
-							case VK_DIVIDE: return MU_KEYBOARD_DIVIDE; break;
-							case VK_F1: return MU_KEYBOARD_F1; break;
-							case VK_F2: return MU_KEYBOARD_F2; break;
-							case VK_F3: return MU_KEYBOARD_F3; break;
-							case VK_F4: return MU_KEYBOARD_F4; break;
-							case VK_F5: return MU_KEYBOARD_F5; break;
-							case VK_F6: return MU_KEYBOARD_F6; break;
-							case VK_F7: return MU_KEYBOARD_F7; break;
-							case VK_F8: return MU_KEYBOARD_F8; break;
-							case VK_F9: return MU_KEYBOARD_F9; break;
-							case VK_F10: return MU_KEYBOARD_F10; break;
-							case VK_F11: return MU_KEYBOARD_F11; break;
-							case VK_F12: return MU_KEYBOARD_F12; break;
-							case VK_F13: return MU_KEYBOARD_F13; break;
-							case VK_F14: return MU_KEYBOARD_F14; break;
-							case VK_F15: return MU_KEYBOARD_F15; break;
-							case VK_F16: return MU_KEYBOARD_F16; break;
-							case VK_F17: return MU_KEYBOARD_F17; break;
-							case VK_F18: return MU_KEYBOARD_F18; break;
-							case VK_F19: return MU_KEYBOARD_F19; break;
-							case VK_F20: return MU_KEYBOARD_F20; break;
-							case VK_F21: return MU_KEYBOARD_F21; break;
-							case VK_F22: return MU_KEYBOARD_F22; break;
-							case VK_F23: return MU_KEYBOARD_F23; break;
-							case VK_F24: return MU_KEYBOARD_F24; break;
-							case VK_NUMLOCK: return MU_KEYBOARD_NUMLOCK; break;
-							case VK_SCROLL: return MU_KEYBOARD_SCROLL; break;
-							case VK_LSHIFT: return MU_KEYBOARD_LEFT_SHIFT; break;
-							case VK_RSHIFT: return MU_KEYBOARD_RIGHT_SHIFT; break;
-							case VK_LCONTROL: return MU_KEYBOARD_LEFT_CONTROL; break;
-							case VK_RCONTROL: return MU_KEYBOARD_RIGHT_CONTROL; break;
-							case VK_LMENU: return MU_KEYBOARD_LEFT_MENU; break;
-							case VK_RMENU: return MU_KEYBOARD_RIGHT_MENU; break;
-							case VK_ATTN: return MU_KEYBOARD_ATTN; break;
-							case VK_CRSEL: return MU_KEYBOARD_CRSEL; break;
-							case VK_EXSEL: return MU_KEYBOARD_EXSEL; break;
-							case VK_EREOF: return MU_KEYBOARD_EREOF; break;
-							case VK_PLAY: return MU_KEYBOARD_PLAY; break;
-							case VK_PA1: return MU_KEYBOARD_PA1; break;
-						}
-					}
+		// Waits until the graphic's parent receives an event, the graphic is woken,
+		// or timeout (in seconds; negative for none) passes
+		void mugGraphic_wait(mug_Graphic* gfx, double timeout) {
+			// Find out parent type
+			switch (gfx->parent_type) {
+				default: break;
 
-					// muCOSA cursor style to Win32 cursor
-					void* muCOSAW32_muCOSA_cursor_to_W32(muCursorStyle style) {
-						switch (style) {
-							default: return IDC_ARROW; break;
-							case MU_CURSOR_ARROW: return IDC_ARROW; break;
-							case MU_CURSOR_IBEAM: return IDC_IBEAM; break;
-							case MU_CURSOR_WAIT: return IDC_WAIT; break;
-							case MU_CURSOR_WAIT_ARROW: return IDC_APPSTARTING; break;
-							case MU_CURSOR_CROSSHAIR: return IDC_CROSS; break;
-							case MU_CURSOR_HAND: return IDC_HAND; break;
-							case MU_CURSOR_SIZE_LR: return IDC_SIZEWE; break;
-							case MU_CURSOR_SIZE_TB: return IDC_SIZENS; break;
-							case MU_CURSOR_SIZE_TL_BR: return IDC_SIZENWSE; break;
-							case MU_CURSOR_SIZE_TR_BL: return IDC_SIZENESW; break;
-							case MU_CURSOR_SIZE_ALL: return IDC_SIZEALL; break;
-							case MU_CURSOR_NO: return IDC_NO; break;
-						}
+				case MUG_GRAPHIC_PARENT_MUWIN: {
+					// Win32 window messages can be waited on along with the wake event
+					#ifdef MU_WIN32
+					if (muCOSA_context_get_window_system(&gfx->context->cosa) == MU_WINDOW_WIN32) {
+						DWORD ms = (timeout < 0.0) ? (INFINITE) : ((DWORD)(timeout * 1000.0));
+						DWORD count = (gfx->wake) ? (1) : (0);
+						MsgWaitForMultipleObjectsEx(count, &gfx->wake, ms, QS_ALLINPUT, MWMO_INPUTAVAILABLE);
+						return;
 					}
+					#endif
+				} break;
+			}
 
-					// muCOSA keystate to Win32
-					int muCOSAW32_keystate_to_W32(muKeyboardState state) {
-						switch (state) {
-							default: return VK_NONAME; break;
-							case MU_KEYSTATE_CAPS_LOCK: return VK_CAPITAL; break;
-							case MU_KEYSTATE_SCROLL_LOCK: return VK_SCROLL; break;
-							case MU_KEYSTATE_NUM_LOCK: return VK_NUMLOCK; break;
-						}
-					}
+			// Otherwise, only wakeups can be waited on
+			mug_signal_wait(&gfx->wake, timeout);
+		}
 
-				/* OpenGL */
+		// Handles OpenGL binding
+		#ifdef MU_SUPPORT_OPENGL
 
-				#ifdef MU_SUPPORT_OPENGL
+			// Creates OpenGL context
+			mugResult mugGraphicGL_create(mug_Graphic* gfx) {
+				// Find out parent type
+				switch (gfx->parent_type) {
+					// ??
+					default: return 1; break;
 
-					/* Inclusion and common definition */
+					// muWindow
+					case MUG_GRAPHIC_PARENT_MUWIN: {
+						// Create OpenGL context
+						muCOSAResult cosa_res = MUCOSA_SUCCESS;
+						gfx->gl.cosa_gl = muCOSA_gl_context_create(
+							&gfx->context->cosa, &cosa_res, gfx->parent.cosa_win, MU_OPENGL_3_3_CORE
+						);
 
-						// Common OpenGL definitions
-						#ifndef MUCOSA_NO_INCLUDE_OPENGL
-							// Only include if "glClearColor" isn't defined; this is to avoid
-							// accidental double definition in many circumstances.
-							#ifndef glClearColor
-								#include <gl/gl.h>
-								#include <gl/glu.h>
-							#endif
-						#endif
+						// Return result
+						return muCOSA_to_mug_result(cosa_res);
+					} break;
+				}
+			}
 
-						// Device context -> valid OpenGL context
-						#include <wingdi.h>
+			// Destroys OpenGL context
+			void mugGraphicGL_destroy(mug_Graphic* gfx) {
+				// Find out parent type
+				switch (gfx->parent_type) {
+					// muWindow
+					case MUG_GRAPHIC_PARENT_MUWIN: {
+						muCOSA_gl_context_destroy(&gfx->context->cosa, gfx->parent.cosa_win, gfx->gl.cosa_gl);
+					} break;
+				}
+			}
 
-						// Typedefs for functions we need
-						// - wglCreateContextAttribs; needed for specifying exact version when creating context
-						typedef HGLRC WINAPI muCOSAW32_wglCreateContextAttribsARB_type(HDC hdc, HGLRC hShareContext, const int* attribList);
-						// - wglChoosePixelFormat; needed for choosing a more thorough pixel format when creating context
-						typedef BOOL WINAPI muCOSAW32_wglChoosePixelFormatARB_type(HDC hdc, const int* piAttribIList, const FLOAT* pfAttribFList, UINT uMaxFormats, int* piFormats, UINT* nNumFormats);
-						// - wglSwapInterval; not needed in context creation, but used for swap interval later
-						typedef BOOL WINAPI muCOSAW32_wglSwapIntervalEXT_type(int interval);
+			// Binds OpenGL context
+			void mugGraphicGL_bind(mug_Graphic* gfx) {
+				MUG_TRACE_BEGIN(&gfx->trace, bind_trace)
+				// Find out parent type
+				switch (gfx->parent_type) {
+					// muWindow
+					case MUG_GRAPHIC_PARENT_MUWIN: {
+						muCOSA_gl_bind(&gfx->context->cosa, 0, gfx->parent.cosa_win, gfx->gl.cosa_gl);
+					} break;
+				}
+				MUG_STAT(&gfx->stats, context_binds, 1)
+				MUG_TRACE_END(&gfx->trace, "context bind", bind_trace)
+			}
 
-						// Struct to hold WGL functions needed for context creation
-						struct muCOSAW32_WGL {
-							muCOSAW32_wglCreateContextAttribsARB_type* CreateContextAttribs;
-							muCOSAW32_wglChoosePixelFormatARB_type* ChoosePixelFormat;
-							muCOSAW32_wglSwapIntervalEXT_type* SwapInterval;
-						};
-						typedef struct muCOSAW32_WGL muCOSAW32_WGL;
+			// Sets the swap interval of OpenGL context; returns whether or not it succeeded
+			muBool mugGraphicGL_swap_interval(mug_Graphic* gfx, int interval) {
+				// Find out parent type
+				switch (gfx->parent_type) {
+					default: return MU_FALSE; break;
 
-					/* WGL tokens */
+					// muWindow
+					case MUG_GRAPHIC_PARENT_MUWIN: {
+						muCOSAResult res = MUCOSA_SUCCESS;
+						muBool set = muCOSA_gl_swap_interval(&gfx->context->cosa, &res, interval);
+						return set && !muCOSA_result_is_fatal(res);
+					} break;
+				}
+			}
 
-						// https://registry.khronos.org/OpenGL/extensions/ARB/WGL_ARB_create_context.txt
+			// Swap buffers of OpenGL context
+			mugResult mugGraphicGL_swap_buffers(mug_Graphic* gfx) {
+				// Find out parent type
+				switch (gfx->parent_type) {
+					default: return 0; break;
 
-						#define MUCOSAWGL_CONTEXT_MAJOR_VERSION_ARB             0x2091
-						#define MUCOSAWGL_CONTEXT_MINOR_VERSION_ARB             0x2092
-						#define MUCOSAWGL_CONTEXT_LAYER_PLANE_ARB               0x2093
-						#define MUCOSAWGL_CONTEXT_FLAGS_ARB                     0x2094
-						#define MUCOSAWGL_CONTEXT_PROFILE_MASK_ARB              0x9126
+					// muWindow
+					case MUG_GRAPHIC_PARENT_MUWIN: {
+						// Swap buffers
+						mugResult res = MUG_SUCCESS;
+						muCOSA_gl_swap_buffers(&gfx->context->cosa, &res, gfx->parent.cosa_win);
+						return res;
+					} break;
+				}
+			}
 
-						#define MUCOSAWGL_CONTEXT_DEBUG_BIT_ARB                 0x0001
-						#define MUCOSAWGL_CONTEXT_FORWARD_COMPATIBLE_BIT_ARB    0x0002
+		#endif /* MU_SUPPORT_OPENGL */
 
-						#define MUCOSAWGL_CONTEXT_CORE_PROFILE_BIT_ARB          0x00000001
-						#define MUCOSAWGL_CONTEXT_COMPATIBILITY_PROFILE_BIT_ARB 0x00000002
+	/* Useful functions */
 
-						#define MUCOSAWGL_ERROR_INVALID_VERSION_ARB                 0x2095
-						#define MUCOSAWGL_ERROR_INVALID_PROFILE_ARB                 0x2096
+		/* Math */
 
-						// https://registry.khronos.org/OpenGL/extensions/ARB/WGL_ARB_pixel_format.txt
+			// Rotates a given point (rpx, rpy) around a center (cpx, cpy)
+			// Uses srot and crot as sin and cos of rotation
+			// Fills in result in pos[0] (x) and pos[1] (y)
+			void mugMath_rot_point_point(
+				float rpx, float rpy, float cpx, float cpy,
+				float srot, float crot,
+				float* pos
+			) {
+				float ox = rpx-cpx, oy = rpy-cpy;
+				pos[0] = (ox*crot - oy*srot) + cpx;
+				pos[1] = (ox*srot + oy*crot) + cpy;
+			}
 
-						#define MUCOSAWGL_NUMBER_PIXEL_FORMATS_ARB    0x2000
-						#define MUCOSAWGL_DRAW_TO_WINDOW_ARB          0x2001
-						#define MUCOSAWGL_DRAW_TO_BITMAP_ARB          0x2002
-						#define MUCOSAWGL_ACCELERATION_ARB            0x2003
-						#define MUCOSAWGL_NEED_PALETTE_ARB            0x2004
-						#define MUCOSAWGL_NEED_SYSTEM_PALETTE_ARB     0x2005
-						#define MUCOSAWGL_SWAP_LAYER_BUFFERS_ARB      0x2006
-						#define MUCOSAWGL_SWAP_METHOD_ARB             0x2007
-						#define MUCOSAWGL_NUMBER_OVERLAYS_ARB         0x2008
-						#define MUCOSAWGL_NUMBER_UNDERLAYS_ARB        0x2009
-						#define MUCOSAWGL_TRANSPARENT_ARB             0x200A
-						#define MUCOSAWGL_TRANSPARENT_RED_VALUE_ARB   0x2037
-						#define MUCOSAWGL_TRANSPARENT_GREEN_VALUE_ARB 0x2038
-						#define MUCOSAWGL_TRANSPARENT_BLUE_VALUE_ARB  0x2039
-						#define MUCOSAWGL_TRANSPARENT_ALPHA_VALUE_ARB 0x203A
-						#define MUCOSAWGL_TRANSPARENT_INDEX_VALUE_ARB 0x203B
-						#define MUCOSAWGL_SHARE_DEPTH_ARB             0x200C
-						#define MUCOSAWGL_SHARE_STENCIL_ARB           0x200D
-						#define MUCOSAWGL_SHARE_ACCUM_ARB             0x200E
-						#define MUCOSAWGL_SUPPORT_GDI_ARB             0x200F
-						#define MUCOSAWGL_SUPPORT_OPENGL_ARB          0x2010
-						#define MUCOSAWGL_DOUBLE_BUFFER_ARB           0x2011
-						#define MUCOSAWGL_STEREO_ARB                  0x2012
-						#define MUCOSAWGL_PIXEL_TYPE_ARB              0x2013
-						#define MUCOSAWGL_COLOR_BITS_ARB              0x2014
-						#define MUCOSAWGL_RED_BITS_ARB                0x2015
-						#define MUCOSAWGL_RED_SHIFT_ARB               0x2016
-						#define MUCOSAWGL_GREEN_BITS_ARB              0x2017
-						#define MUCOSAWGL_GREEN_SHIFT_ARB             0x2018
-						#define MUCOSAWGL_BLUE_BITS_ARB               0x2019
-						#define MUCOSAWGL_BLUE_SHIFT_ARB              0x201A
-						#define MUCOSAWGL_ALPHA_BITS_ARB              0x201B
-						#define MUCOSAWGL_ALPHA_SHIFT_ARB             0x201C
-						#define MUCOSAWGL_ACCUM_BITS_ARB              0x201D
-						#define MUCOSAWGL_ACCUM_RED_BITS_ARB          0x201E
-						#define MUCOSAWGL_ACCUM_GREEN_BITS_ARB        0x201F
-						#define MUCOSAWGL_ACCUM_BLUE_BITS_ARB         0x2020
-						#define MUCOSAWGL_ACCUM_ALPHA_BITS_ARB        0x2021
-						#define MUCOSAWGL_DEPTH_BITS_ARB              0x2022
-						#define MUCOSAWGL_STENCIL_BITS_ARB            0x2023
-						#define MUCOSAWGL_AUX_BUFFERS_ARB             0x2024
+			// Returns whether or not a point (x, y) is within a convex polygon
+			// The polygon has n points, each stride floats apart, with x and y first
+			muBool mugMath_point_in_polygon(const float* v, uint32_m n, uint32_m stride, float x, float y) {
+				muBool neg = MU_FALSE, pos = MU_FALSE;
+				for (uint32_m i = 0; i < n; ++i) {
+					const float* a = &v[i*stride];
+					const float* b = &v[((i+1)%n)*stride];
+					// Find which side of the edge the point is on
+					float cross = (b[0]-a[0])*(y-a[1]) - (b[1]-a[1])*(x-a[0]);
+					if (cross < 0.f) neg = MU_TRUE;
+					if (cross > 0.f) pos = MU_TRUE;
+					// Outside if on both sides of edges
+					if (neg && pos) {
+						return MU_FALSE;
+					}
+				}
+				return MU_TRUE;
+			}
 
-						#define MUCOSAWGL_NO_ACCELERATION_ARB         0x2025
-						#define MUCOSAWGL_GENERIC_ACCELERATION_ARB    0x2026
-						#define MUCOSAWGL_FULL_ACCELERATION_ARB       0x2027
+			// Returns whether or not a convex polygon overlaps an area (min x, min y, max x, max y)
+			// The polygon has n points, each stride floats apart, with x and y first
+			muBool mugMath_polygon_overlaps_area(const float* v, uint32_m n, uint32_m stride, float* area) {
+				// Check area's axes
+				float b[4] = { v[0], v[1], v[0], v[1] };
+				for (uint32_m i = 1; i < n; ++i) {
+					const float* vi = &v[i*stride];
+					if (vi[0] < b[0]) b[0] = vi[0];
+					if (vi[1] < b[1]) b[1] = vi[1];
+					if (vi[0] > b[2]) b[2] = vi[0];
+					if (vi[1] > b[3]) b[3] = vi[1];
+				}
+				if (b[0] > area[2] || b[2] < area[0] || b[1] > area[3] || b[3] < area[1]) {
+					return MU_FALSE;
+				}
 
-						#define MUCOSAWGL_SWAP_EXCHANGE_ARB           0x2028
-						#define MUCOSAWGL_SWAP_COPY_ARB               0x2029
-						#define MUCOSAWGL_SWAP_UNDEFINED_ARB          0x202A
+				// Check polygon's axes (edge normals)
+				float corners[8] = { area[0], area[1], area[2], area[1], area[2], area[3], area[0], area[3] };
+				uint32_m edges = (n == 2) ? (1) : (n);
+				for (uint32_m i = 0; i < edges; ++i) {
+					const float* e0 = &v[i*stride];
+					const float* e1 = &v[((i+1)%n)*stride];
+					float nx = e0[1]-e1[1], ny = e1[0]-e0[0];
+					// Project polygon
+					float pmin = v[0]*nx + v[1]*ny, pmax = pmin;
+					for (uint32_m j = 1; j < n; ++j) {
+						float d = v[j*stride]*nx + v[j*stride+1]*ny;
+						if (d < pmin) pmin = d;
+						if (d > pmax) pmax = d;
+					}
+					// Project area
+					float amin = corners[0]*nx + corners[1]*ny, amax = amin;
+					for (uint32_m j = 1; j < 4; ++j) {
+						float d = corners[j*2]*nx + corners[j*2+1]*ny;
+						if (d < amin) amin = d;
+						if (d > amax) amax = d;
+					}
+					// Separated if projections don't overlap
+					if (pmin > amax || pmax < amin) {
+						return MU_FALSE;
+					}
+				}
+				return MU_TRUE;
+			}
 
-						#define MUCOSAWGL_TYPE_RGBA_ARB               0x202B
-						#define MUCOSAWGL_TYPE_COLORINDEX_ARB         0x202C
+			// Returns the distance between a point (px, py) and a line segment (a to b)
+			float mugMath_point_segment_distance(float px, float py, float ax, float ay, float bx, float by) {
+				float dx = bx-ax, dy = by-ay;
+				float len = dx*dx + dy*dy;
+				// Find closest point along segment
+				float t = (len > 0.f) ? (((px-ax)*dx + (py-ay)*dy) / len) : (0.f);
+				if (t < 0.f) t = 0.f;
+				if (t > 1.f) t = 1.f;
+				float ox = px - (ax + t*dx), oy = py - (ay + t*dy);
+				return mu_sqrtf(ox*ox + oy*oy);
+			}
 
-						// https://nehe.gamedev.net/tutorial/fullscreen_antialiasing/16008/
+			// Clamps a value between a minimum and maximum
+			float mugMath_clamp(float f, float min, float max) {
+				return (f < min) ? (min) : ((f > max) ? (max) : (f));
+			}
 
-						#define MUCOSAWGL_SAMPLE_BUFFERS_ARB  0x2041
-						#define MUCOSAWGL_SAMPLES_ARB     0x2042
+		/* Textures */
+
+			// Returns the amount of bytes per block of a texture format
+			// (a block being one pixel for uncompressed formats)
+			uint32_m mug_texture_format_size(mugTextureFormat format) {
+				switch (format) {
+					default: return 4; break;
+					case MUG_TEXTURE_U8_R: return 1; break;
+					case MUG_TEXTURE_U8_RGB: return 3; break;
+					case MUG_TEXTURE_U8_RGBA: return 4; break;
+					case MUG_TEXTURE_BC1_RGBA: return 8; break;
+					case MUG_TEXTURE_BC3_RGBA: return 16; break;
+					case MUG_TEXTURE_BC4_R: return 8; break;
+					case MUG_TEXTURE_BC7_RGBA: return 16; break;
+				}
+			}
 
-					/* Functions */
+			// Returns the width and height of a block of a texture format
+			uint32_m mug_texture_format_block(mugTextureFormat format) {
+				switch (format) {
+					default: return 1; break;
+					case MUG_TEXTURE_BC1_RGBA: case MUG_TEXTURE_BC3_RGBA: case MUG_TEXTURE_BC4_R: case MUG_TEXTURE_BC7_RGBA:
+						return 4;
+					break;
+				}
+			}
 
-						// Retrieves OpenGL extensions needed for context creation
-						muCOSAResult muCOSAW32_get_opengl_extensions(muCOSAW32_WGL* wgl) {
-							// Create temp window class
-							WNDCLASSA wclass = MU_ZERO_STRUCT(WNDCLASSA);
-							wclass.style = CS_HREDRAW | CS_VREDRAW | CS_OWNDC;
-							wclass.lpfnWndProc = DefWindowProcA;
-							wclass.hInstance = muCOSAW32_get_hinstance();
-							wclass.lpszClassName = "Dummy WGL window class";
-							if (!RegisterClassA(&wclass)) {
-								return MUCOSA_WIN32_FAILED_REGISTER_DUMMY_WGL_WINDOW_CLASS;
-							}
+		/* Texture compression */
 
-							// Create temp window
-							HWND win = CreateWindowExA(
-								0, wclass.lpszClassName, "Dummy WGL window", 0,
-								CW_USEDEFAULT, CW_USEDEFAULT, CW_USEDEFAULT, CW_USEDEFAULT, 0, 0,
-								wclass.hInstance, 0
-							);
-							if (win == NULL) {
-								UnregisterClassA(wclass.lpszClassName, wclass.hInstance);
-								return MUCOSA_WIN32_FAILED_CREATE_DUMMY_WGL_WINDOW;
-							}
+			// SIMD instructions are only used if the compiler already targets them
+			#ifndef MUG_NO_SIMD
+				#if defined(__SSSE3__) || defined(__AVX__)
+					#define MUG_SSSE3
+					#include <tmmintrin.h>
+				#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+					#define MUG_NEON
+					#include <arm_neon.h>
+				#endif
+			#endif
 
-							// Get device context from this window
-							HDC dc = GetDC(win);
+			// Converts an 8-bit color to 5:6:5
+			uint16_m mugBC_pack565(const muByte* c) {
+				return (uint16_m)((((c[0]*31+127)/255) << 11) | (((c[1]*63+127)/255) << 5) | ((c[2]*31+127)/255));
+			}
 
-							// Use pixel format number 1
-							// This is a HACK and a half, but works
-							int pixel_format = 1;
-							PIXELFORMATDESCRIPTOR format_desc;
-							if (!DescribePixelFormat(dc, pixel_format, sizeof(format_desc), &format_desc)) {
-								ReleaseDC(win, dc);
-								DestroyWindow(win);
-								UnregisterClassA(wclass.lpszClassName, wclass.hInstance);
-								return MUCOSA_WIN32_FAILED_DESCRIBE_DUMMY_WGL_PIXEL_FORMAT;
-							}
+			// Converts a 5:6:5 color to 8-bit
+			void mugBC_unpack565(uint16_m v, muByte* c) {
+				uint32_m r = (v >> 11) & 31, g = (v >> 5) & 63, b = v & 31;
+				c[0] = (muByte)((r << 3) | (r >> 2));
+				c[1] = (muByte)((g << 2) | (g >> 4));
+				c[2] = (muByte)((b << 3) | (b >> 2));
+			}
 
-							// Set pixel format. This doesn't make much sense, this is already definitionally
-							// the pixel format of the device, but it doesn't work if I don't do this, so, :L
-							// Note: this might not be okay, and we may need to specify SOME pixel format,
-							// but I don't know.
-							if (!SetPixelFormat(dc, pixel_format, &format_desc)) {
-								ReleaseDC(win, dc);
-								DestroyWindow(win);
-								UnregisterClassA(wclass.lpszClassName, wclass.hInstance);
-								return MUCOSA_WIN32_FAILED_SET_DUMMY_WGL_PIXEL_FORMAT;
-							}
+			// Writes a little-endian 16-bit value
+			void mugBC_write16(muByte* dst, uint16_m v) {
+				dst[0] = (muByte)(v & 0xFF);
+				dst[1] = (muByte)(v >> 8);
+			}
 
-							// Create dummy context
-							HGLRC context = wglCreateContext(dc);
-							if (!context) {
-								ReleaseDC(win, dc);
-								DestroyWindow(win);
-								UnregisterClassA(wclass.lpszClassName, wclass.hInstance);
-								return MUCOSA_WIN32_FAILED_CREATE_DUMMY_WGL_CONTEXT;
-							}
-							// Bind dummy context
-							if (!wglMakeCurrent(dc, context)) {
-								wglDeleteContext(context);
-								ReleaseDC(win, dc);
-								DestroyWindow(win);
-								UnregisterClassA(wclass.lpszClassName, wclass.hInstance);
-								return MUCOSA_WIN32_FAILED_BIND_DUMMY_WGL_CONTEXT;
-							}
+			// Gathers a 4x4 block of pixels starting at pixel (bx, by),
+			// repeating edge pixels for blocks past the image's bounds
+			void mugBC_fetch(const muByte* src, size_m stride, uint32_m ps, uint32_m w, uint32_m h, uint32_m bx, uint32_m by, muByte* block) {
+				for (uint32_m y = 0; y < 4; ++y) {
+					uint32_m sy = (by+y < h) ? (by+y) : (h-1);
+					for (uint32_m x = 0; x < 4; ++x) {
+						uint32_m sx = (bx+x < w) ? (bx+x) : (w-1);
+						mu_memcpy(&block[(y*4+x)*ps], &src[sy*stride + sx*ps], ps);
+					}
+				}
+			}
 
-							// Find necessary functions
-							PROC wglCreateContextAttribsARB_proc = wglGetProcAddress("wglCreateContextAttribsARB");
-							PROC wglChoosePixelFormatARB_proc    = wglGetProcAddress("wglChoosePixelFormatARB");
-							// Find helpful functions
-							PROC wglSwapIntervalEXT_proc         = wglGetProcAddress("wglSwapIntervalEXT");
+			#if defined(MUG_SSSE3)
+
+				// Finds the color bounds of the visible pixels of 16 RGBA pixels,
+				// returning a bitmask of which pixels are visible
+				// (pixels whose alpha is below 128 are invisible if alpha is true)
+				uint32_m mugBC_bounds(const muByte* px, muBool alpha, muByte* lo, muByte* hi) {
+					__m128i ones = _mm_set1_epi8((char)0xFF);
+					__m128i vlo = ones, vhi = _mm_setzero_si128();
+					uint32_m visible = 0;
+					for (uint32_m i = 0; i < 4; ++i) {
+						__m128i v = _mm_loadu_si128((const __m128i*)&px[i*16]);
+						// Spread the top bit of each alpha value to mask out invisible pixels
+						__m128i vis = (alpha) ? (_mm_srai_epi32(v, 31)) : (ones);
+						visible |= (uint32_m)_mm_movemask_ps(_mm_castsi128_ps(vis)) << (i*4);
+						vlo = _mm_min_epu8(vlo, _mm_or_si128(v, _mm_andnot_si128(vis, ones)));
+						vhi = _mm_max_epu8(vhi, _mm_and_si128(v, vis));
+					}
+					// Combine the 4 pixels of each register
+					vlo = _mm_min_epu8(vlo, _mm_shuffle_epi32(vlo, _MM_SHUFFLE(1, 0, 3, 2)));
+					vlo = _mm_min_epu8(vlo, _mm_shuffle_epi32(vlo, _MM_SHUFFLE(2, 3, 0, 1)));
+					vhi = _mm_max_epu8(vhi, _mm_shuffle_epi32(vhi, _MM_SHUFFLE(1, 0, 3, 2)));
+					vhi = _mm_max_epu8(vhi, _mm_shuffle_epi32(vhi, _MM_SHUFFLE(2, 3, 0, 1)));
+					uint32_m l = (uint32_m)_mm_cvtsi128_si32(vlo), h = (uint32_m)_mm_cvtsi128_si32(vhi);
+					for (uint32_m c = 0; c < 3; ++c) {
+						lo[c] = (muByte)((l >> (c*8)) & 0xFF);
+						hi[c] = (muByte)((h >> (c*8)) & 0xFF);
+					}
+					return visible;
+				}
 
-							// Destroy resources
-							wglMakeCurrent(dc, 0);
-							wglDeleteContext(context);
-							ReleaseDC(win, dc);
-							DestroyWindow(win);
-							UnregisterClassA(wclass.lpszClassName, wclass.hInstance);
+				// Finds the index of the closest of the first colors of a palette
+				// for each visible pixel of 16 RGBA pixels (ties going to the lowest index)
+				void mugBC_nearest(const muByte* px, uint32_m visible, muByte pal[4][3], uint32_m colors, muByte* best) {
+					__m128i zero = _mm_setzero_si128();
+					__m128i rgb = _mm_set1_epi32(0x00FFFFFF);
+					for (uint32_m i = 0; i < 4; ++i) {
+						__m128i v = _mm_and_si128(_mm_loadu_si128((const __m128i*)&px[i*16]), rgb);
+						__m128i best_dist = _mm_set1_epi32(0x7FFFFFFF), best_index = zero;
+						for (uint32_m j = 0; j < colors; ++j) {
+							__m128i p = _mm_set1_epi32((int)(pal[j][0] | (pal[j][1] << 8) | (pal[j][2] << 16)));
+							// Absolute differences, widened to 16 bits
+							__m128i d = _mm_or_si128(_mm_subs_epu8(v, p), _mm_subs_epu8(p, v));
+							__m128i dlo = _mm_unpacklo_epi8(d, zero), dhi = _mm_unpackhi_epi8(d, zero);
+							// Squared distance of each pixel
+							__m128i dist = _mm_hadd_epi32(_mm_madd_epi16(dlo, dlo), _mm_madd_epi16(dhi, dhi));
+							__m128i closer = _mm_cmplt_epi32(dist, best_dist);
+							best_dist = _mm_or_si128(_mm_and_si128(closer, dist), _mm_andnot_si128(closer, best_dist));
+							best_index = _mm_or_si128(_mm_and_si128(closer, _mm_set1_epi32((int)j)), _mm_andnot_si128(closer, best_index));
+						}
+						// Narrow indexes to bytes
+						best_index = _mm_packs_epi32(best_index, best_index);
+						uint32_m b = (uint32_m)_mm_cvtsi128_si32(_mm_packus_epi16(best_index, best_index));
+						for (uint32_m k = 0; k < 4; ++k) {
+							best[i*4+k] = (muByte)((b >> (k*8)) & 0xFF);
+						}
+					}
+				}
 
-							// Detect if any required functions went unfound
-							if (!wglCreateContextAttribsARB_proc) {
-								return MUCOSA_WIN32_FAILED_FIND_WGL_CREATE_CONTEXT_ATTRIBS;
-							}
-							if (!wglChoosePixelFormatARB_proc) {
-								return MUCOSA_WIN32_FAILED_FIND_WGL_CHOOSE_PIXEL_FORMAT;
-							}
+			#elif defined(MUG_NEON)
+
+				// Bit of each lane when gathering a mask of 4 lanes
+				const uint32_m mugBC_lane_bits[4] = { 1, 2, 4, 8 };
+
+				// Finds the color bounds of the visible pixels of 16 RGBA pixels,
+				// returning a bitmask of which pixels are visible
+				// (pixels whose alpha is below 128 are invisible if alpha is true)
+				uint32_m mugBC_bounds(const muByte* px, muBool alpha, muByte* lo, muByte* hi) {
+					uint8x16_t ones = vdupq_n_u8(0xFF);
+					uint8x16_t vlo = ones, vhi = vdupq_n_u8(0);
+					uint32_m visible = 0;
+					for (uint32_m i = 0; i < 4; ++i) {
+						uint8x16_t v = vld1q_u8(&px[i*16]);
+						// Spread the top bit of each alpha value to mask out invisible pixels
+						uint8x16_t vis = (alpha) ? (vreinterpretq_u8_s32(vshrq_n_s32(vreinterpretq_s32_u8(v), 31))) : (ones);
+						vlo = vminq_u8(vlo, vorrq_u8(v, vmvnq_u8(vis)));
+						vhi = vmaxq_u8(vhi, vandq_u8(v, vis));
+						// Gather one bit per pixel
+						uint32x4_t bits = vandq_u32(vreinterpretq_u32_u8(vis), vld1q_u32(mugBC_lane_bits));
+						uint32x2_t sum = vpadd_u32(vget_low_u32(bits), vget_high_u32(bits));
+						visible |= (vget_lane_u32(sum, 0) | vget_lane_u32(sum, 1)) << (i*4);
+					}
+					// Combine the 4 pixels of each register
+					uint8x8_t l = vmin_u8(vget_low_u8(vlo), vget_high_u8(vlo));
+					uint8x8_t h = vmax_u8(vget_low_u8(vhi), vget_high_u8(vhi));
+					l = vmin_u8(l, vreinterpret_u8_u32(vrev64_u32(vreinterpret_u32_u8(l))));
+					h = vmax_u8(h, vreinterpret_u8_u32(vrev64_u32(vreinterpret_u32_u8(h))));
+					for (uint32_m c = 0; c < 3; ++c) {
+						lo[c] = vget_lane_u8(l, 0);
+						hi[c] = vget_lane_u8(h, 0);
+						l = vext_u8(l, l, 1);
+						h = vext_u8(h, h, 1);
+					}
+					return visible;
+				}
 
-							// Copy over functions
-							mu_memcpy(&wgl->CreateContextAttribs, &wglCreateContextAttribsARB_proc, sizeof(PROC));
-							mu_memcpy(&wgl->ChoosePixelFormat,    &wglChoosePixelFormatARB_proc,    sizeof(PROC));
-							mu_memcpy(&wgl->SwapInterval,         &wglSwapIntervalEXT_proc,         sizeof(PROC));
-							return MUCOSA_SUCCESS;
+				// Finds the index of the closest of the first colors of a palette
+				// for each visible pixel of 16 RGBA pixels (ties going to the lowest index)
+				void mugBC_nearest(const muByte* px, uint32_m visible, muByte pal[4][3], uint32_m colors, muByte* best) {
+					uint8x16_t rgb = vreinterpretq_u8_u32(vdupq_n_u32(0x00FFFFFF));
+					for (uint32_m i = 0; i < 4; ++i) {
+						uint8x16_t v = vandq_u8(vld1q_u8(&px[i*16]), rgb);
+						uint32x4_t best_dist = vdupq_n_u32(0xFFFFFFFF), best_index = vdupq_n_u32(0);
+						for (uint32_m j = 0; j < colors; ++j) {
+							uint8x16_t p = vreinterpretq_u8_u32(vdupq_n_u32(pal[j][0] | (pal[j][1] << 8) | (pal[j][2] << 16)));
+							// Squared differences, widened to 16 bits
+							uint8x16_t d = vabdq_u8(v, p);
+							uint16x8_t dlo = vmull_u8(vget_low_u8(d), vget_low_u8(d));
+							uint16x8_t dhi = vmull_u8(vget_high_u8(d), vget_high_u8(d));
+							// Squared distance of each pixel (sums of channel pairs, then of pixel halves)
+							uint32x4_t slo = vpaddlq_u16(dlo), shi = vpaddlq_u16(dhi);
+							uint32x4_t dist = vcombine_u32(
+								vpadd_u32(vget_low_u32(slo), vget_high_u32(slo)),
+								vpadd_u32(vget_low_u32(shi), vget_high_u32(shi))
+							);
+							uint32x4_t closer = vcltq_u32(dist, best_dist);
+							best_dist = vbslq_u32(closer, dist, best_dist);
+							best_index = vbslq_u32(closer, vdupq_n_u32(j), best_index);
 						}
+						uint32_m b[4];
+						vst1q_u32(b, best_index);
+						for (uint32_m k = 0; k < 4; ++k) {
+							best[i*4+k] = (muByte)b[k];
+						}
+					}
+				}
 
-						// Creates an OpenGL context
-						muCOSAResult muCOSAW32_create_opengl_context(HDC dc, int win_pixel_format, muCOSAW32_WGL* wgl, muPixelFormat* format, HGLRC* context, muGraphicsAPI api, muBool* set) {
-							muCOSAResult res = MUCOSA_SUCCESS;
-							// Choose pixel format
-							int pixel_format;
+			#else
 
-							// - If a pixel format is supplied by the user:
-							if (format) {
-								// Set up an attribute field based on pixel format
-								int pixel_format_attributes[] = {
-									MUCOSAWGL_DRAW_TO_WINDOW_ARB, MU_TRUE,
-									MUCOSAWGL_SUPPORT_OPENGL_ARB, MU_TRUE,
-									MUCOSAWGL_DOUBLE_BUFFER_ARB,  MU_TRUE,
-									MUCOSAWGL_SAMPLE_BUFFERS_ARB, MU_TRUE, // (?)
-									MUCOSAWGL_ACCELERATION_ARB,   MUCOSAWGL_FULL_ACCELERATION_ARB, // (?)
-									MUCOSAWGL_PIXEL_TYPE_ARB,     MUCOSAWGL_TYPE_RGBA_ARB, // (?)
-									MUCOSAWGL_RED_BITS_ARB,       format->red_bits,
-									MUCOSAWGL_GREEN_BITS_ARB,     format->green_bits,
-									MUCOSAWGL_BLUE_BITS_ARB,      format->blue_bits,
-									MUCOSAWGL_ALPHA_BITS_ARB,     format->alpha_bits,
-									MUCOSAWGL_DEPTH_BITS_ARB,     format->depth_bits,
-									MUCOSAWGL_STENCIL_BITS_ARB,   format->stencil_bits,
-									MUCOSAWGL_SAMPLES_ARB,        format->samples,
-									0
-								};
-								// Find corresponding format using WGL
-								UINT format_count = 0;
-								// - Does the return value of this indicate error? Can't find documentation
-								wgl->ChoosePixelFormat(dc, pixel_format_attributes, 0, 1, &pixel_format, &format_count);
-								if (!format_count) {
-									res = MUCOSA_WIN32_FAILED_CHOOSE_WGL_PIXEL_FORMAT;
-								}
-							}
+				// Finds the color bounds of the visible pixels of 16 RGBA pixels,
+				// returning a bitmask of which pixels are visible
+				// (pixels whose alpha is below 128 are invisible if alpha is true)
+				uint32_m mugBC_bounds(const muByte* px, muBool alpha, muByte* lo, muByte* hi) {
+					// (Kept locally, as writes through lo and hi could alias px)
+					muByte l[3] = { 255, 255, 255 }, h[3] = { 0, 0, 0 };
+					uint32_m visible = 0;
+					for (uint32_m i = 0; i < 16; ++i) {
+						const muByte* p = &px[i*4];
+						if (alpha && p[3] < 128) {
+							continue;
+						}
+						visible |= 1u << i;
+						for (uint32_m c = 0; c < 3; ++c) {
+							if (p[c] < l[c]) l[c] = p[c];
+							if (p[c] > h[c]) h[c] = p[c];
+						}
+					}
+					mu_memcpy(lo, l, 3);
+					mu_memcpy(hi, h, 3);
+					return visible;
+				}
 
-							// - If a pixel format isn't supplied by the user (or it failed)
-							if ((!format) || (res != MUCOSA_SUCCESS)) {
-								// Get default pixel format from window
-								pixel_format = win_pixel_format;
+				// Finds the index of the closest of the first colors of a palette
+				// for each visible pixel of 16 RGBA pixels (ties going to the lowest index)
+				void mugBC_nearest(const muByte* px, uint32_m visible, muByte pal[4][3], uint32_m colors, muByte* best) {
+					for (uint32_m i = 0; i < 16; ++i) {
+						if (!(visible & (1u << i))) {
+							continue;
+						}
+						const muByte* p = &px[i*4];
+						uint32_m best_dist = 0xFFFFFFFF, best_index = 0;
+						for (uint32_m j = 0; j < colors; ++j) {
+							int32_m dr = (int32_m)p[0]-pal[j][0], dg = (int32_m)p[1]-pal[j][1], db = (int32_m)p[2]-pal[j][2];
+							uint32_m dist = (uint32_m)(dr*dr + dg*dg + db*db);
+							if (dist < best_dist) {
+								best_dist = dist;
+								best_index = j;
 							}
+						}
+						best[i] = (muByte)best_index;
+					}
+				}
 
-							// Describe pixel format
-							PIXELFORMATDESCRIPTOR format_desc;
-							if (!DescribePixelFormat(dc, pixel_format, sizeof(format_desc), &format_desc)) {
-								return MUCOSA_WIN32_FAILED_DESCRIBE_WGL_PIXEL_FORMAT;
-							}
-							// Set pixel format @TODO Figure this out in window creation
-							if (!*set) {
-								if (!SetPixelFormat(dc, pixel_format, &format_desc)) {
-									return MUCOSA_WIN32_FAILED_SET_WGL_PIXEL_FORMAT;
-								}
-								*set = MU_TRUE;
-							}
+			#endif
 
-							// OpenGL version info
-							int opengl_attributes[] = {
-								MUCOSAWGL_CONTEXT_MAJOR_VERSION_ARB, 0,
-								MUCOSAWGL_CONTEXT_MINOR_VERSION_ARB, 0,
-								MUCOSAWGL_CONTEXT_PROFILE_MASK_ARB, MUCOSAWGL_CONTEXT_CORE_PROFILE_BIT_ARB,
-								0
-							};
+			// Encodes 16 RGBA pixels into an 8-byte BC1 color block
+			// Transparent pixels are only encoded if alpha is true (BC1);
+			// BC3 color blocks must use the four-color mode
+			void mugBC_color_block(const muByte* px, muBool alpha, muByte* dst) {
+				// Find color bounds of visible pixels
+				muByte lo[3], hi[3];
+				uint32_m visible = mugBC_bounds(px, alpha, lo, hi);
+				muBool transparent = visible != 0xFFFF;
+
+				// Fully transparent block
+				if (!visible) {
+					mugBC_write16(&dst[0], 0);
+					mugBC_write16(&dst[2], 0);
+					dst[4] = dst[5] = dst[6] = dst[7] = 0xFF;
+					return;
+				}
 
-							// - Fill in OpenGL version info based on graphics API value
-							switch (api) {
-								default: return MUCOSA_FAILED_UNKNOWN_GRAPHICS_API; break;
-								case MU_OPENGL_1_0: {
-									opengl_attributes[1] = 1;
-									opengl_attributes[3] = 0;
-									opengl_attributes[4] = 0;
-								} break;
-								case MU_OPENGL_1_1: {
-									opengl_attributes[1] = 1;
-									opengl_attributes[3] = 1;
-									opengl_attributes[4] = 0;
-								} break;
-								case MU_OPENGL_1_2: {
-									opengl_attributes[1] = 1;
-									opengl_attributes[3] = 2;
-									opengl_attributes[4] = 0;
-								} break;
-								// Don't know what to do, setting to 1.3
-								case MU_OPENGL_1_2_1: {
-									opengl_attributes[1] = 1;
-									opengl_attributes[3] = 3;
-									opengl_attributes[4] = 0;
-								} break;
-								case MU_OPENGL_1_3: {
-									opengl_attributes[1] = 1;
-									opengl_attributes[3] = 3;
-									opengl_attributes[4] = 0;
-								} break;
-								case MU_OPENGL_1_4: {
-									opengl_attributes[1] = 1;
-									opengl_attributes[3] = 4;
-									opengl_attributes[4] = 0;
-								} break;
-								case MU_OPENGL_1_5: {
-									opengl_attributes[1] = 1;
-									opengl_attributes[3] = 5;
-									opengl_attributes[4] = 0;
-								} break;
-								case MU_OPENGL_2_0: {
-									opengl_attributes[1] = 2;
-									opengl_attributes[3] = 0;
-									opengl_attributes[4] = 0;
-								} break;
-								case MU_OPENGL_2_1: {
-									opengl_attributes[1] = 2;
-									opengl_attributes[3] = 1;
-									opengl_attributes[4] = 0;
-								} break;
-								case MU_OPENGL_3_0: {
-									opengl_attributes[1] = 3;
-									opengl_attributes[3] = 0;
-									opengl_attributes[4] = 0;
-								} break;
-								case MU_OPENGL_3_1: {
-									opengl_attributes[1] = 3;
-									opengl_attributes[3] = 1;
-									opengl_attributes[4] = 0;
-								} break;
-								case MU_OPENGL_3_2_CORE: {
-									opengl_attributes[1] = 3;
-									opengl_attributes[3] = 2;
-								} break;
-								case MU_OPENGL_3_2_COMPATIBILITY: {
-									opengl_attributes[1] = 3;
-									opengl_attributes[3] = 2;
-									opengl_attributes[5] = MUCOSAWGL_CONTEXT_COMPATIBILITY_PROFILE_BIT_ARB;
-								} break;
-								case MU_OPENGL_3_3_CORE: {
-									opengl_attributes[1] = 3;
-									opengl_attributes[3] = 3;
-								} break;
-								case MU_OPENGL_3_3_COMPATIBILITY: {
-									opengl_attributes[1] = 3;
-									opengl_attributes[3] = 3;
-									opengl_attributes[5] = MUCOSAWGL_CONTEXT_COMPATIBILITY_PROFILE_BIT_ARB;
-								} break;
-								case MU_OPENGL_4_0_CORE: {
-									opengl_attributes[1] = 4;
-									opengl_attributes[3] = 0;
-								} break;
-								case MU_OPENGL_4_0_COMPATIBILITY: {
-									opengl_attributes[1] = 4;
-									opengl_attributes[3] = 0;
-									opengl_attributes[5] = MUCOSAWGL_CONTEXT_COMPATIBILITY_PROFILE_BIT_ARB;
-								} break;
-								case MU_OPENGL_4_1_CORE: {
-									opengl_attributes[1] = 4;
-									opengl_attributes[3] = 1;
-								} break;
-								case MU_OPENGL_4_1_COMPATIBILITY: {
-									opengl_attributes[1] = 4;
-									opengl_attributes[3] = 1;
-									opengl_attributes[5] = MUCOSAWGL_CONTEXT_COMPATIBILITY_PROFILE_BIT_ARB;
-								} break;
-								case MU_OPENGL_4_2_CORE: {
-									opengl_attributes[1] = 4;
-									opengl_attributes[3] = 2;
-								} break;
-								case MU_OPENGL_4_2_COMPATIBILITY: {
-									opengl_attributes[1] = 4;
-									opengl_attributes[3] = 2;
-									opengl_attributes[5] = MUCOSAWGL_CONTEXT_COMPATIBILITY_PROFILE_BIT_ARB;
-								} break;
-								case MU_OPENGL_4_3_CORE: {
-									opengl_attributes[1] = 4;
-									opengl_attributes[3] = 3;
-								} break;
-								case MU_OPENGL_4_3_COMPATIBILITY: {
-									opengl_attributes[1] = 4;
-									opengl_attributes[3] = 3;
-									opengl_attributes[5] = MUCOSAWGL_CONTEXT_COMPATIBILITY_PROFILE_BIT_ARB;
-								} break;
-								case MU_OPENGL_4_4_CORE: {
-									opengl_attributes[1] = 4;
-									opengl_attributes[3] = 4;
-								} break;
-								case MU_OPENGL_4_4_COMPATIBILITY: {
-									opengl_attributes[1] = 4;
-									opengl_attributes[3] = 4;
-									opengl_attributes[5] = MUCOSAWGL_CONTEXT_COMPATIBILITY_PROFILE_BIT_ARB;
-								} break;
-								case MU_OPENGL_4_5_CORE: {
-									opengl_attributes[1] = 4;
-									opengl_attributes[3] = 5;
-								} break;
-								case MU_OPENGL_4_5_COMPATIBILITY: {
-									opengl_attributes[1] = 4;
-									opengl_attributes[3] = 5;
-									opengl_attributes[5] = MUCOSAWGL_CONTEXT_COMPATIBILITY_PROFILE_BIT_ARB;
-								} break;
-								case MU_OPENGL_4_6_CORE: {
-									opengl_attributes[1] = 4;
-									opengl_attributes[3] = 6;
-								} break;
-								case MU_OPENGL_4_6_COMPATIBILITY: {
-									opengl_attributes[1] = 4;
-									opengl_attributes[3] = 6;
-									opengl_attributes[5] = MUCOSAWGL_CONTEXT_COMPATIBILITY_PROFILE_BIT_ARB;
-								} break;
-							}
+				// Pick the bounding box diagonal that follows the colors' trend,
+				// by flipping green and blue if they go against red
+				int32_m cov_g = 0, cov_b = 0;
+				for (uint32_m i = 0; i < 16; ++i) {
+					const muByte* p = &px[i*4];
+					if (!(visible & (1u << i))) {
+						continue;
+					}
+					int32_m dr = (int32_m)p[0]*2 - lo[0] - hi[0];
+					cov_g += dr * ((int32_m)p[1]*2 - lo[1] - hi[1]);
+					cov_b += dr * ((int32_m)p[2]*2 - lo[2] - hi[2]);
+				}
+				if (cov_g < 0) { muByte t = lo[1]; lo[1] = hi[1]; hi[1] = t; }
+				if (cov_b < 0) { muByte t = lo[2]; lo[2] = hi[2]; hi[2] = t; }
+
+				// Inset bounds slightly, as the extremes are rarely the best endpoints
+				for (uint32_m c = 0; c < 3; ++c) {
+					int32_m inset = ((int32_m)hi[c] - (int32_m)lo[c]) / 16;
+					lo[c] = (muByte)((int32_m)lo[c] + inset);
+					hi[c] = (muByte)((int32_m)hi[c] - inset);
+				}
+
+				// Quantize endpoints; their order decides the mode
+				// (c0 > c1: four colors, c0 <= c1: three colors and transparent)
+				uint16_m c0 = mugBC_pack565(hi), c1 = mugBC_pack565(lo);
+				if ((transparent && c0 > c1) || (!transparent && c0 < c1)) {
+					uint16_m t = c0; c0 = c1; c1 = t;
+				}
+
+				// Build palette from quantized endpoints
+				muByte pal[4][3];
+				mugBC_unpack565(c0, pal[0]);
+				mugBC_unpack565(c1, pal[1]);
+				uint32_m colors = (c0 > c1) ? (4) : (3);
+				for (uint32_m c = 0; c < 3; ++c) {
+					if (colors == 4) {
+						pal[2][c] = (muByte)((2*pal[0][c] + pal[1][c]) / 3);
+						pal[3][c] = (muByte)((pal[0][c] + 2*pal[1][c]) / 3);
+					} else {
+						pal[2][c] = (muByte)((pal[0][c] + pal[1][c]) / 2);
+					}
+				}
+
+				// Choose closest palette color for each pixel (3 for transparent pixels)
+				muByte best[16];
+				mugBC_nearest(px, visible, pal, colors, best);
+				uint32_m indexes = 0;
+				for (uint32_m i = 0; i < 16; ++i) {
+					uint32_m index = (visible & (1u << i)) ? (best[i]) : (3);
+					indexes |= index << (i*2);
+				}
+
+				// Write block
+				mugBC_write16(&dst[0], c0);
+				mugBC_write16(&dst[2], c1);
+				mugBC_write16(&dst[4], (uint16_m)(indexes & 0xFFFF));
+				mugBC_write16(&dst[6], (uint16_m)(indexes >> 16));
+			}
+
+			// Encodes 16 single-channel values (each stride bytes apart)
+			// into an 8-byte BC4 block (also used for BC3 alpha)
+			void mugBC_scalar_block(const muByte* v, uint32_m stride, muByte* dst) {
+				// Find bounds
+				muByte lo = 255, hi = 0;
+				for (uint32_m i = 0; i < 16; ++i) {
+					muByte x = v[i*stride];
+					if (x < lo) lo = x;
+					if (x > hi) hi = x;
+				}
+
+				// Use eight-value mode (r0 > r1), where the palette is
+				// r0, r1, then six evenly spaced values from r0 to r1
+				uint64_m indexes = 0;
+				if (hi != lo) {
+					uint32_m range = hi - lo;
+					for (uint32_m i = 0; i < 16; ++i) {
+						// Step from r0 (0) to r1 (7)
+						uint32_m t = ((uint32_m)(hi - v[i*stride]) * 7 + range/2) / range;
+						uint64_m index = (t == 0) ? (0) : ((t == 7) ? (1) : (t+1));
+						indexes |= index << (i*3);
+					}
+				}
 
-							// Create context
-							*context = wgl->CreateContextAttribs(dc, 0, opengl_attributes);
-							if (!*context) {
-								return MUCOSA_WIN32_FAILED_CREATE_WGL_CONTEXT;
+				// Write block
+				dst[0] = hi;
+				dst[1] = lo;
+				for (uint32_m i = 0; i < 6; ++i) {
+					dst[2+i] = (muByte)((indexes >> (i*8)) & 0xFF);
+				}
+			}
+
+			// A range of rows of an image being compressed
+			// Starts on a multiple of 4, so that it covers whole blocks
+			typedef struct mugBC_Band {
+				mugTextureFormat format;
+				// Source pixel size
+				uint32_m ps;
+				// Dimensions of the range
+				uint32_m w, h;
+				// Bytes between each row of src
+				size_m stride;
+				// Start of the range in the source and compressed data
+				const muByte* src;
+				muByte* dst;
+			} mugBC_Band;
+
+			// Compresses a range of rows
+			void mugBC_band(mugBC_Band* band) {
+				muByte block[64];
+				muByte* dst = band->dst;
+				for (uint32_m by = 0; by < band->h; by += 4) {
+					for (uint32_m bx = 0; bx < band->w; bx += 4) {
+						mugBC_fetch(band->src, band->stride, band->ps, band->w, band->h, bx, by, block);
+						switch (band->format) {
+							default: break;
+							case MUG_TEXTURE_BC1_RGBA: {
+								mugBC_color_block(block, MU_TRUE, dst);
+								dst += 8;
+							} break;
+							// Alpha block, then color block
+							case MUG_TEXTURE_BC3_RGBA: {
+								mugBC_scalar_block(&block[3], 4, dst);
+								mugBC_color_block(block, MU_FALSE, &dst[8]);
+								dst += 16;
+							} break;
+							case MUG_TEXTURE_BC4_R: {
+								mugBC_scalar_block(block, 1, dst);
+								dst += 8;
+							} break;
+						}
+					}
+				}
+			}
+
+			#ifdef MU_WIN32
+				DWORD WINAPI mugBC_thread(LPVOID p) {
+					mugBC_band((mugBC_Band*)p);
+					return 0;
+				}
+			#else
+				void* mugBC_thread(void* p) {
+					mugBC_band((mugBC_Band*)p);
+					return 0;
+				}
+			#endif
+
+		/* Texture conversion */
+
+			// Removes conversion flags that have no effect on a format
+			mugTextureConversion mugConv_flags(mugTextureFormat format, mugTextureConversion convert) {
+				switch (format) {
+					default: return 0; break;
+					case MUG_TEXTURE_U8_RGB: return convert & MUG_TEXTURE_CONVERT_BGR; break;
+					case MUG_TEXTURE_U8_RGBA: return convert & (MUG_TEXTURE_CONVERT_BGR | MUG_TEXTURE_CONVERT_PREMULTIPLY); break;
+				}
+			}
+
+			// Returns the BT.601 luma of a color (weights out of 128, rounded)
+			muByte mugConv_luma(uint32_m r, uint32_m g, uint32_m b) {
+				return (muByte)((r*38 + g*75 + b*15 + 64) >> 7);
+			}
+
+			// Multiplies a channel by an alpha value, dividing by 255 (rounded)
+			muByte mugConv_mul(uint32_m c, uint32_m a) {
+				uint32_m t = c*a + 128;
+				return (muByte)((t + (t >> 8)) >> 8);
+			}
+
+			// Converts a row of pixels one at a time
+			void mugConv_row_scalar(muByte* dst, mugTextureFormat dst_format, const muByte* src, mugTextureFormat src_format, mugTextureConversion convert, uint32_m w) {
+				uint32_m ss = mug_texture_format_size(src_format), ds = mug_texture_format_size(dst_format);
+				uint32_m ri = (convert & MUG_TEXTURE_CONVERT_BGR) ? (2) : (0);
+				for (uint32_m i = 0; i < w; ++i, src += ss, dst += ds) {
+					// Read pixel
+					uint32_m r, g, b, a = 255;
+					if (ss == 1) {
+						r = g = b = src[0];
+					} else {
+						r = src[ri];
+						g = src[1];
+						b = src[2-ri];
+						if (ss == 4) {
+							a = src[3];
+						}
+					}
+					if (convert & MUG_TEXTURE_CONVERT_PREMULTIPLY) {
+						r = mugConv_mul(r, a);
+						g = mugConv_mul(g, a);
+						b = mugConv_mul(b, a);
+					}
+
+					// Write pixel
+					if (ds == 1) {
+						dst[0] = (ss == 1) ? ((muByte)r) : (mugConv_luma(r, g, b));
+						continue;
+					}
+					dst[0] = (muByte)r;
+					dst[1] = (muByte)g;
+					dst[2] = (muByte)b;
+					if (ds == 4) {
+						dst[3] = (muByte)a;
+					}
+				}
+			}
+
+			#if defined(MUG_SSSE3)
+
+				// Multiplies the colors of 4 RGBA pixels by their alpha
+				__m128i mugConv_premultiply_sse(__m128i v) {
+					__m128i zero = _mm_setzero_si128();
+					__m128i round = _mm_set1_epi16(128);
+					__m128i alpha = _mm_set1_epi32((int)0xFF000000);
+					// Widen to 16 bits, and spread each pixel's alpha to its channels
+					__m128i lo = _mm_unpacklo_epi8(v, zero), hi = _mm_unpackhi_epi8(v, zero);
+					__m128i alo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(lo, 0xFF), 0xFF);
+					__m128i ahi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(hi, 0xFF), 0xFF);
+					// Same as mugConv_mul
+					lo = _mm_add_epi16(_mm_mullo_epi16(lo, alo), round);
+					hi = _mm_add_epi16(_mm_mullo_epi16(hi, ahi), round);
+					lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+					hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+					// Keep original alpha
+					return _mm_or_si128(_mm_andnot_si128(alpha, _mm_packus_epi16(lo, hi)), _mm_and_si128(alpha, v));
+				}
+
+				// Converts the start of a row of pixels; returns the amount of pixels converted
+				uint32_m mugConv_row_simd(muByte* dst, mugTextureFormat dst_format, const muByte* src, mugTextureFormat src_format, mugTextureConversion convert, uint32_m w) {
+					uint32_m i = 0;
+					muBool bgr = (convert & MUG_TEXTURE_CONVERT_BGR) != 0;
+					__m128i alpha = _mm_set1_epi32((int)0xFF000000);
+					// Shuffles RGB (or BGR) pixels into RGBA order, zeroing alpha
+					__m128i expand = (bgr)
+						? (_mm_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1))
+						: (_mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1));
+
+					switch (dst_format) {
+						default: break;
+
+						case MUG_TEXTURE_U8_RGBA: switch (src_format) {
+							default: break;
+							// Expand 4 pixels at a time
+							// (16 bytes are read for 12, so the last pixels are left to the scalar path)
+							case MUG_TEXTURE_U8_RGB: {
+								for (; i+6 <= w; i += 4) {
+									__m128i v = _mm_loadu_si128((const __m128i*)&src[i*3]);
+									_mm_storeu_si128((__m128i*)&dst[i*4], _mm_or_si128(_mm_shuffle_epi8(v, expand), alpha));
+								}
+							} break;
+							// Swizzle and/or premultiply 4 pixels at a time
+							case MUG_TEXTURE_U8_RGBA: {
+								__m128i swap = _mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+								for (; i+4 <= w; i += 4) {
+									__m128i v = _mm_loadu_si128((const __m128i*)&src[i*4]);
+									if (bgr) {
+										v = _mm_shuffle_epi8(v, swap);
+									}
+									if (convert & MUG_TEXTURE_CONVERT_PREMULTIPLY) {
+										v = mugConv_premultiply_sse(v);
+									}
+									_mm_storeu_si128((__m128i*)&dst[i*4], v);
+								}
+							} break;
+							// Spread gray to 4 pixels at a time
+							case MUG_TEXTURE_U8_R: {
+								__m128i spread = _mm_setr_epi8(0, 0, 0, -1, 1, 1, 1, -1, 2, 2, 2, -1, 3, 3, 3, -1);
+								for (; i+4 <= w; i += 4) {
+									int v;
+									mu_memcpy(&v, &src[i], 4);
+									_mm_storeu_si128((__m128i*)&dst[i*4], _mm_or_si128(_mm_shuffle_epi8(_mm_cvtsi32_si128(v), spread), alpha));
+								}
+							} break;
+						} break;
+
+						// Pack luma of 8 pixels at a time
+						case MUG_TEXTURE_U8_R: {
+							if (src_format == MUG_TEXTURE_U8_R || (convert & MUG_TEXTURE_CONVERT_PREMULTIPLY)) {
+								break;
+							}
+							// Weights sum to 128 so that each pair's sum fits in a signed 16-bit value
+							__m128i weights = (bgr)
+								? (_mm_setr_epi8(15, 75, 38, 0, 15, 75, 38, 0, 15, 75, 38, 0, 15, 75, 38, 0))
+								: (_mm_setr_epi8(38, 75, 15, 0, 38, 75, 15, 0, 38, 75, 15, 0, 38, 75, 15, 0));
+							__m128i round = _mm_set1_epi16(64);
+							// RGB is spread to 4 bytes per pixel without swizzling, as the weights already are
+							__m128i spread = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+							uint32_m ss = mug_texture_format_size(src_format);
+							// RGB reads 16 bytes for 12 at the second group of 4
+							uint32_m end = (ss == 3) ? (10) : (8);
+							for (; i+end <= w; i += 8) {
+								__m128i a = _mm_loadu_si128((const __m128i*)&src[i*ss]);
+								__m128i b = _mm_loadu_si128((const __m128i*)&src[(i+4)*ss]);
+								if (ss == 3) {
+									a = _mm_shuffle_epi8(a, spread);
+									b = _mm_shuffle_epi8(b, spread);
+								}
+								// (r*38 + g*75, b*15) per pixel, then summed
+								__m128i sum = _mm_hadd_epi16(_mm_maddubs_epi16(a, weights), _mm_maddubs_epi16(b, weights));
+								sum = _mm_srli_epi16(_mm_add_epi16(sum, round), 7);
+								_mm_storel_epi64((__m128i*)&dst[i], _mm_packus_epi16(sum, sum));
 							}
+						} break;
+					}
+					return i;
+				}
 
-							return res;
+			#elif defined(MUG_NEON)
+
+				// Multiplies 16 channels by 16 alpha values (same as mugConv_mul)
+				uint8x16_t mugConv_mul_neon(uint8x16_t c, uint8x16_t a) {
+					uint16x8_t round = vdupq_n_u16(128);
+					uint16x8_t lo = vaddq_u16(vmull_u8(vget_low_u8(c), vget_low_u8(a)), round);
+					uint16x8_t hi = vaddq_u16(vmull_u8(vget_high_u8(c), vget_high_u8(a)), round);
+					lo = vaddq_u16(lo, vshrq_n_u16(lo, 8));
+					hi = vaddq_u16(hi, vshrq_n_u16(hi, 8));
+					return vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8));
+				}
+
+				// Returns the luma of 8 pixels (same as mugConv_luma)
+				uint8x8_t mugConv_luma_neon(uint8x8_t r, uint8x8_t g, uint8x8_t b) {
+					uint16x8_t sum = vmull_u8(r, vdup_n_u8(38));
+					sum = vmlal_u8(sum, g, vdup_n_u8(75));
+					sum = vmlal_u8(sum, b, vdup_n_u8(15));
+					return vrshrn_n_u16(sum, 7);
+				}
+
+				// Converts the start of a row of pixels; returns the amount of pixels converted
+				// Pixels are (de)interleaved 16 at a time
+				uint32_m mugConv_row_simd(muByte* dst, mugTextureFormat dst_format, const muByte* src, mugTextureFormat src_format, mugTextureConversion convert, uint32_m w) {
+					uint32_m i = 0;
+					muBool bgr = (convert & MUG_TEXTURE_CONVERT_BGR) != 0;
+					uint32_m ss = mug_texture_format_size(src_format);
+					for (; i+16 <= w; i += 16) {
+						// Read channels
+						uint8x16_t r, g, b, a = vdupq_n_u8(255);
+						switch (src_format) {
+							default: return i; break;
+							case MUG_TEXTURE_U8_R: r = g = b = vld1q_u8(&src[i]); break;
+							case MUG_TEXTURE_U8_RGB: {
+								uint8x16x3_t v = vld3q_u8(&src[i*ss]);
+								r = v.val[0]; g = v.val[1]; b = v.val[2];
+							} break;
+							case MUG_TEXTURE_U8_RGBA: {
+								uint8x16x4_t v = vld4q_u8(&src[i*ss]);
+								r = v.val[0]; g = v.val[1]; b = v.val[2]; a = v.val[3];
+							} break;
+						}
+						if (bgr) {
+							uint8x16_t t = r; r = b; b = t;
+						}
+						if (convert & MUG_TEXTURE_CONVERT_PREMULTIPLY) {
+							r = mugConv_mul_neon(r, a);
+							g = mugConv_mul_neon(g, a);
+							b = mugConv_mul_neon(b, a);
 						}
 
-				#endif /* MU_SUPPORT_OPENGL */
+						// Write channels
+						switch (dst_format) {
+							default: return i; break;
+							case MUG_TEXTURE_U8_R: {
+								if (src_format != MUG_TEXTURE_U8_R) {
+									r = vcombine_u8(
+										mugConv_luma_neon(vget_low_u8(r), vget_low_u8(g), vget_low_u8(b)),
+										mugConv_luma_neon(vget_high_u8(r), vget_high_u8(g), vget_high_u8(b))
+									);
+								}
+								vst1q_u8(&dst[i], r);
+							} break;
+							case MUG_TEXTURE_U8_RGB: {
+								uint8x16x3_t v = { { r, g, b } };
+								vst3q_u8(&dst[i*3], v);
+							} break;
+							case MUG_TEXTURE_U8_RGBA: {
+								uint8x16x4_t v = { { r, g, b, a } };
+								vst4q_u8(&dst[i*4], v);
+							} break;
+						}
+					}
+					return i;
+				}
 
-				/* Time */
+			#else
 
-					struct muCOSAW32_Time {
-						// @DOCLINE The original time the context was created.
-						double orig_time;
-						// @DOCLINE The non-overwritable time.
-						double fixed_time;
-					};
-					typedef struct muCOSAW32_Time muCOSAW32_Time;
+				// Converts the start of a row of pixels; returns the amount of pixels converted
+				uint32_m mugConv_row_simd(muByte* dst, mugTextureFormat dst_format, const muByte* src, mugTextureFormat src_format, mugTextureConversion convert, uint32_m w) {
+					return 0; if (dst) {} if (dst_format) {} if (src) {} if (src_format) {} if (convert) {} if (w) {}
+				}
 
-					// https://stackoverflow.com/questions/1695288/getting-the-current-time-in-milliseconds-from-the-system-clock-in-windows
-					double muCOSAW32_get_current_time(void) {
-						// Get system time
-						FILETIME file_time;
-						GetSystemTimeAsFileTime(&file_time);
+			#endif
 
-						// Format low + high time
-						LONGLONG ll_now = 
-							(LONGLONG)(file_time.dwLowDateTime) + ((LONGLONG)(file_time.dwHighDateTime) << 32LL)
-						;
-						// Return time properly divided
-						return (double)(ll_now) / (double)(1.0e7);
+			// Converts a row of pixels from one uncompressed format to another
+			void mugConv_row(muByte* dst, mugTextureFormat dst_format, const muByte* src, mugTextureFormat src_format, mugTextureConversion convert, uint32_m w) {
+				convert = mugConv_flags(src_format, convert);
+				if (src_format == dst_format && !convert) {
+					mu_memcpy(dst, src, (size_m)w * mug_texture_format_size(src_format));
+					return;
+				}
+				uint32_m i = mugConv_row_simd(dst, dst_format, src, src_format, convert, w);
+				mugConv_row_scalar(
+					&dst[(size_m)i * mug_texture_format_size(dst_format)], dst_format,
+					&src[(size_m)i * mug_texture_format_size(src_format)], src_format,
+					convert, w-i
+				);
+			}
+
+		/* Image decoding */
+
+			// Largest width/height accepted from an encoded image
+			#define MUG_IMAGE_MAX_DIM 32768
+
+			// Reads a whole file into memory allocated with mu_malloc; returns 0 on failure
+			muByte* mugImage_read_file(const char* path, size_m* size) {
+				FILE* file = mu_fopen(path, "rb");
+				if (!file) {
+					return 0;
+				}
+
+				// Read in growing chunks (avoids seeking)
+				size_m len = 0, cap = 65536;
+				muByte* data = (muByte*)mu_malloc(cap);
+				while (data) {
+					len += mu_fread(&data[len], 1, cap-len, file);
+					if (len < cap) {
+						break;
 					}
+					cap *= 2;
+					muByte* grown = (muByte*)mu_realloc(data, cap);
+					if (!grown) {
+						mu_free(data);
+					}
+					data = grown;
+				}
 
-					// Initiates the time struct
-					void muCOSAW32_time_init(muCOSAW32_Time* time) {
-						// Set time to current time
-						time->orig_time = time->fixed_time = muCOSAW32_get_current_time();
+				mu_fclose(file);
+				*size = len;
+				return data;
+			}
+
+			// Checks that decoded dimensions are usable
+			muBool mugImage_valid_dim(uint32_m w, uint32_m h) {
+				return w && h && w <= MUG_IMAGE_MAX_DIM && h <= MUG_IMAGE_MAX_DIM;
+			}
+
+			// Decodes a QOI image to RGBA
+			muByte* mugImage_qoi(muByte* data, size_m size, uint32_m* dim) {
+				// Check header (and room for the end marker)
+				if (size < 22 || data[0] != 'q' || data[1] != 'o' || data[2] != 'i' || data[3] != 'f') {
+					return 0;
+				}
+				uint32_m w = ((uint32_m)data[4] << 24) | ((uint32_m)data[5] << 16) | ((uint32_m)data[6] << 8) | data[7];
+				uint32_m h = ((uint32_m)data[8] << 24) | ((uint32_m)data[9] << 16) | ((uint32_m)data[10] << 8) | data[11];
+				if (!mugImage_valid_dim(w, h)) {
+					return 0;
+				}
+				muByte* pixels = (muByte*)mu_malloc((size_m)w*h*4);
+				if (!pixels) {
+					return 0;
+				}
+
+				// Previously seen pixels, and current pixel
+				muByte index[64*4];
+				mu_memset(index, 0, sizeof(index));
+				muByte px[4] = { 0, 0, 0, 255 };
+
+				// Decode chunks; truncated data repeats the last pixel
+				size_m p = 14, end = size - 8;
+				uint32_m run = 0;
+				size_m count = (size_m)w*h;
+				for (size_m i = 0; i < count; ++i) {
+					if (run) {
+						--run;
+					} else if (p < end) {
+						muByte b = data[p++];
+						// RGB
+						if (b == 0xFE) {
+							if (p+3 <= end) {
+								px[0] = data[p]; px[1] = data[p+1]; px[2] = data[p+2];
+							}
+							p += 3;
+						}
+						// RGBA
+						else if (b == 0xFF) {
+							if (p+4 <= end) {
+								px[0] = data[p]; px[1] = data[p+1]; px[2] = data[p+2]; px[3] = data[p+3];
+							}
+							p += 4;
+						}
+						else switch (b >> 6) {
+							// Index
+							case 0: mu_memcpy(px, &index[(b & 63)*4], 4); break;
+							// Difference
+							case 1: {
+								px[0] = (muByte)(px[0] + ((b >> 4) & 3) - 2);
+								px[1] = (muByte)(px[1] + ((b >> 2) & 3) - 2);
+								px[2] = (muByte)(px[2] + (b & 3) - 2);
+							} break;
+							// Luma
+							case 2: {
+								muByte b2 = (p < end) ? (data[p]) : (0x88);
+								++p;
+								int vg = (b & 63) - 32;
+								px[0] = (muByte)(px[0] + vg - 8 + ((b2 >> 4) & 15));
+								px[1] = (muByte)(px[1] + vg);
+								px[2] = (muByte)(px[2] + vg - 8 + (b2 & 15));
+							} break;
+							// Run
+							case 3: run = b & 63; break;
+						}
+						mu_memcpy(&index[((px[0]*3 + px[1]*5 + px[2]*7 + px[3]*11) % 64)*4], px, 4);
 					}
+					mu_memcpy(&pixels[i*4], px, 4);
+				}
 
-				/* Clipboard */
+				dim[0] = w;
+				dim[1] = h;
+				return pixels;
+			}
 
-					uint8_m* muCOSAW32_clipboard_get(muCOSAResult* result) {
-						// Hold clipboard
-						if (!OpenClipboard(NULL)) {
-							MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_HOLD_CLIPBOARD)
-							return 0;
+			// Skips whitespace and comments in a PPM header
+			size_m mugImage_ppm_skip(muByte* data, size_m size, size_m p) {
+				while (p < size) {
+					if (data[p] == '#') {
+						while (p < size && data[p] != '\n') ++p;
+					} else if (data[p] == ' ' || data[p] == '\t' || data[p] == '\n' || data[p] == '\r') {
+						++p;
+					} else {
+						break;
+					}
+				}
+				return p;
+			}
+
+			// Reads a number in a PPM header (0 if there is none)
+			size_m mugImage_ppm_number(muByte* data, size_m size, size_m p, uint32_m* n) {
+				p = mugImage_ppm_skip(data, size, p);
+				*n = 0;
+				while (p < size && data[p] >= '0' && data[p] <= '9' && *n <= MUG_IMAGE_MAX_DIM) {
+					*n = *n*10 + (data[p++] - '0');
+				}
+				return p;
+			}
+
+			// Decodes a binary PPM (P6) or PGM (P5) image to RGBA
+			muByte* mugImage_ppm(muByte* data, size_m size, uint32_m* dim) {
+				// Check header
+				if (size < 3 || data[0] != 'P' || (data[1] != '6' && data[1] != '5')) {
+					return 0;
+				}
+				uint32_m channels = (data[1] == '6') ? (3) : (1);
+				uint32_m w, h, maxval;
+				size_m p = mugImage_ppm_number(data, size, 2, &w);
+				p = mugImage_ppm_number(data, size, p, &h);
+				p = mugImage_ppm_number(data, size, p, &maxval);
+				if (!mugImage_valid_dim(w, h) || !maxval || maxval > 255) {
+					return 0;
+				}
+				// (Single whitespace character before the pixels)
+				++p;
+				if (p > size || size - p < (size_m)w*h*channels) {
+					return 0;
+				}
+				muByte* pixels = (muByte*)mu_malloc((size_m)w*h*4);
+				if (!pixels) {
+					return 0;
+				}
+
+				// Convert pixels, rescaling to 255
+				size_m count = (size_m)w*h;
+				for (size_m i = 0; i < count; ++i) {
+					muByte* src = &data[p + i*channels];
+					for (uint32_m c = 0; c < 3; ++c) {
+						uint32_m v = src[(channels == 3) ? (c) : (0)];
+						pixels[i*4 + c] = (muByte)((v > maxval) ? (255) : ((v*255) / maxval));
+					}
+					pixels[i*4 + 3] = 255;
+				}
+
+				dim[0] = w;
+				dim[1] = h;
+				return pixels;
+			}
+
+			// Decodes an uncompressed true-color or grayscale TGA image to RGBA
+			muByte* mugImage_tga(muByte* data, size_m size, uint32_m* dim) {
+				// Check header (TGA has no signature, so check that it's plausible)
+				if (size < 18 || data[1] != 0) {
+					return 0;
+				}
+				uint32_m channels;
+				if (data[2] == 2 && (data[16] == 24 || data[16] == 32)) {
+					channels = data[16] / 8;
+				} else if (data[2] == 3 && data[16] == 8) {
+					channels = 1;
+				} else {
+					return 0;
+				}
+				uint32_m w = data[12] | ((uint32_m)data[13] << 8);
+				uint32_m h = data[14] | ((uint32_m)data[15] << 8);
+				size_m offset = 18 + data[0];
+				if (!mugImage_valid_dim(w, h) || size < offset || size - offset < (size_m)w*h*channels) {
+					return 0;
+				}
+				muByte* pixels = (muByte*)mu_malloc((size_m)w*h*4);
+				if (!pixels) {
+					return 0;
+				}
+
+				// Convert pixels from BGR(A), flipping rows unless stored top-to-bottom
+				muBool top = (data[17] & 0x20) != 0;
+				for (uint32_m y = 0; y < h; ++y) {
+					muByte* row = &data[offset + (size_m)((top) ? (y) : (h-1-y))*w*channels];
+					muByte* dst = &pixels[(size_m)y*w*4];
+					for (uint32_m x = 0; x < w; ++x) {
+						muByte* src = &row[x*channels];
+						if (channels == 1) {
+							dst[0] = dst[1] = dst[2] = src[0];
+							dst[3] = 255;
+						} else {
+							dst[0] = src[2];
+							dst[1] = src[1];
+							dst[2] = src[0];
+							dst[3] = (channels == 4) ? (src[3]) : (255);
 						}
+						dst += 4;
+					}
+				}
 
-						// Get handle to clipboard data (UTF-16)
-						HANDLE data = GetClipboardData(CF_UNICODETEXT);
-						if (!data) {
-							// I'm pretty sure this can happen if no clipboard is available, so I'm not
-							// throwing an error here
-							CloseClipboard();
-							return 0;
+				dim[0] = w;
+				dim[1] = h;
+				return pixels;
+			}
+
+			// Decodes an image to RGBA with the built-in decoders; returns 0 on failure
+			muByte* mugImage_decode(muByte* data, size_m size, uint32_m* dim) {
+				muByte* pixels = mugImage_qoi(data, size, dim);
+				if (!pixels) pixels = mugImage_ppm(data, size, dim);
+				if (!pixels) pixels = mugImage_tga(data, size, dim);
+				return pixels;
+			}
+
+			// Converts RGBA pixels to a texture format, returning pixels allocated with mu_malloc
+			// Conversion to uncompressed formats happens in-place (returning rgba)
+			muByte* mugImage_convert(mugResult* result, muByte* rgba, uint32_m* dim, mugTextureFormat format) {
+				size_m count = (size_m)dim[0]*dim[1];
+				switch (format) {
+					default: MU_SET_RESULT(result, MUG_UNSUPPORTED_TEXTURE_FORMAT) return 0; break;
+
+					case MUG_TEXTURE_U8_RGBA: return rgba; break;
+
+					// Drop channels
+					case MUG_TEXTURE_U8_RGB: case MUG_TEXTURE_U8_R: {
+						uint32_m channels = (format == MUG_TEXTURE_U8_RGB) ? (3) : (1);
+						for (size_m i = 0; i < count; ++i) {
+							for (uint32_m c = 0; c < channels; ++c) {
+								rgba[i*channels + c] = rgba[i*4 + c];
+							}
 						}
+						return rgba;
+					} break;
 
-						// Get clipboard data (UTF-16)
-						wchar_t* utf16 = (wchar_t*)GlobalLock(data);
-						if (!utf16) {
-							MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_GET_CLIPBOARD_DATA)
-							CloseClipboard();
+					// Compress
+					case MUG_TEXTURE_BC1_RGBA: case MUG_TEXTURE_BC3_RGBA: case MUG_TEXTURE_BC4_R: {
+						muByte* dst = (muByte*)mu_malloc(mug_texture_data_size(format, dim[0], dim[1]));
+						if (!dst) {
+							MU_SET_RESULT(result, MUG_FAILED_MALLOC)
 							return 0;
 						}
+						if (format == MUG_TEXTURE_BC4_R) {
+							for (size_m i = 0; i < count; ++i) {
+								rgba[i] = rgba[i*4];
+							}
+						}
+						mug_texture_compress(0, result, format, dim[0], dim[1], 0, rgba, dst);
+						return dst;
+					} break;
+				}
+			}
 
-						// Convert UTF-16 to UTF-8
-						uint8_m* utf8 = muCOSAW32_wchar_to_utf8(utf16);
-						if (!utf8) {
-							MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_CONVERT_CLIPBOARD_DATA_FORMAT)
-							GlobalUnlock(data);
-							CloseClipboard();
-							return 0;
+		/* Texture files */
+
+			// Reads a little-endian uint32
+			uint32_m mug_read_u32(muByte* p) {
+				return (uint32_m)p[0] | ((uint32_m)p[1] << 8) | ((uint32_m)p[2] << 16) | ((uint32_m)p[3] << 24);
+			}
+
+			// Writes a little-endian uint32
+			void mug_write_u32(muByte* p, uint32_m v) {
+				p[0] = (muByte)v;
+				p[1] = (muByte)(v >> 8);
+				p[2] = (muByte)(v >> 16);
+				p[3] = (muByte)(v >> 24);
+			}
+
+			// Multiplies two sizes, giving MU_SIZE_MAX if the result overflows
+			size_m mug_size_mul(size_m a, size_m b) {
+				if (a != 0 && b > MU_SIZE_MAX / a) {
+					return MU_SIZE_MAX;
+				}
+				return a * b;
+			}
+
+			// Calculates the size of the pixel data of the first levels mipmap levels of a texture
+			// dim[3] (depth is 1 for non-array textures)
+			// Gives MU_SIZE_MAX if the size overflows, as dimensions read from a file aren't capped
+			size_m mug_texture_levels_size(mugTextureFormat format, uint32_m* dim, uint32_m levels) {
+				uint32_m bd = mug_texture_format_block(format);
+				size_m size = 0;
+				for (uint32_m l = 0; l < levels; ++l) {
+					uint32_m w = dim[0] >> l, h = dim[1] >> l;
+					w = (w) ? (w) : (1); h = (h) ? (h) : (1);
+					// (Block counts are rounded up without adding to w/h, which can overflow)
+					size_m level = mug_size_mul((size_m)(w / bd + (w % bd != 0)), (size_m)(h / bd + (h % bd != 0)));
+					level = mug_size_mul(mug_size_mul(level, mug_texture_format_size(format)), dim[2]);
+					if (level > MU_SIZE_MAX - size) {
+						return MU_SIZE_MAX;
+					}
+					size += level;
+				}
+				return size;
+			}
+
+			// Checks that a texture's info, dimensions, and amount of stored levels are valid for a texture file
+			// dim[3] (depth is 1 for non-array textures)
+			muBool mug_texture_file_valid(mugTextureInfo* info, uint32_m* dim, uint32_m levels) {
+				if (info->type > MUG_TEXTURE_2D_ARRAY || info->format > MUG_TEXTURE_BC7_RGBA
+					|| info->wrapping[0] > MUG_TEXTURE_CLAMP || info->wrapping[1] > MUG_TEXTURE_CLAMP
+					|| info->filtering[0] > MUG_TEXTURE_TRILINEAR || info->filtering[1] > MUG_TEXTURE_TRILINEAR
+				) {
+					return MU_FALSE;
+				}
+				if (!dim[0] || !dim[1] || !dim[2] || (info->type == MUG_TEXTURE_2D && dim[2] != 1)) {
+					return MU_FALSE;
+				}
+
+				// Make sure levels are within the full mipmap chain
+				uint32_m full = 1;
+				uint32_m size = (dim[0] > dim[1]) ? (dim[0]) : (dim[1]);
+				while (size >>= 1) {
+					++full;
+				}
+				return levels && levels <= full;
+			}
+
+			// Parses the header of a texture file, making sure that the file holds the pixel data it describes
+			mugResult mug_texture_file_parse(muByte* data, size_m size, mugTextureInfo* info, uint32_m* dim, uint32_m* levels) {
+				// Check signature and version
+				if (size < MUG_TEXTURE_FILE_HEADER_SIZE || data[0] != 'M' || data[1] != 'U' || data[2] != 'G' || data[3] != 'T'
+					|| mug_read_u32(&data[4]) != MUG_TEXTURE_FILE_VERSION
+				) {
+					return MUG_INVALID_TEXTURE_FILE;
+				}
+
+				// Read info, dimensions, and levels
+				info->type = mug_read_u32(&data[8]);
+				info->format = mug_read_u32(&data[12]);
+				info->wrapping[0] = mug_read_u32(&data[16]);
+				info->wrapping[1] = mug_read_u32(&data[20]);
+				info->filtering[0] = mug_read_u32(&data[24]);
+				info->filtering[1] = mug_read_u32(&data[28]);
+				info->mip_levels = mug_read_u32(&data[32]);
+				info->convert = 0;
+				dim[0] = mug_read_u32(&data[36]);
+				dim[1] = mug_read_u32(&data[40]);
+				dim[2] = mug_read_u32(&data[44]);
+				*levels = mug_read_u32(&data[48]);
+				if (!mug_texture_file_valid(info, dim, *levels)) {
+					return MUG_INVALID_TEXTURE_FILE;
+				}
+
+				// Make sure pixel data fits
+				if (size - MUG_TEXTURE_FILE_HEADER_SIZE < mug_texture_levels_size(info->format, dim, *levels)) {
+					return MUG_INVALID_TEXTURE_FILE;
+				}
+				return MUG_SUCCESS;
+			}
+
+		/* Sorting */
+
+			// Compares two indexes, for sorting
+			int mug_compare_index(const void* a, const void* b) {
+				uint32_m ia = *(const uint32_m*)a, ib = *(const uint32_m*)b;
+				return (ia > ib) - (ia < ib);
+			}
+
+			// Compares two 64-bit keys, for sorting in ascending order
+			int mug_compare_key_asc(const void* a, const void* b) {
+				uint64_m ka = *(const uint64_m*)a, kb = *(const uint64_m*)b;
+				return (ka > kb) - (ka < kb);
+			}
+
+			// Compares two 64-bit keys, for sorting in descending order
+			int mug_compare_key_desc(const void* a, const void* b) {
+				uint64_m ka = *(const uint64_m*)a, kb = *(const uint64_m*)b;
+				return (ka < kb) - (ka > kb);
+			}
+
+		/* Spatial index */
+
+			// A uniform grid over the bounds of objects, used to find
+			// the objects within an area without checking every object.
+			// Cells are hashed into a fixed amount of buckets, so the
+			// grid is unbounded. Objects covering too many cells are
+			// kept in a separate list that every query checks.
+
+			// Maximum amount of cells an object can cover in the grid
+			#define MUG_INDEX_MAX_CELLS 16
+
+			// States of an object within the index
+			#define MUG_INDEX_NONE 0 // (Not in index)
+			#define MUG_INDEX_GRID 1 // (In grid)
+			#define MUG_INDEX_LARGE 2 // (In large list)
+
+			// List of object indexes
+			struct mug_IndexList {
+				// Object indexes
+				uint32_m* items;
+				// Amount of object indexes
+				uint32_m count;
+				// Amount of object indexes allocated
+				uint32_m cap;
+			};
+			typedef struct mug_IndexList mug_IndexList;
+
+			// Adds an object index to a list
+			mugResult mug_index_list_push(mug_IndexList* list, uint32_m item) {
+				// Grow if necessary
+				if (list->count == list->cap) {
+					uint32_m cap = (list->cap) ? (list->cap*2) : (8);
+					uint32_m* items = (uint32_m*)mug_realloc(list->items, cap*sizeof(uint32_m), MUG_ALLOC_SPATIAL_INDEX);
+					if (!items) {
+						return MUG_FAILED_REALLOC;
+					}
+					list->items = items;
+					list->cap = cap;
+				}
+
+				// Add item
+				list->items[list->count++] = item;
+				return MUG_SUCCESS;
+			}
+
+			// Removes one occurrence of an object index from a list
+			void mug_index_list_remove(mug_IndexList* list, uint32_m item) {
+				for (uint32_m i = 0; i < list->count; ++i) {
+					if (list->items[i] == item) {
+						// Swap last item into its place
+						list->items[i] = list->items[--list->count];
+						return;
+					}
+				}
+			}
+
+			// Struct representing a spatial index
+			struct mug_SpatialIndex {
+				// Width and height of each cell
+				float cell_size;
+				// Amount of objects
+				uint32_m obj_count;
+				// Bounds of each object (min x, min y, max x, max y)
+				float* bounds;
+				// Cells covered by each object (min x, min y, max x, max y)
+				int32_m* cells;
+				// State of each object
+				muByte* states;
+				// Query stamp of each object
+				uint32_m* stamps;
+				// Current query stamp
+				uint32_m stamp;
+				// Buckets of cells
+				mug_IndexList* buckets;
+				// Amount of buckets (power of 2)
+				uint32_m bucket_count;
+				// Objects too large for the grid
+				mug_IndexList large;
+				// Results of the last query (sorted)
+				uint32_m* results;
+				// Ranges of the last query's results (offsets + counts)
+				uint32_m* run_offsets;
+				uint32_m* run_counts;
+			};
+			typedef struct mug_SpatialIndex mug_SpatialIndex;
+
+			// Frees the object-related memory of a spatial index
+			void mugIndex_free(mug_SpatialIndex* index) {
+				// Free buckets
+				if (index->buckets) {
+					for (uint32_m i = 0; i < index->bucket_count; ++i) {
+						if (index->buckets[i].items) {
+							mug_dealloc(index->buckets[i].items, MUG_ALLOC_SPATIAL_INDEX);
 						}
+					}
+					mug_dealloc(index->buckets, MUG_ALLOC_SPATIAL_INDEX);
+					index->buckets = 0;
+				}
+				if (index->large.items) {
+					mug_dealloc(index->large.items, MUG_ALLOC_SPATIAL_INDEX);
+					index->large.items = 0;
+				}
+				index->large.count = index->large.cap = 0;
+
+				// Free per-object arrays
+				if (index->bounds) { mug_dealloc(index->bounds, MUG_ALLOC_SPATIAL_INDEX); index->bounds = 0; }
+				if (index->cells) { mug_dealloc(index->cells, MUG_ALLOC_SPATIAL_INDEX); index->cells = 0; }
+				if (index->states) { mug_dealloc(index->states, MUG_ALLOC_SPATIAL_INDEX); index->states = 0; }
+				if (index->stamps) { mug_dealloc(index->stamps, MUG_ALLOC_SPATIAL_INDEX); index->stamps = 0; }
+				if (index->results) { mug_dealloc(index->results, MUG_ALLOC_SPATIAL_INDEX); index->results = 0; }
+				if (index->run_offsets) { mug_dealloc(index->run_offsets, MUG_ALLOC_SPATIAL_INDEX); index->run_offsets = 0; }
+				if (index->run_counts) { mug_dealloc(index->run_counts, MUG_ALLOC_SPATIAL_INDEX); index->run_counts = 0; }
+				index->obj_count = 0;
+			}
 
-						// Close and return data
-						GlobalUnlock(data);
-						CloseClipboard();
-						return utf8;
+			// Allocates the object-related memory of a spatial index
+			// All objects start out as not being in the index
+			mugResult mugIndex_alloc(mug_SpatialIndex* index, uint32_m obj_count) {
+				// Calculate amount of buckets
+				index->bucket_count = 64;
+				while (index->bucket_count < obj_count) {
+					index->bucket_count *= 2;
+				}
+
+				// Allocate arrays
+				size_m count = (obj_count) ? (obj_count) : (1);
+				index->obj_count = obj_count;
+				index->bounds = (float*)mug_alloc(count*4*sizeof(float), MUG_ALLOC_SPATIAL_INDEX);
+				index->cells = (int32_m*)mug_alloc(count*4*sizeof(int32_m), MUG_ALLOC_SPATIAL_INDEX);
+				index->states = (muByte*)mug_alloc(count*sizeof(muByte), MUG_ALLOC_SPATIAL_INDEX);
+				index->stamps = (uint32_m*)mug_alloc(count*sizeof(uint32_m), MUG_ALLOC_SPATIAL_INDEX);
+				index->results = (uint32_m*)mug_alloc(count*sizeof(uint32_m), MUG_ALLOC_SPATIAL_INDEX);
+				index->run_offsets = (uint32_m*)mug_alloc(count*sizeof(uint32_m), MUG_ALLOC_SPATIAL_INDEX);
+				index->run_counts = (uint32_m*)mug_alloc(count*sizeof(uint32_m), MUG_ALLOC_SPATIAL_INDEX);
+				index->buckets = (mug_IndexList*)mug_alloc(index->bucket_count*sizeof(mug_IndexList), MUG_ALLOC_SPATIAL_INDEX);
+				if (!index->bounds || !index->cells || !index->states || !index->stamps
+					|| !index->results || !index->run_offsets || !index->run_counts || !index->buckets
+				) {
+					if (index->buckets) {
+						mug_dealloc(index->buckets, MUG_ALLOC_SPATIAL_INDEX);
+						index->buckets = 0;
 					}
+					mugIndex_free(index);
+					return MUG_FAILED_MALLOC;
+				}
 
-					void muCOSAW32_clipboard_set(muCOSAResult* result, uint8_m* data, size_m datalen) {
-						// Get length of UTF-16 equivalent
-						int wlen = MultiByteToWideChar(CP_UTF8, 0, (LPCCH)data, datalen, NULL, 0);
-						if (!wlen) {
-							MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_CONVERT_CLIPBOARD_DATA_FORMAT)
-							return;
-						}
+				// Zero-out states, stamps, and buckets
+				mu_memset(index->states, 0, count*sizeof(muByte));
+				mu_memset(index->stamps, 0, count*sizeof(uint32_m));
+				mu_memset(index->buckets, 0, index->bucket_count*sizeof(mug_IndexList));
+				index->stamp = 0;
+				return MUG_SUCCESS;
+			}
 
-						// Allocate global memory for UTF-16 string
-						HGLOBAL g_mem = GlobalAlloc(GMEM_MOVEABLE, (SIZE_T)(wlen)*sizeof(wchar_t));
-						if (!g_mem) {
-							MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_ALLOCATE_CLIPBOARD_DATA)
-							return;
-						}
+			// Creates a spatial index; returns 0 on failure
+			mug_SpatialIndex* mugIndex_create(float cell_size, uint32_m obj_count) {
+				// Allocate index
+				mug_SpatialIndex* index = (mug_SpatialIndex*)mug_alloc(sizeof(mug_SpatialIndex), MUG_ALLOC_SPATIAL_INDEX);
+				if (!index) {
+					return 0;
+				}
+				mu_memset(index, 0, sizeof(mug_SpatialIndex));
+				index->cell_size = cell_size;
 
-						// Get memory pointer
-						LPVOID p_mem = GlobalLock(g_mem);
-						if (!p_mem) {
-							MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_ALLOCATE_CLIPBOARD_DATA)
-							GlobalFree(g_mem);
-							return;
-						}
+				// Allocate object-related memory
+				if (mugIndex_alloc(index, obj_count) != MUG_SUCCESS) {
+					mug_dealloc(index, MUG_ALLOC_SPATIAL_INDEX);
+					return 0;
+				}
+				return index;
+			}
 
-						// Perform conversion
-						if (!MultiByteToWideChar(CP_UTF8, 0, (LPCCH)data, datalen, (LPWSTR)p_mem, wlen)) {
-							MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_CONVERT_CLIPBOARD_DATA_FORMAT)
-							GlobalUnlock(g_mem);
-							GlobalFree(g_mem);
-							return;
-						}
+			// Destroys a spatial index
+			void mugIndex_destroy(mug_SpatialIndex* index) {
+				mugIndex_free(index);
+				mug_dealloc(index, MUG_ALLOC_SPATIAL_INDEX);
+			}
 
-						// Release memory pointer
-						GlobalUnlock(g_mem);
+			// Resizes a spatial index; all objects are no longer in the index afterwards
+			mugResult mugIndex_resize(mug_SpatialIndex* index, uint32_m obj_count) {
+				mugIndex_free(index);
+				return mugIndex_alloc(index, obj_count);
+			}
 
-						// Hold clipboard
-						if (!OpenClipboard(NULL)) {
-							MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_HOLD_CLIPBOARD)
-							GlobalFree(g_mem);
-							return;
-						}
+			// Converts a coordinate to a cell coordinate
+			int32_m mugIndex_cell(mug_SpatialIndex* index, float f) {
+				f /= index->cell_size;
+				int32_m c = (int32_m)f;
+				// Round towards negative infinity
+				if ((float)c > f) {
+					c -= 1;
+				}
+				return c;
+			}
 
-						// Empty pre-existing clipboard data
-						if (!EmptyClipboard()) {
-							// Assuming this can get triggered if the clipboard was already empty,
-							// so no error thrown here.
-						}
+			// Hashes a cell coordinate into a bucket index
+			uint32_m mugIndex_hash(mug_SpatialIndex* index, int32_m x, int32_m y) {
+				return (((uint32_m)x * 73856093u) ^ ((uint32_m)y * 19349663u)) & (index->bucket_count-1);
+			}
 
-						// Set clipboard data
-						if (!SetClipboardData(CF_UNICODETEXT, g_mem)) {
-							MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_SET_CLIPBOARD_DATA)
-							GlobalFree(g_mem);
-							CloseClipboard();
-							return;
+			// Removes an object from the index
+			void mugIndex_remove(mug_SpatialIndex* index, uint32_m obj) {
+				int32_m* c = &index->cells[obj*4];
+				switch (index->states[obj]) {
+					default: break;
+					case MUG_INDEX_GRID: {
+						for (int32_m y = c[1]; y <= c[3]; ++y) {
+							for (int32_m x = c[0]; x <= c[2]; ++x) {
+								mug_index_list_remove(&index->buckets[mugIndex_hash(index, x, y)], obj);
+							}
 						}
+					} break;
+					case MUG_INDEX_LARGE: mug_index_list_remove(&index->large, obj); break;
+				}
+				index->states[obj] = MUG_INDEX_NONE;
+			}
 
-						// Close clipboard and we're done
-						CloseClipboard();
-					}
+			// Removes all objects from the index
+			void mugIndex_clear(mug_SpatialIndex* index) {
+				for (uint32_m i = 0; i < index->obj_count; ++i) {
+					mugIndex_remove(index, i);
+				}
+			}
 
-				/* Context */
+			// Sets the bounds of an object, (re)inserting it into the index
+			mugResult mugIndex_set(mug_SpatialIndex* index, uint32_m obj, float* bounds) {
+				// Remove object from its previous cells
+				mugIndex_remove(index, obj);
+
+				// Store bounds
+				float* b = &index->bounds[obj*4];
+				b[0] = bounds[0]; b[1] = bounds[1]; b[2] = bounds[2]; b[3] = bounds[3];
+
+				// Calculate amount of cells covered
+				// (Done in floats to avoid overflow with large/invalid bounds)
+				float span_x = (b[2] / index->cell_size) - (b[0] / index->cell_size) + 2.f;
+				float span_y = (b[3] / index->cell_size) - (b[1] / index->cell_size) + 2.f;
+				float span = span_x * span_y;
+
+				// Insert into large list if too many cells are covered (or bounds are NaN)
+				if (!(span <= (float)MUG_INDEX_MAX_CELLS)) {
+					index->states[obj] = MUG_INDEX_LARGE;
+					return mug_index_list_push(&index->large, obj);
+				}
 
-					struct muCOSAW32_Context {
-						muCOSAW32_Time time;
-						MUCOSA_OPENGL_CALL(muCOSAW32_WGL wgl;)
-					};
-					typedef struct muCOSAW32_Context muCOSAW32_Context;
+				// Insert into each cell covered
+				int32_m* c = &index->cells[obj*4];
+				c[0] = mugIndex_cell(index, b[0]);
+				c[1] = mugIndex_cell(index, b[1]);
+				c[2] = mugIndex_cell(index, b[2]);
+				c[3] = mugIndex_cell(index, b[3]);
+				index->states[obj] = MUG_INDEX_GRID;
+				for (int32_m y = c[1]; y <= c[3]; ++y) {
+					for (int32_m x = c[0]; x <= c[2]; ++x) {
+						mugResult res = mug_index_list_push(&index->buckets[mugIndex_hash(index, x, y)], obj);
+						if (res != MUG_SUCCESS) {
+							return res;
+						}
+					}
+				}
+				return MUG_SUCCESS;
+			}
 
-					// Accessing/Deaccessing pointer map functions needed for contexts
-					void muCOSAW32_window_pmap_access(void);
-					void muCOSAW32_window_pmap_deaccess(void);
+			// Sets the bounds of a range of objects from their vertexes
+			// v holds count*v_per_obj vertexes, each v_stride floats long, with x and y first
+			mugResult mugIndex_set_vertexes(mug_SpatialIndex* index, uint32_m offset, uint32_m count, const float* v, uint32_m v_stride, uint32_m v_per_obj) {
+				for (uint32_m i = 0; i < count; ++i) {
+					// Find bounds of vertexes
+					float b[4] = { v[0], v[1], v[0], v[1] };
+					for (uint32_m j = 1; j < v_per_obj; ++j) {
+						const float* vj = &v[j*v_stride];
+						if (vj[0] < b[0]) b[0] = vj[0];
+						if (vj[1] < b[1]) b[1] = vj[1];
+						if (vj[0] > b[2]) b[2] = vj[0];
+						if (vj[1] > b[3]) b[3] = vj[1];
+					}
+					v += v_per_obj*v_stride;
 
-					muCOSAResult muCOSAW32_context_init(muCOSAW32_Context* context) {
-						muCOSAResult res = MUCOSA_SUCCESS;
-						// Mark newly created context for pmap
-						muCOSAW32_window_pmap_access();
-						// Initiate context time
-						muCOSAW32_time_init(&context->time);
-						// Load OpenGL extensions
-						MUCOSA_OPENGL_CALL(
-							mu_memset(&context->wgl, 0, sizeof(context->wgl));
-							res = muCOSAW32_get_opengl_extensions(&context->wgl);
-						)
+					// Pad by a pixel (for antialiasing and one-pixel-wide points/lines)
+					b[0] -= 1.f; b[1] -= 1.f; b[2] += 1.f; b[3] += 1.f;
 
+					// Set bounds
+					mugResult res = mugIndex_set(index, offset+i, b);
+					if (res != MUG_SUCCESS) {
 						return res;
 					}
+				}
+				return MUG_SUCCESS;
+			}
 
-					void muCOSAW32_context_term(muCOSAW32_Context* context) {
-						// Remove context from pmap
-						muCOSAW32_window_pmap_deaccess();
-						return; if (context) {}
-					}
+			// Returns whether or not an object's bounds overlap an area
+			muBool mugIndex_overlaps(mug_SpatialIndex* index, uint32_m obj, float* area) {
+				float* b = &index->bounds[obj*4];
+				return b[0] <= area[2] && b[2] >= area[0] && b[1] <= area[3] && b[3] >= area[1];
+			}
 
-				/* Context time */
+			// Finds all objects whose bounds overlap an area (min x, min y, max x, max y)
+			// Results are stored sorted in index->results; returns amount of results
+			uint32_m mugIndex_query(mug_SpatialIndex* index, float* area) {
+				uint32_m count = 0;
 
-					double muCOSAW32_fixed_time_get(muCOSAW32_Context* context) {
-						// Return the difference between now and when the context was created
-						return muCOSAW32_get_current_time() - context->time.fixed_time;
+				// Advance query stamp
+				index->stamp += 1;
+				if (index->stamp == 0) {
+					mu_memset(index->stamps, 0, index->obj_count*sizeof(uint32_m));
+					index->stamp = 1;
+				}
+
+				// Check every object if the area covers more cells than there are buckets
+				float span = ((area[2] / index->cell_size) - (area[0] / index->cell_size) + 2.f)
+					* ((area[3] / index->cell_size) - (area[1] / index->cell_size) + 2.f);
+				if (!(span <= (float)index->bucket_count)) {
+					for (uint32_m i = 0; i < index->obj_count; ++i) {
+						if (index->states[i] != MUG_INDEX_NONE && mugIndex_overlaps(index, i, area)) {
+							index->results[count++] = i;
+						}
 					}
+					// (Already sorted)
+					return count;
+				}
 
-					double muCOSAW32_time_get(muCOSAW32_Context* context) {
-						// Return the difference between now and the overridable original time
-						return muCOSAW32_get_current_time() - context->time.orig_time;
+				// Check objects in each cell covered by the area
+				int32_m c[4] = {
+					mugIndex_cell(index, area[0]), mugIndex_cell(index, area[1]),
+					mugIndex_cell(index, area[2]), mugIndex_cell(index, area[3])
+				};
+				for (int32_m y = c[1]; y <= c[3]; ++y) {
+					for (int32_m x = c[0]; x <= c[2]; ++x) {
+						mug_IndexList* bucket = &index->buckets[mugIndex_hash(index, x, y)];
+						for (uint32_m i = 0; i < bucket->count; ++i) {
+							uint32_m obj = bucket->items[i];
+							// Skip objects already checked
+							if (index->stamps[obj] == index->stamp) {
+								continue;
+							}
+							index->stamps[obj] = index->stamp;
+							if (mugIndex_overlaps(index, obj, area)) {
+								index->results[count++] = obj;
+							}
+						}
 					}
+				}
 
-					void muCOSAW32_time_set(muCOSAW32_Context* context, double time) {
-						// Set time to current time minus the given time
-						context->time.orig_time = muCOSAW32_get_current_time() - time;
+				// Check large objects
+				for (uint32_m i = 0; i < index->large.count; ++i) {
+					uint32_m obj = index->large.items[i];
+					if (mugIndex_overlaps(index, obj, area)) {
+						index->results[count++] = obj;
 					}
+				}
 
-				/* Sleep */
+				// Sort results
+				mu_qsort(index->results, count, sizeof(uint32_m), mug_compare_index);
+				return count;
+			}
 
-					void muCOSAW32_sleep(double time) {
-						// Sleep for the approx. amount of milliseconds
-						Sleep((DWORD)(time*1000.0));
+			// Coalesces the last query's results into ranges of consecutive objects
+			// Ranges are stored in index->run_offsets/run_counts; returns amount of ranges
+			uint32_m mugIndex_runs(mug_SpatialIndex* index, uint32_m result_count) {
+				uint32_m run_count = 0;
+				for (uint32_m i = 0; i < result_count; ++i) {
+					// Extend last range if consecutive
+					if (run_count && index->results[i] == index->run_offsets[run_count-1] + index->run_counts[run_count-1]) {
+						index->run_counts[run_count-1] += 1;
+					}
+					// Start new range otherwise
+					else {
+						index->run_offsets[run_count] = index->results[i];
+						index->run_counts[run_count] = 1;
+						run_count += 1;
 					}
+				}
+				return run_count;
+			}
 
-				/* Window structs */
+	/* Asynchronous loading */
+
+		// Image loads requested via mug_gtexture_load_async are decoded on
+		// worker threads, then handed back to the graphic's thread, which
+		// transfers them to their textures a slice at a time each frame.
+
+		typedef struct mug_Loader mug_Loader;
+
+		// An image load
+		typedef struct mug_LoadJob mug_LoadJob;
+		struct mug_LoadJob {
+			// Loader handling the job
+			mug_Loader* loader;
+			// Placeholder texture (0 if destroyed before loading finished)
+			mugTexture tex;
+
+			// Copied path (0 if loading from memory)
+			char* path;
+			// Encoded image in memory
+			muByte* data;
+			size_m size;
+			// Decoder at the time of the request
+			mugImageDecoder decoder;
+			void* decoder_user;
+
+			// Requested texture info
+			mugTextureInfo info;
+			// Callback upon finishing
+			mugTextureLoaded callback;
+			void* user;
+
+			// Result of decoding and transferring
+			mugResult result;
+			// Decoded pixels, in the requested format
+			muByte* pixels;
+			// Decoded dimensions
+			uint32_m dim[2];
+			// Amount of rows transferred so far
+			uint32_m rows;
 
-					struct muCOSAW32_Keymaps {
-						// Keyboard keys
-						muBool keyboard[MU_KEYBOARD_LENGTH];
-						// Keystates
-						muBool keystates[MU_KEYSTATE_LENGTH];
-						// Mouse keys
-						muBool mouse[MU_MOUSE_LENGTH];
-					};
-					typedef struct muCOSAW32_Keymaps muCOSAW32_Keymaps;
+			// Next job in list
+			mug_LoadJob* next;
+		};
 
-					struct muCOSAW32_WindowHandles {
-						// Window class name
-						wchar_t wclass_name[2];
-						// Hinstance
-						HINSTANCE hinstance;
-						// Window handle
-						HWND hwnd;
-						// Device context
-						HDC dc;
-						// Cursor handle
-						HCURSOR hcursor;
-						// IMM context handle
-						HIMC imc;
-					};
-					typedef struct muCOSAW32_WindowHandles muCOSAW32_WindowHandles;
+		// A graphic's loader
+		struct mug_Loader {
+			// Lock for everything shared with the worker threads
+			mug_Mutex mutex;
+			// Signaled when a job is queued or the loader is stopping
+			mug_Cond cond;
+			// Worker threads
+			mug_Thread threads[MUG_LOAD_THREADS];
+			uint32_m thread_count;
+			// Whether or not the worker threads should stop
+			muBool quit;
+
+			// Jobs waiting to be decoded
+			mug_LoadJob* queue_head;
+			mug_LoadJob* queue_tail;
+			// Decoded jobs waiting to be transferred
+			mug_LoadJob* done_head;
+			mug_LoadJob* done_tail;
+
+			// Job currently being transferred (only accessed by the graphic's thread)
+			mug_LoadJob* upload;
+			// Raised when a job is handed back, waking the graphic if it's idle
+			mug_Signal* wake;
+		};
 
-					// States possibly held by the window that are updated via proc
-					struct muCOSAW32_WindowStates {
-						// Closed or not
-						muBool closed;
-						// Cursor style
-						muCursorStyle cursor_style;
-					};
-					typedef struct muCOSAW32_WindowStates muCOSAW32_WindowStates;
+		// Appends a job to a list
+		void mugLoad_push(mug_LoadJob** head, mug_LoadJob** tail, mug_LoadJob* job) {
+			job->next = 0;
+			if (*tail) (*tail)->next = job; else *head = job;
+			*tail = job;
+		}
 
-					struct muCOSAW32_WindowProperties {
-						// Pixel format
-						muPixelFormat format;
-						muBool use_format;
-						muBool format_set;
-						// Default pixel format value
-						int pixel_format;
+		// Removes the first job from a list (0 if empty)
+		mug_LoadJob* mugLoad_pop(mug_LoadJob** head, mug_LoadJob** tail) {
+			mug_LoadJob* job = *head;
+			if (job) {
+				*head = job->next;
+				if (!*head) *tail = 0;
+			}
+			return job;
+		}
 
-						// Min/Max dimensions
-						uint32_m min_width;
-						uint32_m min_height;
-						uint32_m max_width;
-						uint32_m max_height;
+		// Frees a job
+		void mugLoad_free_job(mug_LoadJob* job) {
+			if (job->path) {
+				mu_free(job->path);
+			}
+			if (job->pixels) {
+				mu_free(job->pixels);
+			}
+			mu_free(job);
+		}
 
-						// Scroll level
-						int32_m scroll_level;
+		// Reads, decodes, and converts a job's image
+		void mugLoad_decode(mug_LoadJob* job) {
+			// Read file if needed
+			muByte* data = job->data;
+			size_m size = job->size;
+			muByte* file = 0;
+			if (job->path) {
+				file = mugImage_read_file(job->path, &size);
+				if (!file) {
+					job->result = MUG_FAILED_DECODE_IMAGE;
+					return;
+				}
+				data = file;
+			}
 
-						// Cursor position
-						int32_m cursor_x;
-						int32_m cursor_y;
+			// Decode to RGBA, trying the user's decoder first
+			muByte* rgba = 0;
+			if (job->decoder) {
+				rgba = job->decoder(job->decoder_user, data, size, job->dim);
+			}
+			if (!rgba) {
+				rgba = mugImage_decode(data, size, job->dim);
+			}
+			if (file) {
+				mu_free(file);
+			}
+			if (!rgba) {
+				job->result = MUG_FAILED_DECODE_IMAGE;
+				return;
+			}
 
-						// Text input
-						void (*text_input_callback)(muWindow window, uint8_m* data);
-						uint32_m text_cursor_x;
-						uint32_m text_cursor_y;
-					};
-					typedef struct muCOSAW32_WindowProperties muCOSAW32_WindowProperties;
+			// Convert to requested format
+			job->pixels = mugImage_convert(&job->result, rgba, job->dim, job->info.format);
+			if (job->pixels != rgba) {
+				mu_free(rgba);
+			}
+		}
+
+		// Work loop of each worker thread
+		void mugLoad_work(mug_Loader* loader) {
+			mug_mutex_lock(&loader->mutex);
+			while (MU_TRUE) {
+				// Wait for a job
+				while (!loader->queue_head && !loader->quit) {
+					mug_cond_wait(&loader->cond, &loader->mutex);
+				}
+				if (loader->quit) {
+					break;
+				}
+				mug_LoadJob* job = mugLoad_pop(&loader->queue_head, &loader->queue_tail);
+				muBool cancelled = !job->tex;
+
+				// Decode outside of the lock
+				mug_mutex_unlock(&loader->mutex);
+				if (!cancelled) {
+					mugLoad_decode(job);
+				}
+				mug_mutex_lock(&loader->mutex);
+
+				// Hand back to the graphic's thread
+				mugLoad_push(&loader->done_head, &loader->done_tail, job);
+				mug_signal_raise(loader->wake);
+			}
+			mug_mutex_unlock(&loader->mutex);
+		}
+
+		#ifdef MU_WIN32
+			DWORD WINAPI mugLoad_thread(LPVOID p) {
+				mugLoad_work((mug_Loader*)p);
+				return 0;
+			}
+		#else
+			void* mugLoad_thread(void* p) {
+				mugLoad_work((mug_Loader*)p);
+				return 0;
+			}
+		#endif
+
+		// Creates a loader and starts its worker threads
+		// wake is raised whenever a job is ready to be transferred
+		mugResult mugLoad_create(mug_Loader** p, mug_Signal* wake) {
+			mug_Loader* loader = (mug_Loader*)mu_malloc(sizeof(mug_Loader));
+			if (!loader) {
+				return MUG_FAILED_MALLOC;
+			}
+			mu_memset(loader, 0, sizeof(mug_Loader));
+			loader->wake = wake;
+			mug_mutex_init(&loader->mutex);
+			mug_cond_init(&loader->cond);
+
+			// Start worker threads; at least one is needed
+			for (uint32_m i = 0; i < MUG_LOAD_THREADS; ++i) {
+				if (mug_thread_create(&loader->threads[loader->thread_count], mugLoad_thread, loader)) {
+					++loader->thread_count;
+				}
+			}
+			if (!loader->thread_count) {
+				mug_cond_term(&loader->cond);
+				mug_mutex_term(&loader->mutex);
+				mu_free(loader);
+				return MUG_FAILED_CREATE_THREAD;
+			}
+
+			*p = loader;
+			return MUG_SUCCESS;
+		}
+
+		// Stops a loader's worker threads and frees it, along with any unfinished jobs
+		void mugLoad_destroy(mug_Loader* loader) {
+			// Stop worker threads
+			mug_mutex_lock(&loader->mutex);
+			loader->quit = MU_TRUE;
+			mug_cond_broadcast(&loader->cond);
+			mug_mutex_unlock(&loader->mutex);
+			for (uint32_m i = 0; i < loader->thread_count; ++i) {
+				mug_thread_join(loader->threads[i]);
+			}
+
+			// Free unfinished jobs
+			mug_LoadJob* job;
+			while ((job = mugLoad_pop(&loader->queue_head, &loader->queue_tail))) {
+				mugLoad_free_job(job);
+			}
+			while ((job = mugLoad_pop(&loader->done_head, &loader->done_tail))) {
+				mugLoad_free_job(job);
+			}
+			if (loader->upload) {
+				mugLoad_free_job(loader->upload);
+			}
+
+			mug_cond_term(&loader->cond);
+			mug_mutex_term(&loader->mutex);
+			mu_free(loader);
+		}
+
+		// Queues a job to be decoded
+		void mugLoad_queue(mug_Loader* loader, mug_LoadJob* job) {
+			job->loader = loader;
+			mug_mutex_lock(&loader->mutex);
+			mugLoad_push(&loader->queue_head, &loader->queue_tail, job);
+			mug_cond_signal(&loader->cond);
+			mug_mutex_unlock(&loader->mutex);
+		}
+
+		// Returns whether or not any jobs are waiting to be transferred
+		muBool mugLoad_pending(mug_Loader* loader) {
+			if (loader->upload) {
+				return MU_TRUE;
+			}
+			mug_mutex_lock(&loader->mutex);
+			muBool pending = loader->done_head != 0;
+			mug_mutex_unlock(&loader->mutex);
+			return pending;
+		}
 
-					struct muCOSAW32_WindowTemp {
-						// High surrogate for cross-WM_CHAR messages
-						WCHAR high_surrogate;
-					};
-					typedef struct muCOSAW32_WindowTemp muCOSAW32_WindowTemp;
+		// Detaches a job from its texture, cancelling it
+		void mugLoad_detach(mug_LoadJob* job) {
+			mug_mutex_lock(&job->loader->mutex);
+			job->tex = 0;
+			mug_mutex_unlock(&job->loader->mutex);
+		}
 
-					struct muCOSAW32_Window {
-						muCOSAW32_WindowHandles handles;
-						muCOSAW32_Keymaps keymaps;
-						muCOSAW32_WindowStates states;
-						muCOSAW32_WindowProperties props;
-						muWindowCallbacks callbacks;
-						muCOSAW32_WindowTemp temp;
-					};
-					typedef struct muCOSAW32_Window muCOSAW32_Window;
+	/* OpenGL */
 
-				/* Pmap */
+	#ifdef MU_SUPPORT_OPENGL
 
-					// This entire section describes an atom-locked array of muCOSAW32_Window's.
-					// This is needed for when we need to find a muCOSAW32_Window based on just
-					// the Win32 handle (HWND), which happens in the proc function. Really sucks
-					// that I have to do this, but it works!
+		/* Macros */
 
-					// The way the array works is by using a pointer array that doubles in memory
-					// to keep up with allocation every time new memory is needed. Each element
-					// in the array is a pointer to a valid muCOSA window or 0; when a window is
-					// removed, its slot is set to 0, marking it for overwriting, which will be
-					// done if a new window needs to be added and there is an empty slot.
+			// ...
 
-					// The limitation to this is that the array cannot "de-expand"; for the
-					// entire time that at least one muCOSA context exists, the amount of windows
-					// alllocated can only go up. This is never likely to be a large issue, as
-					// the VAST majority of programs will never allocate enough windows at once
-					// to ever make this considerable in terms of memory allocated, but it is a
-					// limitation nonetheless.
+		/* General shader logic */
 
-					// Pointer map struct
-					struct muCOSAW32_WindowPMAP {
-						// Pointer to each window's memory
-						muCOSAW32_Window** windows;
-						// Amount of windows
-						size_m wincount;
-						// Amount of window array memory allocated; unit is amount of windows
-						size_m winlen;
-						// Locked state
-						LONG volatile locked;
-						// Amount of active muCOSA contexts;
-						// used to destroy all memory once all muCOSA contexts deactivate
-						size_m access_count;
-					};
-					typedef struct muCOSAW32_WindowPMAP muCOSAW32_WindowPMAP;
+			// Struct for a shader
+			struct mugGL_Shader {
+				// Shader program
+				GLuint program;
+				// Position modifiers set by the user
+				// (kept so that they can be flipped when rendering to a target)
+				float add_pos[3];
+				float mul_pos[3];
+			};
+			typedef struct mugGL_Shader mugGL_Shader;
 
-					// Global window pmap
-					muCOSAW32_WindowPMAP muCOSAW32_GlobalWindowPMAP = MU_ZERO_STRUCT_CONST(muCOSAW32_WindowPMAP);
+			// Sets the dimensions that a shader renders to, along with its
+			// position modifiers, flipping the y-axis if flip is true
+			// Shader is expected to be bound
+			void mugGL_shader_view(mugGL_Shader* shader, uint32_m* dim, muBool flip) {
+				float hdim[2] = { ((float)dim[0])/2.f, ((float)dim[1])/2.f };
+				glUniform2f(glGetUniformLocation(shader->program, "d"), hdim[0], hdim[1]);
+
+				// Flipping y across the dimensions is the same as y' = (d.y*2) - y,
+				// which is folded into the modifiers so that the shaders don't change
+				float add_y = shader->add_pos[1], mul_y = shader->mul_pos[1];
+				if (flip) {
+					add_y = (hdim[1]*2.f) - add_y;
+					mul_y = -mul_y;
+				}
+				glUniform3f(glGetUniformLocation(shader->program, "aP"), shader->add_pos[0], add_y, shader->add_pos[2]);
+				glUniform3f(glGetUniformLocation(shader->program, "mP"), shader->mul_pos[0], mul_y, shader->mul_pos[2]);
+			}
 
-					// Locks the window pmap to this thread
-					void muCOSAW32_window_pmap_lock(void) {
-						// Wait until we have it locked for this thread
-						while (InterlockedCompareExchange(&muCOSAW32_GlobalWindowPMAP.locked, 1, 0) == 1) {
-							// ...
-						}
-					}
+			// Creates a vertex/fragment shader
+			mugResult mugGL_shader_create_vf(mug_Graphic* gfx, mugGL_Shader* shader, const char* vsm, const char* fsm) {
+				GLint success;
+				MUG_TRACE_BEGIN(&gfx->trace, compile_trace)
 
-					// Unlocks the window pmap (make sure you have it locked under the current thread!)
-					void muCOSAW32_window_pmap_unlock(void) {
-						// Set locked bit to 0 atomically
-						_interlockedbittestandreset(&muCOSAW32_GlobalWindowPMAP.locked, 0);
-					}
+				// Compile vertex shader
+				GLuint vs = glCreateShader(GL_VERTEX_SHADER);
+				glShaderSource(vs, 1, &vsm, 0);
+				glCompileShader(vs);
+				// Make sure it succeeded
+				glGetShaderiv(vs, GL_COMPILE_STATUS, &success);
+				if (!success) {
+					return MUG_GL_FAILED_COMPILE_VERTEX_SHADER;
+				}
 
-					// Adds a window to the window pmap
-					muCOSAResult muCOSAW32_window_pmap_add(muCOSAW32_Window* win) {
-						// Lock pmap to this thread
-						muCOSAW32_window_pmap_lock();
+				// Compile fragment shader
+				GLuint fs = glCreateShader(GL_FRAGMENT_SHADER);
+				glShaderSource(fs, 1, &fsm, 0);
+				glCompileShader(fs);
+				// Make sure it succeeded
+				glGetShaderiv(fs, GL_COMPILE_STATUS, &success);
+				if (!success) {
+					glDeleteShader(vs);
+					return MUG_GL_FAILED_COMPILE_FRAGMENT_SHADER;
+				}
 
-						// Try and find an empty slot to fill
-						for (size_m s = 0; s < muCOSAW32_GlobalWindowPMAP.wincount; ++s) {
-							if (!muCOSAW32_GlobalWindowPMAP.windows[s]) {
-								// If an empty slot is found, fill it and leave
-								muCOSAW32_GlobalWindowPMAP.windows[s] = win;
-								muCOSAW32_window_pmap_unlock();
-								return MUCOSA_SUCCESS;
-							}
-						}
+				// Create and link shader program
+				shader->program = glCreateProgram();
+				glAttachShader(shader->program, vs);
+				glAttachShader(shader->program, fs);
+				glLinkProgram(shader->program);
+				// Make sure it succeeded
+				glGetProgramiv(shader->program, GL_LINK_STATUS, &success);
+				if (!success) {
+					glDeleteShader(fs);
+					glDeleteShader(vs);
+					return MUG_GL_FAILED_LINK_SHADERS;
+				}
 
-						// Increment window count by 1
-						++muCOSAW32_GlobalWindowPMAP.wincount;
+				// Delete shaders
+				glDeleteShader(fs);
+				glDeleteShader(vs);
+				MUG_STAT(&gfx->stats, shader_compiles, 1)
+				MUG_TRACE_END(&gfx->trace, "shader compile", compile_trace)
 
-						// If array is non-existent currently:
-						if (!muCOSAW32_GlobalWindowPMAP.windows) {
-							// Allocate 1 window worth
-							muCOSAW32_GlobalWindowPMAP.winlen = 1;
-							muCOSAW32_GlobalWindowPMAP.windows = (muCOSAW32_Window**)mu_malloc(sizeof(muCOSAW32_Window*));
-							// If unable to allocate:
-							if (!muCOSAW32_GlobalWindowPMAP.windows) {
-								// Set values to 0
-								muCOSAW32_GlobalWindowPMAP.wincount = 0;
-								muCOSAW32_GlobalWindowPMAP.winlen = 0;
-								// Unlock pmap
-								muCOSAW32_window_pmap_unlock();
-								// Return bad value
-								return MUCOSA_FAILED_MALLOC;
-							}
-						}
+				glUseProgram(shader->program);
+				// Set default add/mul pos/col uniform values
+				shader->add_pos[0] = shader->add_pos[1] = shader->add_pos[2] = 0.f;
+				shader->mul_pos[0] = shader->mul_pos[1] = shader->mul_pos[2] = 1.f;
+				glUniform4f(glGetUniformLocation(shader->program, "aC"), 0.f, 0.f, 0.f, 0.f);
+				glUniform4f(glGetUniformLocation(shader->program, "mC"), 1.f, 1.f, 1.f, 1.f);
 
-						// If an array already exists, but we don't have enough memory allocated
-						else if (muCOSAW32_GlobalWindowPMAP.wincount >= muCOSAW32_GlobalWindowPMAP.winlen) {
-							// Multiply window length by 2
-							muCOSAW32_GlobalWindowPMAP.winlen *= 2;
-							// Reallocate this new length
-							muCOSAW32_Window** new_windows = (muCOSAW32_Window**)mu_realloc(
-								muCOSAW32_GlobalWindowPMAP.windows,
-								sizeof(muCOSAW32_Window*) * muCOSAW32_GlobalWindowPMAP.winlen
-							);
+				// Set dimensions uniform (along with position modifiers)
+				mugGL_shader_view(shader, gfx->dim, MU_FALSE);
+				glUseProgram(0);
 
-							// If we failed to reallocate:
-							if (!new_windows) {
-								// Deincrement window count
-								--muCOSAW32_GlobalWindowPMAP.wincount;
-								// Undo winlen multiplication
-								muCOSAW32_GlobalWindowPMAP.winlen /= 2;
-								// Unlock pmap
-								muCOSAW32_window_pmap_unlock();
-								// Return bad value
-								return MUCOSA_FAILED_REALLOC;
-							}
+				return MUG_SUCCESS;
+			}
 
-							// If we didn't fail, we point to the newly allocated memory
-							muCOSAW32_GlobalWindowPMAP.windows = new_windows;
-						}
+			// Destroys a shader (safe to call if null)
+			void mugGL_shader_destroy(mugGL_Shader* shader) {
+				// If program exists:
+				if (shader->program) {
+					// Destroy program and set to 0
+					glDeleteProgram(shader->program);
+					shader->program = 0;
+				}
+			}
 
-						// Set newly allocated window spot to the new window
-						muCOSAW32_GlobalWindowPMAP.windows[muCOSAW32_GlobalWindowPMAP.wincount-1] = win;
+			// Binds a shader
+			void mugGL_shader_bind(mugGL_Shader* shader) {
+				// Bind shader program
+				glUseProgram(shader->program);
+			}
 
-						// Unlock pmap
-						muCOSAW32_window_pmap_unlock();
-						// Return success
-						return MUCOSA_SUCCESS;
-					}
+			// Unbinds a shader
+			void mugGL_shader_unbind(mugGL_Shader* shader) {
+				// Unbind shader program
+				glUseProgram(shader->program);
+			}
 
-					// Removes a window from the pmap
-					void muCOSAW32_window_pmap_remove(muCOSAW32_Window* win) {
-						// Lock pmap to this thread
-						muCOSAW32_window_pmap_lock();
+		/* General texture logic */
 
-						// Find window pointer within pmap
-						for (size_m p = 0; p < muCOSAW32_GlobalWindowPMAP.wincount; ++p) {
-							if (muCOSAW32_GlobalWindowPMAP.windows[p] == win) {
-								muCOSAW32_GlobalWindowPMAP.windows[p] = 0;
-								break;
-							}
-						}
+			/* Conversions */
 
-						// Unlock pmap
-						muCOSAW32_window_pmap_unlock();
+				// mugTextureType -> GLenum
+				GLenum mugGL_texture_type(mugTextureType type) {
+					switch (type) {
+						default: return GL_TEXTURE_2D; break;
+						case MUG_TEXTURE_2D: return GL_TEXTURE_2D; break;
+						case MUG_TEXTURE_2D_ARRAY: return GL_TEXTURE_2D_ARRAY; break;
 					}
+				}
 
-					// Cleans up all of the memory within the pmap
-					// Note that this does NOT lock/unlock; this should only be called with
-					// a thread that already has the global pmap locked
-					void muCOSAW32_window_pmap_cleanup(void) {
-						// Free the memory if it's allocated
-						if (muCOSAW32_GlobalWindowPMAP.windows) {
-							mu_free(muCOSAW32_GlobalWindowPMAP.windows);
-						}
-						// Zero-out the global pmap struct
-						muCOSAW32_GlobalWindowPMAP = MU_ZERO_STRUCT(muCOSAW32_WindowPMAP);
+				// mugTextureWrapping -> GLint
+				GLint mugGL_texture_wrapping(mugTextureWrapping wrap) {
+					switch (wrap) {
+						default: return GL_REPEAT; break;
+						case MUG_TEXTURE_REPEAT: return GL_REPEAT; break;
+						case MUG_TEXTURE_MIRRORED_REPEAT: return GL_MIRRORED_REPEAT; break;
+						case MUG_TEXTURE_CLAMP: return GL_CLAMP_TO_EDGE; break;
 					}
+				}
 
-					// "Accesses" the pmap, marking a context as currently active
-					void muCOSAW32_window_pmap_access(void) {
-						// Lock the pmap
-						muCOSAW32_window_pmap_lock();
+				// mugTextureFiltering -> GLint (upscaling)
+				GLint mugGL_texture_filtering(mugTextureFiltering fil) {
+					switch (fil) {
+						default: return GL_NEAREST; break;
+						case MUG_TEXTURE_NEAREST: return GL_NEAREST; break;
+						case MUG_TEXTURE_BILINEAR: return GL_LINEAR; break;
+						case MUG_TEXTURE_TRILINEAR: return GL_LINEAR; break;
+					}
+				}
+
+				// mugTextureFiltering -> GLint (downscaling)
+				GLint mugGL_texture_min_filtering(mugTextureFiltering fil) {
+					switch (fil) {
+						default: return mugGL_texture_filtering(fil); break;
+						case MUG_TEXTURE_TRILINEAR: return GL_LINEAR_MIPMAP_LINEAR; break;
+					}
+				}
+
+				// mugTextureFormat -> GLenum format
+				GLenum mugGL_texture_format_format(mugTextureFormat format) {
+					switch (format) {
+						default: return GL_RGB; break;
+						case MUG_TEXTURE_U8_R: return GL_RED; break;
+						case MUG_TEXTURE_U8_RGB: return GL_RGB; break;
+						case MUG_TEXTURE_U8_RGBA: return GL_RGBA; break;
+					}
+				}
 
-						// Increment access count
-						++muCOSAW32_GlobalWindowPMAP.access_count;
+				// Block-compressed formats not defined by GL 3.3 core
+				#ifndef GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
+					#define GL_COMPRESSED_RGBA_S3TC_DXT1_EXT 0x83F1
+				#endif
+				#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+					#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+				#endif
+				#ifndef GL_COMPRESSED_RGBA_BPTC_UNORM
+					#define GL_COMPRESSED_RGBA_BPTC_UNORM 0x8E8C
+				#endif
 
-						// Unlock the pmap
-						muCOSAW32_window_pmap_unlock();
+				// mugTextureFormat -> GLenum internal format
+				GLenum mugGL_texture_format_internal(mugTextureFormat format) {
+					switch (format) {
+						default: return GL_RGBA8; break;
+						case MUG_TEXTURE_U8_R: return GL_R8; break;
+						case MUG_TEXTURE_U8_RGB: return GL_RGB8; break;
+						case MUG_TEXTURE_U8_RGBA: return GL_RGBA8; break;
+						case MUG_TEXTURE_BC1_RGBA: return GL_COMPRESSED_RGBA_S3TC_DXT1_EXT; break;
+						case MUG_TEXTURE_BC3_RGBA: return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT; break;
+						case MUG_TEXTURE_BC4_R: return GL_COMPRESSED_RED_RGTC1; break;
+						case MUG_TEXTURE_BC7_RGBA: return GL_COMPRESSED_RGBA_BPTC_UNORM; break;
 					}
+				}
 
-					// "De-accesses" the pmap, marking a context as no longer active
-					void muCOSAW32_window_pmap_deaccess(void) {
-						// Lock the pmap
-						muCOSAW32_window_pmap_lock();
+				// mugTextureformat -> GLenum type
+				GLenum mugGL_texture_format_type(mugTextureFormat format) {
+					switch (format) {
+						default: return GL_UNSIGNED_BYTE; break;
+						// U8
+						case MUG_TEXTURE_U8_R: case MUG_TEXTURE_U8_RGB: case MUG_TEXTURE_U8_RGBA:
+							return GL_UNSIGNED_BYTE;
+						break;
+					}
+				}
 
-						// Deincrement access count
-						--muCOSAW32_GlobalWindowPMAP.access_count;
 
-						// If access count is 0, no more contexts are active, which
-						// means that we should clean everything up
-						if (muCOSAW32_GlobalWindowPMAP.access_count == 0) {
-							muCOSAW32_window_pmap_cleanup();
-						}
+			// Struct for a texture
+			typedef struct mugGL_Texture mugGL_Texture;
+			struct mugGL_Texture {
+				// Handle to the texture from glGenTextures (0 if evicted)
+				GLuint handle;
+				// The format type (like GL_TEXTURE_2D for example)
+				GLenum target;
+				// Pixel format and type (like GL_RGBA and GL_UNSIGNED_BYTE for example)
+				GLenum format;
+				GLenum type;
+				// Internal format (like GL_RGBA8 for example)
+				GLenum internal;
+				// mug texture format
+				mugTextureFormat format_id;
+				// mug texture format that pixels are stored as
+				// (pixels given are converted to it if it differs from format_id)
+				mugTextureFormat store_id;
+				// Conversion performed on pixels given
+				mugTextureConversion convert;
+				// Bytes per block (a block being one pixel for uncompressed formats)
+				uint32_m block_size;
+				// Width and height of a block (1 for uncompressed formats)
+				uint32_m block_dim;
+				// Dimensions (depth is 1 for non-array textures)
+				uint32_m dim[3];
+				// Amount of mipmap levels
+				uint32_m levels;
+				// Whether or not the mipmap levels need to be regenerated
+				muBool mips_dirty;
+				// Wrapping and filtering parameters (kept for reallocation)
+				GLint wrapping[2];
+				GLint filtering[2];
+				// Size of level 0's pixel data, in bytes
+				size_m data_size;
+				// Size of the texture's storage (all levels), in bytes
+				size_m bytes;
+				// Residency tracker
+				struct mugGL_Residency* res;
+				// Reload callback (0 if the texture isn't evictable)
+				mugTextureReload reload;
+				void* reload_user;
+				// Frame that the texture was last rendered in
+				uint64_m last_use;
+				// Whether or not the texture is in the least-recently-used list
+				muBool listed;
+				// Neighbors in the least-recently-used list
+				mugGL_Texture* prev;
+				mugGL_Texture* next;
+				// Whether or not the texture is still being loaded asynchronously
+				muBool pending;
+				// Asynchronous load job (0 if none)
+				mug_LoadJob* load_job;
+				// Whether or not the texture is owned by a render target
+				// (its handle is attached to the target's framebuffer, so it can't be replaced)
+				muBool render_target;
+			};
 
-						// Unlock the pmap
-						muCOSAW32_window_pmap_unlock();
+			// Struct for tracking texture memory and evicting textures over budget
+			struct mugGL_Residency {
+				// Budget, in bytes (0 if none)
+				size_m budget;
+				// Bytes of texture storage currently resident
+				size_m resident;
+				// Amount of evictions and reloads performed
+				uint32_m evictions;
+				uint32_m reloads;
+				// Current frame
+				uint64_m frame;
+				// Resident evictable textures, from least to most recently used
+				mugGL_Texture* head;
+				mugGL_Texture* tail;
+				// GPU memory tracking of the graphic
+				mug_Memory* memory;
+			};
+			typedef struct mugGL_Residency mugGL_Residency;
+
+			// Amount of pixel unpack buffers used to stage texture updates
+			#define MUGGL_UPLOAD_RING_COUNT 3
+
+			// Struct for a ring of pixel unpack buffers
+			// Each update uses the next buffer in the ring, and each buffer's
+			// storage is invalidated upon being mapped, so writing new pixels
+			// never waits on the GPU to finish transferring older ones.
+			struct mugGL_UploadRing {
+				// Pixel unpack buffers (0 until first used)
+				GLuint pbos[MUGGL_UPLOAD_RING_COUNT];
+				// Allocated size of each buffer, in bytes
+				GLsizeiptr sizes[MUGGL_UPLOAD_RING_COUNT];
+				// Next buffer to use
+				uint32_m next;
+				// GPU memory tracking of the graphic
+				mug_Memory* memory;
+			};
+			typedef struct mugGL_UploadRing mugGL_UploadRing;
+
+			// Maps the next buffer of an upload ring for writing size bytes, growing it if needed
+			// The buffer is left bound to GL_PIXEL_UNPACK_BUFFER (even on failure)
+			// Returns 0 on failure
+			muByte* mugGL_upload_ring_map(mugGL_UploadRing* ring, GLsizeiptr size) {
+				// Get next buffer in ring
+				uint32_m i = ring->next;
+				ring->next = (ring->next + 1) % MUGGL_UPLOAD_RING_COUNT;
+				if (!ring->pbos[i]) {
+					glGenBuffers(1, &ring->pbos[i]);
+					if (ring->pbos[i]) {
+						mug_memory_add(ring->memory, &ring->memory->report.staging, 0, 0);
 					}
+				}
+				if (!ring->pbos[i]) {
+					return 0;
+				}
 
-					// Finds a pointer to a muCOSA window based on the HWND handle
-					muCOSAW32_Window* muCOSAW32_window_pmap_find(HWND hwnd) {
-						// Lock the pmap
-						muCOSAW32_window_pmap_lock();
+				// Map buffer, invalidating its old contents
+				glBindBuffer(GL_PIXEL_UNPACK_BUFFER, ring->pbos[i]);
+				if (ring->sizes[i] < size) {
+					glBufferData(GL_PIXEL_UNPACK_BUFFER, size, 0, GL_STREAM_DRAW);
+					mug_memory_change(ring->memory, &ring->memory->report.staging, (size_m)ring->sizes[i], (size_m)size, (size_m)ring->sizes[i], (size_m)size);
+					ring->sizes[i] = size;
+				}
+				return (muByte*)glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+			}
 
-						// Default pointer
-						muCOSAW32_Window* wp = 0;
+			// Generates a texture's handle and sets its parameters, leaving it bound
+			mugResult mugGL_texture_generate(mugGL_Texture* tex) {
+				// Generate texture
+				glGenTextures(1, &tex->handle);
+				if (!tex->handle) {
+					return MUG_GL_FAILED_GENERATE_TEXTURE;
+				}
+				// Bind texture
+				glBindTexture(tex->target, tex->handle);
 
-						// Find pointer in array
-						for (size_m p = 0; p < muCOSAW32_GlobalWindowPMAP.wincount; ++p) {
-							if (muCOSAW32_GlobalWindowPMAP.windows[p] != 0 && 
-								muCOSAW32_GlobalWindowPMAP.windows[p]->handles.hwnd == hwnd
-							) {
-								wp = muCOSAW32_GlobalWindowPMAP.windows[p];
-								break;
-							}
-						}
+				// Wrapping
+				glTexParameteri(tex->target, GL_TEXTURE_WRAP_S, tex->wrapping[0]);
+				glTexParameteri(tex->target, GL_TEXTURE_WRAP_T, tex->wrapping[1]);
+				// Filtering
+				glTexParameteri(tex->target, GL_TEXTURE_MAG_FILTER, tex->filtering[0]);
+				glTexParameteri(tex->target, GL_TEXTURE_MIN_FILTER, tex->filtering[1]);
+				return MUG_SUCCESS;
+			}
 
-						// Unlock the pmap
-						muCOSAW32_window_pmap_unlock();
-						// Return pointer
-						return wp;
+			// Allocates the storage of a mipmap level of a bound texture, filled with data
+			// size is the size of the level's pixel data (only used for compressed textures)
+			void mugGL_texture_image(mugGL_Texture* tex, uint32_m level, GLsizei size, const void* data) {
+				GLsizei w = (GLsizei)(tex->dim[0] >> level), h = (GLsizei)(tex->dim[1] >> level);
+				w = (w) ? (w) : (1);
+				h = (h) ? (h) : (1);
+
+				// Compressed
+				if (tex->block_dim > 1) {
+					if (tex->target == GL_TEXTURE_2D_ARRAY) {
+						glCompressedTexImage3D(GL_TEXTURE_2D_ARRAY, level, tex->internal, w, h, tex->dim[2], 0, size, data);
+					} else {
+						glCompressedTexImage2D(tex->target, level, tex->internal, w, h, 0, size, data);
 					}
+				}
 
-				/* Proc */
-
-					// Info about a proc message
-					struct muCOSAW32_ProcMsg {
-						// Proc stuff
-						UINT uMsg;
-						WPARAM wParam;
-						LPARAM lParam;
+				// Uncompressed
+				else if (tex->target == GL_TEXTURE_2D_ARRAY) {
+					glTexImage3D(GL_TEXTURE_2D_ARRAY, level, tex->internal, w, h, tex->dim[2], 0, tex->format, tex->type, data);
+				} else {
+					glTexImage2D(tex->target, level, tex->internal, w, h, 0, tex->format, tex->type, data);
+				}
+			}
 
-						// muCOSA window
-						muCOSAW32_Window* win;
-					};
-					typedef struct muCOSAW32_ProcMsg muCOSAW32_ProcMsg;
+			// Returns whether or not pixels given for a texture need to be converted before being transferred
+			muBool mugGL_texture_converts(mugGL_Texture* tex) {
+				return tex->store_id != tex->format_id || tex->convert;
+			}
 
-					// Handling for WM_DESTROY; when a window is closed
-					LRESULT CALLBACK muCOSAW32_DESTROY(muCOSAW32_ProcMsg msg) {
-						PostQuitMessage(0);
-						msg.win->states.closed = MU_TRUE;
-						return 0;
-					}
+			// Converts rows of w pixels given for a texture to how they're stored, packing the rows
+			void mugGL_texture_convert_rows(mugGL_Texture* tex, muByte* dst, const muByte* src, uint32_m w, uint32_m rows, size_m stride) {
+				size_m dst_stride = (size_m)w * mug_texture_format_size(tex->store_id);
+				for (uint32_m r = 0; r < rows; ++r) {
+					mugConv_row(&dst[r*dst_stride], tex->store_id, &src[r*stride], tex->format_id, tex->convert, w);
+				}
+			}
 
-					// Separates left/right keys
-					WPARAM muCOSAW32_map_lr_keys(WPARAM vk, LPARAM lParam) {
-						// Separate scancode and left/right bit
-						UINT scancode = (lParam & 0x00ff0000) >> 16;
-						int  extended = (lParam & 0x01000000) != 0;
+			// Generates a texture's handle and allocates its storage (level 0)
+			// filled with data (undefined contents if 0)
+			mugResult mugGL_texture_allocate(mugGL_Texture* tex, muByte* data) {
+				mugResult res = mugGL_texture_generate(tex);
+				if (res != MUG_SUCCESS) {
+					return res;
+				}
 
-						// Separate into left/right virtual key codes if need be
-						switch (vk) {
-							default: return vk; break;
-							case VK_SHIFT:   return MapVirtualKey(scancode, MAPVK_VSC_TO_VK_EX); break;
-							case VK_CONTROL: return extended ? VK_RCONTROL : VK_LCONTROL; break;
-							case VK_MENU:    return extended ? VK_RMENU    : VK_LMENU; break;
-						}
+				// Compressed storage is allocated zeroed if no data is given,
+				// and data is converted to how it's stored if needed
+				GLsizei size = (GLsizei)tex->data_size;
+				muByte* temp = 0;
+				if ((tex->block_dim > 1 && !data) || (data && mugGL_texture_converts(tex))) {
+					size_m temp_size = mug_texture_data_size(tex->store_id, tex->dim[0], tex->dim[1]) * tex->dim[2];
+					temp = (muByte*)mug_alloc(temp_size, MUG_ALLOC_SCRATCH);
+					if (!temp) {
+						glDeleteTextures(1, &tex->handle);
+						tex->handle = 0;
+						return MUG_FAILED_MALLOC;
+					}
+					if (data) {
+						mugGL_texture_convert_rows(tex, temp, data, tex->dim[0], tex->dim[1]*tex->dim[2], (size_m)tex->dim[0] * tex->block_size);
+					} else {
+						mu_memset(temp, 0, temp_size);
 					}
+					data = temp;
+				}
+				mugGL_texture_image(tex, 0, size, (const void*)data);
+				if (temp) {
+					mug_dealloc(temp, MUG_ALLOC_SCRATCH);
+				}
 
-					// Handling for WM_KEYDOWN and WM_KEYUP
-					LRESULT CALLBACK muCOSAW32_KEY(muCOSAW32_ProcMsg msg, muBool up) {
-						// Handle separation of keys based on left/right
-						msg.wParam = muCOSAW32_map_lr_keys(msg.wParam, msg.lParam);
-						// Convert Win32 key value to muCOSA key value
-						muKeyboardKey key = muCOSAW32_VK_to_muCOSA(msg.wParam);
-						// Return if key is unknown or out of range
-						if (key == MU_KEYBOARD_UNKNOWN || key >= MU_KEYBOARD_LENGTH) {
-							return 0;
-						}
+				// Fix storage to the amount of levels used
+				// (equivalent of immutable storage, which GL 3.3 lacks);
+				// levels past 0 are allocated once generated
+				glTexParameteri(tex->target, GL_TEXTURE_BASE_LEVEL, 0);
+				glTexParameteri(tex->target, GL_TEXTURE_MAX_LEVEL, tex->levels-1);
+				tex->mips_dirty = tex->levels > 1;
 
-						// Set key state
-						msg.win->keymaps.keyboard[key] = up;
-						// Call keyboard callback
-						if (msg.win->callbacks.keyboard) {
-							msg.win->callbacks.keyboard(msg.win, key, up);
-						}
+				return MUG_SUCCESS;
+			}
 
-						// Exit
-						return 0;
-					}
+			// Generates a texture's handle and allocates its storage from the pixel
+			// data of given_levels mipmap levels laid out one after another, staging
+			// each level through the upload ring; levels not given are generated
+			mugResult mugGL_texture_allocate_levels(mugGL_Texture* tex, mugGL_UploadRing* ring, uint32_m given_levels, muByte* data) {
+				mugResult res = mugGL_texture_generate(tex);
+				if (res != MUG_SUCCESS) {
+					return res;
+				}
 
-					// Handling for WM_LBUTTONDOWN, WM_RBUTTONDOWN, WM_LBUTTONUP, and WM_RBUTTONDOWN
-					LRESULT CALLBACK muCOSAW32_MBUTTON(muCOSAW32_ProcMsg msg, muMouseKey key, muBool up) {
-						// Update keymap
-						msg.win->keymaps.mouse[key] = up;
-						// + Callback
-						if (msg.win->callbacks.mouse_key) {
-							msg.win->callbacks.mouse_key(msg.win, key, up);
+				// Allocate each given level
+				uint32_m levels = (given_levels < tex->levels) ? (given_levels) : (tex->levels);
+				muBool converts = mugGL_texture_converts(tex);
+				for (uint32_m l = 0; l < levels; ++l) {
+					uint32_m w = tex->dim[0] >> l, h = tex->dim[1] >> l;
+					w = (w) ? (w) : (1);
+					h = (h) ? (h) : (1);
+					size_m size = mug_texture_data_size(tex->format_id, w, h) * tex->dim[2];
+					size_m store_size = mug_texture_data_size(tex->store_id, w, h) * tex->dim[2];
+
+					// Copy level into buffer (converting it if needed),
+					// and transfer from there if its contents survived unmapping
+					muBool staged = MU_FALSE;
+					muByte* mapped = mugGL_upload_ring_map(ring, (GLsizeiptr)store_size);
+					if (mapped) {
+						if (converts) {
+							mugGL_texture_convert_rows(tex, mapped, data, w, h*tex->dim[2], (size_m)w * tex->block_size);
+						} else {
+							mu_memcpy(mapped, data, size);
+						}
+						if (glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER)) {
+							mugGL_texture_image(tex, l, (GLsizei)store_size, 0);
+							staged = MU_TRUE;
 						}
-						return 0;
 					}
-
-					muCOSAResult muCOSAW32_window_get_dimensions(muCOSAW32_Window* win, uint32_m* data);
-					muCOSAResult muCOSAW32_window_get_cursor_pos(muCOSAW32_Window* win, int32_m* data);
-					// Handling for WM_SETCURSOR
-					LRESULT CALLBACK muCOSAW32_SETCURSOR(muCOSAW32_ProcMsg msg) {
-						// Only allow the cursor to change if it's outside the window surface
-						// This is a hack and a half, but largely works
-						int32_m cur[2]; muCOSAW32_window_get_cursor_pos(msg.win, cur);
-						uint32_m dim[2]; muCOSAW32_window_get_dimensions(msg.win, dim);
-						int32_m idim[2] = { (int32_m)dim[0], (int32_m)dim[1] };
-						if (cur[0] >= 0 && cur[1] >= 0 && cur[0] < idim[0] && cur[1] < idim[1]) {
-							SetCursor(msg.win->handles.hcursor);
-						} else {
-							return DefWindowProcW(msg.win->handles.hwnd, msg.uMsg, msg.wParam, msg.lParam);
+					glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+					// Fall back to transferring directly from data
+					if (!staged) {
+						muByte* temp = 0;
+						if (converts) {
+							temp = (muByte*)mug_alloc(store_size, MUG_ALLOC_SCRATCH);
+							if (!temp) {
+								glDeleteTextures(1, &tex->handle);
+								tex->handle = 0;
+								return MUG_FAILED_MALLOC;
+							}
+							mugGL_texture_convert_rows(tex, temp, data, w, h*tex->dim[2], (size_m)w * tex->block_size);
+						}
+						mugGL_texture_image(tex, l, (GLsizei)store_size, (const void*)((temp) ? (temp) : (data)));
+						if (temp) {
+							mug_dealloc(temp, MUG_ALLOC_SCRATCH);
 						}
-						return 0;
 					}
+					data += size;
+				}
 
-					// Handling for WM_GETMINMAXINFO
-					LRESULT CALLBACK muCOSAW32_GETMINMAXINFO(muCOSAW32_ProcMsg msg) {
-						LPMINMAXINFO lp = (LPMINMAXINFO)msg.lParam;
-						// I have no idea why 16 and 39 need to be added here. Can't be borders
-						// because these numbers don't even nearly match the border values.
-						// If it works, it works :P
-						lp->ptMinTrackSize.x = msg.win->props.min_width + 16;
-						lp->ptMinTrackSize.y = msg.win->props.min_height + 39;
-						lp->ptMaxTrackSize.x = msg.win->props.max_width + 16;
-						lp->ptMaxTrackSize.y = msg.win->props.max_height + 39;
-						return 0;
-					}
+				// Fix storage to the amount of levels used
+				glTexParameteri(tex->target, GL_TEXTURE_BASE_LEVEL, 0);
+				glTexParameteri(tex->target, GL_TEXTURE_MAX_LEVEL, tex->levels-1);
+				tex->mips_dirty = tex->levels > levels;
 
-					// Handling for WM_MOUSEWHEEL
-					LRESULT CALLBACK muCOSAW32_MOUSEWHEEL(muCOSAW32_ProcMsg msg) {
-						// Add scroll level from wParam
-						int32_m add = GET_WHEEL_DELTA_WPARAM(msg.wParam);
-						msg.win->props.scroll_level += add;
-						// + Callback
-						if (msg.win->callbacks.scroll) {
-							msg.win->callbacks.scroll(msg.win, add);
-						}
+				return MUG_SUCCESS;
+			}
 
-						return 0;
-					}
+			// Removes a texture from the least-recently-used list
+			void mugGL_residency_unlist(mugGL_Residency* res, mugGL_Texture* tex) {
+				if (!tex->listed) {
+					return;
+				}
+				if (tex->prev) tex->prev->next = tex->next; else res->head = tex->next;
+				if (tex->next) tex->next->prev = tex->prev; else res->tail = tex->prev;
+				tex->prev = tex->next = 0;
+				tex->listed = MU_FALSE;
+			}
 
-					// Handling for WM_SIZE
-					LRESULT CALLBACK muCOSAW32_SIZE(muCOSAW32_ProcMsg msg) {
-						// Call dimensions callback
-						if (msg.win->callbacks.dimensions) {
-							msg.win->callbacks.dimensions(msg.win,
-								(uint32_m)(LOWORD(msg.lParam)),
-								(uint32_m)(HIWORD(msg.lParam))
-							);
-						}
+			// Adds a texture to the end (most recently used) of the least-recently-used list
+			void mugGL_residency_list(mugGL_Residency* res, mugGL_Texture* tex) {
+				mugGL_residency_unlist(res, tex);
+				tex->prev = res->tail;
+				tex->next = 0;
+				if (res->tail) res->tail->next = tex; else res->head = tex;
+				res->tail = tex;
+				tex->listed = MU_TRUE;
+			}
 
-						// Not sure why we're calling this
-						// I think I vaguely remember this fixing some issue, but idk
-						PostMessage(msg.win->handles.hwnd, WM_PAINT, 0, 0);
-						return 0;
-					}
+			// Returns the size of the full-size level of every layer of a texture, as stored, in bytes
+			size_m mugGL_texture_base_bytes(mugGL_Texture* tex) {
+				return mug_texture_data_size(tex->store_id, tex->dim[0], tex->dim[1]) * tex->dim[2];
+			}
 
-					// Handling for WM_MOVE
-					LRESULT CALLBACK muCOSAW32_MOVE(muCOSAW32_ProcMsg msg) {
-						// Call position callback
-						if (msg.win->callbacks.position) {
-							// https://www.autohotkey.com/boards/viewtopic.php?t=27857
-							// I would KISS Bill on the mouth if I ever met him...
-							msg.win->callbacks.position(
-								msg.win,
-								(int32_m)( msg.lParam      & 0x8000 ? - ((~msg.lParam    ) & 0x7FFF)+1 : msg.lParam       & 0x7FFF),
-								(int32_m)((msg.lParam>>16) & 0x8000 ? - ((~msg.lParam>>16) & 0X7FFF)+1 : (msg.lParam>>16) & 0x7FFF)
-							);
-						}
+			// Tracks a texture's storage as allocated
+			void mugGL_residency_add(mugGL_Residency* res, mugGL_Texture* tex) {
+				res->resident += tex->bytes;
+				mug_memory_add(res->memory, &res->memory->report.textures, tex->bytes, mugGL_texture_base_bytes(tex));
+				res->memory->report.texture_layers += tex->dim[2];
+			}
 
-						return 0;
-					}
+			// Tracks a texture's storage as freed
+			void mugGL_residency_remove(mugGL_Residency* res, mugGL_Texture* tex) {
+				res->resident -= tex->bytes;
+				mug_memory_remove(res->memory, &res->memory->report.textures, tex->bytes, mugGL_texture_base_bytes(tex));
+				res->memory->report.texture_layers -= tex->dim[2];
+			}
 
-					uint8_m muCOSAW32_UTF8_codepoint_size(uint32_m codepoint) {
-						// Storable in 7 bits = 1 byte
-						if (codepoint < 128) {
-							return 1;
-						}
-						// Storable in 11 bits = 2 bytes
-						if (codepoint < 2048) {
-							return 2;
-						}
-						// Storable in 16 bits = 3 bytes
-						if (codepoint < 65536) {
-							return 3;
-						}
-						return 4;
-					}
+			// Evicts a texture, freeing its storage
+			void mugGL_texture_evict(mugGL_Texture* tex) {
+				mugGL_residency_unlist(tex->res, tex);
+				glDeleteTextures(1, &tex->handle);
+				tex->handle = 0;
+				mugGL_residency_remove(tex->res, tex);
+				++tex->res->evictions;
+			}
 
-					// Handling for WM_CHAR
-					LRESULT CALLBACK muCOSAW32_CHAR(muCOSAW32_ProcMsg msg) {
-						// Hold onto high surrogate if it is one
-						if (IS_HIGH_SURROGATE(msg.wParam)) {
-							msg.win->temp.high_surrogate = (WCHAR)msg.wParam;
-							return 0;
-						}
+			// Evicts least recently used textures until within budget
+			// Textures used in the current frame are never evicted
+			void mugGL_residency_trim(mugGL_Residency* res) {
+				while (res->budget && res->resident > res->budget && res->head && res->head->last_use < res->frame) {
+					mugGL_texture_evict(res->head);
+				}
+			}
 
-						// Return if we aren't taking text input
-						if (!msg.win->props.text_input_callback) {
-							return DefWindowProcW(msg.win->handles.hwnd, msg.uMsg, msg.wParam, msg.lParam);
-						}
+			// Makes sure a texture is resident, reloading it if it was evicted
+			mugResult mugGL_texture_make_resident(mugGL_Texture* tex) {
+				if (tex->handle || tex->pending) {
+					return MUG_SUCCESS;
+				}
+				mugGL_Residency* res = tex->res;
 
-						// Convert UTF-16 wParam to wchar_t* UTF-16 string
-						WCHAR wstr[3];
-						// - Surrogate pair
-						if (msg.win->temp.high_surrogate) {
-							wstr[0] = msg.win->temp.high_surrogate;
-							wstr[1] = (WCHAR)msg.wParam;
-							wstr[2] = 0;
-							// (Reset high surrogate)
-							msg.win->temp.high_surrogate = 0;
-						}
-						// - Non-surrogate pair
-						else {
-							wstr[0] = (WCHAR)msg.wParam;
-							wstr[1] = 0;
-						}
+				// Get pixel data from reload callback
+				// (staying evicted if there's no memory to reload into)
+				muByte* data = (muByte*)mug_alloc(tex->data_size, MUG_ALLOC_SCRATCH);
+				if (!data) {
+					return MUG_FAILED_MALLOC;
+				}
+				tex->reload(tex, tex->reload_user, data);
 
-						// Convert wchar_t* UTF-16 string to UTF-8 string
-						uint8_m buf[5];
-						if (!WideCharToMultiByte(CP_UTF8, WC_ERR_INVALID_CHARS, wstr, -1, (LPSTR)buf, sizeof(buf), NULL, NULL)) {
-							return 0;
-						}
+				// Reallocate storage
+				mugResult result = mugGL_texture_allocate(tex, data);
+				mug_dealloc(data, MUG_ALLOC_SCRATCH);
+				if (mug_result_is_fatal(result)) {
+					return result;
+				}
 
-						// Callback
-						msg.win->props.text_input_callback(msg.win, buf);
-						return 0;
+				// Track as resident
+				mugGL_residency_add(res, tex);
+				++res->reloads;
+				tex->last_use = res->frame;
+				mugGL_residency_list(res, tex);
+				mugGL_residency_trim(res);
+				return MUG_SUCCESS;
+			}
+
+			// Fills in a texture's description from texture info and dimensions
+			// 2D: dim[2]
+			// 2D-array: dim[3]
+			// mips_given is whether or not the mipmap levels will be given rather than generated
+			void mugGL_texture_describe(mugGL_Texture* tex, mugTextureInfo* info, uint32_m* dim, muBool mips_given) {
+				// Get equivalent target and format
+				tex->target = mugGL_texture_type(info->type);
+				tex->format_id = info->format;
+				// - RGB is stored as RGBA, as GPUs lack 3-byte pixel formats
+				tex->store_id = (info->format == MUG_TEXTURE_U8_RGB) ? (MUG_TEXTURE_U8_RGBA) : (info->format);
+				tex->convert = mugConv_flags(info->format, info->convert);
+				tex->format = mugGL_texture_format_format(tex->store_id);
+				tex->type = mugGL_texture_format_type(tex->store_id);
+				tex->internal = mugGL_texture_format_internal(tex->store_id);
+				tex->block_size = mug_texture_format_size(info->format);
+				tex->block_dim = mug_texture_format_block(info->format);
+				tex->dim[0] = dim[0];
+				tex->dim[1] = dim[1];
+				tex->dim[2] = (info->type == MUG_TEXTURE_2D_ARRAY) ? (dim[2]) : (1);
+
+				// Wrapping
+				tex->wrapping[0] = mugGL_texture_wrapping(info->wrapping[0]);
+				tex->wrapping[1] = mugGL_texture_wrapping(info->wrapping[1]);
+				// Filtering
+				tex->filtering[0] = mugGL_texture_filtering(info->filtering[0]);
+				// - Mipmaps can't be generated for compressed textures
+				mugTextureFiltering min_filter = info->filtering[1];
+				if (tex->block_dim > 1 && min_filter == MUG_TEXTURE_TRILINEAR && !mips_given) {
+					min_filter = MUG_TEXTURE_BILINEAR;
+				}
+				tex->filtering[1] = mugGL_texture_min_filtering(min_filter);
+
+				// Calculate amount of mipmap levels
+				tex->levels = 1;
+				if (min_filter == MUG_TEXTURE_TRILINEAR) {
+					uint32_m size = (dim[0] > dim[1]) ? (dim[0]) : (dim[1]);
+					while ((size >>= 1) && (!info->mip_levels || tex->levels < info->mip_levels)) {
+						++tex->levels;
 					}
+				}
 
-					// Handling for WM_IME_STARTCOMPOSITION
-					LRESULT CALLBACK muCOSAW32_IME_STARTCOMPOSITION(muCOSAW32_ProcMsg msg) {
-						// Get IMM context handle
-						HIMC imc = ImmGetContext(msg.win->handles.hwnd);
+				// Calculate sizes
+				tex->data_size = mug_texture_data_size(info->format, tex->dim[0], tex->dim[1]) * tex->dim[2];
+				tex->bytes = 0;
+				for (uint32_m l = 0; l < tex->levels; ++l) {
+					uint32_m w = tex->dim[0] >> l, h = tex->dim[1] >> l;
+					tex->bytes += mug_texture_data_size(tex->store_id, (w) ? (w) : (1), (h) ? (h) : (1)) * tex->dim[2];
+				}
+			}
 
-						// Fill out composition form
-						COMPOSITIONFORM cf = MU_ZERO_STRUCT(COMPOSITIONFORM);
-						cf.dwStyle = CFS_FORCE_POSITION;
-						cf.ptCurrentPos.x = msg.win->props.text_cursor_x;
-						cf.ptCurrentPos.y = msg.win->props.text_cursor_y;
+			// Allocates a texture container with no storage
+			mugGL_Texture* mugGL_texture_alloc(mugResult* result, uint32_m formats, mugGL_Residency* res, mugTextureInfo* info) {
+				// Make sure format is known and supported
+				if (info->format > MUG_TEXTURE_BC7_RGBA || !(formats & (1 << info->format))) {
+					MU_SET_RESULT(result, MUG_UNSUPPORTED_TEXTURE_FORMAT)
+					return 0;
+				}
 
-						// Send composition form
-						if (!ImmSetCompositionWindow(imc, &cf)) {
-							return 0;
-						}
+				// Allocate the texture container
+				mugGL_Texture* tex = (mugGL_Texture*)mug_alloc(sizeof(mugGL_Texture), MUG_ALLOC_TEXTURE);
+				if (!tex) {
+					MU_SET_RESULT(result, MUG_FAILED_MALLOC)
+					return 0;
+				}
+				mu_memset(tex, 0, sizeof(mugGL_Texture));
+				tex->res = res;
+				tex->target = mugGL_texture_type(info->type);
+				return tex;
+			}
 
-						// Release IMM context handle
-						ImmReleaseContext(msg.win->handles.hwnd, imc);
-						return 0;
-					}
+			// Creates a texture
+			// 2D: dim[2]
+			// 2D-array: dim[3]
+			// formats is the bitmask of supported formats
+			mugGL_Texture* mugGL_texture_create(mugResult* result, uint32_m formats, mugGL_Residency* res, mugTextureInfo* info, uint32_m* dim, muByte* data) {
+				// Allocate the texture container
+				mugGL_Texture* tex = mugGL_texture_alloc(result, formats, res, info);
+				if (!tex) {
+					return 0;
+				}
+				mugGL_texture_describe(tex, info, dim, MU_FALSE);
 
-					// Handles a proc message
-					LRESULT muCOSAW32_procmsg(muCOSAW32_ProcMsg msg) {
-						// Do things based on the message code
-						switch (msg.uMsg) {
-							// Message code we're not processing; return default handling at end of switch
-							default: break;
-							// Window closing
-							case WM_DESTROY: return muCOSAW32_DESTROY(msg); break;
-							// Key down
-							case WM_KEYDOWN: return muCOSAW32_KEY(msg, MU_TRUE); break;
-							// Key up
-							case WM_KEYUP: return muCOSAW32_KEY(msg, MU_FALSE); break;
-							// Left mouse up
-							case WM_LBUTTONUP: return muCOSAW32_MBUTTON(msg, MU_MOUSE_LEFT, MU_FALSE); break;
-							// Left mouse down
-							case WM_LBUTTONDOWN: return muCOSAW32_MBUTTON(msg, MU_MOUSE_LEFT, MU_TRUE); break;
-							// Right mouse up
-							case WM_RBUTTONUP: return muCOSAW32_MBUTTON(msg, MU_MOUSE_RIGHT, MU_FALSE); break;
-							// Right mouse down
-							case WM_RBUTTONDOWN: return muCOSAW32_MBUTTON(msg, MU_MOUSE_RIGHT, MU_TRUE); break;
-							// Middle mouse up
-							case WM_MBUTTONUP: return muCOSAW32_MBUTTON(msg, MU_MOUSE_MIDDLE, MU_FALSE); break;
-							// Middle mouse down
-							case WM_MBUTTONDOWN: return muCOSAW32_MBUTTON(msg, MU_MOUSE_MIDDLE, MU_TRUE); break;
-							// Cursor style changing
-							case WM_SETCURSOR: return muCOSAW32_SETCURSOR(msg); break;
-							// Windows asking for min/max dimensions
-							case WM_GETMINMAXINFO: return muCOSAW32_GETMINMAXINFO(msg); break;
-							// Scrolling
-							case WM_MOUSEWHEEL: return muCOSAW32_MOUSEWHEEL(msg); break;
-							// Resizing
-							case WM_SIZE: return muCOSAW32_SIZE(msg); break;
-							// Movement
-							case WM_MOVE: return muCOSAW32_MOVE(msg); break;
-							// Character input
-							case WM_CHAR: return muCOSAW32_CHAR(msg); break;
-							// IME composition position
-							case WM_IME_STARTCOMPOSITION: return muCOSAW32_IME_STARTCOMPOSITION(msg); break;
-						}
+				// Allocate storage
+				mugResult res_alloc = mugGL_texture_allocate(tex, data);
+				if (res_alloc != MUG_SUCCESS) {
+					MU_SET_RESULT(result, res_alloc)
+					mug_dealloc(tex, MUG_ALLOC_TEXTURE);
+					return 0;
+				}
 
-						// Default handling
-						return DefWindowProcW(msg.win->handles.hwnd, msg.uMsg, msg.wParam, msg.lParam);
-					}
+				// Track as resident, evicting others if over budget
+				mugGL_residency_add(res, tex);
+				mugGL_residency_trim(res);
+				return tex;
+			}
 
-					// Proc function for Win32
-					LRESULT CALLBACK muCOSAW32_winproc(HWND hwnd, UINT uMsg, WPARAM wParam, LPARAM lParam) {
-						// Return default if hwnd is NULL
-						if (!hwnd) {
-							return DefWindowProcW(hwnd, uMsg, wParam, lParam);
-						}
+			// Creates a texture from the pixel data of given_levels mipmap levels
+			// laid out one after another (like in a texture file)
+			// dim[3] (depth is 1 for non-array textures)
+			mugGL_Texture* mugGL_texture_create_levels(mugResult* result, uint32_m formats, mugGL_Residency* res, mugGL_UploadRing* ring, mugTextureInfo* info, uint32_m* dim, uint32_m given_levels, muByte* data) {
+				// Allocate the texture container
+				mugGL_Texture* tex = mugGL_texture_alloc(result, formats, res, info);
+				if (!tex) {
+					return 0;
+				}
 
-						// Start getting info about the proc
-						muCOSAW32_ProcMsg msg;
+				// Limit mipmap levels to those given, if more than one is
+				mugTextureInfo level_info = *info;
+				if (given_levels > 1) {
+					level_info.mip_levels = given_levels;
+				}
+				mugGL_texture_describe(tex, &level_info, dim, given_levels > 1);
 
-						// Find window based on HWND
-						msg.win = muCOSAW32_window_pmap_find(hwnd);
-						if (!msg.win) {
-							return DefWindowProcW(hwnd, uMsg, wParam, lParam);
-						}
+				// Allocate storage
+				mugResult res_alloc = mugGL_texture_allocate_levels(tex, ring, given_levels, data);
+				if (res_alloc != MUG_SUCCESS) {
+					MU_SET_RESULT(result, res_alloc)
+					mug_dealloc(tex, MUG_ALLOC_TEXTURE);
+					return 0;
+				}
 
-						// Copy over other info
-						msg.uMsg = uMsg;
-						msg.wParam = wParam;
-						msg.lParam = lParam;
+				// Track as resident, evicting others if over budget
+				mugGL_residency_add(res, tex);
+				mugGL_residency_trim(res);
+				return tex;
+			}
 
-						// Return proc message handling
-						return muCOSAW32_procmsg(msg);
-					}
+			// Creates a placeholder texture to be loaded asynchronously
+			// (renders as black until loaded)
+			mugGL_Texture* mugGL_texture_placeholder(mugResult* result, uint32_m formats, mugGL_Residency* res, mugTextureInfo* info, mug_LoadJob* job) {
+				mugGL_Texture* tex = mugGL_texture_alloc(result, formats, res, info);
+				if (tex) {
+					tex->pending = MU_TRUE;
+					tex->load_job = job;
+				}
+				return tex;
+			}
 
-				/* Creation / Destruction */
+			// Allocates the storage of a texture being loaded asynchronously once its size is known
+			mugResult mugGL_texture_load_allocate(mugGL_Texture* tex, mugTextureInfo* info, uint32_m* dim) {
+				mugGL_texture_describe(tex, info, dim, MU_FALSE);
+				mugResult res = mugGL_texture_allocate(tex, 0);
+				if (res != MUG_SUCCESS) {
+					return res;
+				}
+				mugGL_residency_add(tex->res, tex);
+				mugGL_residency_trim(tex->res);
+				return MUG_SUCCESS;
+			}
 
-					muCOSAResult muCOSAW32_window_set_position(muCOSAW32_Window* win, int32_m* data);
+			// Marks a texture loaded asynchronously as finished
+			void mugGL_texture_load_finish(mugGL_Texture* tex, mugResult result) {
+				tex->load_job = 0;
+				if (result == MUG_SUCCESS) {
+					tex->pending = MU_FALSE;
+				}
+			}
 
-					muCOSAResult muCOSAW32_window_create(muWindowInfo* info, muCOSAW32_Window* win) {
-						/* Default attributes */
+			// Binds a texture
+			void mugGL_texture_bind(mugGL_Texture* tex) {
+				glBindTexture(tex->target, tex->handle);
+			}
 
-							// Zero-ing-out
-							mu_memset(&win->handles, 0, sizeof(win->handles));
-							mu_memset(&win->keymaps, 0, sizeof(win->keymaps));
+			// Binds a texture for rendering, reloading it if it was evicted,
+			// regenerating its mipmaps if needed, and marking it as used
+			void mugGL_texture_bind_render(mugGL_Texture* tex) {
+				// Render as black if not loaded yet
+				if (tex->pending) {
+					glBindTexture(tex->target, 0);
+					return;
+				}
+				mugGL_texture_make_resident(tex);
+				glBindTexture(tex->target, tex->handle);
+				if (tex->mips_dirty) {
+					glGenerateMipmap(tex->target);
+					tex->mips_dirty = MU_FALSE;
+				}
+				if (tex->listed) {
+					tex->last_use = tex->res->frame;
+					mugGL_residency_list(tex->res, tex);
+				}
+			}
 
-							// Closed
-							win->states.closed = MU_FALSE;
+			// Sets the reload callback of a texture (0 for not evictable)
+			mugResult mugGL_texture_evictable(mugGL_Texture* tex, mugTextureReload reload, void* user) {
+				if (tex->pending) {
+					return MUG_TEXTURE_NOT_LOADED;
+				}
+				// Evicting would delete the handle attached to the render target's framebuffer
+				if (tex->render_target) {
+					return MUG_UNSUPPORTED_TEXTURE_FORMAT;
+				}
+				// Compressed mipmap levels can't be regenerated after reloading
+				if (reload && tex->block_dim > 1 && tex->levels > 1) {
+					return MUG_UNSUPPORTED_TEXTURE_FORMAT;
+				}
 
-							// Cursor style
-							win->states.cursor_style = MU_CURSOR_ARROW;
+				// Make sure texture is resident to begin with
+				mugResult res = mugGL_texture_make_resident(tex);
+				if (mug_result_is_fatal(res)) {
+					return res;
+				}
 
-							// Pixel format
-							if (info->pixel_format) {
-								win->props.use_format = MU_TRUE;
-								win->props.format = *info->pixel_format;
-							} else {
-								win->props.use_format = MU_FALSE;
-							}
-							win->props.format_set = MU_FALSE;
+				tex->reload = reload;
+				tex->reload_user = user;
 
-							// Min/Max dimensions
-							win->props.min_width = info->min_width;
-							win->props.min_height = info->min_height;
-							win->props.max_width = info->max_width;
-							win->props.max_height = info->max_height;
-							// - (Fix 0 defaults)
-							if (win->props.min_width == 0) {
-								win->props.min_width = 120;
-							}
-							if (win->props.min_height == 0) {
-								win->props.min_height = 1;
-							}
-							if (win->props.max_width == 0) {
-								win->props.max_width = 0x0FFFFFFF;
-							}
-							if (win->props.max_height == 0) {
-								win->props.max_height = 0x0FFFFFFF;
-							}
+				// Not evictable
+				if (!reload) {
+					mugGL_residency_unlist(tex->res, tex);
+					return res;
+				}
 
-							// Scroll level
-							win->props.scroll_level = 0;
+				// Evictable
+				tex->last_use = tex->res->frame;
+				mugGL_residency_list(tex->res, tex);
+				mugGL_residency_trim(tex->res);
+				return res;
+			}
 
-							// Cursor position
-							win->props.cursor_x = win->props.cursor_y = 0;
+			// Transfers pixels to a region of a texture
+			// size is the size of the pixel data (only used for compressed textures)
+			// Texture is expected to be bound
+			void mugGL_texture_transfer(mugGL_Texture* tex, uint32_m x, uint32_m y, uint32_m layer, uint32_m w, uint32_m h, GLsizei size, const void* pixels) {
+				// Compressed
+				if (tex->block_dim > 1) {
+					if (tex->target == GL_TEXTURE_2D_ARRAY) {
+						glCompressedTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, x, y, layer, w, h, 1, tex->internal, size, pixels);
+					} else {
+						glCompressedTexSubImage2D(tex->target, 0, x, y, w, h, tex->internal, size, pixels);
+					}
+					return;
+				}
 
-							// Callbacks
-							// - Zero-out if no callbacks specified
-							if (!info->callbacks) {
-								mu_memset(&win->callbacks, 0, sizeof(win->callbacks));
-							}
-							// - Set all callbacks if specified
-							else {
-								win->callbacks = *info->callbacks;
-							}
+				// Uncompressed
+				if (tex->target == GL_TEXTURE_2D_ARRAY) {
+					glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, x, y, layer, w, h, 1, tex->format, tex->type, pixels);
+				} else {
+					glTexSubImage2D(tex->target, 0, x, y, w, h, tex->format, tex->type, pixels);
+				}
+			}
+
+			// Updates a region of a texture via the upload ring
+			void mugGL_texture_subimage(mugResult* result, mugGL_UploadRing* ring, mugGL_Texture* tex, uint32_m x, uint32_m y, uint32_m layer, uint32_m w, uint32_m h, uint32_m row_stride, muByte* data) {
+				// Make sure region is within texture
+				if (w > tex->dim[0] || x > tex->dim[0]-w || h > tex->dim[1] || y > tex->dim[1]-h || layer >= tex->dim[2]) {
+					MU_SET_RESULT(result, MUG_INVALID_TEXTURE_REGION)
+					return;
+				}
+				// Make sure region is aligned to blocks
+				uint32_m bd = tex->block_dim;
+				if (x % bd || y % bd || (w % bd && x+w != tex->dim[0]) || (h % bd && y+h != tex->dim[1])) {
+					MU_SET_RESULT(result, MUG_INVALID_TEXTURE_REGION)
+					return;
+				}
+				if (!w || !h) {
+					return;
+				}
+
+				// Reload texture if it was evicted
+				mugResult res = mugGL_texture_make_resident(tex);
+				if (mug_result_is_fatal(res)) {
+					MU_SET_RESULT(result, res)
+					return;
+				}
+
+				// Calculate sizes (in rows of blocks)
+				uint32_m rows = (h + bd-1) / bd;
+				size_m row_size = (size_m)((w + bd-1) / bd) * tex->block_size;
+				size_m stride = (row_stride) ? (row_stride) : (row_size);
+				muBool converts = mugGL_texture_converts(tex);
+				size_m store_row_size = (converts) ? ((size_m)w * mug_texture_format_size(tex->store_id)) : (row_size);
+				GLsizeiptr size = (GLsizeiptr)(store_row_size * rows);
+
+				mugGL_texture_bind(tex);
+
+				// Copy pixels into next buffer in ring, packing rows
+				// (and converting them if needed)
+				muByte* mapped = mugGL_upload_ring_map(ring, size);
+				if (mapped) {
+					if (converts) {
+						mugGL_texture_convert_rows(tex, mapped, data, w, rows, stride);
+					} else for (uint32_m r = 0; r < rows; ++r) {
+						mu_memcpy(&mapped[r*row_size], &data[r*stride], row_size);
+					}
+					// Transfer from buffer if its contents survived unmapping
+					if (glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER)) {
+						mugGL_texture_transfer(tex, x, y, layer, w, h, (GLsizei)size, 0);
+						glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+						tex->mips_dirty = tex->levels > 1;
+						return;
+					}
+				}
+				glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+				// Fall back to transferring directly from data...
+				// - Converted into a temporary buffer
+				if (converts) {
+					muByte* temp = (muByte*)mug_alloc((size_m)size, MUG_ALLOC_SCRATCH);
+					if (!temp) {
+						MU_SET_RESULT(result, MUG_FAILED_MALLOC)
+						return;
+					}
+					mugGL_texture_convert_rows(tex, temp, data, w, rows, stride);
+					mugGL_texture_transfer(tex, x, y, layer, w, h, (GLsizei)size, temp);
+					mug_dealloc(temp, MUG_ALLOC_SCRATCH);
+				}
+				// - In one transfer, letting GL skip the rest of each row
+				else if (bd == 1 && stride % tex->block_size == 0) {
+					glPixelStorei(GL_UNPACK_ROW_LENGTH, (GLint)(stride / tex->block_size));
+					mugGL_texture_transfer(tex, x, y, layer, w, h, (GLsizei)size, data);
+					glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+				}
+				// - Row by row
+				else for (uint32_m r = 0; r < rows; ++r) {
+					uint32_m rh = (h - r*bd < bd) ? (h - r*bd) : (bd);
+					mugGL_texture_transfer(tex, x, y+r*bd, layer, w, rh, (GLsizei)row_size, &data[r*stride]);
+				}
+				tex->mips_dirty = tex->levels > 1;
+			}
 
-							// Text focus
-							win->props.text_input_callback = 0;
-							win->props.text_cursor_x = win->props.text_cursor_y = 0;
+			// Changes the amount of layers of a texture array, keeping the pixels of
+			// the layers that remain by copying them through a buffer on the GPU
+			// (GL 3.3 lacks glCopyImageSubData); mipmap levels are regenerated
+			mugResult mugGL_texture_resize_layers(mugGL_Texture* tex, uint32_m depth) {
+				if (tex->pending) {
+					return MUG_TEXTURE_NOT_LOADED;
+				}
+				// Reallocating would replace the handle attached to the render target's framebuffer
+				if (tex->render_target) {
+					return MUG_UNSUPPORTED_TEXTURE_FORMAT;
+				}
+				// Compressed mipmap levels can't be regenerated after copying
+				if (tex->block_dim > 1 && tex->levels > 1) {
+					return MUG_UNSUPPORTED_TEXTURE_FORMAT;
+				}
+				if (depth == tex->dim[2]) {
+					return MUG_SUCCESS;
+				}
 
-							// High surrogate for WM_CHAR messages
-							win->temp.high_surrogate = 0;
+				// Reload texture if it was evicted
+				mugResult res = mugGL_texture_make_resident(tex);
+				if (mug_result_is_fatal(res)) {
+					return res;
+				}
 
-						/* Class */
+				// Calculate size of a layer, as stored
+				uint32_m bd = tex->block_dim;
+				size_m layer_size = mug_texture_data_size(tex->store_id, tex->dim[0], tex->dim[1]);
+				uint32_m keep = (depth < tex->dim[2]) ? (depth) : (tex->dim[2]);
+
+				// Read level 0 of every layer into a buffer
+				mug_Memory* mem = tex->res->memory;
+				size_m pbo_size = layer_size*tex->dim[2];
+				GLuint pbo = 0;
+				glGenBuffers(1, &pbo);
+				if (!pbo) {
+					return MUG_GL_FAILED_CREATE_BUFFER;
+				}
+				glBindBuffer(GL_PIXEL_PACK_BUFFER, pbo);
+				glBufferData(GL_PIXEL_PACK_BUFFER, (GLsizeiptr)pbo_size, 0, GL_STREAM_COPY);
+				mug_memory_add(mem, &mem->report.staging, pbo_size, pbo_size);
+				glBindTexture(tex->target, tex->handle);
+				if (bd > 1) {
+					glGetCompressedTexImage(tex->target, 0, 0);
+				} else {
+					glGetTexImage(tex->target, 0, tex->format, tex->type, 0);
+				}
+				glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+				// Allocate new storage
+				GLuint old = tex->handle;
+				uint32_m old_depth = tex->dim[2];
+				size_m old_data_size = tex->data_size, old_bytes = tex->bytes, old_base = mugGL_texture_base_bytes(tex);
+				tex->data_size = (old_data_size / old_depth) * depth;
+				tex->bytes = (old_bytes / old_depth) * depth;
+				tex->dim[2] = depth;
+				res = mugGL_texture_allocate(tex, 0);
+				if (res != MUG_SUCCESS) {
+					tex->handle = old;
+					tex->dim[2] = old_depth;
+					tex->data_size = old_data_size;
+					tex->bytes = old_bytes;
+					glDeleteBuffers(1, &pbo);
+					mug_memory_remove(mem, &mem->report.staging, pbo_size, pbo_size);
+					return res;
+				}
 
-							// Window title
-							wchar_t* wname = muCOSAW32_utf8_to_wchar(info->title);
-							if (!wname) {
-								return MUCOSA_WIN32_FAILED_CONVERT_UTF8_TO_WCHAR;
-							}
+				// Copy kept layers from buffer
+				glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo);
+				if (bd > 1) {
+					glCompressedTexSubImage3D(tex->target, 0, 0, 0, 0, tex->dim[0], tex->dim[1], keep, tex->internal, (GLsizei)(layer_size*keep), 0);
+				} else {
+					glTexSubImage3D(tex->target, 0, 0, 0, 0, tex->dim[0], tex->dim[1], keep, tex->format, tex->type, 0);
+				}
+				glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+				glDeleteBuffers(1, &pbo);
+				glDeleteTextures(1, &old);
+
+				// Update residency
+				// (New storage is counted before the old storage is uncounted,
+				// as both existed at once)
+				tex->res->resident = tex->res->resident - old_bytes + tex->bytes;
+				mug_memory_add(mem, &mem->report.textures, tex->bytes, mugGL_texture_base_bytes(tex));
+				mug_memory_remove(mem, &mem->report.textures, old_bytes, old_base);
+				mug_memory_remove(mem, &mem->report.staging, pbo_size, pbo_size);
+				mem->report.texture_layers = mem->report.texture_layers - old_depth + depth;
+				mugGL_residency_trim(tex->res);
+				return MUG_SUCCESS;
+			}
 
-							// This is some of the jankiest code I've written!
-							// To generate a unique window class, I hamfistedly
-							// attempt to generate one by adding the actual pointer
-							// value of 'win' to a character, creating an often
-							// unreadable class title. This needs to be improved
-							// at some point, but works for me :P
+			// Destroys the buffers of an upload ring
+			void mugGL_upload_ring_destroy(mugGL_UploadRing* ring) {
+				for (uint32_m i = 0; i < MUGGL_UPLOAD_RING_COUNT; ++i) {
+					if (ring->pbos[i]) {
+						glDeleteBuffers(1, &ring->pbos[i]);
+						mug_memory_remove(ring->memory, &ring->memory->report.staging, (size_m)ring->sizes[i], (size_m)ring->sizes[i]);
+					}
+				}
+				mu_memset(ring, 0, sizeof(mugGL_UploadRing));
+			}
 
-							win->handles.wclass_name[0] = (wchar_t)'!';
+			// Destroys a texture
+			void* mugGL_texture_destroy(mugGL_Texture* tex) {
+				// Cancel asynchronous loading
+				if (tex->load_job) {
+					mugLoad_detach(tex->load_job);
+				}
+				// Destroy texture if resident
+				if (tex->handle) {
+					mugGL_residency_unlist(tex->res, tex);
+					glDeleteTextures(1, &tex->handle);
+					mugGL_residency_remove(tex->res, tex);
+				}
+				// Free container
+				mug_dealloc(tex, MUG_ALLOC_TEXTURE);
+				// Return null
+				return 0;
+			}
 
-							wchar_t add; // (Purposely left uninitialized for more randomness)
-							if (sizeof(wchar_t) < sizeof(win)) {
-								mu_memcpy(&add, &win, sizeof(wchar_t));
-							} else {
-								mu_memcpy(&add, &win, sizeof(win));
-							}
+		/* General buffer logic */
 
-							win->handles.wclass_name[0] += add;
-							win->handles.wclass_name[1] = (wchar_t)'\0';
+			// Struct for an object buffer
+			typedef struct mugGL_ObjBuffer mugGL_ObjBuffer;
+			struct mugGL_ObjBuffer {
+				// Vertex array object
+				GLuint vao;
+				// Vertex buffer object
+				GLuint vbo;
+				// Index buffer object
+				GLuint ebo;
 
-							// Hinstance
-							win->handles.hinstance = muCOSAW32_get_hinstance();
-							// Hcursor
-							win->handles.hcursor = LoadCursor(NULL, IDC_ARROW);
+				// Object type
+				mugObjectType obj_type;
+				// Amount of objects stored
+				uint32_m obj_count;
 
-							// Create class struct
-							WNDCLASSEXW wclass = MU_ZERO_STRUCT(WNDCLASSEXW);
-							wclass.cbSize = sizeof(wclass);
-							wclass.style = CS_HREDRAW | CS_VREDRAW | CS_OWNDC;
-							wclass.lpfnWndProc = muCOSAW32_winproc;
-							wclass.hInstance = win->handles.hinstance;
-							wclass.hCursor = win->handles.hcursor;
-							wclass.lpszMenuName = wname;
-							wclass.lpszClassName = win->handles.wclass_name;
+				// Amount of bytes used for each object on vertexes
+				uint32_m bv_per_obj;
+				// Corresponding vertex buffer size (obj_count*bv_per_obj)
+				uint32_m vbuf_size;
+				// Amount of vertexes for each object
+				uint32_m v_per_obj;
 
-							// Register
-							if(!RegisterClassExW(&wclass)) {
-								mu_free(wname);
-								return MUCOSA_WIN32_FAILED_REGISTER_WINDOW_CLASS;
-							}
+				// Amount of bytes used for each object on indexes
+				uint32_m bi_per_obj;
+				// Corresponding index buffer size (obj_count*bi_per_obj)
+				uint32_m ibuf_size;
+				// Stores if index data has been filled already to correct size
+				// Set this to false to make fill commands regenerate index data;
+				// used upon initialization of buffer and (possibly later imp.)
+				// resizing. Index data is not considered in subfilling.
+				muBool index_filled;
 
-						/* Window */
+				// Optional handle to a texture
+				mugGL_Texture* tex;
 
-							// Style
-							DWORD style = WS_OVERLAPPEDWINDOW;
+				// Function used to fill all vertex data
+				void (*fill_vertexes)(GLfloat* v, void* obj, uint32_m c);
+				// Function used to fill all index data
+				// If this function is null, ebo is not generated
+				void (*fill_indexes)(GLuint* i, uint32_m c);
+				// Function used to describe data
+				void (*desc)(void);
+				// Function that renders with all relevant objects already binded
+				void (*render)(mugGL_ObjBuffer*);
+				// Same but subrenders
+				void (*subrender)(uint32_m o, uint32_m c);
+				// Same but renders n ranges at once
+				// o and c are overwritten; p has room for n pointers
+				void (*multirender)(uint32_m* o, uint32_m* c, const void** p, uint32_m n);
+
+				// Optional spatial index over object bounds
+				mug_SpatialIndex* index;
+				// Copy of vertex data (only kept with spatial index)
+				GLfloat* vertexes;
+				// Function that returns the coverage of an object at a point,
+				// matching the fragment shader; v is the object's vertex data
+				float (*cover)(GLfloat* v, float x, float y);
+				// Function that returns if an object overlaps an area
+				muBool (*overlaps)(GLfloat* v, float* area);
+
+				// Draw statistics and trace of the graphic that the buffer belongs to
+				mug_Stats* stats;
+				mug_Trace* trace;
+				// Damage tracking of the graphic that the buffer draws to (0 if untracked)
+				mug_Damage* damage;
+				// Bounds of each object last filled, used for damage tracking
+				// (only kept while tracking is enabled)
+				float* bounds;
+				uint32_m bounds_count;
+
+				// GPU memory tracking of the graphic that the buffer belongs to,
+				// and the usage that the buffer counts towards
+				mug_Memory* memory;
+				mugMemoryUsage* memory_usage;
+				// Bytes that the buffer is counted as holding, and using
+				size_m memory_bytes;
+				size_m memory_used;
+			};
 
-							// Rect for the window's dimensions
-							RECT r;
-							r.left = r.top = 0;
-							r.right = (LONG)info->width;
-							r.bottom = (LONG)info->height;
-							AdjustWindowRect(&r, style, FALSE);
+			// Checks if a given buffer is the expected size
+			muBool mugGL_buffer_size_check(int buftype, uint32_m size) {
+				// Get size
+				GLint realsize = 0;
+				glGetBufferParameteriv(buftype, GL_BUFFER_SIZE, &realsize);
 
-							// Create window
-							win->handles.hwnd = CreateWindowExW(
-								// dwExStyle
-								0,
-								// lpClassName
-								wclass.lpszClassName,
-								// lpWindowName
-								wclass.lpszMenuName,
-								// dwStyle
-								style,
-								// X, Y,
-								(int)info->x, (int)info->y,
-								// nWidth, nHeight
-								r.right-r.left, r.bottom-r.top,
-								// hWndParent
-								NULL,
-								// hMenu
-								NULL,
-								// hInstance
-								win->handles.hinstance,
-								// lpParam
-								NULL
-							);
+				// Return if buffer size given is valid
+				return realsize == (GLint)(size);
+			}
 
-							// - Handle fail case
-							mu_free(wname);
-							if (win->handles.hwnd == NULL) {
-								UnregisterClassW(win->handles.wclass_name, win->handles.hinstance);
-								return MUCOSA_WIN32_FAILED_CREATE_WINDOW;
-							}
+			// Updates the spatial index of a buffer from a range of vertex data
+			// Matches the size of the spatial index and vertex copy to the buffer
+			// Both are cleared if the size changes
+			mugResult mugGL_objects_index_sync(mugGL_ObjBuffer* buf) {
+				// Exit if sizes match
+				if (buf->index->obj_count == buf->obj_count) {
+					return MUG_SUCCESS;
+				}
 
-						/* Pixel format */
+				// Resize vertex copy
+				GLfloat* vertexes = (GLfloat*)mug_realloc(buf->vertexes, (buf->vbuf_size) ? (buf->vbuf_size) : (1), MUG_ALLOC_VERTEXES);
+				if (!vertexes) {
+					return MUG_FAILED_REALLOC;
+				}
+				buf->vertexes = vertexes;
 
-							// Get device context
-							win->handles.dc = GetDC(win->handles.hwnd);
+				// Resize index
+				return mugIndex_resize(buf->index, buf->obj_count);
+			}
 
-							// Handle default pixel format:
-							if (!info->pixel_format) {
-								// Generic pixel format descriptor
-								// Based on https://www.khronos.org/opengl/wiki/Creating_an_OpenGL_Context_(WGL)
-								PIXELFORMATDESCRIPTOR pfd = {
-									sizeof(PIXELFORMATDESCRIPTOR),
-									1,
-									PFD_DRAW_TO_WINDOW | PFD_SUPPORT_OPENGL | PFD_DOUBLEBUFFER,
-									PFD_TYPE_RGBA,
-									32,
-									0, 0, 0, 0, 0, 0,
-									0, 0, 0,
-									0, 0, 0, 0,
-									24, 8, 8,
-									PFD_MAIN_PLANE,
-									0,
-									0, 0, 0
-								};
+			// Updates the spatial index from a range of the vertex copy
+			mugResult mugGL_objects_index_vertexes(mugGL_ObjBuffer* buf, uint32_m obj_offset, uint32_m obj_count) {
+				return mugIndex_set_vertexes(buf->index, obj_offset, obj_count, &buf->vertexes[(obj_offset*buf->bv_per_obj)/sizeof(GLfloat)],
+					buf->bv_per_obj / buf->v_per_obj / sizeof(GLfloat), buf->v_per_obj
+				);
+			}
 
-								// Find pixel format; fallback on 1
-								win->props.pixel_format = ChoosePixelFormat(win->handles.dc, &pfd);
-								if (!win->props.pixel_format) {
-									win->props.pixel_format = 1;
-								}
-							}
+			// Matches the bounds kept for damage tracking to the buffer's size,
+			// returning whether or not damage is being tracked
+			// Objects whose previous bounds are unknown get unknown bounds,
+			// and objects added by growing the buffer get empty bounds
+			muBool mugGL_objects_bounds_sync(mugGL_ObjBuffer* buf) {
+				// Free bounds if not tracked
+				if (!buf->damage || !buf->damage->enabled) {
+					if (buf->bounds) {
+						mug_dealloc(buf->bounds, MUG_ALLOC_VERTEXES);
+						buf->bounds = 0;
+						buf->bounds_count = 0;
+					}
+					return MU_FALSE;
+				}
 
-							// Show window
-							ShowWindow(win->handles.hwnd, SW_NORMAL);
+				// Exit if sizes match
+				if (buf->bounds && buf->bounds_count == buf->obj_count) {
+					return MU_TRUE;
+				}
 
-						/* Auto-disable IME */
+				// Resize bounds
+				muBool unknown = !buf->bounds;
+				float* bounds = (float*)mug_realloc(buf->bounds, (buf->obj_count ? buf->obj_count : 1)*4*sizeof(float), MUG_ALLOC_VERTEXES);
+				if (!bounds) {
+					mug_damage_full(buf->damage);
+					return MU_FALSE;
+				}
+				buf->bounds = bounds;
+				for (uint32_m i = (unknown) ? (0) : (buf->bounds_count); i < buf->obj_count; ++i) {
+					float* b = &bounds[i*4];
+					if (unknown) {
+						b[0] = b[1] = -MUG_DAMAGE_UNKNOWN;
+						b[2] = b[3] = MUG_DAMAGE_UNKNOWN;
+					} else {
+						b[0] = b[1] = 1.f;
+						b[2] = b[3] = 0.f;
+					}
+				}
+				buf->bounds_count = buf->obj_count;
+				return MU_TRUE;
+			}
 
-							if (ImmAssociateContextEx(win->handles.hwnd, NULL, 0) == FALSE) {
-								// ?
-							}
+			// Damages the previous and new bounds of a range of objects
+			// v holds the new vertex data of the range; if null, the new bounds are empty
+			void mugGL_objects_damage(mugGL_ObjBuffer* buf, uint32_m obj_offset, uint32_m obj_count, const GLfloat* v) {
+				if (!mugGL_objects_bounds_sync(buf)) {
+					return;
+				}
+				uint32_m v_stride = buf->bv_per_obj / buf->v_per_obj / sizeof(GLfloat);
+
+				for (uint32_m i = obj_offset; i < obj_offset+obj_count; ++i) {
+					// Damage previous bounds
+					float* b = &buf->bounds[i*4];
+					mug_damage_object(buf->damage, buf->obj_type, b);
+					if (!v) {
+						b[0] = b[1] = 1.f;
+						b[2] = b[3] = 0.f;
+						continue;
+					}
 
-						/* Set position manually */
+					// Find new bounds of vertexes
+					b[0] = b[2] = v[0];
+					b[1] = b[3] = v[1];
+					for (uint32_m j = 1; j < buf->v_per_obj; ++j) {
+						const GLfloat* vj = &v[j*v_stride];
+						if (vj[0] < b[0]) b[0] = vj[0];
+						if (vj[1] < b[1]) b[1] = vj[1];
+						if (vj[0] > b[2]) b[2] = vj[0];
+						if (vj[1] > b[3]) b[3] = vj[1];
+					}
+					v += buf->v_per_obj*v_stride;
+					// Pad by a pixel (for antialiasing and one-pixel-wide points/lines)
+					b[0] -= 1.f; b[1] -= 1.f; b[2] += 1.f; b[3] += 1.f;
 
-							// A bit of a hack considering that it should work on the first try,
-							// but frame extents on Win32 will be frame extents on Win32.
+					// Damage new bounds
+					mug_damage_object(buf->damage, buf->obj_type, b);
+				}
+			}
 
-							int32_m pos[2] = { info->x, info->y };
-							muCOSAW32_window_set_position(win, pos);
+			// Damages the bounds of every object in a buffer (such as when it's destroyed)
+			void mugGL_objects_damage_all(mugGL_ObjBuffer* buf) {
+				if (!buf->damage || !buf->damage->enabled) {
+					return;
+				}
+				if (!buf->bounds) {
+					mug_damage_full(buf->damage);
+					return;
+				}
+				for (uint32_m i = 0; i < buf->bounds_count; ++i) {
+					mug_damage_object(buf->damage, buf->obj_type, &buf->bounds[i*4]);
+				}
+			}
 
-						/* Add window to pmap */
+			// Tracks the GPU memory held by a buffer, of which up to used bytes are in use
+			void mugGL_objects_track(mugGL_ObjBuffer* buf, size_m used) {
+				size_m bytes = (size_m)buf->vbuf_size + ((buf->fill_indexes) ? (buf->ibuf_size) : (0));
+				used = (used < bytes) ? (used) : (bytes);
+				mug_memory_change(buf->memory, buf->memory_usage, buf->memory_bytes, bytes, buf->memory_used, used);
+				buf->memory_bytes = bytes;
+				buf->memory_used = used;
+			}
 
-							muCOSAResult res = muCOSAW32_window_pmap_add(win);
-							if (muCOSA_result_is_fatal(res)) {
-								return res;
-							}
+			// Moves the GPU memory held by a buffer to count towards another usage
+			void mugGL_objects_track_usage(mugGL_ObjBuffer* buf, mugMemoryUsage* usage) {
+				mugMemoryUsage* old = buf->memory_usage;
+				--old->count;
+				old->bytes -= buf->memory_bytes;
+				old->used -= buf->memory_used;
+				++usage->count;
+				usage->bytes += buf->memory_bytes;
+				usage->used += buf->memory_used;
+				buf->memory_usage = usage;
+			}
+
+			// Fills a buffer; obj can be null to just size buffer
+			mugResult mugGL_objects_fill(mugGL_ObjBuffer* buf, void* obj) {
+				// Bind VAO
+				glBindVertexArray(buf->vao);
+				MUG_STAT(buf->stats, vertex_array_binds, 1)
 
+				// Match spatial index to size
+				if (buf->index) {
+					mugResult res = mugGL_objects_index_sync(buf);
+					if (mug_result_is_fatal(res)) {
+						glBindVertexArray(0);
 						return res;
 					}
+				}
 
-					void muCOSAW32_window_destroy(muCOSAW32_Window* win) {
-						// Release device context
-						ReleaseDC(win->handles.hwnd, win->handles.dc);
-						// Destroy window
-						DestroyWindow(win->handles.hwnd);
-						// Unregister window class
-						UnregisterClassW(win->handles.wclass_name, win->handles.hinstance);
-						// Remove window from pmap
-						muCOSAW32_window_pmap_remove(win);
+				// Vertexes
+				if (obj)
+				{
+					// Allocate vertexes (or use vertex copy if kept)
+					GLfloat* vertexes = (buf->index) ? (buf->vertexes) : ((GLfloat*)mug_alloc(buf->vbuf_size, MUG_ALLOC_SCRATCH));
+					if (!vertexes) {
+						glBindVertexArray(0);
+						return MUG_FAILED_MALLOC;
+					}
+					if (!buf->index) {
+						MUG_STAT(buf->stats, mallocs, 1)
+						MUG_STAT(buf->stats, malloc_bytes, buf->vbuf_size)
 					}
 
-				/* Main loop */
-
-					muBool muCOSAW32_window_get_closed(muCOSAW32_Window* win) {
-						return win->states.closed;
+					// Fill vertex data
+					MUG_STAT_TIME(buf->stats, fill_start)
+					MUG_TRACE_BEGIN(buf->trace, fill_trace)
+					buf->fill_vertexes(vertexes, obj, buf->obj_count);
+					MUG_STAT_TIME_END(buf->stats, fill_time, fill_start)
+					MUG_TRACE_END(buf->trace, "fill vertexes", fill_trace)
+					// Damage previous and new objects
+					mugGL_objects_damage(buf, 0, buf->obj_count, vertexes);
+
+					// Update spatial index
+					if (buf->index) {
+						mugResult res = mugGL_objects_index_vertexes(buf, 0, buf->obj_count);
+						if (mug_result_is_fatal(res)) {
+							glBindVertexArray(0);
+							return res;
+						}
 					}
 
-					void muCOSAW32_window_close(muCOSAW32_Window* win) {
-						// Set closed flag
-						win->states.closed = MU_TRUE;
-					}
+					// Send data to GPU
+					MUG_STAT_TIME(buf->stats, upload_start)
+					MUG_TRACE_BEGIN(buf->trace, upload_trace)
+					glBindBuffer(GL_ARRAY_BUFFER, buf->vbo);
+					glBufferData(GL_ARRAY_BUFFER, buf->vbuf_size, vertexes, GL_DYNAMIC_DRAW);
+					MUG_STAT_TIME_END(buf->stats, upload_time, upload_start)
+					MUG_TRACE_END(buf->trace, "upload", upload_trace)
+					MUG_STAT(buf->stats, upload_bytes, buf->vbuf_size)
 
-					// Checks all keystates and updates accordingly
-					void muCOSAW32_update_keystate(muCOSAW32_Window* win) {
-						// Loop through each possible keystate
-						for (muKeyboardState s = 1; s < MU_KEYSTATE_LENGTH; ++s) {
-							// Assume not on at first
-							muBool b = MU_FALSE;
-							// Convert keystate to Win32
-							int s_w32 = muCOSAW32_keystate_to_W32(s);
-							// If not recognized, continue:
-							if (s_w32 == VK_NONAME) {
-								continue;
-							}
+					// Free vertex data
+					if (!buf->index) {
+						mug_dealloc(vertexes, MUG_ALLOC_SCRATCH);
+					}
 
-							// Set boolean to if it's on or off
-							b = (GetKeyState(s_w32) & 0x0001) != 0;
-							// Change value if different
-							if (b != win->keymaps.keystates[s]) {
-								win->keymaps.keystates[s] = b;
+					// Ensure buffer is expected size
+					if (!mugGL_buffer_size_check(GL_ARRAY_BUFFER, buf->vbuf_size)) {
+						glBindBuffer(GL_ARRAY_BUFFER, 0);
+						glBindVertexArray(0);
+						return MUG_GL_FAILED_ALLOCATE_BUFFER;
+					}
+				}
+				// No vertexes
+				else {
+					mugGL_objects_damage(buf, 0, buf->obj_count, 0);
+					// Clear spatial index and vertex copy, as their contents are no longer valid
+					if (buf->index) {
+						mugIndex_clear(buf->index);
+						mu_memset(buf->vertexes, 0, buf->vbuf_size);
+					}
+					glBindBuffer(GL_ARRAY_BUFFER, buf->vbo);
+					glBufferData(GL_ARRAY_BUFFER, buf->vbuf_size, 0, GL_DYNAMIC_DRAW);
+				}
 
-								// + Callback
-								if (win->callbacks.keystate) {
-									win->callbacks.keystate(win, s, b);
-								}
-							}
-						}
+				// Indexes
+				if (buf->fill_indexes && !buf->index_filled)
+				{
+					// Allocate indexes
+					GLuint* indexes = (GLuint*)mug_alloc(buf->ibuf_size, MUG_ALLOC_SCRATCH);
+					if (!indexes) {
+						glBindBuffer(GL_ARRAY_BUFFER, 0);
+						glBindVertexArray(0);
+						return MUG_FAILED_MALLOC;
 					}
+					MUG_STAT(buf->stats, mallocs, 1)
+					MUG_STAT(buf->stats, malloc_bytes, buf->ibuf_size)
 
-					// Handles the cursor changing position every frame;
-					// no corresponding Win32 proc for this as far as I'm aware :L
-					muCOSAResult muCOSAW32_window_get_cursor_pos(muCOSAW32_Window* win, int32_m* data);
-					void muCOSAW32_update_cursor(muCOSAW32_Window* win) {
-						// Get cursor position
-						int32_m c[2];
-						if (muCOSA_result_is_fatal(muCOSAW32_window_get_cursor_pos(win, c))) {
-							return;
-						}
+					// Fill index data
+					buf->fill_indexes(indexes, buf->obj_count);
 
-						// Update cursor position if changed
-						if (win->props.cursor_x != c[0] || win->props.cursor_y != c[1]) {
-							win->props.cursor_x = c[0];
-							win->props.cursor_y = c[1];
-							// + Callback
-							if (win->callbacks.cursor) {
-								win->callbacks.cursor(win, c[0], c[1]);
-							}
-						}
-					}
+					// Send data to GPU
+					MUG_STAT_TIME(buf->stats, upload_start)
+					MUG_TRACE_BEGIN(buf->trace, upload_trace)
+					glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buf->ebo);
+					glBufferData(GL_ELEMENT_ARRAY_BUFFER, buf->ibuf_size, indexes, GL_STATIC_DRAW);
+					MUG_STAT_TIME_END(buf->stats, upload_time, upload_start)
+					MUG_TRACE_END(buf->trace, "upload", upload_trace)
+					MUG_STAT(buf->stats, index_bytes, buf->ibuf_size)
 
-					void muCOSAW32_window_update(muCOSAW32_Window* win) {
-						// Process messages
-						MSG msg = MU_ZERO_STRUCT(MSG);
-						while (PeekMessageA(&msg, 0, 0, 0, PM_REMOVE)) {
-							TranslateMessage(&msg);
-							DispatchMessage(&msg);
-						}
+					// Free index data
+					mug_dealloc(indexes, MUG_ALLOC_SCRATCH);
 
-						// Update keystates
-						muCOSAW32_update_keystate(win);
-						// Update cursor position
-						muCOSAW32_update_cursor(win);
+					// Ensure buffer is expected size
+					if (!mugGL_buffer_size_check(GL_ELEMENT_ARRAY_BUFFER, buf->ibuf_size)) {
+						glBindBuffer(GL_ARRAY_BUFFER, 0);
+						glBindVertexArray(0);
+						return MUG_GL_FAILED_ALLOCATE_BUFFER;
 					}
 
-				/* Title */
+					// Set index as filled
+					buf->index_filled = MU_TRUE;
+				}
 
-					// Set title
-					muCOSAResult muCOSAW32_window_set_title(muCOSAW32_Window* win, char* data) {
-						// Convert UTF-8 data to wchar_t* data
-						wchar_t* wtitle = muCOSAW32_utf8_to_wchar(data);
-						if (!wtitle) {
-							return MUCOSA_WIN32_FAILED_CONVERT_UTF8_TO_WCHAR;
-						}
+				// Track storage
+				mugGL_objects_track(buf, MU_SIZE_MAX);
 
-						// Set window title
-						if (!SetWindowTextW(win->handles.hwnd, wtitle)) {
-							mu_free(wtitle);
-							return MUCOSA_WIN32_FAILED_SET_WINDOW_ATTRIB;
-						}
+				// Describe data
+				buf->desc();
+				// Unbind and return success
+				glBindBuffer(GL_ARRAY_BUFFER, 0);
+				// glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+				glBindVertexArray(0);
+				return MUG_SUCCESS;
+			}
 
-						mu_free(wtitle);
-						return MUCOSA_SUCCESS;
-					}
+			// Fills a portion of a buffer; obj cannot be null
+			mugResult mugGL_objects_subfill(mugGL_ObjBuffer* buf, uint32_m obj_offset, uint32_m obj_count, void* obj) {
+				// Bind VAO
+				glBindVertexArray(buf->vao);
+				MUG_STAT(buf->stats, vertex_array_binds, 1)
 
-				/* Frame extents */
+				// Vertex data
+				{
+					// Byte amount calcluations
+					uint32_m data_size = obj_count*buf->bv_per_obj;
+					uint32_m data_offset = obj_offset*buf->bv_per_obj;
 
-					// Default frame extents
-					// I love you Bill...
-					void muCOSAW32_def_window_frame_extents(uint32_m* data) {
-						data[0] = data[1] = data[3] = (uint32_m)GetSystemMetrics(SM_CXSIZEFRAME);
-						data[2] = (uint32_m)(GetSystemMetrics(SM_CYFRAME) + GetSystemMetrics(SM_CYCAPTION) + GetSystemMetrics(92));
+					// Allocate vertexes (or use vertex copy if kept)
+					GLfloat* vertexes = (buf->index)
+						? (&buf->vertexes[data_offset/sizeof(GLfloat)])
+						: ((GLfloat*)mug_alloc(data_size, MUG_ALLOC_SCRATCH));
+					if (!vertexes) {
+						glBindVertexArray(0);
+						return MUG_FAILED_MALLOC;
+					}
+					if (!buf->index) {
+						MUG_STAT(buf->stats, mallocs, 1)
+						MUG_STAT(buf->stats, malloc_bytes, data_size)
 					}
 
-					// Get frame extents for a window
-					// I LOVE YOU BILL GATES!!!!!
-					void muCOSAW32_window_get_frame_extents(muCOSAW32_Window* win, uint32_m* data) {
-						// Fallback
-						muCOSAW32_def_window_frame_extents(data);
-
-						// Get window and client rect
-						RECT wr, cr;
-						if (!GetWindowRect(win->handles.hwnd, &wr)) {
-							// (Not returning error since default window frame extents are filled)
-							return;
-						}
-						if (!GetClientRect(win->handles.hwnd, &cr)) {
-							return;
+					// Fill vertex data
+					MUG_STAT_TIME(buf->stats, fill_start)
+					MUG_TRACE_BEGIN(buf->trace, fill_trace)
+					buf->fill_vertexes(vertexes, obj, obj_count);
+					MUG_STAT_TIME_END(buf->stats, fill_time, fill_start)
+					MUG_TRACE_END(buf->trace, "fill vertexes", fill_trace)
+					// Damage previous and new objects
+					mugGL_objects_damage(buf, obj_offset, obj_count, vertexes);
+
+					// Update spatial index
+					if (buf->index) {
+						mugResult res = mugGL_objects_index_vertexes(buf, obj_offset, obj_count);
+						if (mug_result_is_fatal(res)) {
+							glBindVertexArray(0);
+							return res;
 						}
+					}
 
-						// Map client rect to window points
-						if (!MapWindowPoints(win->handles.hwnd, NULL, (LPPOINT)&cr, 2)) {
-							return;
-						}
+					// Send data to GPU
+					MUG_STAT_TIME(buf->stats, upload_start)
+					MUG_TRACE_BEGIN(buf->trace, upload_trace)
+					glBindBuffer(GL_ARRAY_BUFFER, buf->vbo);
+					glBufferSubData(GL_ARRAY_BUFFER, data_offset, data_size, vertexes);
+					MUG_STAT_TIME_END(buf->stats, upload_time, upload_start)
+					MUG_TRACE_END(buf->trace, "upload", upload_trace)
+					MUG_STAT(buf->stats, upload_bytes, data_size)
 
-						// Set values based on window and client rect
-						data[0] = (uint32_m)(cr.left-wr.left);
-						data[1] = (uint32_m)(wr.right-cr.right);
-						data[2] = (uint32_m)(cr.top-wr.top);
-						data[3] = (uint32_m)(wr.bottom-cr.bottom);
+					// Free vertex data
+					if (!buf->index) {
+						mug_dealloc(vertexes, MUG_ALLOC_SCRATCH);
 					}
+				}
 
-				/* Dimensions */
+				// Describe data
+				buf->desc();
+				// Unbind and return success
+				glBindBuffer(GL_ARRAY_BUFFER, 0);
+				glBindVertexArray(0);
+				return MUG_SUCCESS;
+			}
 
-					muCOSAResult muCOSAW32_window_get_dimensions(muCOSAW32_Window* win, uint32_m* data) {
-						// Get client rect
-						RECT r;
-						if (!GetClientRect(win->handles.hwnd, &r)) {
-							return MUCOSA_WIN32_FAILED_GET_WINDOW_ATTRIB;
-						}
+			// Destroys the spatial index and vertex copy of a buffer
+			void mugGL_objects_index_destroy(mugGL_ObjBuffer* buf) {
+				if (buf->index) {
+					mugIndex_destroy(buf->index);
+					buf->index = 0;
+				}
+				if (buf->vertexes) {
+					mug_dealloc(buf->vertexes, MUG_ALLOC_VERTEXES);
+					buf->vertexes = 0;
+				}
+			}
 
-						// Set values
-						data[0] = (uint32_m)(r.right-r.left);
-						data[1] = (uint32_m)(r.bottom-r.top);
-						return MUCOSA_SUCCESS;
+			// Destroys a given buffer
+			void mugGL_objects_destroy(mugGL_ObjBuffer* buf) {
+				// Destroy spatial index and vertex copy
+				mugGL_objects_index_destroy(buf);
+				// Damage where the objects were
+				mugGL_objects_damage_all(buf);
+				if (buf->bounds) {
+					mug_dealloc(buf->bounds, MUG_ALLOC_VERTEXES);
+					buf->bounds = 0;
+				}
+
+				// Destroy VAO, VBO, and (possibly) EBO
+				glDeleteVertexArrays(1, &buf->vao);
+				glDeleteBuffers(1, &buf->vbo);
+				if (buf->fill_indexes) {
+					glDeleteBuffers(1, &buf->ebo);
+				}
+				mug_memory_remove(buf->memory, buf->memory_usage, buf->memory_bytes, buf->memory_used);
+			}
+
+			// Creates a given buffer
+			// All fields besides OpenGL objects should be set within buf by now
+			mugResult mugGL_objects_create(mugGL_ObjBuffer* buf, void* obj) {
+				// Generate VBO
+				glGenBuffers(1, &buf->vbo);
+				if (!buf->vbo) {
+					return MUG_GL_FAILED_CREATE_BUFFER;
+				}
+				// Generate EBO if necessary
+				if (buf->fill_indexes) {
+					glGenBuffers(1, &buf->ebo);
+					if (!buf->ebo) {
+						glDeleteBuffers(1, &buf->vbo);
+						return MUG_GL_FAILED_CREATE_BUFFER;
 					}
+					// + Mark indexes to be filled
+					buf->index_filled = MU_FALSE;
+				}
+				// Generate VAO
+				glGenVertexArrays(1, &buf->vao);
+				if (!buf->vao) {
+					glDeleteBuffers(1, &buf->vbo);
+					glDeleteBuffers(1, &buf->ebo);
+					return MUG_GL_FAILED_CREATE_VERTEX_ARRAY;
+				}
+				// Count buffer (holding nothing until filled)
+				buf->memory_bytes = 0;
+				buf->memory_used = 0;
+				mug_memory_add(buf->memory, buf->memory_usage, 0, 0);
 
-					muCOSAResult muCOSAW32_window_set_dimensions(muCOSAW32_Window* win, uint32_m* data) {
-						// Get general window info for style
-						WINDOWINFO wi;
-						if (!GetWindowInfo(win->handles.hwnd, &wi)) {
-							return MUCOSA_WIN32_FAILED_SET_WINDOW_ATTRIB;
-						}
+				// Fill buffer
+				mugResult res = mugGL_objects_fill(buf, obj);
+				if (mug_result_is_fatal(res)) {
+					mugGL_objects_destroy(buf);
+					return res;
+				}
 
-						// Calculate rect
-						RECT r;
-						r.left = r.top = 0;
-						r.right = data[0];
-						r.bottom = data[1];
+				return MUG_SUCCESS;
+			}
 
-						// Calculate appropriate window rect for dimensions
-						if (!AdjustWindowRect(&r, wi.dwStyle, FALSE)) {
-							return MUCOSA_WIN32_FAILED_SET_WINDOW_ATTRIB;
-						}
+			// Resizes a given buffer
+			// Buffer's contents are unknown after this if data is NULL
+			mugResult mugGL_objects_resize(mugGL_ObjBuffer* buf, uint32_m obj_count, void* obj) {
+				// Damage objects cut off by shrinking
+				if (obj_count < buf->obj_count && mugGL_objects_bounds_sync(buf)) {
+					mugGL_objects_damage(buf, obj_count, buf->obj_count-obj_count, 0);
+				}
 
-						// Set window rect based on this
-						if (!SetWindowPos(win->handles.hwnd, HWND_TOP, 0, 0, r.right-r.left, r.bottom-r.top, SWP_NOACTIVATE | SWP_NOZORDER | SWP_NOMOVE)) {
-							return MUCOSA_WIN32_FAILED_SET_WINDOW_ATTRIB;
-						}
-						return MUCOSA_SUCCESS;
-					}
+				// Set count + other related variables
+				uint32_m prev_count = buf->obj_count;
+				buf->obj_count = obj_count;
+				buf->vbuf_size = obj_count*buf->bv_per_obj;
+				buf->ibuf_size = obj_count*buf->bi_per_obj;
+				buf->index_filled = MU_FALSE;
 
-				/* Position */
+				// Perform a fill
+				mugResult res = mugGL_objects_fill(buf, obj);
+				// If fatally failed, set things back to what they were
+				if (mug_result_is_fatal(res)) {
+					buf->obj_count = prev_count;
+					buf->vbuf_size = prev_count*buf->bv_per_obj;
+				}
 
-					muCOSAResult muCOSAW32_window_get_position(muCOSAW32_Window* win, int32_m* data) {
-						// Get window rect
-						RECT r;
-						if (!GetWindowRect(win->handles.hwnd, &r)) {
-							return MUCOSA_WIN32_FAILED_GET_WINDOW_ATTRIB;
-						}
+				return res;
+			}
 
-						// Get frame extents
-						uint32_m fe[4];
-						muCOSAW32_window_get_frame_extents(win, fe);
+			// Renders the object buffer
+			void mugGL_objects_render(mugGL_ObjBuffer* buf) {
+				// Bind texture if needed
+				if (buf->tex) {
+					mugGL_texture_bind_render(buf->tex);
+					MUG_STAT(buf->stats, texture_binds, 1)
+				}
+				// Bind VAO
+				glBindVertexArray(buf->vao);
+				MUG_STAT(buf->stats, vertex_array_binds, 1)
+				// Call render function
+				MUG_TRACE_BEGIN(buf->trace, draw_trace)
+				buf->render(buf);
+				MUG_TRACE_END(buf->trace, "draw", draw_trace)
+				MUG_STAT(buf->stats, draw_calls, 1)
+				MUG_STAT(buf->stats, objects, buf->obj_count)
+				MUG_STAT(buf->stats, vertexes, (uint64_m)buf->obj_count*buf->v_per_obj)
+				// Unbind VAO
+				glBindVertexArray(0);
+			}
 
-						// Set position based on rect and relative frame extents
-						data[0] = (int32_m)(r.left) + (int32_m)(fe[0]);
-						data[1] = (int32_m)(r.top) + (int32_m)(fe[2]);
-						return MUCOSA_SUCCESS;
-					}
+			// Subrenders the object buffer
+			void mugGL_objects_subrender(mugGL_ObjBuffer* buf, uint32_m obj_offset, uint32_m obj_count) {
+				// Bind texture if needed
+				if (buf->tex) {
+					mugGL_texture_bind_render(buf->tex);
+					MUG_STAT(buf->stats, texture_binds, 1)
+				}
+				// Bind VAO
+				glBindVertexArray(buf->vao);
+				MUG_STAT(buf->stats, vertex_array_binds, 1)
+				// Call subrender function
+				MUG_TRACE_BEGIN(buf->trace, draw_trace)
+				buf->subrender(obj_offset, obj_count);
+				MUG_TRACE_END(buf->trace, "draw", draw_trace)
+				MUG_STAT(buf->stats, draw_calls, 1)
+				MUG_STAT(buf->stats, objects, obj_count)
+				MUG_STAT(buf->stats, vertexes, (uint64_m)obj_count*buf->v_per_obj)
+				// Unbind VAO
+				glBindVertexArray(0);
+			}
 
-					muCOSAResult muCOSAW32_window_set_position(muCOSAW32_Window* win, int32_m* data) {
-						// Get frame extents
-						uint32_m fe[4];
-						muCOSAW32_window_get_frame_extents(win, fe);
+			// Renders multiple ranges of the object buffer
+			// o and c are overwritten; p has room for n pointers
+			void mugGL_objects_multirender(mugGL_ObjBuffer* buf, uint32_m* o, uint32_m* c, const void** p, uint32_m n) {
+				// Bind texture if needed
+				if (buf->tex) {
+					mugGL_texture_bind_render(buf->tex);
+					MUG_STAT(buf->stats, texture_binds, 1)
+				}
+				// Bind VAO
+				glBindVertexArray(buf->vao);
+				MUG_STAT(buf->stats, vertex_array_binds, 1)
+				// Count objects before their counts are overwritten
+				MUG_STAT(buf->stats, draw_calls, 1)
+				MUG_STAT(buf->stats, objects, mug_stats_sum(c, n))
+				MUG_STAT(buf->stats, vertexes, mug_stats_sum(c, n)*buf->v_per_obj)
+				// Call multirender function
+				MUG_TRACE_BEGIN(buf->trace, draw_trace)
+				buf->multirender(o, c, p, n);
+				MUG_TRACE_END(buf->trace, "draw", draw_trace)
+				// Unbind VAO
+				glBindVertexArray(0);
+			}
 
-						// Translate x and y based on extents
-						int32_m x = data[0] - (int32_m)(fe[0]);
-						int32_m y = data[1] - (int32_m)(fe[2]);
+			// Sets the given object buffer's texture
+			void mugGL_objects_texture(mugGL_ObjBuffer* buf, mugGL_Texture* tex) {
+				buf->tex = tex;
+			}
 
-						// Set window position
-						if (!SetWindowPos(win->handles.hwnd, HWND_TOP, x, y, 0, 0, SWP_NOACTIVATE | SWP_NOZORDER | SWP_NOSIZE)) {
-							return MUCOSA_WIN32_FAILED_SET_WINDOW_ATTRIB;
-						}
-						return MUCOSA_SUCCESS;
-					}
+			// Enables (cell_size > 0) or disables (cell_size <= 0) the buffer's spatial index
+			mugResult mugGL_objects_index(mugGL_ObjBuffer* buf, float cell_size) {
+				// Destroy previous index and vertex copy
+				mugGL_objects_index_destroy(buf);
+				if (cell_size <= 0.f) {
+					return MUG_SUCCESS;
+				}
 
-				/* Keymaps */
+				// Create index
+				buf->index = mugIndex_create(cell_size, 0);
+				if (!buf->index) {
+					return MUG_FAILED_MALLOC;
+				}
+				mugResult res = mugGL_objects_index_sync(buf);
+				if (res == MUG_SUCCESS) {
+					// Read back current vertexes into vertex copy
+					glBindBuffer(GL_ARRAY_BUFFER, buf->vbo);
+					glGetBufferSubData(GL_ARRAY_BUFFER, 0, buf->vbuf_size, buf->vertexes);
+					glBindBuffer(GL_ARRAY_BUFFER, 0);
 
-					muCOSAResult muCOSAW32_window_get_keyboard_map(muCOSAW32_Window* win, muBool** data) {
-						// Point to keyboard keymap
-						*data = win->keymaps.keyboard;
-						return MUCOSA_SUCCESS;
-					}
+					// Fill index
+					res = mugGL_objects_index_vertexes(buf, 0, buf->obj_count);
+				}
 
-					muCOSAResult muCOSAW32_window_get_keystate_map(muCOSAW32_Window* win, muBool** data) {
-						// Point to keystate keymap
-						*data = win->keymaps.keystates;
-						return MUCOSA_SUCCESS;
-					}
+				// Disable on failure
+				if (mug_result_is_fatal(res)) {
+					mugGL_objects_index_destroy(buf);
+				}
+				return res;
+			}
 
-					muCOSAResult muCOSAW32_window_get_mouse_map(muCOSAW32_Window* win, muBool** data) {
-						// Point to mouse keymap
-						*data = win->keymaps.mouse;
-						return MUCOSA_SUCCESS;
-					}
+		/* Objects */
 
-				/* Cursor */
+			/* Points */
 
-					muCOSAResult muCOSAW32_window_get_cursor_pos(muCOSAW32_Window* win, int32_m* data) {
-						// Get cursor position
-						POINT p;
-						if (!GetCursorPos(&p)) {
-							return MUCOSA_WIN32_FAILED_GET_WINDOW_ATTRIB;
-						}
+				// Data format: { vec3 pos, vec4 col }
+				// Rendered as GL_POINTS
 
-						// Get window position
-						int32_m wpos[2];
-						muCOSAResult res = muCOSAW32_window_get_position(win, wpos);
-						if (muCOSA_result_is_fatal(res)) {
-							return MUCOSA_WIN32_FAILED_GET_WINDOW_ATTRIB;
-						}
+				/* Shaders */
 
-						// Retrieve cursor position relative to window
-						data[0] = p.x-wpos[0];
-						data[1] = p.y-wpos[1];
-						return res;
-					}
+					// Vertex shader
+					// * Lines, triangles, and rects also use this shader.
+					const char* mugGL_pointVS = 
+						// Version
+						"#version 330 core\n"
 
-					muCOSAResult muCOSAW32_window_set_cursor_pos(muCOSAW32_Window* win, int32_m* data) {
-						// Get window position
-						int32_m wpos[2];
-						muCOSAResult res = muCOSAW32_window_get_position(win, wpos);
-						if (muCOSA_result_is_fatal(res)) {
-							return MUCOSA_WIN32_FAILED_SET_WINDOW_ATTRIB;
-						}
+						// Input { vec3 pos, vec4 col }
+						"layout(location=0)in vec3 vPos;"
+						"layout(location=1)in vec4 vCol;"
 
-						// Set cursor position relative to window
-						if (!SetCursorPos(wpos[0]+data[0], wpos[1]+data[1])) {
-							return MUCOSA_WIN32_FAILED_SET_WINDOW_ATTRIB;
-						}
-						return res;
-					}
+						// Output { vec4 col }
+						"out vec4 fCol;"
 
-					muCOSAResult muCOSAW32_window_get_cursor_style(muCOSAW32_Window* win, muCursorStyle* data) {
-						// Set data to cursor style
-						*data = win->states.cursor_style;
-						return MUCOSA_SUCCESS;
-					}
+						// Dimensions of graphic divided by 2
+						"uniform vec2 d;"
+						// Modifiers
+						"uniform vec3 aP;" // addPos
+						"uniform vec3 mP;" // mulPos
 
-					muCOSAResult muCOSAW32_window_set_cursor_style(muCOSAW32_Window* win, muCursorStyle* data) {
-						// Set internal storage to cursor style
-						win->states.cursor_style = *data;
-						// Destroy cursor
-						DestroyCursor(win->handles.hcursor);
-						// Load cursor
-						win->handles.hcursor = LoadCursor(0, (LPCSTR)muCOSAW32_muCOSA_cursor_to_W32(*data));
-						// Set cursor
-						SetCursor(win->handles.hcursor);
-						return MUCOSA_SUCCESS;
-					}
+						// Main
+						"void main(){"
+							// Set position
+							"gl_Position=vec4("
+								// X
+								"(((vPos.x*mP.x)+aP.x)-(d.x))/d.x,"
+								// Y
+								"-(((vPos.y*mP.y)+aP.y)-(d.y))/d.y,"
+								// Z
+								"((vPos.z*mP.z)+aP.z),"
+								// W
+								"1.0"
+							");"
+							// Transfer color to fragment
+							"fCol=vCol;"
+						"}"
+					;
 
-				/* Scroll */
+					// Fragment shader
+					// * Lines, triangles, and rects also use this shader.
+					const char* mugGL_pointFS =
+						// Version
+						"#version 330 core\n"
 
-					void muCOSAW32_window_get_scroll(muCOSAW32_Window* win, int32_m* data) {
-						// Give scroll level
-						*data = win->props.scroll_level;
-					}
+						// Input { vec4 col }
+						"in vec4 fCol;"
+						// Output { vec4 col }
+						"out vec4 oCol;"
 
-					void muCOSAW32_window_set_scroll(muCOSAW32_Window* win, int32_m* data) {
-						// Overwrite scroll level
-						win->props.scroll_level = *data;
-					}
+						// Modifiers
+						"uniform vec4 aC;" // addCol
+						"uniform vec4 mC;" // mulCol
 
-				/* Callbacks */
+						// Main
+						"void main(){"
+							// Set color
+							"oCol=(fCol*mC)+aC;"
+						"}"
+					;
 
-					void muCOSAW32_window_set_callback(muCOSAW32_Window* win, muWindowAttrib attrib, void* fun) {
-						switch (attrib) {
-							case MU_WINDOW_DIMENSIONS_CALLBACK: {
-								mu_memcpy(&win->callbacks.dimensions, fun, sizeof(win->callbacks.dimensions));
-							} break;
-							case MU_WINDOW_POSITION_CALLBACK: {
-								mu_memcpy(&win->callbacks.position, fun, sizeof(win->callbacks.position));
-							} break;
-							case MU_WINDOW_KEYBOARD_CALLBACK: {
-								mu_memcpy(&win->callbacks.keyboard, fun, sizeof(win->callbacks.keyboard));
-							} break;
-							case MU_WINDOW_KEYSTATE_CALLBACK: {
-								mu_memcpy(&win->callbacks.keystate, fun, sizeof(win->callbacks.keystate));
-							} break;
-							case MU_WINDOW_MOUSE_KEY_CALLBACK: {
-								mu_memcpy(&win->callbacks.mouse_key, fun, sizeof(win->callbacks.mouse_key));
-							} break;
-							case MU_WINDOW_CURSOR_CALLBACK: {
-								mu_memcpy(&win->callbacks.cursor, fun, sizeof(win->callbacks.cursor));
-							} break;
-							case MU_WINDOW_SCROLL_CALLBACK: {
-								mu_memcpy(&win->callbacks.scroll, fun, sizeof(win->callbacks.scroll));
-							} break;
+					// Creates program for points
+					// * Lines, triangles, & rects also use this function.
+					void mugGL_points_shader_load(mug_Graphic* gfx, mugGL_Shader* shader, mugResult* result) {
+						// Exit if shader already compiled
+						if (shader->program) {
+							return;
+						}
+
+						// Compile shader
+						mugResult res = mugGL_shader_create_vf(gfx, shader, mugGL_pointVS, mugGL_pointFS);
+						if (res != MUG_SUCCESS) {
+							MU_SET_RESULT(result, res)
 						}
 					}
 
-				/* Text input */
+				/* Buffer */
 
-					void muCOSAW32_window_update_text_cursor(muCOSAResult* result, muCOSAW32_Window* win, uint32_m cx, uint32_m cy);
-					void muCOSAW32_window_get_text_input(muCOSAResult* result, muCOSAW32_Window* win, uint32_m cx, uint32_m cy, void (*callback)(muWindow, uint8_m*)) {
-						// Associate IMM context with this window
-						if (!ImmAssociateContextEx(win->handles.hwnd, NULL, IACE_DEFAULT)) {
-							MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_ASSOCIATE_IMM)
-							return;
+					// Fills vertex data
+					void mugGL_points_fill_vertexes(GLfloat* v, void* obj, uint32_m c) {
+						// Convert obj to struct array
+						mugPoint* points = (mugPoint*)obj;
+
+						// Loop through each point
+						for (uint32_m i = 0; i < c; ++i) {
+							// vec3 pos
+							mu_memcpy(v, points->pos, 12);
+							v += 3;
+							// vec4 col
+							mu_memcpy(v, points++->col, 16);
+							v += 4;
 						}
+					}
 
-						// Set callback
-						win->props.text_input_callback = callback;
-						// Update text cursor position
-						muCOSAW32_window_update_text_cursor(0, win, cx, cy);
+					// Describes point data
+					// * Lines, triangles, and rects also use this function.
+					void mugGL_points_desc(void) {
+						// vec3 pos
+						glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 28, 0);
+						glEnableVertexAttribArray(0);
+						// vec4 col
+						glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, 28, (void*)(12));
+						glEnableVertexAttribArray(1);
 					}
 
-					void muCOSAW32_window_let_text_input(muCOSAW32_Window* win) {
-						// Set callback to nothing
-						win->props.text_input_callback = 0;
-						// Deassociate IMM context
-						ImmAssociateContextEx(win->handles.hwnd, NULL, 0);
+					// Renders points
+					void mugGL_points_render(mugGL_ObjBuffer* buf) {
+						// Draw arrays
+						glDrawArrays(
+							GL_POINTS, // Render using points
+							0, // Starting index (just 0)
+							buf->obj_count // Index count (equal to amount of points)
+						);
 					}
 
-					void muCOSAW32_window_update_text_cursor(muCOSAResult* result, muCOSAW32_Window* win, uint32_m cx, uint32_m cy) {
-						// Do nothing if text input isn't being taken
-						if (!win->props.text_input_callback) {
-							return;
-						}
+					// Subrenders points
+					void mugGL_points_subrender(uint32_m o, uint32_m c) {
+						// Draw arrays
+						glDrawArrays(
+							GL_POINTS, // Render using points
+							o, // Starting index (equal to amount of points)
+							c // Index count (equal to amount of points)
+						);
+					}
 
-						// Might not be a good idea to keep grabbing an releasing IMM context,
-						// but the entire IMM is so fragile that the smallest change makes it
-						// not function at all. So, I'm keeping it like this :L
+					// Multirenders points
+					void mugGL_points_multirender(uint32_m* o, uint32_m* c, const void** p, uint32_m n) {
+						// Draw arrays (offsets and counts are already in points)
+						glMultiDrawArrays(GL_POINTS, (const GLint*)o, (const GLsizei*)c, (GLsizei)n);
+						return; if (p) {}
+					}
 
-						// Get IMM context handle
-						win->handles.imc = ImmGetContext(win->handles.hwnd);
+					// Returns coverage of point at (x, y)
+					float mugGL_points_cover(GLfloat* v, float x, float y) {
+						// Points are one pixel wide
+						return (x >= v[0]-0.5f && x <= v[0]+0.5f && y >= v[1]-0.5f && y <= v[1]+0.5f) ? (1.f) : (0.f);
+					}
 
-						// Fill out composition form
-						COMPOSITIONFORM cf = MU_ZERO_STRUCT(COMPOSITIONFORM);
-						cf.dwStyle = CFS_FORCE_POSITION;
-						cf.ptCurrentPos.x = cx;
-						cf.ptCurrentPos.y = cy;
+					// Returns if point overlaps an area
+					muBool mugGL_points_overlaps(GLfloat* v, float* area) {
+						return v[0]+0.5f >= area[0] && v[0]-0.5f <= area[2] && v[1]+0.5f >= area[1] && v[1]-0.5f <= area[3];
+					}
 
-						// Send composition form
-						if (!ImmSetCompositionWindow(win->handles.imc, &cf)) {
-							MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_SET_COMPOSITION_WINDOW_POSITION)
-						}
+					// Fills buffer with needed information
+					void mugGL_points_fill(mugGL_ObjBuffer* buf) {
+						buf->obj_type = MUG_OBJECT_POINT;
 
-						// Release IMM context handle
-						ImmReleaseContext(win->handles.hwnd, win->handles.imc);
+						// Amount of bytes used on vertex per object:
+						// one vertex = vec3+vec4 (28)
+						// one point = one vertex (28)
+						buf->bv_per_obj = 28;
+						// Amount of vertexes per object
+						buf->v_per_obj = 1;
+
+						// Function equivalents
+						buf->fill_vertexes = mugGL_points_fill_vertexes;
+						buf->fill_indexes = 0;
+						buf->desc = mugGL_points_desc;
+						buf->render = mugGL_points_render;
+						buf->subrender = mugGL_points_subrender;
+						buf->multirender = mugGL_points_multirender;
+						buf->cover = mugGL_points_cover;
+						buf->overlaps = mugGL_points_overlaps;
 					}
 
-				/* OpenGL */
+			/* Lines */
 
-				#ifdef MU_SUPPORT_OPENGL
+				// Data format: { vec3 pos, vec4 col }
+				// Rendered as GL_LINES
 
-					struct muCOSAW32_GL {
-						HDC dc;
-						HGLRC hgl;
-					};
-					typedef struct muCOSAW32_GL muCOSAW32_GL;
+				/* Shaders */
 
-					void* muCOSAW32_gl_context_create(muCOSAW32_Context* context, muCOSAResult* result, muCOSAW32_Window* win, muGraphicsAPI api) {
-						// Allocate memory for context
-						muCOSAW32_GL* gl = (muCOSAW32_GL*)mu_malloc(sizeof(muCOSAW32_GL));
-						if (!gl) {
-							MU_SET_RESULT(result, MUCOSA_FAILED_MALLOC)
-							return 0;
-						}
-						gl->dc = win->handles.dc;
+					// Vertex shader (same as points)
+					#define mugGL_lineVS mugGL_pointVS
 
-						// Create OpenGL context
-						muPixelFormat* format = 0;
-						if (win->props.use_format) {
-							format = &win->props.format;
-						}
-						muCOSAResult res = muCOSAW32_create_opengl_context(win->handles.dc, win->props.pixel_format, &context->wgl, format, &gl->hgl, api, &win->props.format_set);
-						if (res != MUCOSA_SUCCESS) {
-							MU_SET_RESULT(result, res)
-							if (muCOSA_result_is_fatal(res)) {
-								mu_free(gl);
-								gl = 0;
-							}
-						}
-						return gl;
-					}
+					// Fragment shader (same as points)
+					#define mugGL_lineFS mugGL_pointFS
 
-					void muCOSAW32_gl_context_destroy(muCOSAW32_GL* gl) {
-						wglDeleteContext(gl->hgl);
-						mu_free(gl);
-					}
+					// Creates program for lines (same as points)
+					#define mugGL_lines_shader_load mugGL_points_shader_load
 
-					muCOSAResult muCOSAW32_gl_bind(muCOSAW32_GL* gl) {
-						if (!wglMakeCurrent(gl->dc, gl->hgl)) {
-							return MUCOSA_WIN32_FAILED_SET_WGL_CONTEXT;
-						}
-						return MUCOSA_SUCCESS;
-					}
+				/* Buffer */
 
-					muCOSAResult muCOSAW32_gl_swap_buffers(muCOSAW32_Window* win) {
-						if (!SwapBuffers(win->handles.dc)) {
-							return MUCOSA_WIN32_FAILED_SWAP_WGL_BUFFERS;
+					// Fills vertex data
+					void mugGL_lines_fill_vertexes(GLfloat* v, void* obj, uint32_m c) {
+						// Convert obj to struct array
+						mugLine* lines = (mugLine*)obj;
+
+						// Loop through each point
+						for (uint32_m i = 0; i < c; ++i) {
+							// Point 1
+							// - vec3 pos
+							mu_memcpy(v, lines->points[0].pos, 12);
+							v += 3;
+							// - vec4 col
+							mu_memcpy(v, lines->points[0].col, 16);
+							v += 4;
+							// Point 2
+							// - vec3 pos
+							mu_memcpy(v, lines->points[1].pos, 12);
+							v += 3;
+							// - vec4 col
+							mu_memcpy(v, lines++->points[1].col, 16);
+							v += 4;
 						}
-						return MUCOSA_SUCCESS;
 					}
 
-					void* muCOSAW32_gl_get_proc_address(const char* name) {
-						// Get proc address based on name
-						PROC p = (PROC)wglGetProcAddress(name);
+					// Describes line data (same as points)
+					#define mugGL_lines_desc mugGL_points_desc
 
-						// If failed:
-						if (p == 0
-							|| (p == (PROC)1)
-							|| (p == (PROC)2)
-							|| (p == (PROC)3)
-							|| (p == (PROC)-1)
-						) {
-							// Try loading from DLL itself
-							HMODULE module = LoadLibraryA("opengl32.dll");
-							p = (PROC)GetProcAddress(module, name);
-						}
+					// Renders lines
+					void mugGL_lines_render(mugGL_ObjBuffer* buf) {
+						// Draw arrays
+						glDrawArrays(
+							GL_LINES, // Render using lines
+							0, // Starting index (just 0)
+							buf->obj_count*2 // Index count (two points per line)
+						);
+					}
 
-						// Convert to void* in a way that avoids warnings
-						void* vptr = 0;
-						mu_memcpy(&vptr, &p, sizeof(void*));
-						return vptr;
+					// Subrenders lines
+					void mugGL_lines_subrender(uint32_m o, uint32_m c) {
+						// Draw arrays
+						glDrawArrays(
+							GL_LINES, // Render using lines
+							o*2, // Starting index (two points per line)
+							c*2 // Index count (two points per line)
+						);
 					}
 
-					muBool muCOSAW32_gl_swap_interval(muCOSAW32_Context* context, muCOSAResult* result, int interval) {
-						// If the swap interval function was not found when loading, quit
-						if (!context->wgl.SwapInterval) {
-							MU_SET_RESULT(result, MUCOSA_WIN32_FAILED_FIND_WGL_FUNCTION)
-							return 0;
+					// Multirenders lines
+					void mugGL_lines_multirender(uint32_m* o, uint32_m* c, const void** p, uint32_m n) {
+						// Convert to vertexes (2 points per line)
+						for (uint32_m i = 0; i < n; ++i) {
+							o[i] *= 2;
+							c[i] *= 2;
 						}
-
-						// Return a call to it if we've found it
-						return context->wgl.SwapInterval(interval);
+						// Draw arrays
+						glMultiDrawArrays(GL_LINES, (const GLint*)o, (const GLsizei*)c, (GLsizei)n);
+						return; if (p) {}
 					}
 
-				#endif /* MU_SUPPORT_OPENGL */
-
-			#endif /* MUCOSA_WIN32 */
+					// Returns coverage of line at (x, y)
+					float mugGL_lines_cover(GLfloat* v, float x, float y) {
+						// Lines are one pixel wide
+						return (mugMath_point_segment_distance(x, y, v[0], v[1], v[7], v[8]) <= 0.5f) ? (1.f) : (0.f);
+					}
 
-			/* Inner */
+					// Returns if line overlaps an area
+					muBool mugGL_lines_overlaps(GLfloat* v, float* area) {
+						return mugMath_polygon_overlaps_area(v, 2, 7, area);
+					}
 
-				// Inner struct
-				struct muCOSA_Inner {
-					muWindowSystem system;
-					void* context;
-				};
-				typedef struct muCOSA_Inner muCOSA_Inner;
+					// Fills buffer with need info
+					void mugGL_lines_fill(mugGL_ObjBuffer* buf) {
+						buf->obj_type = MUG_OBJECT_LINE;
 
-				// Determines the best window system
-				muWindowSystem muCOSA_best_window_system(void) {
-					#ifdef MUCOSA_WIN32
-						return MU_WINDOW_WIN32;
-					#else
-						return 0;
-					#endif
-				}
+						// Amount of bytes used on vertex per object:
+						// one vertex = vec3+vec4 (28)
+						// one line = two vertexes (56)
+						buf->bv_per_obj = 56;
+						// Amount of vertexes per object
+						buf->v_per_obj = 2;
 
-				// Creates a valid inner struct based on the requested system
-				muCOSAResult muCOSA_inner_create(muCOSA_Inner* inner, muWindowSystem system) {
-					// Find best window system
-					if (system == 0) {
-						system = muCOSA_best_window_system();
+						// Function equivalents
+						buf->fill_vertexes = mugGL_lines_fill_vertexes;
+						buf->fill_indexes = 0;
+						buf->desc = mugGL_lines_desc;
+						buf->render = mugGL_lines_render;
+						buf->subrender = mugGL_lines_subrender;
+						buf->multirender = mugGL_lines_multirender;
+						buf->cover = mugGL_lines_cover;
+						buf->overlaps = mugGL_lines_overlaps;
 					}
-					inner->system = system;
 
-					// Create context based on system
-					switch (system) {
-						// Unknown/Unsupported/None supported:
-						default: return MUCOSA_FAILED_NULL_WINDOW_SYSTEM; break;
+			/* Triangle */
 
-						// Win32
-						MUCOSA_WIN32_CALL(
-							case MU_WINDOW_WIN32: {
-								// Allocate context
-								inner->context = mu_malloc(sizeof(muCOSAW32_Context));
-								if (!inner->context) {
-									return MUCOSA_FAILED_MALLOC;
-								}
+				// Data format: { vec3 pos, vec4 col }
+				// Rendered as GL_TRIANGLES
 
-								// Create context
-								muCOSAResult res = muCOSAW32_context_init((muCOSAW32_Context*)inner->context);
-								if (muCOSA_result_is_fatal(res)) {
-									mu_free(inner->context);
-								}
-								return res;
-							} break;
-						)
-					}
-				}
+				/* Shaders */
 
-				// Destroys inner struct based on system
-				void muCOSA_inner_destroy(muCOSA_Inner* inner) {
-					switch (inner->system) {
-						default: break;
+					// Vertex shader (same as points)
+					#define mugGL_triangleVS mugGL_pointVS
 
-						// Win32
-						MUCOSA_WIN32_CALL(
-							case MU_WINDOW_WIN32: {
-								// Destroy context
-								muCOSAW32_context_term((muCOSAW32_Context*)inner->context);
-							} break;
-						)
+					// Fragment shader (same as points)
+					#define mugGL_triangleFS mugGL_pointFS
+
+					// Creates program for triangles (same as points)
+					#define mugGL_triangles_shader_load mugGL_points_shader_load
+
+				/* Buffer */
+
+					// Fills vertex data
+					void mugGL_triangles_fill_vertexes(GLfloat* v, void* obj, uint32_m c) {
+						// Convert obj to struct array
+						mugTriangle* triangles = (mugTriangle*)obj;
+
+						// Loop through each triangle
+						for (uint32_m t = 0; t < c; ++t) {
+							// Point 0
+							// - vec3 pos
+							mu_memcpy(v, triangles->points[0].pos, 12);
+							v += 3;
+							// - vec4 col
+							mu_memcpy(v, triangles->points[0].col, 16);
+							v += 4;
+							// Point 1
+							// - vec3 pos
+							mu_memcpy(v, triangles->points[1].pos, 12);
+							v += 3;
+							// - vec4 col
+							mu_memcpy(v, triangles->points[1].col, 16);
+							v += 4;
+							// Point 2
+							// - vec3 pos
+							mu_memcpy(v, triangles->points[2].pos, 12);
+							v += 3;
+							// - vec4 col
+							mu_memcpy(v, triangles++->points[2].col, 16);
+							v += 4;
+						}
 					}
-				}
 
-			// Name call macro
-			#ifdef MUCOSA_NAMES
-				#define MUCOSA_NAME_CALL(...) __VA_ARGS__
-			#else
-				#define MUCOSA_NAME_CALL(...)
-			#endif
+					// Describes triangle data (same as points)
+					#define mugGL_triangles_desc mugGL_points_desc
 
-			/* Context */
+					// Renders triangles
+					void mugGL_triangles_render(mugGL_ObjBuffer* buf) {
+						// Draw arrays
+						glDrawArrays(
+							GL_TRIANGLES, // Render using triangles
+							0, // Starting index (just 0)
+							buf->obj_count*3 // Index count (three points per triangle)
+						);
+					}
 
-				MUDEF void muCOSA_context_create(muCOSAContext* context, muWindowSystem system, muBool set_context) {
-					// Allocate context
-					context->inner = mu_malloc(sizeof(muCOSA_Inner));
-					if (!context->inner) {
-						context->result = MUCOSA_FAILED_MALLOC;
-						return;
+					// Subrenders triangles
+					void mugGL_triangles_subrender(uint32_m o, uint32_m c) {
+						// Draw arrays
+						glDrawArrays(
+							GL_TRIANGLES, // Render using triangles
+							o*3, // Starting index (three points per triangle)
+							c*3 // Index count (three points per triangle)
+						);
 					}
 
-					// Create context
-					context->result = muCOSA_inner_create((muCOSA_Inner*)context->inner, system);
-					if (muCOSA_result_is_fatal(context->result)) {
-						mu_free(context->inner);
-						return;
+					// Multirenders triangles
+					void mugGL_triangles_multirender(uint32_m* o, uint32_m* c, const void** p, uint32_m n) {
+						// Convert to vertexes (3 points per triangle)
+						for (uint32_m i = 0; i < n; ++i) {
+							o[i] *= 3;
+							c[i] *= 3;
+						}
+						// Draw arrays
+						glMultiDrawArrays(GL_TRIANGLES, (const GLint*)o, (const GLsizei*)c, (GLsizei)n);
+						return; if (p) {}
 					}
 
-					// Set context if necessary
-					if (set_context) {
-						muCOSA_context_set(context);
+					// Returns coverage of triangle at (x, y)
+					float mugGL_triangles_cover(GLfloat* v, float x, float y) {
+						return (mugMath_point_in_polygon(v, 3, 7, x, y)) ? (1.f) : (0.f);
 					}
-				}
 
-				MUDEF void muCOSA_context_destroy(muCOSAContext* context) {
-					// Free and destroy if inner contents exist
-					if (context->inner) {
-						muCOSA_inner_destroy((muCOSA_Inner*)context->inner);
-						mu_free(context->inner);
+					// Returns if triangle overlaps an area
+					muBool mugGL_triangles_overlaps(GLfloat* v, float* area) {
+						return mugMath_polygon_overlaps_area(v, 3, 7, area);
 					}
-				}
 
-				// Global context
-				muCOSAContext* muCOSA_global_context = 0;
+					// Fills buffer with needed info
+					void mugGL_triangles_fill(mugGL_ObjBuffer* buf) {
+						buf->obj_type = MUG_OBJECT_TRIANGLE;
 
-				// Set context
-				MUDEF void muCOSA_context_set(muCOSAContext* context) {
-					muCOSA_global_context = context;
-				}
+						// Amount of bytes used on vertex per object:
+						// one vertex = vec3+vec4 (28)
+						// one triangle = three vertexes (84)
+						buf->bv_per_obj = 84;
+						// Amount of vertexes per object
+						buf->v_per_obj = 3;
 
-				// Get window system
-				MUDEF muWindowSystem muCOSA_context_get_window_system(muCOSAContext* context) {
-					return ((muCOSA_Inner*)context->inner)->system;
-				}
+						// Function equivalents
+						buf->fill_vertexes = mugGL_triangles_fill_vertexes;
+						buf->fill_indexes = 0;
+						buf->desc = mugGL_triangles_desc;
+						buf->render = mugGL_triangles_render;
+						buf->subrender = mugGL_triangles_subrender;
+						buf->multirender = mugGL_triangles_multirender;
+						buf->cover = mugGL_triangles_cover;
+						buf->overlaps = mugGL_triangles_overlaps;
+					}
 
-			/* Window */
+			/* Rect */
 
-				/* Creation / Destruction */
+				// Data format: { vec3 pos, vec4 col }
+				// Indexed data: { 0, 1, 3, 1, 2, 3 }
 
-					MUDEF muWindow muCOSA_window_create(muCOSAContext* context, muCOSAResult* result, muWindowInfo* info) {
-						// Get inner from context
-						muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+				/* Shaders */
 
-						// Do thing based on window system
-						switch (inner->system) {
-							default: return 0; break;
+					// Vertex shader (same as points)
+					#define mugGL_rectVS mugGL_pointVS
 
-							// Win32
-							MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32 : {
-								// Allocate window memory
-								muCOSAW32_Window* win = (muCOSAW32_Window*)mu_malloc(sizeof(muCOSAW32_Window));
-								if (!win) {
-									MU_SET_RESULT(result, MUCOSA_FAILED_MALLOC)
-									return 0;
-								}
+					// Fragment shader (same as points)
+					#define mugGL_rectFS mugGL_pointFS
 
-								// Create window
-								muCOSAResult res = muCOSAW32_window_create(info, win);
-								if (res != MUCOSA_SUCCESS) {
-									MU_SET_RESULT(result, res)
-									if (muCOSA_result_is_fatal(res)) {
-										mu_free(win);
-										MU_SET_RESULT(result, res)
-										return 0;
-									}
-								}
-								return win;
-							} break;)
-						}
+					// Creates program for rects (same as points)
+					#define mugGL_rects_shader_load mugGL_points_shader_load
 
-						// To avoid unused parameter warnings in some cases
-						if (result) {} if (info) {}
+				/* Buffer */
+
+					// Fills a particular vertex given what to multiply dimensions by
+					// (Used to alternate between 4 corners)
+					// Returns how much to increment v by
+					static inline size_m mugGL_rects_fill_invertexes(
+						// Rect data
+						GLfloat* v, mugRect* rect,
+						// Half-dim and vector dim
+						float hdim[2], float vdim0, float vdim1,
+						// Sin/Cos rotation
+						float srot, float crot
+					) {
+						// vec3 pos
+						// - x and y
+						mugMath_rot_point_point(
+							rect->center.pos[0]+(hdim[0]*vdim0), // Point x
+							rect->center.pos[1]+(hdim[1]*vdim1), // Point y
+							rect->center.pos[0], // Center x
+							rect->center.pos[1], // Center y
+							srot, crot, // Sin / Cos rotation
+							v
+						);
+						// - z
+						v[2] = rect->center.pos[2];
+
+						// vec4 col
+						mu_memcpy(&v[3], rect->center.col, 16);
+						return 7;
 					}
 
-					MUDEF muWindow muCOSA_window_destroy(muCOSAContext* context, muWindow win) {
-						// Get inner from context
-						muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+					// Fill vertex data
+					void mugGL_rects_fill_vertexes(GLfloat* v, void* obj, uint32_m c) {
+						// Convert obj to struct array
+						mugRect* rects = (mugRect*)obj;
 
-						// Do things based on window system
-						switch (inner->system) {
-							default: return 0; break;
+						// Loop through each rect
+						for (uint32_m i = 0; i < c; ++i) {
+							// Store half-dim
+							float hdim[2] = { rects->dim[0]/2.f, rects->dim[1]/2.f };
+							// Store sin/cos of rotation
+							// Sin is negative because y-direction is flipped in mug coordinates
+							float srot = -mu_sinf(rects->rot);
+							float crot = mu_cosf(rects->rot);
 
-							// Win32
-							MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
-								// Destroy window
-								muCOSAW32_window_destroy((muCOSAW32_Window*)win);
-								// Free memory
-								mu_free(win);
-								return 0;
-							} break;)
+							// Top-left
+							v += mugGL_rects_fill_invertexes(v, rects  , hdim, -1.f, -1.f, srot, crot);
+							// Bottom-left
+							v += mugGL_rects_fill_invertexes(v, rects  , hdim, -1.f,  1.f, srot, crot);
+							// Bottom-right
+							v += mugGL_rects_fill_invertexes(v, rects  , hdim,  1.f,  1.f, srot, crot);
+							// Top-right
+							v += mugGL_rects_fill_invertexes(v, rects++, hdim,  1.f, -1.f, srot, crot);
 						}
+					}
+
+					// Fill index data
+					// Circles, squircles, round rects, textures, texture arrays also use this
+					void mugGL_rects_fill_indexes(GLuint* i, uint32_m c) {
+						// Offset for index pattern:
+						uint32_m po = 0;
 
-						// To avoid unused parameter warnings in some cases
-						if (win) {}
+						// Loop through each rect
+						for (uint32_m r = 0; r < c; ++r) {
+							// Fill out index pattern:
+							// { 0, 1, 3, 1, 2, 3 }
+							*i++ = po;
+							*i++ = po+1;
+							*i++ = po+3;
+							*i++ = po+1;
+							*i++ = po+2;
+							*i++ = po+3;
+							// Increment po
+							po += 4;
+						}
 					}
 
-				/* Main loop */
+					// Describes rect data (same as points)
+					#define mugGL_rects_desc mugGL_points_desc
 
-					MUDEF muBool muCOSA_window_get_closed(muCOSAContext* context, muCOSAResult* result, muWindow win) {
-						// Get inner from context
-						muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+					// Renders rects
+					// Circles, squircles, round rects, textures, texture arrays also use this
+					void mugGL_rects_render(mugGL_ObjBuffer* buf) {
+						// Draw elements
+						glDrawElements(
+							GL_TRIANGLES, // Rendering triangle-by-triangle
+							buf->obj_count*6, // Indexes per object
+							GL_UNSIGNED_INT, // Index type (GLuint)
+							(const void*)(0) // Offset in index data (in bytes)
+						);
+					}
 
-						// Do things based on window system
-						switch (inner->system) {
-							default: return 0; break;
+					// Subrenders rects
+					// Circles, squircles, round rects, textures, texture arrays also use this
+					void mugGL_rects_subrender(uint32_m o, uint32_m c) {
+						// Draw elements
+						glDrawElements(
+							GL_TRIANGLES, // Rendering triangle-by-triangle
+							c*6, // Indexes per object
+							GL_UNSIGNED_INT, // Index type (GLuint)
+							(const void*)(((size_m)o)*24) // Offset in index data (in bytes; 24 = 6*4 = 6*sizeof(GLuint))
+						);
+					}
 
-							// Win32
-							MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
-								return muCOSAW32_window_get_closed((muCOSAW32_Window*)win);
-							} break;)
+					// Multirenders rects
+					void mugGL_rects_multirender(uint32_m* o, uint32_m* c, const void** p, uint32_m n) {
+						// Convert to index counts and offsets
+						for (uint32_m i = 0; i < n; ++i) {
+							p[i] = (const void*)(((size_m)o[i])*24); // (24 = 6*4 = 6*sizeof(GLuint))
+							c[i] *= 6;
 						}
-
-						// To avoid unused parameter warnings in some cases
-						if (result) {} if (win) {}
+						// Draw elements
+						glMultiDrawElements(GL_TRIANGLES, (const GLsizei*)c, GL_UNSIGNED_INT, p, (GLsizei)n);
 					}
 
-					MUDEF void muCOSA_window_close(muCOSAContext* context, muWindow win) {
-						// Get inner from context
-						muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+					// Returns coverage of rect at (x, y)
+					float mugGL_rects_cover(GLfloat* v, float x, float y) {
+						return (mugMath_point_in_polygon(v, 4, 7, x, y)) ? (1.f) : (0.f);
+					}
 
-						// Do things based on window system
-						switch (inner->system) {
-							default: return; break;
+					// Returns if rect overlaps an area
+					muBool mugGL_rects_overlaps(GLfloat* v, float* area) {
+						return mugMath_polygon_overlaps_area(v, 4, 7, area);
+					}
 
-							// Win32
-							MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
-								muCOSAW32_window_close((muCOSAW32_Window*)win);
-								return;
-							} break;)
+					// Returns if a smooth shape (circle, squircle, round rect) overlaps an area,
+					// by checking its coverage at the point of the area closest to its center
+					// (cx, cy) as well as at the corners of the area
+					muBool mugGL_smooth_overlaps(GLfloat* v, float* area, float cx, float cy, float (*cover)(GLfloat*, float, float)) {
+						// Closest point
+						if (cover(v, mugMath_clamp(cx, area[0], area[2]), mugMath_clamp(cy, area[1], area[3])) >= 0.5f) {
+							return MU_TRUE;
 						}
-
-						// To avoid unused parameter warnings in some cases
-						if (win) {}
+						// Corners
+						return cover(v, area[0], area[1]) >= 0.5f || cover(v, area[2], area[1]) >= 0.5f
+							|| cover(v, area[2], area[3]) >= 0.5f || cover(v, area[0], area[3]) >= 0.5f;
 					}
 
-					MUDEF void muCOSA_window_update(muCOSAContext* context, muCOSAResult* result, muWindow win) {
-						// Get inner from context
-						muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+					// Fills buffer with needed info
+					void mugGL_rects_fill(mugGL_ObjBuffer* buf) {
+						buf->obj_type = MUG_OBJECT_RECT;
 
-						// Do things based on window system
-						switch (inner->system) {
-							default: return; break;
+						// Amount of bytes used on vertex per object:
+						// one vertex = vec3+vec4 (28)
+						// one rect = four vertexes (112)
+						buf->bv_per_obj = 112;
+						// Amount of vertexes per object
+						buf->v_per_obj = 4;
 
-							// Win32
-							MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
-								muCOSAW32_window_update((muCOSAW32_Window*)win);
-								return;
-							} break;)
-						}
+						// Amount of bytes used on index per object:
+						// one rect = six indexes (24)
+						buf->bi_per_obj = 24;
 
-						// To avoid unused parameter warnings in some cases
-						if (result) {} if (win) {}
+						// Function equivalents
+						buf->fill_vertexes = mugGL_rects_fill_vertexes;
+						buf->fill_indexes = mugGL_rects_fill_indexes;
+						buf->desc = mugGL_rects_desc;
+						buf->render = mugGL_rects_render;
+						buf->subrender = mugGL_rects_subrender;
+						buf->multirender = mugGL_rects_multirender;
+						buf->cover = mugGL_rects_cover;
+						buf->overlaps = mugGL_rects_overlaps;
 					}
 
-				/* Get / Set */
+			/* Circle */
 
-					MUDEF void muCOSA_window_get(muCOSAContext* context, muCOSAResult* result, muWindow win, muWindowAttrib attrib, void* data) {
-						// Get inner from context
-						muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+				// Data format: { vec3 pos, vec4 col, vec2 cen, float rad }
+				// Indexed data: { 0, 1, 3, 1, 2, 3 }
 
-						// Do things based on window system
-						switch (inner->system) {
-							default: return; break;
+				/* Shaders */
 
-							// Win32
-							MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
-								muCOSAResult res = MUCOSA_SUCCESS;
-								muCOSAW32_Window* w32_win = (muCOSAW32_Window*)win;
+					// Vertex shader
+					const char* mugGL_circleVS = 
+						// Version
+						"#version 330 core\n"
 
-								// Do things based on attribute
-								switch (attrib) {
-									default: MU_SET_RESULT(result, MUCOSA_FAILED_UNKNOWN_WINDOW_ATTRIB) return; break;
+						// Input (pos, col, cen, rad)
+						"layout(location=0)in vec3 vPos;"
+						"layout(location=1)in vec4 vCol;"
+						"layout(location=2)in vec2 vCen;"
+						"layout(location=3)in float vRad;"
 
-									// Dimensions
-									case MU_WINDOW_DIMENSIONS: res = muCOSAW32_window_get_dimensions(w32_win, (uint32_m*)data); break;
-									// Position
-									case MU_WINDOW_POSITION: res = muCOSAW32_window_get_position(w32_win, (int32_m*)data); break;
-									// Keyboard keymap
-									case MU_WINDOW_KEYBOARD_MAP: res = muCOSAW32_window_get_keyboard_map(w32_win, (muBool**)data); break;
-									// Keystate keymap
-									case MU_WINDOW_KEYSTATE_MAP: res = muCOSAW32_window_get_keystate_map(w32_win, (muBool**)data); break;
-									// Mouse keymap
-									case MU_WINDOW_MOUSE_MAP: res = muCOSAW32_window_get_mouse_map(w32_win, (muBool**)data); break;
-									// Scroll
-									case MU_WINDOW_SCROLL_LEVEL: muCOSAW32_window_get_scroll(w32_win, (int32_m*)data); return; break;
-									// Cursor
-									case MU_WINDOW_CURSOR: res = muCOSAW32_window_get_cursor_pos(w32_win, (int32_m*)data); break;
-									// Cursor style
-									case MU_WINDOW_CURSOR_STYLE: res = muCOSAW32_window_get_cursor_style(w32_win, (muCursorStyle*)data); break;
-								}
+						// Output (col, cen, float rad)
+						"out vec4 fCol;"
+						"out vec2 fCen;"
+						"out float fRad;"
 
-								if (res != MUCOSA_SUCCESS) {
-									MU_SET_RESULT(result, res)
-								}
-								return;
-							} break;)
-						}
+						// Dimensions of graphic divided by 2
+						"uniform vec2 d;"
+						// Modifiers
+						"uniform vec3 aP;" // addPos
+						"uniform vec3 mP;" // mulPos
 
-						// To avoid unused parameter warnings in some cases
-						if (result) {} if (win) {} if (attrib) {} if (data) {}
-					}
+						// Main
+						"void main(){"
+							// Set position
+							"gl_Position=vec4("
+								// X
+								"(((vPos.x*mP.x)+aP.x)-(d.x))/d.x,"
+								// Y
+								"-(((vPos.y*mP.y)+aP.y)-(d.y))/d.y,"
+								// Z
+								"((vPos.z*mP.z)+aP.z),"
+								// W
+								"1.0"
+							");"
 
-					MUDEF void muCOSA_window_set(muCOSAContext* context, muCOSAResult* result, muWindow win, muWindowAttrib attrib, void* data) {
-						// Get inner from context
-						muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+							// Transfer data to fragment
+							"fCol=vCol;"
+							// (Flip y because fragcoord is bottom-left origin)
+							"fCen=vec2((vCen.x*mP.x)+aP.x, (d.y*2.0)-((vCen.y*mP.y)+aP.y));"
+							"fRad=vRad;"
+						"}"
+					;
 
-						// Do things based on window system
-						switch (inner->system) {
-							default: return; break;
+					// Fragment shader
+					const char* mugGL_circleFS = 
+						// Version
+						"#version 330 core\n"
 
-							// Win32
-							MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
-								muCOSAResult res = MUCOSA_SUCCESS;
-								muCOSAW32_Window* w32_win = (muCOSAW32_Window*)win;
+						// Input (col, cen, rad)
+						"in vec4 fCol;"
+						"in vec2 fCen;"
+						"in float fRad;"
+						// Output (col)
+						"out vec4 oCol;"
 
-								// Do things based on attribute
-								switch (attrib) {
-									default: MU_SET_RESULT(result, MUCOSA_FAILED_UNKNOWN_WINDOW_ATTRIB) return; break;
+						// Modifiers
+						"uniform vec4 aC;" // addCol
+						"uniform vec4 mC;" // mulCol
 
-									// Title
-									case MU_WINDOW_TITLE: res = muCOSAW32_window_set_title(w32_win, (char*)data); break;
-									// Dimensions
-									case MU_WINDOW_DIMENSIONS: res = muCOSAW32_window_set_dimensions(w32_win, (uint32_m*)data); break;
-									// Position
-									case MU_WINDOW_POSITION: res = muCOSAW32_window_set_position(w32_win, (int32_m*)data); break;
-									// Scroll
-									case MU_WINDOW_SCROLL_LEVEL: muCOSAW32_window_set_scroll(w32_win, (int32_m*)data); return; break;
-									// Cursor
-									case MU_WINDOW_CURSOR: res = muCOSAW32_window_set_cursor_pos(w32_win, (int32_m*)data); break;
-									// Cursor style
-									case MU_WINDOW_CURSOR_STYLE: res = muCOSAW32_window_set_cursor_style(w32_win, (muCursorStyle*)data); break;
-									// Callbacks
-									case MU_WINDOW_DIMENSIONS_CALLBACK: case MU_WINDOW_POSITION_CALLBACK:
-									case MU_WINDOW_KEYBOARD_CALLBACK: case MU_WINDOW_KEYSTATE_CALLBACK:
-									case MU_WINDOW_MOUSE_KEY_CALLBACK: case MU_WINDOW_CURSOR_CALLBACK:
-									case MU_WINDOW_SCROLL_CALLBACK: muCOSAW32_window_set_callback(w32_win, attrib, data); return; break;
-								}
+						// Returns a smooth transition between 0.0 and 1.0
+						// depending on if pixel (p) is outside of circle
+						// (center c, radius r)
+						// Uses this formula (lol):
+						// \max\left(\min\left(-\left(\sqrt{\left(p.x-c.x\right)^{2}+\left(p.y-c.y\right)^{2}}-r\right)+0.5,1\right),0\right)
+						"float dis(vec2 p,vec2 c,float r){"
+							// Return inverse of:
+							"return 1.0-"
+								"max(min("
+								// Negative if outside, positive if inside
+								// Fades between edge of circle; automatic anti-aliasing >:)
+								"(sqrt(pow(p.x-c.x,2.0)+pow(p.y-c.y,2.0))-r)+0.5,"
+								// Maximum value of 1
+								"1.0),"
+								// Minimum value of 0
+								"0.0);"
+						"}"
+
+						// Main
+						"void main(){"
+							// Calculate color
+							"oCol=vec4(fCol.rgb, fCol.a*dis(gl_FragCoord.xy,fCen,fRad));"
+							// Apply modifiers
+							"oCol=(oCol*mC)+aC;"
+						"}"
+					;
 
-								if (res != MUCOSA_SUCCESS) {
-									MU_SET_RESULT(result, res)
-								}
-								return;
-							} break;)
+					// Creates program for circles
+					void mugGL_circles_shader_load(mug_Graphic* gfx, mugGL_Shader* shader, mugResult* result) {
+						// Exit if shader already compiled
+						if (shader->program) {
+							return;
 						}
 
-						// To avoid unused parameter warnings in some cases
-						if (result) {} if (win) {} if (attrib) {} if (data) {}
+						// Compile shader
+						mugResult res = mugGL_shader_create_vf(gfx, shader, mugGL_circleVS, mugGL_circleFS);
+						if (res != MUG_SUCCESS) {
+							MU_SET_RESULT(result, res)
+						}
 					}
 
-				/* Text input */
-
-					MUDEF void muCOSA_window_get_text_input(muCOSAContext* context, muCOSAResult* result, muWindow win, uint32_m text_cursor_x, uint32_m text_cursor_y, void (*callback)(muWindow window, uint8_m* data)) {
-						// Get inner from context
-						muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
-
-						// Do things based on window system
-						switch (inner->system) {
-							default: return; break;
+				/* Buffer */
 
-							// Win32
-							MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
-								muCOSAW32_window_get_text_input(result, (muCOSAW32_Window*)win, text_cursor_x, text_cursor_y, callback);
-								return;
-							} break;)
-						}
+					// Fills a particular vertex given what to multiply radius by
+					// (Used to alternate between 4 corners)
+					// Returns new v pointer after this vertex
+					static inline GLfloat* mugGL_circles_fill_invertexes(
+						// Circle data
+						GLfloat* v, mugCircle* circle,
+						// Radius data
+						float vradx, float vrady
+					) {
+						// vec3 pos
+						// - x and y
+						*v++ = circle->center.pos[0]+(circle->radius*vradx);
+						*v++ = circle->center.pos[1]+(circle->radius*vrady);
+						// - z
+						*v++ = circle->center.pos[2];
 
-						// To avoid unused parameter warnings in some cases
-						if (result) {} if (win) {} if (text_cursor_x) {} if (text_cursor_y) {} if (callback) {}
+						// vec4 col
+						mu_memcpy(v, circle->center.col, 16);
+						// vec2 cen
+						mu_memcpy(v+4, circle->center.pos, 8);
+						// float rad
+						v[6] = circle->radius;
+						return v+7;
 					}
 
-					MUDEF void muCOSA_window_let_text_input(muCOSAContext* context, muWindow win) {
-						// Get inner from context
-						muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
-
-						// Do things based on window system
-						switch (inner->system) {
-							default: return; break;
+					// Fills vertex data
+					void mugGL_circles_fill_vertexes(GLfloat* v, void* obj, uint32_m c) {
+						// Convert obj to struct array
+						mugCircle* circles = (mugCircle*)obj;
 
-							// Win32
-							MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
-								muCOSAW32_window_let_text_input((muCOSAW32_Window*)win);
-								return;
-							} break;)
+						// Loop through each circle
+						for (uint32_m i = 0; i < c; ++i) {
+							// Top-left
+							v = mugGL_circles_fill_invertexes(v, circles,  -1.f, -1.f);
+							// Bottom-left
+							v = mugGL_circles_fill_invertexes(v, circles,  -1.f,  1.f);
+							// Bottom-right
+							v = mugGL_circles_fill_invertexes(v, circles,   1.f,  1.f);
+							// Top-right
+							v = mugGL_circles_fill_invertexes(v, circles++, 1.f, -1.f);
 						}
-
-						// To avoid unused parameter warnings in some cases
-						if (win) {}
 					}
 
-					MUDEF void muCOSA_window_update_text_cursor(muCOSAContext* context, muCOSAResult* result, muWindow win, uint32_m x, uint32_m y) {
-						// Get inner from context
-						muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+					// Fill index data (same as rect)
+					#define mugGL_circles_fill_indexes mugGL_rects_fill_indexes
 
-						// Do things based on window system
-						switch (inner->system) {
-							default: return; break;
+					// Describes circle data
+					void mugGL_circles_desc(void) {
+						// vec3 pos
+						glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 40, 0);
+						glEnableVertexAttribArray(0);
+						// vec4 col
+						glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, 40, (void*)(12));
+						glEnableVertexAttribArray(1);
+						// vec2 cen
+						glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 40, (void*)(28));
+						glEnableVertexAttribArray(2);
+						// float rad
+						glVertexAttribPointer(3, 1, GL_FLOAT, GL_FALSE, 40, (void*)(36));
+						glEnableVertexAttribArray(3);
+					}
 
-							// Win32
-							MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
-								muCOSAW32_window_update_text_cursor(result, (muCOSAW32_Window*)win, x, y);
-								return;
-							} break;)
+					// Renders circles (same as rect)
+					#define mugGL_circles_render mugGL_rects_render
+					// Subrenders circles (same as rect)
+					#define mugGL_circles_subrender mugGL_rects_subrender
+					// Multirenders circles (same as rect)
+					#define mugGL_circles_multirender mugGL_rects_multirender
+
+					// Returns coverage of circle at (x, y) (matches mugGL_circleFS)
+					float mugGL_circles_cover(GLfloat* v, float x, float y) {
+						// Check if within geometry
+						if (!mugMath_point_in_polygon(v, 4, 10, x, y)) {
+							return 0.f;
 						}
-
-						// To avoid unused parameter warnings in some cases
-						if (result) {} if (win) {} if (x) {} if (y) {}
+						// dis(p, c, r)
+						float ox = x-v[7], oy = y-v[8];
+						return 1.f - mugMath_clamp((mu_sqrtf(ox*ox + oy*oy) - v[9]) + 0.5f, 0.f, 1.f);
 					}
 
-				/* OpenGL */
-
-					MUDEF muGLContext muCOSA_gl_context_create(muCOSAContext* context, muCOSAResult* result, muWindow win, muGraphicsAPI api) {
-						#ifdef MU_SUPPORT_OPENGL
-						// Get inner from context
-						muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+					// Returns if circle overlaps an area
+					muBool mugGL_circles_overlaps(GLfloat* v, float* area) {
+						return mugGL_smooth_overlaps(v, area, v[7], v[8], mugGL_circles_cover);
+					}
 
-						// Do things based on window system
-						switch (inner->system) {
-							default: return 0; break;
+					// Fills buffer with needed info
+					void mugGL_circles_fill(mugGL_ObjBuffer* buf) {
+						buf->obj_type = MUG_OBJECT_CIRCLE;
 
-							// Win32
-							MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
-								return muCOSAW32_gl_context_create(
-									(muCOSAW32_Context*)inner->context, result,
-									(muCOSAW32_Window*)win, api
-								);
-							} break;)
-						}
+						// Amount of bytes used on vertex per object:
+						// one vertex = vec3+vec4+vec2+float (40)
+						// one circle = four vertexes (160)
+						buf->bv_per_obj = 160;
+						// Amount of vertexes per object
+						buf->v_per_obj = 4;
 
-						// To avoid parameter warnings in certain circumstances
-						if (result) {} if (win) {} if (api) {}
+						// Amount of bytes used on index per object:
+						// one circle = six indexes (24)
+						buf->bi_per_obj = 24;
 
-						// Fallback for non-OpenGL support:
-						#else
-						MU_SET_RESULT(result, MUCOSA_FAILED_UNSUPPORTED_GRAPHICS_API)
-						return 0;
-						if (context) {} if (result) {} if (win) {} if (api) {}
-						#endif
+						// Function equivalents
+						buf->fill_vertexes = mugGL_circles_fill_vertexes;
+						buf->fill_indexes = mugGL_circles_fill_indexes;
+						buf->desc = mugGL_circles_desc;
+						buf->render = mugGL_circles_render;
+						buf->subrender = mugGL_circles_subrender;
+						buf->multirender = mugGL_circles_multirender;
+						buf->cover = mugGL_circles_cover;
+						buf->overlaps = mugGL_circles_overlaps;
 					}
 
-					MUDEF muGLContext muCOSA_gl_context_destroy(muCOSAContext* context, muWindow win, muGLContext gl_context) {
-						#ifdef MU_SUPPORT_OPENGL
-						// Get inner from context
-						muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
-
-						// Do things based on window system
-						switch (inner->system) {
-							default: return 0; break;
-
-							// Win32
-							MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
-								muCOSAW32_gl_context_destroy((muCOSAW32_GL*)gl_context);
-								return 0;
-							} break;)
-						}
+			/* Squircle */
 
-						// To avoid parameter warnings in certain circumstances
-						if (win) {} if (gl_context) {}
+				// Data format: { vec3 pos, vec4 col, float rot, vec2 cen, float rad, float exp }
+				// Indexed data: { 0, 1, 3, 1, 2, 3 }
 
-						// Fallback for non-OpenGL support:
-						#else
-						return 0;
-						if (context) {} if (win) {} if (gl_context) {}
-						#endif
-					}
+				/* Shaders */
 
-					MUDEF void muCOSA_gl_bind(muCOSAContext* context, muCOSAResult* result, muWindow win, muGLContext gl_context) {
-						#ifdef MU_SUPPORT_OPENGL
-						// Get inner from context
-						muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+					// Vertex shader
+					const char* mugGL_squircleVS = 
+						// Version
+						"#version 330 core\n"
 
-						// Do things based on window system
-						switch (inner->system) {
-							default: return; break;
+						// Input (pos, col, rot, cen, rad, exp)
+						"layout(location=0)in vec3 vPos;"
+						"layout(location=1)in vec4 vCol;"
+						"layout(location=2)in float vRot;"
+						"layout(location=3)in vec2 vCen;"
+						"layout(location=4)in float vRad;"
+						"layout(location=5)in float vExp;"
 
-							// Win32
-							MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
-								muCOSAResult res = muCOSAW32_gl_bind((muCOSAW32_GL*)gl_context);
-								if (res != MUCOSA_SUCCESS) {
-									MU_SET_RESULT(result, res)
-								}
-								return;
-							} break;)
-						}
+						// Output (rot, col, cen, rad, exp)
+						"out float fRot;"
+						"out vec4 fCol;"
+						"out vec2 fCen;"
+						"out float fRad;"
+						"out float fExp;"
 
-						// To avoid parameter warnings in certain circumstances
-						if (result) {} if (win) {} if (gl_context) {}
+						// Dimensions of graphic divided by 2
+						"uniform vec2 d;"
+						// Modifiers
+						"uniform vec3 aP;" // addPos
+						"uniform vec3 mP;" // mulPos
 
-						// Fallback for non-OpenGL support:
-						#else
-						MU_SET_RESULT(result, MUCOSA_FAILED_UNSUPPORTED_GRAPHICS_API)
-						return;
-						if (context) {} if (result) {} if (win) {} if (gl_context) {}
-						#endif
-					}
+						// Main
+						"void main(){"
+							// Set position
+							"gl_Position=vec4("
+								// X
+								"(((vPos.x*mP.x)+aP.x)-(d.x))/d.x,"
+								// Y
+								"-(((vPos.y*mP.y)+aP.y)-(d.y))/d.y,"
+								// Z
+								"(vPos.z*mP.z)+aP.z,"
+								// W
+								"1.0"
+							");"
 
-					MUDEF void muCOSA_gl_swap_buffers(muCOSAContext* context, muCOSAResult* result, muWindow win) {
-						#ifdef MU_SUPPORT_OPENGL
-						// Get inner from context
-						muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+							// Transfer data to fragment
+							"fRot=vRot;"
+							"fCol=vCol;"
+							// (Flip y because fragcoord is bottom-left origin)
+							"fCen=vec2((vCen.x*mP.x)+aP.x, (d.y*2.0)-((vCen.y*mP.y)+aP.y));"
+							"fRad=vRad;"
+							"fExp=vExp;"
+						"}"
+					;
 
-						// Do things based on window system
-						switch (inner->system) {
-							default: return; break;
+					// Fragment shader
+					const char* mugGL_squircleFS =
+						// Version
+						"#version 330 core\n"
 
-							// Win32
-							MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
-								muCOSAResult res = muCOSAW32_gl_swap_buffers((muCOSAW32_Window*)win);
-								if (res != MUCOSA_SUCCESS) {
-									MU_SET_RESULT(result, res)
-								}
-								return;
-							} break;)
-						}
+						// Input (rot, col, cen, rad, exp)
+						"in float fRot;"
+						"in vec4 fCol;"
+						"in vec2 fCen;"
+						"in float fRad;"
+						"in float fExp;"
+						// Output (col)
+						"out vec4 oCol;"
 
-						// To avoid parameter warnings in certain circumstances
-						if (result) {} if (win) {}
+						// Modifiers
+						"uniform vec4 aC;" // addCol
+						"uniform vec4 mC;" // mulCol
 
-						// Fallback for non-OpenGL support:
-						#else
-						MU_SET_RESULT(result, MUCOSA_FAILED_UNSUPPORTED_GRAPHICS_API)
-						return;
-						if (context) {} if (result) {} if (win) {}
-						#endif
-					}
+						// Rotates point (p) around center (c)
+						// Rotation is given by cos (cr) and sin (sr) of rotation
+						"vec2 r(vec2 p,vec2 c,float cr,float sr){"
+							"vec2 o=p-c;"
+							// MATH
+							"return vec2((o.x*cr-o.y*sr)+c.x,(o.x*sr+o.y*cr)+c.y);"
+						"}"
 
-					MUDEF void* muCOSA_gl_get_proc_address(muCOSAContext* context, const char* name) {
-						#ifdef MU_SUPPORT_OPENGL
-						// Get inner from context
-						muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+						// Returns a smooth transition between 0.0 and 1.0
+						// depending on if pixel (p) is outside of squircle
+						// (center c, radius r, exponent e)
+						// Uses this formula:
+						// \max\left(\min\left(-\left(\left(\left|p.x-c.x\right|^{b}+\left|p.y-c.y\right|^{b}\right)^{\frac{1}{b}}-r\right)+0.5,1\right),0\right)
+						// ^ (b is the exponent)
+						"float s(vec2 p,vec2 c,float r,float e){"
+							// Return inverse of:
+							"return 1.0-"
+								"max(min("
+								// Negative if outside, positive if inside
+								// Fades between edge of squircle; automatic anti-aliasing >:)
+								"(pow(pow(abs(p.x-c.x),e)+pow(abs(p.y-c.y),e),1.0/e)-r)+0.5,"
+								// Maximum value of 1
+								"1.0),"
+								// Maximum value of 0
+								"0.0)"
+							";"
+						"}"
 
-						// Do things based on window system
-						switch (inner->system) {
-							default: return 0; break;
+						// Main
+						"void main(){"
+							// Calculate color (rotating FragCoord to adjust for rotation)
+							"oCol=vec4(fCol.rgb, fCol.a*s(r(gl_FragCoord.xy,fCen,sin(fRot),cos(fRot)),fCen,fRad,fExp));"
+							// Apply modifiers
+							"oCol=(oCol*mC)+aC;"
+						"}"
+					;
 
-							// Win32
-							MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
-								return muCOSAW32_gl_get_proc_address(name);
-							} break;)
+					// Creates program for squircles
+					void mugGL_squircles_shader_load(mug_Graphic* gfx, mugGL_Shader* shader, mugResult* result) {
+						// Exit if shader already compiled
+						if (shader->program) {
+							return;
 						}
 
-						// To avoid parameter warnings in certain circumstances
-						if (name) {}
-
-						// Fallback for non-OpenGL support:
-						#else
-						return 0;
-						if (context) {} if (name) {}
-						#endif
+						// Compile shader
+						mugResult res = mugGL_shader_create_vf(gfx, shader, mugGL_squircleVS, mugGL_squircleFS);
+						if (res != MUG_SUCCESS) {
+							MU_SET_RESULT(result, res)
+						}
 					}
 
-					MUDEF muBool muCOSA_gl_swap_interval(muCOSAContext* context, muCOSAResult* result, int interval) {
-						#ifdef MU_SUPPORT_OPENGL
-						// Get inner from context
-						muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
-
-						// Do things based on window system
-						switch (inner->system) {
-							default: return 0; break;
+				/* Buffer */
 
-							// Win32
-							MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
-								return muCOSAW32_gl_swap_interval((muCOSAW32_Context*)inner->context, result, interval);
-							} break;)
-						}
+					// Fills a particular vertex given what to multiply radius by
+					// (Used to alternate between 4 corners)
+					// Returns new v pointer after this vertex
+					static inline GLfloat* mugGL_squircles_fill_invertexes(
+						// Squircle data
+						GLfloat* v, mugSquircle* squircle,
+						// Radius data
+						float vradx, float vrady,
+						// Rotation data
+						float srot, float crot
+					) {
+						// vec3 pos
+						// - x and y (rotated)
+						mugMath_rot_point_point(
+							squircle->center.pos[0]+(squircle->radius*vradx), // Point x
+							squircle->center.pos[1]+(squircle->radius*vrady), // Point y
+							squircle->center.pos[0], // Center x
+							squircle->center.pos[1], // Center y
+							srot, crot, // Sin / Cos rotation
+							v
+						);
+						// - z
+						v[2] = squircle->center.pos[2];
+						v += 3;
 
-						// Fallback for non-OpenGL support
-						#else
-						MU_SET_RESULT(result, MUCOSA_FAILED_UNSUPPORTED_GRAPHICS_API)
-						return 0;
-						if (context) {} if (result) {} if (interval) {}
-						#endif
+						// vec4 col
+						mu_memcpy(v, squircle->center.col, 16);
+						// float rot
+						v[4] = squircle->rot;
+						// vec2 cen
+						mu_memcpy(v+5, squircle->center.pos, 8);
+						// float rad
+						v[7] = squircle->radius;
+						// float exp
+						v[8] = squircle->exp;
+						return v+9;
 					}
 
-			/* Time */
-
-				MUDEF double muCOSA_fixed_time_get(muCOSAContext* context) {
-					// Get inner from context
-					muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+					// Fills vertex data
+					void mugGL_squircles_fill_vertexes(GLfloat* v, void* obj, uint32_m c) {
+						// Convert obj to struct array
+						mugSquircle* squircles = (mugSquircle*)obj;
 
-					// Do things based on window system
-					switch (inner->system) {
-						default: return 0.0; break;
+						// Loop through each squircle
+						for (uint32_m i = 0; i < c; ++i) {
+							// Calculate rotation values
+							// Sin is negative because y-direction is flipped in mug coordinates
+							float srot = -mu_sinf(squircles->rot);
+							float crot = mu_cosf(squircles->rot);
 
-						// Win32
-						MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
-							return muCOSAW32_fixed_time_get((muCOSAW32_Context*)inner->context);
-						} break;)
+							// Top-left
+							v = mugGL_squircles_fill_invertexes(v, squircles,  -1.f, -1.f, srot, crot);
+							// Bottom-left
+							v = mugGL_squircles_fill_invertexes(v, squircles,  -1.f,  1.f, srot, crot);
+							// Bottom-right
+							v = mugGL_squircles_fill_invertexes(v, squircles,   1.f,  1.f, srot, crot);
+							// Top-right
+							v = mugGL_squircles_fill_invertexes(v, squircles++, 1.f, -1.f, srot, crot);
+						}
 					}
-				}
 
-				MUDEF double muCOSA_time_get(muCOSAContext* context) {
-					// Get inner from context
-					muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+					// Fill index data (same as rect)
+					#define mugGL_squircles_fill_indexes mugGL_rects_fill_indexes
 
-					// Do things based on window system
-					switch (inner->system) {
-						default: return 0.0; break;
+					// Describes squircle data
+					void mugGL_squircles_desc(void) {
+						// vec3 pos
+						glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 48, 0);
+						glEnableVertexAttribArray(0);
+						// vec4 col
+						glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, 48, (void*)(12));
+						glEnableVertexAttribArray(1);
+						// float rot
+						glVertexAttribPointer(2, 1, GL_FLOAT, GL_FALSE, 48, (void*)(28));
+						glEnableVertexAttribArray(2);
+						// vec2 cen
+						glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, 48, (void*)(32));
+						glEnableVertexAttribArray(3);
+						// float rad
+						glVertexAttribPointer(4, 1, GL_FLOAT, GL_FALSE, 48, (void*)(40));
+						glEnableVertexAttribArray(4);
+						// float exp
+						glVertexAttribPointer(5, 1, GL_FLOAT, GL_FALSE, 48, (void*)(44));
+						glEnableVertexAttribArray(5);
+					}
 
-						// Win32
-						MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
-							return muCOSAW32_time_get((muCOSAW32_Context*)inner->context);
-						} break;)
+					// Renders squircles (same as rect)
+					#define mugGL_squircles_render mugGL_rects_render
+					// Subrenders squircles (same as rect)
+					#define mugGL_squircles_subrender mugGL_rects_subrender
+					// Multirenders squircles (same as rect)
+					#define mugGL_squircles_multirender mugGL_rects_multirender
+
+					// Returns coverage of squircle at (x, y) (matches mugGL_squircleFS)
+					float mugGL_squircles_cover(GLfloat* v, float x, float y) {
+						// Check if within geometry
+						if (!mugMath_point_in_polygon(v, 4, 12, x, y)) {
+							return 0.f;
+						}
+						// r(p, c, sin(rot), cos(rot)), with y flipped like gl_FragCoord
+						float ox = x-v[8], oy = v[9]-y;
+						float cr = mu_sinf(v[7]), sr = mu_cosf(v[7]);
+						float rx = ox*cr - oy*sr, ry = ox*sr + oy*cr;
+						// s(p, c, r, e)
+						if (rx < 0.f) rx = -rx;
+						if (ry < 0.f) ry = -ry;
+						float e = v[11];
+						return 1.f - mugMath_clamp((mu_powf(mu_powf(rx, e) + mu_powf(ry, e), 1.f/e) - v[10]) + 0.5f, 0.f, 1.f);
 					}
-				}
 
-				MUDEF void muCOSA_time_set(muCOSAContext* context, double time) {
-					// Get inner from context
-					muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+					// Returns if squircle overlaps an area
+					muBool mugGL_squircles_overlaps(GLfloat* v, float* area) {
+						return mugGL_smooth_overlaps(v, area, v[8], v[9], mugGL_squircles_cover);
+					}
 
-					// Do things based on window system
-					switch (inner->system) {
-						default: return; break;
+					// Fills buffer with needed info
+					void mugGL_squircles_fill(mugGL_ObjBuffer* buf) {
+						buf->obj_type = MUG_OBJECT_SQUIRCLE;
 
-						// Win32
-						MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
-							muCOSAW32_time_set((muCOSAW32_Context*)inner->context, time);
-							return;
-						} break;)
-					}
+						// Amount of bytes used on vertex per object:
+						// one vertex = vec3+vec4+float+vec2+float+float (48)
+						// one squircle = four vertexes (192)
+						buf->bv_per_obj = 192;
+						// Amount of vertexes per object
+						buf->v_per_obj = 4;
 
-					// To avoid parameter warnings in certain cirumstances
-					if (time) {}
-				}
+						// Amount of bytes used on index per object:
+						// one squircle = six indexes (24)
+						buf->bi_per_obj = 24;
 
-			/* Sleep */
+						// Function equivalents
+						buf->fill_vertexes = mugGL_squircles_fill_vertexes;
+						buf->fill_indexes = mugGL_squircles_fill_indexes;
+						buf->desc = mugGL_squircles_desc;
+						buf->render = mugGL_squircles_render;
+						buf->subrender = mugGL_squircles_subrender;
+						buf->multirender = mugGL_squircles_multirender;
+						buf->cover = mugGL_squircles_cover;
+						buf->overlaps = mugGL_squircles_overlaps;
+					}
 
-				MUDEF void muCOSA_sleep(muCOSAContext* context, double time) {
-					// Get inner from context
-					muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+			/* Round rect */
 
-					// Do things based on window system
-					switch (inner->system) {
-						default: return; break;
+				// Data format: { vec3 pos, vec4 col, float rot, vec2 cen, vec2 dim, float rad }
+				// * dim is actually half-dimensions
+				// Indexed data: { 0, 1, 3, 1, 2, 3 }
 
-						// Win32
-						MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
-							muCOSAW32_sleep(time);
-							return;
-						} break;)
-					}
+				/* Shaders */
 
-					// To avoid parameter warnings in certain circumstances
-					if (time) {}
-				}
+					// Vertex shader
+					const char* mugGL_roundrectVS = 
+						// Version
+						"#version 330 core\n"
 
-			/* Clipboard */
+						// Input ( pos, col, rot, cen, dim, rad )
+						"layout(location=0)in vec3 vPos;"
+						"layout(location=1)in vec4 vCol;"
+						"layout(location=2)in float vRot;"
+						"layout(location=3)in vec2 vCen;"
+						"layout(location=4)in vec2 vDim;"
+						"layout(location=5)in float vRad;"
 
-				MUDEF uint8_m* muCOSA_clipboard_get(muCOSAContext* context, muCOSAResult* result) {
-					// Get inner from context
-					muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+						// Output (col, rot, cen, dim, rad)
+						"out vec4 fCol;"
+						"out float fRot;"
+						"out vec2 fCen;"
+						"out vec2 fDim;"
+						"out float fRad;"
 
-					// Do things based on window system
-					switch (inner->system) {
-						default: return 0; break;
+						// Dimensions of graphic divided by 2
+						"uniform vec2 d;"
+						// Modifiers
+						"uniform vec3 aP;" // addPos
+						"uniform vec3 mP;" // mulPos
 
-						// Win32
-						MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
-							return muCOSAW32_clipboard_get(result);
-						} break;)
-					}
+						// Main
+						"void main(){"
+							// Set position
+							"gl_Position=vec4("
+								// X
+								"(((vPos.x*mP.x)+aP.x)-(d.x))/d.x,"
+								// Y
+								"-(((vPos.y*mP.y)+aP.y)-(d.y))/d.y,"
+								// Z
+								"(vPos.z*mP.z)+aP.z,"
+								// W
+								"1.0"
+							");"
 
-					// To avoid unused parameter warnings in some circumstances
-					if (result) {}
-				}
+							// Transfer data to fragment
+							"fCol=vCol;"
+							"fRot=vRot;"
+							// (Flip y because fragcoord is bottom-left origin)
+							"fCen=vec2((vCen.x*mP.x)+aP.x,(d.y*2.0)-((vCen.y*mP.y)+aP.y));"
+							"fDim=vDim;"
+							"fRad=vRad;"
+						"}"
+					;
 
-				MUDEF void muCOSA_clipboard_set(muCOSAContext* context, muCOSAResult* result, uint8_m* data, size_m datalen) {
-					// Get inner from context
-					muCOSA_Inner* inner = (muCOSA_Inner*)context->inner;
+					// Fragment shader
+					const char* mugGL_roundrectFS =
+						// Version
+						"#version 330 core\n"
 
-					// Do things based on window system
-					switch (inner->system) {
-						default: return; break;
+						// Input (col, rot, cen, dim, rad)
+						"in vec4 fCol;"
+						"in float fRot;"
+						"in vec2 fCen;"
+						"in vec2 fDim;"
+						"in float fRad;"
+						// Output (col)
+						"out vec4 oCol;"
 
-						// Win32
-						MUCOSA_WIN32_CALL(case MU_WINDOW_WIN32: {
-							muCOSAW32_clipboard_set(result, data, datalen);
-							return;
-						} break;)
-					}
+						// Modifiers
+						"uniform vec4 aC;" // addCol
+						"uniform vec4 mC;" // mulCol
 
-					// To avoid unused parameter warnings in some circumstances
-					if (result) {} if (data) {} if (datalen) {}
-				}
+						// Rotates point (p) around center (c)
+						// Rotation is given by cos (cr) and sin(sr) of rotation
+						"vec2 r(vec2 p,vec2 c,float cr,float sr){"
+							"vec2 o=p-c;"
+							// MATH
+							"return vec2((o.x*cr-o.y*sr)+c.x,(o.x*sr+o.y*cr)+c.y);"
+						"}"
 
-			/* Result */
+						// Main
+						"void main(){"
+							// Calculate pixel based on rotation of FragCoord
+							"vec2 p=r(gl_FragCoord.xy,fCen,sin(fRot),cos(fRot));"
+							// Calculate absolute distance from center
+							"vec2 j=vec2(abs(p.x-fCen.x),abs(p.y-fCen.y));"
+							// Calculate alpha multiplier:
+							"float a="
+								// If we're inside of rectangle's bounding box:
+								// - \left|x-p.x\right|\le w_{0}\left\{\left|y-p.y\right|\le h_{0}-r\right\}
+								// - \left|y-p.y\right|\le h_{0}\left\{\left|x-p.x\right|\le w_{0}-r\right\}
+								"((j.x<=fDim.x && j.y<=fDim.y-fRad) || (j.y<=fDim.y && j.x<+fDim.x-fRad))?"
+									// If these checks passed, we're in the rectangle; just set to 1.0
+									"1.0:"
+								// If it didn't succeed, we're in a circle corner
+								// In this case, we use the magical equation to return a smooth transition
+								// between in and out of the corner (automatic AA)
+								// - \max\left(\min\left(-\left(\sqrt{\left|\left|j.x-p.x\right|-w_{0}+r\right|^{2}+\left|\left|j.y-p.y\right|-h_{0}+r\right|^{2}}-r\right)+0.5,1\right),0\right)
+								"max(min(-(sqrt(pow(abs(j.x-fDim.x+fRad),2.0)+pow(abs(j.y-fDim.y+fRad),2.0))-fRad)+0.5,1.0),0.0)"
+							";"
+							// Calculate color
+							"oCol=vec4(fCol.rgb,fCol.a*a);"
+							// Apply modifiers
+							"oCol=(oCol*mC)+aC;"
+						"}"
+					;
 
-				MUDEF muBool muCOSA_result_is_fatal(muCOSAResult result) {
-					switch (result) {
-						// Fatal errors (assumed fatal):
-						default: return MU_TRUE; break;
+					// Creates program for round rects
+					void mugGL_roundrects_shader_load(mug_Graphic* gfx, mugGL_Shader* shader, mugResult* result) {
+						// Exit if shader already compiled
+						if (shader->program) {
+							return;
+						}
 
-						// All non-fatal errors:
-						case MUCOSA_SUCCESS:
-						case MUCOSA_WIN32_FAILED_REGISTER_DUMMY_WGL_WINDOW_CLASS:
-						case MUCOSA_WIN32_FAILED_CREATE_DUMMY_WGL_WINDOW:
-						case MUCOSA_WIN32_FAILED_GET_DUMMY_WGL_PIXEL_FORMAT:
-						case MUCOSA_WIN32_FAILED_DESCRIBE_DUMMY_WGL_PIXEL_FORMAT:
-						case MUCOSA_WIN32_FAILED_SET_DUMMY_WGL_PIXEL_FORMAT:
-						case MUCOSA_WIN32_FAILED_CREATE_DUMMY_WGL_CONTEXT:
-						case MUCOSA_WIN32_FAILED_BIND_DUMMY_WGL_CONTEXT:
-						case MUCOSA_WIN32_FAILED_FIND_WGL_CREATE_CONTEXT_ATTRIBS:
-						case MUCOSA_WIN32_FAILED_FIND_WGL_CHOOSE_PIXEL_FORMAT:
-						case MUCOSA_WIN32_FAILED_CHOOSE_WGL_PIXEL_FORMAT:
-							return MU_FALSE;
-						break;
+						// Compile shader
+						mugResult res = mugGL_shader_create_vf(gfx, shader, mugGL_roundrectVS, mugGL_roundrectFS);
+						if (res != MUG_SUCCESS) {
+							MU_SET_RESULT(result, res)
+						}
 					}
-				}
-
-			/* Names */
 
-			MUCOSA_NAME_CALL(
-				MUDEF const char* muCOSA_result_get_name(muCOSAResult result) {
-					switch (result) {
-						default: return "MU_UNKNOWN"; break;
+				/* Buffer */
 
-						case MUCOSA_SUCCESS: return "MUCOSA_SUCCESS"; break;
-						case MUCOSA_FAILED_NULL_WINDOW_SYSTEM: return "MUCOSA_FAILED_NULL_WINDOW_SYSTEM"; break;
-						case MUCOSA_FAILED_MALLOC: return "MUCOSA_FAILED_MALLOC"; break;
-						case MUCOSA_FAILED_UNKNOWN_WINDOW_ATTRIB: return "MUCOSA_FAILED_UNKNOWN_WINDOW_ATTRIB"; break;
-						case MUCOSA_FAILED_REALLOC: return "MUCOSA_FAILED_REALLOC"; break;
-						case MUCOSA_FAILED_UNKNOWN_GRAPHICS_API: return "MUCOSA_FAILED_UNKNOWN_GRAPHICS_API"; break;
-						case MUCOSA_FAILED_UNSUPPORTED_GRAPHICS_API: return "MUCOSA_FAILED_UNSUPPORTED_GRAPHICS_API"; break;
+					// Fills a particular vertex given what to multiply dimensions by
+					// (Used to alternate between 4 corners)
+					// Returns new v pointer after this vertex
+					static inline GLfloat* mugGL_roundrects_fill_invertexes(
+						// Round rect data
+						GLfloat* v, mugRoundRect* roundrect,
+						// Dimension data
+						float hdim[2], float vdim0, float vdim1,
+						// Rotation data
+						float srot, float crot
+					) {
+						// vec3 pos
+						// - x and y (rotated)
+						mugMath_rot_point_point(
+							roundrect->center.pos[0]+(hdim[0]*vdim0), // Point x
+							roundrect->center.pos[1]+(hdim[1]*vdim1), // Point y
+							roundrect->center.pos[0], // Center x
+							roundrect->center.pos[1], // Center y
+							srot, crot, // Sin / Cos rotation
+							v
+						);
+						// - z
+						v[2] = roundrect->center.pos[2];
 
-						case MUCOSA_WIN32_FAILED_CONVERT_UTF8_TO_WCHAR: return "MUCOSA_WIN32_FAILED_CONVERT_UTF8_TO_WCHAR"; break;
-						case MUCOSA_WIN32_FAILED_REGISTER_WINDOW_CLASS: return "MUCOSA_WIN32_FAILED_REGISTER_WINDOW_CLASS"; break;
-						case MUCOSA_WIN32_FAILED_CREATE_WINDOW: return "MUCOSA_WIN32_FAILED_CREATE_WINDOW"; break;
-						case MUCOSA_WIN32_FAILED_GET_WINDOW_ATTRIB: return "MUCOSA_WIN32_FAILED_GET_WINDOW_ATTRIB"; break;
-						case MUCOSA_WIN32_FAILED_SET_WINDOW_ATTRIB: return "MUCOSA_WIN32_FAILED_SET_WINDOW_ATTRIB"; break;
-						case MUCOSA_WIN32_FAILED_REGISTER_DUMMY_WGL_WINDOW_CLASS: return "MUCOSA_WIN32_FAILED_REGISTER_DUMMY_WGL_WINDOW_CLASS"; break;
-						case MUCOSA_WIN32_FAILED_CREATE_DUMMY_WGL_WINDOW: return "MUCOSA_WIN32_FAILED_CREATE_DUMMY_WGL_WINDOW"; break;
-						case MUCOSA_WIN32_FAILED_GET_DUMMY_WGL_PIXEL_FORMAT: return "MUCOSA_WIN32_FAILED_GET_DUMMY_WGL_PIXEL_FORMAT"; break;
-						case MUCOSA_WIN32_FAILED_DESCRIBE_DUMMY_WGL_PIXEL_FORMAT: return "MUCOSA_WIN32_FAILED_DESCRIBE_DUMMY_WGL_PIXEL_FORMAT"; break;
-						case MUCOSA_WIN32_FAILED_SET_DUMMY_WGL_PIXEL_FORMAT: return "MUCOSA_WIN32_FAILED_SET_DUMMY_WGL_PIXEL_FORMAT"; break;
-						case MUCOSA_WIN32_FAILED_CREATE_DUMMY_WGL_CONTEXT: return "MUCOSA_WIN32_FAILED_CREATE_DUMMY_WGL_CONTEXT"; break;
-						case MUCOSA_WIN32_FAILED_BIND_DUMMY_WGL_CONTEXT: return "MUCOSA_WIN32_FAILED_BIND_DUMMY_WGL_CONTEXT"; break;
-						case MUCOSA_WIN32_FAILED_FIND_WGL_CREATE_CONTEXT_ATTRIBS: return "MUCOSA_WIN32_FAILED_FIND_WGL_CREATE_CONTEXT_ATTRIBS"; break;
-						case MUCOSA_WIN32_FAILED_FIND_WGL_CHOOSE_PIXEL_FORMAT: return "MUCOSA_WIN32_FAILED_FIND_WGL_CHOOSE_PIXEL_FORMAT"; break;
-						case MUCOSA_WIN32_FAILED_CHOOSE_WGL_PIXEL_FORMAT: return "MUCOSA_WIN32_FAILED_CHOOSE_WGL_PIXEL_FORMAT"; break;
-						case MUCOSA_WIN32_FAILED_GET_WGL_PIXEL_FORMAT: return "MUCOSA_WIN32_FAILED_GET_WGL_PIXEL_FORMAT"; break;
-						case MUCOSA_WIN32_FAILED_DESCRIBE_WGL_PIXEL_FORMAT: return "MUCOSA_WIN32_FAILED_DESCRIBE_WGL_PIXEL_FORMAT"; break;
-						case MUCOSA_WIN32_FAILED_SET_WGL_PIXEL_FORMAT: return "MUCOSA_WIN32_FAILED_SET_WGL_PIXEL_FORMAT"; break;
-						case MUCOSA_WIN32_FAILED_CREATE_WGL_CONTEXT: return "MUCOSA_WIN32_FAILED_CREATE_WGL_CONTEXT"; break;
-						case MUCOSA_WIN32_FAILED_SET_WGL_CONTEXT: return "MUCOSA_WIN32_FAILED_SET_WGL_CONTEXT"; break;
-						case MUCOSA_WIN32_FAILED_SWAP_WGL_BUFFERS: return "MUCOSA_WIN32_FAILED_SWAP_WGL_BUFFERS"; break;
-						case MUCOSA_WIN32_FAILED_FIND_WGL_FUNCTION: return "MUCOSA_WIN32_FAILED_FIND_WGL_FUNCTION"; break;
-						case MUCOSA_WIN32_FAILED_ASSOCIATE_IMM: return "MUCOSA_WIN32_FAILED_ASSOCIATE_IMM"; break;
-						case MUCOSA_WIN32_FAILED_SET_COMPOSITION_WINDOW_POSITION: return "MUCOSA_WIN32_FAILED_SET_COMPOSITION_WINDOW_POSITION"; break;
-						case MUCOSA_WIN32_FAILED_HOLD_CLIPBOARD: return "MUCOSA_WIN32_FAILED_HOLD_CLIPBOARD"; break;
-						case MUCOSA_WIN32_FAILED_GET_CLIPBOARD_DATA: return "MUCOSA_WIN32_FAILED_GET_CLIPBOARD_DATA"; break;
-						case MUCOSA_WIN32_FAILED_CONVERT_CLIPBOARD_DATA_FORMAT: return "MUCOSA_WIN32_FAILED_CONVERT_CLIPBOARD_DATA_FORMAT"; break;
-						case MUCOSA_WIN32_FAILED_ALLOCATE_CLIPBOARD_DATA: return "MUCOSA_WIN32_FAILED_ALLOCATE_CLIPBOARD_DATA"; break;
-						case MUCOSA_WIN32_FAILED_SET_CLIPBOARD_DATA: return "MUCOSA_WIN32_FAILED_SET_CLIPBOARD_DATA"; break;
+						// vec4 col
+						mu_memcpy(&v[3], roundrect->center.col, 16);
+						// float rot
+						v[7] = roundrect->rot;
+						// vec2 cen
+						mu_memcpy(&v[8], roundrect->center.pos, 8);
+						// vec2 dim
+						mu_memcpy(&v[10], hdim, 8);
+						// float rad
+						v[12] = roundrect->radius;
+
+						return v+13;
 					}
-				}
 
-				MUDEF const char* mu_window_system_get_name(muWindowSystem system) {
-					switch (system) {
-						default: return "MU_UNKNOWN"; break;
+					// Fills vertex data
+					void mugGL_roundrects_fill_vertexes(GLfloat* v, void* obj, uint32_m c) {
+						// Convert obj to struct array
+						mugRoundRect* roundrects = (mugRoundRect*)obj;
 
-						case MU_WINDOW_NULL: return "MU_WINDOW_NULL"; break;
-						case MU_WINDOW_WIN32: return "MU_WINDOW_WIN32"; break;
+						// Loop through each round rect
+						for (uint32_m i = 0; i < c; ++i) {
+							// Calculate rotation values
+							// Sin is negative because y-direction is flipped in mug coordinates
+							float srot = -mu_sinf(roundrects->rot);
+							float crot =  mu_cosf(roundrects->rot);
+							// Calculate half-dimensions
+							float hdim[2] = { roundrects->dim[0]/2.f, roundrects->dim[1]/2.f };
+
+							// Top-left
+							v = mugGL_roundrects_fill_invertexes(v, roundrects,   hdim, -1.f, -1.f, srot, crot);
+							// Bottom-left
+							v = mugGL_roundrects_fill_invertexes(v, roundrects,   hdim, -1.f,  1.f, srot, crot);
+							// Bottom-right
+							v = mugGL_roundrects_fill_invertexes(v, roundrects,   hdim,  1.f,  1.f, srot, crot);
+							// Top-right
+							v = mugGL_roundrects_fill_invertexes(v, roundrects++, hdim,  1.f, -1.f, srot, crot);
+						}
 					}
-				}
 
-				MUDEF const char* mu_window_system_get_nice_name(muWindowSystem system) {
-					switch (system) {
-						default: return "Unknown"; break;
+					// Fill index data (same as rect)
+					#define mugGL_roundrects_fill_indexes mugGL_rects_fill_indexes
 
-						case MU_WINDOW_NULL: return "Unknown/Auto"; break;
-						case MU_WINDOW_WIN32: return "Win32"; break;
+					// Describes round rect data
+					void mugGL_roundrects_desc(void) {
+						// vec3 pos
+						glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 52, 0);
+						glEnableVertexAttribArray(0);
+						// vec4 col
+						glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, 52, (void*)(12));
+						glEnableVertexAttribArray(1);
+						// float rot
+						glVertexAttribPointer(2, 1, GL_FLOAT, GL_FALSE, 52, (void*)(28));
+						glEnableVertexAttribArray(2);
+						// vec2 cen
+						glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, 52, (void*)(32));
+						glEnableVertexAttribArray(3);
+						// vec2 dim
+						glVertexAttribPointer(4, 2, GL_FLOAT, GL_FALSE, 52, (void*)(40));
+						glEnableVertexAttribArray(4);
+						// float rad
+						glVertexAttribPointer(5, 1, GL_FLOAT, GL_FALSE, 52, (void*)(48));
+						glEnableVertexAttribArray(5);
 					}
-				}
 
-				MUDEF const char* mu_window_attrib_get_name(muWindowAttrib attrib) {
-					switch (attrib) {
-						default: return "MU_UNKNOWN"; break;
-						case MU_WINDOW_TITLE: return "MU_WINDOW_TITLE"; break;
-						case MU_WINDOW_DIMENSIONS: return "MU_WINDOW_DIMENSIONS"; break;
-						case MU_WINDOW_POSITION: return "MU_WINDOW_POSITION"; break;
-						case MU_WINDOW_KEYBOARD_MAP: return "MU_WINDOW_KEYBOARD_MAP"; break;
-						case MU_WINDOW_KEYSTATE_MAP: return "MU_WINDOW_KEYSTATE_MAP"; break;
-						case MU_WINDOW_MOUSE_MAP: return "MU_WINDOW_MOUSE_MAP"; break;
-						case MU_WINDOW_SCROLL_LEVEL: return "MU_WINDOW_SCROLL_LEVEL"; break;
-						case MU_WINDOW_CURSOR: return "MU_WINDOW_CURSOR"; break;
-						case MU_WINDOW_CURSOR_STYLE: return "MU_WINDOW_CURSOR_STYLE"; break;
-						case MU_WINDOW_DIMENSIONS_CALLBACK: return "MU_WINDOW_DIMENSIONS_CALLBACK"; break;
-						case MU_WINDOW_POSITION_CALLBACK: return "MU_WINDOW_POSITION_CALLBACK"; break;
-						case MU_WINDOW_KEYBOARD_CALLBACK: return "MU_WINDOW_KEYBOARD_CALLBACK"; break;
-						case MU_WINDOW_KEYSTATE_CALLBACK: return "MU_WINDOW_KEYSTATE_CALLBACK"; break;
-						case MU_WINDOW_MOUSE_KEY_CALLBACK: return "MU_WINDOW_MOUSE_KEY_CALLBACK"; break;
-						case MU_WINDOW_CURSOR_CALLBACK: return "MU_WINDOW_CURSOR_CALLBACK"; break;
-						case MU_WINDOW_SCROLL_CALLBACK: return "MU_WINDOW_SCROLL_CALLBACK"; break;
+					// Renders round rects (same as rect)
+					#define mugGL_roundrects_render mugGL_rects_render
+					// Subrenders round rects (same as rect)
+					#define mugGL_roundrects_subrender mugGL_rects_subrender
+					// Multirenders round rects (same as rect)
+					#define mugGL_roundrects_multirender mugGL_rects_multirender
+
+					// Returns coverage of round rect at (x, y) (matches mugGL_roundrectFS)
+					float mugGL_roundrects_cover(GLfloat* v, float x, float y) {
+						// Check if within geometry
+						if (!mugMath_point_in_polygon(v, 4, 13, x, y)) {
+							return 0.f;
+						}
+						// r(p, c, sin(rot), cos(rot)), with y flipped like gl_FragCoord
+						float ox = x-v[8], oy = v[9]-y;
+						float cr = mu_sinf(v[7]), sr = mu_cosf(v[7]);
+						float jx = ox*cr - oy*sr, jy = ox*sr + oy*cr;
+						if (jx < 0.f) jx = -jx;
+						if (jy < 0.f) jy = -jy;
+						// Inside of rectangle's bounding box
+						float dx = v[10], dy = v[11], r = v[12];
+						if ((jx <= dx && jy <= dy-r) || (jy <= dy && jx < dx-r)) {
+							return 1.f;
+						}
+						// Inside of circle corner
+						float cx = jx-dx+r, cy = jy-dy+r;
+						return mugMath_clamp(-(mu_sqrtf(cx*cx + cy*cy) - r) + 0.5f, 0.f, 1.f);
 					}
-				}
 
-				MUDEF const char* mu_window_attrib_get_nice_name(muWindowAttrib attrib) {
-					switch (attrib) {
-						default: return "Unknown"; break;
-						case MU_WINDOW_TITLE: return "Title"; break;
-						case MU_WINDOW_DIMENSIONS: return "Dimensions"; break;
-						case MU_WINDOW_POSITION: return "Position"; break;
-						case MU_WINDOW_KEYBOARD_MAP: return "Keyboard map"; break;
-						case MU_WINDOW_KEYSTATE_MAP: return "Keystate map"; break;
-						case MU_WINDOW_MOUSE_MAP: return "Mouse map"; break;
-						case MU_WINDOW_SCROLL_LEVEL: return "Scroll level"; break;
-						case MU_WINDOW_CURSOR: return "Cursor"; break;
-						case MU_WINDOW_CURSOR_STYLE: return "Cursor style"; break;
-						case MU_WINDOW_DIMENSIONS_CALLBACK: return "Dimensions callback"; break;
-						case MU_WINDOW_POSITION_CALLBACK: return "Position callback"; break;
-						case MU_WINDOW_KEYBOARD_CALLBACK: return "Keyboard callback"; break;
-						case MU_WINDOW_KEYSTATE_CALLBACK: return "Keystate callback"; break;
-						case MU_WINDOW_MOUSE_KEY_CALLBACK: return "Mouse key callback"; break;
-						case MU_WINDOW_CURSOR_CALLBACK: return "Cursor callback"; break;
-						case MU_WINDOW_SCROLL_CALLBACK: return "Scroll callback"; break;
+					// Returns if round rect overlaps an area
+					muBool mugGL_roundrects_overlaps(GLfloat* v, float* area) {
+						return mugGL_smooth_overlaps(v, area, v[8], v[9], mugGL_roundrects_cover);
 					}
-				}
 
-				MUDEF const char* mu_keyboard_key_get_name(muKeyboardKey key) {
-					switch (key) {
-						default: return "MU_UNKNOWN"; break;
-						case MU_KEYBOARD_UNKNOWN: return "MU_KEYBOARD_UNKNOWN"; break;
-						case MU_KEYBOARD_BACKSPACE: return "MU_KEYBOARD_BACKSPACE"; break;
-						case MU_KEYBOARD_TAB: return "MU_KEYBOARD_TAB"; break;
-						case MU_KEYBOARD_CLEAR: return "MU_KEYBOARD_CLEAR"; break;
-						case MU_KEYBOARD_RETURN: return "MU_KEYBOARD_RETURN"; break;
-						case MU_KEYBOARD_PAUSE: return "MU_KEYBOARD_PAUSE"; break;
-						case MU_KEYBOARD_ESCAPE: return "MU_KEYBOARD_ESCAPE"; break;
-						case MU_KEYBOARD_MODECHANGE: return "MU_KEYBOARD_MODECHANGE"; break;
-						case MU_KEYBOARD_SPACE: return "MU_KEYBOARD_SPACE"; break;
-						case MU_KEYBOARD_PRIOR: return "MU_KEYBOARD_PRIOR"; break;
-						case MU_KEYBOARD_NEXT: return "MU_KEYBOARD_NEXT"; break;
-						case MU_KEYBOARD_END: return "MU_KEYBOARD_END"; break;
-						case MU_KEYBOARD_HOME: return "MU_KEYBOARD_HOME"; break;
-						case MU_KEYBOARD_LEFT: return "MU_KEYBOARD_LEFT"; break;
-						case MU_KEYBOARD_UP: return "MU_KEYBOARD_UP"; break;
-						case MU_KEYBOARD_RIGHT: return "MU_KEYBOARD_RIGHT"; break;
-						case MU_KEYBOARD_DOWN: return "MU_KEYBOARD_DOWN"; break;
-						case MU_KEYBOARD_SELECT: return "MU_KEYBOARD_SELECT"; break;
-						case MU_KEYBOARD_PRINT: return "MU_KEYBOARD_PRINT"; break;
-						case MU_KEYBOARD_EXECUTE: return "MU_KEYBOARD_EXECUTE"; break;
-						case MU_KEYBOARD_INSERT: return "MU_KEYBOARD_INSERT"; break;
-						case MU_KEYBOARD_DELETE: return "MU_KEYBOARD_DELETE"; break;
-						case MU_KEYBOARD_HELP: return "MU_KEYBOARD_HELP"; break;
-						case MU_KEYBOARD_0: return "MU_KEYBOARD_0"; break;
-						case MU_KEYBOARD_1: return "MU_KEYBOARD_1"; break;
-						case MU_KEYBOARD_2: return "MU_KEYBOARD_2"; break;
-						case MU_KEYBOARD_3: return "MU_KEYBOARD_3"; break;
-						case MU_KEYBOARD_4: return "MU_KEYBOARD_4"; break;
-						case MU_KEYBOARD_5: return "MU_KEYBOARD_5"; break;
-						case MU_KEYBOARD_6: return "MU_KEYBOARD_6"; break;
-						case MU_KEYBOARD_7: return "MU_KEYBOARD_7"; break;
-						case MU_KEYBOARD_8: return "MU_KEYBOARD_8"; break;
-						case MU_KEYBOARD_9: return "MU_KEYBOARD_9"; break;
-						case MU_KEYBOARD_A: return "MU_KEYBOARD_A"; break;
-						case MU_KEYBOARD_B: return "MU_KEYBOARD_B"; break;
-						case MU_KEYBOARD_C: return "MU_KEYBOARD_C"; break;
-						case MU_KEYBOARD_D: return "MU_KEYBOARD_D"; break;
-						case MU_KEYBOARD_E: return "MU_KEYBOARD_E"; break;
-						case MU_KEYBOARD_F: return "MU_KEYBOARD_F"; break;
-						case MU_KEYBOARD_G: return "MU_KEYBOARD_G"; break;
-						case MU_KEYBOARD_H: return "MU_KEYBOARD_H"; break;
-						case MU_KEYBOARD_I: return "MU_KEYBOARD_I"; break;
-						case MU_KEYBOARD_J: return "MU_KEYBOARD_J"; break;
-						case MU_KEYBOARD_K: return "MU_KEYBOARD_K"; break;
-						case MU_KEYBOARD_L: return "MU_KEYBOARD_L"; break;
-						case MU_KEYBOARD_M: return "MU_KEYBOARD_M"; break;
-						case MU_KEYBOARD_N: return "MU_KEYBOARD_N"; break;
-						case MU_KEYBOARD_O: return "MU_KEYBOARD_O"; break;
-						case MU_KEYBOARD_P: return "MU_KEYBOARD_P"; break;
-						case MU_KEYBOARD_Q: return "MU_KEYBOARD_Q"; break;
-						case MU_KEYBOARD_R: return "MU_KEYBOARD_R"; break;
-						case MU_KEYBOARD_S: return "MU_KEYBOARD_S"; break;
-						case MU_KEYBOARD_T: return "MU_KEYBOARD_T"; break;
-						case MU_KEYBOARD_U: return "MU_KEYBOARD_U"; break;
-						case MU_KEYBOARD_V: return "MU_KEYBOARD_V"; break;
-						case MU_KEYBOARD_W: return "MU_KEYBOARD_W"; break;
-						case MU_KEYBOARD_X: return "MU_KEYBOARD_X"; break;
-						case MU_KEYBOARD_Y: return "MU_KEYBOARD_Y"; break;
-						case MU_KEYBOARD_Z: return "MU_KEYBOARD_Z"; break;
-						case MU_KEYBOARD_LEFT_WINDOWS: return "MU_KEYBOARD_LEFT_WINDOWS"; break;
-						case MU_KEYBOARD_RIGHT_WINDOWS: return "MU_KEYBOARD_RIGHT_WINDOWS"; break;
-						case MU_KEYBOARD_NUMPAD_0: return "MU_KEYBOARD_NUMPAD_0"; break;
-						case MU_KEYBOARD_NUMPAD_1: return "MU_KEYBOARD_NUMPAD_1"; break;
-						case MU_KEYBOARD_NUMPAD_2: return "MU_KEYBOARD_NUMPAD_2"; break;
-						case MU_KEYBOARD_NUMPAD_3: return "MU_KEYBOARD_NUMPAD_3"; break;
-						case MU_KEYBOARD_NUMPAD_4: return "MU_KEYBOARD_NUMPAD_4"; break;
-						case MU_KEYBOARD_NUMPAD_5: return "MU_KEYBOARD_NUMPAD_5"; break;
-						case MU_KEYBOARD_NUMPAD_6: return "MU_KEYBOARD_NUMPAD_6"; break;
-						case MU_KEYBOARD_NUMPAD_7: return "MU_KEYBOARD_NUMPAD_7"; break;
-						case MU_KEYBOARD_NUMPAD_8: return "MU_KEYBOARD_NUMPAD_8"; break;
-						case MU_KEYBOARD_NUMPAD_9: return "MU_KEYBOARD_NUMPAD_9"; break;
-						case MU_KEYBOARD_ADD: return "MU_KEYBOARD_ADD"; break;
-						case MU_KEYBOARD_SUBTRACT: return "MU_KEYBOARD_SUBTRACT"; break;
-						case MU_KEYBOARD_MULTIPLY: return "MU_KEYBOARD_MULTIPLY"; break;
-						case MU_KEYBOARD_DIVIDE: return "MU_KEYBOARD_DIVIDE"; break;
-						case MU_KEYBOARD_SEPARATOR: return "MU_KEYBOARD_SEPARATOR"; break;
-						case MU_KEYBOARD_DECIMAL: return "MU_KEYBOARD_DECIMAL"; break;
-						case MU_KEYBOARD_F1: return "MU_KEYBOARD_F1"; break;
-						case MU_KEYBOARD_F2: return "MU_KEYBOARD_F2"; break;
-						case MU_KEYBOARD_F3: return "MU_KEYBOARD_F3"; break;
-						case MU_KEYBOARD_F4: return "MU_KEYBOARD_F4"; break;
-						case MU_KEYBOARD_F5: return "MU_KEYBOARD_F5"; break;
-						case MU_KEYBOARD_F6: return "MU_KEYBOARD_F6"; break;
-						case MU_KEYBOARD_F7: return "MU_KEYBOARD_F7"; break;
-						case MU_KEYBOARD_F8: return "MU_KEYBOARD_F8"; break;
-						case MU_KEYBOARD_F9: return "MU_KEYBOARD_F9"; break;
-						case MU_KEYBOARD_F10: return "MU_KEYBOARD_F10"; break;
-						case MU_KEYBOARD_F11: return "MU_KEYBOARD_F11"; break;
-						case MU_KEYBOARD_F12: return "MU_KEYBOARD_F12"; break;
-						case MU_KEYBOARD_F13: return "MU_KEYBOARD_F13"; break;
-						case MU_KEYBOARD_F14: return "MU_KEYBOARD_F14"; break;
-						case MU_KEYBOARD_F15: return "MU_KEYBOARD_F15"; break;
-						case MU_KEYBOARD_F16: return "MU_KEYBOARD_F16"; break;
-						case MU_KEYBOARD_F17: return "MU_KEYBOARD_F17"; break;
-						case MU_KEYBOARD_F18: return "MU_KEYBOARD_F18"; break;
-						case MU_KEYBOARD_F19: return "MU_KEYBOARD_F19"; break;
-						case MU_KEYBOARD_F20: return "MU_KEYBOARD_F20"; break;
-						case MU_KEYBOARD_F21: return "MU_KEYBOARD_F21"; break;
-						case MU_KEYBOARD_F22: return "MU_KEYBOARD_F22"; break;
-						case MU_KEYBOARD_F23: return "MU_KEYBOARD_F23"; break;
-						case MU_KEYBOARD_F24: return "MU_KEYBOARD_F24"; break;
-						case MU_KEYBOARD_NUMLOCK: return "MU_KEYBOARD_NUMLOCK"; break;
-						case MU_KEYBOARD_SCROLL: return "MU_KEYBOARD_SCROLL"; break;
-						case MU_KEYBOARD_LEFT_SHIFT: return "MU_KEYBOARD_LEFT_SHIFT"; break;
-						case MU_KEYBOARD_RIGHT_SHIFT: return "MU_KEYBOARD_RIGHT_SHIFT"; break;
-						case MU_KEYBOARD_LEFT_CONTROL: return "MU_KEYBOARD_LEFT_CONTROL"; break;
-						case MU_KEYBOARD_RIGHT_CONTROL: return "MU_KEYBOARD_RIGHT_CONTROL"; break;
-						case MU_KEYBOARD_LEFT_MENU: return "MU_KEYBOARD_LEFT_MENU"; break;
-						case MU_KEYBOARD_RIGHT_MENU: return "MU_KEYBOARD_RIGHT_MENU"; break;
-						case MU_KEYBOARD_ATTN: return "MU_KEYBOARD_ATTN"; break;
-						case MU_KEYBOARD_CRSEL: return "MU_KEYBOARD_CRSEL"; break;
-						case MU_KEYBOARD_EXSEL: return "MU_KEYBOARD_EXSEL"; break;
-						case MU_KEYBOARD_EREOF: return "MU_KEYBOARD_EREOF"; break;
-						case MU_KEYBOARD_PLAY: return "MU_KEYBOARD_PLAY"; break;
-						case MU_KEYBOARD_PA1: return "MU_KEYBOARD_PA1"; break;
+					// Fills buffer with needed info
+					void mugGL_roundrects_fill(mugGL_ObjBuffer* buf) {
+						buf->obj_type = MUG_OBJECT_ROUND_RECT;
+
+						// Amount of bytes used on vertex per object:
+						// one vertex = vec3+vec4+float+vec2+vec2+float (52)
+						// one round rect = four vertexes (208)
+						buf->bv_per_obj = 208;
+						// Amount of vertexes per object
+						buf->v_per_obj = 4;
+
+						// Amount of bytes used on index per object:
+						// one round rect = six indexes (24)
+						buf->bi_per_obj = 24;
+
+						// Function equivalents
+						buf->fill_vertexes = mugGL_roundrects_fill_vertexes;
+						buf->fill_indexes = mugGL_roundrects_fill_indexes;
+						buf->desc = mugGL_roundrects_desc;
+						buf->render = mugGL_roundrects_render;
+						buf->subrender = mugGL_roundrects_subrender;
+						buf->multirender = mugGL_roundrects_multirender;
+						buf->cover = mugGL_roundrects_cover;
+						buf->overlaps = mugGL_roundrects_overlaps;
+					}
+
+			/* 2D texture */
+
+				// Data format: { vec3 pos, vec4 col, vec2 tex }
+				// Indexed data: { 0, 1, 3, 1, 2, 3 }
+
+				/* Shaders */
+
+					// Vertex shader
+					const char* mugGL_2DtextureVS = 
+						// Version
+						"#version 330 core\n"
+
+						// Input { vec3 pos, vec4 col, vec2 tex }
+						"layout(location=0)in vec3 vPos;"
+						"layout(location=1)in vec4 vCol;"
+						"layout(location=2)in vec2 vTex;"
+
+						// Output { vec4 col, vec2 tex }
+						"out vec4 fCol;"
+						"out vec2 fTex;"
+
+						// Dimensions of graphic divided by 2
+						"uniform vec2 d;"
+						// Modifiers
+						"uniform vec3 aP;" // addPos
+						"uniform vec3 mP;" // mulPos
+
+						// Main
+						"void main(){"
+							// Set position
+							"gl_Position=vec4("
+								// X
+								"(((vPos.x*mP.x)+aP.x)-(d.x))/d.x,"
+								// Y
+								"-(((vPos.y*mP.y)+aP.y)-(d.y))/d.y,"
+								// Z
+								"(vPos.z*mP.z)+aP.z,"
+								// W
+								"1.0"
+							");"
+
+							// Transfer to fragment
+							"fCol=vCol;"
+							"fTex=vTex;"
+						"}"
+					;
+
+					// Fragment shader
+					const char* mugGL_2DtextureFS = 
+						// Version
+						"#version 330 core\n"
+
+						// Input { vec4 col, vec2 tex }
+						"in vec4 fCol;"
+						"in vec2 fTex;"
+						// Output { vec4 col }
+						"out vec4 oCol;"
+
+						// Sampler
+						"uniform sampler2D tex;"
+						// Modifiers
+						"uniform vec4 aC;" // addCol
+						"uniform vec4 mC;" // mulCol
+
+						// Main
+						"void main(){"
+							// Set color
+							"oCol=((fCol*texture(tex,fTex))*mC)+aC;"
+						"}"
+					;
+
+					// Creates program for 2D textures
+					void mugGL_2Dtextures_shader_load(mug_Graphic* gfx, mugGL_Shader* shader, mugResult* result) {
+						// Exit if shader already compiled
+						if (shader->program) {
+							return;
+						}
+
+						// Compile shader
+						mugResult res = mugGL_shader_create_vf(gfx, shader, mugGL_2DtextureVS, mugGL_2DtextureFS);
+						if (res != MUG_SUCCESS) {
+							MU_SET_RESULT(result, res)
+						}
 					}
-				}
 
-				MUDEF const char* mu_keyboard_key_get_nice_name(muKeyboardKey key) {
-					switch (key) {
-						default: return "Unknown"; break;
-						case MU_KEYBOARD_UNKNOWN: return "Unknown"; break;
-						case MU_KEYBOARD_BACKSPACE: return "Baskspace"; break;
-						case MU_KEYBOARD_TAB: return "Tab"; break;
-						case MU_KEYBOARD_CLEAR: return "Clear"; break;
-						case MU_KEYBOARD_RETURN: return "Return"; break;
-						case MU_KEYBOARD_PAUSE: return "Pause"; break;
-						case MU_KEYBOARD_ESCAPE: return "Escape"; break;
-						case MU_KEYBOARD_MODECHANGE: return "Mode change"; break;
-						case MU_KEYBOARD_SPACE: return "Space"; break;
-						case MU_KEYBOARD_PRIOR: return "Prior"; break;
-						case MU_KEYBOARD_NEXT: return "Next"; break;
-						case MU_KEYBOARD_END: return "End"; break;
-						case MU_KEYBOARD_HOME: return "Home"; break;
-						case MU_KEYBOARD_LEFT: return "Left"; break;
-						case MU_KEYBOARD_UP: return "Up"; break;
-						case MU_KEYBOARD_RIGHT: return "Right"; break;
-						case MU_KEYBOARD_DOWN: return "Down"; break;
-						case MU_KEYBOARD_SELECT: return "Select"; break;
-						case MU_KEYBOARD_PRINT: return "Print"; break;
-						case MU_KEYBOARD_EXECUTE: return "Execute"; break;
-						case MU_KEYBOARD_INSERT: return "Insert"; break;
-						case MU_KEYBOARD_DELETE: return "Delete"; break;
-						case MU_KEYBOARD_HELP: return "Help"; break;
-						case MU_KEYBOARD_0: return "0"; break;
-						case MU_KEYBOARD_1: return "1"; break;
-						case MU_KEYBOARD_2: return "2"; break;
-						case MU_KEYBOARD_3: return "3"; break;
-						case MU_KEYBOARD_4: return "4"; break;
-						case MU_KEYBOARD_5: return "5"; break;
-						case MU_KEYBOARD_6: return "6"; break;
-						case MU_KEYBOARD_7: return "7"; break;
-						case MU_KEYBOARD_8: return "8"; break;
-						case MU_KEYBOARD_9: return "9"; break;
-						case MU_KEYBOARD_A: return "A"; break;
-						case MU_KEYBOARD_B: return "B"; break;
-						case MU_KEYBOARD_C: return "C"; break;
-						case MU_KEYBOARD_D: return "D"; break;
-						case MU_KEYBOARD_E: return "E"; break;
-						case MU_KEYBOARD_F: return "F"; break;
-						case MU_KEYBOARD_G: return "G"; break;
-						case MU_KEYBOARD_H: return "H"; break;
-						case MU_KEYBOARD_I: return "I"; break;
-						case MU_KEYBOARD_J: return "J"; break;
-						case MU_KEYBOARD_K: return "K"; break;
-						case MU_KEYBOARD_L: return "L"; break;
-						case MU_KEYBOARD_M: return "M"; break;
-						case MU_KEYBOARD_N: return "N"; break;
-						case MU_KEYBOARD_O: return "O"; break;
-						case MU_KEYBOARD_P: return "P"; break;
-						case MU_KEYBOARD_Q: return "Q"; break;
-						case MU_KEYBOARD_R: return "R"; break;
-						case MU_KEYBOARD_S: return "S"; break;
-						case MU_KEYBOARD_T: return "T"; break;
-						case MU_KEYBOARD_U: return "U"; break;
-						case MU_KEYBOARD_V: return "V"; break;
-						case MU_KEYBOARD_W: return "W"; break;
-						case MU_KEYBOARD_X: return "X"; break;
-						case MU_KEYBOARD_Y: return "Y"; break;
-						case MU_KEYBOARD_Z: return "Z"; break;
-						case MU_KEYBOARD_LEFT_WINDOWS: return "Left Windows/Super/Command"; break;
-						case MU_KEYBOARD_RIGHT_WINDOWS: return "Right Windows/Super/Command"; break;
-						case MU_KEYBOARD_NUMPAD_0: return "Numpad 0"; break;
-						case MU_KEYBOARD_NUMPAD_1: return "Numpad 1"; break;
-						case MU_KEYBOARD_NUMPAD_2: return "Numpad 2"; break;
-						case MU_KEYBOARD_NUMPAD_3: return "Numpad 3"; break;
-						case MU_KEYBOARD_NUMPAD_4: return "Numpad 4"; break;
-						case MU_KEYBOARD_NUMPAD_5: return "Numpad 5"; break;
-						case MU_KEYBOARD_NUMPAD_6: return "Numpad 6"; break;
-						case MU_KEYBOARD_NUMPAD_7: return "Numpad 7"; break;
-						case MU_KEYBOARD_NUMPAD_8: return "Numpad 8"; break;
-						case MU_KEYBOARD_NUMPAD_9: return "Numpad 9"; break;
-						case MU_KEYBOARD_ADD: return "Add"; break;
-						case MU_KEYBOARD_SUBTRACT: return "Subtract"; break;
-						case MU_KEYBOARD_MULTIPLY: return "Multiply"; break;
-						case MU_KEYBOARD_DIVIDE: return "Divide"; break;
-						case MU_KEYBOARD_SEPARATOR: return "Separator"; break;
-						case MU_KEYBOARD_DECIMAL: return "Decimal"; break;
-						case MU_KEYBOARD_F1: return "F1"; break;
-						case MU_KEYBOARD_F2: return "F2"; break;
-						case MU_KEYBOARD_F3: return "F3"; break;
-						case MU_KEYBOARD_F4: return "F4"; break;
-						case MU_KEYBOARD_F5: return "F5"; break;
-						case MU_KEYBOARD_F6: return "F6"; break;
-						case MU_KEYBOARD_F7: return "F7"; break;
-						case MU_KEYBOARD_F8: return "F8"; break;
-						case MU_KEYBOARD_F9: return "F9"; break;
-						case MU_KEYBOARD_F10: return "F10"; break;
-						case MU_KEYBOARD_F11: return "F11"; break;
-						case MU_KEYBOARD_F12: return "F12"; break;
-						case MU_KEYBOARD_F13: return "F13"; break;
-						case MU_KEYBOARD_F14: return "F14"; break;
-						case MU_KEYBOARD_F15: return "F15"; break;
-						case MU_KEYBOARD_F16: return "F16"; break;
-						case MU_KEYBOARD_F17: return "F17"; break;
-						case MU_KEYBOARD_F18: return "F18"; break;
-						case MU_KEYBOARD_F19: return "F19"; break;
-						case MU_KEYBOARD_F20: return "F20"; break;
-						case MU_KEYBOARD_F21: return "F21"; break;
-						case MU_KEYBOARD_F22: return "F22"; break;
-						case MU_KEYBOARD_F23: return "F23"; break;
-						case MU_KEYBOARD_F24: return "F24"; break;
-						case MU_KEYBOARD_NUMLOCK: return "Num Lock"; break;
-						case MU_KEYBOARD_SCROLL: return "Scroll"; break;
-						case MU_KEYBOARD_LEFT_SHIFT: return "Left shift"; break;
-						case MU_KEYBOARD_RIGHT_SHIFT: return "Right shift"; break;
-						case MU_KEYBOARD_LEFT_CONTROL: return "Left control"; break;
-						case MU_KEYBOARD_RIGHT_CONTROL: return "Right control"; break;
-						case MU_KEYBOARD_LEFT_MENU: return "Left menu"; break;
-						case MU_KEYBOARD_RIGHT_MENU: return "Right menu"; break;
-						case MU_KEYBOARD_ATTN: return "Attn"; break;
-						case MU_KEYBOARD_CRSEL: return "CrSel"; break;
-						case MU_KEYBOARD_EXSEL: return "ExSel"; break;
-						case MU_KEYBOARD_EREOF: return "EreOf"; break;
-						case MU_KEYBOARD_PLAY: return "Play"; break;
-						case MU_KEYBOARD_PA1: return "PA1"; break;
+				/* Buffer */
+
+					// Fills a particular vertex given what to multiply dimensions by
+					// (Used to alternate between 4 corners)
+					// Returns new v pointer
+					static inline GLfloat* mugGL_2Dtextures_fill_invertexes(
+						// Rect data
+						GLfloat* v, mug2DTextureRect* rect,
+						// Half-dim and vector dim
+						float hdim[2], float vdim0, float vdim1,
+						// Center and half-dim of texture cutout
+						float ctex[2], float htdim[2],
+						// Sin/Cos rotation
+						float srot, float crot
+					) {
+						// vec3 pos
+						// - x and y
+						mugMath_rot_point_point(
+							rect->center.pos[0]+(hdim[0]*vdim0), // Point x
+							rect->center.pos[1]+(hdim[1]*vdim1), // Point y
+							rect->center.pos[0], // Center x
+							rect->center.pos[1], // Center y
+							srot, crot, // Sin/Cos rotation
+							v
+						);
+						// - z
+						v[2] = rect->center.pos[2];
+
+						// vec4 col
+						mu_memcpy(&v[3], rect->center.col, 16);
+						// vec2 tex
+						v[7] = ctex[0]+(htdim[0]*vdim0);
+						v[8] = ctex[1]+(htdim[1]*vdim1);
+						return v+9;
 					}
-				}
 
-				MUDEF const char* mu_keystate_get_name(muKeyboardState state) {
-					switch (state) {
-						default: return "MU_UNKNOWN"; break;
-						case MU_KEYSTATE_UNKNOWN: return "MU_KEYSTATE_UNKNOWN"; break;
-						case MU_KEYSTATE_CAPS_LOCK: return "MU_KEYSTATE_CAPS_LOCK"; break;
-						case MU_KEYSTATE_SCROLL_LOCK: return "MU_KEYSTATE_SCROLL_LOCK"; break;
-						case MU_KEYSTATE_NUM_LOCK: return "MU_KEYSTATE_NUM_LOCK"; break;
+					// Fills vertex data
+					void mugGL_2Dtextures_fill_vertexes(GLfloat* v, void* obj, uint32_m c) {
+						// Convert obj to struct array
+						mug2DTextureRect* rects = (mug2DTextureRect*)obj;
+
+						// Loop through each rect
+						for (uint32_m i = 0; i < c; ++i) {
+							// Store half-dim
+							float hdim[2] = { rects->dim[0]/2.f, rects->dim[1]/2.f };
+							// Store sin/cos of rotation
+							// Sin is negative because y-direction is flipped in mug coordinates
+							float srot = -mu_sinf(rects->rot);
+							float crot = mu_cosf(rects->rot);
+							// Half-texture dim
+							float htdim[2] = { rects->tex_dim[0]/2.f, rects->tex_dim[1]/2.f };
+							// Center of texture cutout
+							float ctex[2] = { rects->tex_pos[0]+htdim[0], rects->tex_pos[1]+htdim[1] };
+
+							// Top-left
+							v = mugGL_2Dtextures_fill_invertexes(v, rects,   hdim, -1.f, -1.f, ctex, htdim, srot, crot);
+							// Bottom-left
+							v = mugGL_2Dtextures_fill_invertexes(v, rects,   hdim, -1.f,  1.f, ctex, htdim, srot, crot);
+							// Bottom-right
+							v = mugGL_2Dtextures_fill_invertexes(v, rects,   hdim,  1.f,  1.f, ctex, htdim, srot, crot);
+							// Top-right
+							v = mugGL_2Dtextures_fill_invertexes(v, rects++, hdim,  1.f, -1.f, ctex, htdim, srot, crot);
+						}
 					}
-				}
 
-				MUDEF const char* mu_keystate_get_nice_name(muKeyboardState state) {
-					switch (state) {
-						default: return "Unknown"; break;
-						case MU_KEYSTATE_UNKNOWN: return "Unknown"; break;
-						case MU_KEYSTATE_CAPS_LOCK: return "Caps Lock"; break;
-						case MU_KEYSTATE_SCROLL_LOCK: return "Scroll Lock"; break;
-						case MU_KEYSTATE_NUM_LOCK: return "Num Lock"; break;
-					}
-				}
+					// Fills index data (same as rect)
+					#define mugGL_2Dtextures_fill_indexes mugGL_rects_fill_indexes
 
-				MUDEF const char* mu_mouse_key_get_name(muMouseKey key) {
-					switch (key) {
-						default: return "MU_UNKNOWN"; break;
-						case MU_MOUSE_UNKNOWN: return "MU_MOUSE_UNKNOWN"; break;
-						case MU_MOUSE_LEFT: return "MU_MOUSE_LEFT"; break;
-						case MU_MOUSE_RIGHT: return "MU_MOUSE_RIGHT"; break;
-						case MU_MOUSE_MIDDLE: return "MU_MOUSE_MIDDLE"; break;
+					// Describes data
+					void mugGL_2Dtextures_desc(void) {
+						// vec3 pos
+						glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 36, 0);
+						glEnableVertexAttribArray(0);
+						// vec4 col
+						glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, 36, (void*)(12));
+						glEnableVertexAttribArray(1);
+						// vec2 tex
+						glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 36, (void*)(28));
+						glEnableVertexAttribArray(2);
 					}
-				}
 
-				MUDEF const char* mu_mouse_key_get_nice_name(muMouseKey key) {
-					switch (key) {
-						default: return "Unknown"; break;
-						case MU_MOUSE_UNKNOWN: return "Unknown"; break;
-						case MU_MOUSE_LEFT: return "Left"; break;
-						case MU_MOUSE_RIGHT: return "Right"; break;
-						case MU_MOUSE_MIDDLE: return "Middle"; break;
-					}
-				}
+					// Renders data (same as rects)
+					#define mugGL_2Dtextures_render mugGL_rects_render
+					// Subrenders data (same as rects)
+					#define mugGL_2Dtextures_subrender mugGL_rects_subrender
+					// Multirenders data (same as rects)
+					#define mugGL_2Dtextures_multirender mugGL_rects_multirender
 
-				MUDEF const char* mu_cursor_style_get_name(muCursorStyle style) {
-					switch (style) {
-						default: return "MU_UNKNOWN"; break;
-						case MU_CURSOR_UNKNOWN: return "MU_CURSOR_UNKNOWN"; break;
-						case MU_CURSOR_ARROW: return "MU_CURSOR_ARROW"; break;
-						case MU_CURSOR_IBEAM: return "MU_CURSOR_IBEAM"; break;
-						case MU_CURSOR_WAIT: return "MU_CURSOR_WAIT"; break;
-						case MU_CURSOR_WAIT_ARROW: return "MU_CURSOR_WAIT_ARROW"; break;
-						case MU_CURSOR_CROSSHAIR: return "MU_CURSOR_CROSSHAIR"; break;
-						case MU_CURSOR_HAND: return "MU_CURSOR_HAND"; break;
-						case MU_CURSOR_SIZE_LR: return "MU_CURSOR_SIZE_LR"; break;
-						case MU_CURSOR_SIZE_TB: return "MU_CURSOR_SIZE_TB"; break;
-						case MU_CURSOR_SIZE_TL_BR: return "MU_CURSOR_SIZE_TL_BR"; break;
-						case MU_CURSOR_SIZE_TR_BL: return "MU_CURSOR_SIZE_TR_BL"; break;
-						case MU_CURSOR_SIZE_ALL: return "MU_CURSOR_SIZE_ALL"; break;
-						case MU_CURSOR_NO: return "MU_CURSOR_NO"; break;
+					// Returns coverage of texture rect at (x, y)
+					float mugGL_2Dtextures_cover(GLfloat* v, float x, float y) {
+						return (mugMath_point_in_polygon(v, 4, 9, x, y)) ? (1.f) : (0.f);
 					}
-				}
 
-				MUDEF const char* mu_cursor_style_get_nice_name(muCursorStyle style) {
-					switch (style) {
-						default: return "Unknown"; break;
-						case MU_CURSOR_UNKNOWN: return "Unknown"; break;
-						case MU_CURSOR_ARROW: return "Arrow"; break;
-						case MU_CURSOR_IBEAM: return "I-Beam"; break;
-						case MU_CURSOR_WAIT: return "Wait"; break;
-						case MU_CURSOR_WAIT_ARROW: return "Wait (Arrow)"; break;
-						case MU_CURSOR_CROSSHAIR: return "Crosshair"; break;
-						case MU_CURSOR_HAND: return "Hand"; break;
-						case MU_CURSOR_SIZE_LR: return "Resize (Left to right)"; break;
-						case MU_CURSOR_SIZE_TB: return "Resize (Top to bottom)"; break;
-						case MU_CURSOR_SIZE_TL_BR: return "Resize (Top-left to bottom-right)"; break;
-						case MU_CURSOR_SIZE_TR_BL: return "Resize (Top-right to bottom-left)"; break;
-						case MU_CURSOR_SIZE_ALL: return "Resize (All 4 directions)"; break;
-						case MU_CURSOR_NO: return "No/Error"; break;
+					// Returns if texture rect overlaps an area
+					muBool mugGL_2Dtextures_overlaps(GLfloat* v, float* area) {
+						return mugMath_polygon_overlaps_area(v, 4, 9, area);
 					}
-				}
 
-				MUDEF const char* mu_graphics_api_get_name(muGraphicsAPI api) {
-					switch (api) {
-						default: return "MU_UNKNOWN"; break;
-						case MU_NULL_GRAPHICS_API: return "MU_NULL_GRAPHICS_API"; break;
-						case MU_OPENGL_1_0: return "MU_OPENGL_1_0"; break;
-						case MU_OPENGL_1_1: return "MU_OPENGL_1_1"; break;
-						case MU_OPENGL_1_2: return "MU_OPENGL_1_2"; break;
-						case MU_OPENGL_1_2_1: return "MU_OPENGL_1_2_1"; break;
-						case MU_OPENGL_1_3: return "MU_OPENGL_1_3"; break;
-						case MU_OPENGL_1_4: return "MU_OPENGL_1_4"; break;
-						case MU_OPENGL_1_5: return "MU_OPENGL_1_5"; break;
-						case MU_OPENGL_2_0: return "MU_OPENGL_2_0"; break;
-						case MU_OPENGL_2_1: return "MU_OPENGL_2_1"; break;
-						case MU_OPENGL_3_0: return "MU_OPENGL_3_0"; break;
-						case MU_OPENGL_3_1: return "MU_OPENGL_3_1"; break;
-						case MU_OPENGL_3_2_CORE: return "MU_OPENGL_3_2_CORE"; break;
-						case MU_OPENGL_3_2_COMPATIBILITY: return "MU_OPENGL_3_2_COMPATIBILITY"; break;
-						case MU_OPENGL_3_3_CORE: return "MU_OPENGL_3_3_CORE"; break;
-						case MU_OPENGL_3_3_COMPATIBILITY: return "MU_OPENGL_3_3_COMPATIBILITY"; break;
-						case MU_OPENGL_4_0_CORE: return "MU_OPENGL_4_0_CORE"; break;
-						case MU_OPENGL_4_0_COMPATIBILITY: return "MU_OPENGL_4_0_COMPATIBILITY"; break;
-						case MU_OPENGL_4_1_CORE: return "MU_OPENGL_4_1_CORE"; break;
-						case MU_OPENGL_4_1_COMPATIBILITY: return "MU_OPENGL_4_1_COMPATIBILITY"; break;
-						case MU_OPENGL_4_2_CORE: return "MU_OPENGL_4_2_CORE"; break;
-						case MU_OPENGL_4_2_COMPATIBILITY: return "MU_OPENGL_4_2_COMPATIBILITY"; break;
-						case MU_OPENGL_4_3_CORE: return "MU_OPENGL_4_3_CORE"; break;
-						case MU_OPENGL_4_3_COMPATIBILITY: return "MU_OPENGL_4_3_COMPATIBILITY"; break;
-						case MU_OPENGL_4_4_CORE: return "MU_OPENGL_4_4_CORE"; break;
-						case MU_OPENGL_4_4_COMPATIBILITY: return "MU_OPENGL_4_4_COMPATIBILITY"; break;
-						case MU_OPENGL_4_5_CORE: return "MU_OPENGL_4_5_CORE"; break;
-						case MU_OPENGL_4_5_COMPATIBILITY: return "MU_OPENGL_4_5_COMPATIBILITY"; break;
-						case MU_OPENGL_4_6_CORE: return "MU_OPENGL_4_6_CORE"; break;
-						case MU_OPENGL_4_6_COMPATIBILITY: return "MU_OPENGL_4_6_COMPATIBILITY"; break;
-					}
-				}
+					// Fills buffer with needed info
+					void mugGL_2Dtextures_fill(mugGL_ObjBuffer* buf) {
+						buf->obj_type = MUG_OBJECT_TEXTURE_2D;
 
-				MUDEF const char* mu_graphics_api_get_nice_name(muGraphicsAPI api) {
-					switch (api) {
-						default: return "Unknown"; break;
-						case MU_NULL_GRAPHICS_API: return "Unknown"; break;
-						case MU_OPENGL_1_0: return "OpenGL 1.0"; break;
-						case MU_OPENGL_1_1: return "OpenGL 1.1"; break;
-						case MU_OPENGL_1_2: return "OpenGL 1.2"; break;
-						case MU_OPENGL_1_2_1: return "OpenGL 1.2.1"; break;
-						case MU_OPENGL_1_3: return "OpenGL 1.3"; break;
-						case MU_OPENGL_1_4: return "OpenGL 1.4"; break;
-						case MU_OPENGL_1_5: return "OpenGL 1.5"; break;
-						case MU_OPENGL_2_0: return "OpenGL 2.0"; break;
-						case MU_OPENGL_2_1: return "OpenGL 2.1"; break;
-						case MU_OPENGL_3_0: return "OpenGL 3.0"; break;
-						case MU_OPENGL_3_1: return "OpenGL 3.1"; break;
-						case MU_OPENGL_3_2_CORE: return "OpenGL 3.2 (Core Profile)"; break;
-						case MU_OPENGL_3_2_COMPATIBILITY: return "OpenGL 3.2 (Compatibility Profile)"; break;
-						case MU_OPENGL_3_3_CORE: return "OpenGL 3.3 (Core Profile)"; break;
-						case MU_OPENGL_3_3_COMPATIBILITY: return "OpenGL 3.3 (Compatibility Profile)"; break;
-						case MU_OPENGL_4_0_CORE: return "OpenGL 4.0 (Core Profile)"; break;
-						case MU_OPENGL_4_0_COMPATIBILITY: return "OpenGL 4.0 (Compatibility Profile)"; break;
-						case MU_OPENGL_4_1_CORE: return "OpenGL 4.1 (Core Profile)"; break;
-						case MU_OPENGL_4_1_COMPATIBILITY: return "OpenGL 4.1 (Compatibility Profile)"; break;
-						case MU_OPENGL_4_2_CORE: return "OpenGL 4.2 (Core Profile)"; break;
-						case MU_OPENGL_4_2_COMPATIBILITY: return "OpenGL 4.2 (Compatibility Profile)"; break;
-						case MU_OPENGL_4_3_CORE: return "OpenGL 4.3 (Core Profile)"; break;
-						case MU_OPENGL_4_3_COMPATIBILITY: return "OpenGL 4.3 (Compatibility Profile)"; break;
-						case MU_OPENGL_4_4_CORE: return "OpenGL 4.4 (Core Profile)"; break;
-						case MU_OPENGL_4_4_COMPATIBILITY: return "OpenGL 4.4 (Compatibility Profile)"; break;
-						case MU_OPENGL_4_5_CORE: return "OpenGL 4.5 (Core Profile)"; break;
-						case MU_OPENGL_4_5_COMPATIBILITY: return "OpenGL 4.5 (Compatibility Profile)"; break;
-						case MU_OPENGL_4_6_CORE: return "OpenGL 4.6 (Core Profile)"; break;
-						case MU_OPENGL_4_6_COMPATIBILITY: return "OpenGL 4.6 (Compatibility Profile)"; break;
+						// Amount of bytes used on vertex per object:
+						// one vertex = vec3+vec4+vec2 (36)
+						// one rect = four vertexes (144)
+						buf->bv_per_obj = 144;
+						// Amount of vertexes per object
+						buf->v_per_obj = 4;
+
+						// Amount of bytes used on index per object:
+						// one rect = six indexes (24)
+						buf->bi_per_obj = 24;
+
+						// Function equivalents
+						buf->fill_vertexes = mugGL_2Dtextures_fill_vertexes;
+						buf->fill_indexes = mugGL_2Dtextures_fill_indexes;
+						buf->desc = mugGL_2Dtextures_desc;
+						buf->render = mugGL_2Dtextures_render;
+						buf->subrender = mugGL_2Dtextures_subrender;
+						buf->multirender = mugGL_2Dtextures_multirender;
+						buf->cover = mugGL_2Dtextures_cover;
+						buf->overlaps = mugGL_2Dtextures_overlaps;
+					}
+
+			/* 2D texture array */
+
+				// Data format: { vec3 pos, vec4 col, vec3 tex }
+				// Indexed data: { 0, 1, 3, 1, 2, 3 }
+
+				/* Shaders */
+
+					// Vertex shader
+					const char* mugGL_2DtexturearrVS = 
+						// Version
+						"#version 330 core\n"
+
+						// Input { vec3 pos, vec4 col, vec3 tex }
+						"layout(location=0)in vec3 vPos;"
+						"layout(location=1)in vec4 vCol;"
+						"layout(location=2)in vec3 vTex;"
+
+						// Output {vec4 col, vec3 tex }
+						"out vec4 fCol;"
+						"out vec3 fTex;"
+
+						// Dimensions of graphic divided by 2
+						"uniform vec2 d;"
+						// Modifiers
+						"uniform vec3 aP;" // addPos
+						"uniform vec3 mP;" // mulPos
+
+						// Main
+						"void main(){"
+							// Set position
+							"gl_Position=vec4("
+								// X
+								"(((vPos.x*mP.x)+aP.x)-(d.x))/d.x,"
+								// Y
+								"-(((vPos.y*mP.y)+aP.y)-(d.y))/d.y,"
+								// Z
+								"(vPos.z*mP.z)+aP.z,"
+								// W
+								"1.0"
+							");"
+
+							// Transfer to fragment
+							"fCol=vCol;"
+							"fTex=vTex;"
+						"}"
+					;
+
+					// Fragment shader
+					const char* mugGL_2DtexturearrFS = 
+						// Version
+						"#version 330 core\n"
+
+						// Input { vec4 col, vec3 tex }
+						"in vec4 fCol;"
+						"in vec3 fTex;"
+						// Output { vec4 col }
+						"out vec4 oCol;"
+
+						// Sampler
+						"uniform sampler2DArray tex;"
+						// Modifiers
+						"uniform vec4 aC;" // addCol
+						"uniform vec4 mC;" // mulCol
+
+						// Main
+						"void main(){"
+							// Set color
+							"oCol=((fCol*texture(tex, fTex))*mC)+aC;"
+						"}"
+					;
+
+					// Creates program for 2D texture arrays
+					void mugGL_2Dtexturearr_shader_load(mug_Graphic* gfx, mugGL_Shader* shader, mugResult* result) {
+						// Exit if shader already compiled
+						if (shader->program) {
+							return;
+						}
+
+						// Compile shader
+						mugResult res = mugGL_shader_create_vf(gfx, shader, mugGL_2DtexturearrVS, mugGL_2DtexturearrFS);
+						if (res != MUG_SUCCESS) {
+							MU_SET_RESULT(result, res)
+						}
 					}
-				}
-			)
 
-			MU_CPP_EXTERN_END
+				/* Buffer */
 
-		#endif /* MUCOSA_IMPLEMENTATION */
-	#endif
+					// Fills a particular vertex given what to multiply dimensions by
+					// (Used to alternate between 4 corners)
+					// Returns new v pointer
+					// This code is considerably similar to mugGL_2Dtextures_fill_invertexes
+					static inline GLfloat* mugGL_2Dtexturearr_fill_invertexes(
+						// Rect data
+						GLfloat* v, mug2DTextureArrayRect* rect,
+						// Half-dim and vector dim
+						float hdim[2], float vdim0, float vdim1,
+						// Center and half-dim of texture cutout
+						float ctex[2], float htdim[2],
+						// Sin/Cos rotation
+						float srot, float crot
+					) {
+						// vec3 pos
+						// - x and y
+						mugMath_rot_point_point(
+							rect->center.pos[0]+(hdim[0]*vdim0), // Point x
+							rect->center.pos[1]+(hdim[1]*vdim1), // Point y
+							rect->center.pos[0], // Center x
+							rect->center.pos[1], // Center y
+							srot, crot, // Sin/Cos rotation
+							v
+						);
+						// - z
+						v[2] = rect->center.pos[2];
 
-	MU_CPP_EXTERN_START
+						// vec4 col
+						mu_memcpy(&v[3], rect->center.col, 16);
+						// vec3 tex
+						v[7] = ctex[0]+(htdim[0]*vdim0);
+						v[8] = ctex[1]+(htdim[1]*vdim1);
+						v[9] = rect->tex_pos[2];
+						return v+10;
+					}
 
-	/* mug context */
+					// Fills vertex data
+					void mugGL_2Dtexturearr_fill_vertexes(GLfloat* v, void* obj, uint32_m c) {
+						// Convert obj to struct array
+						mug2DTextureArrayRect* rects = (mug2DTextureArrayRect*)obj;
 
-		// Global context
-		mugContext* mug_global_context = 0;
+						// Loop through each rect
+						for (uint32_m i = 0; i < c; ++i) {
+							// Store half-dim
+							float hdim[2] = { rects->dim[0]/2.f, rects->dim[1]/2.f };
+							// Store sin/cos of rotation
+							// Sin is negative because y-direction is flipped in mug coordinates
+							float srot = -mu_sinf(rects->rot);
+							float crot =  mu_cosf(rects->rot);
+							// Half-texture dim
+							float htdim[2] = { rects->tex_dim[0]/2.f, rects->tex_dim[1]/2.f };
+							// Center of texture cutout
+							float ctex[2] = { rects->tex_pos[0]+htdim[0], rects->tex_pos[1]+htdim[1] };
 
-		// Create context
-		MUDEF void mug_context_create(mugContext* context, muWindowSystem system, muBool set_context) {
-			// Create muCOSA context
-			muCOSA_context_create(&context->cosa, system, set_context);
-			if (context->cosa.result != MUCOSA_SUCCESS) {
-				context->result = muCOSA_to_mug_result(context->cosa.result);
-				if (muCOSA_result_is_fatal(context->cosa.result)) {
-					return;
-				}
-			} else {
-				context->result = MUG_SUCCESS;
-			}
+							// Top-left
+							v = mugGL_2Dtexturearr_fill_invertexes(v, rects  , hdim, -1.f, -1.f, ctex, htdim, srot, crot);
+							// Bottom-left
+							v = mugGL_2Dtexturearr_fill_invertexes(v, rects  , hdim, -1.f,  1.f, ctex, htdim, srot, crot);
+							// Bottom-right
+							v = mugGL_2Dtexturearr_fill_invertexes(v, rects  , hdim,  1.f,  1.f, ctex, htdim, srot, crot);
+							// Top-right
+							v = mugGL_2Dtexturearr_fill_invertexes(v, rects++, hdim,  1.f, -1.f, ctex, htdim, srot, crot);
+						}
+					}
 
-			// Set context
-			if (set_context) {
-				mug_context_set(context);
-			}
-		}
+					// Fills index data (same as rect)
+					#define mugGL_2Dtexturearr_fill_indexes mugGL_rects_fill_indexes
 
-		// Destroy context
-		MUDEF void mug_context_destroy(mugContext* context) {
-			// Destroy muCOSA context
-			muCOSA_context_destroy(&context->cosa);
-		}
+					// Describes data
+					void mugGL_2Dtexturearr_desc(void) {
+						// vec3 pos
+						glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 40, 0);
+						glEnableVertexAttribArray(0);
+						// vec4 col
+						glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, 40, (void*)(12));
+						glEnableVertexAttribArray(1);
+						// vec3 tex
+						glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 40, (void*)(28));
+						glEnableVertexAttribArray(2);
+					}
 
-		// Set global context
-		MUDEF void mug_context_set(mugContext* context) {
-			mug_global_context = context;
-		}
+					// Renders data (same as rects)
+					#define mugGL_2Dtexturearr_render mugGL_rects_render
+					// Subrenders data (same as rects)
+					#define mugGL_2Dtexturearr_subrender mugGL_rects_subrender
+					// Multirenders data (same as rects)
+					#define mugGL_2Dtexturearr_multirender mugGL_rects_multirender
 
-	/* Inner graphic logic */
+					// Returns coverage of texture array rect at (x, y)
+					float mugGL_2Dtexturearr_cover(GLfloat* v, float x, float y) {
+						return (mugMath_point_in_polygon(v, 4, 10, x, y)) ? (1.f) : (0.f);
+					}
 
-		// This section handles all API-specific functionality
-		// so that rendering sections are coded in a completely
-		// API-less manner.
+					// Returns if texture array rect overlaps an area
+					muBool mugGL_2Dtexturearr_overlaps(GLfloat* v, float* area) {
+						return mugMath_polygon_overlaps_area(v, 4, 10, area);
+					}
 
-		// Union representing a graphic's parent
-		union mug_GraphicParent {
-			// muCOSA window
-			muWindow cosa_win;
-		};
-		typedef union mug_GraphicParent mug_GraphicParent;
+					// Fills buffer with needed info
+					void mugGL_2Dtexturearr_fill(mugGL_ObjBuffer* buf) {
+						buf->obj_type = MUG_OBJECT_TEXTURE_2D_ARRAY;
 
-		// Macro used to identify graphic parent type
-		typedef uint16_m mug_GraphicParentType;
-		#define MUG_GRAPHIC_PARENT_MUWIN 1 // (muWindow)
+						// Amount of bytes used on vertex per object:
+						// one vertex = vec3+vec4+vec3 (40)
+						// one rect = four vertexes (160)
+						buf->bv_per_obj = 160;
+						// Amount of vertexes per object
+						buf->v_per_obj = 4;
 
-		// Union representing a graphic's GL implementation
-		#ifdef MU_SUPPORT_OPENGL
-			union mug_GraphicGL {
-				// muCOSA OpenGL context
-				muGLContext cosa_gl;
-			};
-			typedef union mug_GraphicGL mug_GraphicGL;
-		#endif
+						// Amount of bytes used on index per object:
+						// one rect = six indexes (24)
+						buf->bi_per_obj = 24;
 
-		// Struct representing a graphic
-		struct mug_Graphic {
-			// The context used by the graphic
-			mugContext* context;
-			// Graphic system
-			muGraphicSystem system;
-			// Inner-API data
-			void* p;
-			// Parent type
-			mug_GraphicParentType parent_type;
-			// Parent
-			mug_GraphicParent parent;
+						// Function equivalents
+						buf->fill_vertexes = mugGL_2Dtexturearr_fill_vertexes;
+						buf->fill_indexes = mugGL_2Dtexturearr_fill_indexes;
+						buf->desc = mugGL_2Dtexturearr_desc;
+						buf->render = mugGL_2Dtexturearr_render;
+						buf->subrender = mugGL_2Dtexturearr_subrender;
+						buf->multirender = mugGL_2Dtexturearr_multirender;
+						buf->cover = mugGL_2Dtexturearr_cover;
+						buf->overlaps = mugGL_2Dtexturearr_overlaps;
+					}
 
-			// OpenGL context
-			#ifdef MU_SUPPORT_OPENGL
-				mug_GraphicGL gl;
-			#endif
+		/* Context setup */
 
-			// The time at which the last frame completed
-			double last_time;
+			// Struct for shaders
+			struct mugGL_Shaders {
+				mugGL_Shader point;
+				mugGL_Shader line;
+				mugGL_Shader triangle;
+				mugGL_Shader rect;
+				mugGL_Shader circle;
+				mugGL_Shader squircle;
+				mugGL_Shader roundrect;
+				mugGL_Shader textures2D;
+				mugGL_Shader texturearrays2D;
+			};
+			typedef struct mugGL_Shaders mugGL_Shaders;
 
-			// Latest dimensions retrieved
-			uint32_m dim[2];
-		};
-		typedef struct mug_Graphic mug_Graphic;
+			// Struct for a persistent framebuffer that frames are rendered to
+			// before being copied to the window, so that its contents outside
+			// of the area being redrawn are kept between frames
+			struct mugGL_Canvas {
+				// Framebuffer (0 if not created)
+				GLuint fbo;
+				// Color and depth renderbuffers
+				GLuint color;
+				GLuint depth;
+				// Sample count of the renderbuffers
+				GLsizei samples;
+				// Dimensions
+				uint32_m dim[2];
+			};
+			typedef struct mugGL_Canvas mugGL_Canvas;
 
-		// Create graphic via window
-		mugResult mugGraphic_window_create(mugContext* context, muWindowInfo* info, mug_Graphic* gfx, muGraphicSystem system) {
-			// Create window
-			muCOSAResult cosa_res = MUCOSA_SUCCESS;
-			gfx->parent_type = MUG_GRAPHIC_PARENT_MUWIN;
-			gfx->parent.cosa_win = muCOSA_window_create(&context->cosa, &cosa_res, info);
-			if (muCOSA_result_is_fatal(cosa_res)) {
-				return muCOSA_to_mug_result(cosa_res);
+			// Returns the size of a renderbuffer's storage, in bytes
+			// (estimated as 4 bytes per sample, as for GL_RGBA8 and GL_DEPTH_COMPONENT24)
+			size_m mugGL_renderbuffer_bytes(GLsizei samples, uint32_m* dim) {
+				return (size_m)dim[0] * dim[1] * 4 * ((samples > 1) ? (samples) : (1));
 			}
 
-			// Set generic parameters
-			gfx->context = context;
-			gfx->system = system;
-			gfx->last_time = muCOSA_time_get(&context->cosa);
-			gfx->dim[0] = info->width;
-			gfx->dim[1] = info->height;
-
-			return muCOSA_to_mug_result(cosa_res);
-		}
+			// Creates a renderbuffer (returns 0 on failure)
+			GLuint mugGL_renderbuffer_create(mug_Memory* mem, GLsizei samples, GLenum internal, uint32_m* dim) {
+				GLuint rb = 0;
+				glGenRenderbuffers(1, &rb);
+				if (rb) {
+					glBindRenderbuffer(GL_RENDERBUFFER, rb);
+					glRenderbufferStorageMultisample(GL_RENDERBUFFER, samples, internal, dim[0], dim[1]);
+					glBindRenderbuffer(GL_RENDERBUFFER, 0);
+					size_m bytes = mugGL_renderbuffer_bytes(samples, dim);
+					mug_memory_add(mem, &mem->report.renderbuffers, bytes, bytes);
+				}
+				return rb;
+			}
 
-		// Destroys graphic based on parent
-		// Note: does not free internally stored contents
-		void mugGraphic_destroy(mug_Graphic* gfx) {
-			// Find out parent type
-			switch (gfx->parent_type) {
-				// muWindow
-				case MUG_GRAPHIC_PARENT_MUWIN: {
-					muCOSA_window_destroy(&gfx->context->cosa, gfx->parent.cosa_win);
-				} break;
+			// Destroys a renderbuffer
+			void mugGL_renderbuffer_destroy(mug_Memory* mem, GLuint rb, GLsizei samples, uint32_m* dim) {
+				glDeleteRenderbuffers(1, &rb);
+				size_m bytes = mugGL_renderbuffer_bytes(samples, dim);
+				mug_memory_remove(mem, &mem->report.renderbuffers, bytes, bytes);
 			}
-		}
 
-		// Retrieves the dimensions of a graphic; stored in gfx->dim
-		void mugGraphic_dim(mug_Graphic* gfx) {
-			// Retrieve dimensions based on parent type
-			switch (gfx->parent_type) {
-				case MUG_GRAPHIC_PARENT_MUWIN: {
-					muCOSA_window_get(&gfx->context->cosa, 0, gfx->parent.cosa_win, MU_WINDOW_DIMENSIONS, gfx->dim);
-				} break;
+			// Destroys a canvas
+			void mugGL_canvas_destroy(mug_Memory* mem, mugGL_Canvas* canvas) {
+				if (canvas->fbo) {
+					glDeleteFramebuffers(1, &canvas->fbo);
+				}
+				if (canvas->color) {
+					mugGL_renderbuffer_destroy(mem, canvas->color, canvas->samples, canvas->dim);
+				}
+				if (canvas->depth) {
+					mugGL_renderbuffer_destroy(mem, canvas->depth, canvas->samples, canvas->dim);
+				}
+				mu_memset(canvas, 0, sizeof(mugGL_Canvas));
 			}
-		}
 
-		// Returns whether or not the graphic still exists
-		muBool mugGraphic_exists(mug_Graphic* gfx) {
-			// Find out parent type
-			switch (gfx->parent_type) {
-				default: return MU_FALSE; break;
+			// (Re)creates a canvas if it doesn't match the given dimensions
+			// Sets created to whether or not it was (re)created
+			// Leaves the window's framebuffer bound if (re)created
+			mugResult mugGL_canvas_match(mug_Memory* mem, mugGL_Canvas* canvas, uint32_m* dim, muBool* created) {
+				*created = MU_FALSE;
+				if (canvas->fbo && canvas->dim[0] == dim[0] && canvas->dim[1] == dim[1]) {
+					return MUG_SUCCESS;
+				}
+				glBindFramebuffer(GL_FRAMEBUFFER, 0);
+				mugGL_canvas_destroy(mem, canvas);
+				*created = MU_TRUE;
+
+				// Match the window's sample count, as blitting can't change it
+				GLint samples = 0;
+				glGetIntegerv(GL_SAMPLES, &samples);
+				canvas->samples = samples;
+				canvas->dim[0] = dim[0];
+				canvas->dim[1] = dim[1];
+
+				// Create renderbuffers
+				canvas->color = mugGL_renderbuffer_create(mem, samples, GL_RGBA8, dim);
+				canvas->depth = mugGL_renderbuffer_create(mem, samples, GL_DEPTH_COMPONENT24, dim);
+
+				// Create framebuffer
+				glGenFramebuffers(1, &canvas->fbo);
+				glBindFramebuffer(GL_FRAMEBUFFER, canvas->fbo);
+				glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, canvas->color);
+				glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, canvas->depth);
+				GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+				glBindFramebuffer(GL_FRAMEBUFFER, 0);
+				if (!canvas->fbo || status != GL_FRAMEBUFFER_COMPLETE) {
+					mugGL_canvas_destroy(mem, canvas);
+					return MUG_GL_FAILED_CREATE_FRAMEBUFFER;
+				}
 
-				// muWindow
-				case MUG_GRAPHIC_PARENT_MUWIN: {
-					return !muCOSA_window_get_closed(&gfx->context->cosa, 0, gfx->parent.cosa_win);
-				} break;
+				return MUG_SUCCESS;
 			}
-		}
 
-		// Updates the graphic's parent
-		mugResult mugGraphic_update(mug_Graphic* gfx) {
-			// Find out parent type
-			switch (gfx->parent_type) {
-				default: return 0; break;
+			// Struct for a target; a texture that can be rendered to
+			typedef struct mugGL_Target mugGL_Target;
+			struct mugGL_Target {
+				// Texture rendered to
+				mugGL_Texture* tex;
+				// Framebuffer
+				GLuint fbo;
+				// Depth renderbuffer (0 if the target has no depth)
+				GLuint depth;
+				// Dimensions
+				uint32_m dim[2];
+				// Next target in the pool of destroyed targets
+				mugGL_Target* next;
+			};
 
-				case MUG_GRAPHIC_PARENT_MUWIN: {
-					// Update window
-					mugResult res = MUG_SUCCESS;
-					muCOSA_window_update(&gfx->context->cosa, &res, gfx->parent.cosa_win);
-					return res;
-				} break;
+			// Destroys a target
+			void* mugGL_target_destroy(mugGL_Target* target) {
+				glDeleteFramebuffers(1, &target->fbo);
+				if (target->depth) {
+					mugGL_renderbuffer_destroy(target->tex->res->memory, target->depth, 0, target->dim);
+				}
+				mugGL_texture_destroy(target->tex);
+				mug_dealloc(target, MUG_ALLOC_GENERAL);
+				return 0;
 			}
-		}
-
-		// Handles OpenGL binding
-		#ifdef MU_SUPPORT_OPENGL
 
-			// Creates OpenGL context
-			mugResult mugGraphicGL_create(mug_Graphic* gfx) {
-				// Find out parent type
-				switch (gfx->parent_type) {
-					// ??
-					default: return 1; break;
+			// Creates a target
+			mugGL_Target* mugGL_target_create(mugResult* result, uint32_m formats, mugGL_Residency* res, uint32_m* dim, muBool depth) {
+				// Allocate the target container
+				mugGL_Target* target = (mugGL_Target*)mug_alloc(sizeof(mugGL_Target), MUG_ALLOC_GENERAL);
+				if (!target) {
+					MU_SET_RESULT(result, MUG_FAILED_MALLOC)
+					return 0;
+				}
+				mu_memset(target, 0, sizeof(mugGL_Target));
+				target->dim[0] = dim[0];
+				target->dim[1] = dim[1];
+
+				// Create texture
+				mugTextureInfo info = {
+					MUG_TEXTURE_2D, MUG_TEXTURE_U8_RGBA,
+					{ MUG_TEXTURE_CLAMP, MUG_TEXTURE_CLAMP },
+					{ MUG_TEXTURE_BILINEAR, MUG_TEXTURE_BILINEAR },
+					0, 0
+				};
+				uint32_m tex_dim[3] = { dim[0], dim[1], 1 };
+				mugResult res_ = MUG_SUCCESS;
+				target->tex = mugGL_texture_create(&res_, formats, res, &info, tex_dim, 0);
+				if (!target->tex) {
+					MU_SET_RESULT(result, res_)
+					mug_dealloc(target, MUG_ALLOC_GENERAL);
+					return 0;
+				}
+				target->tex->render_target = MU_TRUE;
 
-					// muWindow
-					case MUG_GRAPHIC_PARENT_MUWIN: {
-						// Create OpenGL context
-						muCOSAResult cosa_res = MUCOSA_SUCCESS;
-						gfx->gl.cosa_gl = muCOSA_gl_context_create(
-							&gfx->context->cosa, &cosa_res, gfx->parent.cosa_win, MU_OPENGL_3_3_CORE
-						);
+				// Create depth renderbuffer
+				if (depth) {
+					target->depth = mugGL_renderbuffer_create(res->memory, 0, GL_DEPTH_COMPONENT24, dim);
+				}
 
-						// Return result
-						return muCOSA_to_mug_result(cosa_res);
-					} break;
+				// Create framebuffer
+				glGenFramebuffers(1, &target->fbo);
+				GLenum status = 0;
+				if (target->fbo) {
+					glBindFramebuffer(GL_FRAMEBUFFER, target->fbo);
+					glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, target->tex->handle, 0);
+					if (target->depth) {
+						glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, target->depth);
+					}
+					status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+					glBindFramebuffer(GL_FRAMEBUFFER, 0);
 				}
+				if (status != GL_FRAMEBUFFER_COMPLETE || (depth && !target->depth)) {
+					MU_SET_RESULT(result, MUG_GL_FAILED_CREATE_FRAMEBUFFER)
+					mugGL_target_destroy(target);
+					return 0;
+				}
+
+				return target;
 			}
 
-			// Destroys OpenGL context
-			void mugGraphicGL_destroy(mug_Graphic* gfx) {
-				// Find out parent type
-				switch (gfx->parent_type) {
-					// muWindow
-					case MUG_GRAPHIC_PARENT_MUWIN: {
-						muCOSA_gl_context_destroy(&gfx->context->cosa, gfx->parent.cosa_win, gfx->gl.cosa_gl);
-					} break;
+			// Amount of timer queries in the ring used for GPU zones
+			#define MUGGL_ZONE_QUERY_COUNT 128
+
+			// Struct for a ring of timer queries measuring GPU zones
+			struct mugGL_ZoneQueries {
+				// Queries (0 until first used)
+				GLuint queries[MUGGL_ZONE_QUERY_COUNT];
+				// Timestamp queries of when each query began, used for tracing
+				GLuint stamps[MUGGL_ZONE_QUERY_COUNT];
+				// Whether or not each query's timestamp was queried
+				muBool stamped[MUGGL_ZONE_QUERY_COUNT];
+				// Index of the zone that each query measures, and the frame it was made in
+				uint32_m zones[MUGGL_ZONE_QUERY_COUNT];
+				uint64_m frames[MUGGL_ZONE_QUERY_COUNT];
+				// Index of the oldest query, and amount of queries in the ring
+				uint32_m first;
+				uint32_m count;
+			};
+			typedef struct mugGL_ZoneQueries mugGL_ZoneQueries;
+
+			// Struct for GL context
+			struct mugGL_Context {
+				// Shaders
+				mugGL_Shaders shaders;
+				// Streaming buffers used for immediate drawing (indexed by object type)
+				mugGL_ObjBuffer* streams[MUG_OBJECT_LAST+1];
+				// Amount of objects written to each streaming buffer this frame
+				uint32_m stream_cursors[MUG_OBJECT_LAST+1];
+				// Buffers used for staging texture updates
+				mugGL_UploadRing uploads;
+				// Bitmask of supported texture formats (1 << format)
+				uint32_m formats;
+				// Texture residency tracker
+				mugGL_Residency residency;
+				// Persistent framebuffer rendered to for partial redraw
+				mugGL_Canvas canvas;
+				// Ring of fences placed after each swap, oldest first
+				GLsync fences[MUG_MAX_FRAMES_IN_FLIGHT];
+				// Index of the oldest fence, and amount of fences in the ring
+				uint32_m fence_first;
+				uint32_m fence_count;
+				// Target being rendered to (0 if rendering to the graphic)
+				mugGL_Target* target;
+				// Dimensions being rendered to, and whether or not they're flipped
+				// on the y-axis (as they are for targets)
+				uint32_m view_dim[2];
+				muBool view_flip;
+				// Pool of destroyed targets kept for reuse, most recent first
+				mugGL_Target* target_pool;
+				uint32_m target_pool_count;
+				uint32_m target_pool_max;
+				// Timer queries of GPU zones
+				mugGL_ZoneQueries zone_queries;
+			};
+			typedef struct mugGL_Context mugGL_Context;
+
+			// Destroys pooled targets past the first max
+			void mugGL_target_pool_trim(mugGL_Context* ic, uint32_m max) {
+				mugGL_Target** link = &ic->target_pool;
+				for (uint32_m i = 0; *link && i < max; ++i) {
+					link = &(*link)->next;
+				}
+				while (*link) {
+					mugGL_Target* next = (*link)->next;
+					mugGL_target_destroy(*link);
+					*link = next;
+					--ic->target_pool_count;
 				}
 			}
 
-			// Binds OpenGL context
-			void mugGraphicGL_bind(mug_Graphic* gfx) {
-				// Find out parent type
-				switch (gfx->parent_type) {
-					// muWindow
-					case MUG_GRAPHIC_PARENT_MUWIN: {
-						muCOSA_gl_bind(&gfx->context->cosa, 0, gfx->parent.cosa_win, gfx->gl.cosa_gl);
-					} break;
+			// Gets a target, reusing a pooled one of the same size if available
+			mugGL_Target* mugGL_target_get(mugGL_Context* ic, mugResult* result, uint32_m* dim, muBool depth) {
+				for (mugGL_Target** link = &ic->target_pool; *link; link = &(*link)->next) {
+					mugGL_Target* target = *link;
+					if (target->dim[0] == dim[0] && target->dim[1] == dim[1] && (target->depth != 0) == (depth != 0)) {
+						*link = target->next;
+						target->next = 0;
+						--ic->target_pool_count;
+						return target;
+					}
 				}
+				return mugGL_target_create(result, ic->formats, &ic->residency, dim, depth);
 			}
 
-			// Swap buffers of OpenGL context
-			mugResult mugGraphicGL_swap_buffers(mug_Graphic* gfx) {
-				// Find out parent type
-				switch (gfx->parent_type) {
-					default: return 0; break;
+			// Returns a target to the pool, destroying the oldest if the pool is full
+			void* mugGL_target_release(mugGL_Context* ic, mugGL_Target* target) {
+				target->next = ic->target_pool;
+				ic->target_pool = target;
+				++ic->target_pool_count;
+				mugGL_target_pool_trim(ic, ic->target_pool_max);
+				return 0;
+			}
 
-					// muWindow
-					case MUG_GRAPHIC_PARENT_MUWIN: {
-						// Swap buffers
-						mugResult res = MUG_SUCCESS;
-						muCOSA_gl_swap_buffers(&gfx->context->cosa, &res, gfx->parent.cosa_win);
-						return res;
-					} break;
+			// Pointer to loading context
+			// This is a non-threadsafe solution that requires
+			// no more than one mug context to be created at
+			// one time within the program.
+			muCOSAContext* mugGL_load_func_context;
+
+			// Finds an OpenGL address
+			void* mugGL_load_func(const char* name) {
+				return muCOSA_gl_get_proc_address(mugGL_load_func_context, name);
+			}
+
+			// Returns whether or not an OpenGL extension is supported
+			muBool mugGL_has_extension(const char* name) {
+				GLint count = 0;
+				glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+				for (GLint i = 0; i < count; ++i) {
+					const char* ext = (const char*)glGetStringi(GL_EXTENSIONS, (GLuint)i);
+					if (!ext) {
+						continue;
+					}
+					// Compare names
+					size_m c = 0;
+					while (ext[c] && ext[c] == name[c]) {
+						++c;
+					}
+					if (ext[c] == name[c]) {
+						return MU_TRUE;
+					}
 				}
+				return MU_FALSE;
 			}
 
-		#endif /* MU_SUPPORT_OPENGL */
+			// Returns a bitmask of supported texture formats
+			uint32_m mugGL_texture_formats(void) {
+				// Uncompressed and RGTC formats are core
+				uint32_m formats = (1 << MUG_TEXTURE_U8_R) | (1 << MUG_TEXTURE_U8_RGB) | (1 << MUG_TEXTURE_U8_RGBA) | (1 << MUG_TEXTURE_BC4_R);
+				// S3TC
+				if (mugGL_has_extension("GL_EXT_texture_compression_s3tc")) {
+					formats |= (1 << MUG_TEXTURE_BC1_RGBA) | (1 << MUG_TEXTURE_BC3_RGBA);
+				}
+				// BPTC
+				if (mugGL_has_extension("GL_ARB_texture_compression_bptc")) {
+					formats |= (1 << MUG_TEXTURE_BC7_RGBA);
+				}
+				return formats;
+			}
 
-	/* Useful functions */
+			// Timeout of each wait on a fence, in nanoseconds
+			#define MUGGL_FENCE_TIMEOUT 100000000
 
-		/* Math */
+			// Retires fences, oldest first, until no more than max remain
+			// If wait is true, fences still pending are waited on, and the time
+			// spent waiting is added to the graphic's current frame
+			void mugGL_fences_wait(mug_Graphic* gfx, uint32_m max, muBool wait) {
+				mugGL_Context* ic = (mugGL_Context*)gfx->p;
+				double start = 0.0;
+
+				while (ic->fence_count > max) {
+					GLsync fence = ic->fences[ic->fence_first];
+					if (wait) {
+						// Poll first (flushing so that the fence is guaranteed to signal),
+						// and only time the wait if the fence is still pending
+						GLenum status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+						if (status == GL_TIMEOUT_EXPIRED && start == 0.0) {
+							start = muCOSA_fixed_time_get(&gfx->context->cosa);
+						}
+						while (status == GL_TIMEOUT_EXPIRED) {
+							status = glClientWaitSync(fence, 0, MUGGL_FENCE_TIMEOUT);
+						}
+					}
+					glDeleteSync(fence);
+					ic->fences[ic->fence_first] = 0;
+					ic->fence_first = (ic->fence_first + 1) % MUG_MAX_FRAMES_IN_FLIGHT;
+					--ic->fence_count;
+				}
 
-			// Rotates a given point (rpx, rpy) around a center (cpx, cpy)
-			// Uses srot and crot as sin and cos of rotation
-			// Fills in result in pos[0] (x) and pos[1] (y)
-			void mugMath_rot_point_point(
-				float rpx, float rpy, float cpx, float cpy,
-				float srot, float crot,
-				float* pos
-			) {
-				float ox = rpx-cpx, oy = rpy-cpy;
-				pos[0] = (ox*crot - oy*srot) + cpx;
-				pos[1] = (ox*srot + oy*crot) + cpy;
+				if (start != 0.0) {
+					gfx->pacer.gpu_wait += muCOSA_fixed_time_get(&gfx->context->cosa) - start;
+				}
 			}
 
-	/* OpenGL */
+			// Reads the results of finished zone queries, oldest first, without waiting on the GPU
+			void mugGL_zones_read(mug_Graphic* gfx) {
+				mugGL_ZoneQueries* q = &((mugGL_Context*)gfx->p)->zone_queries;
+				// (The newest query is still running if a zone is active)
+				uint32_m running = (gfx->zones.active) ? (1) : (0);
+
+				while (q->count > running) {
+					GLint available = 0;
+					glGetQueryObjectiv(q->queries[q->first], GL_QUERY_RESULT_AVAILABLE, &available);
+					if (available && q->stamped[q->first]) {
+						glGetQueryObjectiv(q->stamps[q->first], GL_QUERY_RESULT_AVAILABLE, &available);
+					}
+					if (!available) {
+						break;
+					}
+					GLuint64 ns = 0;
+					glGetQueryObjectui64v(q->queries[q->first], GL_QUERY_RESULT, &ns);
+					mug_gpu_zone_sample(&gfx->zones, q->zones[q->first], q->frames[q->first], (double)ns / 1000000000.0);
+					// Record zone on trace's GPU track
+					if (q->stamped[q->first]) {
+						GLuint64 stamp = 0;
+						glGetQueryObjectui64v(q->stamps[q->first], GL_QUERY_RESULT, &stamp);
+						mug_trace_gpu(&gfx->trace, gfx->zones.zones[q->zones[q->first]].info.name, stamp, ns);
+					}
+					q->first = (q->first + 1) % MUGGL_ZONE_QUERY_COUNT;
+					--q->count;
+				}
 
-	#ifdef MU_SUPPORT_OPENGL
+				// Frames older than the oldest query left have been fully read
+				mug_gpu_zones_commit(&gfx->zones, (q->count) ? (q->frames[q->first]) : (gfx->zones.frame));
+			}
 
-		/* Macros */
+			// Takes the current GPU timestamp along with the CPU time, aligning the trace's GPU track
+			void mugGL_trace_calibrate(mug_Graphic* gfx) {
+				GLint64 stamp = 0;
+				glGetInteger64v(GL_TIMESTAMP, &stamp);
+				gfx->trace.cpu_ref = muCOSA_fixed_time_get(&gfx->context->cosa);
+				gfx->trace.gpu_ref = (uint64_m)stamp;
+				gfx->trace.calibrated = stamp != 0;
+			}
 
-			// ...
+			// Begins measuring a zone; returns whether or not it was begun
+			muBool mugGL_zone_begin(mug_Graphic* gfx, const char* name) {
+				mugGL_ZoneQueries* q = &((mugGL_Context*)gfx->p)->zone_queries;
+				if (!gfx->zones.enabled || gfx->zones.active) {
+					return MU_FALSE;
+				}
 
-		/* General shader logic */
+				// Find zone
+				uint32_m zone = mug_gpu_zone_find(&gfx->zones, name);
+				if (zone == MUG_GPU_ZONE_COUNT) {
+					return MU_FALSE;
+				}
 
-			// Struct for a shader
-			struct mugGL_Shader {
-				// Shader program
-				GLuint program;
-			};
-			typedef struct mugGL_Shader mugGL_Shader;
+				// Generate queries if not done already
+				if (!q->queries[0]) {
+					glGenQueries(MUGGL_ZONE_QUERY_COUNT, q->queries);
+					glGenQueries(MUGGL_ZONE_QUERY_COUNT, q->stamps);
+					if (!q->queries[0] || !q->stamps[0]) {
+						return MU_FALSE;
+					}
+				}
+				// Make room in ring, skipping the zone rather than waiting if there's none
+				if (q->count == MUGGL_ZONE_QUERY_COUNT) {
+					mugGL_zones_read(gfx);
+					if (q->count == MUGGL_ZONE_QUERY_COUNT) {
+						return MU_FALSE;
+					}
+				}
 
-			// Creates a vertex/fragment shader
-			mugResult mugGL_shader_create_vf(mug_Graphic* gfx, mugGL_Shader* shader, const char* vsm, const char* fsm) {
-				GLint success;
+				// Begin query
+				uint32_m i = (q->first + q->count) % MUGGL_ZONE_QUERY_COUNT;
+				q->zones[i] = zone;
+				q->frames[i] = gfx->zones.frame;
+				q->stamped[i] = gfx->trace.enabled;
+				++q->count;
+				if (q->stamped[i]) {
+					glQueryCounter(q->stamps[i], GL_TIMESTAMP);
+				}
+				glBeginQuery(GL_TIME_ELAPSED, q->queries[i]);
+				gfx->zones.active = zone + 1;
+				return MU_TRUE;
+			}
 
-				// Compile vertex shader
-				GLuint vs = glCreateShader(GL_VERTEX_SHADER);
-				glShaderSource(vs, 1, &vsm, 0);
-				glCompileShader(vs);
-				// Make sure it succeeded
-				glGetShaderiv(vs, GL_COMPILE_STATUS, &success);
-				if (!success) {
-					return MUG_GL_FAILED_COMPILE_VERTEX_SHADER;
+			// Ends measuring the active zone, if any
+			void mugGL_zone_end(mug_Graphic* gfx) {
+				if (gfx->zones.active) {
+					glEndQuery(GL_TIME_ELAPSED);
+					gfx->zones.active = 0;
 				}
+			}
 
-				// Compile fragment shader
-				GLuint fs = glCreateShader(GL_FRAGMENT_SHADER);
-				glShaderSource(fs, 1, &fsm, 0);
-				glCompileShader(fs);
-				// Make sure it succeeded
-				glGetShaderiv(fs, GL_COMPILE_STATUS, &success);
-				if (!success) {
-					glDeleteShader(vs);
-					return MUG_GL_FAILED_COMPILE_FRAGMENT_SHADER;
+			// Loads a valid OpenGL context
+			mugResult mugGL_init_context(mug_Graphic* gfx) {
+				// Allocate inner GL context
+				gfx->p = mug_alloc(sizeof(mugGL_Context), MUG_ALLOC_GENERAL);
+				if (!gfx->p) {
+					return MUG_FAILED_MALLOC;
 				}
+				// - Casted handle
+				mugGL_Context* ic = (mugGL_Context*)gfx->p;
 
-				// Create and link shader program
-				shader->program = glCreateProgram();
-				glAttachShader(shader->program, vs);
-				glAttachShader(shader->program, fs);
-				glLinkProgram(shader->program);
-				// Make sure it succeeded
-				glGetProgramiv(shader->program, GL_LINK_STATUS, &success);
-				if (!success) {
-					glDeleteShader(fs);
-					glDeleteShader(vs);
-					return MUG_GL_FAILED_LINK_SHADERS;
+				// Create OpenGL context
+				mugResult res = mugGraphicGL_create(gfx);
+				if (mug_result_is_fatal(res)) {
+					mug_dealloc(gfx->p, MUG_ALLOC_GENERAL);
+					return res;
 				}
 
-				// Delete shaders
-				glDeleteShader(fs);
-				glDeleteShader(vs);
+				// Bind OpenGL context
+				mugGraphicGL_bind(gfx);
 
-				glUseProgram(shader->program);
-				// Set default add/mul pos/col uniform values
-				glUniform3f(glGetUniformLocation(shader->program, "aP"), 0.f, 0.f, 0.f);
-				glUniform3f(glGetUniformLocation(shader->program, "mP"), 1.f, 1.f, 1.f);
-				glUniform4f(glGetUniformLocation(shader->program, "aC"), 0.f, 0.f, 0.f, 0.f);
-				glUniform4f(glGetUniformLocation(shader->program, "mC"), 1.f, 1.f, 1.f, 1.f);
+				// Load OpenGL functions
+				mugGL_load_func_context = &gfx->context->cosa;
+				if (!gladLoadGL((GLADloadfunc)mugGL_load_func)) {
+					mug_dealloc(gfx->p, MUG_ALLOC_GENERAL);
+					mugGraphicGL_destroy(gfx);
+					return MUG_GL_FAILED_LOAD;
+				}
 
-				// Set dimensions uniform
-				glUniform2f(glGetUniformLocation(shader->program, "d"), ((float)gfx->dim[0])/2.f, ((float)gfx->dim[1])/2.f);
-				glUseProgram(0);
+				// Enable and set blending
+				glEnable(GL_BLEND);
+				glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+				// Enable depth testing
+				glEnable(GL_DEPTH_TEST);
+				glDepthFunc(GL_GEQUAL);
+				// Set initial viewport
+				glViewport(0, 0, gfx->dim[0], gfx->dim[1]);
+				// Pixel rows are tightly packed
+				glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+				glPixelStorei(GL_PACK_ALIGNMENT, 1);
 
-				return MUG_SUCCESS;
+				// Zero-out necessary struct memory
+				mu_memset(&ic->shaders, 0, sizeof(ic->shaders));
+				mu_memset(ic->streams, 0, sizeof(ic->streams));
+				mu_memset(ic->stream_cursors, 0, sizeof(ic->stream_cursors));
+				mu_memset(&ic->uploads, 0, sizeof(ic->uploads));
+				mu_memset(&ic->canvas, 0, sizeof(ic->canvas));
+				mu_memset(ic->fences, 0, sizeof(ic->fences));
+				ic->fence_first = 0;
+				ic->fence_count = 0;
+				ic->target = 0;
+				ic->view_dim[0] = gfx->dim[0];
+				ic->view_dim[1] = gfx->dim[1];
+				ic->view_flip = MU_FALSE;
+				ic->target_pool = 0;
+				ic->target_pool_count = 0;
+				ic->target_pool_max = MUG_TARGET_POOL_COUNT;
+				mu_memset(&ic->zone_queries, 0, sizeof(ic->zone_queries));
+
+				// Find supported texture formats
+				ic->formats = mugGL_texture_formats();
+				// Start tracking texture residency
+				mu_memset(&ic->residency, 0, sizeof(ic->residency));
+				ic->residency.memory = &gfx->memory;
+				ic->uploads.memory = &gfx->memory;
+
+				return res;
 			}
 
-			// Destroys a shader (safe to call if null)
-			void mugGL_shader_destroy(mugGL_Shader* shader) {
-				// If program exists:
-				if (shader->program) {
-					// Destroy program and set to 0
-					glDeleteProgram(shader->program);
-					shader->program = 0;
+			// Deloads a valid OpenGL context
+			void mugGL_term_context(mug_Graphic* gfx) {
+				// Destroy streaming buffers
+				mugGL_Context* ic = (mugGL_Context*)gfx->p;
+				mugGraphicGL_bind(gfx);
+				for (mugObjectType objtype = MUG_OBJECT_FIRST; objtype <= MUG_OBJECT_LAST; ++objtype) {
+					if (ic->streams[objtype]) {
+						mugGL_objects_destroy(ic->streams[objtype]);
+						mug_dealloc(ic->streams[objtype], MUG_ALLOC_OBJECT_BUFFER);
+					}
+				}
+				// Destroy upload ring
+				mugGL_upload_ring_destroy(&ic->uploads);
+				// Delete remaining fences
+				mugGL_fences_wait(gfx, 0, MU_FALSE);
+				// Destroy canvas
+				mugGL_canvas_destroy(&gfx->memory, &ic->canvas);
+				// Destroy pooled targets
+				mugGL_target_pool_trim(ic, 0);
+				// Delete zone queries
+				if (ic->zone_queries.queries[0]) {
+					glDeleteQueries(MUGGL_ZONE_QUERY_COUNT, ic->zone_queries.queries);
+				}
+				if (ic->zone_queries.stamps[0]) {
+					glDeleteQueries(MUGGL_ZONE_QUERY_COUNT, ic->zone_queries.stamps);
 				}
-			}
 
-			// Binds a shader
-			void mugGL_shader_bind(mugGL_Shader* shader) {
-				// Bind shader program
-				glUseProgram(shader->program);
+				// Free inner context
+				mug_dealloc(gfx->p, MUG_ALLOC_GENERAL);
+				// Destroy OpenGL context
+				mugGraphicGL_destroy(gfx);
 			}
 
-			// Unbinds a shader
-			void mugGL_shader_unbind(mugGL_Shader* shader) {
-				// Unbind shader program
-				glUseProgram(shader->program);
+			// Update function; gets called at end of swap buffers
+			void mugGL_update_context(mug_Graphic* gfx) {
+				mugGL_Context* ic = (mugGL_Context*)gfx->p;
+
+				// Fence this frame, then wait until starting the next one
+				// wouldn't put more frames in flight than allowed
+				if (gfx->frames_in_flight) {
+					GLsync fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+					if (fence) {
+						ic->fences[(ic->fence_first + ic->fence_count) % MUG_MAX_FRAMES_IN_FLIGHT] = fence;
+						++ic->fence_count;
+					}
+					mugGL_fences_wait(gfx, gfx->frames_in_flight-1, MU_TRUE);
+				} else {
+					mugGL_fences_wait(gfx, 0, MU_FALSE);
+				}
+
+				// Realign trace's GPU track (clocks may drift), then read finished zone queries
+				if (gfx->trace.enabled) {
+					mugGL_trace_calibrate(gfx);
+				}
+				mugGL_zones_read(gfx);
+
+				// Evict textures if over budget, then start a new frame
+				mugGL_residency_trim(&ic->residency);
+				++ic->residency.frame;
+
+				// Restart each used streaming buffer
+				for (mugObjectType objtype = MUG_OBJECT_FIRST; objtype <= MUG_OBJECT_LAST; ++objtype) {
+					if (ic->stream_cursors[objtype]) {
+						// Orphan vertex storage so that next frame's writes
+						// don't wait on the GPU reading this frame's
+						mugGL_ObjBuffer* buf = ic->streams[objtype];
+						glBindBuffer(GL_ARRAY_BUFFER, buf->vbo);
+						glBufferData(GL_ARRAY_BUFFER, buf->vbuf_size, 0, GL_DYNAMIC_DRAW);
+						glBindBuffer(GL_ARRAY_BUFFER, 0);
+						// (Track what this frame used of the buffer)
+						mugGL_objects_track(buf, (size_m)ic->stream_cursors[objtype] * (buf->bv_per_obj + ((buf->fill_indexes) ? (buf->bi_per_obj) : (0))));
+						ic->stream_cursors[objtype] = 0;
+					}
+				}
 			}
 
-		/* General texture logic */
+		/* Objects */
 
-			/* Conversions */
+			/* Shader logic */
 
-				// mugTextureType -> GLenum
-				GLenum mugGL_texture_type(mugTextureType type) {
+				// Converts object type to shader pointer
+				mugGL_Shader* mugGL_object_type_to_shader(mugGL_Context* context, mugObjectType type) {
 					switch (type) {
-						default: return GL_TEXTURE_2D; break;
-						case MUG_TEXTURE_2D: return GL_TEXTURE_2D; break;
-						case MUG_TEXTURE_2D_ARRAY: return GL_TEXTURE_2D_ARRAY; break;
+						default: return 0; break;
+						case MUG_OBJECT_POINT: return &context->shaders.point; break;
+						case MUG_OBJECT_LINE: return &context->shaders.line; break;
+						case MUG_OBJECT_TRIANGLE: return &context->shaders.triangle; break;
+						case MUG_OBJECT_RECT: return &context->shaders.rect; break;
+						case MUG_OBJECT_CIRCLE: return &context->shaders.circle; break;
+						case MUG_OBJECT_SQUIRCLE: return &context->shaders.squircle; break;
+						case MUG_OBJECT_ROUND_RECT: return &context->shaders.roundrect; break;
+						case MUG_OBJECT_TEXTURE_2D: return &context->shaders.textures2D; break;
+						case MUG_OBJECT_TEXTURE_2D_ARRAY: return &context->shaders.texturearrays2D; break;
 					}
 				}
 
-				// mugTextureWrapping -> GLint
-				GLint mugGL_texture_wrapping(mugTextureWrapping wrap) {
-					switch (wrap) {
-						default: return GL_REPEAT; break;
-						case MUG_TEXTURE_REPEAT: return GL_REPEAT; break;
-						case MUG_TEXTURE_MIRRORED_REPEAT: return GL_MIRRORED_REPEAT; break;
-						case MUG_TEXTURE_CLAMP: return GL_CLAMP_TO_EDGE; break;
+				// Converts object type to shader program pointer
+				GLuint* mugGL_object_type_to_program(mugGL_Context* context, mugObjectType type) {
+					// Convert object type to shader pointer
+					mugGL_Shader* shader = mugGL_object_type_to_shader(context, type);
+					// If NULL, shader doesn't exist
+					if (!shader) {
+						return 0;
 					}
+					// Return pointer to shader program if otherwise
+					return &shader->program;
 				}
 
-				// mugTextureFiltering -> GLint
-				GLint mugGL_texture_filtering(mugTextureFiltering fil) {
-					switch (fil) {
-						default: return GL_NEAREST; break;
-						case MUG_TEXTURE_NEAREST: return GL_NEAREST; break;
-						case MUG_TEXTURE_BILINEAR: return GL_LINEAR; break;
+				// Updates the dimensions rendered to for each active shader program
+				// (flipped on the y-axis if flip is true, used for targets)
+				void mugGL_update_view(mugGL_Context* context, uint32_m dim[2], muBool flip) {
+					context->view_dim[0] = dim[0];
+					context->view_dim[1] = dim[1];
+					context->view_flip = flip;
+
+					// Loop through each valid object type enum
+					for (mugObjectType objtype = MUG_OBJECT_FIRST; objtype <= MUG_OBJECT_LAST; ++objtype) {
+						// Find shader
+						mugGL_Shader* shader = mugGL_object_type_to_shader(context, objtype);
+						// If program exists, update its view
+						if (shader && shader->program) {
+							glUseProgram(shader->program);
+							mugGL_shader_view(shader, dim, flip);
+							glUseProgram(0);
+						}
 					}
 				}
 
-				// mugTextureFormat -> GLenum format
-				GLenum mugGL_texture_format_format(mugTextureFormat format) {
-					switch (format) {
-						default: return GL_RGB; break;
-						case MUG_TEXTURE_U8_R: return GL_RED; break;
-						case MUG_TEXTURE_U8_RGB: return GL_RGB; break;
-						case MUG_TEXTURE_U8_RGBA: return GL_RGBA; break;
+				// Loads a given object type
+				void mugGL_load_object_type(mug_Graphic* gfx, mugGL_Context* context, mugResult* result, mugObjectType type) {
+					// Call function based on object type
+					switch (type) {
+						default: MU_SET_RESULT(result, MUG_UNKNOWN_OBJECT_TYPE) break;
+						case MUG_OBJECT_POINT: mugGL_points_shader_load(gfx, &context->shaders.point, result); break;
+						case MUG_OBJECT_LINE: mugGL_lines_shader_load(gfx, &context->shaders.line, result); break;
+						case MUG_OBJECT_TRIANGLE: mugGL_triangles_shader_load(gfx, &context->shaders.triangle, result); break;
+						case MUG_OBJECT_RECT: mugGL_rects_shader_load(gfx, &context->shaders.rect, result); break;
+						case MUG_OBJECT_CIRCLE: mugGL_circles_shader_load(gfx, &context->shaders.circle, result); break;
+						case MUG_OBJECT_SQUIRCLE: mugGL_squircles_shader_load(gfx, &context->shaders.squircle, result); break;
+						case MUG_OBJECT_ROUND_RECT: mugGL_roundrects_shader_load(gfx, &context->shaders.roundrect, result); break;
+						case MUG_OBJECT_TEXTURE_2D: mugGL_2Dtextures_shader_load(gfx, &context->shaders.textures2D, result); break;
+						case MUG_OBJECT_TEXTURE_2D_ARRAY: mugGL_2Dtexturearr_shader_load(gfx, &context->shaders.texturearrays2D, result); break;
 					}
-				}
 
-				// mugTextureformat -> GLenum type
-				GLenum mugGL_texture_format_type(mugTextureFormat format) {
-					switch (format) {
-						default: return GL_UNSIGNED_BYTE; break;
-						// U8
-						case MUG_TEXTURE_U8_R: case MUG_TEXTURE_U8_RGB: case MUG_TEXTURE_U8_RGBA:
-							return GL_UNSIGNED_BYTE;
-						break;
+					// Shaders load for the graphic's dimensions, so correct them
+					// if a target is being rendered to
+					mugGL_Shader* shader = mugGL_object_type_to_shader(context, type);
+					if (context->target && shader && shader->program) {
+						glUseProgram(shader->program);
+						mugGL_shader_view(shader, context->view_dim, context->view_flip);
+						glUseProgram(0);
 					}
 				}
 
-			// Struct for a texture
-			struct mugGL_Texture {
-				// Handle to the texture from glGenTextures
-				GLuint handle;
-				// The format type (like GL_TEXTURE_2D for example)
-				GLenum target;
-			};
-			typedef struct mugGL_Texture mugGL_Texture;
-
-			// Creates a texture
-			// 2D: dim[2]
-			// 2D-array: dim[3]
-			mugGL_Texture* mugGL_texture_create(mugResult* result, mugTextureInfo* info, uint32_m* dim, muByte* data) {
-				// Allocate the texture container
-				mugGL_Texture* tex = (mugGL_Texture*)mu_malloc(sizeof(mugGL_Texture));
-				if (!tex) {
-					MU_SET_RESULT(result, MUG_FAILED_MALLOC)
-					return 0;
+				// Deloads a given object type
+				void mugGL_deload_object_type(mugGL_Context* context, mugObjectType type) {
+					// Convert object type to shader pointer
+					mugGL_Shader* shader = mugGL_object_type_to_shader(context, type);
+					// Destroy if exists
+					if (shader) {
+						mugGL_shader_destroy(shader);
+					}
 				}
 
-				// Generate texture
-				glGenTextures(1, &tex->handle);
-				if (!tex->handle) {
-					MU_SET_RESULT(result, MUG_GL_FAILED_GENERATE_TEXTURE)
-					mu_free(tex);
-					return 0;
-				}
+				// Sets an object type modifier
+				void mugGL_object_type_mod(mugGL_Context* context, mugResult* result, mugObjectType type, mugObjectMod mod, float* data) {
+					// Get shader handle
+					mugGL_Shader* shader = mugGL_object_type_to_shader(context, type);
+					if (!shader) {
+						MU_SET_RESULT(result, MUG_UNKNOWN_OBJECT_TYPE)
+						return;
+					}
 
-				// Get equivalent target
-				tex->target = mugGL_texture_type(info->type);
-				// Bind texture
-				glBindTexture(tex->target, tex->handle);
+					// Bind shader
+					mugGL_shader_bind(shader);
 
-				// Wrapping
-				glTexParameteri(tex->target, GL_TEXTURE_WRAP_S, mugGL_texture_wrapping(info->wrapping[0]));
-				glTexParameteri(tex->target, GL_TEXTURE_WRAP_T, mugGL_texture_wrapping(info->wrapping[1]));
-				// Filtering
-				glTexParameteri(tex->target, GL_TEXTURE_MAG_FILTER, mugGL_texture_filtering(info->filtering[0]));
-				glTexParameteri(tex->target, GL_TEXTURE_MIN_FILTER, mugGL_texture_filtering(info->filtering[1]));
+					// Identify attribute
+					switch (mod) {
+						default: MU_SET_RESULT(result, MUG_UNKNOWN_OBJECT_MOD) break;
+						// addPos/mulPos (applied relative to the current view)
+						case MUG_OBJECT_ADD_POS: {
+							mu_memcpy(shader->add_pos, data, sizeof(shader->add_pos));
+							mugGL_shader_view(shader, context->view_dim, context->view_flip);
+						} break;
+						case MUG_OBJECT_MUL_POS: {
+							mu_memcpy(shader->mul_pos, data, sizeof(shader->mul_pos));
+							mugGL_shader_view(shader, context->view_dim, context->view_flip);
+						} break;
+						case MUG_OBJECT_ADD_COL: glUniform4f(glGetUniformLocation(shader->program, "aC"), data[0], data[1], data[2], data[3]); break;
+						case MUG_OBJECT_MUL_COL: glUniform4f(glGetUniformLocation(shader->program, "mC"), data[0], data[1], data[2], data[3]); break;
+					}
 
-				// Generate texture
-				switch (info->type) {
-					// 2D
-					case MUG_TEXTURE_2D: {
-						GLenum format = mugGL_texture_format_format(info->format);
-						glTexImage2D(
-							GL_TEXTURE_2D, 0,
-							format, dim[0], dim[1], 0, format,
-							mugGL_texture_format_type(info->format),
-							(const void*)data
-						);
-					} break;
-					// 2D array
-					case MUG_TEXTURE_2D_ARRAY: {
-						GLenum format = mugGL_texture_format_format(info->format);
-						glTexImage3D(
-							GL_TEXTURE_2D_ARRAY, 0,
-							format, dim[0], dim[1], dim[2], 0, format,
-							mugGL_texture_format_type(info->format),
-							(const void*)data
-						);
-					} break;
+					// Unbind shader
+					mugGL_shader_unbind(shader);
 				}
 
-				// Don't generate mipmap for now
-				// Wouldn't this cause issues with 2D texture arrays?
-				// glGenerateMipmap(tex->target);
+			/* Buffer logic */
 
-				return tex;
-			}
+				// Fills information about buffer based on the type
+				mugResult mugGL_fill_info_buffer(mugGL_ObjBuffer* buf, mugObjectType type) {
+					// Set texture handle to null
+					buf->tex = 0;
+					// No spatial index by default
+					buf->index = 0;
+					buf->vertexes = 0;
+					buf->damage = 0;
+					buf->bounds = 0;
+					buf->bounds_count = 0;
 
-			// Destroys a texture
-			void* mugGL_texture_destroy(mugGL_Texture* tex) {
-				// Destroy texture
-				glDeleteTextures(1, &tex->handle);
-				// Free container
-				mu_free(tex);
-				// Return null
-				return 0;
-			}
+					// Fill based on type
+					switch (type) {
+						default: return MUG_UNKNOWN_OBJECT_TYPE; break;
+						case MUG_OBJECT_POINT: mugGL_points_fill(buf); break;
+						case MUG_OBJECT_LINE: mugGL_lines_fill(buf); break;
+						case MUG_OBJECT_TRIANGLE: mugGL_triangles_fill(buf); break;
+						case MUG_OBJECT_RECT: mugGL_rects_fill(buf); break;
+						case MUG_OBJECT_CIRCLE: mugGL_circles_fill(buf); break;
+						case MUG_OBJECT_SQUIRCLE: mugGL_squircles_fill(buf); break;
+						case MUG_OBJECT_ROUND_RECT: mugGL_roundrects_fill(buf); break;
+						case MUG_OBJECT_TEXTURE_2D: mugGL_2Dtextures_fill(buf); break;
+						case MUG_OBJECT_TEXTURE_2D_ARRAY: mugGL_2Dtexturearr_fill(buf); break;
+					}
+					return MUG_SUCCESS;
+				}
 
-			// Binds a texture
-			void mugGL_texture_bind(mugGL_Texture* tex) {
-				glBindTexture(tex->target, tex->handle);
-			}
+				// Creates an object buffer
+				// damage is the damage tracking that changes to the buffer are reported to (0 for none)
+				mugGL_ObjBuffer* mugGL_object_buffer_create(mug_Graphic* gfx, mugGL_Context* context, mugResult* result, mugObjectType type, uint32_m obj_count, void* obj, mug_Damage* damage) {
+					// Load object type
+					mugResult res = MUG_SUCCESS;
+					mugGL_load_object_type(gfx, context, &res, type);
+					if (res != MUG_SUCCESS) {
+						MU_SET_RESULT(result, res)
+						if (mug_result_is_fatal(res)) {
+							return 0;
+						}
+					}
 
-		/* General buffer logic */
+					// Allocate struct
+					mugGL_ObjBuffer* buf = (mugGL_ObjBuffer*)mug_alloc(sizeof(mugGL_ObjBuffer), MUG_ALLOC_OBJECT_BUFFER);
+					if (!buf) {
+						MU_SET_RESULT(result, MUG_FAILED_MALLOC)
+						return 0;
+					}
 
-			// Struct for an object buffer
-			typedef struct mugGL_ObjBuffer mugGL_ObjBuffer;
-			struct mugGL_ObjBuffer {
-				// Vertex array object
-				GLuint vao;
-				// Vertex buffer object
-				GLuint vbo;
-				// Index buffer object
-				GLuint ebo;
+					// Fill info about buffer based on type
+					res = mugGL_fill_info_buffer(buf, type);
+					if (res != MUG_SUCCESS) {
+						MU_SET_RESULT(result, res)
+						if (mug_result_is_fatal(res)) {
+							mug_dealloc(buf, MUG_ALLOC_OBJECT_BUFFER);
+							return 0;
+						}
+					}
 
-				// Object type
-				mugObjectType obj_type;
-				// Amount of objects stored
-				uint32_m obj_count;
+					// Fill other calculatable info
+					buf->stats = &gfx->stats;
+					buf->trace = &gfx->trace;
+					buf->memory = &gfx->memory;
+					buf->memory_usage = &gfx->memory.report.objects[type];
+					buf->obj_count = obj_count;
+					buf->vbuf_size = obj_count*buf->bv_per_obj;
+					if (buf->fill_indexes) {
+						buf->ibuf_size = obj_count*buf->bi_per_obj;
+					}
 
-				// Amount of bytes used for each object on vertexes
-				uint32_m bv_per_obj;
-				// Corresponding vertex buffer size (obj_count*bv_per_obj)
-				uint32_m vbuf_size;
+					// Track damage, with no objects drawn before the buffer existed
+					// (An allocated bounds array with no bounds; see mugGL_objects_bounds_sync)
+					buf->damage = damage;
+					if (damage && damage->enabled) {
+						buf->bounds = (float*)mug_alloc(4*sizeof(float), MUG_ALLOC_VERTEXES);
+					}
 
-				// Amount of bytes used for each object on indexes
-				uint32_m bi_per_obj;
-				// Corresponding index buffer size (obj_count*bi_per_obj)
-				uint32_m ibuf_size;
-				// Stores if index data has been filled already to correct size
-				// Set this to false to make fill commands regenerate index data;
-				// used upon initialization of buffer and (possibly later imp.)
-				// resizing. Index data is not considered in subfilling.
-				muBool index_filled;
+					// Create buffers
+					res = mugGL_objects_create(buf, obj);
+					if (res != MUG_SUCCESS) {
+						MU_SET_RESULT(result, res)
+						if (mug_result_is_fatal(res)) {
+							if (buf->bounds) {
+								mug_dealloc(buf->bounds, MUG_ALLOC_VERTEXES);
+							}
+							mug_dealloc(buf, MUG_ALLOC_OBJECT_BUFFER);
+							return 0;
+						}
+					}
 
-				// Optional handle to a texture
-				mugGL_Texture* tex;
+					return buf;
+				}
 
-				// Function used to fill all vertex data
-				void (*fill_vertexes)(GLfloat* v, void* obj, uint32_m c);
-				// Function used to fill all index data
-				// If this function is null, ebo is not generated
-				void (*fill_indexes)(GLuint* i, uint32_m c);
-				// Function used to describe data
-				void (*desc)(void);
-				// Function that renders with all relevant objects already binded
-				void (*render)(mugGL_ObjBuffer*);
-				// Same but subrenders
-				void (*subrender)(uint32_m o, uint32_m c);
-			};
+				// Destroys an object buffer
+				mugGL_ObjBuffer* mugGL_object_buffer_destroy(mugGL_ObjBuffer* buf) {
+					// Destroy inner buffers
+					mugGL_objects_destroy(buf);
+					// Free malloc'd data
+					mug_dealloc(buf, MUG_ALLOC_OBJECT_BUFFER);
+					// Return null
+					return 0;
+				}
 
-			// Checks if a given buffer is the expected size
-			muBool mugGL_buffer_size_check(int buftype, uint32_m size) {
-				// Get size
-				GLint realsize = 0;
-				glGetBufferParameteriv(buftype, GL_BUFFER_SIZE, &realsize);
+				// Renders an object buffer
+				void mugGL_object_buffer_render(mugGL_Context* context, mugGL_ObjBuffer* buf) {
+					// Get shader handle
+					mugGL_Shader* shader = mugGL_object_type_to_shader(context, buf->obj_type);
+					if (!shader) {
+						return;
+					}
 
-				// Return if buffer size given is valid
-				return realsize == (GLint)(size);
-			}
+					// Bind shader
+					mugGL_shader_bind(shader);
+					MUG_STAT(buf->stats, program_binds, 1)
+					// Render buffer
+					mugGL_objects_render(buf);
+					// Unbind shader
+					mugGL_shader_unbind(shader);
+				}
 
-			// Fills a buffer; obj can be null to just size buffer
-			mugResult mugGL_objects_fill(mugGL_ObjBuffer* buf, void* obj) {
-				// Bind VAO
-				glBindVertexArray(buf->vao);
+				// Subrenders an object buffer
+				void mugGL_object_buffer_subrender(mugGL_Context* context, mugGL_ObjBuffer* buf, uint32_m offset, uint32_m count) {
+					// Get shader handle
+					mugGL_Shader* shader = mugGL_object_type_to_shader(context, buf->obj_type);
+					if (!shader) {
+						return;
+					}
 
-				// Vertexes
-				if (obj)
-				{
-					// Allocate vertexes
-					GLfloat* vertexes = (GLfloat*)mu_malloc(buf->vbuf_size);
-					if (!vertexes) {
-						glBindVertexArray(0);
-						return MUG_FAILED_MALLOC;
+					// Bind shader
+					mugGL_shader_bind(shader);
+					MUG_STAT(buf->stats, program_binds, 1)
+					// Subrender buffer
+					mugGL_objects_subrender(buf, offset, count);
+					// Unbind shader
+					mugGL_shader_unbind(shader);
+				}
+
+				// Renders the objects of an object buffer visible in an area
+				void mugGL_object_buffer_render_visible(mug_Graphic* gfx, mugGL_Context* context, mugResult* result, mugGL_ObjBuffer* buf, float* view) {
+					// Render everything if there's no spatial index
+					if (!buf->index) {
+						mugGL_object_buffer_render(context, buf);
+						return;
 					}
 
-					// Fill vertex data
-					buf->fill_vertexes(vertexes, obj, buf->obj_count);
+					// Find visible ranges
+					float area[4] = { view[0], view[1], view[0]+view[2], view[1]+view[3] };
+					uint32_m run_count = mugIndex_runs(buf->index, mugIndex_query(buf->index, area));
+					if (!run_count) {
+						return;
+					}
 
-					// Send data to GPU
-					glBindBuffer(GL_ARRAY_BUFFER, buf->vbo);
-					glBufferData(GL_ARRAY_BUFFER, buf->vbuf_size, vertexes, GL_DYNAMIC_DRAW);
+					// Get shader handle
+					mugGL_Shader* shader = mugGL_object_type_to_shader(context, buf->obj_type);
+					if (!shader) {
+						return;
+					}
 
-					// Free vertex data
-					mu_free(vertexes);
+					// Reload texture if evicted before taking scratch memory,
+					// so that nothing done while rendering can move the arena
+					if (buf->tex) {
+						mugGL_texture_make_resident(buf->tex);
+					}
 
-					// Ensure buffer is expected size
-					if (!mugGL_buffer_size_check(GL_ARRAY_BUFFER, buf->vbuf_size)) {
-						glBindBuffer(GL_ARRAY_BUFFER, 0);
-						glBindVertexArray(0);
-						return MUG_GL_FAILED_ALLOCATE_BUFFER;
+					// Allocate multirender scratch memory on arena
+					size_m p_offset = mug_arena_push(&gfx->arena, run_count*sizeof(const void*));
+					if (p_offset == MU_SIZE_MAX) {
+						MU_SET_RESULT(result, MUG_FAILED_MALLOC)
+						return;
 					}
-				}
-				// No vertexes
-				else {
-					glBindBuffer(GL_ARRAY_BUFFER, buf->vbo);
-					glBufferData(GL_ARRAY_BUFFER, buf->vbuf_size, 0, GL_DYNAMIC_DRAW);
+
+					// Bind shader
+					mugGL_shader_bind(shader);
+					MUG_STAT(buf->stats, program_binds, 1)
+					// Render visible ranges
+					mugGL_objects_multirender(buf, buf->index->run_offsets, buf->index->run_counts, (const void**)&gfx->arena.data[p_offset], run_count);
+					// Unbind shader
+					mugGL_shader_unbind(shader);
+
+					// Free scratch memory
+					mug_arena_pop(&gfx->arena, p_offset);
 				}
 
-				// Indexes
-				if (buf->fill_indexes && !buf->index_filled)
-				{
-					// Allocate indexes
-					GLuint* indexes = (GLuint*)mu_malloc(buf->ibuf_size);
-					if (!indexes) {
-						glBindBuffer(GL_ARRAY_BUFFER, 0);
-						glBindVertexArray(0);
-						return MUG_FAILED_MALLOC;
+				// Finds the objects of a buffer covering a point (point is true; area[0] and area[1])
+				// or overlapping an area (point is false); writes up to max indexes, topmost first
+				// Returns amount of objects found
+				uint32_m mugGL_object_buffer_pick(mug_Graphic* gfx, mugResult* result, mugGL_ObjBuffer* buf, float* area, muBool point, uint32_m* indexes, uint32_m max) {
+					// Spatial index is required
+					if (!buf->index) {
+						MU_SET_RESULT(result, MUG_NO_SPATIAL_INDEX)
+						return 0;
 					}
 
-					// Fill index data
-					buf->fill_indexes(indexes, buf->obj_count);
+					// Find objects with overlapping bounds
+					uint32_m count = mugIndex_query(buf->index, area);
+					if (!count) {
+						return 0;
+					}
 
-					// Send data to GPU
-					glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buf->ebo);
-					glBufferData(GL_ELEMENT_ARRAY_BUFFER, buf->ibuf_size, indexes, GL_STATIC_DRAW);
+					// Allocate sorting keys on arena
+					size_m key_offset = mug_arena_push(&gfx->arena, count*sizeof(uint64_m));
+					if (key_offset == MU_SIZE_MAX) {
+						MU_SET_RESULT(result, MUG_FAILED_MALLOC)
+						return 0;
+					}
+					uint64_m* keys = (uint64_m*)&gfx->arena.data[key_offset];
+
+					// Test each object's shape
+					uint32_m stride = buf->bv_per_obj / sizeof(GLfloat);
+					uint32_m hits = 0;
+					for (uint32_m i = 0; i < count; ++i) {
+						uint32_m obj = buf->index->results[i];
+						GLfloat* v = &buf->vertexes[obj*stride];
+						muBool hit = (point) ? (buf->cover(v, area[0], area[1]) >= 0.5f) : (buf->overlaps(v, area));
+						if (!hit) {
+							continue;
+						}
 
-					// Free index data
-					mu_free(indexes);
+						// Key sorts by depth, then by index (later objects are drawn on top)
+						uint32_m z;
+						mu_memcpy(&z, &v[2], 4);
+						z = (z & 0x80000000) ? (~z) : (z | 0x80000000);
+						keys[hits++] = (((uint64_m)z) << 32) | (uint64_m)obj;
+					}
 
-					// Ensure buffer is expected size
-					if (!mugGL_buffer_size_check(GL_ELEMENT_ARRAY_BUFFER, buf->ibuf_size)) {
-						glBindBuffer(GL_ARRAY_BUFFER, 0);
-						glBindVertexArray(0);
-						return MUG_GL_FAILED_ALLOCATE_BUFFER;
+					// Sort topmost first and write indexes
+					mu_qsort(keys, hits, sizeof(uint64_m), mug_compare_key_desc);
+					for (uint32_m i = 0; i < hits && i < max; ++i) {
+						indexes[i] = (uint32_m)(keys[i] & 0xFFFFFFFF);
 					}
 
-					// Set index as filled
-					buf->index_filled = MU_TRUE;
+					// Free keys
+					mug_arena_pop(&gfx->arena, key_offset);
+					return hits;
 				}
 
-				// Describe data
-				buf->desc();
-				// Unbind and return success
-				glBindBuffer(GL_ARRAY_BUFFER, 0);
-				// glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
-				glBindVertexArray(0);
-				return MUG_SUCCESS;
-			}
+			/* Immediate drawing */
 
-			// Fills a portion of a buffer; obj cannot be null
-			mugResult mugGL_objects_subfill(mugGL_ObjBuffer* buf, uint32_m obj_offset, uint32_m obj_count, void* obj) {
-				// Bind VAO
-				glBindVertexArray(buf->vao);
+				// Minimum amount of objects in a streaming buffer
+				#define MUGGL_STREAM_MIN_COUNT 256
 
-				// Vertex data
-				{
-					// Byte amount calcluations
-					uint32_m data_size = obj_count*buf->bv_per_obj;
-					uint32_m data_offset = obj_offset*buf->bv_per_obj;
+				// Renders a batch of immediately-drawn objects
+				// The objects are stored in the graphic's arena at obj_offset
+				void mugGL_draw_batch(mug_Graphic* gfx, mugGL_Context* context, mugResult* result, mugObjectType type, mugTexture tex, uint32_m count, size_m obj_offset) {
+					mugResult res = MUG_SUCCESS;
 
-					// Allocate vertexes
-					GLfloat* vertexes = (GLfloat*)mu_malloc(data_size);
-					if (!vertexes) {
-						glBindVertexArray(0);
-						return MUG_FAILED_MALLOC;
+					// Create streaming buffer if it doesn't exist yet
+					if (!context->streams[type]) {
+						uint32_m cap = (count > MUGGL_STREAM_MIN_COUNT) ? count : MUGGL_STREAM_MIN_COUNT;
+						context->streams[type] = mugGL_object_buffer_create(gfx, context, &res, type, cap, 0, 0);
+						if (res != MUG_SUCCESS) {
+							MU_SET_RESULT(result, res)
+							if (mug_result_is_fatal(res)) {
+								return;
+							}
+						}
+						context->stream_cursors[type] = 0;
+						// Count as immediate drawing memory rather than an object buffer
+						mugGL_objects_track_usage(context->streams[type], &gfx->memory.report.immediate);
+					}
+					// Ensure object type is loaded otherwise
+					else {
+						mugGL_load_object_type(gfx, context, &res, type);
+						if (res != MUG_SUCCESS) {
+							MU_SET_RESULT(result, res)
+							if (mug_result_is_fatal(res)) {
+								return;
+							}
+						}
+					}
+					mugGL_ObjBuffer* buf = context->streams[type];
+					uint32_m* cursor = &context->stream_cursors[type];
+
+					// Make room if the batch doesn't fit in what's left of the buffer
+					if (*cursor + count > buf->obj_count) {
+						// Grow buffer if the batch doesn't fit at all
+						if (count > buf->obj_count) {
+							uint32_m cap = buf->obj_count*2;
+							while (cap < count) {
+								cap *= 2;
+							}
+							res = mugGL_objects_resize(buf, cap, 0);
+							if (res != MUG_SUCCESS) {
+								MU_SET_RESULT(result, res)
+								if (mug_result_is_fatal(res)) {
+									return;
+								}
+							}
+						}
+						// Orphan vertex storage otherwise
+						else {
+							glBindBuffer(GL_ARRAY_BUFFER, buf->vbo);
+							glBufferData(GL_ARRAY_BUFFER, buf->vbuf_size, 0, GL_DYNAMIC_DRAW);
+							glBindBuffer(GL_ARRAY_BUFFER, 0);
+						}
+						*cursor = 0;
+					}
+
+					// Allocate vertexes on arena
+					size_m arena_cap = gfx->arena.cap;
+					size_m vertex_offset = mug_arena_push(&gfx->arena, count*buf->bv_per_obj);
+					if (vertex_offset == MU_SIZE_MAX) {
+						MU_SET_RESULT(result, MUG_FAILED_MALLOC)
+						return;
 					}
+					mug_stats_arena(&gfx->stats, &gfx->arena, arena_cap);
+					GLfloat* vertexes = (GLfloat*)&gfx->arena.data[vertex_offset];
 
 					// Fill vertex data
-					buf->fill_vertexes(vertexes, obj, obj_count);
+					MUG_STAT_TIME(&gfx->stats, fill_start)
+					MUG_TRACE_BEGIN(&gfx->trace, fill_trace)
+					buf->fill_vertexes(vertexes, &gfx->arena.data[obj_offset], count);
+					MUG_STAT_TIME_END(&gfx->stats, fill_time, fill_start)
+					MUG_TRACE_END(&gfx->trace, "fill vertexes", fill_trace)
 
 					// Send data to GPU
+					MUG_STAT_TIME(&gfx->stats, upload_start)
+					MUG_TRACE_BEGIN(&gfx->trace, upload_trace)
 					glBindBuffer(GL_ARRAY_BUFFER, buf->vbo);
-					glBufferSubData(GL_ARRAY_BUFFER, data_offset, data_size, vertexes);
+					glBufferSubData(GL_ARRAY_BUFFER, (*cursor)*buf->bv_per_obj, count*buf->bv_per_obj, vertexes);
+					glBindBuffer(GL_ARRAY_BUFFER, 0);
+					MUG_STAT_TIME_END(&gfx->stats, upload_time, upload_start)
+					MUG_TRACE_END(&gfx->trace, "upload", upload_trace)
+					MUG_STAT(&gfx->stats, upload_bytes, count*buf->bv_per_obj)
 
 					// Free vertex data
-					mu_free(vertexes);
+					mug_arena_pop(&gfx->arena, vertex_offset);
+
+					// Render batch
+					buf->tex = (mugGL_Texture*)tex;
+					mugGL_object_buffer_subrender(context, buf, *cursor, count);
+					*cursor += count;
 				}
 
-				// Describe data
-				buf->desc();
-				// Unbind and return success
-				glBindBuffer(GL_ARRAY_BUFFER, 0);
-				glBindVertexArray(0);
-				return MUG_SUCCESS;
-			}
+		/* Misc. */
 
-			// Destroys a given buffer
-			void mugGL_objects_destroy(mugGL_ObjBuffer* buf) {
-				// Destroy VAO, VBO, and (possibly) EBO
-				glDeleteVertexArrays(1, &buf->vao);
-				glDeleteBuffers(1, &buf->vbo);
-				if (buf->fill_indexes) {
-					glDeleteBuffers(1, &buf->ebo);
+			// Clears the screen
+			mugResult mugGL_clear(mug_Graphic* gfx, float r, float g, float b) {
+				mugGL_Context* ic = (mugGL_Context*)gfx->p;
+				mugResult res = MUG_SUCCESS;
+
+				// Clear only the target if one is being rendered to
+				if (ic->target) {
+					glClearColor(r, g, b, 1.f);
+					glClearDepth(0.0);
+					glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+					return res;
 				}
-			}
 
-			// Creates a given buffer
-			// All fields besides OpenGL objects should be set within buf by now
-			mugResult mugGL_objects_create(mugGL_ObjBuffer* buf, void* obj) {
-				// Generate VBO
-				glGenBuffers(1, &buf->vbo);
-				if (!buf->vbo) {
-					return MUG_GL_FAILED_CREATE_BUFFER;
+				// Update dimensions
+				{
+					// Retrieve dimensions
+					uint32_m dim[2] = { gfx->dim[0], gfx->dim[1] };
+					mugGraphic_dim(gfx);
+					// Viewport if they've changed
+					if (dim[0] != gfx->dim[0] || dim[1] != gfx->dim[1]) {
+						glViewport(0, 0, gfx->dim[0], gfx->dim[1]);
+
+						// + Update dimensions for shaders
+						mugGL_update_view(ic, gfx->dim, MU_FALSE);
+					}
 				}
-				// Generate EBO if necessary
-				if (buf->fill_indexes) {
-					glGenBuffers(1, &buf->ebo);
-					if (!buf->ebo) {
-						glDeleteBuffers(1, &buf->vbo);
-						return MUG_GL_FAILED_CREATE_BUFFER;
+
+				// Partial redraw; render to the canvas, only within the damaged area
+				if (gfx->damage.enabled) {
+					// Match canvas to dimensions, redrawing everything if recreated
+					muBool created;
+					res = mugGL_canvas_match(&gfx->memory, &ic->canvas, gfx->dim, &created);
+					if (res != MUG_SUCCESS) {
+						// (Fall back to redrawing everything)
+						gfx->damage.enabled = MU_FALSE;
+					}
+					else {
+						if (created) {
+							mug_damage_full(&gfx->damage);
+						}
+
+						// Scissor to damaged area
+						mug_damage_begin_frame(&gfx->damage);
+						int32_m rect[4];
+						mug_damage_frame_rect(&gfx->damage, gfx->dim, rect);
+						glBindFramebuffer(GL_FRAMEBUFFER, ic->canvas.fbo);
+						glEnable(GL_SCISSOR_TEST);
+						glScissor(rect[0], rect[1], rect[2], rect[3]);
 					}
-					// + Mark indexes to be filled
-					buf->index_filled = MU_FALSE;
 				}
-				// Generate VAO
-				glGenVertexArrays(1, &buf->vao);
-				if (!buf->vao) {
-					glDeleteBuffers(1, &buf->vbo);
-					glDeleteBuffers(1, &buf->ebo);
-					return MUG_GL_FAILED_CREATE_VERTEX_ARRAY;
+				// Full redraw; free canvas if it's no longer used
+				else if (ic->canvas.fbo) {
+					mugGL_canvas_destroy(&gfx->memory, &ic->canvas);
+					glBindFramebuffer(GL_FRAMEBUFFER, 0);
+					glDisable(GL_SCISSOR_TEST);
 				}
 
-				// Fill buffer
-				mugResult res = mugGL_objects_fill(buf, obj);
-				if (mug_result_is_fatal(res)) {
-					mugGL_objects_destroy(buf);
-					return res;
+				// Set clear color
+				glClearColor(r, g, b, 1.f);
+				// Set clear depth
+				glClearDepth(0.0);
+				// Clear screen color and depth
+				glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+				return res;
+			}
+
+			// Copies the canvas to the window if partially redrawing
+			void mugGL_present_canvas(mug_Graphic* gfx) {
+				mugGL_Context* ic = (mugGL_Context*)gfx->p;
+				if (!gfx->damage.enabled || !ic->canvas.fbo) {
+					return;
 				}
 
-				return MUG_SUCCESS;
+				glDisable(GL_SCISSOR_TEST);
+				glBindFramebuffer(GL_READ_FRAMEBUFFER, ic->canvas.fbo);
+				glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+				glBlitFramebuffer(
+					0, 0, ic->canvas.dim[0], ic->canvas.dim[1],
+					0, 0, ic->canvas.dim[0], ic->canvas.dim[1],
+					GL_COLOR_BUFFER_BIT, GL_NEAREST
+				);
+				glBindFramebuffer(GL_FRAMEBUFFER, 0);
 			}
 
-			// Resizes a given buffer
-			// Buffer's contents are unknown after this if data is NULL
-			mugResult mugGL_objects_resize(mugGL_ObjBuffer* buf, uint32_m obj_count, void* obj) {
-				// Set count + other related variables
-				uint32_m prev_count = buf->obj_count;
-				buf->obj_count = obj_count;
-				buf->vbuf_size = obj_count*buf->bv_per_obj;
-				buf->ibuf_size = obj_count*buf->bi_per_obj;
-				buf->index_filled = MU_FALSE;
+			// Starts rendering to a target
+			void mugGL_target_begin(mug_Graphic* gfx, mugGL_Target* target) {
+				mugGL_Context* ic = (mugGL_Context*)gfx->p;
+				ic->target = target;
+
+				// Render to the target's texture, upright in texture coordinates
+				glBindFramebuffer(GL_FRAMEBUFFER, target->fbo);
+				glDisable(GL_SCISSOR_TEST);
+				glViewport(0, 0, target->dim[0], target->dim[1]);
+				mugGL_update_view(ic, target->dim, MU_TRUE);
+				// Blend alpha additively, so that transparent parts of the target
+				// become as opaque as what's drawn over them
+				glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+
+				// Clear to transparent
+				glClearColor(0.f, 0.f, 0.f, 0.f);
+				glClearDepth(0.0);
+				glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+			}
 
-				// Perform a fill
-				mugResult res = mugGL_objects_fill(buf, obj);
-				// If fatally failed, set things back to what they were
-				if (mug_result_is_fatal(res)) {
-					buf->obj_count = prev_count;
-					buf->vbuf_size = prev_count*buf->bv_per_obj;
+			// Stops rendering to the current target, if any
+			// Returns whether or not a target was being rendered to
+			muBool mugGL_target_end(mug_Graphic* gfx) {
+				mugGL_Context* ic = (mugGL_Context*)gfx->p;
+				if (!ic->target) {
+					return MU_FALSE;
+				}
+				ic->target = 0;
+
+				// Render to the canvas (within the damaged area) if partially redrawing,
+				// and to the window otherwise
+				glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+				glViewport(0, 0, gfx->dim[0], gfx->dim[1]);
+				mugGL_update_view(ic, gfx->dim, MU_FALSE);
+				if (gfx->damage.enabled && ic->canvas.fbo) {
+					int32_m rect[4];
+					mug_damage_frame_rect(&gfx->damage, gfx->dim, rect);
+					glBindFramebuffer(GL_FRAMEBUFFER, ic->canvas.fbo);
+					glEnable(GL_SCISSOR_TEST);
+					glScissor(rect[0], rect[1], rect[2], rect[3]);
+				} else {
+					glBindFramebuffer(GL_FRAMEBUFFER, 0);
+				}
+				return MU_TRUE;
+			}
+
+			// Maximums
+			uint32_m mugGL_max(mug_Graphic* gfx, mugMax max) {
+				GLint gi = 0;
+
+				switch (max) {
+					default: return 0; break;
+
+					// Texture
+					case MUG_MAX_TEXTURE_WIDTH_HEIGHT: {
+						glGetIntegerv(GL_MAX_TEXTURE_SIZE, &gi);
+						return gi;
+					} break;
+					case MUG_MAX_TEXTURE_DEPTH: {
+						glGetIntegerv(GL_MAX_ARRAY_TEXTURE_LAYERS, &gi);
+						return gi;
+					} break;
+					case MUG_MAX_TEXTURE_FORMATS: {
+						return ((mugGL_Context*)gfx->p)->formats;
+					} break;
 				}
+			}
 
-				return res;
+	#endif /* MU_SUPPORT_OPENGL */
+
+	/* Immediate drawing logic */
+
+		// Renders the graphic's pending immediate batch, if any
+		void mugDraw_flush(mug_Graphic* gfx, mugResult* result) {
+			// Exit if no batch is pending
+			if (!gfx->batch_type) {
+				return;
 			}
 
-			// Renders the object buffer
-			void mugGL_objects_render(mugGL_ObjBuffer* buf) {
-				// Bind texture if needed
-				if (buf->tex) {
-					mugGL_texture_bind(buf->tex);
-				}
-				// Bind VAO
-				glBindVertexArray(buf->vao);
-				// Call render function
-				buf->render(buf);
-				// Unbind VAO
-				glBindVertexArray(0);
+			// Render batch based on graphic system
+			switch (gfx->system) {
+				default: break;
+
+				// OpenGL
+				#ifdef MU_SUPPORT_OPENGL
+					case MU_GRAPHIC_OPENGL: {
+						mugGraphicGL_bind(gfx);
+						mugGL_draw_batch(gfx, (mugGL_Context*)gfx->p, result, gfx->batch_type, gfx->batch_tex, gfx->batch_count, gfx->batch_offset);
+					} break;
+				#endif
 			}
 
-			// Subrenders the object buffer
-			void mugGL_objects_subrender(mugGL_ObjBuffer* buf, uint32_m obj_offset, uint32_m obj_count) {
-				// Bind texture if needed
-				if (buf->tex) {
-					mugGL_texture_bind(buf->tex);
-				}
-				// Bind VAO
-				glBindVertexArray(buf->vao);
-				// Call subrender function
-				buf->subrender(obj_offset, obj_count);
-				// Unbind VAO
-				glBindVertexArray(0);
+			// Free batch
+			mug_arena_pop(&gfx->arena, gfx->batch_offset);
+			gfx->batch_type = 0;
+			gfx->batch_tex = 0;
+			gfx->batch_count = 0;
+
+			// To avoid unused parameter warnings
+			return; if (result) {}
+		}
+
+		// Appends an object to the graphic's pending immediate batch
+		void mugDraw_object(mug_Graphic* gfx, mugResult* result, mugObjectType type, mugTexture tex, void* obj, size_m obj_size) {
+			// Render pending batch if it can't hold this object
+			if (gfx->batch_type != type || gfx->batch_tex != tex) {
+				mugDraw_flush(gfx, result);
+				gfx->batch_type = type;
+				gfx->batch_tex = tex;
+				gfx->batch_offset = gfx->arena.len;
 			}
 
-			// Sets the given object buffer's texture
-			void mugGL_objects_texture(mugGL_ObjBuffer* buf, mugGL_Texture* tex) {
-				buf->tex = tex;
+			// Allocate object on arena (packed, as the batch is read as an array)
+			size_m arena_cap = gfx->arena.cap;
+			size_m offset = mug_arena_push_packed(&gfx->arena, obj_size);
+			if (offset == MU_SIZE_MAX) {
+				MU_SET_RESULT(result, MUG_FAILED_MALLOC)
+				return;
 			}
+			mug_stats_arena(&gfx->stats, &gfx->arena, arena_cap);
 
-		/* Objects */
+			// Copy object
+			mu_memcpy(&gfx->arena.data[offset], obj, obj_size);
+			gfx->batch_count += 1;
+		}
 
-			/* Points */
+	/* Asynchronous upload logic */
 
-				// Data format: { vec3 pos, vec4 col }
-				// Rendered as GL_POINTS
+		// Allocates the storage of a decoded job's texture
+		mugResult mugLoad_allocate(mug_Graphic* gfx, mug_LoadJob* job) {
+			switch (gfx->system) {
+				default: break;
 
-				/* Shaders */
+				// OpenGL
+				#ifdef MU_SUPPORT_OPENGL
+					case MU_GRAPHIC_OPENGL: {
+						mugGraphicGL_bind(gfx);
+						return mugGL_texture_load_allocate((mugGL_Texture*)job->tex, &job->info, job->dim);
+					} break;
+				#endif
+			}
 
-					// Vertex shader
-					// * Lines, triangles, and rects also use this shader.
-					const char* mugGL_pointVS = 
-						// Version
-						"#version 330 core\n"
+			return MUG_SUCCESS; if (job) {}
+		}
 
-						// Input { vec3 pos, vec4 col }
-						"layout(location=0)in vec3 vPos;"
-						"layout(location=1)in vec4 vCol;"
+		// Transfers a slice of rows of a job's pixels to its texture
+		void mugLoad_transfer(mug_Graphic* gfx, mugResult* result, mug_LoadJob* job, uint32_m rows, size_m offset) {
+			switch (gfx->system) {
+				default: break;
 
-						// Output { vec4 col }
-						"out vec4 fCol;"
+				// OpenGL
+				#ifdef MU_SUPPORT_OPENGL
+					case MU_GRAPHIC_OPENGL: {
+						mugGraphicGL_bind(gfx);
+						mugGL_texture_subimage(result, &((mugGL_Context*)gfx->p)->uploads, (mugGL_Texture*)job->tex, 0, job->rows, 0, job->dim[0], rows, 0, &job->pixels[offset]);
+					} break;
+				#endif
+			}
 
-						// Dimensions of graphic divided by 2
-						"uniform vec2 d;"
-						// Modifiers
-						"uniform vec3 aP;" // addPos
-						"uniform vec3 mP;" // mulPos
+			return; if (result) {} if (job) {} if (rows) {} if (offset) {}
+		}
 
-						// Main
-						"void main(){"
-							// Set position
-							"gl_Position=vec4("
-								// X
-								"(((vPos.x*mP.x)+aP.x)-(d.x))/d.x,"
-								// Y
-								"-(((vPos.y*mP.y)+aP.y)-(d.y))/d.y,"
-								// Z
-								"((vPos.z*mP.z)+aP.z),"
-								// W
-								"1.0"
-							");"
-							// Transfer color to fragment
-							"fCol=vCol;"
-						"}"
-					;
+		// Marks a job's texture as done loading
+		void mugLoad_finish(mug_Graphic* gfx, mug_LoadJob* job) {
+			switch (gfx->system) {
+				default: break;
 
-					// Fragment shader
-					// * Lines, triangles, and rects also use this shader.
-					const char* mugGL_pointFS =
-						// Version
-						"#version 330 core\n"
+				// OpenGL
+				#ifdef MU_SUPPORT_OPENGL
+					case MU_GRAPHIC_OPENGL: {
+						mugGL_texture_load_finish((mugGL_Texture*)job->tex, job->result);
+					} break;
+				#endif
+			}
 
-						// Input { vec4 col }
-						"in vec4 fCol;"
-						// Output { vec4 col }
-						"out vec4 oCol;"
+			return; if (job) {}
+		}
 
-						// Modifiers
-						"uniform vec4 aC;" // addCol
-						"uniform vec4 mC;" // mulCol
+		// Transfers decoded images to their textures, up to MUG_LOAD_UPLOAD_BYTES per call,
+		// calling the callbacks of finished jobs
+		void mugLoad_pump(mug_Graphic* gfx) {
+			mug_Loader* loader = gfx->loader;
+			if (!loader) {
+				return;
+			}
 
-						// Main
-						"void main(){"
-							// Set color
-							"oCol=(fCol*mC)+aC;"
-						"}"
-					;
+			size_m budget = MUG_LOAD_UPLOAD_BYTES;
+			while (MU_TRUE) {
+				// Get next decoded job if none is being transferred
+				mug_LoadJob* job = loader->upload;
+				if (!job) {
+					if (!budget) {
+						return;
+					}
+					mug_mutex_lock(&loader->mutex);
+					job = mugLoad_pop(&loader->done_head, &loader->done_tail);
+					mug_mutex_unlock(&loader->mutex);
+					if (!job) {
+						return;
+					}
+					loader->upload = job;
 
-					// Creates program for points
-					// * Lines, triangles, & rects also use this function.
-					void mugGL_points_shader_load(mug_Graphic* gfx, mugGL_Shader* shader, mugResult* result) {
-						// Exit if shader already compiled
-						if (shader->program) {
-							return;
-						}
+					// Allocate texture storage
+					if (job->tex && job->result == MUG_SUCCESS) {
+						job->result = mugLoad_allocate(gfx, job);
+					}
+				}
 
-						// Compile shader
-						mugResult res = mugGL_shader_create_vf(gfx, shader, mugGL_pointVS, mugGL_pointFS);
-						if (res != MUG_SUCCESS) {
-							MU_SET_RESULT(result, res)
-						}
+				// Transfer next slice of rows (at least one row of blocks)
+				if (job->tex && job->result == MUG_SUCCESS && job->rows < job->dim[1]) {
+					if (!budget) {
+						return;
+					}
+					uint32_m bd = mug_texture_format_block(job->info.format);
+					size_m row_size = mug_texture_data_size(job->info.format, job->dim[0], bd);
+					size_m blocks = budget / row_size;
+					if (!blocks) {
+						blocks = 1;
 					}
+					size_m left = job->dim[1] - job->rows;
+					uint32_m rows = (uint32_m)((blocks*bd < left) ? (blocks*bd) : (left));
 
-				/* Buffer */
+					mugLoad_transfer(gfx, &job->result, job, rows, (size_m)(job->rows / bd) * row_size);
+					job->rows += rows;
 
-					// Fills vertex data
-					void mugGL_points_fill_vertexes(GLfloat* v, void* obj, uint32_m c) {
-						// Convert obj to struct array
-						mugPoint* points = (mugPoint*)obj;
+					size_m bytes = (size_m)((rows + bd-1) / bd) * row_size;
+					budget = (bytes < budget) ? (budget - bytes) : (0);
+					continue;
+				}
 
-						// Loop through each point
-						for (uint32_m i = 0; i < c; ++i) {
-							// vec3 pos
-							mu_memcpy(v, points->pos, 12);
-							v += 3;
-							// vec4 col
-							mu_memcpy(v, points++->col, 16);
-							v += 4;
-						}
+				// Finish job
+				loader->upload = 0;
+				if (job->tex) {
+					mugLoad_finish(gfx, job);
+					gfx->redraw = MU_TRUE;
+					mug_damage_full(&gfx->damage);
+					if (job->callback) {
+						job->callback(job->tex, job->result, job->user);
 					}
+				}
+				mugLoad_free_job(job);
+			}
+		}
 
-					// Describes point data
-					// * Lines, triangles, and rects also use this function.
-					void mugGL_points_desc(void) {
-						// vec3 pos
-						glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 28, 0);
-						glEnableVertexAttribArray(0);
-						// vec4 col
-						glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, 28, (void*)(12));
-						glEnableVertexAttribArray(1);
-					}
+	/* Outer graphic logic */
 
-					// Renders points
-					void mugGL_points_render(mugGL_ObjBuffer* buf) {
-						// Draw arrays
-						glDrawArrays(
-							GL_POINTS, // Render using points
-							0, // Starting index (just 0)
-							buf->obj_count // Index count (equal to amount of points)
-						);
-					}
+		// Destroy graphic
+		MUDEF muGraphic mug_graphic_destroy(mugContext* context, muGraphic gfx) {
+			// Get handle to inner graphics
+			mug_Graphic* ingfx = (mug_Graphic*)gfx;
 
-					// Subrenders points
-					void mugGL_points_subrender(uint32_m o, uint32_m c) {
-						// Draw arrays
-						glDrawArrays(
-							GL_POINTS, // Render using points
-							o, // Starting index (equal to amount of points)
-							c // Index count (equal to amount of points)
-						);
-					}
+			// Stop asynchronous loader
+			if (ingfx->loader) {
+				mugLoad_destroy(ingfx->loader);
+			}
 
-					// Fills buffer with needed information
-					void mugGL_points_fill(mugGL_ObjBuffer* buf) {
-						buf->obj_type = MUG_OBJECT_POINT;
+			// Destroy system
+			switch (ingfx->system) {
+				default: break;
 
-						// Amount of bytes used on vertex per object:
-						// one vertex = vec3+vec4 (28)
-						// one point = one vertex (28)
-						buf->bv_per_obj = 28;
+				// OpenGL
+				#ifdef MU_SUPPORT_OPENGL
+					case MU_GRAPHIC_OPENGL: mugGL_term_context(ingfx); break;
+				#endif
+			}
 
-						// Function equivalents
-						buf->fill_vertexes = mugGL_points_fill_vertexes;
-						buf->fill_indexes = 0;
-						buf->desc = mugGL_points_desc;
-						buf->render = mugGL_points_render;
-						buf->subrender = mugGL_points_subrender;
-					}
+			// Free frame arena
+			mug_arena_free(&ingfx->arena);
+			// Free trace
+			mug_trace_free(&ingfx->trace);
 
-			/* Lines */
+			// Destroy graphic
+			mugGraphic_destroy(ingfx);
 
-				// Data format: { vec3 pos, vec4 col }
-				// Rendered as GL_LINES
+			// Free graphic
+			mug_dealloc(ingfx, MUG_ALLOC_GENERAL);
 
-				/* Shaders */
+			// Return null
+			return 0;
 
-					// Vertex shader (same as points)
-					#define mugGL_lineVS mugGL_pointVS
+			// To avoid unused parameter warnings
+			if (context) {}
+		}
 
-					// Fragment shader (same as points)
-					#define mugGL_lineFS mugGL_pointFS
+		// Create graphic via window
+		MUDEF muGraphic mug_graphic_create_window(mugContext* context, mugResult* result, muGraphicSystem system, muWindowInfo* info) {
+			// Allocate handle to graphics
+			mug_Graphic* gfx = (mug_Graphic*)mug_alloc(sizeof(mug_Graphic), MUG_ALLOC_GENERAL);
+			if (!gfx) {
+				MU_SET_RESULT(result, MUG_FAILED_MALLOC);
+				return 0;
+			}
 
-					// Creates program for lines (same as points)
-					#define mugGL_lines_shader_load mugGL_points_shader_load
+			// Create window graphic
+			mugResult res = mugGraphic_window_create(context, info, gfx, system);
+			if (res != MUG_SUCCESS) {
+				MU_SET_RESULT(result, res)
+				if (mug_result_is_fatal(res)) {
+					mug_dealloc(gfx, MUG_ALLOC_GENERAL);
+					return 0;
+				}
+			}
 
-				/* Buffer */
+			// Create context based on given system value
+			switch (system) {
+				// Unknown system value
+				default: {
+					// Destroy graphic
+					mugGraphic_destroy(gfx);
+					// Free graphic
+					mug_dealloc(gfx, MUG_ALLOC_GENERAL);
+					// Return failure value
+					MU_SET_RESULT(result, MUG_UNKNOWN_GRAPHIC_SYSTEM)
+					return 0;
+				} break;
 
-					// Fills vertex data
-					void mugGL_lines_fill_vertexes(GLfloat* v, void* obj, uint32_m c) {
-						// Convert obj to struct array
-						mugLine* lines = (mugLine*)obj;
+				// OpenGL
+				#ifdef MU_SUPPORT_OPENGL
+					case MU_GRAPHIC_OPENGL: {
+						// Initiate OpenGL context
+						res = mugGL_init_context(gfx);
 
-						// Loop through each point
-						for (uint32_m i = 0; i < c; ++i) {
-							// Point 1
-							// - vec3 pos
-							mu_memcpy(v, lines->points[0].pos, 12);
-							v += 3;
-							// - vec4 col
-							mu_memcpy(v, lines->points[0].col, 16);
-							v += 4;
-							// Point 2
-							// - vec3 pos
-							mu_memcpy(v, lines->points[1].pos, 12);
-							v += 3;
-							// - vec4 col
-							mu_memcpy(v, lines++->points[1].col, 16);
-							v += 4;
+						// Return possible failure
+						if (res != MUG_SUCCESS) {
+							MU_SET_RESULT(result, res)
+							if (mug_result_is_fatal(res)) {
+								mugGraphic_destroy(gfx);
+								mug_dealloc(gfx, MUG_ALLOC_GENERAL);
+								return 0;
+							}
 						}
-					}
+					} break;
+				#endif
+			}
 
-					// Describes line data (same as points)
-					#define mugGL_lines_desc mugGL_points_desc
+			return gfx;
+		}
 
-					// Renders lines
-					void mugGL_lines_render(mugGL_ObjBuffer* buf) {
-						// Draw arrays
-						glDrawArrays(
-							GL_LINES, // Render using lines
-							0, // Starting index (just 0)
-							buf->obj_count*2 // Index count (two points per line)
-						);
-					}
+		// Get window handle from graphic
+		MUDEF muWindow mug_graphic_get_window(mugContext* context, muGraphic gfx) {
+			// Return window handle
+			return ((mug_Graphic*)gfx)->parent.cosa_win;
+			// To avoid unused parameter warnings
+			if (context) {}
+		}
 
-					// Subrenders lines
-					void mugGL_lines_subrender(uint32_m o, uint32_m c) {
-						// Draw arrays
-						glDrawArrays(
-							GL_LINES, // Render using lines
-							o*2, // Starting index (two points per line)
-							c*2 // Index count (two points per line)
-						);
-					}
+		// Returns if the graphic exists
+		MUDEF muBool mug_graphic_exists(mugContext* context, muGraphic gfx) {
+			// Return existence state
+			return mugGraphic_exists((mug_Graphic*)gfx);
 
-					// Fills buffer with need info
-					void mugGL_lines_fill(mugGL_ObjBuffer* buf) {
-						buf->obj_type = MUG_OBJECT_LINE;
+			// To avoid unused parameter warnings
+			if (context) {}
+		}
 
-						// Amount of bytes used on vertex per object:
-						// one vertex = vec3+vec4 (28)
-						// one line = two vertexes (56)
-						buf->bv_per_obj = 56;
+		// Clear graphic
+		MUDEF void mug_graphic_clear(mugContext* context, mugResult* result, muGraphic gfx, float r, float g, float b) {
+			// Get inner graphic handle
+			mug_Graphic* igfx = (mug_Graphic*)gfx;
 
-						// Function equivalents
-						buf->fill_vertexes = mugGL_lines_fill_vertexes;
-						buf->fill_indexes = 0;
-						buf->desc = mugGL_lines_desc;
-						buf->render = mugGL_lines_render;
-						buf->subrender = mugGL_lines_subrender;
-					}
+			// Clear screen
+			switch (igfx->system) {
+				default: break;
 
-			/* Triangle */
+				// OpenGL
+				#ifdef MU_SUPPORT_OPENGL
+					case MU_GRAPHIC_OPENGL: {
+						// Bind
+						mugGraphicGL_bind(igfx);
+						// Clear
+						mugResult res = mugGL_clear(igfx, r, g, b);
+						if (res != MUG_SUCCESS) {
+							MU_SET_RESULT(result, res)
+						}
+					} break;
+				#endif
+			}
 
-				// Data format: { vec3 pos, vec4 col }
-				// Rendered as GL_TRIANGLES
+			// To avoid unused parameter warnings
+			return; if (context) {} if (result) {} if (r) {} if (g) {} if (b) {}
+		}
 
-				/* Shaders */
+		// Swaps buffers, presenting image to screen
+		MUDEF void mug_graphic_swap_buffers(mugContext* context, mugResult* result, muGraphic gfx) {
+			// Get inner graphic handle
+			mug_Graphic* igfx = (mug_Graphic*)gfx;
 
-					// Vertex shader (same as points)
-					#define mugGL_triangleVS mugGL_pointVS
+			// Render pending immediate batch
+			mugDraw_flush(igfx, result);
+			// Reset frame arena
+			mug_arena_pop(&igfx->arena, 0);
 
-					// Fragment shader (same as points)
-					#define mugGL_triangleFS mugGL_pointFS
+			// Swap buffers
+			switch (igfx->system) {
+				default: break;
 
-					// Creates program for triangles (same as points)
-					#define mugGL_triangles_shader_load mugGL_points_shader_load
+				// OpenGL
+				#ifdef MU_SUPPORT_OPENGL
+					case MU_GRAPHIC_OPENGL: {
+						// Bind OpenGL
+						mugGraphicGL_bind(igfx);
 
-				/* Buffer */
+						// Stop rendering to a target left unfinished
+						if (mugGL_target_end(igfx)) {
+							mug_damage_full(&igfx->damage);
+						}
+						// End zone left active
+						mugGL_zone_end(igfx);
+						// Copy partially redrawn frame to window
+						mugGL_present_canvas(igfx);
+						// Swap buffers
+						MUG_STAT_TIME(&igfx->stats, swap_start)
+						MUG_TRACE_BEGIN(&igfx->trace, swap_trace)
+						mugResult res = mugGraphicGL_swap_buffers(igfx);
+						MUG_STAT_TIME_END(&igfx->stats, swap_time, swap_start)
+						MUG_TRACE_END(&igfx->trace, "swap", swap_trace)
+						if (res != MUG_SUCCESS) {
+							MU_SET_RESULT(result, res)
+							if (mug_result_is_fatal(res)) {
+								return;
+							}
+						}
 
-					// Fills vertex data
-					void mugGL_triangles_fill_vertexes(GLfloat* v, void* obj, uint32_m c) {
-						// Convert obj to struct array
-						mugTriangle* triangles = (mugTriangle*)obj;
+						// Update OpenGL afterwards
+						mugGL_update_context(igfx);
+					} break;
+				#endif
+			}
 
-						// Loop through each triangle
-						for (uint32_m t = 0; t < c; ++t) {
-							// Point 0
-							// - vec3 pos
-							mu_memcpy(v, triangles->points[0].pos, 12);
-							v += 3;
-							// - vec4 col
-							mu_memcpy(v, triangles->points[0].col, 16);
-							v += 4;
-							// Point 1
-							// - vec3 pos
-							mu_memcpy(v, triangles->points[1].pos, 12);
-							v += 3;
-							// - vec4 col
-							mu_memcpy(v, triangles->points[1].col, 16);
-							v += 4;
-							// Point 2
-							// - vec3 pos
-							mu_memcpy(v, triangles->points[2].pos, 12);
-							v += 3;
-							// - vec4 col
-							mu_memcpy(v, triangles++->points[2].col, 16);
-							v += 4;
-						}
-					}
+			// Everything changed so far has been presented,
+			// except for damage from after clearing if partially redrawing
+			igfx->redraw = igfx->damage.enabled && igfx->damage.any;
 
-					// Describes triangle data (same as points)
-					#define mugGL_triangles_desc mugGL_points_desc
+			// Transfer asynchronously loaded images
+			mugLoad_pump(igfx);
 
-					// Renders triangles
-					void mugGL_triangles_render(mugGL_ObjBuffer* buf) {
-						// Draw arrays
-						glDrawArrays(
-							GL_TRIANGLES, // Render using triangles
-							0, // Starting index (just 0)
-							buf->obj_count*3 // Index count (three points per triangle)
-						);
-					}
+			// Complete frame's draw statistics
+			mug_stats_frame(&igfx->stats);
+			++igfx->zones.frame;
 
-					// Subrenders triangles
-					void mugGL_triangles_subrender(uint32_m o, uint32_m c) {
-						// Draw arrays
-						glDrawArrays(
-							GL_TRIANGLES, // Render using triangles
-							o*3, // Starting index (three points per triangle)
-							c*3 // Index count (three points per triangle)
-						);
-					}
+			// Report crossing of GPU memory threshold
+			mug_memory_frame(&igfx->memory, gfx);
 
-					// Fills buffer with needed info
-					void mugGL_triangles_fill(mugGL_ObjBuffer* buf) {
-						buf->obj_type = MUG_OBJECT_TRIANGLE;
+			// Avoid unused parameter warnings
+			return; if (context) {} if (result) {}
+		}
 
-						// Amount of bytes used on vertex per object:
-						// one vertex = vec3+vec4 (28)
-						// one triangle = three vertexes (84)
-						buf->bv_per_obj = 84;
+		// Updates the graphic's parent
+		MUDEF void mug_graphic_update(mugContext* context, mugResult* result, muGraphic gfx, float target_fps) {
+			// Get inner graphic handle
+			mug_Graphic* igfx = (mug_Graphic*)gfx;
 
-						// Function equivalents
-						buf->fill_vertexes = mugGL_triangles_fill_vertexes;
-						buf->fill_indexes = 0;
-						buf->desc = mugGL_triangles_desc;
-						buf->render = mugGL_triangles_render;
-						buf->subrender = mugGL_triangles_subrender;
-					}
+			// Wait until the next frame is scheduled
+			MUG_STAT_TIME(&igfx->stats, sleep_start)
+			MUG_TRACE_BEGIN(&igfx->trace, sleep_trace)
+			mug_pacer_frame(context, &igfx->pacer, target_fps, igfx->present_mode != MUG_PRESENT_IMMEDIATE);
+			MUG_STAT_TIME_END(&igfx->stats, sleep_time, sleep_start)
+			MUG_TRACE_END(&igfx->trace, "sleep", sleep_trace)
 
-			/* Rect */
+			// Update graphic
+			MUG_TRACE_BEGIN(&igfx->trace, update_trace)
+			mugResult res = mugGraphic_update(igfx);
+			MUG_TRACE_END(&igfx->trace, "window update", update_trace)
+			if (res != MUG_SUCCESS) {
+				MU_SET_RESULT(result, res)
+			}
+		}
 
-				// Data format: { vec3 pos, vec4 col }
-				// Indexed data: { 0, 1, 3, 1, 2, 3 }
+		// Updates the graphic's parent, waiting for an event if idle
+		MUDEF void mug_graphic_update_wait(mugContext* context, mugResult* result, muGraphic gfx, double timeout) {
+			// Get inner graphic handle
+			mug_Graphic* igfx = (mug_Graphic*)gfx;
 
-				/* Shaders */
+			// Transfer asynchronously loaded images, since no swap is coming while idle
+			mugLoad_pump(igfx);
 
-					// Vertex shader (same as points)
-					#define mugGL_rectVS mugGL_pointVS
+			// Wait if there's nothing left to do
+			if (!igfx->redraw && !(igfx->loader && mugLoad_pending(igfx->loader))) {
+				MUG_STAT_TIME(&igfx->stats, sleep_start)
+				MUG_TRACE_BEGIN(&igfx->trace, sleep_trace)
+				mugGraphic_wait(igfx, timeout);
+				MUG_STAT_TIME_END(&igfx->stats, sleep_time, sleep_start)
+				MUG_TRACE_END(&igfx->trace, "sleep", sleep_trace)
+			}
+			mug_pacer_idle(&igfx->pacer, muCOSA_fixed_time_get(&context->cosa));
 
-					// Fragment shader (same as points)
-					#define mugGL_rectFS mugGL_pointFS
+			// Update graphic
+			MUG_TRACE_BEGIN(&igfx->trace, update_trace)
+			mugResult res = mugGraphic_update(igfx);
+			MUG_TRACE_END(&igfx->trace, "window update", update_trace)
+			if (res != MUG_SUCCESS) {
+				MU_SET_RESULT(result, res)
+			}
+		}
 
-					// Creates program for rects (same as points)
-					#define mugGL_rects_shader_load mugGL_points_shader_load
+		MUDEF muBool mug_graphic_needs_redraw(mugContext* context, muGraphic gfx) {
+			return ((mug_Graphic*)gfx)->redraw; if (context) {}
+		}
+
+		MUDEF void mug_graphic_wake(mugContext* context, muGraphic gfx) {
+			mug_signal_raise(&((mug_Graphic*)gfx)->wake);
+			return; if (context) {}
+		}
 
-				/* Buffer */
+		MUDEF void mug_graphic_partial_redraw(mugContext* context, muGraphic gfx, muBool partial) {
+			mug_Graphic* igfx = (mug_Graphic*)gfx;
+			if (igfx->damage.enabled == partial) {
+				return;
+			}
 
-					// Fills a particular vertex given what to multiply dimensions by
-					// (Used to alternate between 4 corners)
-					// Returns how much to increment v by
-					static inline size_m mugGL_rects_fill_invertexes(
-						// Rect data
-						GLfloat* v, mugRect* rect,
-						// Half-dim and vector dim
-						float hdim[2], float vdim0, float vdim1,
-						// Sin/Cos rotation
-						float srot, float crot
-					) {
-						// vec3 pos
-						// - x and y
-						mugMath_rot_point_point(
-							rect->center.pos[0]+(hdim[0]*vdim0), // Point x
-							rect->center.pos[1]+(hdim[1]*vdim1), // Point y
-							rect->center.pos[0], // Center x
-							rect->center.pos[1], // Center y
-							srot, crot, // Sin / Cos rotation
-							v
-						);
-						// - z
-						v[2] = rect->center.pos[2];
+			// Start tracking from a full redraw
+			// (Buffers' bounds are (re)created or freed as they change)
+			igfx->damage.enabled = partial;
+			igfx->damage.any = MU_FALSE;
+			mug_damage_full(&igfx->damage);
+			igfx->redraw = MU_TRUE;
+			return; if (context) {}
+		}
 
-						// vec4 col
-						mu_memcpy(&v[3], rect->center.col, 16);
-						return 7;
-					}
+		MUDEF void mug_graphic_damage(mugContext* context, muGraphic gfx, float* rect) {
+			mug_Graphic* igfx = (mug_Graphic*)gfx;
+			if (!rect) {
+				mug_damage_full(&igfx->damage);
+			} else {
+				float area[4] = { rect[0], rect[1], rect[0]+rect[2], rect[1]+rect[3] };
+				mug_damage_add(&igfx->damage, area);
+			}
+			igfx->redraw = MU_TRUE;
+			return; if (context) {}
+		}
 
-					// Fill vertex data
-					void mugGL_rects_fill_vertexes(GLfloat* v, void* obj, uint32_m c) {
-						// Convert obj to struct array
-						mugRect* rects = (mugRect*)obj;
+		MUDEF muBool mug_graphic_get_damage(mugContext* context, muGraphic gfx, float* rect) {
+			mug_Graphic* igfx = (mug_Graphic*)gfx;
+			if (!igfx->damage.enabled || !igfx->damage.any) {
+				return MU_FALSE;
+			}
 
-						// Loop through each rect
-						for (uint32_m i = 0; i < c; ++i) {
-							// Store half-dim
-							float hdim[2] = { rects->dim[0]/2.f, rects->dim[1]/2.f };
-							// Store sin/cos of rotation
-							// Sin is negative because y-direction is flipped in mug coordinates
-							float srot = -mu_sinf(rects->rot);
-							float crot = mu_cosf(rects->rot);
+			// Limit to graphic
+			float b[4];
+			for (uint32_m i = 0; i < 4; ++i) {
+				float max = (float)igfx->dim[i % 2];
+				b[i] = (igfx->damage.area[i] < 0.f) ? (0.f) : ((igfx->damage.area[i] > max) ? (max) : (igfx->damage.area[i]));
+			}
+			rect[0] = b[0];
+			rect[1] = b[1];
+			rect[2] = b[2] - b[0];
+			rect[3] = b[3] - b[1];
+			return MU_TRUE; if (context) {}
+		}
 
-							// Top-left
-							v += mugGL_rects_fill_invertexes(v, rects  , hdim, -1.f, -1.f, srot, crot);
-							// Bottom-left
-							v += mugGL_rects_fill_invertexes(v, rects  , hdim, -1.f,  1.f, srot, crot);
-							// Bottom-right
-							v += mugGL_rects_fill_invertexes(v, rects  , hdim,  1.f,  1.f, srot, crot);
-							// Top-right
-							v += mugGL_rects_fill_invertexes(v, rects++, hdim,  1.f, -1.f, srot, crot);
-						}
-					}
+		MUDEF void mug_graphic_set_present_mode(mugContext* context, mugResult* result, muGraphic gfx, mugPresentMode mode) {
+			// Get inner graphic handle
+			mug_Graphic* igfx = (mug_Graphic*)gfx;
 
-					// Fill index data
-					// Circles, squircles, round rects, textures, texture arrays also use this
-					void mugGL_rects_fill_indexes(GLuint* i, uint32_m c) {
-						// Offset for index pattern:
-						uint32_m po = 0;
+			// Do things based on graphic system
+			switch (igfx->system) {
+				default: return; break;
 
-						// Loop through each rect
-						for (uint32_m r = 0; r < c; ++r) {
-							// Fill out index pattern:
-							// { 0, 1, 3, 1, 2, 3 }
-							*i++ = po;
-							*i++ = po+1;
-							*i++ = po+3;
-							*i++ = po+1;
-							*i++ = po+2;
-							*i++ = po+3;
-							// Increment po
-							po += 4;
+				// OpenGL
+				#ifdef MU_SUPPORT_OPENGL
+					case MU_GRAPHIC_OPENGL: {
+						mugGraphicGL_bind(igfx);
+						muBool set = MU_FALSE;
+						// Adaptive uses a negative interval (EXT_swap_control_tear),
+						// falling back to vsync if unsupported
+						if (mode == MUG_PRESENT_ADAPTIVE) {
+							set = mugGraphicGL_swap_interval(igfx, -1);
+							if (!set) {
+								mode = MUG_PRESENT_VSYNC;
+							}
 						}
-					}
-
-					// Describes rect data (same as points)
-					#define mugGL_rects_desc mugGL_points_desc
+						if (mode != MUG_PRESENT_ADAPTIVE) {
+							set = mugGraphicGL_swap_interval(igfx, (mode == MUG_PRESENT_VSYNC) ? (1) : (0));
+						}
+						if (!set) {
+							MU_SET_RESULT(result, MUG_UNSUPPORTED_PRESENT_MODE)
+							return;
+						}
+						igfx->present_mode = mode;
+					} break;
+				#endif
+			}
 
-					// Renders rects
-					// Circles, squircles, round rects, textures, texture arrays also use this
-					void mugGL_rects_render(mugGL_ObjBuffer* buf) {
-						// Draw elements
-						glDrawElements(
-							GL_TRIANGLES, // Rendering triangle-by-triangle
-							buf->obj_count*6, // Indexes per object
-							GL_UNSIGNED_INT, // Index type (GLuint)
-							(const void*)(0) // Offset in index data (in bytes)
-						);
-					}
+			return; if (context) {} if (result) {} if (mode) {}
+		}
 
-					// Subrenders rects
-					// Circles, squircles, round rects, textures, texture arrays also use this
-					void mugGL_rects_subrender(uint32_m o, uint32_m c) {
-						// Draw elements
-						glDrawElements(
-							GL_TRIANGLES, // Rendering triangle-by-triangle
-							c*6, // Indexes per object
-							GL_UNSIGNED_INT, // Index type (GLuint)
-							(const void*)(((size_m)o)*24) // Offset in index data (in bytes; 24 = 6*4 = 6*sizeof(GLuint))
-						);
-					}
+		MUDEF mugPresentMode mug_graphic_get_present_mode(mugContext* context, muGraphic gfx) {
+			return ((mug_Graphic*)gfx)->present_mode; if (context) {}
+		}
 
-					// Fills buffer with needed info
-					void mugGL_rects_fill(mugGL_ObjBuffer* buf) {
-						buf->obj_type = MUG_OBJECT_RECT;
+		MUDEF void mug_graphic_frame_policy(mugContext* context, muGraphic gfx, mugFramePolicy policy) {
+			((mug_Graphic*)gfx)->pacer.policy = policy;
+			return; if (context) {}
+		}
 
-						// Amount of bytes used on vertex per object:
-						// one vertex = vec3+vec4 (28)
-						// one rect = four vertexes (112)
-						buf->bv_per_obj = 112;
+		MUDEF void mug_graphic_frame_stats(mugContext* context, muGraphic gfx, mugFrameStats* stats) {
+			mug_pacer_stats(&((mug_Graphic*)gfx)->pacer, stats);
+			return; if (context) {}
+		}
 
-						// Amount of bytes used on index per object:
-						// one rect = six indexes (24)
-						buf->bi_per_obj = 24;
+		MUDEF void mug_graphic_get_stats(mugContext* context, muGraphic gfx, mugStats* stats) {
+			*stats = ((mug_Graphic*)gfx)->stats.counters;
+			return; if (context) {}
+		}
 
-						// Function equivalents
-						buf->fill_vertexes = mugGL_rects_fill_vertexes;
-						buf->fill_indexes = mugGL_rects_fill_indexes;
-						buf->desc = mugGL_rects_desc;
-						buf->render = mugGL_rects_render;
-						buf->subrender = mugGL_rects_subrender;
-					}
+		MUDEF void mug_graphic_gpu_profile(mugContext* context, muGraphic gfx, muBool enable) {
+			// Get inner graphic handle
+			mug_Graphic* igfx = (mug_Graphic*)gfx;
 
-			/* Circle */
+			// End zone being measured if disabling
+			if (!enable && igfx->zones.active) {
+				switch (igfx->system) {
+					default: break;
+
+					// OpenGL
+					#ifdef MU_SUPPORT_OPENGL
+						case MU_GRAPHIC_OPENGL: {
+							mugGraphicGL_bind(igfx);
+							mugGL_zone_end(igfx);
+						} break;
+					#endif
+				}
+			}
+			igfx->zones.enabled = enable;
 
-				// Data format: { vec3 pos, vec4 col, vec2 cen, float rad }
-				// Indexed data: { 0, 1, 3, 1, 2, 3 }
+			// To avoid unused parameter warnings
+			return; if (context) {}
+		}
 
-				/* Shaders */
+		MUDEF void mug_gpu_zone_begin(mugContext* context, mugResult* result, muGraphic gfx, const char* name) {
+			// Get inner graphic handle
+			mug_Graphic* igfx = (mug_Graphic*)gfx;
+			if (!igfx->zones.enabled || igfx->zones.active) {
+				return;
+			}
 
-					// Vertex shader
-					const char* mugGL_circleVS = 
-						// Version
-						"#version 330 core\n"
+			// Do things based on graphic system
+			switch (igfx->system) {
+				default: break;
 
-						// Input (pos, col, cen, rad)
-						"layout(location=0)in vec3 vPos;"
-						"layout(location=1)in vec4 vCol;"
-						"layout(location=2)in vec2 vCen;"
-						"layout(location=3)in float vRad;"
+				// OpenGL
+				#ifdef MU_SUPPORT_OPENGL
+					case MU_GRAPHIC_OPENGL: {
+						mugGraphicGL_bind(igfx);
+						// Pending immediate draws belong to what came before the zone
+						mugDraw_flush(igfx, result);
+						mugGL_zone_begin(igfx, name);
+					} break;
+				#endif
+			}
 
-						// Output (col, cen, float rad)
-						"out vec4 fCol;"
-						"out vec2 fCen;"
-						"out float fRad;"
+			// To avoid unused parameter warnings
+			return; if (context) {} if (result) {} if (name) {}
+		}
 
-						// Dimensions of graphic divided by 2
-						"uniform vec2 d;"
-						// Modifiers
-						"uniform vec3 aP;" // addPos
-						"uniform vec3 mP;" // mulPos
+		MUDEF void mug_gpu_zone_end(mugContext* context, muGraphic gfx) {
+			// Get inner graphic handle
+			mug_Graphic* igfx = (mug_Graphic*)gfx;
+			if (!igfx->zones.active) {
+				return;
+			}
 
-						// Main
-						"void main(){"
-							// Set position
-							"gl_Position=vec4("
-								// X
-								"(((vPos.x*mP.x)+aP.x)-(d.x))/d.x,"
-								// Y
-								"-(((vPos.y*mP.y)+aP.y)-(d.y))/d.y,"
-								// Z
-								"((vPos.z*mP.z)+aP.z),"
-								// W
-								"1.0"
-							");"
+			// Do things based on graphic system
+			switch (igfx->system) {
+				default: break;
 
-							// Transfer data to fragment
-							"fCol=vCol;"
-							// (Flip y because fragcoord is bottom-left origin)
-							"fCen=vec2((vCen.x*mP.x)+aP.x, (d.y*2.0)-((vCen.y*mP.y)+aP.y));"
-							"fRad=vRad;"
-						"}"
-					;
+				// OpenGL
+				#ifdef MU_SUPPORT_OPENGL
+					case MU_GRAPHIC_OPENGL: {
+						mugGraphicGL_bind(igfx);
+						// Pending immediate draws belong to the zone
+						mugDraw_flush(igfx, 0);
+						mugGL_zone_end(igfx);
+					} break;
+				#endif
+			}
 
-					// Fragment shader
-					const char* mugGL_circleFS = 
-						// Version
-						"#version 330 core\n"
+			// To avoid unused parameter warnings
+			return; if (context) {}
+		}
 
-						// Input (col, cen, rad)
-						"in vec4 fCol;"
-						"in vec2 fCen;"
-						"in float fRad;"
-						// Output (col)
-						"out vec4 oCol;"
+		MUDEF uint32_m mug_graphic_get_gpu_zones(mugContext* context, muGraphic gfx, mugGPUZone* zones, uint32_m max) {
+			mug_GPUZones* izones = &((mug_Graphic*)gfx)->zones;
+			for (uint32_m i = 0; i < izones->count && i < max; ++i) {
+				zones[i] = izones->zones[i].info;
+			}
+			return izones->count;
+			if (context) {}
+		}
 
-						// Modifiers
-						"uniform vec4 aC;" // addCol
-						"uniform vec4 mC;" // mulCol
+		MUDEF void mug_graphic_trace(mugContext* context, mugResult* result, muGraphic gfx, muBool enable) {
+			// Get inner graphic handle
+			mug_Graphic* igfx = (mug_Graphic*)gfx;
 
-						// Returns a smooth transition between 0.0 and 1.0
-						// depending on if pixel (p) is outside of circle
-						// (center c, radius r)
-						// Uses this formula (lol):
-						// \max\left(\min\left(-\left(\sqrt{\left(p.x-c.x\right)^{2}+\left(p.y-c.y\right)^{2}}-r\right)+0.5,1\right),0\right)
-						"float dis(vec2 p,vec2 c,float r){"
-							// Return inverse of:
-							"return 1.0-"
-								"max(min("
-								// Negative if outside, positive if inside
-								// Fades between edge of circle; automatic anti-aliasing >:)
-								"(sqrt(pow(p.x-c.x,2.0)+pow(p.y-c.y,2.0))-r)+0.5,"
-								// Maximum value of 1
-								"1.0),"
-								// Minimum value of 0
-								"0.0);"
-						"}"
+			// Allocate events upon first being enabled
+			if (enable && !igfx->trace.events) {
+				igfx->trace.events = (mug_TraceEvent*)mug_alloc(sizeof(mug_TraceEvent) * MUG_TRACE_EVENT_COUNT, MUG_ALLOC_GENERAL);
+				if (!igfx->trace.events) {
+					MU_SET_RESULT(result, MUG_FAILED_MALLOC)
+					return;
+				}
+			}
+			igfx->trace.enabled = enable;
+
+			// Align GPU track
+			if (enable) {
+				switch (igfx->system) {
+					default: break;
+
+					// OpenGL
+					#ifdef MU_SUPPORT_OPENGL
+						case MU_GRAPHIC_OPENGL: {
+							mugGraphicGL_bind(igfx);
+							mugGL_trace_calibrate(igfx);
+						} break;
+					#endif
+				}
+			}
 
-						// Main
-						"void main(){"
-							// Calculate color
-							"oCol=vec4(fCol.rgb, fCol.a*dis(gl_FragCoord.xy,fCen,fRad));"
-							// Apply modifiers
-							"oCol=(oCol*mC)+aC;"
-						"}"
-					;
+			// To avoid unused parameter warnings
+			return; if (context) {} if (result) {}
+		}
 
-					// Creates program for circles
-					void mugGL_circles_shader_load(mug_Graphic* gfx, mugGL_Shader* shader, mugResult* result) {
-						// Exit if shader already compiled
-						if (shader->program) {
-							return;
-						}
+		MUDEF void mug_graphic_write_trace(mugContext* context, mugResult* result, muGraphic gfx, const char* path) {
+			// Get inner graphic handle
+			mug_Graphic* igfx = (mug_Graphic*)gfx;
 
-						// Compile shader
-						mugResult res = mugGL_shader_create_vf(gfx, shader, mugGL_circleVS, mugGL_circleFS);
-						if (res != MUG_SUCCESS) {
-							MU_SET_RESULT(result, res)
-						}
-					}
+			// Write trace (empty if nothing was ever recorded)
+			FILE* file = mu_fopen(path, "wb");
+			if (!file) {
+				MU_SET_RESULT(result, MUG_FAILED_ACCESS_FILE)
+				return;
+			}
+			mug_Trace empty;
+			mug_trace_init(&empty, context);
+			muBool written = mug_trace_write((igfx->trace.events) ? (&igfx->trace) : (&empty), file);
+			if (mu_fclose(file) != 0 || !written) {
+				MU_SET_RESULT(result, MUG_FAILED_ACCESS_FILE)
+			}
 
-				/* Buffer */
+			return; if (context) {}
+		}
 
-					// Fills a particular vertex given what to multiply radius by
-					// (Used to alternate between 4 corners)
-					// Returns new v pointer after this vertex
-					static inline GLfloat* mugGL_circles_fill_invertexes(
-						// Circle data
-						GLfloat* v, mugCircle* circle,
-						// Radius data
-						float vradx, float vrady
-					) {
-						// vec3 pos
-						// - x and y
-						*v++ = circle->center.pos[0]+(circle->radius*vradx);
-						*v++ = circle->center.pos[1]+(circle->radius*vrady);
-						// - z
-						*v++ = circle->center.pos[2];
+		MUDEF void mug_graphic_frames_in_flight(mugContext* context, muGraphic gfx, uint32_m frames) {
+			((mug_Graphic*)gfx)->frames_in_flight = (frames > MUG_MAX_FRAMES_IN_FLIGHT) ? (MUG_MAX_FRAMES_IN_FLIGHT) : (frames);
+			return; if (context) {}
+		}
 
-						// vec4 col
-						mu_memcpy(v, circle->center.col, 16);
-						// vec2 cen
-						mu_memcpy(v+4, circle->center.pos, 8);
-						// float rad
-						v[6] = circle->radius;
-						return v+7;
-					}
+		MUDEF void mug_graphic_memory_report(mugContext* context, muGraphic gfx, mugMemoryReport* report) {
+			*report = ((mug_Graphic*)gfx)->memory.report;
+			return; if (context) {}
+		}
 
-					// Fills vertex data
-					void mugGL_circles_fill_vertexes(GLfloat* v, void* obj, uint32_m c) {
-						// Convert obj to struct array
-						mugCircle* circles = (mugCircle*)obj;
+		MUDEF void mug_graphic_memory_threshold(mugContext* context, muGraphic gfx, size_m threshold, mugMemoryCallback callback, void* user) {
+			mug_Memory* mem = &((mug_Graphic*)gfx)->memory;
+			mem->threshold = threshold;
+			mem->callback = callback;
+			mem->user = user;
 
-						// Loop through each circle
-						for (uint32_m i = 0; i < c; ++i) {
-							// Top-left
-							v = mugGL_circles_fill_invertexes(v, circles,  -1.f, -1.f);
-							// Bottom-left
-							v = mugGL_circles_fill_invertexes(v, circles,  -1.f,  1.f);
-							// Bottom-right
-							v = mugGL_circles_fill_invertexes(v, circles,   1.f,  1.f);
-							// Top-right
-							v = mugGL_circles_fill_invertexes(v, circles++, 1.f, -1.f);
-						}
-					}
+			// Count being over the new threshold already as crossing it
+			mem->over = MU_FALSE;
+			mem->crossed = MU_FALSE;
+			mug_memory_check(mem);
 
-					// Fill index data (same as rect)
-					#define mugGL_circles_fill_indexes mugGL_rects_fill_indexes
+			return; if (context) {}
+		}
 
-					// Describes circle data
-					void mugGL_circles_desc(void) {
-						// vec3 pos
-						glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 40, 0);
-						glEnableVertexAttribArray(0);
-						// vec4 col
-						glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, 40, (void*)(12));
-						glEnableVertexAttribArray(1);
-						// vec2 cen
-						glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 40, (void*)(28));
-						glEnableVertexAttribArray(2);
-						// float rad
-						glVertexAttribPointer(3, 1, GL_FLOAT, GL_FALSE, 40, (void*)(36));
-						glEnableVertexAttribArray(3);
-					}
+	/* Object types */
 
-					// Renders circles (same as rect)
-					#define mugGL_circles_render mugGL_rects_render
-					// Subrenders circles (same as rect)
-					#define mugGL_circles_subrender mugGL_rects_subrender
+		// Loads the given object type
+		MUDEF void mug_gobject_load(mugContext* context, mugResult* result, muGraphic gfx, mugObjectType obj_type) {
+			// Get inner graphic handle
+			mug_Graphic* igfx = (mug_Graphic*)gfx;
 
-					// Fills buffer with needed info
-					void mugGL_circles_fill(mugGL_ObjBuffer* buf) {
-						buf->obj_type = MUG_OBJECT_CIRCLE;
+			// Do thing based on graphic system
+			switch (igfx->system) {
+				default: break;
 
-						// Amount of bytes used on vertex per object:
-						// one vertex = vec3+vec4+vec2+float (40)
-						// one circle = four vertexes (160)
-						buf->bv_per_obj = 160;
+				// OpenGL
+				#ifdef MU_SUPPORT_OPENGL
+					case MU_GRAPHIC_OPENGL: {
+						// Bind OpenGL
+						mugGraphicGL_bind(igfx);
+						// Load object type
+						mugGL_load_object_type(igfx, (mugGL_Context*)igfx->p, result, obj_type);
+					} break;
+				#endif
+			}
 
-						// Amount of bytes used on index per object:
-						// one circle = six indexes (24)
-						buf->bi_per_obj = 24;
+			// To avoid unused parameter warnings in some circumstances
+			return; if (context) {} if (result) {} if (obj_type) {}
+		}
 
-						// Function equivalents
-						buf->fill_vertexes = mugGL_circles_fill_vertexes;
-						buf->fill_indexes = mugGL_circles_fill_indexes;
-						buf->desc = mugGL_circles_desc;
-						buf->render = mugGL_circles_render;
-						buf->subrender = mugGL_circles_subrender;
-					}
+		// Deloads the given object type
+		MUDEF void mug_gobject_deload(mugContext* context, muGraphic gfx, mugObjectType obj_type) {
+			// Get inner graphic handle
+			mug_Graphic* igfx = (mug_Graphic*)gfx;
 
-			/* Squircle */
+			// Do things based on graphic system
+			switch (igfx->system) {
+				default: break;
 
-				// Data format: { vec3 pos, vec4 col, float rot, vec2 cen, float rad, float exp }
-				// Indexed data: { 0, 1, 3, 1, 2, 3 }
+				// OpenGL
+				#ifdef MU_SUPPORT_OPENGL
+					case MU_GRAPHIC_OPENGL: {
+						// Bind OpenGL
+						mugGraphicGL_bind(igfx);
+						// Deload
+						mugGL_deload_object_type((mugGL_Context*)igfx->p, obj_type);
+					} break;
+				#endif
+			}
 
-				/* Shaders */
+			// To avoid unused parameter warnings
+			return; if (context) {} if (obj_type) {}
+		}
 
-					// Vertex shader
-					const char* mugGL_squircleVS = 
-						// Version
-						"#version 330 core\n"
+		// Sets modification variable for given object type
+		MUDEF void mug_gobject_mod(mugContext* context, muGraphic gfx, mugObjectType type, mugObjectMod mod, float* data) {
+			// Get inner graphic handle
+			mug_Graphic* igfx = (mug_Graphic*)gfx;
+			// Graphic needs to be redrawn
+			igfx->redraw = MU_TRUE;
 
-						// Input (pos, col, rot, cen, rad, exp)
-						"layout(location=0)in vec3 vPos;"
-						"layout(location=1)in vec4 vCol;"
-						"layout(location=2)in float vRot;"
-						"layout(location=3)in vec2 vCen;"
-						"layout(location=4)in float vRad;"
-						"layout(location=5)in float vExp;"
+			// Do things based on graphic system
+			switch (igfx->system) {
+				default: break;
 
-						// Output (rot, col, cen, rad, exp)
-						"out float fRot;"
-						"out vec4 fCol;"
-						"out vec2 fCen;"
-						"out float fRad;"
-						"out float fExp;"
+				// OpenGL
+				#ifdef MU_SUPPORT_OPENGL
+					case MU_GRAPHIC_OPENGL: {
+						// Render pending immediate batch with the previous modifier
+						mugDraw_flush(igfx, 0);
+						mugGL_object_type_mod((mugGL_Context*)igfx->p, 0, type, mod, data);
+					} break;
+				#endif
+			}
 
-						// Dimensions of graphic divided by 2
-						"uniform vec2 d;"
-						// Modifiers
-						"uniform vec3 aP;" // addPos
-						"uniform vec3 mP;" // mulPos
+			// Every object of the type may have moved
+			mug_damage_full(&igfx->damage);
+			if (type <= MUG_OBJECT_LAST) {
+				switch (mod) {
+					default: break;
+					case MUG_OBJECT_ADD_POS: igfx->damage.add[type][0] = data[0]; igfx->damage.add[type][1] = data[1]; break;
+					case MUG_OBJECT_MUL_POS: igfx->damage.mul[type][0] = data[0]; igfx->damage.mul[type][1] = data[1]; break;
+				}
+			}
 
-						// Main
-						"void main(){"
-							// Set position
-							"gl_Position=vec4("
-								// X
-								"(((vPos.x*mP.x)+aP.x)-(d.x))/d.x,"
-								// Y
-								"-(((vPos.y*mP.y)+aP.y)-(d.y))/d.y,"
-								// Z
-								"(vPos.z*mP.z)+aP.z,"
-								// W
-								"1.0"
-							");"
+			// To avoid unused parameter warnings
+			return; if (context) {} if (type) {} if (mod) {} if (data) {}
+		}
 
-							// Transfer data to fragment
-							"fRot=vRot;"
-							"fCol=vCol;"
-							// (Flip y because fragcoord is bottom-left origin)
-							"fCen=vec2((vCen.x*mP.x)+aP.x, (d.y*2.0)-((vCen.y*mP.y)+aP.y));"
-							"fRad=vRad;"
-							"fExp=vExp;"
-						"}"
-					;
+	/* Object buffer stuff */
 
-					// Fragment shader
-					const char* mugGL_squircleFS =
-						// Version
-						"#version 330 core\n"
+		// Creates an object buffer
+		MUDEF mugObjects mug_gobjects_create(mugContext* context, mugResult* result, muGraphic gfx, mugObjectType type, uint32_m obj_count, void* objs) {
+			// Get inner graphic handle
+			mug_Graphic* igfx = (mug_Graphic*)gfx;
+			// Graphic needs to be redrawn
+			igfx->redraw = MU_TRUE;
 
-						// Input (rot, col, cen, rad, exp)
-						"in float fRot;"
-						"in vec4 fCol;"
-						"in vec2 fCen;"
-						"in float fRad;"
-						"in float fExp;"
-						// Output (col)
-						"out vec4 oCol;"
+			// Do things based on graphic system
+			switch (igfx->system) {
+				default: return 0; break;
+
+				// OpenGL
+				#ifdef MU_SUPPORT_OPENGL
+					case MU_GRAPHIC_OPENGL: {
+						mugGraphicGL_bind(igfx);
+						return mugGL_object_buffer_create(igfx, (mugGL_Context*)igfx->p, result, type, obj_count, objs, &igfx->damage);
+					} break;
+				#endif
+			}
+
+			// To avoid unused parameter warnings
+			if (context) {} if (result) {} if (type) {} if (obj_count) {} if (objs) {}
+		}
+
+		// Destroys an object buffer
+		MUDEF mugObjects mug_gobjects_destroy(mugContext* context, muGraphic gfx, mugObjects objs) {
+			// Get inner graphic handle
+			mug_Graphic* igfx = (mug_Graphic*)gfx;
+			// Graphic needs to be redrawn
+			igfx->redraw = MU_TRUE;
 
-						// Modifiers
-						"uniform vec4 aC;" // addCol
-						"uniform vec4 mC;" // mulCol
+			// Do things based on graphic system
+			switch (igfx->system) {
+				default: return 0; break;
 
-						// Rotates point (p) around center (c)
-						// Rotation is given by cos (cr) and sin (sr) of rotation
-						"vec2 r(vec2 p,vec2 c,float cr,float sr){"
-							"vec2 o=p-c;"
-							// MATH
-							"return vec2((o.x*cr-o.y*sr)+c.x,(o.x*sr+o.y*cr)+c.y);"
-						"}"
+				// OpenGL
+				#ifdef MU_SUPPORT_OPENGL
+					case MU_GRAPHIC_OPENGL: {
+						return mugGL_object_buffer_destroy((mugGL_ObjBuffer*)objs);
+					} break;
+				#endif
+			}
 
-						// Returns a smooth transition between 0.0 and 1.0
-						// depending on if pixel (p) is outside of squircle
-						// (center c, radius r, exponent e)
-						// Uses this formula:
-						// \max\left(\min\left(-\left(\left(\left|p.x-c.x\right|^{b}+\left|p.y-c.y\right|^{b}\right)^{\frac{1}{b}}-r\right)+0.5,1\right),0\right)
-						// ^ (b is the exponent)
-						"float s(vec2 p,vec2 c,float r,float e){"
-							// Return inverse of:
-							"return 1.0-"
-								"max(min("
-								// Negative if outside, positive if inside
-								// Fades between edge of squircle; automatic anti-aliasing >:)
-								"(pow(pow(abs(p.x-c.x),e)+pow(abs(p.y-c.y),e),1.0/e)-r)+0.5,"
-								// Maximum value of 1
-								"1.0),"
-								// Maximum value of 0
-								"0.0)"
-							";"
-						"}"
+			// To avoid unused parameter warnings
+			if (context) {} if (objs) {}
+		}
 
-						// Main
-						"void main(){"
-							// Calculate color (rotating FragCoord to adjust for rotation)
-							"oCol=vec4(fCol.rgb, fCol.a*s(r(gl_FragCoord.xy,fCen,sin(fRot),cos(fRot)),fCen,fRad,fExp));"
-							// Apply modifiers
-							"oCol=(oCol*mC)+aC;"
-						"}"
-					;
+		MUDEF void mug_gobjects_render(mugContext* context, mugResult* result, muGraphic gfx, mugObjects objs) {
+			// Get inner graphic handle
+			mug_Graphic* igfx = (mug_Graphic*)gfx;
 
-					// Creates program for squircles
-					void mugGL_squircles_shader_load(mug_Graphic* gfx, mugGL_Shader* shader, mugResult* result) {
-						// Exit if shader already compiled
-						if (shader->program) {
-							return;
-						}
+			// Do things based on graphic system
+			switch (igfx->system) {
+				default: break;
 
-						// Compile shader
-						mugResult res = mugGL_shader_create_vf(gfx, shader, mugGL_squircleVS, mugGL_squircleFS);
-						if (res != MUG_SUCCESS) {
-							MU_SET_RESULT(result, res)
+				// OpenGL
+				#ifdef MU_SUPPORT_OPENGL
+					case MU_GRAPHIC_OPENGL: {
+						mugGraphicGL_bind(igfx);
+						mugDraw_flush(igfx, result);
+						muBool zone = mugGL_zone_begin(igfx, mug_gpu_zone_object_name(((mugGL_ObjBuffer*)objs)->obj_type));
+						mugGL_object_buffer_render((mugGL_Context*)igfx->p, (mugGL_ObjBuffer*)objs);
+						if (zone) {
+							mugGL_zone_end(igfx);
 						}
-					}
+					} break;
+				#endif
+			}
 
-				/* Buffer */
+			// To avoid unused parameter warnings
+			return; if (context) {} if (result) {} if (objs) {}
+		}
 
-					// Fills a particular vertex given what to multiply radius by
-					// (Used to alternate between 4 corners)
-					// Returns new v pointer after this vertex
-					static inline GLfloat* mugGL_squircles_fill_invertexes(
-						// Squircle data
-						GLfloat* v, mugSquircle* squircle,
-						// Radius data
-						float vradx, float vrady,
-						// Rotation data
-						float srot, float crot
-					) {
-						// vec3 pos
-						// - x and y (rotated)
-						mugMath_rot_point_point(
-							squircle->center.pos[0]+(squircle->radius*vradx), // Point x
-							squircle->center.pos[1]+(squircle->radius*vrady), // Point y
-							squircle->center.pos[0], // Center x
-							squircle->center.pos[1], // Center y
-							srot, crot, // Sin / Cos rotation
-							v
-						);
-						// - z
-						v[2] = squircle->center.pos[2];
-						v += 3;
+		MUDEF void mug_gobjects_subrender(mugContext* context, mugResult* result, muGraphic gfx, mugObjects objs, uint32_m offset, uint32_m count) {
+			// Get inner graphic handle
+			mug_Graphic* igfx = (mug_Graphic*)gfx;
 
-						// vec4 col
-						mu_memcpy(v, squircle->center.col, 16);
-						// float rot
-						v[4] = squircle->rot;
-						// vec2 cen
-						mu_memcpy(v+5, squircle->center.pos, 8);
-						// float rad
-						v[7] = squircle->radius;
-						// float exp
-						v[8] = squircle->exp;
-						return v+9;
-					}
+			// Do things based on graphic system
+			switch (igfx->system) {
+				default: break;
 
-					// Fills vertex data
-					void mugGL_squircles_fill_vertexes(GLfloat* v, void* obj, uint32_m c) {
-						// Convert obj to struct array
-						mugSquircle* squircles = (mugSquircle*)obj;
+				// OpenGL
+				#ifdef MU_SUPPORT_OPENGL
+					case MU_GRAPHIC_OPENGL: {
+						mugGraphicGL_bind(igfx);
+						mugDraw_flush(igfx, result);
+						muBool zone = mugGL_zone_begin(igfx, mug_gpu_zone_object_name(((mugGL_ObjBuffer*)objs)->obj_type));
+						mugGL_object_buffer_subrender((mugGL_Context*)igfx->p, (mugGL_ObjBuffer*)objs, offset, count);
+						if (zone) {
+							mugGL_zone_end(igfx);
+						}
+					} break;
+				#endif
+			}
 
-						// Loop through each squircle
-						for (uint32_m i = 0; i < c; ++i) {
-							// Calculate rotation values
-							// Sin is negative because y-direction is flipped in mug coordinates
-							float srot = -mu_sinf(squircles->rot);
-							float crot = mu_cosf(squircles->rot);
+			// To avoid unused parameter warnings
+			return; if (context) {} if (result) {} if (objs) {} if (offset) {} if (count) {}
+		}
 
-							// Top-left
-							v = mugGL_squircles_fill_invertexes(v, squircles,  -1.f, -1.f, srot, crot);
-							// Bottom-left
-							v = mugGL_squircles_fill_invertexes(v, squircles,  -1.f,  1.f, srot, crot);
-							// Bottom-right
-							v = mugGL_squircles_fill_invertexes(v, squircles,   1.f,  1.f, srot, crot);
-							// Top-right
-							v = mugGL_squircles_fill_invertexes(v, squircles++, 1.f, -1.f, srot, crot);
+		MUDEF void mug_gobjects_index(mugContext* context, mugResult* result, muGraphic gfx, mugObjects objs, float cell_size) {
+			// Get inner graphic handle
+			mug_Graphic* igfx = (mug_Graphic*)gfx;
+
+			// Do things based on graphic system
+			switch (igfx->system) {
+				default: break;
+
+				// OpenGL
+				#ifdef MU_SUPPORT_OPENGL
+					case MU_GRAPHIC_OPENGL: {
+						mugGraphicGL_bind(igfx);
+						mugResult res = mugGL_objects_index((mugGL_ObjBuffer*)objs, cell_size);
+						if (res != MUG_SUCCESS) {
+							MU_SET_RESULT(result, res)
 						}
-					}
+					} break;
+				#endif
+			}
 
-					// Fill index data (same as rect)
-					#define mugGL_squircles_fill_indexes mugGL_rects_fill_indexes
+			// To avoid unused parameter warnings
+			return; if (context) {} if (result) {} if (objs) {} if (cell_size) {}
+		}
 
-					// Describes squircle data
-					void mugGL_squircles_desc(void) {
-						// vec3 pos
-						glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 48, 0);
-						glEnableVertexAttribArray(0);
-						// vec4 col
-						glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, 48, (void*)(12));
-						glEnableVertexAttribArray(1);
-						// float rot
-						glVertexAttribPointer(2, 1, GL_FLOAT, GL_FALSE, 48, (void*)(28));
-						glEnableVertexAttribArray(2);
-						// vec2 cen
-						glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, 48, (void*)(32));
-						glEnableVertexAttribArray(3);
-						// float rad
-						glVertexAttribPointer(4, 1, GL_FLOAT, GL_FALSE, 48, (void*)(40));
-						glEnableVertexAttribArray(4);
-						// float exp
-						glVertexAttribPointer(5, 1, GL_FLOAT, GL_FALSE, 48, (void*)(44));
-						glEnableVertexAttribArray(5);
-					}
+		MUDEF void mug_gobjects_render_visible(mugContext* context, mugResult* result, muGraphic gfx, mugObjects objs, float* view_rect) {
+			// Get inner graphic handle
+			mug_Graphic* igfx = (mug_Graphic*)gfx;
 
-					// Renders squircles (same as rect)
-					#define mugGL_squircles_render mugGL_rects_render
-					// Subrenders squircles (same as rect)
-					#define mugGL_squircles_subrender mugGL_rects_subrender
+			// Do things based on graphic system
+			switch (igfx->system) {
+				default: break;
 
-					// Fills buffer with needed info
-					void mugGL_squircles_fill(mugGL_ObjBuffer* buf) {
-						buf->obj_type = MUG_OBJECT_SQUIRCLE;
+				// OpenGL
+				#ifdef MU_SUPPORT_OPENGL
+					case MU_GRAPHIC_OPENGL: {
+						mugGraphicGL_bind(igfx);
+						mugDraw_flush(igfx, result);
+						muBool zone = mugGL_zone_begin(igfx, mug_gpu_zone_object_name(((mugGL_ObjBuffer*)objs)->obj_type));
+						mugGL_object_buffer_render_visible(igfx, (mugGL_Context*)igfx->p, result, (mugGL_ObjBuffer*)objs, view_rect);
+						if (zone) {
+							mugGL_zone_end(igfx);
+						}
+					} break;
+				#endif
+			}
 
-						// Amount of bytes used on vertex per object:
-						// one vertex = vec3+vec4+float+vec2+float+float (48)
-						// one squircle = four vertexes (192)
-						buf->bv_per_obj = 192;
+			// To avoid unused parameter warnings
+			return; if (context) {} if (result) {} if (objs) {} if (view_rect) {}
+		}
 
-						// Amount of bytes used on index per object:
-						// one squircle = six indexes (24)
-						buf->bi_per_obj = 24;
+		MUDEF uint32_m mug_gobjects_pick(mugContext* context, mugResult* result, muGraphic gfx, mugObjects objs, float x, float y, uint32_m* indexes, uint32_m max) {
+			// Get inner graphic handle
+			mug_Graphic* igfx = (mug_Graphic*)gfx;
 
-						// Function equivalents
-						buf->fill_vertexes = mugGL_squircles_fill_vertexes;
-						buf->fill_indexes = mugGL_squircles_fill_indexes;
-						buf->desc = mugGL_squircles_desc;
-						buf->render = mugGL_squircles_render;
-						buf->subrender = mugGL_squircles_subrender;
-					}
+			// Do things based on graphic system
+			switch (igfx->system) {
+				default: return 0; break;
 
-			/* Round rect */
+				// OpenGL
+				#ifdef MU_SUPPORT_OPENGL
+					case MU_GRAPHIC_OPENGL: {
+						float area[4] = { x, y, x, y };
+						return mugGL_object_buffer_pick(igfx, result, (mugGL_ObjBuffer*)objs, area, MU_TRUE, indexes, max);
+					} break;
+				#endif
+			}
 
-				// Data format: { vec3 pos, vec4 col, float rot, vec2 cen, vec2 dim, float rad }
-				// * dim is actually half-dimensions
-				// Indexed data: { 0, 1, 3, 1, 2, 3 }
+			// To avoid unused parameter warnings
+			if (context) {} if (result) {} if (objs) {} if (x) {} if (y) {} if (indexes) {} if (max) {}
+		}
 
-				/* Shaders */
+		MUDEF uint32_m mug_gobjects_pick_rect(mugContext* context, mugResult* result, muGraphic gfx, mugObjects objs, float* rect, uint32_m* indexes, uint32_m max) {
+			// Get inner graphic handle
+			mug_Graphic* igfx = (mug_Graphic*)gfx;
+
+			// Do things based on graphic system
+			switch (igfx->system) {
+				default: return 0; break;
 
-					// Vertex shader
-					const char* mugGL_roundrectVS = 
-						// Version
-						"#version 330 core\n"
+				// OpenGL
+				#ifdef MU_SUPPORT_OPENGL
+					case MU_GRAPHIC_OPENGL: {
+						float area[4] = { rect[0], rect[1], rect[0]+rect[2], rect[1]+rect[3] };
+						return mugGL_object_buffer_pick(igfx, result, (mugGL_ObjBuffer*)objs, area, MU_FALSE, indexes, max);
+					} break;
+				#endif
+			}
 
-						// Input ( pos, col, rot, cen, dim, rad )
-						"layout(location=0)in vec3 vPos;"
-						"layout(location=1)in vec4 vCol;"
-						"layout(location=2)in float vRot;"
-						"layout(location=3)in vec2 vCen;"
-						"layout(location=4)in vec2 vDim;"
-						"layout(location=5)in float vRad;"
+			// To avoid unused parameter warnings
+			if (context) {} if (result) {} if (objs) {} if (rect) {} if (indexes) {} if (max) {}
+		}
 
-						// Output (col, rot, cen, dim, rad)
-						"out vec4 fCol;"
-						"out float fRot;"
-						"out vec2 fCen;"
-						"out vec2 fDim;"
-						"out float fRad;"
+		MUDEF void mug_gobjects_fill(mugContext* context, mugResult* result, muGraphic gfx, mugObjects objs, void* data) {
+			// Get inner graphic handle
+			mug_Graphic* igfx = (mug_Graphic*)gfx;
+			// Graphic needs to be redrawn
+			igfx->redraw = MU_TRUE;
 
-						// Dimensions of graphic divided by 2
-						"uniform vec2 d;"
-						// Modifiers
-						"uniform vec3 aP;" // addPos
-						"uniform vec3 mP;" // mulPos
+			// Do things based on graphic system
+			switch (igfx->system) {
+				default: break;
 
-						// Main
-						"void main(){"
-							// Set position
-							"gl_Position=vec4("
-								// X
-								"(((vPos.x*mP.x)+aP.x)-(d.x))/d.x,"
-								// Y
-								"-(((vPos.y*mP.y)+aP.y)-(d.y))/d.y,"
-								// Z
-								"(vPos.z*mP.z)+aP.z,"
-								// W
-								"1.0"
-							");"
+				// OpenGL
+				#ifdef MU_SUPPORT_OPENGL
+					case MU_GRAPHIC_OPENGL: {
+						mugResult res = mugGL_objects_fill((mugGL_ObjBuffer*)objs, data);
+						if (res != MUG_SUCCESS) {
+							MU_SET_RESULT(result, res)
+						}
+					} break;
+				#endif
+			}
 
-							// Transfer data to fragment
-							"fCol=vCol;"
-							"fRot=vRot;"
-							// (Flip y because fragcoord is bottom-left origin)
-							"fCen=vec2((vCen.x*mP.x)+aP.x,(d.y*2.0)-((vCen.y*mP.y)+aP.y));"
-							"fDim=vDim;"
-							"fRad=vRad;"
-						"}"
-					;
+			// To avoid unused parameter warnings
+			return; if (context) {} if (result) {} if (objs) {} if (data) {}
+		}
 
-					// Fragment shader
-					const char* mugGL_roundrectFS =
-						// Version
-						"#version 330 core\n"
+		MUDEF void mug_gobjects_subfill(mugContext* context, mugResult* result, muGraphic gfx, mugObjects objs, uint32_m offset, uint32_m count, void* data) {
+			// Get inner graphic handle
+			mug_Graphic* igfx = (mug_Graphic*)gfx;
+			// Graphic needs to be redrawn
+			igfx->redraw = MU_TRUE;
 
-						// Input (col, rot, cen, dim, rad)
-						"in vec4 fCol;"
-						"in float fRot;"
-						"in vec2 fCen;"
-						"in vec2 fDim;"
-						"in float fRad;"
-						// Output (col)
-						"out vec4 oCol;"
+			// Do things based on graphic system
+			switch (igfx->system) {
+				default: break;
 
-						// Modifiers
-						"uniform vec4 aC;" // addCol
-						"uniform vec4 mC;" // mulCol
+				// OpenGL
+				#ifdef MU_SUPPORT_OPENGL
+					case MU_GRAPHIC_OPENGL: {
+						mugGraphicGL_bind(igfx);
+						mugResult res = mugGL_objects_subfill((mugGL_ObjBuffer*)objs, offset, count, data);
+						if (res != MUG_SUCCESS) {
+							MU_SET_RESULT(result, res)
+						}
+					} break;
+				#endif
+			}
 
-						// Rotates point (p) around center (c)
-						// Rotation is given by cos (cr) and sin(sr) of rotation
-						"vec2 r(vec2 p,vec2 c,float cr,float sr){"
-							"vec2 o=p-c;"
-							// MATH
-							"return vec2((o.x*cr-o.y*sr)+c.x,(o.x*sr+o.y*cr)+c.y);"
-						"}"
+			// To avoid unused parameter warnings
+			return; if (context) {} if (result) {} if (objs) {} if (offset) {} if (count) {} if (data) {}
+		}
 
-						// Main
-						"void main(){"
-							// Calculate pixel based on rotation of FragCoord
-							"vec2 p=r(gl_FragCoord.xy,fCen,sin(fRot),cos(fRot));"
-							// Calculate absolute distance from center
-							"vec2 j=vec2(abs(p.x-fCen.x),abs(p.y-fCen.y));"
-							// Calculate alpha multiplier:
-							"float a="
-								// If we're inside of rectangle's bounding box:
-								// - \left|x-p.x\right|\le w_{0}\left\{\left|y-p.y\right|\le h_{0}-r\right\}
-								// - \left|y-p.y\right|\le h_{0}\left\{\left|x-p.x\right|\le w_{0}-r\right\}
-								"((j.x<=fDim.x && j.y<=fDim.y-fRad) || (j.y<=fDim.y && j.x<+fDim.x-fRad))?"
-									// If these checks passed, we're in the rectangle; just set to 1.0
-									"1.0:"
-								// If it didn't succeed, we're in a circle corner
-								// In this case, we use the magical equation to return a smooth transition
-								// between in and out of the corner (automatic AA)
-								// - \max\left(\min\left(-\left(\sqrt{\left|\left|j.x-p.x\right|-w_{0}+r\right|^{2}+\left|\left|j.y-p.y\right|-h_{0}+r\right|^{2}}-r\right)+0.5,1\right),0\right)
-								"max(min(-(sqrt(pow(abs(j.x-fDim.x+fRad),2.0)+pow(abs(j.y-fDim.y+fRad),2.0))-fRad)+0.5,1.0),0.0)"
-							";"
-							// Calculate color
-							"oCol=vec4(fCol.rgb,fCol.a*a);"
-							// Apply modifiers
-							"oCol=(oCol*mC)+aC;"
-						"}"
-					;
+		MUDEF void mug_gobjects_resize(mugContext* context, mugResult* result, muGraphic gfx, mugObjects objs, uint32_m obj_count, void* data) {
+			// Get inner graphic handle
+			mug_Graphic* igfx = (mug_Graphic*)gfx;
+			// Graphic needs to be redrawn
+			igfx->redraw = MU_TRUE;
 
-					// Creates program for round rects
-					void mugGL_roundrects_shader_load(mug_Graphic* gfx, mugGL_Shader* shader, mugResult* result) {
-						// Exit if shader already compiled
-						if (shader->program) {
-							return;
-						}
+			// Do things based on graphic system
+			switch (igfx->system) {
+				default: break;
 
-						// Compile shader
-						mugResult res = mugGL_shader_create_vf(gfx, shader, mugGL_roundrectVS, mugGL_roundrectFS);
+				// OpenGL
+				#ifdef MU_SUPPORT_OPENGL
+					case MU_GRAPHIC_OPENGL: {
+						mugGraphicGL_bind(igfx);
+						mugResult res = mugGL_objects_resize((mugGL_ObjBuffer*)objs, obj_count, data);
 						if (res != MUG_SUCCESS) {
 							MU_SET_RESULT(result, res)
 						}
-					}
+					} break;
+				#endif
+			}
 
-				/* Buffer */
+			// To avoid unused parameter warnings
+			return; if (context) {} if (result) {} if (objs) {} if (obj_count) {} if (data) {}
+		}
 
-					// Fills a particular vertex given what to multiply dimensions by
-					// (Used to alternate between 4 corners)
-					// Returns new v pointer after this vertex
-					static inline GLfloat* mugGL_roundrects_fill_invertexes(
-						// Round rect data
-						GLfloat* v, mugRoundRect* roundrect,
-						// Dimension data
-						float hdim[2], float vdim0, float vdim1,
-						// Rotation data
-						float srot, float crot
-					) {
-						// vec3 pos
-						// - x and y (rotated)
-						mugMath_rot_point_point(
-							roundrect->center.pos[0]+(hdim[0]*vdim0), // Point x
-							roundrect->center.pos[1]+(hdim[1]*vdim1), // Point y
-							roundrect->center.pos[0], // Center x
-							roundrect->center.pos[1], // Center y
-							srot, crot, // Sin / Cos rotation
-							v
-						);
-						// - z
-						v[2] = roundrect->center.pos[2];
+		MUDEF void mug_gobjects_texture(mugContext* context, muGraphic gfx, mugObjects obj, mugTexture tex) {
+			// Get inner graphic handle
+			mug_Graphic* igfx = (mug_Graphic*)gfx;
+			// Graphic needs to be redrawn
+			igfx->redraw = MU_TRUE;
 
-						// vec4 col
-						mu_memcpy(&v[3], roundrect->center.col, 16);
-						// float rot
-						v[7] = roundrect->rot;
-						// vec2 cen
-						mu_memcpy(&v[8], roundrect->center.pos, 8);
-						// vec2 dim
-						mu_memcpy(&v[10], hdim, 8);
-						// float rad
-						v[12] = roundrect->radius;
+			// Do things based on graphic system
+			switch (igfx->system) {
+				default: break;
 
-						return v+13;
-					}
+				// OpenGL
+				#ifdef MU_SUPPORT_OPENGL
+					case MU_GRAPHIC_OPENGL: {
+						mugGraphicGL_bind(igfx);
+						mugGL_objects_texture((mugGL_ObjBuffer*)obj, (mugGL_Texture*)tex);
+						mugGL_objects_damage_all((mugGL_ObjBuffer*)obj);
+					} break;
+				#endif
+			}
 
-					// Fills vertex data
-					void mugGL_roundrects_fill_vertexes(GLfloat* v, void* obj, uint32_m c) {
-						// Convert obj to struct array
-						mugRoundRect* roundrects = (mugRoundRect*)obj;
+			// To avoid unused parameter warnings
+			return; if (context) {} if (obj) {} if (tex) {}
+		}
 
-						// Loop through each round rect
-						for (uint32_m i = 0; i < c; ++i) {
-							// Calculate rotation values
-							// Sin is negative because y-direction is flipped in mug coordinates
-							float srot = -mu_sinf(roundrects->rot);
-							float crot =  mu_cosf(roundrects->rot);
-							// Calculate half-dimensions
-							float hdim[2] = { roundrects->dim[0]/2.f, roundrects->dim[1]/2.f };
+	/* Immediate drawing stuff */
 
-							// Top-left
-							v = mugGL_roundrects_fill_invertexes(v, roundrects,   hdim, -1.f, -1.f, srot, crot);
-							// Bottom-left
-							v = mugGL_roundrects_fill_invertexes(v, roundrects,   hdim, -1.f,  1.f, srot, crot);
-							// Bottom-right
-							v = mugGL_roundrects_fill_invertexes(v, roundrects,   hdim,  1.f,  1.f, srot, crot);
-							// Top-right
-							v = mugGL_roundrects_fill_invertexes(v, roundrects++, hdim,  1.f, -1.f, srot, crot);
-						}
-					}
+		MUDEF void mug_draw_rect(mugContext* context, mugResult* result, muGraphic gfx, mugRect* rect) {
+			mugDraw_object((mug_Graphic*)gfx, result, MUG_OBJECT_RECT, 0, rect, sizeof(mugRect));
+			// To avoid unused parameter warnings
+			return; if (context) {}
+		}
 
-					// Fill index data (same as rect)
-					#define mugGL_roundrects_fill_indexes mugGL_rects_fill_indexes
+		MUDEF void mug_draw_circle(mugContext* context, mugResult* result, muGraphic gfx, mugCircle* circle) {
+			mugDraw_object((mug_Graphic*)gfx, result, MUG_OBJECT_CIRCLE, 0, circle, sizeof(mugCircle));
+			// To avoid unused parameter warnings
+			return; if (context) {}
+		}
+
+		MUDEF void mug_draw_round_rect(mugContext* context, mugResult* result, muGraphic gfx, mugRoundRect* round_rect) {
+			mugDraw_object((mug_Graphic*)gfx, result, MUG_OBJECT_ROUND_RECT, 0, round_rect, sizeof(mugRoundRect));
+			// To avoid unused parameter warnings
+			return; if (context) {}
+		}
+
+		MUDEF void mug_draw_texture_rect(mugContext* context, mugResult* result, muGraphic gfx, mugTexture tex, mug2DTextureRect* rect) {
+			mugDraw_object((mug_Graphic*)gfx, result, MUG_OBJECT_TEXTURE_2D, tex, rect, sizeof(mug2DTextureRect));
+			// To avoid unused parameter warnings
+			return; if (context) {}
+		}
+
+		MUDEF void mug_draw_flush(mugContext* context, mugResult* result, muGraphic gfx) {
+			mugDraw_flush((mug_Graphic*)gfx, result);
+			// To avoid unused parameter warnings
+			return; if (context) {}
+		}
+
+	/* Scene stuff */
+
+		// Returns the size of an object type's struct (0 if unknown)
+		size_m mugScene_object_size(mugObjectType type) {
+			switch (type) {
+				default: return 0; break;
+				case MUG_OBJECT_POINT: return sizeof(mugPoint); break;
+				case MUG_OBJECT_LINE: return sizeof(mugLine); break;
+				case MUG_OBJECT_TRIANGLE: return sizeof(mugTriangle); break;
+				case MUG_OBJECT_RECT: return sizeof(mugRect); break;
+				case MUG_OBJECT_CIRCLE: return sizeof(mugCircle); break;
+				case MUG_OBJECT_SQUIRCLE: return sizeof(mugSquircle); break;
+				case MUG_OBJECT_ROUND_RECT: return sizeof(mugRoundRect); break;
+				case MUG_OBJECT_TEXTURE_2D: return sizeof(mug2DTextureRect); break;
+				case MUG_OBJECT_TEXTURE_2D_ARRAY: return sizeof(mug2DTextureArrayRect); break;
+			}
+		}
 
-					// Describes round rect data
-					void mugGL_roundrects_desc(void) {
-						// vec3 pos
-						glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 52, 0);
-						glEnableVertexAttribArray(0);
-						// vec4 col
-						glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, 52, (void*)(12));
-						glEnableVertexAttribArray(1);
-						// float rot
-						glVertexAttribPointer(2, 1, GL_FLOAT, GL_FALSE, 52, (void*)(28));
-						glEnableVertexAttribArray(2);
-						// vec2 cen
-						glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, 52, (void*)(32));
-						glEnableVertexAttribArray(3);
-						// vec2 dim
-						glVertexAttribPointer(4, 2, GL_FLOAT, GL_FALSE, 52, (void*)(40));
-						glEnableVertexAttribArray(4);
-						// float rad
-						glVertexAttribPointer(5, 1, GL_FLOAT, GL_FALSE, 52, (void*)(48));
-						glEnableVertexAttribArray(5);
-					}
+		// Objects of one type within a scene
+		struct mug_SceneLayer {
+			// Object buffer (0 if not yet created)
+			mugObjects buf;
+			// Texture of object buffer
+			mugTexture tex;
+			// Copy of objects (zeroed past count)
+			muByte* objs;
+			// Slot of each object
+			uint32_m* slots;
+			// Whether or not each object is in the dirty list
+			muBool* dirty_flags;
+			// Dirty list; indexes of objects that need to be uploaded
+			uint32_m* dirty;
+			// Length of dirty list
+			uint32_m dirty_count;
+			// Amount of objects
+			uint32_m count;
+			// Amount of objects allocated (and size of object buffer)
+			uint32_m cap;
+			// Whether or not the object buffer needs to be resized to cap
+			muBool resized;
+		};
+		typedef struct mug_SceneLayer mug_SceneLayer;
+
+		// Slot referred to by a handle
+		struct mug_SceneSlot {
+			// Generation; incremented each time the slot is freed
+			uint32_m generation;
+			// Object type (0 if slot is free)
+			mugObjectType type;
+			// Index of object within layer (or next free slot if slot is free)
+			uint32_m index;
+		};
+		typedef struct mug_SceneSlot mug_SceneSlot;
+
+		// Struct representing a scene
+		struct mug_Scene {
+			// Layers (indexed by object type)
+			mug_SceneLayer layers[MUG_OBJECT_LAST+1];
+			// Slots
+			mug_SceneSlot* slots;
+			// Amount of slots
+			uint32_m slot_count;
+			// Amount of slots allocated
+			uint32_m slot_cap;
+			// First free slot (MUG_SCENE_NO_SLOT if none)
+			uint32_m free_slot;
+		};
+		typedef struct mug_Scene mug_Scene;
 
-					// Renders round rects (same as rect)
-					#define mugGL_roundrects_render mugGL_rects_render
-					// Subrenders round rects (same as rect)
-					#define mugGL_roundrects_subrender mugGL_rects_subrender
+		// No free slot
+		#define MUG_SCENE_NO_SLOT 0xFFFFFFFF
 
-					// Fills buffer with needed info
-					void mugGL_roundrects_fill(mugGL_ObjBuffer* buf) {
-						buf->obj_type = MUG_OBJECT_ROUND_RECT;
+		// Gets the slot referred to by a handle; returns 0 if handle is invalid
+		mug_SceneSlot* mugScene_slot(mug_Scene* scene, mugSceneObject obj) {
+			uint32_m slot = (uint32_m)(obj & 0xFFFFFFFF);
+			uint32_m generation = (uint32_m)(obj >> 32);
+			// Slots are stored as + 1 so that 0 is never valid
+			if (slot == 0 || slot > scene->slot_count) {
+				return 0;
+			}
+			slot -= 1;
+			// Check if slot is used and matches generation
+			if (!scene->slots[slot].type || scene->slots[slot].generation != generation) {
+				return 0;
+			}
+			return &scene->slots[slot];
+		}
 
-						// Amount of bytes used on vertex per object:
-						// one vertex = vec3+vec4+float+vec2+vec2+float (52)
-						// one round rect = four vertexes (208)
-						buf->bv_per_obj = 208;
+		// Marks an object as dirty
+		void mugScene_mark(mug_SceneLayer* layer, uint32_m index) {
+			if (!layer->dirty_flags[index]) {
+				layer->dirty_flags[index] = MU_TRUE;
+				layer->dirty[layer->dirty_count++] = index;
+			}
+		}
 
-						// Amount of bytes used on index per object:
-						// one round rect = six indexes (24)
-						buf->bi_per_obj = 24;
+		// Ensures that a layer can hold one more object
+		mugResult mugScene_layer_reserve(mug_SceneLayer* layer, size_m obj_size) {
+			// Exit if enough space
+			if (layer->count < layer->cap) {
+				return MUG_SUCCESS;
+			}
 
-						// Function equivalents
-						buf->fill_vertexes = mugGL_roundrects_fill_vertexes;
-						buf->fill_indexes = mugGL_roundrects_fill_indexes;
-						buf->desc = mugGL_roundrects_desc;
-						buf->render = mugGL_roundrects_render;
-						buf->subrender = mugGL_roundrects_subrender;
-					}
+			// Calculate new capacity
+			uint32_m cap = (layer->cap) ? (layer->cap*2) : (64);
 
-			/* 2D texture */
+			// Reallocate arrays
+			muByte* objs = (muByte*)mug_realloc(layer->objs, cap*obj_size, MUG_ALLOC_GENERAL);
+			if (!objs) {
+				return MUG_FAILED_REALLOC;
+			}
+			layer->objs = objs;
+			uint32_m* slots = (uint32_m*)mug_realloc(layer->slots, cap*sizeof(uint32_m), MUG_ALLOC_GENERAL);
+			if (!slots) {
+				return MUG_FAILED_REALLOC;
+			}
+			layer->slots = slots;
+			muBool* dirty_flags = (muBool*)mug_realloc(layer->dirty_flags, cap*sizeof(muBool), MUG_ALLOC_GENERAL);
+			if (!dirty_flags) {
+				return MUG_FAILED_REALLOC;
+			}
+			layer->dirty_flags = dirty_flags;
+			uint32_m* dirty = (uint32_m*)mug_realloc(layer->dirty, cap*sizeof(uint32_m), MUG_ALLOC_GENERAL);
+			if (!dirty) {
+				return MUG_FAILED_REALLOC;
+			}
+			layer->dirty = dirty;
 
-				// Data format: { vec3 pos, vec4 col, vec2 tex }
-				// Indexed data: { 0, 1, 3, 1, 2, 3 }
+			// Zero-out new memory
+			mu_memset(&layer->objs[layer->cap*obj_size], 0, (cap-layer->cap)*obj_size);
+			mu_memset(&layer->dirty_flags[layer->cap], 0, (cap-layer->cap)*sizeof(muBool));
 
-				/* Shaders */
+			// Set new capacity; buffer needs to be resized
+			layer->cap = cap;
+			layer->resized = MU_TRUE;
+			return MUG_SUCCESS;
+		}
 
-					// Vertex shader
-					const char* mugGL_2DtextureVS = 
-						// Version
-						"#version 330 core\n"
+		// Uploads all dirty objects of a layer
+		void mugScene_layer_upload(mugContext* context, mugResult* result, muGraphic gfx, mug_SceneLayer* layer, mugObjectType type) {
+			size_m obj_size = mugScene_object_size(type);
+
+			// Upload everything if the buffer needs to be created or resized
+			if (layer->resized) {
+				mugResult res = MUG_SUCCESS;
+				if (!layer->buf) {
+					layer->buf = mug_gobjects_create(context, &res, gfx, type, layer->cap, layer->objs);
+					if (layer->buf) {
+						mug_gobjects_texture(context, gfx, layer->buf, layer->tex);
+					}
+				} else {
+					mug_gobjects_resize(context, &res, gfx, layer->buf, layer->cap, layer->objs);
+				}
+				if (res != MUG_SUCCESS) {
+					MU_SET_RESULT(result, res)
+					if (mug_result_is_fatal(res)) {
+						return;
+					}
+				}
+				layer->resized = MU_FALSE;
 
-						// Input { vec3 pos, vec4 col, vec2 tex }
-						"layout(location=0)in vec3 vPos;"
-						"layout(location=1)in vec4 vCol;"
-						"layout(location=2)in vec2 vTex;"
+				// Clear dirty list
+				for (uint32_m i = 0; i < layer->dirty_count; ++i) {
+					layer->dirty_flags[layer->dirty[i]] = MU_FALSE;
+				}
+				layer->dirty_count = 0;
+				return;
+			}
 
-						// Output { vec4 col, vec2 tex }
-						"out vec4 fCol;"
-						"out vec2 fTex;"
+			// Exit if nothing is dirty
+			if (!layer->dirty_count) {
+				return;
+			}
 
-						// Dimensions of graphic divided by 2
-						"uniform vec2 d;"
-						// Modifiers
-						"uniform vec3 aP;" // addPos
-						"uniform vec3 mP;" // mulPos
+			// Clear dirty flags, removing indexes of objects that no longer exist
+			uint32_m dirty_count = 0;
+			for (uint32_m i = 0; i < layer->dirty_count; ++i) {
+				layer->dirty_flags[layer->dirty[i]] = MU_FALSE;
+				if (layer->dirty[i] < layer->count) {
+					layer->dirty[dirty_count++] = layer->dirty[i];
+				}
+			}
+			layer->dirty_count = 0;
+
+			// Sort dirty indexes
+			mu_qsort(layer->dirty, dirty_count, sizeof(uint32_m), mug_compare_index);
+
+			// Upload each run of consecutive dirty objects
+			uint32_m run_start = 0;
+			for (uint32_m i = 1; i <= dirty_count; ++i) {
+				if (i == dirty_count || layer->dirty[i] != layer->dirty[i-1]+1) {
+					uint32_m offset = layer->dirty[run_start];
+					mug_gobjects_subfill(context, result, gfx, layer->buf, offset, i-run_start, &layer->objs[offset*obj_size]);
+					run_start = i;
+				}
+			}
+		}
 
-						// Main
-						"void main(){"
-							// Set position
-							"gl_Position=vec4("
-								// X
-								"(((vPos.x*mP.x)+aP.x)-(d.x))/d.x,"
-								// Y
-								"-(((vPos.y*mP.y)+aP.y)-(d.y))/d.y,"
-								// Z
-								"(vPos.z*mP.z)+aP.z,"
-								// W
-								"1.0"
-							");"
+		MUDEF mugScene mug_scene_create(mugContext* context, mugResult* result, muGraphic gfx) {
+			// Allocate scene
+			mug_Scene* scene = (mug_Scene*)mug_alloc(sizeof(mug_Scene), MUG_ALLOC_GENERAL);
+			if (!scene) {
+				MU_SET_RESULT(result, MUG_FAILED_MALLOC)
+				return 0;
+			}
 
-							// Transfer to fragment
-							"fCol=vCol;"
-							"fTex=vTex;"
-						"}"
-					;
+			// Zero-out scene
+			mu_memset(scene, 0, sizeof(mug_Scene));
+			scene->free_slot = MUG_SCENE_NO_SLOT;
+			return scene;
 
-					// Fragment shader
-					const char* mugGL_2DtextureFS = 
-						// Version
-						"#version 330 core\n"
+			// To avoid unused parameter warnings
+			if (context) {} if (gfx) {}
+		}
 
-						// Input { vec4 col, vec2 tex }
-						"in vec4 fCol;"
-						"in vec2 fTex;"
-						// Output { vec4 col }
-						"out vec4 oCol;"
+		MUDEF mugScene mug_scene_destroy(mugContext* context, muGraphic gfx, mugScene scene) {
+			mug_Scene* iscene = (mug_Scene*)scene;
 
-						// Sampler
-						"uniform sampler2D tex;"
-						// Modifiers
-						"uniform vec4 aC;" // addCol
-						"uniform vec4 mC;" // mulCol
+			// Free each layer
+			for (mugObjectType type = MUG_OBJECT_FIRST; type <= MUG_OBJECT_LAST; ++type) {
+				mug_SceneLayer* layer = &iscene->layers[type];
+				if (layer->buf) {
+					mug_gobjects_destroy(context, gfx, layer->buf);
+				}
+				if (layer->cap) {
+					mug_dealloc(layer->objs, MUG_ALLOC_GENERAL);
+					mug_dealloc(layer->slots, MUG_ALLOC_GENERAL);
+					mug_dealloc(layer->dirty_flags, MUG_ALLOC_GENERAL);
+					mug_dealloc(layer->dirty, MUG_ALLOC_GENERAL);
+				}
+			}
 
-						// Main
-						"void main(){"
-							// Set color
-							"oCol=((fCol*texture(tex,fTex))*mC)+aC;"
-						"}"
-					;
+			// Free slots
+			if (iscene->slots) {
+				mug_dealloc(iscene->slots, MUG_ALLOC_GENERAL);
+			}
 
-					// Creates program for 2D textures
-					void mugGL_2Dtextures_shader_load(mug_Graphic* gfx, mugGL_Shader* shader, mugResult* result) {
-						// Exit if shader already compiled
-						if (shader->program) {
-							return;
-						}
+			// Free scene
+			mug_dealloc(iscene, MUG_ALLOC_GENERAL);
+			return 0;
+		}
 
-						// Compile shader
-						mugResult res = mugGL_shader_create_vf(gfx, shader, mugGL_2DtextureVS, mugGL_2DtextureFS);
-						if (res != MUG_SUCCESS) {
-							MU_SET_RESULT(result, res)
-						}
-					}
+		MUDEF mugSceneObject mug_scene_add(mugContext* context, mugResult* result, muGraphic gfx, mugScene scene, mugObjectType type, void* obj) {
+			mug_Scene* iscene = (mug_Scene*)scene;
+			// Graphic needs to be redrawn
+			((mug_Graphic*)gfx)->redraw = MU_TRUE;
 
-				/* Buffer */
+			// Get object size
+			size_m obj_size = mugScene_object_size(type);
+			if (!obj_size) {
+				MU_SET_RESULT(result, MUG_UNKNOWN_OBJECT_TYPE)
+				return 0;
+			}
 
-					// Fills a particular vertex given what to multiply dimensions by
-					// (Used to alternate between 4 corners)
-					// Returns new v pointer
-					static inline GLfloat* mugGL_2Dtextures_fill_invertexes(
-						// Rect data
-						GLfloat* v, mug2DTextureRect* rect,
-						// Half-dim and vector dim
-						float hdim[2], float vdim0, float vdim1,
-						// Center and half-dim of texture cutout
-						float ctex[2], float htdim[2],
-						// Sin/Cos rotation
-						float srot, float crot
-					) {
-						// vec3 pos
-						// - x and y
-						mugMath_rot_point_point(
-							rect->center.pos[0]+(hdim[0]*vdim0), // Point x
-							rect->center.pos[1]+(hdim[1]*vdim1), // Point y
-							rect->center.pos[0], // Center x
-							rect->center.pos[1], // Center y
-							srot, crot, // Sin/Cos rotation
-							v
-						);
-						// - z
-						v[2] = rect->center.pos[2];
+			// Make room for object
+			mug_SceneLayer* layer = &iscene->layers[type];
+			mugResult res = mugScene_layer_reserve(layer, obj_size);
+			if (res != MUG_SUCCESS) {
+				MU_SET_RESULT(result, res)
+				return 0;
+			}
 
-						// vec4 col
-						mu_memcpy(&v[3], rect->center.col, 16);
-						// vec2 tex
-						v[7] = ctex[0]+(htdim[0]*vdim0);
-						v[8] = ctex[1]+(htdim[1]*vdim1);
-						return v+9;
+			// Get a slot
+			uint32_m slot = iscene->free_slot;
+			// - Reuse free slot if one exists
+			if (slot != MUG_SCENE_NO_SLOT) {
+				iscene->free_slot = iscene->slots[slot].index;
+			}
+			// - Create new slot otherwise
+			else {
+				if (iscene->slot_count == iscene->slot_cap) {
+					uint32_m slot_cap = (iscene->slot_cap) ? (iscene->slot_cap*2) : (64);
+					mug_SceneSlot* slots = (mug_SceneSlot*)mug_realloc(iscene->slots, slot_cap*sizeof(mug_SceneSlot), MUG_ALLOC_GENERAL);
+					if (!slots) {
+						MU_SET_RESULT(result, MUG_FAILED_REALLOC)
+						return 0;
 					}
+					iscene->slots = slots;
+					iscene->slot_cap = slot_cap;
+				}
+				slot = iscene->slot_count++;
+				iscene->slots[slot].generation = 0;
+			}
 
-					// Fills vertex data
-					void mugGL_2Dtextures_fill_vertexes(GLfloat* v, void* obj, uint32_m c) {
-						// Convert obj to struct array
-						mug2DTextureRect* rects = (mug2DTextureRect*)obj;
+			// Add object to end of layer
+			uint32_m index = layer->count++;
+			mu_memcpy(&layer->objs[index*obj_size], obj, obj_size);
+			layer->slots[index] = slot;
+			mugScene_mark(layer, index);
 
-						// Loop through each rect
-						for (uint32_m i = 0; i < c; ++i) {
-							// Store half-dim
-							float hdim[2] = { rects->dim[0]/2.f, rects->dim[1]/2.f };
-							// Store sin/cos of rotation
-							// Sin is negative because y-direction is flipped in mug coordinates
-							float srot = -mu_sinf(rects->rot);
-							float crot = mu_cosf(rects->rot);
-							// Half-texture dim
-							float htdim[2] = { rects->tex_dim[0]/2.f, rects->tex_dim[1]/2.f };
-							// Center of texture cutout
-							float ctex[2] = { rects->tex_pos[0]+htdim[0], rects->tex_pos[1]+htdim[1] };
+			// Fill slot
+			iscene->slots[slot].type = type;
+			iscene->slots[slot].index = index;
 
-							// Top-left
-							v = mugGL_2Dtextures_fill_invertexes(v, rects,   hdim, -1.f, -1.f, ctex, htdim, srot, crot);
-							// Bottom-left
-							v = mugGL_2Dtextures_fill_invertexes(v, rects,   hdim, -1.f,  1.f, ctex, htdim, srot, crot);
-							// Bottom-right
-							v = mugGL_2Dtextures_fill_invertexes(v, rects,   hdim,  1.f,  1.f, ctex, htdim, srot, crot);
-							// Top-right
-							v = mugGL_2Dtextures_fill_invertexes(v, rects++, hdim,  1.f, -1.f, ctex, htdim, srot, crot);
-						}
-					}
+			// Return handle
+			return (((mugSceneObject)iscene->slots[slot].generation) << 32) | (mugSceneObject)(slot+1);
 
-					// Fills index data (same as rect)
-					#define mugGL_2Dtextures_fill_indexes mugGL_rects_fill_indexes
+			// To avoid unused parameter warnings
+			if (context) {} if (gfx) {}
+		}
 
-					// Describes data
-					void mugGL_2Dtextures_desc(void) {
-						// vec3 pos
-						glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 36, 0);
-						glEnableVertexAttribArray(0);
-						// vec4 col
-						glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, 36, (void*)(12));
-						glEnableVertexAttribArray(1);
-						// vec2 tex
-						glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 36, (void*)(28));
-						glEnableVertexAttribArray(2);
-					}
+		MUDEF void mug_scene_update(mugContext* context, mugResult* result, muGraphic gfx, mugScene scene, mugSceneObject obj, void* data) {
+			mug_Scene* iscene = (mug_Scene*)scene;
+			// Graphic needs to be redrawn
+			((mug_Graphic*)gfx)->redraw = MU_TRUE;
 
-					// Renders data (same as rects)
-					#define mugGL_2Dtextures_render mugGL_rects_render
-					// Subrenders data (same as rects)
-					#define mugGL_2Dtextures_subrender mugGL_rects_subrender
+			// Get slot
+			mug_SceneSlot* slot = mugScene_slot(iscene, obj);
+			if (!slot) {
+				MU_SET_RESULT(result, MUG_INVALID_SCENE_OBJECT)
+				return;
+			}
 
-					// Fills buffer with needed info
-					void mugGL_2Dtextures_fill(mugGL_ObjBuffer* buf) {
-						buf->obj_type = MUG_OBJECT_TEXTURE_2D;
+			// Copy object and mark it as dirty
+			mug_SceneLayer* layer = &iscene->layers[slot->type];
+			size_m obj_size = mugScene_object_size(slot->type);
+			mu_memcpy(&layer->objs[slot->index*obj_size], data, obj_size);
+			mugScene_mark(layer, slot->index);
 
-						// Amount of bytes used on vertex per object:
-						// one vertex = vec3+vec4+vec2 (36)
-						// one rect = four vertexes (144)
-						buf->bv_per_obj = 144;
+			// To avoid unused parameter warnings
+			return; if (context) {} if (gfx) {}
+		}
 
-						// Amount of bytes used on index per object:
-						// one rect = six indexes (24)
-						buf->bi_per_obj = 24;
+		MUDEF void mug_scene_remove(mugContext* context, mugResult* result, muGraphic gfx, mugScene scene, mugSceneObject obj) {
+			mug_Scene* iscene = (mug_Scene*)scene;
+			// Graphic needs to be redrawn
+			((mug_Graphic*)gfx)->redraw = MU_TRUE;
+
+			// Get slot
+			mug_SceneSlot* slot = mugScene_slot(iscene, obj);
+			if (!slot) {
+				MU_SET_RESULT(result, MUG_INVALID_SCENE_OBJECT)
+				return;
+			}
+			mug_SceneLayer* layer = &iscene->layers[slot->type];
+			size_m obj_size = mugScene_object_size(slot->type);
+
+			// Move last object into removed object's place
+			uint32_m index = slot->index;
+			uint32_m last = layer->count-1;
+			if (index != last) {
+				mu_memcpy(&layer->objs[index*obj_size], &layer->objs[last*obj_size], obj_size);
+				layer->slots[index] = layer->slots[last];
+				iscene->slots[layer->slots[index]].index = index;
+				mugScene_mark(layer, index);
+			}
+			mu_memset(&layer->objs[last*obj_size], 0, obj_size);
+			layer->count -= 1;
 
-						// Function equivalents
-						buf->fill_vertexes = mugGL_2Dtextures_fill_vertexes;
-						buf->fill_indexes = mugGL_2Dtextures_fill_indexes;
-						buf->desc = mugGL_2Dtextures_desc;
-						buf->render = mugGL_2Dtextures_render;
-						buf->subrender = mugGL_2Dtextures_subrender;
-					}
+			// Free slot
+			slot->generation += 1;
+			slot->type = 0;
+			slot->index = iscene->free_slot;
+			iscene->free_slot = (uint32_m)(slot - iscene->slots);
 
-			/* 2D texture array */
+			// To avoid unused parameter warnings
+			return; if (context) {} if (gfx) {}
+		}
 
-				// Data format: { vec3 pos, vec4 col, vec3 tex }
-				// Indexed data: { 0, 1, 3, 1, 2, 3 }
+		MUDEF void mug_scene_render(mugContext* context, mugResult* result, muGraphic gfx, mugScene scene) {
+			mug_Scene* iscene = (mug_Scene*)scene;
 
-				/* Shaders */
+			// Upload and render each layer
+			for (mugObjectType type = MUG_OBJECT_FIRST; type <= MUG_OBJECT_LAST; ++type) {
+				mug_SceneLayer* layer = &iscene->layers[type];
+				mugScene_layer_upload(context, result, gfx, layer, type);
+				if (layer->buf && layer->count) {
+					mug_gobjects_subrender(context, result, gfx, layer->buf, 0, layer->count);
+				}
+			}
+		}
 
-					// Vertex shader
-					const char* mugGL_2DtexturearrVS = 
-						// Version
-						"#version 330 core\n"
+		MUDEF void mug_scene_texture(mugContext* context, muGraphic gfx, mugScene scene, mugObjectType type, mugTexture tex) {
+			mug_Scene* iscene = (mug_Scene*)scene;
+			// Ignore unknown object types
+			if (type < MUG_OBJECT_FIRST || type > MUG_OBJECT_LAST) {
+				return;
+			}
+			// Graphic needs to be redrawn
+			((mug_Graphic*)gfx)->redraw = MU_TRUE;
 
-						// Input { vec3 pos, vec4 col, vec3 tex }
-						"layout(location=0)in vec3 vPos;"
-						"layout(location=1)in vec4 vCol;"
-						"layout(location=2)in vec3 vTex;"
+			// Set texture of layer, and of its buffer if it exists
+			iscene->layers[type].tex = tex;
+			if (iscene->layers[type].buf) {
+				mug_gobjects_texture(context, gfx, iscene->layers[type].buf, tex);
+			}
+		}
 
-						// Output {vec4 col, vec3 tex }
-						"out vec4 fCol;"
-						"out vec3 fTex;"
+	/* Texture stuff */
 
-						// Dimensions of graphic divided by 2
-						"uniform vec2 d;"
-						// Modifiers
-						"uniform vec3 aP;" // addPos
-						"uniform vec3 mP;" // mulPos
+		MUDEF mugTexture mug_gtexture_create(mugContext* context, mugResult* result, muGraphic gfx, mugTextureInfo* info, uint32_m* dim, muByte* data) {
+			// Get inner graphic handle
+			mug_Graphic* igfx = (mug_Graphic*)gfx;
+			// Graphic needs to be redrawn
+			igfx->redraw = MU_TRUE;
 
-						// Main
-						"void main(){"
-							// Set position
-							"gl_Position=vec4("
-								// X
-								"(((vPos.x*mP.x)+aP.x)-(d.x))/d.x,"
-								// Y
-								"-(((vPos.y*mP.y)+aP.y)-(d.y))/d.y,"
-								// Z
-								"(vPos.z*mP.z)+aP.z,"
-								// W
-								"1.0"
-							");"
+			// Do things based on graphic system
+			switch (igfx->system) {
+				default: return 0; break;
 
-							// Transfer to fragment
-							"fCol=vCol;"
-							"fTex=vTex;"
-						"}"
-					;
+				// OpenGL
+				#ifdef MU_SUPPORT_OPENGL
+					case MU_GRAPHIC_OPENGL: {
+						mugGraphicGL_bind(igfx);
+						mugGL_Context* ic = (mugGL_Context*)igfx->p;
+						return mugGL_texture_create(result, ic->formats, &ic->residency, info, dim, data);
+					} break;
+				#endif
+			}
 
-					// Fragment shader
-					const char* mugGL_2DtexturearrFS = 
-						// Version
-						"#version 330 core\n"
+			// To avoid unused parameter warnings
+			if (context) {} if (result) {} if (info) {} if (dim) {} if (data) {}
+		}
 
-						// Input { vec4 col, vec3 tex }
-						"in vec4 fCol;"
-						"in vec3 fTex;"
-						// Output { vec4 col }
-						"out vec4 oCol;"
+		MUDEF void mug_gtexture_subimage(mugContext* context, mugResult* result, muGraphic gfx, mugTexture tex, uint32_m x, uint32_m y, uint32_m layer, uint32_m w, uint32_m h, uint32_m row_stride, muByte* data) {
+			// Get inner graphic handle
+			mug_Graphic* igfx = (mug_Graphic*)gfx;
+			// Graphic needs to be redrawn wherever the texture is used
+			igfx->redraw = MU_TRUE;
+			mug_damage_full(&igfx->damage);
 
-						// Sampler
-						"uniform sampler2DArray tex;"
-						// Modifiers
-						"uniform vec4 aC;" // addCol
-						"uniform vec4 mC;" // mulCol
+			// Pending immediate draws should use the old pixels
+			mugDraw_flush(igfx, result);
 
-						// Main
-						"void main(){"
-							// Set color
-							"oCol=((fCol*texture(tex, fTex))*mC)+aC;"
-						"}"
-					;
+			// Do things based on graphic system
+			switch (igfx->system) {
+				default: return; break;
 
-					// Creates program for 2D texture arrays
-					void mugGL_2Dtexturearr_shader_load(mug_Graphic* gfx, mugGL_Shader* shader, mugResult* result) {
-						// Exit if shader already compiled
-						if (shader->program) {
+				// OpenGL
+				#ifdef MU_SUPPORT_OPENGL
+					case MU_GRAPHIC_OPENGL: {
+						if (((mugGL_Texture*)tex)->pending) {
+							MU_SET_RESULT(result, MUG_TEXTURE_NOT_LOADED)
 							return;
 						}
+						mugGraphicGL_bind(igfx);
+						mugGL_texture_subimage(result, &((mugGL_Context*)igfx->p)->uploads, (mugGL_Texture*)tex, x, y, layer, w, h, row_stride, data);
+					} break;
+				#endif
+			}
 
-						// Compile shader
-						mugResult res = mugGL_shader_create_vf(gfx, shader, mugGL_2DtexturearrVS, mugGL_2DtexturearrFS);
+			return; if (context) {} if (result) {} if (tex) {} if (x) {} if (y) {} if (layer) {} if (w) {} if (h) {} if (row_stride) {} if (data) {}
+		}
+
+		MUDEF void mug_gtexture_resize_layers(mugContext* context, mugResult* result, muGraphic gfx, mugTexture tex, uint32_m depth) {
+			// Get inner graphic handle
+			mug_Graphic* igfx = (mug_Graphic*)gfx;
+			// Graphic needs to be redrawn wherever the texture is used
+			igfx->redraw = MU_TRUE;
+			mug_damage_full(&igfx->damage);
+
+			// Pending immediate draws should use the old storage
+			mugDraw_flush(igfx, result);
+
+			// Do things based on graphic system
+			switch (igfx->system) {
+				default: return; break;
+
+				// OpenGL
+				#ifdef MU_SUPPORT_OPENGL
+					case MU_GRAPHIC_OPENGL: {
+						mugGraphicGL_bind(igfx);
+						mugResult res = mugGL_texture_resize_layers((mugGL_Texture*)tex, depth);
 						if (res != MUG_SUCCESS) {
 							MU_SET_RESULT(result, res)
 						}
-					}
+					} break;
+				#endif
+			}
 
-				/* Buffer */
+			return; if (context) {} if (result) {} if (tex) {} if (depth) {}
+		}
 
-					// Fills a particular vertex given what to multiply dimensions by
-					// (Used to alternate between 4 corners)
-					// Returns new v pointer
-					// This code is considerably similar to mugGL_2Dtextures_fill_invertexes
-					static inline GLfloat* mugGL_2Dtexturearr_fill_invertexes(
-						// Rect data
-						GLfloat* v, mug2DTextureArrayRect* rect,
-						// Half-dim and vector dim
-						float hdim[2], float vdim0, float vdim1,
-						// Center and half-dim of texture cutout
-						float ctex[2], float htdim[2],
-						// Sin/Cos rotation
-						float srot, float crot
-					) {
-						// vec3 pos
-						// - x and y
-						mugMath_rot_point_point(
-							rect->center.pos[0]+(hdim[0]*vdim0), // Point x
-							rect->center.pos[1]+(hdim[1]*vdim1), // Point y
-							rect->center.pos[0], // Center x
-							rect->center.pos[1], // Center y
-							srot, crot, // Sin/Cos rotation
-							v
-						);
-						// - z
-						v[2] = rect->center.pos[2];
+		MUDEF size_m mug_texture_data_size(mugTextureFormat format, uint32_m w, uint32_m h) {
+			uint32_m bd = mug_texture_format_block(format);
+			return (size_m)((w + bd-1) / bd) * (size_m)((h + bd-1) / bd) * mug_texture_format_size(format);
+		}
 
-						// vec4 col
-						mu_memcpy(&v[3], rect->center.col, 16);
-						// vec3 tex
-						v[7] = ctex[0]+(htdim[0]*vdim0);
-						v[8] = ctex[1]+(htdim[1]*vdim1);
-						v[9] = rect->tex_pos[2];
-						return v+10;
-					}
+		MUDEF void mug_texture_compress(mugContext* context, mugResult* result, mugTextureFormat format, uint32_m w, uint32_m h, uint32_m row_stride, muByte* src, muByte* dst) {
+			// Get source pixel size
+			uint32_m ps;
+			switch (format) {
+				default: MU_SET_RESULT(result, MUG_UNSUPPORTED_TEXTURE_FORMAT) return; break;
+				case MUG_TEXTURE_BC1_RGBA: case MUG_TEXTURE_BC3_RGBA: ps = 4; break;
+				case MUG_TEXTURE_BC4_R: ps = 1; break;
+			}
+			size_m stride = (row_stride) ? (row_stride) : ((size_m)w * ps);
+
+			// Split block rows into bands, one per thread,
+			// only using more than one thread for images of at least 4096 blocks
+			uint32_m block_rows = (h + 3) / 4;
+			size_m row_bytes = mug_texture_data_size(format, w, 4);
+			size_m blocks = (size_m)block_rows * ((w + 3) / 4);
+			uint32_m band_count = (uint32_m)(blocks / 4096);
+			if (band_count > MUG_COMPRESS_THREADS) band_count = MUG_COMPRESS_THREADS;
+			if (band_count > block_rows) band_count = block_rows;
+			if (band_count < 1) band_count = 1;
+			uint32_m band_rows = (block_rows + band_count-1) / band_count;
+
+			mugBC_Band bands[MUG_COMPRESS_THREADS];
+			band_count = 0;
+			for (uint32_m r = 0; r < block_rows; r += band_rows) {
+				mugBC_Band* band = &bands[band_count++];
+				band->format = format;
+				band->ps = ps;
+				band->w = w;
+				band->h = ((r+band_rows)*4 < h) ? (band_rows*4) : (h - r*4);
+				band->stride = stride;
+				band->src = &src[(size_m)r*4*stride];
+				band->dst = &dst[(size_m)r*row_bytes];
+			}
 
-					// Fills vertex data
-					void mugGL_2Dtexturearr_fill_vertexes(GLfloat* v, void* obj, uint32_m c) {
-						// Convert obj to struct array
-						mug2DTextureArrayRect* rects = (mug2DTextureArrayRect*)obj;
+			// Compress every band but the first on its own thread,
+			// falling back to the calling thread if a thread can't be started
+			mug_Thread threads[MUG_COMPRESS_THREADS];
+			muBool started[MUG_COMPRESS_THREADS];
+			for (uint32_m b = 1; b < band_count; ++b) {
+				started[b] = mug_thread_create(&threads[b], mugBC_thread, &bands[b]);
+			}
+			mugBC_band(&bands[0]);
+			for (uint32_m b = 1; b < band_count; ++b) {
+				if (started[b]) {
+					mug_thread_join(threads[b]);
+				} else {
+					mugBC_band(&bands[b]);
+				}
+			}
 
-						// Loop through each rect
-						for (uint32_m i = 0; i < c; ++i) {
-							// Store half-dim
-							float hdim[2] = { rects->dim[0]/2.f, rects->dim[1]/2.f };
-							// Store sin/cos of rotation
-							// Sin is negative because y-direction is flipped in mug coordinates
-							float srot = -mu_sinf(rects->rot);
-							float crot =  mu_cosf(rects->rot);
-							// Half-texture dim
-							float htdim[2] = { rects->tex_dim[0]/2.f, rects->tex_dim[1]/2.f };
-							// Center of texture cutout
-							float ctex[2] = { rects->tex_pos[0]+htdim[0], rects->tex_pos[1]+htdim[1] };
+			return; if (context) {}
+		}
 
-							// Top-left
-							v = mugGL_2Dtexturearr_fill_invertexes(v, rects  , hdim, -1.f, -1.f, ctex, htdim, srot, crot);
-							// Bottom-left
-							v = mugGL_2Dtexturearr_fill_invertexes(v, rects  , hdim, -1.f,  1.f, ctex, htdim, srot, crot);
-							// Bottom-right
-							v = mugGL_2Dtexturearr_fill_invertexes(v, rects  , hdim,  1.f,  1.f, ctex, htdim, srot, crot);
-							// Top-right
-							v = mugGL_2Dtexturearr_fill_invertexes(v, rects++, hdim,  1.f, -1.f, ctex, htdim, srot, crot);
-						}
-					}
+		MUDEF void mug_texture_convert(mugContext* context, mugResult* result, mugTextureFormat src_format, mugTextureFormat dst_format, mugTextureConversion convert, uint32_m w, uint32_m h, uint32_m row_stride, muByte* src, muByte* dst) {
+			// Make sure formats are uncompressed
+			if (src_format > MUG_TEXTURE_U8_RGBA || dst_format > MUG_TEXTURE_U8_RGBA) {
+				MU_SET_RESULT(result, MUG_UNSUPPORTED_TEXTURE_FORMAT)
+				return;
+			}
+			size_m stride = (row_stride) ? (row_stride) : ((size_m)w * mug_texture_format_size(src_format));
+			size_m dst_stride = (size_m)w * mug_texture_format_size(dst_format);
 
-					// Fills index data (same as rect)
-					#define mugGL_2Dtexturearr_fill_indexes mugGL_rects_fill_indexes
+			// Convert each row
+			for (uint32_m r = 0; r < h; ++r) {
+				mugConv_row(&dst[r*dst_stride], dst_format, &src[r*stride], src_format, convert, w);
+			}
 
-					// Describes data
-					void mugGL_2Dtexturearr_desc(void) {
-						// vec3 pos
-						glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 40, 0);
-						glEnableVertexAttribArray(0);
-						// vec4 col
-						glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, 40, (void*)(12));
-						glEnableVertexAttribArray(1);
-						// vec3 tex
-						glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 40, (void*)(28));
-						glEnableVertexAttribArray(2);
-					}
+			return; if (context) {}
+		}
 
-					// Renders data (same as rects)
-					#define mugGL_2Dtexturearr_render mugGL_rects_render
-					// Subrenders data (same as rects)
-					#define mugGL_2Dtexturearr_subrender mugGL_rects_subrender
+		MUDEF void mug_graphic_texture_budget(mugContext* context, muGraphic gfx, size_m budget) {
+			// Get inner graphic handle
+			mug_Graphic* igfx = (mug_Graphic*)gfx;
 
-					// Fills buffer with needed info
-					void mugGL_2Dtexturearr_fill(mugGL_ObjBuffer* buf) {
-						buf->obj_type = MUG_OBJECT_TEXTURE_2D_ARRAY;
+			// Do things based on graphic system
+			switch (igfx->system) {
+				default: return; break;
 
-						// Amount of bytes used on vertex per object:
-						// one vertex = vec3+vec4+vec3 (40)
-						// one rect = four vertexes (160)
-						buf->bv_per_obj = 160;
+				// OpenGL
+				#ifdef MU_SUPPORT_OPENGL
+					case MU_GRAPHIC_OPENGL: {
+						mugGraphicGL_bind(igfx);
+						mugGL_Residency* res = &((mugGL_Context*)igfx->p)->residency;
+						res->budget = budget;
+						mugGL_residency_trim(res);
+					} break;
+				#endif
+			}
 
-						// Amount of bytes used on index per object:
-						// one rect = six indexes (24)
-						buf->bi_per_obj = 24;
+			return; if (context) {} if (budget) {}
+		}
+
+		MUDEF void mug_gtexture_evictable(mugContext* context, mugResult* result, muGraphic gfx, mugTexture tex, mugTextureReload reload, void* user) {
+			// Get inner graphic handle
+			mug_Graphic* igfx = (mug_Graphic*)gfx;
+
+			// Do things based on graphic system
+			switch (igfx->system) {
+				default: return; break;
+
+				// OpenGL
+				#ifdef MU_SUPPORT_OPENGL
+					case MU_GRAPHIC_OPENGL: {
+						mugGraphicGL_bind(igfx);
+						mugResult res = mugGL_texture_evictable((mugGL_Texture*)tex, reload, user);
+						if (res != MUG_SUCCESS) {
+							MU_SET_RESULT(result, res)
+						}
+					} break;
+				#endif
+			}
+
+			return; if (context) {} if (result) {} if (tex) {} if (reload) {} if (user) {}
+		}
 
-						// Function equivalents
-						buf->fill_vertexes = mugGL_2Dtexturearr_fill_vertexes;
-						buf->fill_indexes = mugGL_2Dtexturearr_fill_indexes;
-						buf->desc = mugGL_2Dtexturearr_desc;
-						buf->render = mugGL_2Dtexturearr_render;
-						buf->subrender = mugGL_2Dtexturearr_subrender;
-					}
+		MUDEF void mug_graphic_texture_stats(mugContext* context, muGraphic gfx, mugTextureStats* stats) {
+			// Get inner graphic handle
+			mug_Graphic* igfx = (mug_Graphic*)gfx;
+			mu_memset(stats, 0, sizeof(mugTextureStats));
 
-		/* Context setup */
+			// Do things based on graphic system
+			switch (igfx->system) {
+				default: return; break;
 
-			// Struct for shaders
-			struct mugGL_Shaders {
-				mugGL_Shader point;
-				mugGL_Shader line;
-				mugGL_Shader triangle;
-				mugGL_Shader rect;
-				mugGL_Shader circle;
-				mugGL_Shader squircle;
-				mugGL_Shader roundrect;
-				mugGL_Shader textures2D;
-				mugGL_Shader texturearrays2D;
-			};
-			typedef struct mugGL_Shaders mugGL_Shaders;
+				// OpenGL
+				#ifdef MU_SUPPORT_OPENGL
+					case MU_GRAPHIC_OPENGL: {
+						mugGL_Residency* res = &((mugGL_Context*)igfx->p)->residency;
+						stats->resident_bytes = res->resident;
+						stats->budget = res->budget;
+						stats->evictions = res->evictions;
+						stats->reloads = res->reloads;
+					} break;
+				#endif
+			}
 
-			// Struct for GL context
-			struct mugGL_Context {
-				// Shaders
-				mugGL_Shaders shaders;
-			};
-			typedef struct mugGL_Context mugGL_Context;
+			return; if (context) {}
+		}
 
-			// Pointer to loading context
-			// This is a non-threadsafe solution that requires
-			// no more than one mug context to be created at
-			// one time within the program.
-			muCOSAContext* mugGL_load_func_context;
+		MUDEF mugTexture mug_gtexture_load_async(mugContext* context, mugResult* result, muGraphic gfx, mugImageSource* source, mugTextureInfo* info, mugTextureLoaded callback, void* user) {
+			// Get inner graphic handle
+			mug_Graphic* igfx = (mug_Graphic*)gfx;
 
-			// Finds an OpenGL address
-			void* mugGL_load_func(const char* name) {
-				return muCOSA_gl_get_proc_address(mugGL_load_func_context, name);
+			// Only 2D textures of formats that images can be converted to are supported
+			if (info->type != MUG_TEXTURE_2D || info->format == MUG_TEXTURE_BC7_RGBA) {
+				MU_SET_RESULT(result, MUG_UNSUPPORTED_TEXTURE_FORMAT)
+				return 0;
 			}
 
-			// Loads a valid OpenGL context
-			mugResult mugGL_init_context(mug_Graphic* gfx) {
-				// Allocate inner GL context
-				gfx->p = mu_malloc(sizeof(mugGL_Context));
-				if (!gfx->p) {
-					return MUG_FAILED_MALLOC;
+			// Start loader if needed
+			if (!igfx->loader) {
+				mugResult res = mugLoad_create(&igfx->loader, &igfx->wake);
+				if (res != MUG_SUCCESS) {
+					MU_SET_RESULT(result, res)
+					return 0;
 				}
-				// - Casted handle
-				mugGL_Context* ic = (mugGL_Context*)gfx->p;
+			}
 
-				// Create OpenGL context
-				mugResult res = mugGraphicGL_create(gfx);
-				if (mug_result_is_fatal(res)) {
-					mu_free(gfx->p);
-					return res;
+			// Create job
+			mug_LoadJob* job = (mug_LoadJob*)mu_malloc(sizeof(mug_LoadJob));
+			if (!job) {
+				MU_SET_RESULT(result, MUG_FAILED_MALLOC)
+				return 0;
+			}
+			mu_memset(job, 0, sizeof(mug_LoadJob));
+			// - Source
+			if (source->path) {
+				size_m len = 0;
+				while (source->path[len]) ++len;
+				job->path = (char*)mu_malloc(len+1);
+				if (!job->path) {
+					MU_SET_RESULT(result, MUG_FAILED_MALLOC)
+					mu_free(job);
+					return 0;
 				}
+				mu_memcpy(job->path, source->path, len+1);
+			} else {
+				job->data = source->data;
+				job->size = source->size;
+			}
+			// - Request
+			job->decoder = igfx->decoder;
+			job->decoder_user = igfx->decoder_user;
+			job->info = *info;
+			job->callback = callback;
+			job->user = user;
+			job->result = MUG_SUCCESS;
+
+			// Create placeholder texture
+			switch (igfx->system) {
+				default: break;
 
-				// Bind OpenGL context
-				mugGraphicGL_bind(gfx);
+				// OpenGL
+				#ifdef MU_SUPPORT_OPENGL
+					case MU_GRAPHIC_OPENGL: {
+						mugGL_Context* ic = (mugGL_Context*)igfx->p;
+						job->tex = mugGL_texture_placeholder(result, ic->formats, &ic->residency, info, job);
+					} break;
+				#endif
+			}
+			if (!job->tex) {
+				mugLoad_free_job(job);
+				return 0;
+			}
 
-				// Load OpenGL functions
-				mugGL_load_func_context = &gfx->context->cosa;
-				if (!gladLoadGL((GLADloadfunc)mugGL_load_func)) {
-					mu_free(gfx->p);
-					mugGraphicGL_destroy(gfx);
-					return MUG_GL_FAILED_LOAD;
-				}
+			// Queue to be decoded
+			mugLoad_queue(igfx->loader, job);
+			return job->tex;
 
-				// Enable and set blending
-				glEnable(GL_BLEND);
-				glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-				// Enable depth testing
-				glEnable(GL_DEPTH_TEST);
-				glDepthFunc(GL_GEQUAL);
-				// Set initial viewport
-				glViewport(0, 0, gfx->dim[0], gfx->dim[1]);
+			// To avoid unused parameter warnings
+			if (context) {}
+		}
 
-				// Zero-out necessary struct memory
-				mu_memset(&ic->shaders, 0, sizeof(ic->shaders));
+		MUDEF void mug_graphic_image_decoder(mugContext* context, muGraphic gfx, mugImageDecoder decoder, void* user) {
+			// Get inner graphic handle
+			mug_Graphic* igfx = (mug_Graphic*)gfx;
 
-				return res;
-			}
+			// Set decoder for future loads
+			igfx->decoder = decoder;
+			igfx->decoder_user = user;
 
-			// Deloads a valid OpenGL context
-			void mugGL_term_context(mug_Graphic* gfx) {
-				// Free inner context
-				mu_free(gfx->p);
-				// Destroy OpenGL context
-				mugGraphicGL_destroy(gfx);
-			}
+			return; if (context) {}
+		}
 
-			// Update function; gets called at end of swap buffers
-			void mugGL_update_context(mug_Graphic* gfx) {
-				// ...
-				return; if (gfx) {}
-			}
+		MUDEF mugTexture mug_gtexture_create_from_file(mugContext* context, mugResult* result, muGraphic gfx, const char* path) {
+			// Get inner graphic handle
+			mug_Graphic* igfx = (mug_Graphic*)gfx;
 
-		/* Objects */
+			// Map file
+			mug_FileMap map;
+			if (!mug_file_map(&map, path)) {
+				MU_SET_RESULT(result, MUG_FAILED_ACCESS_FILE)
+				return 0;
+			}
 
-			/* Shader logic */
+			// Parse header
+			mugTextureInfo info;
+			uint32_m dim[3], levels;
+			mugResult res = mug_texture_file_parse(map.data, map.size, &info, dim, &levels);
+			if (res != MUG_SUCCESS) {
+				MU_SET_RESULT(result, res)
+				mug_file_unmap(&map);
+				return 0;
+			}
 
-				// Converts object type to shader pointer
-				mugGL_Shader* mugGL_object_type_to_shader(mugGL_Context* context, mugObjectType type) {
-					switch (type) {
-						default: return 0; break;
-						case MUG_OBJECT_POINT: return &context->shaders.point; break;
-						case MUG_OBJECT_LINE: return &context->shaders.line; break;
-						case MUG_OBJECT_TRIANGLE: return &context->shaders.triangle; break;
-						case MUG_OBJECT_RECT: return &context->shaders.rect; break;
-						case MUG_OBJECT_CIRCLE: return &context->shaders.circle; break;
-						case MUG_OBJECT_SQUIRCLE: return &context->shaders.squircle; break;
-						case MUG_OBJECT_ROUND_RECT: return &context->shaders.roundrect; break;
-						case MUG_OBJECT_TEXTURE_2D: return &context->shaders.textures2D; break;
-						case MUG_OBJECT_TEXTURE_2D_ARRAY: return &context->shaders.texturearrays2D; break;
-					}
-				}
+			// Create texture straight from the mapped pixel data
+			mugTexture tex = 0;
+			switch (igfx->system) {
+				default: break;
 
-				// Converts object type to shader program pointer
-				GLuint* mugGL_object_type_to_program(mugGL_Context* context, mugObjectType type) {
-					// Convert object type to shader pointer
-					mugGL_Shader* shader = mugGL_object_type_to_shader(context, type);
-					// If NULL, shader doesn't exist
-					if (!shader) {
-						return 0;
-					}
-					// Return pointer to shader program if otherwise
-					return &shader->program;
-				}
+				// OpenGL
+				#ifdef MU_SUPPORT_OPENGL
+					case MU_GRAPHIC_OPENGL: {
+						mugGraphicGL_bind(igfx);
+						mugGL_Context* ic = (mugGL_Context*)igfx->p;
+						tex = mugGL_texture_create_levels(result, ic->formats, &ic->residency, &ic->uploads, &info, dim, levels, &map.data[MUG_TEXTURE_FILE_HEADER_SIZE]);
+					} break;
+				#endif
+			}
 
-				// Updates dimensions shaders for each active shader program
-				void mugGL_update_dimensions(mugGL_Context* context, uint32_m dim[2]) {
-					// Holder variables
-					GLuint* program;
-					float fdim[2] = { ((float)dim[0]) / 2.f, ((float)dim[1]) / 2.f };
+			mug_file_unmap(&map);
+			return tex;
 
-					// Loop through each valid object type enum
-					for (mugObjectType objtype = MUG_OBJECT_FIRST; objtype <= MUG_OBJECT_LAST; ++objtype) {
-						// Find program ID
-						program = mugGL_object_type_to_program(context, objtype);
-						// If program ID exists, update dimensions uniform
-						if (program && *program) {
-							glUseProgram(*program);
-							glUniform2f(glGetUniformLocation(*program, "d"), fdim[0], fdim[1]);
-							glUseProgram(0);
-						}
-					}
-				}
+			// To avoid unused parameter warnings
+			if (context) {}
+		}
 
-				// Loads a given object type
-				void mugGL_load_object_type(mug_Graphic* gfx, mugGL_Context* context, mugResult* result, mugObjectType type) {
-					// Call function based on object type
-					switch (type) {
-						default: MU_SET_RESULT(result, MUG_UNKNOWN_OBJECT_TYPE) break;
-						case MUG_OBJECT_POINT: mugGL_points_shader_load(gfx, &context->shaders.point, result); break;
-						case MUG_OBJECT_LINE: mugGL_lines_shader_load(gfx, &context->shaders.line, result); break;
-						case MUG_OBJECT_TRIANGLE: mugGL_triangles_shader_load(gfx, &context->shaders.triangle, result); break;
-						case MUG_OBJECT_RECT: mugGL_rects_shader_load(gfx, &context->shaders.rect, result); break;
-						case MUG_OBJECT_CIRCLE: mugGL_circles_shader_load(gfx, &context->shaders.circle, result); break;
-						case MUG_OBJECT_SQUIRCLE: mugGL_squircles_shader_load(gfx, &context->shaders.squircle, result); break;
-						case MUG_OBJECT_ROUND_RECT: mugGL_roundrects_shader_load(gfx, &context->shaders.roundrect, result); break;
-						case MUG_OBJECT_TEXTURE_2D: mugGL_2Dtextures_shader_load(gfx, &context->shaders.textures2D, result); break;
-						case MUG_OBJECT_TEXTURE_2D_ARRAY: mugGL_2Dtexturearr_shader_load(gfx, &context->shaders.texturearrays2D, result); break;
-					}
-				}
+		MUDEF void mug_texture_file_write(mugContext* context, mugResult* result, const char* path, mugTextureInfo* info, uint32_m* dim, uint32_m levels, muByte* data) {
+			// Make sure texture is valid
+			uint32_m fdim[3] = { dim[0], dim[1], (info->type == MUG_TEXTURE_2D_ARRAY) ? (dim[2]) : (1) };
+			if (!mug_texture_file_valid(info, fdim, levels)) {
+				MU_SET_RESULT(result, MUG_INVALID_TEXTURE_FILE)
+				return;
+			}
 
-				// Deloads a given object type
-				void mugGL_deload_object_type(mugGL_Context* context, mugObjectType type) {
-					// Convert object type to shader pointer
-					mugGL_Shader* shader = mugGL_object_type_to_shader(context, type);
-					// Destroy if exists
-					if (shader) {
-						mugGL_shader_destroy(shader);
-					}
-				}
+			// Fill header
+			muByte header[MUG_TEXTURE_FILE_HEADER_SIZE];
+			mu_memset(header, 0, sizeof(header));
+			header[0] = 'M'; header[1] = 'U'; header[2] = 'G'; header[3] = 'T';
+			mug_write_u32(&header[4], MUG_TEXTURE_FILE_VERSION);
+			mug_write_u32(&header[8], info->type);
+			mug_write_u32(&header[12], info->format);
+			mug_write_u32(&header[16], info->wrapping[0]);
+			mug_write_u32(&header[20], info->wrapping[1]);
+			mug_write_u32(&header[24], info->filtering[0]);
+			mug_write_u32(&header[28], info->filtering[1]);
+			mug_write_u32(&header[32], info->mip_levels);
+			mug_write_u32(&header[36], fdim[0]);
+			mug_write_u32(&header[40], fdim[1]);
+			mug_write_u32(&header[44], fdim[2]);
+			mug_write_u32(&header[48], levels);
+
+			// Write header and pixel data
+			FILE* file = mu_fopen(path, "wb");
+			if (!file) {
+				MU_SET_RESULT(result, MUG_FAILED_ACCESS_FILE)
+				return;
+			}
+			size_m size = mug_texture_levels_size(info->format, fdim, levels);
+			muBool written = mu_fwrite(header, 1, sizeof(header), file) == sizeof(header) && mu_fwrite(data, 1, size, file) == size;
+			if (mu_fclose(file) != 0 || !written) {
+				MU_SET_RESULT(result, MUG_FAILED_ACCESS_FILE)
+			}
 
-				// Sets an object type modifier
-				void mugGL_object_type_mod(mugGL_Context* context, mugResult* result, mugObjectType type, mugObjectMod mod, float* data) {
-					// Get shader handle
-					mugGL_Shader* shader = mugGL_object_type_to_shader(context, type);
-					if (!shader) {
-						MU_SET_RESULT(result, MUG_UNKNOWN_OBJECT_TYPE)
-						return;
-					}
+			return; if (context) {}
+		}
 
-					// Bind shader
-					mugGL_shader_bind(shader);
+		MUDEF muByte* mug_image_decode(mugContext* context, mugResult* result, muByte* data, size_m size, uint32_m* dim) {
+			muByte* pixels = mugImage_decode(data, size, dim);
+			if (!pixels) {
+				MU_SET_RESULT(result, MUG_FAILED_DECODE_IMAGE)
+			}
+			return pixels;
 
-					// Identify attribute
-					switch (mod) {
-						default: MU_SET_RESULT(result, MUG_UNKNOWN_OBJECT_MOD) break;
-						// addPos
-						case MUG_OBJECT_ADD_POS: glUniform3f(glGetUniformLocation(shader->program, "aP"), data[0], data[1], data[2]); break;
-						case MUG_OBJECT_MUL_POS: glUniform3f(glGetUniformLocation(shader->program, "mP"), data[0], data[1], data[2]); break;
-						case MUG_OBJECT_ADD_COL: glUniform4f(glGetUniformLocation(shader->program, "aC"), data[0], data[1], data[2], data[3]); break;
-						case MUG_OBJECT_MUL_COL: glUniform4f(glGetUniformLocation(shader->program, "mC"), data[0], data[1], data[2], data[3]); break;
-					}
+			// To avoid unused parameter warnings
+			if (context) {}
+		}
 
-					// Unbind shader
-					mugGL_shader_unbind(shader);
-				}
+		MUDEF mugTexture mug_gtexture_destroy(mugContext* context, muGraphic gfx, mugTexture tex) {
+			// Get inner graphic handle
+			mug_Graphic* igfx = (mug_Graphic*)gfx;
+			// Graphic needs to be redrawn wherever the texture is used
+			igfx->redraw = MU_TRUE;
+			mug_damage_full(&igfx->damage);
 
-			/* Buffer logic */
+			// Do things based on graphic system
+			switch (igfx->system) {
+				default: return 0; break;
 
-				// Fills information about buffer based on the type
-				mugResult mugGL_fill_info_buffer(mugGL_ObjBuffer* buf, mugObjectType type) {
-					// Set texture handle to null
-					buf->tex = 0;
+				// OpenGL
+				#ifdef MU_SUPPORT_OPENGL
+					case MU_GRAPHIC_OPENGL: {
+						mugGraphicGL_bind(igfx);
+						return mugGL_texture_destroy((mugGL_Texture*)tex);
+					} break;
+				#endif
+			}
 
-					// Fill based on type
-					switch (type) {
-						default: return MUG_UNKNOWN_OBJECT_TYPE; break;
-						case MUG_OBJECT_POINT: mugGL_points_fill(buf); break;
-						case MUG_OBJECT_LINE: mugGL_lines_fill(buf); break;
-						case MUG_OBJECT_TRIANGLE: mugGL_triangles_fill(buf); break;
-						case MUG_OBJECT_RECT: mugGL_rects_fill(buf); break;
-						case MUG_OBJECT_CIRCLE: mugGL_circles_fill(buf); break;
-						case MUG_OBJECT_SQUIRCLE: mugGL_squircles_fill(buf); break;
-						case MUG_OBJECT_ROUND_RECT: mugGL_roundrects_fill(buf); break;
-						case MUG_OBJECT_TEXTURE_2D: mugGL_2Dtextures_fill(buf); break;
-						case MUG_OBJECT_TEXTURE_2D_ARRAY: mugGL_2Dtexturearr_fill(buf); break;
-					}
-					return MUG_SUCCESS;
-				}
+			// To avoid unused parameter warnings
+			if (context) {} if (tex) {}
+		}
 
-				// Creates an object buffer
-				mugGL_ObjBuffer* mugGL_object_buffer_create(mug_Graphic* gfx, mugGL_Context* context, mugResult* result, mugObjectType type, uint32_m obj_count, void* obj) {
-					// Load object type
-					mugResult res = MUG_SUCCESS;
-					mugGL_load_object_type(gfx, context, &res, type);
-					if (res != MUG_SUCCESS) {
-						MU_SET_RESULT(result, res)
-						if (mug_result_is_fatal(res)) {
-							return 0;
-						}
-					}
+	/* Atlas stuff */
 
-					// Allocate struct
-					mugGL_ObjBuffer* buf = (mugGL_ObjBuffer*)mu_malloc(sizeof(mugGL_ObjBuffer));
-					if (!buf) {
-						MU_SET_RESULT(result, MUG_FAILED_MALLOC)
-						return 0;
-					}
+		// Node of a skyline; a horizontal segment of the packed area's top edge
+		struct mug_SkylineNode {
+			// Left x-coordinate
+			uint32_m x;
+			// y-coordinate (height of packed area at this segment)
+			uint32_m y;
+			// Width
+			uint32_m w;
+		};
+		typedef struct mug_SkylineNode mug_SkylineNode;
+
+		// Skyline of one page of an atlas
+		// Nodes are ordered by x, and together span the page's width
+		struct mug_Skyline {
+			// Nodes
+			mug_SkylineNode* nodes;
+			// Amount of nodes
+			uint32_m count;
+			// Amount of nodes allocated
+			uint32_m cap;
+		};
+		typedef struct mug_Skyline mug_Skyline;
+
+		// Struct representing an atlas
+		struct mug_Atlas {
+			// Texture
+			mugTexture tex;
+			// Texture dimensions (depth is 1 for non-array textures)
+			uint32_m dim[3];
+			// Whether or not the texture is a texture array
+			muBool array;
+			// Bytes per pixel
+			uint32_m pixel_size;
+			// Padding around each image
+			uint32_m padding;
+			// Skyline of each page
+			mug_Skyline* pages;
+		};
+		typedef struct mug_Atlas mug_Atlas;
 
-					// Fill info about buffer based on type
-					res = mugGL_fill_info_buffer(buf, type);
-					if (res != MUG_SUCCESS) {
-						MU_SET_RESULT(result, res)
-						if (mug_result_is_fatal(res)) {
-							mu_free(buf);
-							return 0;
-						}
-					}
+		// No position/node
+		#define MUG_ATLAS_NONE 0xFFFFFFFF
 
-					// Fill other calculatable info
-					buf->obj_count = obj_count;
-					buf->vbuf_size = obj_count*buf->bv_per_obj;
-					if (buf->fill_indexes) {
-						buf->ibuf_size = obj_count*buf->bi_per_obj;
-					}
+		// Resets a skyline to be empty
+		void mugAtlas_reset(mug_Skyline* sky, uint32_m width) {
+			sky->count = 1;
+			sky->nodes[0].x = 0;
+			sky->nodes[0].y = 0;
+			sky->nodes[0].w = width;
+		}
 
-					// Create buffers
-					res = mugGL_objects_create(buf, obj);
-					if (res != MUG_SUCCESS) {
-						MU_SET_RESULT(result, res)
-						if (mug_result_is_fatal(res)) {
-							mu_free(buf);
-							return 0;
-						}
-					}
+		// Returns the y-coordinate that a rect of size w*h would be placed at
+		// if its left side were placed at a node; MUG_ATLAS_NONE if it doesn't fit
+		uint32_m mugAtlas_fit(mug_Atlas* atlas, mug_Skyline* sky, uint32_m node, uint32_m w, uint32_m h) {
+			// Check if it fits horizontally
+			if (w > atlas->dim[0] - sky->nodes[node].x) {
+				return MUG_ATLAS_NONE;
+			}
 
-					return buf;
+			// Find highest node that it spans
+			uint32_m y = 0;
+			uint32_m remaining = w;
+			for (uint32_m i = node; remaining > 0; ++i) {
+				if (sky->nodes[i].y > y) {
+					y = sky->nodes[i].y;
 				}
-
-				// Destroys an object buffer
-				mugGL_ObjBuffer* mugGL_object_buffer_destroy(mugGL_ObjBuffer* buf) {
-					// Destroy inner buffers
-					mugGL_objects_destroy(buf);
-					// Free malloc'd data
-					mu_free(buf);
-					// Return null
-					return 0;
+				if (h > atlas->dim[1] - y) {
+					return MUG_ATLAS_NONE;
 				}
+				remaining = (sky->nodes[i].w < remaining) ? (remaining - sky->nodes[i].w) : (0);
+			}
+			return y;
+		}
 
-				// Renders an object buffer
-				void mugGL_object_buffer_render(mugGL_Context* context, mugGL_ObjBuffer* buf) {
-					// Get shader handle
-					mugGL_Shader* shader = mugGL_object_type_to_shader(context, buf->obj_type);
-					if (!shader) {
-						return;
-					}
+		// Places a rect of size w*h on a skyline
+		// Returns MUG_ATLAS_FULL if it didn't fit
+		mugResult mugAtlas_place(mug_Atlas* atlas, mug_Skyline* sky, uint32_m w, uint32_m h, uint32_m* pos) {
+			// Find position with lowest top, then tightest node
+			uint32_m best = MUG_ATLAS_NONE, best_y = MUG_ATLAS_NONE, best_w = MUG_ATLAS_NONE;
+			for (uint32_m i = 0; i < sky->count; ++i) {
+				uint32_m y = mugAtlas_fit(atlas, sky, i, w, h);
+				if (y == MUG_ATLAS_NONE) {
+					continue;
+				}
+				if (best == MUG_ATLAS_NONE || y+h < best_y+h || (y+h == best_y+h && sky->nodes[i].w < best_w)) {
+					best = i;
+					best_y = y;
+					best_w = sky->nodes[i].w;
+				}
+			}
+			if (best == MUG_ATLAS_NONE) {
+				return MUG_ATLAS_FULL;
+			}
 
-					// Bind shader
-					mugGL_shader_bind(shader);
-					// Render buffer
-					mugGL_objects_render(buf);
-					// Unbind shader
-					mugGL_shader_unbind(shader);
+			// Make sure there's room for a new node
+			if (sky->count == sky->cap) {
+				mug_SkylineNode* nodes = (mug_SkylineNode*)mug_realloc(sky->nodes, sizeof(mug_SkylineNode)*sky->cap*2, MUG_ALLOC_GENERAL);
+				if (!nodes) {
+					return MUG_FAILED_REALLOC;
 				}
+				sky->nodes = nodes;
+				sky->cap *= 2;
+			}
 
-				// Subrenders an object buffer
-				void mugGL_object_buffer_subrender(mugGL_Context* context, mugGL_ObjBuffer* buf, uint32_m offset, uint32_m count) {
-					// Get shader handle
-					mugGL_Shader* shader = mugGL_object_type_to_shader(context, buf->obj_type);
-					if (!shader) {
-						return;
-					}
+			// Insert new node
+			pos[0] = sky->nodes[best].x;
+			pos[1] = best_y;
+			mu_memmove(&sky->nodes[best+1], &sky->nodes[best], sizeof(mug_SkylineNode)*(sky->count-best));
+			sky->nodes[best].y = best_y + h;
+			sky->nodes[best].w = w;
+			++sky->count;
+
+			// Shrink or remove nodes now covered by the new node
+			uint32_m right = pos[0] + w;
+			uint32_m i = best+1;
+			while (i < sky->count && sky->nodes[i].x < right) {
+				uint32_m shrink = right - sky->nodes[i].x;
+				if (shrink >= sky->nodes[i].w) {
+					mu_memmove(&sky->nodes[i], &sky->nodes[i+1], sizeof(mug_SkylineNode)*(sky->count-i-1));
+					--sky->count;
+					continue;
+				}
+				sky->nodes[i].x += shrink;
+				sky->nodes[i].w -= shrink;
+				break;
+			}
 
-					// Bind shader
-					mugGL_shader_bind(shader);
-					// Subrender buffer
-					mugGL_objects_subrender(buf, offset, count);
-					// Unbind shader
-					mugGL_shader_unbind(shader);
+			// Merge neighboring nodes of equal height
+			for (i = 0; i+1 < sky->count;) {
+				if (sky->nodes[i].y == sky->nodes[i+1].y) {
+					sky->nodes[i].w += sky->nodes[i+1].w;
+					mu_memmove(&sky->nodes[i+1], &sky->nodes[i+2], sizeof(mug_SkylineNode)*(sky->count-i-2));
+					--sky->count;
+				} else {
+					++i;
 				}
+			}
+			return MUG_SUCCESS;
+		}
 
-		/* Misc. */
+		MUDEF mugAtlas mug_atlas_create(mugContext* context, mugResult* result, muGraphic gfx, mugTextureInfo* info, uint32_m* dim, uint32_m padding) {
+			// Images can't be padded in compressed formats
+			if (mug_texture_format_block(info->format) > 1) {
+				MU_SET_RESULT(result, MUG_UNSUPPORTED_TEXTURE_FORMAT)
+				return 0;
+			}
 
-			// Clears the screen
-			void mugGL_clear(mug_Graphic* gfx, float r, float g, float b) {
-				// Update dimensions
-				{
-					// Retrieve dimensions
-					uint32_m dim[2] = { gfx->dim[0], gfx->dim[1] };
-					mugGraphic_dim(gfx);
-					// Viewport if they've changed
-					if (dim[0] != gfx->dim[0] || dim[1] != gfx->dim[1]) {
-						glViewport(0, 0, gfx->dim[0], gfx->dim[1]);
+			// Allocate atlas
+			mug_Atlas* atlas = (mug_Atlas*)mug_alloc(sizeof(mug_Atlas), MUG_ALLOC_GENERAL);
+			if (!atlas) {
+				MU_SET_RESULT(result, MUG_FAILED_MALLOC)
+				return 0;
+			}
 
-						// + Update dimensions for shaders
-						mugGL_update_dimensions((mugGL_Context*)gfx->p, gfx->dim);
+			// Fill in info
+			atlas->array = info->type == MUG_TEXTURE_2D_ARRAY;
+			atlas->dim[0] = dim[0];
+			atlas->dim[1] = dim[1];
+			atlas->dim[2] = (atlas->array) ? (dim[2]) : (1);
+			atlas->pixel_size = mug_texture_format_size(info->format);
+			atlas->padding = padding;
+
+			// Allocate skylines
+			atlas->pages = (mug_Skyline*)mug_alloc(sizeof(mug_Skyline)*atlas->dim[2], MUG_ALLOC_GENERAL);
+			if (!atlas->pages) {
+				MU_SET_RESULT(result, MUG_FAILED_MALLOC)
+				mug_dealloc(atlas, MUG_ALLOC_GENERAL);
+				return 0;
+			}
+			for (uint32_m p = 0; p < atlas->dim[2]; ++p) {
+				atlas->pages[p].cap = 16;
+				atlas->pages[p].nodes = (mug_SkylineNode*)mug_alloc(sizeof(mug_SkylineNode)*16, MUG_ALLOC_GENERAL);
+				if (!atlas->pages[p].nodes) {
+					MU_SET_RESULT(result, MUG_FAILED_MALLOC)
+					while (p--) {
+						mug_dealloc(atlas->pages[p].nodes, MUG_ALLOC_GENERAL);
 					}
+					mug_dealloc(atlas->pages, MUG_ALLOC_GENERAL);
+					mug_dealloc(atlas, MUG_ALLOC_GENERAL);
+					return 0;
 				}
+				mugAtlas_reset(&atlas->pages[p], atlas->dim[0]);
+			}
 
-				// Set clear color
-				glClearColor(r, g, b, 1.f);
-				// Set clear depth
-				glClearDepth(0.0);
-				// Clear screen color and depth
-				glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+			// Create texture
+			mugResult res = MUG_SUCCESS;
+			atlas->tex = mug_gtexture_create(context, &res, gfx, info, dim, 0);
+			if (mug_result_is_fatal(res)) {
+				MU_SET_RESULT(result, res)
+				mug_atlas_destroy(context, gfx, atlas);
+				return 0;
+			}
+			if (res != MUG_SUCCESS) {
+				MU_SET_RESULT(result, res)
 			}
+			return atlas;
+		}
 
-			// Maximums
-			uint32_m mugGL_max(mugMax max) {
-				GLint gi = 0;
+		MUDEF mugAtlas mug_atlas_destroy(mugContext* context, muGraphic gfx, mugAtlas atlas) {
+			mug_Atlas* iatlas = (mug_Atlas*)atlas;
 
-				switch (max) {
-					default: return 0; break;
+			// Destroy texture
+			if (iatlas->tex) {
+				mug_gtexture_destroy(context, gfx, iatlas->tex);
+			}
 
-					// Texture
-					case MUG_MAX_TEXTURE_WIDTH_HEIGHT: {
-						glGetIntegerv(GL_MAX_TEXTURE_SIZE, &gi);
-						return gi;
-					} break;
-					case MUG_MAX_TEXTURE_DEPTH: {
-						glGetIntegerv(GL_MAX_ARRAY_TEXTURE_LAYERS, &gi);
-						return gi;
-					} break;
-				}
+			// Free skylines
+			for (uint32_m p = 0; p < iatlas->dim[2]; ++p) {
+				mug_dealloc(iatlas->pages[p].nodes, MUG_ALLOC_GENERAL);
 			}
+			mug_dealloc(iatlas->pages, MUG_ALLOC_GENERAL);
 
-	#endif /* MU_SUPPORT_OPENGL */
+			// Free atlas
+			mug_dealloc(iatlas, MUG_ALLOC_GENERAL);
+			return 0;
+		}
 
-	/* Outer graphic logic */
+		MUDEF muBool mug_atlas_add(mugContext* context, mugResult* result, muGraphic gfx, mugAtlas atlas, uint32_m w, uint32_m h, uint32_m row_stride, muByte* data, float* tex_pos, float* tex_dim) {
+			mug_Atlas* iatlas = (mug_Atlas*)atlas;
 
-		// Destroy graphic
-		MUDEF muGraphic mug_graphic_destroy(mugContext* context, muGraphic gfx) {
-			// Get handle to inner graphics
-			mug_Graphic* ingfx = (mug_Graphic*)gfx;
+			// Calculate padded size
+			uint32_m pad = iatlas->padding;
+			if (!w || !h || w > iatlas->dim[0] || h > iatlas->dim[1] || pad*2 > iatlas->dim[0]-w || pad*2 > iatlas->dim[1]-h) {
+				MU_SET_RESULT(result, MUG_ATLAS_FULL)
+				return MU_FALSE;
+			}
+			uint32_m pw = w + pad*2, ph = h + pad*2;
+
+			// Find first page that fits
+			uint32_m pos[2];
+			uint32_m page = 0;
+			mugResult res = MUG_ATLAS_FULL;
+			for (; page < iatlas->dim[2]; ++page) {
+				res = mugAtlas_place(iatlas, &iatlas->pages[page], pw, ph, pos);
+				if (res != MUG_ATLAS_FULL) {
+					break;
+				}
+			}
+			if (res != MUG_SUCCESS) {
+				MU_SET_RESULT(result, res)
+				return MU_FALSE;
+			}
 
-			// Destroy system
-			switch (ingfx->system) {
-				default: break;
+			// Upload image
+			size_m stride = (row_stride) ? (row_stride) : ((size_m)w * iatlas->pixel_size);
+			if (!pad) {
+				mug_gtexture_subimage(context, result, gfx, iatlas->tex, pos[0], pos[1], page, w, h, (uint32_m)stride, data);
+			}
+			// Upload image with its edges extended into the padding
+			else {
+				// (Not allocated on the arena, as uploading flushes immediate drawing, which uses it)
+				size_m ps = iatlas->pixel_size;
+				muByte* padded = (muByte*)mug_alloc(pw*ph*ps, MUG_ALLOC_SCRATCH);
+				if (!padded) {
+					MU_SET_RESULT(result, MUG_FAILED_MALLOC)
+				} else {
+					for (uint32_m y = 0; y < ph; ++y) {
+						// Clamp to image row
+						uint32_m sy = (y < pad) ? (0) : ((y-pad >= h) ? (h-1) : (y-pad));
+						muByte* src = &data[sy*stride];
+						muByte* dst = &padded[y*pw*ps];
+						// Left padding, image row, right padding
+						for (uint32_m x = 0; x < pad; ++x) {
+							mu_memcpy(&dst[x*ps], src, ps);
+							mu_memcpy(&dst[(pad+w+x)*ps], &src[(w-1)*ps], ps);
+						}
+						mu_memcpy(&dst[pad*ps], src, w*ps);
+					}
+					mug_gtexture_subimage(context, result, gfx, iatlas->tex, pos[0], pos[1], page, pw, ph, 0, padded);
+					mug_dealloc(padded, MUG_ALLOC_SCRATCH);
+				}
+			}
 
-				// OpenGL
-				#ifdef MU_SUPPORT_OPENGL
-					case MU_GRAPHIC_OPENGL: mugGL_term_context(ingfx); break;
-				#endif
+			// Calculate texture cutout
+			tex_pos[0] = (float)(pos[0]+pad) / (float)iatlas->dim[0];
+			tex_pos[1] = (float)(pos[1]+pad) / (float)iatlas->dim[1];
+			if (iatlas->array) {
+				tex_pos[2] = (float)page;
 			}
+			tex_dim[0] = (float)w / (float)iatlas->dim[0];
+			tex_dim[1] = (float)h / (float)iatlas->dim[1];
+			return MU_TRUE;
+		}
 
-			// Destroy graphic
-			mugGraphic_destroy(ingfx);
+		MUDEF void mug_atlas_clear(mugContext* context, muGraphic gfx, mugAtlas atlas) {
+			mug_Atlas* iatlas = (mug_Atlas*)atlas;
 
-			// Free graphic
-			mu_free(ingfx);
+			// Reset each skyline
+			for (uint32_m p = 0; p < iatlas->dim[2]; ++p) {
+				mugAtlas_reset(&iatlas->pages[p], iatlas->dim[0]);
+			}
 
-			// Return null
-			return 0;
+			return; if (context) {} if (gfx) {}
+		}
+
+		MUDEF mugTexture mug_atlas_texture(mugContext* context, muGraphic gfx, mugAtlas atlas) {
+			return ((mug_Atlas*)atlas)->tex;
 
 			// To avoid unused parameter warnings
-			if (context) {}
+			if (context) {} if (gfx) {}
 		}
 
-		// Create graphic via window
-		MUDEF muGraphic mug_graphic_create_window(mugContext* context, mugResult* result, muGraphicSystem system, muWindowInfo* info) {
-			// Allocate handle to graphics
-			mug_Graphic* gfx = (mug_Graphic*)mu_malloc(sizeof(mug_Graphic));
-			if (!gfx) {
-				MU_SET_RESULT(result, MUG_FAILED_MALLOC);
+	/* Texture pool stuff */
+
+		// Struct representing a texture pool
+		struct mug_TexturePool {
+			// Texture
+			mugTexture tex;
+			// Image dimensions and amount of layers
+			uint32_m dim[3];
+			// Amount of layers ever handed out (layers past this are free)
+			uint32_m used;
+			// Removed layers, to be reused before any others
+			uint32_m* free;
+			uint32_m free_count;
+		};
+		typedef struct mug_TexturePool mug_TexturePool;
+
+		MUDEF mugTexturePool mug_pool_create(mugContext* context, mugResult* result, muGraphic gfx, mugTextureInfo* info, uint32_m* dim) {
+			// Allocate pool
+			mug_TexturePool* pool = (mug_TexturePool*)mug_alloc(sizeof(mug_TexturePool), MUG_ALLOC_GENERAL);
+			if (!pool) {
+				MU_SET_RESULT(result, MUG_FAILED_MALLOC)
 				return 0;
 			}
 
-			// Create window graphic
-			mugResult res = mugGraphic_window_create(context, info, gfx, system);
+			// Fill in info
+			pool->dim[0] = dim[0];
+			pool->dim[1] = dim[1];
+			pool->dim[2] = (dim[2]) ? (dim[2]) : (1);
+			pool->used = 0;
+			pool->free_count = 0;
+			pool->free = (uint32_m*)mug_alloc(sizeof(uint32_m)*pool->dim[2], MUG_ALLOC_GENERAL);
+			if (!pool->free) {
+				MU_SET_RESULT(result, MUG_FAILED_MALLOC)
+				mug_dealloc(pool, MUG_ALLOC_GENERAL);
+				return 0;
+			}
+
+			// Create texture
+			mugTextureInfo array_info = *info;
+			array_info.type = MUG_TEXTURE_2D_ARRAY;
+			mugResult res = MUG_SUCCESS;
+			pool->tex = mug_gtexture_create(context, &res, gfx, &array_info, pool->dim, 0);
+			if (mug_result_is_fatal(res)) {
+				MU_SET_RESULT(result, res)
+				mug_pool_destroy(context, gfx, pool);
+				return 0;
+			}
 			if (res != MUG_SUCCESS) {
 				MU_SET_RESULT(result, res)
-				if (mug_result_is_fatal(res)) {
-					mu_free(gfx);
-					return 0;
-				}
 			}
+			return pool;
+		}
 
-			// Create context based on given system value
-			switch (system) {
-				// Unknown system value
-				default: {
-					// Destroy graphic
-					mugGraphic_destroy(gfx);
-					// Free graphic
-					mu_free(gfx);
-					// Return failure value
-					MU_SET_RESULT(result, MUG_UNKNOWN_GRAPHIC_SYSTEM)
-					return 0;
-				} break;
-
-				// OpenGL
-				#ifdef MU_SUPPORT_OPENGL
-					case MU_GRAPHIC_OPENGL: {
-						// Initiate OpenGL context
-						res = mugGL_init_context(gfx);
+		MUDEF mugTexturePool mug_pool_destroy(mugContext* context, muGraphic gfx, mugTexturePool pool) {
+			mug_TexturePool* ipool = (mug_TexturePool*)pool;
 
-						// Return possible failure
-						if (res != MUG_SUCCESS) {
-							MU_SET_RESULT(result, res)
-							if (mug_result_is_fatal(res)) {
-								mugGraphic_destroy(gfx);
-								mu_free(gfx);
-								return 0;
-							}
-						}
-					} break;
-				#endif
+			// Destroy texture
+			if (ipool->tex) {
+				mug_gtexture_destroy(context, gfx, ipool->tex);
 			}
 
-			return gfx;
+			// Free pool
+			mug_dealloc(ipool->free, MUG_ALLOC_GENERAL);
+			mug_dealloc(ipool, MUG_ALLOC_GENERAL);
+			return 0;
 		}
 
-		// Get window handle from graphic
-		MUDEF muWindow mug_graphic_get_window(mugContext* context, muGraphic gfx) {
-			// Return window handle
-			return ((mug_Graphic*)gfx)->parent.cosa_win;
-			// To avoid unused parameter warnings
-			if (context) {}
-		}
+		MUDEF uint32_m mug_pool_add(mugContext* context, mugResult* result, muGraphic gfx, mugTexturePool pool, uint32_m row_stride, muByte* data) {
+			mug_TexturePool* ipool = (mug_TexturePool*)pool;
 
-		// Returns if the graphic exists
-		MUDEF muBool mug_graphic_exists(mugContext* context, muGraphic gfx) {
-			// Return existence state
-			return mugGraphic_exists((mug_Graphic*)gfx);
+			// Reuse removed layer
+			uint32_m layer = MUG_TEXTURE_POOL_NONE;
+			if (ipool->free_count) {
+				layer = ipool->free[--ipool->free_count];
+			}
 
-			// To avoid unused parameter warnings
-			if (context) {}
-		}
+			// Use next layer, growing texture array if there is none
+			else {
+				if (ipool->used == ipool->dim[2]) {
+					uint32_m max = mug_max(context, gfx, MUG_MAX_TEXTURE_DEPTH);
+					uint32_m depth = (ipool->dim[2] > max/2) ? (max) : (ipool->dim[2]*2);
+					if (depth <= ipool->dim[2]) {
+						MU_SET_RESULT(result, MUG_TEXTURE_POOL_FULL)
+						return MUG_TEXTURE_POOL_NONE;
+					}
 
-		// Clear graphic
-		MUDEF void mug_graphic_clear(mugContext* context, mugResult* result, muGraphic gfx, float r, float g, float b) {
-			// Get inner graphic handle
-			mug_Graphic* igfx = (mug_Graphic*)gfx;
+					// Grow free list to be able to hold every layer
+					uint32_m* free = (uint32_m*)mug_realloc(ipool->free, sizeof(uint32_m)*depth, MUG_ALLOC_GENERAL);
+					if (!free) {
+						MU_SET_RESULT(result, MUG_FAILED_REALLOC)
+						return MUG_TEXTURE_POOL_NONE;
+					}
+					ipool->free = free;
 
-			// Clear screen
-			switch (igfx->system) {
-				default: break;
+					// Grow texture array
+					mugResult res = MUG_SUCCESS;
+					mug_gtexture_resize_layers(context, &res, gfx, ipool->tex, depth);
+					if (res != MUG_SUCCESS) {
+						MU_SET_RESULT(result, res)
+						if (mug_result_is_fatal(res)) {
+							return MUG_TEXTURE_POOL_NONE;
+						}
+					}
+					ipool->dim[2] = depth;
+				}
+				layer = ipool->used++;
+			}
+
+			// Upload image
+			mug_gtexture_subimage(context, result, gfx, ipool->tex, 0, 0, layer, ipool->dim[0], ipool->dim[1], row_stride, data);
+			return layer;
+		}
+
+		MUDEF void mug_pool_remove(mugContext* context, muGraphic gfx, mugTexturePool pool, uint32_m layer) {
+			mug_TexturePool* ipool = (mug_TexturePool*)pool;
 
-				// OpenGL
-				#ifdef MU_SUPPORT_OPENGL
-					case MU_GRAPHIC_OPENGL: {
-						// Bind
-						mugGraphicGL_bind(igfx);
-						// Clear
-						mugGL_clear(igfx, r, g, b);
-					} break;
-				#endif
+			// Ignore layers that were never handed out
+			if (layer >= ipool->used || ipool->free_count >= ipool->dim[2]) {
+				return;
 			}
+			// Ignore layers that are already removed
+			for (uint32_m i = 0; i < ipool->free_count; ++i) {
+				if (ipool->free[i] == layer) {
+					return;
+				}
+			}
+
+			ipool->free[ipool->free_count++] = layer;
+
+			return; if (context) {} if (gfx) {}
+		}
+
+		MUDEF mugTexture mug_pool_texture(mugContext* context, muGraphic gfx, mugTexturePool pool) {
+			return ((mug_TexturePool*)pool)->tex;
 
 			// To avoid unused parameter warnings
-			return; if (context) {} if (result) {} if (r) {} if (g) {} if (b) {}
+			if (context) {} if (gfx) {}
 		}
 
-		// Swaps buffers, presenting image to screen
-		MUDEF void mug_graphic_swap_buffers(mugContext* context, mugResult* result, muGraphic gfx) {
-			// Get inner graphic handle
-			mug_Graphic* igfx = (mug_Graphic*)gfx;
+	/* Virtual texture stuff */
 
-			// Swap buffers
-			switch (igfx->system) {
-				default: break;
+		// Maximum amount of levels (enough for any 32-bit dimensions)
+		#define MUG_VTEXTURE_MAX_LEVELS 33
 
-				// OpenGL
-				#ifdef MU_SUPPORT_OPENGL
-					case MU_GRAPHIC_OPENGL: {
-						// Bind OpenGL
-						mugGraphicGL_bind(igfx);
+		// No tile/slot
+		#define MUG_VTEXTURE_NONE 0xFFFFFFFF
 
-						// Swap buffers
-						mugResult res = mugGraphicGL_swap_buffers(igfx);
-						if (res != MUG_SUCCESS) {
-							MU_SET_RESULT(result, res)
-							if (mug_result_is_fatal(res)) {
-								return;
-							}
-						}
+		// Slot of a virtual texture's page cache
+		struct mug_TileSlot {
+			// Level of tile held (MUG_VTEXTURE_NONE if empty)
+			uint32_m level;
+			// Column and row of tile held
+			uint32_m x;
+			uint32_m y;
+			// Draw that the tile was last needed in (0 if never)
+			uint64_m last_use;
+		};
+		typedef struct mug_TileSlot mug_TileSlot;
+
+		// Struct representing a virtual texture
+		struct mug_VirtualTexture {
+			// Info
+			mugVirtualTextureInfo info;
+			// Page cache
+			mugTexture cache;
+			// Amount of levels
+			uint32_m levels;
+			// Dimensions of each level, in pixels
+			uint32_m level_dim[MUG_VTEXTURE_MAX_LEVELS][2];
+			// Dimensions of each level, in tiles
+			uint32_m level_tiles[MUG_VTEXTURE_MAX_LEVELS][2];
+			// Offset of each level's indirection table within tables
+			size_m level_offsets[MUG_VTEXTURE_MAX_LEVELS];
+			// Indirection tables; slot of each tile of each level (MUG_VTEXTURE_NONE if not resident)
+			uint32_m* tables;
+			// Page cache slots
+			mug_TileSlot* slots;
+			// Buffer that tiles are loaded into
+			muByte* staging;
+			// Size of a tile's pixel data, in bytes
+			size_m tile_size;
+			// Bytes per pixel (0 for block-compressed formats)
+			uint32_m pixel_size;
+			// Current draw
+			uint64_m draw;
+			// Amount of visible tiles missing in last draw
+			uint32_m missing;
+		};
+		typedef struct mug_VirtualTexture mug_VirtualTexture;
 
-						// Update OpenGL afterwards
-						mugGL_update_context(igfx);
-					} break;
-				#endif
+		// Returns the indirection table entry of a tile
+		uint32_m* mugVTexture_entry(mug_VirtualTexture* vtex, uint32_m level, uint32_m x, uint32_m y) {
+			return &vtex->tables[vtex->level_offsets[level] + (size_m)y*vtex->level_tiles[level][0] + x];
+		}
+
+		// Returns the closest level at or below a tile's level with a resident tile covering it
+		// Returns MUG_VTEXTURE_NONE if there is none
+		uint32_m mugVTexture_find(mug_VirtualTexture* vtex, uint32_m level, uint32_m x, uint32_m y) {
+			for (; level < vtex->levels; ++level, x >>= 1, y >>= 1) {
+				if (*mugVTexture_entry(vtex, level, x, y) != MUG_VTEXTURE_NONE) {
+					return level;
+				}
 			}
+			return MUG_VTEXTURE_NONE;
+		}
 
-			// Avoid unused parameter warnings
-			return; if (context) {} if (result) {}
+		// Marks a tile as needed by the current draw, if resident
+		void mugVTexture_touch(mug_VirtualTexture* vtex, uint32_m level, uint32_m x, uint32_m y) {
+			uint32_m slot = *mugVTexture_entry(vtex, level, x, y);
+			if (slot != MUG_VTEXTURE_NONE) {
+				vtex->slots[slot].last_use = vtex->draw;
+			}
 		}
 
-		// Updates the graphic's parent
-		MUDEF void mug_graphic_update(mugContext* context, mugResult* result, muGraphic gfx, float target_fps) {
-			// Get inner graphic handle
-			mug_Graphic* igfx = (mug_Graphic*)gfx;
+		// Loads a tile into the least-recently-needed slot not needed by the current draw
+		// Returns 0 if loaded, 1 if the loader didn't have it ready, and 2 if no slot is free
+		uint32_m mugVTexture_load(mugContext* context, mugResult* result, muGraphic gfx, mug_VirtualTexture* vtex, uint32_m level, uint32_m x, uint32_m y) {
+			// Find slot
+			uint32_m slot = MUG_VTEXTURE_NONE;
+			for (uint32_m s = 0; s < vtex->info.cache_tiles; ++s) {
+				if (vtex->slots[s].last_use == vtex->draw) {
+					continue;
+				}
+				if (slot == MUG_VTEXTURE_NONE || vtex->slots[s].last_use < vtex->slots[slot].last_use) {
+					slot = s;
+				}
+			}
+			if (slot == MUG_VTEXTURE_NONE) {
+				return 2;
+			}
 
-			// Calculate delta-time
-			double current_time = muCOSA_fixed_time_get(&context->cosa);
-			double delta_time = current_time - igfx->last_time;
-			igfx->last_time = current_time;
+			// Load tile
+			uint32_m ts = vtex->info.tile_size;
+			uint32_m w = vtex->level_dim[level][0] - x*ts, h = vtex->level_dim[level][1] - y*ts;
+			w = (w < ts) ? (w) : (ts);
+			h = (h < ts) ? (h) : (ts);
+			if (!vtex->info.loader(vtex->info.user, level, x, y, w, h, vtex->staging)) {
+				return 1;
+			}
 
-			// Sleep, if needed, to adjust for frame time
-			if (target_fps > 0.f) {
-				double inv_fps = 1.0 / target_fps;
-				if (delta_time < inv_fps) {
-					muCOSA_sleep(&context->cosa, inv_fps-delta_time);
+			// Extend edge pixels of partial tiles so that filtering doesn't read past them
+			size_m ps = vtex->pixel_size;
+			if (ps) {
+				if (w < ts) {
+					for (uint32_m r = 0; r < h; ++r) {
+						muByte* row = &vtex->staging[(size_m)r*ts*ps];
+						mu_memcpy(&row[w*ps], &row[(w-1)*ps], ps);
+					}
+				}
+				if (h < ts) {
+					mu_memcpy(&vtex->staging[(size_m)h*ts*ps], &vtex->staging[(size_m)(h-1)*ts*ps], ts*ps);
 				}
 			}
 
-			// Update graphic
-			mugResult res = mugGraphic_update(igfx);
+			// Upload tile
+			mugResult res = MUG_SUCCESS;
+			mug_gtexture_subimage(context, &res, gfx, vtex->cache, 0, 0, slot, ts, ts, 0, vtex->staging);
 			if (res != MUG_SUCCESS) {
 				MU_SET_RESULT(result, res)
+				if (mug_result_is_fatal(res)) {
+					return 2;
+				}
 			}
+
+			// Replace old tile
+			mug_TileSlot* s = &vtex->slots[slot];
+			if (s->level != MUG_VTEXTURE_NONE) {
+				*mugVTexture_entry(vtex, s->level, s->x, s->y) = MUG_VTEXTURE_NONE;
+			}
+			s->level = level;
+			s->x = x;
+			s->y = y;
+			s->last_use = vtex->draw;
+			*mugVTexture_entry(vtex, level, x, y) = slot;
+			return 0;
 		}
 
-	/* Object types */
+		// Draws the part of the image within normalized coordinates uv (u0, v0, u1, v1)
+		// with a resident tile
+		void mugVTexture_draw_tile(mug_Graphic* gfx, mugResult* result, mug_VirtualTexture* vtex, float* rect, double* uv, uint32_m level, uint32_m x, uint32_m y) {
+			double ts = (double)vtex->info.tile_size;
+			double lw = (double)vtex->level_dim[level][0], lh = (double)vtex->level_dim[level][1];
 
-		// Loads the given object type
-		MUDEF void mug_gobject_load(mugContext* context, mugResult* result, muGraphic gfx, mugObjectType obj_type) {
-			// Get inner graphic handle
-			mug_Graphic* igfx = (mug_Graphic*)gfx;
+			mug2DTextureArrayRect tile = {
+				{ { 0.f, 0.f, 0.f }, { 1.f, 1.f, 1.f, 1.f } },
+				{ 0.f, 0.f }, 0.f, { 0.f, 0.f, 0.f }, { 0.f, 0.f }
+			};
+			// Position on graphic
+			tile.center.pos[0] = (float)(rect[0] + (uv[0]+uv[2])*0.5*rect[2]);
+			tile.center.pos[1] = (float)(rect[1] + (uv[1]+uv[3])*0.5*rect[3]);
+			tile.dim[0] = (float)((uv[2]-uv[0])*rect[2]);
+			tile.dim[1] = (float)((uv[3]-uv[1])*rect[3]);
+			// Cutout within tile
+			tile.tex_pos[0] = (float)((uv[0]*lw - x*ts) / ts);
+			tile.tex_pos[1] = (float)((uv[1]*lh - y*ts) / ts);
+			tile.tex_pos[2] = (float)*mugVTexture_entry(vtex, level, x, y);
+			tile.tex_dim[0] = (float)((uv[2]-uv[0])*lw / ts);
+			tile.tex_dim[1] = (float)((uv[3]-uv[1])*lh / ts);
+
+			mugDraw_object(gfx, result, MUG_OBJECT_TEXTURE_2D_ARRAY, vtex->cache, &tile, sizeof(tile));
+		}
 
-			// Do thing based on graphic system
-			switch (igfx->system) {
-				default: break;
+		MUDEF mugVirtualTexture mug_vtexture_create(mugContext* context, mugResult* result, muGraphic gfx, mugVirtualTextureInfo* info) {
+			// Make sure info is valid
+			uint32_m block = mug_texture_format_block(info->format);
+			if (!info->dim[0] || !info->dim[1] || !info->tile_size || info->tile_size % block || info->cache_tiles < 2 || !info->loader) {
+				MU_SET_RESULT(result, MUG_INVALID_VIRTUAL_TEXTURE)
+				return 0;
+			}
 
-				// OpenGL
-				#ifdef MU_SUPPORT_OPENGL
-					case MU_GRAPHIC_OPENGL: {
-						// Bind OpenGL
-						mugGraphicGL_bind(igfx);
-						// Load object type
-						mugGL_load_object_type(igfx, (mugGL_Context*)igfx->p, result, obj_type);
-					} break;
-				#endif
+			// Allocate virtual texture
+			mug_VirtualTexture* vtex = (mug_VirtualTexture*)mug_alloc(sizeof(mug_VirtualTexture), MUG_ALLOC_GENERAL);
+			if (!vtex) {
+				MU_SET_RESULT(result, MUG_FAILED_MALLOC)
+				return 0;
+			}
+			mu_memset(vtex, 0, sizeof(mug_VirtualTexture));
+			vtex->info = *info;
+			if (!vtex->info.upload_tiles) {
+				vtex->info.upload_tiles = MUG_VTEXTURE_UPLOAD_TILES;
+			}
+			vtex->tile_size = mug_texture_data_size(info->format, info->tile_size, info->tile_size);
+			vtex->pixel_size = (block > 1) ? (0) : (mug_texture_format_size(info->format));
+
+			// Calculate levels, halving until a level fits in one tile
+			size_m entries = 0;
+			for (uint32_m l = 0; l < MUG_VTEXTURE_MAX_LEVELS; ++l) {
+				vtex->level_dim[l][0] = ((info->dim[0]-1) >> l) + 1;
+				vtex->level_dim[l][1] = ((info->dim[1]-1) >> l) + 1;
+				vtex->level_tiles[l][0] = (vtex->level_dim[l][0]-1) / info->tile_size + 1;
+				vtex->level_tiles[l][1] = (vtex->level_dim[l][1]-1) / info->tile_size + 1;
+				vtex->level_offsets[l] = entries;
+				entries += (size_m)vtex->level_tiles[l][0] * vtex->level_tiles[l][1];
+				vtex->levels = l+1;
+				if (vtex->level_tiles[l][0] == 1 && vtex->level_tiles[l][1] == 1) {
+					break;
+				}
 			}
 
-			// To avoid unused parameter warnings in some circumstances
-			return; if (context) {} if (result) {} if (obj_type) {}
+			// Allocate indirection tables, slots, and staging buffer
+			vtex->tables = (uint32_m*)mug_alloc(sizeof(uint32_m)*entries, MUG_ALLOC_GENERAL);
+			vtex->slots = (mug_TileSlot*)mug_alloc(sizeof(mug_TileSlot)*info->cache_tiles, MUG_ALLOC_GENERAL);
+			vtex->staging = (muByte*)mug_alloc(vtex->tile_size, MUG_ALLOC_GENERAL);
+			if (!vtex->tables || !vtex->slots || !vtex->staging) {
+				MU_SET_RESULT(result, MUG_FAILED_MALLOC)
+				mug_vtexture_destroy(context, gfx, vtex);
+				return 0;
+			}
+			mu_memset(vtex->tables, 0xFF, sizeof(uint32_m)*entries);
+			for (uint32_m s = 0; s < info->cache_tiles; ++s) {
+				vtex->slots[s].level = MUG_VTEXTURE_NONE;
+				vtex->slots[s].x = vtex->slots[s].y = 0;
+				vtex->slots[s].last_use = 0;
+			}
+
+			// Create page cache
+			mugTextureInfo cache_info = {
+				MUG_TEXTURE_2D_ARRAY, info->format,
+				{ MUG_TEXTURE_CLAMP, MUG_TEXTURE_CLAMP },
+				{ info->filtering[0], info->filtering[1] },
+				1, 0
+			};
+			if (cache_info.filtering[1] == MUG_TEXTURE_TRILINEAR) {
+				cache_info.filtering[1] = MUG_TEXTURE_BILINEAR;
+			}
+			uint32_m cache_dim[3] = { info->tile_size, info->tile_size, info->cache_tiles };
+			mugResult res = MUG_SUCCESS;
+			vtex->cache = mug_gtexture_create(context, &res, gfx, &cache_info, cache_dim, 0);
+			if (mug_result_is_fatal(res)) {
+				MU_SET_RESULT(result, res)
+				mug_vtexture_destroy(context, gfx, vtex);
+				return 0;
+			}
+			if (res != MUG_SUCCESS) {
+				MU_SET_RESULT(result, res)
+			}
+			return vtex;
 		}
 
-		// Deloads the given object type
-		MUDEF void mug_gobject_deload(mugContext* context, muGraphic gfx, mugObjectType obj_type) {
-			// Get inner graphic handle
-			mug_Graphic* igfx = (mug_Graphic*)gfx;
+		MUDEF mugVirtualTexture mug_vtexture_destroy(mugContext* context, muGraphic gfx, mugVirtualTexture vtex) {
+			mug_VirtualTexture* ivtex = (mug_VirtualTexture*)vtex;
 
-			// Do things based on graphic system
-			switch (igfx->system) {
-				default: break;
+			// Destroy page cache
+			if (ivtex->cache) {
+				mug_gtexture_destroy(context, gfx, ivtex->cache);
+			}
 
-				// OpenGL
-				#ifdef MU_SUPPORT_OPENGL
-					case MU_GRAPHIC_OPENGL: {
-						// Bind OpenGL
-						mugGraphicGL_bind(igfx);
-						// Deload
-						mugGL_deload_object_type((mugGL_Context*)igfx->p, obj_type);
-					} break;
-				#endif
+			// Free tables, slots, and staging buffer
+			if (ivtex->tables) {
+				mug_dealloc(ivtex->tables, MUG_ALLOC_GENERAL);
+			}
+			if (ivtex->slots) {
+				mug_dealloc(ivtex->slots, MUG_ALLOC_GENERAL);
+			}
+			if (ivtex->staging) {
+				mug_dealloc(ivtex->staging, MUG_ALLOC_GENERAL);
 			}
 
-			// To avoid unused parameter warnings
-			return; if (context) {} if (obj_type) {}
+			// Free virtual texture
+			mug_dealloc(ivtex, MUG_ALLOC_GENERAL);
+			return 0;
 		}
 
-		// Sets modification variable for given object type
-		MUDEF void mug_gobject_mod(mugContext* context, muGraphic gfx, mugObjectType type, mugObjectMod mod, float* data) {
-			// Get inner graphic handle
+		MUDEF void mug_vtexture_draw(mugContext* context, mugResult* result, muGraphic gfx, mugVirtualTexture vtex, float* rect) {
 			mug_Graphic* igfx = (mug_Graphic*)gfx;
+			mug_VirtualTexture* ivtex = (mug_VirtualTexture*)vtex;
+			ivtex->missing = 0;
+			if (!(rect[2] > 0.f) || !(rect[3] > 0.f)) {
+				return;
+			}
 
-			// Do things based on graphic system
-			switch (igfx->system) {
-				default: break;
+			// Calculate visible part of image in normalized coordinates
+			double vis[4] = {
+				(0.0 - rect[0]) / rect[2], (0.0 - rect[1]) / rect[3],
+				((double)igfx->dim[0] - rect[0]) / rect[2], ((double)igfx->dim[1] - rect[1]) / rect[3]
+			};
+			for (uint32_m i = 0; i < 4; ++i) {
+				vis[i] = (vis[i] < 0.0) ? (0.0) : ((vis[i] > 1.0) ? (1.0) : (vis[i]));
+			}
+			if (vis[0] >= vis[2] || vis[1] >= vis[3]) {
+				return;
+			}
 
-				// OpenGL
-				#ifdef MU_SUPPORT_OPENGL
-					case MU_GRAPHIC_OPENGL: {
-						mugGL_object_type_mod((mugGL_Context*)igfx->p, 0, type, mod, data);
-					} break;
-				#endif
+			// Pick level whose pixels are between one and two per graphic pixel
+			double sx = (double)ivtex->info.dim[0] / rect[2], sy = (double)ivtex->info.dim[1] / rect[3];
+			double scale = (sx > sy) ? (sx) : (sy);
+			uint32_m level = 0;
+			while (scale >= 2.0 && level+1 < ivtex->levels) {
+				scale *= 0.5;
+				++level;
 			}
 
-			// To avoid unused parameter warnings
-			return; if (context) {} if (type) {} if (mod) {} if (data) {}
-		}
+			// Calculate range of visible tiles
+			double ts = (double)ivtex->info.tile_size;
+			double lw = (double)ivtex->level_dim[level][0], lh = (double)ivtex->level_dim[level][1];
+			uint32_m tx0 = (uint32_m)(vis[0]*lw / ts), ty0 = (uint32_m)(vis[1]*lh / ts);
+			double ex = vis[2]*lw / ts, ey = vis[3]*lh / ts;
+			uint32_m tx1 = (uint32_m)ex, ty1 = (uint32_m)ey;
+			tx1 += ((double)tx1 < ex);
+			ty1 += ((double)ty1 < ey);
+			tx1 = (tx1 > ivtex->level_tiles[level][0]) ? (ivtex->level_tiles[level][0]) : (tx1);
+			ty1 = (ty1 > ivtex->level_tiles[level][1]) ? (ivtex->level_tiles[level][1]) : (ty1);
+			tx0 = (tx0 >= tx1) ? (tx1-1) : (tx0);
+			ty0 = (ty0 >= ty1) ? (ty1-1) : (ty0);
+			uint32_m tw = tx1-tx0;
+
+			// Mark lowest level and everything that visible tiles would be drawn with as needed,
+			// counting visible tiles that aren't resident
+			uint32_m top = ivtex->levels-1;
+			++ivtex->draw;
+			mugVTexture_touch(ivtex, top, 0, 0);
+			uint32_m missing = 0;
+			for (uint32_m y = ty0; y < ty1; ++y) {
+				for (uint32_m x = tx0; x < tx1; ++x) {
+					uint32_m found = mugVTexture_find(ivtex, level, x, y);
+					if (found != level) {
+						++missing;
+					}
+					if (found != MUG_VTEXTURE_NONE) {
+						mugVTexture_touch(ivtex, found, x >> (found-level), y >> (found-level));
+					}
+				}
+			}
 
-	/* Object buffer stuff */
+			// Load missing tiles
+			if (missing || *mugVTexture_entry(ivtex, top, 0, 0) == MUG_VTEXTURE_NONE) {
+				// Pending immediate draws are stored on the arena, so render them first
+				mugDraw_flush(igfx, result);
+				uint32_m budget = ivtex->info.upload_tiles;
 
-		// Creates an object buffer
-		MUDEF mugObjects mug_gobjects_create(mugContext* context, mugResult* result, muGraphic gfx, mugObjectType type, uint32_m obj_count, void* objs) {
-			// Get inner graphic handle
-			mug_Graphic* igfx = (mug_Graphic*)gfx;
+				// Load lowest level first, as it's the fallback for everything else
+				if (*mugVTexture_entry(ivtex, top, 0, 0) == MUG_VTEXTURE_NONE) {
+					if (mugVTexture_load(context, result, gfx, ivtex, top, 0, 0) == 0) {
+						--budget;
+					}
+				}
 
-			// Do things based on graphic system
-			switch (igfx->system) {
-				default: return 0; break;
+				// Sort missing tiles by distance from center of view
+				size_m key_offset = (budget && missing) ? (mug_arena_push(&igfx->arena, sizeof(uint64_m)*missing)) : (MU_SIZE_MAX);
+				if (key_offset != MU_SIZE_MAX) {
+					uint64_m* keys = (uint64_m*)&igfx->arena.data[key_offset];
+					double cx = (vis[0]+vis[2])*0.5*lw / ts, cy = (vis[1]+vis[3])*0.5*lh / ts;
+					uint32_m k = 0;
+					for (uint32_m y = ty0; y < ty1; ++y) {
+						for (uint32_m x = tx0; x < tx1; ++x) {
+							if (*mugVTexture_entry(ivtex, level, x, y) != MUG_VTEXTURE_NONE) {
+								continue;
+							}
+							double dx = (double)x+0.5 - cx, dy = (double)y+0.5 - cy;
+							double dist = (dx*dx + dy*dy) * 256.0;
+							uint64_m d = (dist > 4294967295.0) ? (0xFFFFFFFF) : ((uint64_m)dist);
+							keys[k++] = (d << 32) | (uint64_m)((y-ty0)*tw + (x-tx0));
+						}
+					}
+					mu_qsort(keys, k, sizeof(uint64_m), mug_compare_key_asc);
+
+					// Load closest tiles until budget runs out
+					for (uint32_m i = 0; i < k && budget; ++i) {
+						uint32_m index = (uint32_m)(keys[i] & 0xFFFFFFFF);
+						uint32_m state = mugVTexture_load(context, result, gfx, ivtex, level, tx0 + index%tw, ty0 + index/tw);
+						if (state == 0) {
+							--budget;
+						} else if (state == 2) {
+							break;
+						}
+					}
 
-				// OpenGL
-				#ifdef MU_SUPPORT_OPENGL
-					case MU_GRAPHIC_OPENGL: {
-						mugGraphicGL_bind(igfx);
-						return mugGL_object_buffer_create(igfx, (mugGL_Context*)igfx->p, result, type, obj_count, objs);
-					} break;
-				#endif
+					mug_arena_pop(&igfx->arena, key_offset);
+				}
+				else if (budget && missing) {
+					MU_SET_RESULT(result, MUG_FAILED_MALLOC)
+				}
 			}
 
-			// To avoid unused parameter warnings
-			if (context) {} if (result) {} if (type) {} if (obj_count) {} if (objs) {}
-		}
-
-		// Destroys an object buffer
-		MUDEF mugObjects mug_gobjects_destroy(mugContext* context, muGraphic gfx, mugObjects objs) {
-			// Get inner graphic handle
-			mug_Graphic* igfx = (mug_Graphic*)gfx;
+			// Draw each visible tile with the highest level resident
+			for (uint32_m y = ty0; y < ty1; ++y) {
+				for (uint32_m x = tx0; x < tx1; ++x) {
+					uint32_m found = mugVTexture_find(ivtex, level, x, y);
+					if (found != level) {
+						++ivtex->missing;
+					}
+					if (found == MUG_VTEXTURE_NONE) {
+						continue;
+					}
 
-			// Do things based on graphic system
-			switch (igfx->system) {
-				default: return 0; break;
+					// Calculate part of image that the tile covers
+					double uv[4] = {
+						(x*ts) / lw, (y*ts) / lh,
+						((x+1)*ts) / lw, ((y+1)*ts) / lh
+					};
+					uv[2] = (uv[2] > 1.0) ? (1.0) : (uv[2]);
+					uv[3] = (uv[3] > 1.0) ? (1.0) : (uv[3]);
 
-				// OpenGL
-				#ifdef MU_SUPPORT_OPENGL
-					case MU_GRAPHIC_OPENGL: {
-						return mugGL_object_buffer_destroy((mugGL_ObjBuffer*)objs);
-					} break;
-				#endif
+					mugVTexture_draw_tile(igfx, result, ivtex, rect, uv, found, x >> (found-level), y >> (found-level));
+				}
 			}
 
 			// To avoid unused parameter warnings
-			if (context) {} if (objs) {}
+			return; if (context) {}
 		}
 
-		MUDEF void mug_gobjects_render(mugContext* context, mugResult* result, muGraphic gfx, mugObjects objs) {
-			// Get inner graphic handle
-			mug_Graphic* igfx = (mug_Graphic*)gfx;
-
-			// Do things based on graphic system
-			switch (igfx->system) {
-				default: break;
-
-				// OpenGL
-				#ifdef MU_SUPPORT_OPENGL
-					case MU_GRAPHIC_OPENGL: {
-						mugGraphicGL_bind(igfx);
-						mugGL_object_buffer_render((mugGL_Context*)igfx->p, (mugGL_ObjBuffer*)objs);
-					} break;
-				#endif
-			}
+		MUDEF uint32_m mug_vtexture_missing(mugContext* context, muGraphic gfx, mugVirtualTexture vtex) {
+			return ((mug_VirtualTexture*)vtex)->missing;
 
 			// To avoid unused parameter warnings
-			return; if (context) {} if (result) {} if (objs) {}
+			if (context) {} if (gfx) {}
 		}
 
-		MUDEF void mug_gobjects_subrender(mugContext* context, mugResult* result, muGraphic gfx, mugObjects objs, uint32_m offset, uint32_m count) {
+	/* Render target stuff */
+
+		MUDEF mugTarget mug_gtarget_create(mugContext* context, mugResult* result, muGraphic gfx, uint32_m* dim, muBool depth) {
 			// Get inner graphic handle
 			mug_Graphic* igfx = (mug_Graphic*)gfx;
 
 			// Do things based on graphic system
 			switch (igfx->system) {
-				default: break;
+				default: return 0; break;
 
 				// OpenGL
 				#ifdef MU_SUPPORT_OPENGL
 					case MU_GRAPHIC_OPENGL: {
 						mugGraphicGL_bind(igfx);
-						mugGL_object_buffer_subrender((mugGL_Context*)igfx->p, (mugGL_ObjBuffer*)objs, offset, count);
+						return mugGL_target_get((mugGL_Context*)igfx->p, result, dim, depth);
 					} break;
 				#endif
 			}
 
 			// To avoid unused parameter warnings
-			return; if (context) {} if (result) {} if (objs) {} if (offset) {} if (count) {}
+			if (context) {} if (result) {} if (dim) {} if (depth) {}
 		}
 
-		MUDEF void mug_gobjects_fill(mugContext* context, mugResult* result, muGraphic gfx, mugObjects objs, void* data) {
+		MUDEF mugTarget mug_gtarget_destroy(mugContext* context, muGraphic gfx, mugTarget target) {
 			// Get inner graphic handle
 			mug_Graphic* igfx = (mug_Graphic*)gfx;
 
 			// Do things based on graphic system
 			switch (igfx->system) {
-				default: break;
+				default: return 0; break;
 
 				// OpenGL
 				#ifdef MU_SUPPORT_OPENGL
 					case MU_GRAPHIC_OPENGL: {
-						mugResult res = mugGL_objects_fill((mugGL_ObjBuffer*)objs, data);
-						if (res != MUG_SUCCESS) {
-							MU_SET_RESULT(result, res)
-						}
+						mugGraphicGL_bind(igfx);
+						return mugGL_target_release((mugGL_Context*)igfx->p, (mugGL_Target*)target);
 					} break;
 				#endif
 			}
 
 			// To avoid unused parameter warnings
-			return; if (context) {} if (result) {} if (objs) {} if (data) {}
+			if (context) {} if (target) {}
 		}
 
-		MUDEF void mug_gobjects_subfill(mugContext* context, mugResult* result, muGraphic gfx, mugObjects objs, uint32_m offset, uint32_m count, void* data) {
+		MUDEF void mug_graphic_target_pool(mugContext* context, muGraphic gfx, uint32_m count) {
 			// Get inner graphic handle
 			mug_Graphic* igfx = (mug_Graphic*)gfx;
 
@@ -12750,81 +22018,87 @@ It is likely that [object type modifiers](#object-type-modifiers) would work bet
 				#ifdef MU_SUPPORT_OPENGL
 					case MU_GRAPHIC_OPENGL: {
 						mugGraphicGL_bind(igfx);
-						mugResult res = mugGL_objects_subfill((mugGL_ObjBuffer*)objs, offset, count, data);
-						if (res != MUG_SUCCESS) {
-							MU_SET_RESULT(result, res)
-						}
+						mugGL_Context* ic = (mugGL_Context*)igfx->p;
+						ic->target_pool_max = count;
+						mugGL_target_pool_trim(ic, count);
 					} break;
 				#endif
 			}
 
 			// To avoid unused parameter warnings
-			return; if (context) {} if (result) {} if (objs) {} if (offset) {} if (count) {} if (data) {}
+			return; if (context) {} if (count) {}
 		}
 
-		MUDEF void mug_gobjects_texture(mugContext* context, muGraphic gfx, mugObjects obj, mugTexture tex) {
+		MUDEF mugTexture mug_gtarget_texture(mugContext* context, muGraphic gfx, mugTarget target) {
 			// Get inner graphic handle
 			mug_Graphic* igfx = (mug_Graphic*)gfx;
 
 			// Do things based on graphic system
 			switch (igfx->system) {
-				default: break;
+				default: return 0; break;
 
 				// OpenGL
 				#ifdef MU_SUPPORT_OPENGL
 					case MU_GRAPHIC_OPENGL: {
-						mugGraphicGL_bind(igfx);
-						mugGL_objects_texture((mugGL_ObjBuffer*)obj, (mugGL_Texture*)tex);
+						return ((mugGL_Target*)target)->tex;
 					} break;
 				#endif
 			}
 
 			// To avoid unused parameter warnings
-			return; if (context) {} if (obj) {} if (tex) {}
+			if (context) {} if (target) {}
 		}
 
-	/* Texture stuff */
-
-		MUDEF mugTexture mug_gtexture_create(mugContext* context, mugResult* result, muGraphic gfx, mugTextureInfo* info, uint32_m* dim, muByte* data) {
+		MUDEF void mug_graphic_begin_target(mugContext* context, mugResult* result, muGraphic gfx, mugTarget target) {
 			// Get inner graphic handle
 			mug_Graphic* igfx = (mug_Graphic*)gfx;
 
+			// Pending immediate draws belong to what was being rendered to before
+			mugDraw_flush(igfx, result);
+
 			// Do things based on graphic system
 			switch (igfx->system) {
-				default: return 0; break;
+				default: break;
 
 				// OpenGL
 				#ifdef MU_SUPPORT_OPENGL
 					case MU_GRAPHIC_OPENGL: {
 						mugGraphicGL_bind(igfx);
-						return mugGL_texture_create(result, info, dim, data);
+						mugGL_target_begin(igfx, (mugGL_Target*)target);
 					} break;
 				#endif
 			}
 
 			// To avoid unused parameter warnings
-			if (context) {} if (result) {} if (info) {} if (dim) {} if (data) {}
+			return; if (context) {} if (target) {}
 		}
 
-		MUDEF mugTexture mug_gtexture_destroy(mugContext* context, muGraphic gfx, mugTexture tex) {
+		MUDEF void mug_graphic_end_target(mugContext* context, muGraphic gfx) {
 			// Get inner graphic handle
 			mug_Graphic* igfx = (mug_Graphic*)gfx;
 
+			// Pending immediate draws belong to the target
+			mugDraw_flush(igfx, 0);
+
 			// Do things based on graphic system
 			switch (igfx->system) {
-				default: return 0; break;
+				default: break;
 
 				// OpenGL
 				#ifdef MU_SUPPORT_OPENGL
 					case MU_GRAPHIC_OPENGL: {
 						mugGraphicGL_bind(igfx);
-						return mugGL_texture_destroy((mugGL_Texture*)tex);
+						mugGL_target_end(igfx);
 					} break;
 				#endif
 			}
 
+			// Graphic needs to be redrawn wherever the target's texture is used
+			igfx->redraw = MU_TRUE;
+			mug_damage_full(&igfx->damage);
+
 			// To avoid unused parameter warnings
-			if (context) {} if (tex) {}
+			return; if (context) {}
 		}
 
 	/* Misc. */
@@ -12842,7 +22116,7 @@ It is likely that [object type modifiers](#object-type-modifiers) would work bet
 				#ifdef MU_SUPPORT_OPENGL
 					case MU_GRAPHIC_OPENGL: {
 						mugGraphicGL_bind(igfx);
-						return mugGL_max(max);
+						return mugGL_max(igfx, max);
 					} break;
 				#endif
 			}
@@ -12968,6 +22242,19 @@ It is likely that [object type modifiers](#object-type-modifiers) would work bet
 				case MUG_UNKNOWN_GRAPHIC_SYSTEM: return "MUG_UNKNOWN_GRAPHIC_SYSTEM"; break;
 				case MUG_UNKNOWN_OBJECT_TYPE: return "MUG_UNKNOWN_OBJECT_TYPE"; break;
 				case MUG_UNKNOWN_OBJECT_MOD: return "MUG_UNKNOWN_OBJECT_MOD"; break;
+				case MUG_INVALID_SCENE_OBJECT: return "MUG_INVALID_SCENE_OBJECT"; break;
+				case MUG_NO_SPATIAL_INDEX: return "MUG_NO_SPATIAL_INDEX"; break;
+				case MUG_INVALID_TEXTURE_REGION: return "MUG_INVALID_TEXTURE_REGION"; break;
+				case MUG_ATLAS_FULL: return "MUG_ATLAS_FULL"; break;
+				case MUG_UNSUPPORTED_TEXTURE_FORMAT: return "MUG_UNSUPPORTED_TEXTURE_FORMAT"; break;
+				case MUG_FAILED_DECODE_IMAGE: return "MUG_FAILED_DECODE_IMAGE"; break;
+				case MUG_TEXTURE_NOT_LOADED: return "MUG_TEXTURE_NOT_LOADED"; break;
+				case MUG_FAILED_CREATE_THREAD: return "MUG_FAILED_CREATE_THREAD"; break;
+				case MUG_FAILED_ACCESS_FILE: return "MUG_FAILED_ACCESS_FILE"; break;
+				case MUG_INVALID_TEXTURE_FILE: return "MUG_INVALID_TEXTURE_FILE"; break;
+				case MUG_INVALID_VIRTUAL_TEXTURE: return "MUG_INVALID_VIRTUAL_TEXTURE"; break;
+				case MUG_TEXTURE_POOL_FULL: return "MUG_TEXTURE_POOL_FULL"; break;
+				case MUG_UNSUPPORTED_PRESENT_MODE: return "MUG_UNSUPPORTED_PRESENT_MODE"; break;
 
 				case MUG_GL_FAILED_LOAD: return "MUG_GL_FAILED_LOAD"; break;
 				case MUG_GL_FAILED_COMPILE_VERTEX_SHADER: return "MUG_GL_FAILED_COMPILE_VERTEX_SHADER";
@@ -12977,6 +22264,7 @@ It is likely that [object type modifiers](#object-type-modifiers) would work bet
 				case MUG_GL_FAILED_CREATE_BUFFER: return "MUG_GL_FAILED_CREATE_BUFFER"; break;
 				case MUG_GL_FAILED_CREATE_VERTEX_ARRAY: return "MUG_GL_FAILED_CREATE_VERTEX_ARRAY"; break;
 				case MUG_GL_FAILED_GENERATE_TEXTURE: return "MUG_GL_FAILED_GENERATE_TEXTURE"; break;
+				case MUG_GL_FAILED_CREATE_FRAMEBUFFER: return "MUG_GL_FAILED_CREATE_FRAMEBUFFER"; break;
 
 				case MUG_MUCOSA_FAILED_NULL_WINDOW_SYSTEM: return "MUG_MUCOSA_FAILED_NULL_WINDOW_SYSTEM"; break;
 				case MUG_MUCOSA_FAILED_MALLOC: return "MUG_MUCOSA_FAILED_MALLOC"; break;
@@ -0,0 +1,196 @@
+/*
+============================================================
+                        TOOL INFO
+
+TOOL NAME:          mugconv_bench.c
+TOOL WRITTEN BY:    Muukid
+CREATION DATE:      2026-10-18
+LAST UPDATED:       2026-10-18
+
+============================================================
+                        TOOL PURPOSE
+
+This tool benchmarks the pixel conversions that mug performs
+while uploading textures (see mug_texture_convert): RGB to
+RGBA expansion, BGR(A) swizzling, alpha premultiplication,
+grayscale packing, and gray expansion, along with a plain
+copy as a reference. Each case converts a 2048x2048 image
+several times, and the best time is printed in megapixels
+per second.
+
+It's built like any other program using mug, for example:
+cc -O2 -I.. mugconv_bench.c -o mugconv_bench (plus the
+libraries needed by muCOSA on the given operating system).
+Building with -mssse3 (or an -march that implies it) or for
+ARM with NEON enables the SIMD conversions, and defining
+MUG_NO_SIMD disables them, so the tool can be built both
+ways to compare them.
+
+============================================================
+                        LICENSE INFO
+
+This software is licensed under:
+(MIT license OR public domain) AND Apache 2.0.
+More explicit license information at the end of file.
+
+============================================================
+*/
+
+/* Inclusion */
+
+	// Include mug
+	#define MUG_IMPLEMENTATION // (For source code)
+	#include "muGraphics.h"
+
+	// Include stdio for printing
+	#include <stdio.h>
+
+	// Include stdlib for memory allocation
+	#include <stdlib.h>
+
+	// Include time for timing
+	#include <time.h>
+
+/* Benchmark logic */
+
+	// Image dimensions
+	#define WIDTH 2048
+	#define HEIGHT 2048
+	// Amount of times each case is run (the best time is kept)
+	#define RUNS 10
+
+	// A conversion being benchmarked
+	struct Case {
+		const char* name;
+		mugTextureFormat src_format;
+		mugTextureFormat dst_format;
+		mugTextureConversion convert;
+	};
+	typedef struct Case Case;
+
+	Case cases[] = {
+		{ "RGBA copy (reference)", MUG_TEXTURE_U8_RGBA, MUG_TEXTURE_U8_RGBA, 0 },
+		{ "RGB -> RGBA", MUG_TEXTURE_U8_RGB, MUG_TEXTURE_U8_RGBA, 0 },
+		{ "BGR -> RGBA", MUG_TEXTURE_U8_RGB, MUG_TEXTURE_U8_RGBA, MUG_TEXTURE_CONVERT_BGR },
+		{ "BGRA -> RGBA", MUG_TEXTURE_U8_RGBA, MUG_TEXTURE_U8_RGBA, MUG_TEXTURE_CONVERT_BGR },
+		{ "RGBA premultiply", MUG_TEXTURE_U8_RGBA, MUG_TEXTURE_U8_RGBA, MUG_TEXTURE_CONVERT_PREMULTIPLY },
+		{ "BGRA -> RGBA premultiply", MUG_TEXTURE_U8_RGBA, MUG_TEXTURE_U8_RGBA, MUG_TEXTURE_CONVERT_BGR | MUG_TEXTURE_CONVERT_PREMULTIPLY },
+		{ "RGBA -> R (luma)", MUG_TEXTURE_U8_RGBA, MUG_TEXTURE_U8_R, 0 },
+		{ "RGB -> R (luma)", MUG_TEXTURE_U8_RGB, MUG_TEXTURE_U8_R, 0 },
+		{ "R -> RGBA", MUG_TEXTURE_U8_R, MUG_TEXTURE_U8_RGBA, 0 },
+	};
+
+	// Returns the current processor time, in seconds
+	double now(void) {
+		return (double)clock() / (double)CLOCKS_PER_SEC;
+	}
+
+int main(void)
+{
+	// Allocate source and destination images (big enough for any format)
+	size_m size = (size_m)WIDTH * HEIGHT * 4;
+	muByte* src = (muByte*)malloc(size);
+	muByte* dst = (muByte*)malloc(size);
+	if (!src || !dst) {
+		printf("Failed to allocate images\n");
+		return -1;
+	}
+
+	// Fill source with noise
+	uint32_m seed = 1;
+	for (size_m i = 0; i < size; ++i) {
+		seed = seed * 1664525 + 1013904223;
+		src[i] = (muByte)(seed >> 24);
+	}
+
+	#if defined(MUG_NO_SIMD)
+		printf("SIMD disabled\n");
+	#endif
+
+	// Run each case
+	for (size_m c = 0; c < sizeof(cases) / sizeof(Case); ++c) {
+		double best = 0.0;
+		for (uint32_m r = 0; r < RUNS; ++r) {
+			double start = now();
+			mugResult result = MUG_SUCCESS;
+			mug_texture_convert(0, &result, cases[c].src_format, cases[c].dst_format, cases[c].convert, WIDTH, HEIGHT, 0, src, dst);
+			double time = now() - start;
+			if (result != MUG_SUCCESS) {
+				printf("%s failed\n", cases[c].name);
+				return -1;
+			}
+			if (r == 0 || time < best) {
+				best = time;
+			}
+		}
+		printf("%-26s %8.1f MPix/s\n", cases[c].name,
+			(best > 0.0) ? (((double)WIDTH * HEIGHT / 1000000.0) / best) : (0.0)
+		);
+	}
+
+	free(src);
+	free(dst);
+	return 0;
+}
+
+/*
+For all source code:
+
+	------------------------------------------------------------------------------
+	This software is available under 2 licenses -- choose whichever you prefer.
+	------------------------------------------------------------------------------
+	ALTERNATIVE A - MIT License
+	Copyright (c) 2024 Hum
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+	of the Software, and to permit persons to whom the Software is furnished to do
+	so, subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+	------------------------------------------------------------------------------
+	ALTERNATIVE B - Public Domain (www.unlicense.org)
+	This is free and unencumbered software released into the public domain.
+	Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+	software, either in source code form or as a compiled binary, for any purpose,
+	commercial or non-commercial, and by any means.
+	In jurisdictions that recognize copyright laws, the author or authors of this
+	software dedicate any and all copyright interest in the software to the public
+	domain. We make this dedication for the benefit of the public at large and to
+	the detriment of our heirs and successors. We intend this dedication to be an
+	overt act of relinquishment in perpetuity of all present and future rights to
+	this software under copyright law.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+	ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+	WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+	------------------------------------------------------------------------------
+
+For Khronos specifications:
+	
+	Copyright (c) 2013-2020 The Khronos Group Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+
+*/
+
@@ -0,0 +1,363 @@
+/*
+============================================================
+                        TOOL INFO
+
+TOOL NAME:          mugtex_bake.c
+TOOL WRITTEN BY:    Muukid
+CREATION DATE:      2026-10-18
+LAST UPDATED:       2026-10-18
+
+============================================================
+                        TOOL PURPOSE
+
+This tool bakes images into .mugtex texture files, which
+mug can load via mug_gtexture_create_from_file without any
+decoding or conversion. It reads QOI, TGA, and PPM/PGM
+images, converts them to the requested texture format
+(compressing them for block-compressed formats), optionally
+generates their mipmap levels, and combines several images
+into a texture array.
+
+It's built like any other program using mug, for example:
+cc -I.. mugtex_bake.c -o mugtex_bake (plus the libraries
+needed by muCOSA on the given operating system).
+
+Run it without arguments to print its usage.
+
+============================================================
+                        LICENSE INFO
+
+This software is licensed under:
+(MIT license OR public domain) AND Apache 2.0.
+More explicit license information at the end of file.
+
+============================================================
+*/
+
+/* Inclusion */
+
+	// Include mug
+	#define MUG_IMPLEMENTATION // (For source code)
+	#include "muGraphics.h"
+
+	// Include stdio for printing and reading files
+	#include <stdio.h>
+
+	// Include stdlib for memory allocation
+	#include <stdlib.h>
+
+	// Include string for argument parsing
+	#include <string.h>
+
+/* Image logic */
+
+	// Maximum amount of images (layers)
+	#define MAX_IMAGES 256
+
+	// Decoded images (RGBA)
+	muByte* images[MAX_IMAGES];
+	uint32_m image_count = 0;
+	uint32_m dim[3];
+
+	// Reads and decodes an image; returns whether or not it succeeded
+	muBool load_image(const char* path, uint32_m index) {
+		// Read file
+		FILE* file = fopen(path, "rb");
+		if (!file) {
+			printf("Failed to open \"%s\"\n", path);
+			return MU_FALSE;
+		}
+		fseek(file, 0, SEEK_END);
+		long size = ftell(file);
+		fseek(file, 0, SEEK_SET);
+		muByte* data = (muByte*)malloc((size > 0) ? (size) : (1));
+		size_t read = fread(data, 1, (size > 0) ? (size) : (0), file);
+		fclose(file);
+
+		// Decode it
+		uint32_m image_dim[2];
+		mugResult result = MUG_SUCCESS;
+		images[index] = mug_image_decode(0, &result, data, read, image_dim);
+		free(data);
+		if (!images[index]) {
+			printf("Failed to decode \"%s\"\n", path);
+			return MU_FALSE;
+		}
+
+		// Make sure every image has the same dimensions
+		if (index == 0) {
+			dim[0] = image_dim[0];
+			dim[1] = image_dim[1];
+		} else if (image_dim[0] != dim[0] || image_dim[1] != dim[1]) {
+			printf("\"%s\" is %ux%u, but the first image is %ux%u\n", path,
+				(unsigned)image_dim[0], (unsigned)image_dim[1], (unsigned)dim[0], (unsigned)dim[1]
+			);
+			return MU_FALSE;
+		}
+		return MU_TRUE;
+	}
+
+	// Downscales an RGBA image to half its width and height (never below 1) in-place,
+	// averaging each 2x2 square of pixels
+	void downscale(muByte* pixels, uint32_m w, uint32_m h) {
+		uint32_m dw = (w > 1) ? (w/2) : (1), dh = (h > 1) ? (h/2) : (1);
+		for (uint32_m y = 0; y < dh; ++y) {
+			uint32_m y0 = (y*2 < h) ? (y*2) : (h-1), y1 = (y*2+1 < h) ? (y*2+1) : (h-1);
+			for (uint32_m x = 0; x < dw; ++x) {
+				uint32_m x0 = (x*2 < w) ? (x*2) : (w-1), x1 = (x*2+1 < w) ? (x*2+1) : (w-1);
+				for (uint32_m c = 0; c < 4; ++c) {
+					uint32_m sum = pixels[(y0*w + x0)*4 + c] + pixels[(y0*w + x1)*4 + c]
+						+ pixels[(y1*w + x0)*4 + c] + pixels[(y1*w + x1)*4 + c];
+					pixels[(y*dw + x)*4 + c] = (muByte)((sum + 2) / 4);
+				}
+			}
+		}
+	}
+
+	// Converts an RGBA image to a texture format, writing it to dst
+	void convert(muByte* pixels, uint32_m w, uint32_m h, mugTextureFormat format, muByte* dst) {
+		size_m count = (size_m)w*h;
+		switch (format) {
+			default: break;
+
+			// Uncompressed
+			case MUG_TEXTURE_U8_R: case MUG_TEXTURE_U8_RGB: case MUG_TEXTURE_U8_RGBA: {
+				uint32_m channels = (format == MUG_TEXTURE_U8_R) ? (1) : ((format == MUG_TEXTURE_U8_RGB) ? (3) : (4));
+				for (size_m i = 0; i < count; ++i) {
+					for (uint32_m c = 0; c < channels; ++c) {
+						dst[i*channels + c] = pixels[i*4 + c];
+					}
+				}
+			} break;
+
+			// Compressed
+			case MUG_TEXTURE_BC1_RGBA: case MUG_TEXTURE_BC3_RGBA: {
+				mug_texture_compress(0, 0, format, w, h, 0, pixels, dst);
+			} break;
+			case MUG_TEXTURE_BC4_R: {
+				muByte* red = (muByte*)malloc(count);
+				for (size_m i = 0; i < count; ++i) {
+					red[i] = pixels[i*4];
+				}
+				mug_texture_compress(0, 0, format, w, h, 0, red, dst);
+				free(red);
+			} break;
+		}
+	}
+
+/* Argument logic */
+
+	// Texture info, changed by options
+	mugTextureInfo texinfo = {
+		// Type (changed to 2D array if there's more than one image)
+		MUG_TEXTURE_2D,
+		// Format (uint8_m RGBA by default)
+		MUG_TEXTURE_U8_RGBA,
+		// Wrapping x and y (repeat by default)
+		{ MUG_TEXTURE_REPEAT, MUG_TEXTURE_REPEAT },
+		// Filtering up-/downscale (bilinear by default)
+		{ MUG_TEXTURE_BILINEAR, MUG_TEXTURE_BILINEAR },
+		// Mip levels (set to the amount stored)
+		0,
+		// Conversion (none)
+		0
+	};
+
+	// Whether or not to generate mipmap levels
+	muBool mipmaps = MU_FALSE;
+
+	// Prints usage
+	void print_usage(void) {
+		printf("Usage: mugtex_bake [options] <output.mugtex> <image> [image...]\n");
+		printf("Converts QOI, TGA, or PPM/PGM images to a .mugtex texture file.\n");
+		printf("More than one image creates a texture array (all images must be the same size).\n");
+		printf("Options:\n");
+		printf("  -f <format>  rgba (default), rgb, r, bc1, bc3, or bc4\n");
+		printf("  -w <wrap>    repeat (default), mirror, or clamp\n");
+		printf("  -n           nearest-neighbor filtering (bilinear by default)\n");
+		printf("  -m           generate mipmap levels, using trilinear downscale filtering\n");
+	}
+
+	// Parses a format name
+	muBool parse_format(const char* name) {
+		const char* names[] = { "r", "rgb", "rgba", "bc1", "bc3", "bc4" };
+		mugTextureFormat formats[] = { MUG_TEXTURE_U8_R, MUG_TEXTURE_U8_RGB, MUG_TEXTURE_U8_RGBA, MUG_TEXTURE_BC1_RGBA, MUG_TEXTURE_BC3_RGBA, MUG_TEXTURE_BC4_R };
+		for (uint32_m i = 0; i < 6; ++i) {
+			if (strcmp(name, names[i]) == 0) {
+				texinfo.format = formats[i];
+				return MU_TRUE;
+			}
+		}
+		return MU_FALSE;
+	}
+
+	// Parses a wrapping name
+	muBool parse_wrapping(const char* name) {
+		const char* names[] = { "repeat", "mirror", "clamp" };
+		mugTextureWrapping wrappings[] = { MUG_TEXTURE_REPEAT, MUG_TEXTURE_MIRRORED_REPEAT, MUG_TEXTURE_CLAMP };
+		for (uint32_m i = 0; i < 3; ++i) {
+			if (strcmp(name, names[i]) == 0) {
+				texinfo.wrapping[0] = texinfo.wrapping[1] = wrappings[i];
+				return MU_TRUE;
+			}
+		}
+		return MU_FALSE;
+	}
+
+int main(int argc, char** argv)
+{
+
+/* Arguments */
+
+	int arg = 1;
+	for (; arg < argc && argv[arg][0] == '-'; ++arg) {
+		if (strcmp(argv[arg], "-f") == 0 && arg+1 < argc && parse_format(argv[arg+1])) {
+			++arg;
+		} else if (strcmp(argv[arg], "-w") == 0 && arg+1 < argc && parse_wrapping(argv[arg+1])) {
+			++arg;
+		} else if (strcmp(argv[arg], "-n") == 0) {
+			texinfo.filtering[0] = texinfo.filtering[1] = MUG_TEXTURE_NEAREST;
+		} else if (strcmp(argv[arg], "-m") == 0) {
+			mipmaps = MU_TRUE;
+		} else {
+			print_usage();
+			return 1;
+		}
+	}
+	if (argc - arg < 2 || argc - arg - 1 > MAX_IMAGES) {
+		print_usage();
+		return 1;
+	}
+	const char* output = argv[arg++];
+
+/* Loading */
+
+	for (; arg < argc; ++arg) {
+		if (!load_image(argv[arg], image_count++)) {
+			return 1;
+		}
+	}
+	dim[2] = image_count;
+	if (image_count > 1) {
+		texinfo.type = MUG_TEXTURE_2D_ARRAY;
+	}
+
+/* Baking */
+
+	// Calculate amount of levels
+	uint32_m levels = 1;
+	if (mipmaps) {
+		uint32_m size = (dim[0] > dim[1]) ? (dim[0]) : (dim[1]);
+		while (size >>= 1) {
+			++levels;
+		}
+		texinfo.filtering[1] = MUG_TEXTURE_TRILINEAR;
+	}
+	texinfo.mip_levels = levels;
+
+	// Calculate total size of pixel data
+	size_m total = 0;
+	for (uint32_m l = 0; l < levels; ++l) {
+		uint32_m w = dim[0] >> l, h = dim[1] >> l;
+		total += mug_texture_data_size(texinfo.format, (w) ? (w) : (1), (h) ? (h) : (1)) * image_count;
+	}
+	muByte* data = (muByte*)malloc(total);
+
+	// Convert each level of each image, downscaling images in-place
+	muByte* dst = data;
+	for (uint32_m l = 0; l < levels; ++l) {
+		uint32_m w = dim[0] >> l, h = dim[1] >> l;
+		w = (w) ? (w) : (1);
+		h = (h) ? (h) : (1);
+		for (uint32_m i = 0; i < image_count; ++i) {
+			if (l > 0) {
+				uint32_m pw = dim[0] >> (l-1), ph = dim[1] >> (l-1);
+				downscale(images[i], (pw) ? (pw) : (1), (ph) ? (ph) : (1));
+			}
+			convert(images[i], w, h, texinfo.format, dst);
+			dst += mug_texture_data_size(texinfo.format, w, h);
+		}
+	}
+
+	// Write file
+	mugResult result = MUG_SUCCESS;
+	mug_texture_file_write(0, &result, output, &texinfo, dim, levels, data);
+
+/* Termination */
+
+	free(data);
+	for (uint32_m i = 0; i < image_count; ++i) {
+		mu_free(images[i]);
+	}
+
+	if (result != MUG_SUCCESS) {
+		printf("Failed to write \"%s\"\n", output);
+		return 1;
+	}
+	printf("Baked %u image(s) of %ux%u into \"%s\" (%u level(s), %lu bytes of pixel data)\n",
+		(unsigned)image_count, (unsigned)dim[0], (unsigned)dim[1], output, (unsigned)levels, (unsigned long)total
+	);
+	return 0;
+}
+
+/*
+For all source code:
+
+	------------------------------------------------------------------------------
+	This software is available under 2 licenses -- choose whichever you prefer.
+	------------------------------------------------------------------------------
+	ALTERNATIVE A - MIT License
+	Copyright (c) 2024 Hum
+	Permission is hereby granted, free of charge, to any person obtaining a copy of
+	this software and associated documentation files (the "Software"), to deal in
+	the Software without restriction, including without limitation the rights to
+	use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+	of the Software, and to permit persons to whom the Software is furnished to do
+	so, subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all
+	copies or substantial portions of the Software.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+	LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+	OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+	SOFTWARE.
+	------------------------------------------------------------------------------
+	ALTERNATIVE B - Public Domain (www.unlicense.org)
+	This is free and unencumbered software released into the public domain.
+	Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+	software, either in source code form or as a compiled binary, for any purpose,
+	commercial or non-commercial, and by any means.
+	In jurisdictions that recognize copyright laws, the author or authors of this
+	software dedicate any and all copyright interest in the software to the public
+	domain. We make this dedication for the benefit of the public at large and to
+	the detriment of our heirs and successors. We intend this dedication to be an
+	overt act of relinquishment in perpetuity of all present and future rights to
+	this software under copyright law.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+	IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+	FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+	AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+	ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+	WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+	------------------------------------------------------------------------------
+
+For Khronos specifications:
+	
+	Copyright (c) 2013-2020 The Khronos Group Inc.
+
+	Licensed under the Apache License, Version 2.0 (the "License");
+	you may not use this file except in compliance with the License.
+	You may obtain a copy of the License at
+
+		http://www.apache.org/licenses/LICENSE-2.0
+
+	Unless required by applicable law or agreed to in writing, software
+	distributed under the License is distributed on an "AS IS" BASIS,
+	WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	See the License for the specific language governing permissions and
+	limitations under the License.
+
+*/
+